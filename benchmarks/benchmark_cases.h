@@ -0,0 +1,30 @@
+#ifndef AWS_IO_BENCHMARK_CASES_H
+#define AWS_IO_BENCHMARK_CASES_H
+
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "benchmark_harness.h"
+
+/* event_loop_benchmarks.c */
+aws_benchmark_fn aws_benchmark_event_loop_xthread_schedule_now;
+
+/* task_scheduler_benchmarks.c */
+aws_benchmark_fn aws_benchmark_task_scheduler_insert_cancel_depth_100;
+aws_benchmark_fn aws_benchmark_task_scheduler_insert_cancel_depth_1000;
+aws_benchmark_fn aws_benchmark_task_scheduler_insert_cancel_depth_10000;
+
+/* message_pool_benchmarks.c */
+aws_benchmark_fn aws_benchmark_message_pool_acquire_release;
+
+/* channel_benchmarks.c */
+aws_benchmark_fn aws_benchmark_channel_send_message_2_slots;
+aws_benchmark_fn aws_benchmark_channel_send_message_3_slots;
+aws_benchmark_fn aws_benchmark_channel_send_message_5_slots;
+
+/* pipe_benchmarks.c */
+aws_benchmark_fn aws_benchmark_pipe_wakeup_latency;
+
+#endif /* AWS_IO_BENCHMARK_CASES_H */
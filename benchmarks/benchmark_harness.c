@@ -0,0 +1,52 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "benchmark_harness.h"
+
+#include <aws/common/clock.h>
+
+#include <stdio.h>
+
+uint64_t aws_benchmark_clock_ns(void) {
+    uint64_t now = 0;
+    aws_high_res_clock_get_ticks(&now);
+    return now;
+}
+
+int aws_benchmark_run_suite(
+    struct aws_allocator *allocator,
+    const struct aws_benchmark_case *cases,
+    size_t case_count) {
+
+    int suite_result = AWS_OP_SUCCESS;
+
+    printf("{\n  \"version\": 1,\n  \"benchmarks\": [\n");
+
+    for (size_t i = 0; i < case_count; ++i) {
+        fprintf(stderr, "running %s...\n", cases[i].name);
+
+        struct aws_benchmark_result result = {0};
+        int case_result = cases[i].fn(allocator, &result);
+
+        printf("    {\"name\": \"%s\"", cases[i].name);
+        if (case_result == AWS_OP_SUCCESS && result.iterations > 0) {
+            double ns_per_op = (double)result.total_ns / (double)result.iterations;
+            double ops_per_sec = ns_per_op > 0.0 ? 1e9 / ns_per_op : 0.0;
+            printf(
+                ", \"iterations\": %llu, \"total_ns\": %llu, \"ns_per_op\": %.2f, \"ops_per_sec\": %.0f}",
+                (unsigned long long)result.iterations,
+                (unsigned long long)result.total_ns,
+                ns_per_op,
+                ops_per_sec);
+        } else {
+            printf(", \"error\": \"%s\"}", aws_error_name(aws_last_error()));
+            suite_result = AWS_OP_ERR;
+        }
+        printf("%s\n", (i + 1 < case_count) ? "," : "");
+    }
+
+    printf("  ]\n}\n");
+    return suite_result;
+}
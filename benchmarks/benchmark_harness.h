@@ -0,0 +1,41 @@
+#ifndef AWS_IO_BENCHMARK_HARNESS_H
+#define AWS_IO_BENCHMARK_HARNESS_H
+
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/io/io.h>
+
+/**
+ * Tiny harness for the aws-c-io microbenchmarks. Each case runs a timed loop and fills in
+ * iterations/total_ns; the suite runner derives ns-per-op and emits one JSON document on stdout
+ * so results can be tracked across releases. Progress goes to stderr.
+ */
+
+struct aws_benchmark_result {
+    uint64_t iterations;
+    uint64_t total_ns;
+};
+
+typedef int(aws_benchmark_fn)(struct aws_allocator *allocator, struct aws_benchmark_result *result);
+
+struct aws_benchmark_case {
+    const char *name;
+    aws_benchmark_fn *fn;
+};
+
+/** Current time on the high-res clock, in nanoseconds. */
+uint64_t aws_benchmark_clock_ns(void);
+
+/**
+ * Runs every case in order and prints the JSON report. Returns AWS_OP_ERR (after finishing the
+ * report) if any case failed; failed cases are listed in the report with an "error" field.
+ */
+int aws_benchmark_run_suite(
+    struct aws_allocator *allocator,
+    const struct aws_benchmark_case *cases,
+    size_t case_count);
+
+#endif /* AWS_IO_BENCHMARK_HARNESS_H */
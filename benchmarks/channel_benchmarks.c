@@ -0,0 +1,294 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "benchmark_cases.h"
+
+#include <aws/common/clock.h>
+#include <aws/common/condition_variable.h>
+#include <aws/common/mutex.h>
+#include <aws/io/channel.h>
+#include <aws/io/event_loop.h>
+
+enum {
+    CHANNEL_SEND_ITERATIONS = 200 * 1000,
+    CHANNEL_SEND_MSG_SIZE = 1024,
+};
+
+struct channel_bench_ctx {
+    struct aws_mutex lock;
+    struct aws_condition_variable signal;
+    bool setup_done;
+    bool shutdown_done;
+    bool run_done;
+    int error_code;
+
+    struct aws_channel *channel;
+    struct aws_channel_slot *first_slot;
+    struct aws_channel_task send_task;
+    uint64_t total_ns;
+};
+
+static void s_channel_bench_flag_done(struct channel_bench_ctx *ctx, bool *flag, int error_code) {
+    aws_mutex_lock(&ctx->lock);
+    *flag = true;
+    if (ctx->error_code == AWS_ERROR_SUCCESS) {
+        ctx->error_code = error_code;
+    }
+    aws_mutex_unlock(&ctx->lock);
+    aws_condition_variable_notify_one(&ctx->signal);
+}
+
+static void s_channel_bench_wait(struct channel_bench_ctx *ctx, bool *flag) {
+    aws_mutex_lock(&ctx->lock);
+    while (!*flag) {
+        aws_condition_variable_wait(&ctx->signal, &ctx->lock);
+    }
+    aws_mutex_unlock(&ctx->lock);
+}
+
+static void s_channel_bench_on_setup(struct aws_channel *channel, int error_code, void *user_data) {
+    (void)channel;
+    struct channel_bench_ctx *ctx = user_data;
+    s_channel_bench_flag_done(ctx, &ctx->setup_done, error_code);
+}
+
+static void s_channel_bench_on_shutdown(struct aws_channel *channel, int error_code, void *user_data) {
+    (void)channel;
+    struct channel_bench_ctx *ctx = user_data;
+    s_channel_bench_flag_done(ctx, &ctx->shutdown_done, error_code);
+}
+
+/* Pass-through handler: forwards read messages to the next slot unchanged. */
+
+static int s_forwarding_process_read_message(
+    struct aws_channel_handler *handler,
+    struct aws_channel_slot *slot,
+    struct aws_io_message *message) {
+    (void)handler;
+    return aws_channel_slot_send_message(slot, message, AWS_CHANNEL_DIR_READ);
+}
+
+/* Terminal handler: consumes and releases every message, like an application would. */
+
+static int s_sink_process_read_message(
+    struct aws_channel_handler *handler,
+    struct aws_channel_slot *slot,
+    struct aws_io_message *message) {
+    (void)handler;
+    (void)slot;
+    aws_mem_release(message->allocator, message);
+    return AWS_OP_SUCCESS;
+}
+
+static int s_bench_process_write_message(
+    struct aws_channel_handler *handler,
+    struct aws_channel_slot *slot,
+    struct aws_io_message *message) {
+    (void)handler;
+    (void)slot;
+    (void)message;
+    return aws_raise_error(AWS_ERROR_UNIMPLEMENTED);
+}
+
+static int s_bench_increment_read_window(struct aws_channel_handler *handler, struct aws_channel_slot *slot, size_t size) {
+    (void)handler;
+    (void)slot;
+    (void)size;
+    return AWS_OP_SUCCESS;
+}
+
+static int s_bench_shutdown(
+    struct aws_channel_handler *handler,
+    struct aws_channel_slot *slot,
+    enum aws_channel_direction dir,
+    int error_code,
+    bool free_scarce_resources_immediately) {
+    (void)handler;
+    return aws_channel_slot_on_handler_shutdown_complete(slot, dir, error_code, free_scarce_resources_immediately);
+}
+
+static size_t s_bench_initial_window_size(struct aws_channel_handler *handler) {
+    (void)handler;
+    return SIZE_MAX;
+}
+
+static size_t s_bench_message_overhead(struct aws_channel_handler *handler) {
+    (void)handler;
+    return 0;
+}
+
+static void s_bench_destroy_handler(struct aws_channel_handler *handler) {
+    aws_mem_release(handler->alloc, handler);
+}
+
+static struct aws_channel_handler_vtable s_forwarding_handler_vtable = {
+    .process_read_message = s_forwarding_process_read_message,
+    .process_write_message = s_bench_process_write_message,
+    .increment_read_window = s_bench_increment_read_window,
+    .shutdown = s_bench_shutdown,
+    .initial_window_size = s_bench_initial_window_size,
+    .message_overhead = s_bench_message_overhead,
+    .destroy = s_bench_destroy_handler,
+};
+
+static struct aws_channel_handler_vtable s_sink_handler_vtable = {
+    .process_read_message = s_sink_process_read_message,
+    .process_write_message = s_bench_process_write_message,
+    .increment_read_window = s_bench_increment_read_window,
+    .shutdown = s_bench_shutdown,
+    .initial_window_size = s_bench_initial_window_size,
+    .message_overhead = s_bench_message_overhead,
+    .destroy = s_bench_destroy_handler,
+};
+
+static struct aws_channel_handler *s_bench_handler_new(
+    struct aws_allocator *allocator,
+    struct aws_channel_handler_vtable *vtable) {
+
+    struct aws_channel_handler *handler = aws_mem_calloc(allocator, 1, sizeof(struct aws_channel_handler));
+    if (handler == NULL) {
+        return NULL;
+    }
+    handler->vtable = vtable;
+    handler->alloc = allocator;
+    return handler;
+}
+
+/*
+ * Runs on the channel thread: times a tight acquire/send loop from the first slot. The read
+ * direction is a synchronous call chain on the loop thread, so every message fully traverses
+ * the chain (and is released by the sink) before the next send.
+ */
+static void s_channel_bench_send_task(struct aws_channel_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+
+    struct channel_bench_ctx *ctx = arg;
+    int error_code = AWS_ERROR_SUCCESS;
+
+    if (status != AWS_TASK_STATUS_RUN_READY) {
+        error_code = AWS_ERROR_UNKNOWN;
+        goto done;
+    }
+
+    uint64_t start_ns = aws_benchmark_clock_ns();
+
+    for (size_t i = 0; i < CHANNEL_SEND_ITERATIONS; ++i) {
+        struct aws_io_message *message =
+            aws_channel_acquire_message_from_pool(ctx->channel, AWS_IO_MESSAGE_APPLICATION_DATA, CHANNEL_SEND_MSG_SIZE);
+        if (message == NULL) {
+            error_code = aws_last_error();
+            goto done;
+        }
+        message->message_data.len = message->message_data.capacity;
+
+        if (aws_channel_slot_send_message(ctx->first_slot, message, AWS_CHANNEL_DIR_READ)) {
+            error_code = aws_last_error();
+            aws_mem_release(message->allocator, message);
+            goto done;
+        }
+    }
+
+    ctx->total_ns = aws_benchmark_clock_ns() - start_ns;
+
+done:
+    s_channel_bench_flag_done(ctx, &ctx->run_done, error_code);
+}
+
+/*
+ * aws_channel_slot_send_message() traversal: a channel of `slot_count` slots where the first
+ * slot originates messages, interior slots pass them through, and the last slot releases them.
+ * One iteration = acquire from pool + traverse (slot_count - 1) handlers + release.
+ */
+static int s_benchmark_channel_send_message(
+    struct aws_allocator *allocator,
+    struct aws_benchmark_result *result,
+    size_t slot_count) {
+
+    int op_result = AWS_OP_ERR;
+
+    struct channel_bench_ctx ctx;
+    AWS_ZERO_STRUCT(ctx);
+    aws_mutex_init(&ctx.lock);
+    aws_condition_variable_init(&ctx.signal);
+
+    struct aws_event_loop *event_loop = aws_event_loop_new_default(allocator, aws_high_res_clock_get_ticks);
+    if (event_loop == NULL || aws_event_loop_run(event_loop)) {
+        goto clean_up;
+    }
+
+    struct aws_channel_options channel_options = {
+        .event_loop = event_loop,
+        .on_setup_completed = s_channel_bench_on_setup,
+        .on_shutdown_completed = s_channel_bench_on_shutdown,
+        .setup_user_data = &ctx,
+        .shutdown_user_data = &ctx,
+    };
+
+    ctx.channel = aws_channel_new(allocator, &channel_options);
+    if (ctx.channel == NULL) {
+        goto clean_up;
+    }
+
+    s_channel_bench_wait(&ctx, &ctx.setup_done);
+    if (ctx.error_code != AWS_ERROR_SUCCESS) {
+        goto clean_up;
+    }
+
+    for (size_t i = 0; i < slot_count; ++i) {
+        struct aws_channel_slot *slot = aws_channel_slot_new(ctx.channel);
+        struct aws_channel_handler *handler = s_bench_handler_new(
+            allocator, (i + 1 < slot_count) ? &s_forwarding_handler_vtable : &s_sink_handler_vtable);
+        if (slot == NULL || handler == NULL || aws_channel_slot_set_handler(slot, handler) ||
+            aws_channel_slot_insert_end(ctx.channel, slot)) {
+            goto clean_up;
+        }
+        if (i == 0) {
+            ctx.first_slot = slot;
+        }
+    }
+
+    aws_channel_task_init(&ctx.send_task, s_channel_bench_send_task, &ctx, "benchmark_channel_send");
+    aws_channel_schedule_task_now(ctx.channel, &ctx.send_task);
+
+    s_channel_bench_wait(&ctx, &ctx.run_done);
+    if (ctx.error_code != AWS_ERROR_SUCCESS) {
+        goto clean_up;
+    }
+
+    result->total_ns = ctx.total_ns;
+    result->iterations = CHANNEL_SEND_ITERATIONS;
+    op_result = AWS_OP_SUCCESS;
+
+clean_up:
+    if (ctx.channel != NULL) {
+        aws_channel_shutdown(ctx.channel, AWS_ERROR_SUCCESS);
+        s_channel_bench_wait(&ctx, &ctx.shutdown_done);
+        aws_channel_destroy(ctx.channel);
+    }
+    if (event_loop != NULL) {
+        aws_event_loop_destroy(event_loop);
+    }
+    aws_condition_variable_clean_up(&ctx.signal);
+    aws_mutex_clean_up(&ctx.lock);
+    return op_result;
+}
+
+int aws_benchmark_channel_send_message_2_slots(
+    struct aws_allocator *allocator,
+    struct aws_benchmark_result *result) {
+    return s_benchmark_channel_send_message(allocator, result, 2);
+}
+
+int aws_benchmark_channel_send_message_3_slots(
+    struct aws_allocator *allocator,
+    struct aws_benchmark_result *result) {
+    return s_benchmark_channel_send_message(allocator, result, 3);
+}
+
+int aws_benchmark_channel_send_message_5_slots(
+    struct aws_allocator *allocator,
+    struct aws_benchmark_result *result) {
+    return s_benchmark_channel_send_message(allocator, result, 5);
+}
@@ -0,0 +1,93 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "benchmark_cases.h"
+
+#include <aws/common/atomics.h>
+#include <aws/common/clock.h>
+#include <aws/common/condition_variable.h>
+#include <aws/common/mutex.h>
+#include <aws/common/task_scheduler.h>
+#include <aws/io/event_loop.h>
+
+enum { XTHREAD_SCHEDULE_TASK_COUNT = 100 * 1000 };
+
+struct xthread_schedule_ctx {
+    struct aws_atomic_var tasks_run;
+    struct aws_mutex lock;
+    struct aws_condition_variable signal;
+};
+
+static void s_xthread_schedule_task_fn(struct aws_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    (void)status;
+
+    struct xthread_schedule_ctx *ctx = arg;
+    size_t run = aws_atomic_fetch_add(&ctx->tasks_run, 1) + 1;
+    if (run == XTHREAD_SCHEDULE_TASK_COUNT) {
+        aws_mutex_lock(&ctx->lock);
+        aws_mutex_unlock(&ctx->lock);
+        aws_condition_variable_notify_one(&ctx->signal);
+    }
+}
+
+static bool s_xthread_schedule_done_pred(void *arg) {
+    struct xthread_schedule_ctx *ctx = arg;
+    return aws_atomic_load_int(&ctx->tasks_run) == XTHREAD_SCHEDULE_TASK_COUNT;
+}
+
+/*
+ * Cross-thread aws_event_loop_schedule_task_now() throughput: this thread schedules tasks against
+ * a running loop as fast as it can; the measurement covers schedule-side cost plus the loop
+ * draining every task.
+ */
+int aws_benchmark_event_loop_xthread_schedule_now(
+    struct aws_allocator *allocator,
+    struct aws_benchmark_result *result) {
+
+    int op_result = AWS_OP_ERR;
+
+    struct xthread_schedule_ctx ctx;
+    aws_atomic_init_int(&ctx.tasks_run, 0);
+    aws_mutex_init(&ctx.lock);
+    aws_condition_variable_init(&ctx.signal);
+
+    struct aws_task *tasks =
+        aws_mem_calloc(allocator, XTHREAD_SCHEDULE_TASK_COUNT, sizeof(struct aws_task));
+    if (tasks == NULL) {
+        goto clean_up_sync;
+    }
+
+    struct aws_event_loop *event_loop = aws_event_loop_new_default(allocator, aws_high_res_clock_get_ticks);
+    if (event_loop == NULL || aws_event_loop_run(event_loop)) {
+        goto clean_up;
+    }
+
+    uint64_t start_ns = aws_benchmark_clock_ns();
+
+    for (size_t i = 0; i < XTHREAD_SCHEDULE_TASK_COUNT; ++i) {
+        aws_task_init(&tasks[i], s_xthread_schedule_task_fn, &ctx, "benchmark_xthread_schedule");
+        aws_event_loop_schedule_task_now(event_loop, &tasks[i]);
+    }
+
+    aws_mutex_lock(&ctx.lock);
+    aws_condition_variable_wait_pred(&ctx.signal, &ctx.lock, s_xthread_schedule_done_pred, &ctx);
+    aws_mutex_unlock(&ctx.lock);
+
+    result->total_ns = aws_benchmark_clock_ns() - start_ns;
+    result->iterations = XTHREAD_SCHEDULE_TASK_COUNT;
+    op_result = AWS_OP_SUCCESS;
+
+clean_up:
+    if (event_loop != NULL) {
+        aws_event_loop_destroy(event_loop);
+    }
+    aws_mem_release(allocator, tasks);
+
+clean_up_sync:
+    aws_condition_variable_clean_up(&ctx.signal);
+    aws_mutex_clean_up(&ctx.lock);
+    return op_result;
+}
@@ -0,0 +1,781 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+/*
+ * End-to-end loadgen pair for aws-c-io, built on the client/server bootstraps.
+ *
+ * Server: echoes every byte back to the sender.
+ *   aws-c-io-loadgen server --port 9000 [--cert server.pem --key key.pem]
+ *
+ * Client: sweeps connection count and message size against an echo server, one message in
+ * flight per connection (ping-pong), and reports Gbps, msgs/sec and p50/p99/p999 RTT per
+ * configuration as JSON lines on stdout.
+ *   aws-c-io-loadgen client --host 127.0.0.1 --port 9000 \
+ *       --connections 1,16,64 --msg-sizes 1024,65536 --duration-secs 5 [--tls]
+ *
+ * TLS is on for the server when --cert/--key are given, and for the client with --tls
+ * (certificate verification is disabled; this is a benchmark, not an example).
+ */
+
+#include <aws/common/atomics.h>
+#include <aws/common/clock.h>
+#include <aws/common/condition_variable.h>
+#include <aws/common/mutex.h>
+#include <aws/common/thread.h>
+#include <aws/io/channel.h>
+#include <aws/io/channel_bootstrap.h>
+#include <aws/io/event_loop.h>
+#include <aws/io/host_resolver.h>
+#include <aws/io/socket.h>
+#include <aws/io/tls_channel_handler.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum {
+    LOADGEN_MAX_SWEEP_VALUES = 16,
+    LOADGEN_MAX_SAMPLES = 1000 * 1000,
+};
+
+static uint64_t s_now_ns(void) {
+    uint64_t now = 0;
+    aws_high_res_clock_get_ticks(&now);
+    return now;
+}
+
+/* ---------------------------------------------------------------------------------------------
+ * Shared channel-handler boilerplate
+ * ------------------------------------------------------------------------------------------- */
+
+static int s_loadgen_process_write_message(
+    struct aws_channel_handler *handler,
+    struct aws_channel_slot *slot,
+    struct aws_io_message *message) {
+    (void)handler;
+    (void)slot;
+    (void)message;
+    return aws_raise_error(AWS_ERROR_UNIMPLEMENTED);
+}
+
+static int s_loadgen_increment_read_window(
+    struct aws_channel_handler *handler,
+    struct aws_channel_slot *slot,
+    size_t size) {
+    (void)handler;
+    return aws_channel_slot_increment_read_window(slot, size);
+}
+
+static int s_loadgen_shutdown(
+    struct aws_channel_handler *handler,
+    struct aws_channel_slot *slot,
+    enum aws_channel_direction dir,
+    int error_code,
+    bool free_scarce_resources_immediately) {
+    (void)handler;
+    return aws_channel_slot_on_handler_shutdown_complete(slot, dir, error_code, free_scarce_resources_immediately);
+}
+
+static size_t s_loadgen_initial_window_size(struct aws_channel_handler *handler) {
+    (void)handler;
+    return SIZE_MAX;
+}
+
+static size_t s_loadgen_message_overhead(struct aws_channel_handler *handler) {
+    (void)handler;
+    return 0;
+}
+
+/* ---------------------------------------------------------------------------------------------
+ * Echo server
+ * ------------------------------------------------------------------------------------------- */
+
+struct echo_server_conn {
+    struct aws_allocator *allocator;
+    struct aws_channel_handler handler;
+};
+
+static int s_echo_process_read_message(
+    struct aws_channel_handler *handler,
+    struct aws_channel_slot *slot,
+    struct aws_io_message *message) {
+    (void)handler;
+
+    struct aws_byte_cursor data = aws_byte_cursor_from_buf(&message->message_data);
+
+    while (data.len > 0) {
+        struct aws_io_message *out_message =
+            aws_channel_acquire_message_from_pool(slot->channel, AWS_IO_MESSAGE_APPLICATION_DATA, data.len);
+        if (out_message == NULL) {
+            return AWS_OP_ERR;
+        }
+
+        size_t chunk_size = aws_min_size(data.len, out_message->message_data.capacity);
+        struct aws_byte_cursor chunk = aws_byte_cursor_advance(&data, chunk_size);
+        aws_byte_buf_write_from_whole_cursor(&out_message->message_data, chunk);
+
+        if (aws_channel_slot_send_message(slot, out_message, AWS_CHANNEL_DIR_WRITE)) {
+            aws_mem_release(out_message->allocator, out_message);
+            return AWS_OP_ERR;
+        }
+    }
+
+    aws_mem_release(message->allocator, message);
+    return AWS_OP_SUCCESS;
+}
+
+static void s_echo_destroy_handler(struct aws_channel_handler *handler) {
+    struct echo_server_conn *conn = handler->impl;
+    aws_mem_release(conn->allocator, conn);
+}
+
+static struct aws_channel_handler_vtable s_echo_handler_vtable = {
+    .process_read_message = s_echo_process_read_message,
+    .process_write_message = s_loadgen_process_write_message,
+    .increment_read_window = s_loadgen_increment_read_window,
+    .shutdown = s_loadgen_shutdown,
+    .initial_window_size = s_loadgen_initial_window_size,
+    .message_overhead = s_loadgen_message_overhead,
+    .destroy = s_echo_destroy_handler,
+};
+
+static void s_echo_on_incoming_channel(
+    struct aws_server_bootstrap *bootstrap,
+    int error_code,
+    struct aws_channel *channel,
+    void *user_data) {
+    (void)bootstrap;
+
+    struct aws_allocator *allocator = user_data;
+    if (error_code != AWS_ERROR_SUCCESS) {
+        fprintf(stderr, "incoming channel failed: %s\n", aws_error_name(error_code));
+        return;
+    }
+
+    struct echo_server_conn *conn = aws_mem_calloc(allocator, 1, sizeof(struct echo_server_conn));
+    if (conn == NULL) {
+        aws_channel_shutdown(channel, aws_last_error());
+        return;
+    }
+    conn->allocator = allocator;
+    conn->handler.vtable = &s_echo_handler_vtable;
+    conn->handler.alloc = allocator;
+    conn->handler.impl = conn;
+
+    struct aws_channel_slot *slot = aws_channel_slot_new(channel);
+    if (slot == NULL || aws_channel_slot_insert_end(channel, slot) ||
+        aws_channel_slot_set_handler(slot, &conn->handler)) {
+        aws_mem_release(allocator, conn);
+        aws_channel_shutdown(channel, aws_last_error());
+    }
+}
+
+static void s_echo_on_channel_shutdown(
+    struct aws_server_bootstrap *bootstrap,
+    int error_code,
+    struct aws_channel *channel,
+    void *user_data) {
+    (void)bootstrap;
+    (void)error_code;
+    (void)channel;
+    (void)user_data;
+}
+
+/* ---------------------------------------------------------------------------------------------
+ * Client driver
+ * ------------------------------------------------------------------------------------------- */
+
+struct client_run_ctx {
+    struct aws_allocator *allocator;
+    size_t msg_size;
+    struct aws_atomic_var running;
+
+    struct aws_mutex lock;
+    struct aws_condition_variable signal;
+    size_t channels_pending; /* setup callbacks not yet fired */
+    size_t channels_open;    /* shutdown callbacks not yet fired */
+    size_t setup_failures;
+
+    /* RTT samples and interval counters; lock-guarded, sampling stops at the cap. */
+    uint64_t *samples;
+    size_t sample_count;
+    uint64_t total_msgs;
+    uint64_t total_bytes;
+};
+
+struct client_conn {
+    struct aws_allocator *allocator;
+    struct client_run_ctx *run;
+    struct aws_channel_handler handler;
+    struct aws_channel_slot *slot;
+    struct aws_channel *channel;
+    /* Once the handler is seated in a slot the channel owns the conn and frees it via the
+     * handler's destroy; until then the sweep loop owns it. */
+    bool handler_attached;
+    size_t bytes_remaining; /* echoed bytes still expected for the in-flight message */
+    uint64_t send_ns;
+};
+
+static int s_client_send_one_message(struct client_conn *conn) {
+    struct client_run_ctx *run = conn->run;
+
+    conn->bytes_remaining = run->msg_size;
+    conn->send_ns = s_now_ns();
+
+    /* The channel's pool caps per-message capacity, so large sweep sizes go out in chunks. */
+    size_t to_send = run->msg_size;
+    while (to_send > 0) {
+        struct aws_io_message *message =
+            aws_channel_acquire_message_from_pool(conn->channel, AWS_IO_MESSAGE_APPLICATION_DATA, to_send);
+        if (message == NULL) {
+            return AWS_OP_ERR;
+        }
+
+        size_t chunk_size = aws_min_size(to_send, message->message_data.capacity);
+        memset(message->message_data.buffer, 0xA5, chunk_size);
+        message->message_data.len = chunk_size;
+
+        if (aws_channel_slot_send_message(conn->slot, message, AWS_CHANNEL_DIR_WRITE)) {
+            aws_mem_release(message->allocator, message);
+            return AWS_OP_ERR;
+        }
+        to_send -= chunk_size;
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_client_process_read_message(
+    struct aws_channel_handler *handler,
+    struct aws_channel_slot *slot,
+    struct aws_io_message *message) {
+    (void)slot;
+
+    struct client_conn *conn = handler->impl;
+    struct client_run_ctx *run = conn->run;
+
+    size_t received = message->message_data.len;
+    aws_mem_release(message->allocator, message);
+
+    if (received >= conn->bytes_remaining) {
+        uint64_t rtt_ns = s_now_ns() - conn->send_ns;
+
+        aws_mutex_lock(&run->lock);
+        if (run->sample_count < LOADGEN_MAX_SAMPLES) {
+            run->samples[run->sample_count++] = rtt_ns;
+        }
+        ++run->total_msgs;
+        run->total_bytes += run->msg_size;
+        aws_mutex_unlock(&run->lock);
+
+        if (aws_atomic_load_int(&run->running) != 0 && s_client_send_one_message(conn)) {
+            aws_channel_shutdown(conn->channel, aws_last_error());
+        }
+    } else {
+        conn->bytes_remaining -= received;
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static void s_client_destroy_handler(struct aws_channel_handler *handler) {
+    struct client_conn *conn = handler->impl;
+    aws_mem_release(conn->allocator, conn);
+}
+
+static struct aws_channel_handler_vtable s_client_handler_vtable = {
+    .process_read_message = s_client_process_read_message,
+    .process_write_message = s_loadgen_process_write_message,
+    .increment_read_window = s_loadgen_increment_read_window,
+    .shutdown = s_loadgen_shutdown,
+    .initial_window_size = s_loadgen_initial_window_size,
+    .message_overhead = s_loadgen_message_overhead,
+    .destroy = s_client_destroy_handler,
+};
+
+static void s_client_on_channel_setup(
+    struct aws_client_bootstrap *bootstrap,
+    int error_code,
+    struct aws_channel *channel,
+    void *user_data) {
+    (void)bootstrap;
+
+    struct client_conn *conn = user_data;
+    struct client_run_ctx *run = conn->run;
+
+    bool failed = false;
+    if (error_code != AWS_ERROR_SUCCESS) {
+        fprintf(stderr, "connection failed: %s\n", aws_error_name(error_code));
+        failed = true;
+    } else {
+        conn->channel = channel;
+        conn->slot = aws_channel_slot_new(channel);
+        if (conn->slot == NULL || aws_channel_slot_insert_end(channel, conn->slot) ||
+            aws_channel_slot_set_handler(conn->slot, &conn->handler)) {
+            aws_channel_shutdown(channel, aws_last_error());
+        } else {
+            conn->handler_attached = true;
+            if (s_client_send_one_message(conn)) {
+                aws_channel_shutdown(channel, aws_last_error());
+            }
+        }
+    }
+
+    aws_mutex_lock(&run->lock);
+    --run->channels_pending;
+    if (failed) {
+        ++run->setup_failures;
+        --run->channels_open;
+    }
+    aws_mutex_unlock(&run->lock);
+    aws_condition_variable_notify_one(&run->signal);
+}
+
+static void s_client_on_channel_shutdown(
+    struct aws_client_bootstrap *bootstrap,
+    int error_code,
+    struct aws_channel *channel,
+    void *user_data) {
+    (void)bootstrap;
+    (void)error_code;
+    (void)channel;
+
+    struct client_conn *conn = user_data;
+    struct client_run_ctx *run = conn->run;
+
+    aws_mutex_lock(&run->lock);
+    --run->channels_open;
+    aws_mutex_unlock(&run->lock);
+    aws_condition_variable_notify_one(&run->signal);
+}
+
+static bool s_all_channels_setup_pred(void *arg) {
+    struct client_run_ctx *run = arg;
+    return run->channels_pending == 0;
+}
+
+static bool s_all_channels_closed_pred(void *arg) {
+    struct client_run_ctx *run = arg;
+    return run->channels_open == 0;
+}
+
+static int s_compare_u64(const void *a, const void *b) {
+    uint64_t lhs = *(const uint64_t *)a;
+    uint64_t rhs = *(const uint64_t *)b;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+static uint64_t s_percentile_ns(const uint64_t *sorted, size_t count, double percentile) {
+    if (count == 0) {
+        return 0;
+    }
+    size_t index = (size_t)((double)(count - 1) * percentile);
+    return sorted[index];
+}
+
+struct client_sweep_config {
+    const char *host;
+    uint32_t port;
+    size_t connection_count;
+    size_t msg_size;
+    uint64_t duration_secs;
+    bool tls;
+};
+
+static int s_client_run_one_config(
+    struct aws_allocator *allocator,
+    struct aws_client_bootstrap *bootstrap,
+    const struct aws_tls_connection_options *tls_options,
+    const struct client_sweep_config *config) {
+
+    int op_result = AWS_OP_ERR;
+    uint64_t start_ns = 0;
+    uint64_t elapsed_ns = 0;
+
+    struct client_run_ctx run;
+    AWS_ZERO_STRUCT(run);
+    run.allocator = allocator;
+    run.msg_size = config->msg_size;
+    aws_atomic_init_int(&run.running, 1);
+    aws_mutex_init(&run.lock);
+    aws_condition_variable_init(&run.signal);
+    run.channels_pending = config->connection_count;
+    run.channels_open = config->connection_count;
+
+    run.samples = aws_mem_calloc(allocator, LOADGEN_MAX_SAMPLES, sizeof(uint64_t));
+    if (run.samples == NULL) {
+        goto clean_up;
+    }
+
+    struct aws_socket_options socket_options = {
+        .type = AWS_SOCKET_STREAM,
+        .domain = AWS_SOCKET_IPV4,
+        .connect_timeout_ms = 10000,
+    };
+
+    struct client_conn **conns = aws_mem_calloc(allocator, config->connection_count, sizeof(struct client_conn *));
+    if (conns == NULL) {
+        goto clean_up;
+    }
+
+    for (size_t i = 0; i < config->connection_count; ++i) {
+        struct client_conn *conn = aws_mem_calloc(allocator, 1, sizeof(struct client_conn));
+        if (conn == NULL) {
+            size_t remaining = config->connection_count - i;
+            aws_mutex_lock(&run.lock);
+            run.channels_pending -= remaining;
+            run.channels_open -= remaining;
+            run.setup_failures += remaining;
+            aws_mutex_unlock(&run.lock);
+            break;
+        }
+        conn->allocator = allocator;
+        conn->run = &run;
+        conn->handler.vtable = &s_client_handler_vtable;
+        conn->handler.alloc = allocator;
+        conn->handler.impl = conn;
+        conns[i] = conn;
+
+        struct aws_socket_channel_bootstrap_options channel_options = {
+            .bootstrap = bootstrap,
+            .host_name = config->host,
+            .port = config->port,
+            .socket_options = &socket_options,
+            .tls_options = config->tls ? tls_options : NULL,
+            .setup_callback = s_client_on_channel_setup,
+            .shutdown_callback = s_client_on_channel_shutdown,
+            .user_data = conn,
+        };
+
+        if (aws_client_bootstrap_new_socket_channel(&channel_options)) {
+            fprintf(stderr, "failed to start connection: %s\n", aws_error_name(aws_last_error()));
+            aws_mem_release(allocator, conn);
+            conns[i] = NULL;
+            aws_mutex_lock(&run.lock);
+            --run.channels_pending;
+            --run.channels_open;
+            ++run.setup_failures;
+            aws_mutex_unlock(&run.lock);
+        }
+    }
+
+    aws_mutex_lock(&run.lock);
+    aws_condition_variable_wait_pred(&run.signal, &run.lock, s_all_channels_setup_pred, &run);
+    size_t setup_failures = run.setup_failures;
+    aws_mutex_unlock(&run.lock);
+
+    if (setup_failures == config->connection_count) {
+        fprintf(stderr, "every connection failed; aborting this configuration\n");
+        goto clean_up_shutdown;
+    }
+
+    /* Discard the connect-phase samples so the measurement window is steady-state. */
+    aws_mutex_lock(&run.lock);
+    run.sample_count = 0;
+    run.total_msgs = 0;
+    run.total_bytes = 0;
+    aws_mutex_unlock(&run.lock);
+
+    start_ns = s_now_ns();
+    aws_thread_current_sleep(config->duration_secs * 1000000000ULL);
+    aws_atomic_store_int(&run.running, 0);
+    elapsed_ns = s_now_ns() - start_ns;
+
+clean_up_shutdown:
+    for (size_t i = 0; i < config->connection_count; ++i) {
+        if (conns[i] != NULL && conns[i]->channel != NULL) {
+            aws_channel_shutdown(conns[i]->channel, AWS_ERROR_SUCCESS);
+        }
+    }
+
+    aws_mutex_lock(&run.lock);
+    aws_condition_variable_wait_pred(&run.signal, &run.lock, s_all_channels_closed_pred, &run);
+    aws_mutex_unlock(&run.lock);
+
+    /* Conns whose handler never made it into a slot are still ours to free. */
+    for (size_t i = 0; i < config->connection_count; ++i) {
+        if (conns[i] != NULL && !conns[i]->handler_attached) {
+            aws_mem_release(allocator, conns[i]);
+        }
+    }
+
+    if (setup_failures < config->connection_count) {
+        qsort(run.samples, run.sample_count, sizeof(uint64_t), s_compare_u64);
+
+        double elapsed_secs = (double)elapsed_ns / 1e9;
+        double msgs_per_sec = elapsed_secs > 0.0 ? (double)run.total_msgs / elapsed_secs : 0.0;
+        /* Echoed payload crosses the wire twice; report the application-visible direction. */
+        double gbps = elapsed_secs > 0.0 ? ((double)run.total_bytes * 8.0) / elapsed_secs / 1e9 : 0.0;
+
+        printf(
+            "{\"connections\": %zu, \"msg_size\": %zu, \"tls\": %s, \"duration_secs\": %" PRIu64
+            ", \"msgs_per_sec\": %.0f, \"gbps\": %.3f, \"rtt_p50_ns\": %" PRIu64 ", \"rtt_p99_ns\": %" PRIu64
+            ", \"rtt_p999_ns\": %" PRIu64 ", \"samples\": %zu}\n",
+            config->connection_count,
+            config->msg_size,
+            config->tls ? "true" : "false",
+            config->duration_secs,
+            msgs_per_sec,
+            gbps,
+            s_percentile_ns(run.samples, run.sample_count, 0.50),
+            s_percentile_ns(run.samples, run.sample_count, 0.99),
+            s_percentile_ns(run.samples, run.sample_count, 0.999),
+            run.sample_count);
+        fflush(stdout);
+        op_result = AWS_OP_SUCCESS;
+    }
+
+    aws_mem_release(allocator, conns);
+
+clean_up:
+    aws_mem_release(allocator, run.samples);
+    aws_condition_variable_clean_up(&run.signal);
+    aws_mutex_clean_up(&run.lock);
+    return op_result;
+}
+
+/* ---------------------------------------------------------------------------------------------
+ * Argument parsing and main
+ * ------------------------------------------------------------------------------------------- */
+
+struct loadgen_args {
+    bool is_server;
+    const char *host;
+    uint32_t port;
+    size_t connection_counts[LOADGEN_MAX_SWEEP_VALUES];
+    size_t connection_count_count;
+    size_t msg_sizes[LOADGEN_MAX_SWEEP_VALUES];
+    size_t msg_size_count;
+    uint64_t duration_secs;
+    bool tls;
+    const char *cert_path;
+    const char *key_path;
+    /* Server only: require client certificates and verify them against this CA bundle. */
+    const char *ca_path;
+};
+
+static size_t s_parse_size_list(const char *arg, size_t *values, size_t max_values) {
+    size_t count = 0;
+    const char *cursor = arg;
+    while (count < max_values && *cursor != '\0') {
+        char *end = NULL;
+        unsigned long long value = strtoull(cursor, &end, 10);
+        if (end == cursor || value == 0) {
+            return 0;
+        }
+        values[count++] = (size_t)value;
+        cursor = (*end == ',') ? end + 1 : end;
+    }
+    return count;
+}
+
+static void s_usage(void) {
+    fprintf(
+        stderr,
+        "usage:\n"
+        "  aws-c-io-loadgen server --port PORT [--cert PEM --key PEM [--ca PEM]]\n"
+        "  aws-c-io-loadgen client --host HOST --port PORT [--connections N,N,...]\n"
+        "      [--msg-sizes S,S,...] [--duration-secs D] [--tls]\n");
+    exit(1);
+}
+
+static void s_parse_args(int argc, char **argv, struct loadgen_args *args) {
+    AWS_ZERO_STRUCT(*args);
+    args->host = "127.0.0.1";
+    args->duration_secs = 5;
+    args->connection_counts[0] = 1;
+    args->connection_count_count = 1;
+    args->msg_sizes[0] = 1024;
+    args->msg_size_count = 1;
+
+    if (argc < 2) {
+        s_usage();
+    }
+    if (strcmp(argv[1], "server") == 0) {
+        args->is_server = true;
+    } else if (strcmp(argv[1], "client") != 0) {
+        s_usage();
+    }
+
+    for (int i = 2; i < argc; ++i) {
+        const char *flag = argv[i];
+        if (strcmp(flag, "--tls") == 0) {
+            args->tls = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            s_usage();
+        }
+        const char *value = argv[++i];
+        if (strcmp(flag, "--host") == 0) {
+            args->host = value;
+        } else if (strcmp(flag, "--port") == 0) {
+            args->port = (uint32_t)atoi(value);
+        } else if (strcmp(flag, "--connections") == 0) {
+            args->connection_count_count =
+                s_parse_size_list(value, args->connection_counts, LOADGEN_MAX_SWEEP_VALUES);
+        } else if (strcmp(flag, "--msg-sizes") == 0) {
+            args->msg_size_count = s_parse_size_list(value, args->msg_sizes, LOADGEN_MAX_SWEEP_VALUES);
+        } else if (strcmp(flag, "--duration-secs") == 0) {
+            args->duration_secs = strtoull(value, NULL, 10);
+        } else if (strcmp(flag, "--cert") == 0) {
+            args->cert_path = value;
+        } else if (strcmp(flag, "--key") == 0) {
+            args->key_path = value;
+        } else if (strcmp(flag, "--ca") == 0) {
+            args->ca_path = value;
+        } else {
+            s_usage();
+        }
+    }
+
+    if (args->port == 0 || args->connection_count_count == 0 || args->msg_size_count == 0 ||
+        args->duration_secs == 0) {
+        s_usage();
+    }
+    if (args->is_server && ((args->cert_path == NULL) != (args->key_path == NULL))) {
+        s_usage();
+    }
+}
+
+static int s_run_server(struct aws_allocator *allocator, const struct loadgen_args *args) {
+    struct aws_event_loop_group *el_group = aws_event_loop_group_new_default(allocator, 0, NULL);
+    struct aws_server_bootstrap *bootstrap = aws_server_bootstrap_new(allocator, el_group);
+
+    struct aws_tls_ctx_options tls_ctx_options;
+    struct aws_tls_connection_options tls_options;
+    struct aws_tls_ctx *tls_ctx = NULL;
+    bool use_tls = args->cert_path != NULL;
+    if (use_tls) {
+        if (aws_tls_ctx_options_init_default_server_from_path(
+                &tls_ctx_options, allocator, args->cert_path, args->key_path)) {
+            fprintf(stderr, "failed to load server cert/key: %s\n", aws_error_name(aws_last_error()));
+            return 1;
+        }
+        if (args->ca_path != NULL) {
+            if (aws_tls_ctx_options_override_default_trust_store_from_path(&tls_ctx_options, NULL, args->ca_path)) {
+                fprintf(stderr, "failed to load CA bundle: %s\n", aws_error_name(aws_last_error()));
+                return 1;
+            }
+            aws_tls_ctx_options_set_verify_peer(&tls_ctx_options, true);
+        }
+        tls_ctx = aws_tls_server_ctx_new(allocator, &tls_ctx_options);
+        if (tls_ctx == NULL) {
+            fprintf(stderr, "failed to create server tls ctx: %s\n", aws_error_name(aws_last_error()));
+            return 1;
+        }
+        aws_tls_connection_options_init_from_ctx(&tls_options, tls_ctx);
+    }
+
+    struct aws_socket_options socket_options = {
+        .type = AWS_SOCKET_STREAM,
+        .domain = AWS_SOCKET_IPV4,
+        .connect_timeout_ms = 10000,
+    };
+
+    struct aws_server_socket_channel_bootstrap_options listener_options = {
+        .bootstrap = bootstrap,
+        .host_name = args->host,
+        .port = args->port,
+        .socket_options = &socket_options,
+        .tls_options = use_tls ? &tls_options : NULL,
+        .incoming_callback = s_echo_on_incoming_channel,
+        .shutdown_callback = s_echo_on_channel_shutdown,
+        .user_data = allocator,
+    };
+
+    struct aws_socket *listener = aws_server_bootstrap_new_socket_listener(&listener_options);
+    if (listener == NULL) {
+        fprintf(stderr, "failed to listen on %s:%u: %s\n", args->host, args->port, aws_error_name(aws_last_error()));
+        return 1;
+    }
+
+    fprintf(stderr, "echo server listening on %s:%u (tls: %s)\n", args->host, args->port, use_tls ? "on" : "off");
+    for (;;) {
+        aws_thread_current_sleep(3600ULL * 1000000000ULL);
+    }
+}
+
+static int s_run_client(struct aws_allocator *allocator, const struct loadgen_args *args) {
+    int exit_code = 0;
+
+    struct aws_event_loop_group *el_group = aws_event_loop_group_new_default(allocator, 0, NULL);
+
+    struct aws_host_resolver_default_options resolver_options = {
+        .max_entries = 8,
+        .el_group = el_group,
+    };
+    struct aws_host_resolver *resolver = aws_host_resolver_new_default(allocator, &resolver_options);
+
+    struct aws_client_bootstrap_options bootstrap_options = {
+        .event_loop_group = el_group,
+        .host_resolver = resolver,
+    };
+    struct aws_client_bootstrap *bootstrap = aws_client_bootstrap_new(allocator, &bootstrap_options);
+
+    struct aws_tls_ctx_options tls_ctx_options;
+    struct aws_tls_connection_options tls_options;
+    AWS_ZERO_STRUCT(tls_options);
+    struct aws_tls_ctx *tls_ctx = NULL;
+    if (args->tls) {
+        aws_tls_ctx_options_init_default_client(&tls_ctx_options, allocator);
+        aws_tls_ctx_options_set_verify_peer(&tls_ctx_options, false);
+        tls_ctx = aws_tls_client_ctx_new(allocator, &tls_ctx_options);
+        if (tls_ctx == NULL) {
+            fprintf(stderr, "failed to create client tls ctx: %s\n", aws_error_name(aws_last_error()));
+            return 1;
+        }
+        aws_tls_connection_options_init_from_ctx(&tls_options, tls_ctx);
+        struct aws_byte_cursor host_cursor = aws_byte_cursor_from_c_str(args->host);
+        aws_tls_connection_options_set_server_name(&tls_options, allocator, &host_cursor);
+    }
+
+    for (size_t c = 0; c < args->connection_count_count; ++c) {
+        for (size_t s = 0; s < args->msg_size_count; ++s) {
+            struct client_sweep_config config = {
+                .host = args->host,
+                .port = args->port,
+                .connection_count = args->connection_counts[c],
+                .msg_size = args->msg_sizes[s],
+                .duration_secs = args->duration_secs,
+                .tls = args->tls,
+            };
+            fprintf(
+                stderr,
+                "running: %zu connections, %zu byte messages, tls %s...\n",
+                config.connection_count,
+                config.msg_size,
+                config.tls ? "on" : "off");
+            if (s_client_run_one_config(allocator, bootstrap, args->tls ? &tls_options : NULL, &config)) {
+                exit_code = 1;
+            }
+        }
+    }
+
+    if (tls_ctx != NULL) {
+        aws_tls_connection_options_clean_up(&tls_options);
+        aws_tls_ctx_release(tls_ctx);
+    }
+    aws_client_bootstrap_release(bootstrap);
+    aws_host_resolver_release(resolver);
+    aws_event_loop_group_release(el_group);
+    aws_thread_join_all_managed();
+
+    return exit_code;
+}
+
+int main(int argc, char **argv) {
+    struct loadgen_args args;
+    s_parse_args(argc, argv, &args);
+
+    struct aws_allocator *allocator = aws_default_allocator();
+    aws_io_library_init(allocator);
+
+    int exit_code = args.is_server ? s_run_server(allocator, &args) : s_run_client(allocator, &args);
+
+    aws_io_library_clean_up();
+    return exit_code;
+}
@@ -0,0 +1,31 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "benchmark_cases.h"
+
+#include <aws/io/io.h>
+
+static const struct aws_benchmark_case s_benchmark_cases[] = {
+    {"event_loop_xthread_schedule_now", aws_benchmark_event_loop_xthread_schedule_now},
+    {"task_scheduler_insert_cancel_depth_100", aws_benchmark_task_scheduler_insert_cancel_depth_100},
+    {"task_scheduler_insert_cancel_depth_1000", aws_benchmark_task_scheduler_insert_cancel_depth_1000},
+    {"task_scheduler_insert_cancel_depth_10000", aws_benchmark_task_scheduler_insert_cancel_depth_10000},
+    {"message_pool_acquire_release", aws_benchmark_message_pool_acquire_release},
+    {"channel_send_message_2_slots", aws_benchmark_channel_send_message_2_slots},
+    {"channel_send_message_3_slots", aws_benchmark_channel_send_message_3_slots},
+    {"channel_send_message_5_slots", aws_benchmark_channel_send_message_5_slots},
+    {"pipe_wakeup_latency", aws_benchmark_pipe_wakeup_latency},
+};
+
+int main(void) {
+    struct aws_allocator *allocator = aws_default_allocator();
+    aws_io_library_init(allocator);
+
+    int result =
+        aws_benchmark_run_suite(allocator, s_benchmark_cases, AWS_ARRAY_SIZE(s_benchmark_cases));
+
+    aws_io_library_clean_up();
+    return result == AWS_OP_SUCCESS ? 0 : 1;
+}
@@ -0,0 +1,55 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "benchmark_cases.h"
+
+#include <aws/io/message_pool.h>
+
+enum {
+    MESSAGE_POOL_ITERATIONS = 1000 * 1000,
+    MESSAGE_POOL_MSG_SIZE = 16 * 1024,
+};
+
+/*
+ * Steady-state aws_message_pool_acquire()/release() cycle on the application-data pool: every
+ * acquire after warm-up is a pool hit, so this measures the pooled fast path, not the allocator.
+ */
+int aws_benchmark_message_pool_acquire_release(
+    struct aws_allocator *allocator,
+    struct aws_benchmark_result *result) {
+
+    struct aws_message_pool_creation_args creation_args = {
+        .application_data_msg_data_size = MESSAGE_POOL_MSG_SIZE,
+        .application_data_msg_count = 4,
+        .small_block_msg_data_size = 128,
+        .small_block_msg_count = 16,
+    };
+
+    struct aws_message_pool message_pool;
+    if (aws_message_pool_init(&message_pool, allocator, &creation_args)) {
+        return AWS_OP_ERR;
+    }
+
+    int op_result = AWS_OP_ERR;
+
+    uint64_t start_ns = aws_benchmark_clock_ns();
+
+    for (size_t i = 0; i < MESSAGE_POOL_ITERATIONS; ++i) {
+        struct aws_io_message *message =
+            aws_message_pool_acquire(&message_pool, AWS_IO_MESSAGE_APPLICATION_DATA, MESSAGE_POOL_MSG_SIZE);
+        if (message == NULL) {
+            goto clean_up;
+        }
+        aws_message_pool_release(&message_pool, message);
+    }
+
+    result->total_ns = aws_benchmark_clock_ns() - start_ns;
+    result->iterations = MESSAGE_POOL_ITERATIONS;
+    op_result = AWS_OP_SUCCESS;
+
+clean_up:
+    aws_message_pool_clean_up(&message_pool);
+    return op_result;
+}
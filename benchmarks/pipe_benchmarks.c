@@ -0,0 +1,216 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "benchmark_cases.h"
+
+#include <aws/common/clock.h>
+#include <aws/common/condition_variable.h>
+#include <aws/common/mutex.h>
+#include <aws/common/task_scheduler.h>
+#include <aws/io/event_loop.h>
+#include <aws/io/pipe.h>
+
+enum { PIPE_WAKEUP_ROUNDS = 10 * 1000 };
+
+struct pipe_bench_ctx {
+    struct aws_pipe_read_end read_end;
+    struct aws_pipe_write_end write_end;
+    struct aws_event_loop *write_loop;
+    struct aws_event_loop *read_loop;
+
+    struct aws_mutex lock;
+    struct aws_condition_variable signal;
+    bool subscribe_done;
+    bool rounds_done;
+    bool read_end_closed;
+    bool write_end_closed;
+    int error_code;
+
+    struct aws_task write_task;
+    struct aws_task subscribe_task;
+    struct aws_task close_read_task;
+    struct aws_task close_write_task;
+
+    uint64_t round_start_ns;
+    uint64_t total_latency_ns;
+    size_t rounds_completed;
+
+    uint8_t write_byte;
+    uint8_t read_storage[16];
+};
+
+static void s_pipe_bench_flag_done(struct pipe_bench_ctx *ctx, bool *flag, int error_code) {
+    aws_mutex_lock(&ctx->lock);
+    *flag = true;
+    if (ctx->error_code == AWS_ERROR_SUCCESS) {
+        ctx->error_code = error_code;
+    }
+    aws_mutex_unlock(&ctx->lock);
+    aws_condition_variable_notify_one(&ctx->signal);
+}
+
+static void s_pipe_bench_wait(struct pipe_bench_ctx *ctx, bool *flag) {
+    aws_mutex_lock(&ctx->lock);
+    while (!*flag) {
+        aws_condition_variable_wait(&ctx->signal, &ctx->lock);
+    }
+    aws_mutex_unlock(&ctx->lock);
+}
+
+static void s_pipe_bench_on_write_completed(
+    struct aws_pipe_write_end *write_end,
+    int error_code,
+    struct aws_byte_cursor src_buffer,
+    void *user_data) {
+    (void)write_end;
+    (void)src_buffer;
+
+    struct pipe_bench_ctx *ctx = user_data;
+    if (error_code != AWS_ERROR_SUCCESS) {
+        s_pipe_bench_flag_done(ctx, &ctx->rounds_done, error_code);
+    }
+}
+
+static void s_pipe_bench_write_task_fn(struct aws_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+
+    struct pipe_bench_ctx *ctx = arg;
+    if (status != AWS_TASK_STATUS_RUN_READY) {
+        s_pipe_bench_flag_done(ctx, &ctx->rounds_done, AWS_ERROR_UNKNOWN);
+        return;
+    }
+
+    struct aws_byte_cursor byte_cursor = {.ptr = &ctx->write_byte, .len = 1};
+    ctx->round_start_ns = aws_benchmark_clock_ns();
+    if (aws_pipe_write(&ctx->write_end, byte_cursor, s_pipe_bench_on_write_completed, ctx)) {
+        s_pipe_bench_flag_done(ctx, &ctx->rounds_done, aws_last_error());
+    }
+}
+
+static void s_pipe_bench_on_readable(struct aws_pipe_read_end *read_end, int error_code, void *user_data) {
+    struct pipe_bench_ctx *ctx = user_data;
+
+    if (error_code != AWS_ERROR_SUCCESS) {
+        s_pipe_bench_flag_done(ctx, &ctx->rounds_done, error_code);
+        return;
+    }
+
+    uint64_t now_ns = aws_benchmark_clock_ns();
+
+    /* Drain; the event is edge-triggered. */
+    struct aws_byte_buf read_buf = aws_byte_buf_from_empty_array(ctx->read_storage, sizeof(ctx->read_storage));
+    if (aws_pipe_read(read_end, &read_buf, NULL)) {
+        /* A spurious wakeup with nothing to read; the byte is still in flight. */
+        return;
+    }
+
+    ctx->total_latency_ns += now_ns - ctx->round_start_ns;
+    ++ctx->rounds_completed;
+
+    if (ctx->rounds_completed < PIPE_WAKEUP_ROUNDS) {
+        aws_task_init(&ctx->write_task, s_pipe_bench_write_task_fn, ctx, "benchmark_pipe_write");
+        aws_event_loop_schedule_task_now(ctx->write_loop, &ctx->write_task);
+    } else {
+        s_pipe_bench_flag_done(ctx, &ctx->rounds_done, AWS_ERROR_SUCCESS);
+    }
+}
+
+static void s_pipe_bench_subscribe_task_fn(struct aws_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+
+    struct pipe_bench_ctx *ctx = arg;
+    int error_code = AWS_ERROR_SUCCESS;
+    if (status != AWS_TASK_STATUS_RUN_READY ||
+        aws_pipe_subscribe_to_readable_events(&ctx->read_end, s_pipe_bench_on_readable, ctx)) {
+        error_code = aws_last_error();
+        if (error_code == AWS_ERROR_SUCCESS) {
+            error_code = AWS_ERROR_UNKNOWN;
+        }
+    }
+    s_pipe_bench_flag_done(ctx, &ctx->subscribe_done, error_code);
+}
+
+static void s_pipe_bench_close_read_task_fn(struct aws_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    (void)status;
+
+    struct pipe_bench_ctx *ctx = arg;
+    aws_pipe_clean_up_read_end(&ctx->read_end);
+    s_pipe_bench_flag_done(ctx, &ctx->read_end_closed, AWS_ERROR_SUCCESS);
+}
+
+static void s_pipe_bench_close_write_task_fn(struct aws_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    (void)status;
+
+    struct pipe_bench_ctx *ctx = arg;
+    aws_pipe_clean_up_write_end(&ctx->write_end);
+    s_pipe_bench_flag_done(ctx, &ctx->write_end_closed, AWS_ERROR_SUCCESS);
+}
+
+/*
+ * Pipe wakeup latency: the write-end loop writes one byte, the read-end loop's readable callback
+ * timestamps its arrival, ping-pong for PIPE_WAKEUP_ROUNDS. The reported per-op time is one
+ * write-to-readable-callback hop across threads, which is dominated by the eventfd/pipe wakeup.
+ */
+int aws_benchmark_pipe_wakeup_latency(struct aws_allocator *allocator, struct aws_benchmark_result *result) {
+
+    int op_result = AWS_OP_ERR;
+
+    struct pipe_bench_ctx ctx;
+    AWS_ZERO_STRUCT(ctx);
+    aws_mutex_init(&ctx.lock);
+    aws_condition_variable_init(&ctx.signal);
+
+    ctx.write_loop = aws_event_loop_new_default(allocator, aws_high_res_clock_get_ticks);
+    ctx.read_loop = aws_event_loop_new_default(allocator, aws_high_res_clock_get_ticks);
+    if (ctx.write_loop == NULL || ctx.read_loop == NULL || aws_event_loop_run(ctx.write_loop) ||
+        aws_event_loop_run(ctx.read_loop)) {
+        goto clean_up;
+    }
+
+    if (aws_pipe_init(&ctx.read_end, ctx.read_loop, &ctx.write_end, ctx.write_loop, allocator)) {
+        goto clean_up;
+    }
+
+    aws_task_init(&ctx.subscribe_task, s_pipe_bench_subscribe_task_fn, &ctx, "benchmark_pipe_subscribe");
+    aws_event_loop_schedule_task_now(ctx.read_loop, &ctx.subscribe_task);
+    s_pipe_bench_wait(&ctx, &ctx.subscribe_done);
+    if (ctx.error_code != AWS_ERROR_SUCCESS) {
+        goto clean_up_pipe;
+    }
+
+    aws_task_init(&ctx.write_task, s_pipe_bench_write_task_fn, &ctx, "benchmark_pipe_write");
+    aws_event_loop_schedule_task_now(ctx.write_loop, &ctx.write_task);
+
+    s_pipe_bench_wait(&ctx, &ctx.rounds_done);
+    if (ctx.error_code != AWS_ERROR_SUCCESS) {
+        goto clean_up_pipe;
+    }
+
+    result->total_ns = ctx.total_latency_ns;
+    result->iterations = ctx.rounds_completed;
+    op_result = AWS_OP_SUCCESS;
+
+clean_up_pipe:
+    aws_task_init(&ctx.close_read_task, s_pipe_bench_close_read_task_fn, &ctx, "benchmark_pipe_close_read");
+    aws_event_loop_schedule_task_now(ctx.read_loop, &ctx.close_read_task);
+    s_pipe_bench_wait(&ctx, &ctx.read_end_closed);
+
+    aws_task_init(&ctx.close_write_task, s_pipe_bench_close_write_task_fn, &ctx, "benchmark_pipe_close_write");
+    aws_event_loop_schedule_task_now(ctx.write_loop, &ctx.close_write_task);
+    s_pipe_bench_wait(&ctx, &ctx.write_end_closed);
+
+clean_up:
+    if (ctx.read_loop != NULL) {
+        aws_event_loop_destroy(ctx.read_loop);
+    }
+    if (ctx.write_loop != NULL) {
+        aws_event_loop_destroy(ctx.write_loop);
+    }
+    aws_condition_variable_clean_up(&ctx.signal);
+    aws_mutex_clean_up(&ctx.lock);
+    return op_result;
+}
@@ -0,0 +1,88 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "benchmark_cases.h"
+
+#include <aws/common/task_scheduler.h>
+
+enum { SCHEDULER_TARGET_OPS = 200 * 1000 };
+
+static void s_noop_task_fn(struct aws_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    (void)arg;
+    (void)status;
+}
+
+/* Cheap deterministic timestamps, so every run exercises the same priority-queue shape. */
+static uint64_t s_next_timestamp(uint64_t *state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+/*
+ * Fills the scheduler to `depth` future tasks, then cancels them all, and repeats until roughly
+ * SCHEDULER_TARGET_OPS insert/cancel operations have run. Reported per-op cost is the average of
+ * one insert plus one cancel at that depth.
+ */
+static int s_benchmark_scheduler_insert_cancel(
+    struct aws_allocator *allocator,
+    struct aws_benchmark_result *result,
+    size_t depth) {
+
+    struct aws_task *tasks = aws_mem_calloc(allocator, depth, sizeof(struct aws_task));
+    if (tasks == NULL) {
+        return AWS_OP_ERR;
+    }
+
+    struct aws_task_scheduler scheduler;
+    if (aws_task_scheduler_init(&scheduler, allocator)) {
+        aws_mem_release(allocator, tasks);
+        return AWS_OP_ERR;
+    }
+
+    size_t rounds = (SCHEDULER_TARGET_OPS / (2 * depth)) + 1;
+    uint64_t timestamp_state = 0x9E3779B97F4A7C15ULL;
+
+    uint64_t start_ns = aws_benchmark_clock_ns();
+
+    for (size_t round = 0; round < rounds; ++round) {
+        for (size_t i = 0; i < depth; ++i) {
+            aws_task_init(&tasks[i], s_noop_task_fn, NULL, "benchmark_scheduler");
+            aws_task_scheduler_schedule_future(&scheduler, &tasks[i], s_next_timestamp(&timestamp_state));
+        }
+        for (size_t i = 0; i < depth; ++i) {
+            aws_task_scheduler_cancel_task(&scheduler, &tasks[i]);
+        }
+    }
+
+    result->total_ns = aws_benchmark_clock_ns() - start_ns;
+    result->iterations = (uint64_t)rounds * depth; /* one iteration = insert + cancel */
+
+    aws_task_scheduler_clean_up(&scheduler);
+    aws_mem_release(allocator, tasks);
+    return AWS_OP_SUCCESS;
+}
+
+int aws_benchmark_task_scheduler_insert_cancel_depth_100(
+    struct aws_allocator *allocator,
+    struct aws_benchmark_result *result) {
+    return s_benchmark_scheduler_insert_cancel(allocator, result, 100);
+}
+
+int aws_benchmark_task_scheduler_insert_cancel_depth_1000(
+    struct aws_allocator *allocator,
+    struct aws_benchmark_result *result) {
+    return s_benchmark_scheduler_insert_cancel(allocator, result, 1000);
+}
+
+int aws_benchmark_task_scheduler_insert_cancel_depth_10000(
+    struct aws_allocator *allocator,
+    struct aws_benchmark_result *result) {
+    return s_benchmark_scheduler_insert_cancel(allocator, result, 10000);
+}
@@ -0,0 +1,440 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+/*
+ * TLS handshakes-per-second driver. Holds `concurrency` connections in flight against a TLS
+ * echo server (e.g. `aws-c-io-loadgen server --cert ... --key ...`), shutting each channel
+ * down the moment negotiation completes and immediately dialing a replacement, so the server
+ * sees nothing but handshakes. Reports handshakes/sec plus p50/p99/p999 negotiation latency
+ * (socket connect through TLS completion) as one JSON line on stdout.
+ *
+ * Variants:
+ *   default           server-auth only, full handshake every time (fresh session per connection)
+ *   --resumed         enables the client session cache, so steady-state handshakes resume
+ *   --mtls            client certificate from --cert/--key
+ *   --pkcs11-lib SO   mTLS with the private key operated through PKCS#11 (e.g. a softhsm
+ *                     token); combine with --cert, --pkcs11-token-label, --pkcs11-key-label,
+ *                     --pkcs11-pin
+ *
+ * Certificate verification is disabled; this measures crypto and negotiation cost, not trust.
+ */
+
+#include <aws/common/atomics.h>
+#include <aws/common/clock.h>
+#include <aws/common/condition_variable.h>
+#include <aws/common/mutex.h>
+#include <aws/common/thread.h>
+#include <aws/io/channel.h>
+#include <aws/io/channel_bootstrap.h>
+#include <aws/io/event_loop.h>
+#include <aws/io/host_resolver.h>
+#include <aws/io/pkcs11.h>
+#include <aws/io/socket.h>
+#include <aws/io/tls_channel_handler.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum { HS_BENCH_MAX_SAMPLES = 1000 * 1000 };
+
+static uint64_t s_now_ns(void) {
+    uint64_t now = 0;
+    aws_high_res_clock_get_ticks(&now);
+    return now;
+}
+
+struct hs_bench_ctx {
+    struct aws_allocator *allocator;
+    struct aws_client_bootstrap *bootstrap;
+    const struct aws_tls_connection_options *tls_options;
+    const char *host;
+    uint32_t port;
+    const struct aws_socket_options *socket_options;
+
+    struct aws_atomic_var running;
+
+    struct aws_mutex lock;
+    struct aws_condition_variable signal;
+    size_t in_flight;
+
+    uint64_t *samples;
+    size_t sample_count;
+    uint64_t total_handshakes;
+    uint64_t failures;
+};
+
+struct hs_attempt {
+    struct hs_bench_ctx *ctx;
+    uint64_t start_ns;
+};
+
+static int s_hs_launch_attempt(struct hs_bench_ctx *ctx);
+
+/* Called when an attempt reaches its end of life (successful channel closed, or setup failed). */
+static void s_hs_attempt_finished(struct hs_attempt *attempt) {
+    struct hs_bench_ctx *ctx = attempt->ctx;
+    aws_mem_release(ctx->allocator, attempt);
+
+    if (aws_atomic_load_int(&ctx->running) != 0 && s_hs_launch_attempt(ctx) == AWS_OP_SUCCESS) {
+        return;
+    }
+
+    aws_mutex_lock(&ctx->lock);
+    --ctx->in_flight;
+    aws_mutex_unlock(&ctx->lock);
+    aws_condition_variable_notify_one(&ctx->signal);
+}
+
+static void s_hs_on_channel_setup(
+    struct aws_client_bootstrap *bootstrap,
+    int error_code,
+    struct aws_channel *channel,
+    void *user_data) {
+    (void)bootstrap;
+
+    struct hs_attempt *attempt = user_data;
+    struct hs_bench_ctx *ctx = attempt->ctx;
+
+    if (error_code != AWS_ERROR_SUCCESS) {
+        aws_mutex_lock(&ctx->lock);
+        ++ctx->failures;
+        aws_mutex_unlock(&ctx->lock);
+        /* No shutdown callback will come for a failed setup; retire the attempt here. */
+        s_hs_attempt_finished(attempt);
+        return;
+    }
+
+    uint64_t latency_ns = s_now_ns() - attempt->start_ns;
+
+    aws_mutex_lock(&ctx->lock);
+    ++ctx->total_handshakes;
+    if (ctx->sample_count < HS_BENCH_MAX_SAMPLES) {
+        ctx->samples[ctx->sample_count++] = latency_ns;
+    }
+    aws_mutex_unlock(&ctx->lock);
+
+    aws_channel_shutdown(channel, AWS_ERROR_SUCCESS);
+}
+
+static void s_hs_on_channel_shutdown(
+    struct aws_client_bootstrap *bootstrap,
+    int error_code,
+    struct aws_channel *channel,
+    void *user_data) {
+    (void)bootstrap;
+    (void)error_code;
+    (void)channel;
+
+    s_hs_attempt_finished(user_data);
+}
+
+static int s_hs_launch_attempt(struct hs_bench_ctx *ctx) {
+    struct hs_attempt *attempt = aws_mem_calloc(ctx->allocator, 1, sizeof(struct hs_attempt));
+    if (attempt == NULL) {
+        return AWS_OP_ERR;
+    }
+    attempt->ctx = ctx;
+    attempt->start_ns = s_now_ns();
+
+    struct aws_socket_channel_bootstrap_options channel_options = {
+        .bootstrap = ctx->bootstrap,
+        .host_name = ctx->host,
+        .port = ctx->port,
+        .socket_options = ctx->socket_options,
+        .tls_options = ctx->tls_options,
+        .setup_callback = s_hs_on_channel_setup,
+        .shutdown_callback = s_hs_on_channel_shutdown,
+        .user_data = attempt,
+    };
+
+    if (aws_client_bootstrap_new_socket_channel(&channel_options)) {
+        aws_mem_release(ctx->allocator, attempt);
+        aws_mutex_lock(&ctx->lock);
+        ++ctx->failures;
+        aws_mutex_unlock(&ctx->lock);
+        return AWS_OP_ERR;
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static bool s_hs_all_done_pred(void *arg) {
+    struct hs_bench_ctx *ctx = arg;
+    return ctx->in_flight == 0;
+}
+
+static int s_compare_u64(const void *a, const void *b) {
+    uint64_t lhs = *(const uint64_t *)a;
+    uint64_t rhs = *(const uint64_t *)b;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+static uint64_t s_percentile_ns(const uint64_t *sorted, size_t count, double percentile) {
+    if (count == 0) {
+        return 0;
+    }
+    return sorted[(size_t)((double)(count - 1) * percentile)];
+}
+
+struct hs_bench_args {
+    const char *host;
+    uint32_t port;
+    size_t concurrency;
+    uint64_t duration_secs;
+    bool resumed;
+    bool mtls;
+    const char *cert_path;
+    const char *key_path;
+    const char *pkcs11_lib_path;
+    const char *pkcs11_token_label;
+    const char *pkcs11_key_label;
+    const char *pkcs11_pin;
+};
+
+static void s_usage(void) {
+    fprintf(
+        stderr,
+        "usage:\n"
+        "  aws-c-io-tls-handshake-bench --host HOST --port PORT [--concurrency N]\n"
+        "      [--duration-secs D] [--resumed]\n"
+        "      [--mtls --cert PEM --key PEM]\n"
+        "      [--pkcs11-lib SO --cert PEM --pkcs11-token-label LABEL\n"
+        "       --pkcs11-key-label LABEL --pkcs11-pin PIN]\n");
+    exit(1);
+}
+
+static void s_parse_args(int argc, char **argv, struct hs_bench_args *args) {
+    AWS_ZERO_STRUCT(*args);
+    args->host = "127.0.0.1";
+    args->concurrency = 8;
+    args->duration_secs = 5;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *flag = argv[i];
+        if (strcmp(flag, "--resumed") == 0) {
+            args->resumed = true;
+            continue;
+        }
+        if (strcmp(flag, "--mtls") == 0) {
+            args->mtls = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            s_usage();
+        }
+        const char *value = argv[++i];
+        if (strcmp(flag, "--host") == 0) {
+            args->host = value;
+        } else if (strcmp(flag, "--port") == 0) {
+            args->port = (uint32_t)atoi(value);
+        } else if (strcmp(flag, "--concurrency") == 0) {
+            args->concurrency = (size_t)strtoull(value, NULL, 10);
+        } else if (strcmp(flag, "--duration-secs") == 0) {
+            args->duration_secs = strtoull(value, NULL, 10);
+        } else if (strcmp(flag, "--cert") == 0) {
+            args->cert_path = value;
+        } else if (strcmp(flag, "--key") == 0) {
+            args->key_path = value;
+        } else if (strcmp(flag, "--pkcs11-lib") == 0) {
+            args->pkcs11_lib_path = value;
+        } else if (strcmp(flag, "--pkcs11-token-label") == 0) {
+            args->pkcs11_token_label = value;
+        } else if (strcmp(flag, "--pkcs11-key-label") == 0) {
+            args->pkcs11_key_label = value;
+        } else if (strcmp(flag, "--pkcs11-pin") == 0) {
+            args->pkcs11_pin = value;
+        } else {
+            s_usage();
+        }
+    }
+
+    if (args->port == 0 || args->concurrency == 0 || args->duration_secs == 0) {
+        s_usage();
+    }
+    if (args->mtls && (args->cert_path == NULL || args->key_path == NULL)) {
+        s_usage();
+    }
+    if (args->pkcs11_lib_path != NULL && args->cert_path == NULL) {
+        s_usage();
+    }
+    if (args->mtls && args->pkcs11_lib_path != NULL) {
+        fprintf(stderr, "--mtls and --pkcs11-lib are mutually exclusive\n");
+        s_usage();
+    }
+}
+
+int main(int argc, char **argv) {
+    struct hs_bench_args args;
+    s_parse_args(argc, argv, &args);
+
+    struct aws_allocator *allocator = aws_default_allocator();
+    aws_io_library_init(allocator);
+
+    int exit_code = 1;
+
+    struct aws_event_loop_group *el_group = aws_event_loop_group_new_default(allocator, 0, NULL);
+    struct aws_host_resolver_default_options resolver_options = {
+        .max_entries = 8,
+        .el_group = el_group,
+    };
+    struct aws_host_resolver *resolver = aws_host_resolver_new_default(allocator, &resolver_options);
+    struct aws_client_bootstrap_options bootstrap_options = {
+        .event_loop_group = el_group,
+        .host_resolver = resolver,
+    };
+    struct aws_client_bootstrap *bootstrap = aws_client_bootstrap_new(allocator, &bootstrap_options);
+
+    /* Build the TLS context for the selected variant. */
+    struct aws_tls_ctx_options tls_ctx_options;
+    struct aws_pkcs11_lib *pkcs11_lib = NULL;
+    const char *variant = "server_auth";
+
+    if (args.pkcs11_lib_path != NULL) {
+        variant = "pkcs11_mtls";
+        struct aws_pkcs11_lib_options pkcs11_lib_options = {
+            .filename = aws_byte_cursor_from_c_str(args.pkcs11_lib_path),
+        };
+        pkcs11_lib = aws_pkcs11_lib_new(allocator, &pkcs11_lib_options);
+        if (pkcs11_lib == NULL) {
+            fprintf(stderr, "failed to load pkcs11 library: %s\n", aws_error_name(aws_last_error()));
+            goto clean_up_bootstrap;
+        }
+
+        struct aws_tls_ctx_pkcs11_options pkcs11_options = {
+            .pkcs11_lib = pkcs11_lib,
+            .cert_file_path = aws_byte_cursor_from_c_str(args.cert_path),
+        };
+        if (args.pkcs11_pin != NULL) {
+            pkcs11_options.user_pin = aws_byte_cursor_from_c_str(args.pkcs11_pin);
+        }
+        if (args.pkcs11_token_label != NULL) {
+            pkcs11_options.token_label = aws_byte_cursor_from_c_str(args.pkcs11_token_label);
+        }
+        if (args.pkcs11_key_label != NULL) {
+            pkcs11_options.private_key_object_label = aws_byte_cursor_from_c_str(args.pkcs11_key_label);
+        }
+        if (aws_tls_ctx_options_init_client_mtls_with_pkcs11(&tls_ctx_options, allocator, &pkcs11_options)) {
+            fprintf(stderr, "pkcs11 tls options failed: %s\n", aws_error_name(aws_last_error()));
+            goto clean_up_bootstrap;
+        }
+    } else if (args.mtls) {
+        variant = "mtls";
+        if (aws_tls_ctx_options_init_client_mtls_from_path(
+                &tls_ctx_options, allocator, args.cert_path, args.key_path)) {
+            fprintf(stderr, "failed to load client cert/key: %s\n", aws_error_name(aws_last_error()));
+            goto clean_up_bootstrap;
+        }
+    } else {
+        aws_tls_ctx_options_init_default_client(&tls_ctx_options, allocator);
+    }
+    aws_tls_ctx_options_set_verify_peer(&tls_ctx_options, false);
+
+    if (args.resumed) {
+        if (aws_tls_ctx_options_set_session_cache(&tls_ctx_options, NULL)) {
+            fprintf(stderr, "failed to enable session cache: %s\n", aws_error_name(aws_last_error()));
+            goto clean_up_bootstrap;
+        }
+    }
+
+    struct aws_tls_ctx *tls_ctx = aws_tls_client_ctx_new(allocator, &tls_ctx_options);
+    if (tls_ctx == NULL) {
+        fprintf(stderr, "failed to create tls ctx: %s\n", aws_error_name(aws_last_error()));
+        goto clean_up_bootstrap;
+    }
+
+    struct aws_tls_connection_options tls_options;
+    aws_tls_connection_options_init_from_ctx(&tls_options, tls_ctx);
+    struct aws_byte_cursor host_cursor = aws_byte_cursor_from_c_str(args.host);
+    aws_tls_connection_options_set_server_name(&tls_options, allocator, &host_cursor);
+
+    struct aws_socket_options socket_options = {
+        .type = AWS_SOCKET_STREAM,
+        .domain = AWS_SOCKET_IPV4,
+        .connect_timeout_ms = 10000,
+    };
+
+    struct hs_bench_ctx ctx;
+    AWS_ZERO_STRUCT(ctx);
+    ctx.allocator = allocator;
+    ctx.bootstrap = bootstrap;
+    ctx.tls_options = &tls_options;
+    ctx.host = args.host;
+    ctx.port = args.port;
+    ctx.socket_options = &socket_options;
+    aws_atomic_init_int(&ctx.running, 1);
+    aws_mutex_init(&ctx.lock);
+    aws_condition_variable_init(&ctx.signal);
+    ctx.samples = aws_mem_calloc(allocator, HS_BENCH_MAX_SAMPLES, sizeof(uint64_t));
+
+    fprintf(
+        stderr,
+        "running %s: %zu concurrent handshakes against %s:%u for %" PRIu64 "s...\n",
+        variant,
+        args.concurrency,
+        args.host,
+        args.port,
+        args.duration_secs);
+
+    ctx.in_flight = args.concurrency;
+    size_t launch_failures = 0;
+    for (size_t i = 0; i < args.concurrency; ++i) {
+        if (s_hs_launch_attempt(&ctx)) {
+            ++launch_failures;
+        }
+    }
+    aws_mutex_lock(&ctx.lock);
+    ctx.in_flight -= launch_failures;
+    aws_mutex_unlock(&ctx.lock);
+
+    uint64_t start_ns = s_now_ns();
+    aws_thread_current_sleep(args.duration_secs * 1000000000ULL);
+    aws_atomic_store_int(&ctx.running, 0);
+
+    aws_mutex_lock(&ctx.lock);
+    aws_condition_variable_wait_pred(&ctx.signal, &ctx.lock, s_hs_all_done_pred, &ctx);
+    aws_mutex_unlock(&ctx.lock);
+    uint64_t elapsed_ns = s_now_ns() - start_ns;
+
+    qsort(ctx.samples, ctx.sample_count, sizeof(uint64_t), s_compare_u64);
+    double elapsed_secs = (double)elapsed_ns / 1e9;
+    double handshakes_per_sec = elapsed_secs > 0.0 ? (double)ctx.total_handshakes / elapsed_secs : 0.0;
+
+    printf(
+        "{\"variant\": \"%s\", \"concurrency\": %zu, \"duration_secs\": %" PRIu64
+        ", \"handshakes\": %" PRIu64 ", \"handshakes_per_sec\": %.1f, \"failures\": %" PRIu64
+        ", \"hs_p50_ns\": %" PRIu64 ", \"hs_p99_ns\": %" PRIu64 ", \"hs_p999_ns\": %" PRIu64 "}\n",
+        variant,
+        args.concurrency,
+        args.duration_secs,
+        ctx.total_handshakes,
+        handshakes_per_sec,
+        ctx.failures,
+        s_percentile_ns(ctx.samples, ctx.sample_count, 0.50),
+        s_percentile_ns(ctx.samples, ctx.sample_count, 0.99),
+        s_percentile_ns(ctx.samples, ctx.sample_count, 0.999));
+
+    exit_code = (ctx.total_handshakes > 0) ? 0 : 1;
+
+    aws_mem_release(allocator, ctx.samples);
+    aws_condition_variable_clean_up(&ctx.signal);
+    aws_mutex_clean_up(&ctx.lock);
+    aws_tls_connection_options_clean_up(&tls_options);
+    aws_tls_ctx_release(tls_ctx);
+    aws_tls_ctx_options_clean_up(&tls_ctx_options);
+
+clean_up_bootstrap:
+    if (pkcs11_lib != NULL) {
+        aws_pkcs11_lib_release(pkcs11_lib);
+    }
+    aws_client_bootstrap_release(bootstrap);
+    aws_host_resolver_release(resolver);
+    aws_event_loop_group_release(el_group);
+    aws_thread_join_all_managed();
+
+    aws_io_library_clean_up();
+    return exit_code;
+}
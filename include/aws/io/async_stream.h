@@ -25,6 +25,7 @@ AWS_PUSH_SANE_WARNING_LEVEL
 
 struct aws_async_input_stream;
 struct aws_byte_buf;
+struct aws_event_loop_group;
 struct aws_future_bool;
 struct aws_input_stream;
 
@@ -52,6 +53,17 @@ struct aws_async_input_stream_vtable {
      * or a result bool indicating whether EOF has been reached.
      */
     struct aws_future_bool *(*read)(struct aws_async_input_stream *stream, struct aws_byte_buf *dest);
+
+    /**
+     * Optional.
+     * Read into several buffers, filling each in turn, completing when every buffer is full
+     * or EOF is reached.  Same rules as read() otherwise.
+     * If not set, aws_async_input_stream_readv() falls back to filling one buffer at a time.
+     */
+    struct aws_future_bool *(*readv)(
+        struct aws_async_input_stream *stream,
+        struct aws_byte_buf *dest_array,
+        size_t dest_count);
 };
 
 AWS_EXTERN_C_BEGIN
@@ -111,6 +123,55 @@ struct aws_future_bool *aws_async_input_stream_read_to_fill(
     struct aws_async_input_stream *stream,
     struct aws_byte_buf *dest);
 
+/**
+ * Read from the async stream into an array of buffers, filling each in turn, until every
+ * buffer is full or EOF is reached.  One call can fill a whole batch of fixed-size buffers
+ * (e.g. one aws_io_message per channel fragment) instead of paying a round trip per buffer.
+ * Returns a future, which will contain an error code if something went wrong,
+ * or a result bool indicating whether EOF has been reached.
+ *
+ * WARNING: Every buffer must have space available.
+ * WARNING: Do not read again until the previous read is complete.
+ */
+AWS_IO_API
+struct aws_future_bool *aws_async_input_stream_readv(
+    struct aws_async_input_stream *stream,
+    struct aws_byte_buf *dest_array,
+    size_t dest_count);
+
+/**
+ * Create an async stream that reads a (not-yet-opened) file.
+ * Each read() runs as a task on a thread from reading_elg, so disk latency never blocks the
+ * calling thread; use a dedicated event loop group for file I/O rather than the one driving
+ * your connections. The stream pins one loop from the group at creation so reads stay
+ * sequential and the file's pages stay warm on one thread. Use
+ * aws_future_bool_register_event_loop_callback() to get the completion delivered back on
+ * your own loop.
+ * Destruction closes the file.
+ * Returns NULL on failure (the file could not be opened).
+ */
+AWS_IO_API
+struct aws_async_input_stream *aws_async_input_stream_new_from_file(
+    struct aws_allocator *alloc,
+    const char *file_name,
+    struct aws_event_loop_group *reading_elg);
+
+/**
+ * Create a read-ahead adapter around another async stream.
+ * The adapter keeps reading from the source into a ring of buffer_count pooled buffers of
+ * buffer_size bytes while the caller is busy elsewhere, so the caller's next read() usually
+ * completes instantly from prefetched data. Use this to overlap source latency (e.g. disk)
+ * with whatever the caller does between reads (e.g. network sends).
+ * Source reads stay serial, as the vtable requires; read-ahead depth is buffer_count.
+ * Takes a reference on the source stream, released on destruction.
+ */
+AWS_IO_API
+struct aws_async_input_stream *aws_async_input_stream_new_read_ahead(
+    struct aws_allocator *alloc,
+    struct aws_async_input_stream *source,
+    size_t buffer_size,
+    size_t buffer_count);
+
 AWS_EXTERN_C_END
 AWS_POP_SANE_WARNING_LEVEL
 
@@ -28,6 +28,21 @@ typedef void(aws_channel_on_setup_completed_fn)(struct aws_channel *channel, int
 /* Callback called when a channel is completely shutdown. error_code refers to the reason the channel was closed. */
 typedef void(aws_channel_on_shutdown_completed_fn)(struct aws_channel *channel, int error_code, void *user_data);
 
+/**
+ * Invoked (on the channel's thread) when the channel crosses a congestion watermark. 'congested' is
+ * true when the watermark signaling congestion was crossed (write queue reached its high watermark,
+ * or read window drained to its low watermark) and false when the channel has recovered past the
+ * opposite watermark. Each edge fires once per crossing.
+ */
+typedef void(aws_channel_on_watermark_fn)(struct aws_channel *channel, bool congested, void *user_data);
+
+/**
+ * Invoked when an aws_channel_migrate() call finishes. On success error_code is AWS_ERROR_SUCCESS and the callback
+ * runs on the destination loop's thread; on failure the channel is untouched (or shut down, for failures past the
+ * point of no return) and the thread the callback runs on is unspecified.
+ */
+typedef void(aws_channel_on_migration_completed_fn)(struct aws_channel *channel, int error_code, void *user_data);
+
 struct aws_channel_slot {
     struct aws_allocator *alloc;
     struct aws_channel *channel;
@@ -37,6 +52,11 @@ struct aws_channel_slot {
     size_t window_size;
     size_t upstream_message_overhead;
     size_t current_window_update_batch_size;
+    /* position in the channel's fused dispatch table; maintained by the channel, do not touch */
+    size_t fused_index;
+    /* write messages parked here until the tick-end flush (see enable_deferred_write_flush);
+     * maintained by the channel, do not touch */
+    struct aws_linked_list deferred_writes;
 };
 
 struct aws_channel_task;
@@ -131,6 +151,20 @@ struct aws_channel_handler_vtable {
      * from the data source.
      */
     void (*trigger_read)(struct aws_channel_handler *handler);
+
+    /**
+     * Optional (may be NULL, meaning the handler holds no event-loop-bound resources). Invoked on the channel's
+     * current event-loop thread while the channel is migrating to another loop (see aws_channel_migrate()). The
+     * handler must release anything tied to that loop, e.g. an io-event subscription via
+     * aws_socket_unassign_from_event_loop(). A handler that implements this must implement attach_to_event_loop too.
+     */
+    int (*detach_from_event_loop)(struct aws_channel_handler *handler);
+
+    /**
+     * Second half of detach_from_event_loop: invoked on the destination loop's thread to re-acquire whatever
+     * detach released, e.g. aws_socket_assign_to_event_loop().
+     */
+    int (*attach_to_event_loop)(struct aws_channel_handler *handler, struct aws_event_loop *event_loop);
 };
 
 struct aws_channel_handler {
@@ -153,6 +187,22 @@ struct aws_channel_handler {
  *  Unless otherwise
  *  specified all functions for channels and channel slots must be executed within that channel's event-loop's thread.
  **/
+/*
+ * How much per-channel statistics instrumentation a channel carries. At fleet scale (100k channels
+ * on a box), even cheap per-channel gather/reset traffic adds up, and often only loop-level
+ * aggregates are wanted.
+ */
+enum aws_channel_statistics_mode {
+    /* every channel is fully instrumented and reports through its own statistics handler (default) */
+    AWS_CHANNEL_STATS_FULL = 0,
+    /* every Nth channel registered on a loop is fully instrumented (N = statistics_sample_rate);
+     * the rest behave as AWS_CHANNEL_STATS_AGGREGATE_ONLY */
+    AWS_CHANNEL_STATS_SAMPLED,
+    /* no per-channel reporting or timing: dispatch counters roll up into a per-event-loop
+     * aggregate, fetched with aws_channel_fetch_aggregate_statistics() */
+    AWS_CHANNEL_STATS_AGGREGATE_ONLY,
+};
+
 struct aws_channel_options {
     struct aws_event_loop *event_loop;
     aws_channel_on_setup_completed_fn *on_setup_completed;
@@ -160,6 +210,46 @@ struct aws_channel_options {
     void *setup_user_data;
     void *shutdown_user_data;
     bool enable_read_back_pressure;
+    /* Only used when enable_read_back_pressure is set. Read-window increments accumulate per slot
+     * and flush with one propagation task; the flush is only scheduled once the window has
+     * drained to this many bytes. 0 means twice the channel's max fragment size. Larger values
+     * propagate less often at the cost of more buffered data before upstream handlers resume. */
+    size_t window_update_batch_emit_threshold;
+    /* Maximum fragment (aws_io_message) size for this channel. 0 means the process-wide default
+     * g_aws_channel_max_fragment_size. Values above the default are backed by larger message-pool
+     * size classes on the channel's event-loop, so bulk transfers stop being chopped into
+     * default-size pieces with per-piece handler traversal. */
+    size_t max_fragment_size;
+    /* Write-queue watermarks, in bytes submitted to the transport but not yet accepted by the
+     * kernel. on_write_watermark fires with congested=true when the queue reaches
+     * write_queue_high_watermark and with congested=false when it drains back to
+     * write_queue_low_watermark. A high watermark of 0 disables the callback. */
+    size_t write_queue_high_watermark;
+    size_t write_queue_low_watermark;
+    aws_channel_on_watermark_fn *on_write_watermark;
+    /* Read-window watermarks, in bytes of downstream window remaining below the transport's
+     * slot. Only used when enable_read_back_pressure is set. on_read_watermark fires with
+     * congested=true when the window drains to read_window_low_watermark and with
+     * congested=false when it recovers to read_window_high_watermark. A high watermark of 0
+     * disables the callback. */
+    size_t read_window_low_watermark;
+    size_t read_window_high_watermark;
+    aws_channel_on_watermark_fn *on_read_watermark;
+    void *watermark_user_data;
+    /* Statistics instrumentation mode (see aws_channel_statistics_mode). Only consulted once a
+     * statistics handler is assigned; a channel that never gets one carries no instrumentation
+     * regardless of mode. */
+    enum aws_channel_statistics_mode statistics_mode;
+    /* Only used with AWS_CHANNEL_STATS_SAMPLED: one channel in every statistics_sample_rate
+     * registered on a loop is fully instrumented. 0 means the default of 100 (1% sampled). */
+    uint32_t statistics_sample_rate;
+    /* Opt-in tick-end write coalescing. Write messages accumulate on the sending slot instead of
+     * traversing the slot chain the moment they're produced, and a single flush pass at the end
+     * of the event-loop tick drains them together. A tick that produces several messages then
+     * costs one traversal instead of one per message, and downstream handlers see the whole
+     * batch back-to-back (pairing with TLS record coalescing and vectored socket writes). Adds
+     * up to a tick of latency to writes; leave it off for latency-sensitive channels. */
+    bool enable_deferred_write_flush;
 };
 
 AWS_EXTERN_C_BEGIN
@@ -205,6 +295,19 @@ void aws_channel_destroy(struct aws_channel *channel);
 AWS_IO_API
 int aws_channel_shutdown(struct aws_channel *channel, int error_code);
 
+/**
+ * Initiates an abortive shutdown of the channel. Follows the same two-direction sequence as
+ * aws_channel_shutdown(), but handlers are told to free scarce resources immediately: the socket is
+ * closed during the read pass rather than after pending writes flush, handlers short-circuit their
+ * graceful teardown, and 'callbacks->shutdown_completed' typically fires within a single event-loop
+ * tick. Use this to discard connections that are already known to be dead (e.g. broken pooled
+ * connections), where graceful teardown is wasted latency. Any un-flushed outbound data is lost.
+ *
+ * This function can be called from any thread.
+ */
+AWS_IO_API
+int aws_channel_shutdown_abortive(struct aws_channel *channel, int error_code);
+
 /**
  * Prevent a channel's memory from being freed.
  * Any number of users may acquire a hold to prevent a channel and its handlers from being unexpectedly freed.
@@ -236,6 +339,79 @@ struct aws_channel_slot *aws_channel_slot_new(struct aws_channel *channel);
 AWS_IO_API
 struct aws_event_loop *aws_channel_get_event_loop(struct aws_channel *channel);
 
+/**
+ * Moves a running channel to another event loop, enabling hot-spot rebalancing and draining of loops retired via
+ * aws_event_loop_group_shrink(). The move happens at a safe point on the current loop's thread: every handler's
+ * detach_from_event_loop() hook releases its loop-bound resources (handlers with NULL hooks are assumed to hold
+ * none), the channel's task scheduling and message pool are switched over, and the handlers are re-attached on the
+ * destination loop's thread.
+ *
+ * The channel must be quiescent at the safe point: if any channel tasks are pending (scheduled or cross-thread) the
+ * migration completes with AWS_ERROR_INVALID_STATE and can simply be retried. Callers must also ensure no
+ * aws_io_messages acquired from the channel are in flight, since message buffers return to the loop-local pool they
+ * came from; between requests on an idle connection is the intended moment.
+ *
+ * on_completed fires exactly once. Fails immediately (returning AWS_OP_ERR without scheduling anything) if the
+ * channel is not active or new_loop is its current loop.
+ */
+AWS_IO_API
+int aws_channel_migrate(
+    struct aws_channel *channel,
+    struct aws_event_loop *new_loop,
+    aws_channel_on_migration_completed_fn *on_completed,
+    void *user_data);
+
+/**
+ * Returns the channel's maximum fragment size (see aws_channel_options).
+ */
+AWS_IO_API
+size_t aws_channel_get_max_fragment_size(const struct aws_channel *channel);
+
+/**
+ * Returns a bump allocator whose memory lives as long as the channel and is released wholesale when
+ * the channel is destroyed. Releasing individual allocations through it is a no-op, so objects whose
+ * lifetime already matches the channel's (slots, handler impls, per-channel tasks) can be drawn from
+ * it without changing their existing aws_mem_release() calls. The arena is created lazily; if it
+ * cannot be created, the channel's allocator is returned instead (in which case releases are real
+ * frees, which is equally correct). Must be called from the channel's thread, or before the channel
+ * is active.
+ */
+AWS_IO_API
+struct aws_allocator *aws_channel_get_arena_allocator(struct aws_channel *channel);
+
+struct aws_message_pool_creation_args;
+
+/**
+ * Pre-builds the lazily-created per-event-loop channel machinery so the first channel on the loop
+ * pays no lazy-init cost: the loop's shared message pool is created up front (sized by
+ * `message_pool_creation_args`, or the usual defaults when NULL - the args are ignored if the pool
+ * already exists), and up to `parked_channel_count` channel skeletons (struct plus a primed arena
+ * chunk) are parked in the loop's recycle cache, bounded by the cache's capacity.
+ * Must be called on the event loop's thread; most callers should go through
+ * aws_server_bootstrap_warm_up() instead.
+ */
+AWS_IO_API
+int aws_channel_prime_event_loop(
+    struct aws_allocator *allocator,
+    struct aws_event_loop *event_loop,
+    const struct aws_message_pool_creation_args *message_pool_creation_args,
+    size_t parked_channel_count);
+
+/**
+ * Reports the current depth, in bytes, of the transport's un-flushed write queue. Called by the
+ * channel's transport handler (e.g. the socket handler) as writes are submitted and completed;
+ * drives the write-queue watermark callback and the bytes_queued_write statistic gauge. Must be
+ * called from the channel's thread.
+ */
+AWS_IO_API
+void aws_channel_report_write_queue_size(struct aws_channel *channel, size_t bytes_queued);
+
+/**
+ * Returns the most recently reported write-queue depth, in bytes.
+ */
+AWS_IO_API
+size_t aws_channel_get_write_queue_size(const struct aws_channel *channel);
+
 /**
  * Fetches the current timestamp from the event-loop's clock, in nanoseconds.
  */
@@ -339,6 +515,48 @@ void aws_channel_schedule_task_future(
 AWS_IO_API
 int aws_channel_set_statistics_handler(struct aws_channel *channel, struct aws_crt_statistics_handler *handler);
 
+/**
+ * Fetch (and reset) the per-event-loop rollup of dispatch counters from channels running in
+ * AWS_CHANNEL_STATS_AGGREGATE_ONLY mode (including the unsampled majority under
+ * AWS_CHANNEL_STATS_SAMPLED). out_channel_count, if non-null, receives the number of channels
+ * currently contributing to the rollup. Must be called from the event loop's thread.
+ */
+AWS_IO_API
+int aws_channel_fetch_aggregate_statistics(
+    struct aws_event_loop *event_loop,
+    struct aws_crt_statistics_channel *out_stats,
+    uint64_t *out_channel_count);
+
+/**
+ * Invoked (on the channel's thread) when a channel's coarse idle timeout elapses without any
+ * intervening aws_channel_touch_idle_timeout() call. The timeout is disarmed before the callback
+ * runs; re-arm from the callback if the channel should keep being watched.
+ */
+typedef void(aws_channel_on_idle_timeout_fn)(struct aws_channel *channel, void *user_data);
+
+/**
+ * Arms (or re-arms) a coarse idle timeout on the channel. All channels on an event loop share a
+ * single once-per-second service ticking hashed deadline buckets, so arming costs no timer entry
+ * in the loop's scheduler and firing is accurate to roughly one second -- use
+ * aws_channel_schedule_task_future() instead when precision matters. A timeout_ms of 0 disarms.
+ * May only be called from the channel's event-loop thread.
+ */
+AWS_IO_API
+int aws_channel_set_idle_timeout(
+    struct aws_channel *channel,
+    uint64_t timeout_ms,
+    aws_channel_on_idle_timeout_fn *on_idle_timeout,
+    void *user_data);
+
+/**
+ * Marks the channel as active for idle-timeout purposes: the armed deadline is lazily pushed out
+ * to now + timeout the next time the service visits the channel. A single flag store -- cheap
+ * enough to call once per message. No-op on a channel with no armed timeout. May only be called
+ * from the channel's event-loop thread.
+ */
+AWS_IO_API
+void aws_channel_touch_idle_timeout(struct aws_channel *channel);
+
 /**
  * Returns true if the caller is on the event loop's thread. If false, you likely need to use
  * aws_channel_schedule_task(). This function is safe to call from any thread.
@@ -400,6 +618,24 @@ int aws_channel_slot_send_message(
     struct aws_io_message *message,
     enum aws_channel_direction dir);
 
+/**
+ * Fan-out write: sends a zero-copy reference to `shared_message` down this slot's write direction.
+ * Construct the payload once (e.g. via aws_channel_acquire_message_from_pool() on any channel),
+ * then call this once per subscriber slot, from each slot's channel thread; the payload is shared
+ * by reference counting (see aws_io_message_new_slice()) rather than copied, so a broadcast to N
+ * channels costs N small allocations instead of N payload copies. `on_completion`/`user_data` are
+ * per-call, so each channel gets its own completion callback. Treat the shared payload as
+ * immutable once the first broadcast has been issued; it returns to its pool after the caller's
+ * own release and every channel's write completes. On error the caller still owns
+ * `shared_message`; no reference was retained.
+ */
+AWS_IO_API
+int aws_channel_slot_send_broadcast_message(
+    struct aws_channel_slot *slot,
+    struct aws_io_message *shared_message,
+    aws_channel_on_message_write_completed_fn *on_completion,
+    void *user_data);
+
 /**
  * Convenience function that invokes aws_channel_acquire_message_from_pool(),
  * asking for the largest reasonable DATA message that can be sent in the write direction,
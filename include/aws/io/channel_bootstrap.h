@@ -94,6 +94,12 @@ struct aws_client_bootstrap_options {
 
 struct aws_server_bootstrap;
 
+/**
+ * Ref-counted, single-use handle for aborting one in-flight aws_client_bootstrap_new_socket_channel() call
+ * (see aws_socket_channel_bootstrap_options.cancellation_token).
+ */
+struct aws_client_connection_token;
+
 /**
  * If TLS is being used, this function is called once the socket has received an incoming connection, the channel has
  * been initialized, and TLS has been successfully negotiated. A TLS handler has already been added to the channel. If
@@ -139,6 +145,31 @@ typedef void(aws_server_bootstrap_on_accept_channel_shutdown_fn)(
 typedef void(
     aws_server_bootstrap_on_server_listener_destroy_fn)(struct aws_server_bootstrap *bootstrap, void *user_data);
 
+/**
+ * Invoked once every event loop in the server bootstrap's group has been warmed up
+ * (see aws_server_bootstrap_warm_up). Called from the thread of the last loop to finish.
+ */
+typedef void(aws_server_bootstrap_on_warm_up_complete_fn)(struct aws_server_bootstrap *bootstrap, void *user_data);
+
+struct aws_message_pool_creation_args;
+
+/**
+ * Options for aws_server_bootstrap_warm_up().
+ *
+ * message_pool_creation_args - (optional) initial sizing for each loop's shared message pool; when NULL the
+ *   same defaults the lazy path uses apply. Ignored on loops whose pool already exists. Copied.
+ * parked_channels_per_loop - number of channel skeletons (channel struct plus a primed arena chunk) to park
+ *   in each loop's recycle cache, bounded by the cache's capacity.
+ * on_complete - (optional) invoked once every loop has been primed.
+ * user_data - passed to on_complete.
+ */
+struct aws_server_bootstrap_warm_up_options {
+    const struct aws_message_pool_creation_args *message_pool_creation_args;
+    size_t parked_channels_per_loop;
+    aws_server_bootstrap_on_warm_up_complete_fn *on_complete;
+    void *user_data;
+};
+
 /**
  * aws_server_bootstrap manages listening sockets, creating and setting up channels to handle each incoming connection.
  */
@@ -169,6 +200,13 @@ struct aws_server_bootstrap {
  * requested_event_loop - if set, the connection will be placed on the requested event loop rather than one
  *  chosen internally from the bootstrap's associated event loop group.  It is an error to pass in an event loop
  *  that is not associated with the bootstrap's event loop group.
+ * overall_timeout_ms - (optional) wall-clock budget covering the entire connection attempt: host resolution,
+ *  every staggered socket connect, and TLS negotiation. When it expires before the setup_callback has fired,
+ *  whichever phase is active is aborted and the setup_callback is invoked with AWS_IO_SOCKET_TIMEOUT.
+ *  0 means no overall limit; socket_options->connect_timeout_ms still applies to each individual attempt.
+ * cancellation_token - (optional) token the caller can use to abort the connection attempt from any thread
+ *  (see aws_client_connection_token_cancel). The token is single-use: it tracks exactly one call to
+ *  aws_client_bootstrap_new_socket_channel. The caller keeps its reference and must release it.
  *
  * Immediately after the `shutdown_callback` returns, the channel is cleaned up automatically. All callbacks are invoked
  * in the thread of the event-loop that the new channel is assigned to.
@@ -187,6 +225,38 @@ struct aws_socket_channel_bootstrap_options {
     void *user_data;
     struct aws_event_loop *requested_event_loop;
     const struct aws_host_resolution_config *host_resolution_override_config;
+    uint64_t overall_timeout_ms;
+    struct aws_client_connection_token *cancellation_token;
+};
+
+struct aws_channel_pool;
+
+/**
+ * Invoked when a pooled channel acquisition completes. On success, error_code is AWS_ERROR_SUCCESS
+ * and channel is an established (and, if the pool has TLS options, negotiated) channel the caller
+ * now owns until it calls aws_channel_pool_release() or shuts the channel down. On failure, channel
+ * is NULL. Invoked either inline from aws_channel_pool_acquire() when an idle channel is available,
+ * or later from the connection's event-loop thread.
+ */
+typedef void(aws_channel_pool_on_channel_acquired_fn)(
+    struct aws_channel_pool *pool,
+    int error_code,
+    struct aws_channel *channel,
+    void *user_data);
+
+/**
+ * Configuration for a channel pool. A pool binds one set of socket options and (optionally) TLS
+ * connection options; channels inside it are keyed by host and port. max_channels_per_endpoint
+ * caps live channels (idle + checked out) per endpoint, 0 means the default of 8. idle_timeout_ms
+ * is how long a released channel may sit idle before the reaper shuts it down, 0 disables reaping.
+ */
+struct aws_channel_pool_options {
+    struct aws_client_bootstrap *bootstrap;
+    const struct aws_socket_options *socket_options;
+    const struct aws_tls_connection_options *tls_options;
+    size_t max_channels_per_endpoint;
+    uint64_t idle_timeout_ms;
+    bool enable_read_back_pressure;
 };
 
 /**
@@ -214,6 +284,20 @@ struct aws_server_socket_channel_bootstrap_options {
     aws_server_bootstrap_on_accept_channel_shutdown_fn *shutdown_callback;
     aws_server_bootstrap_on_server_listener_destroy_fn *destroy_callback;
     bool enable_read_back_pressure;
+    /**
+     * If set, one SO_REUSEPORT listening socket is created per event loop in the bootstrap's
+     * event loop group, each accepting on its own loop, and accepted connections stay on the loop
+     * that accepted them. The kernel load-balances incoming connections between the listeners, so
+     * accepts don't funnel through a single loop. Ignored on platforms without SO_REUSEPORT.
+     */
+    bool enable_reuseport_sharding;
+    /**
+     * Maximum number of inbound TLS handshakes this listener negotiates at once. Connections accepted past the
+     * limit are queued cheaply (socket accepted, TLS not yet driven) and negotiate as earlier handshakes finish,
+     * protecting established traffic from the asymmetric crypto of a reconnect storm. 0 means unlimited.
+     * Only meaningful when tls_options is set.
+     */
+    size_t maximum_concurrent_handshakes;
     void *user_data;
 };
 
@@ -251,6 +335,79 @@ AWS_IO_API int aws_client_bootstrap_set_alpn_callback(
  */
 AWS_IO_API int aws_client_bootstrap_new_socket_channel(struct aws_socket_channel_bootstrap_options *options);
 
+/**
+ * Creates a connection token to pass as aws_socket_channel_bootstrap_options.cancellation_token.
+ * A token tracks exactly one aws_client_bootstrap_new_socket_channel() call; create a fresh one per attempt.
+ */
+AWS_IO_API struct aws_client_connection_token *aws_client_connection_token_new(struct aws_allocator *allocator);
+
+/**
+ * Increments a connection token's ref count. Returns the same token passed in.
+ */
+AWS_IO_API struct aws_client_connection_token *aws_client_connection_token_acquire(
+    struct aws_client_connection_token *token);
+
+/**
+ * Decrements a connection token's ref count. When the ref count drops to zero, the token is destroyed.
+ * Releasing the token does NOT cancel the connection attempt it tracks.
+ */
+AWS_IO_API void aws_client_connection_token_release(struct aws_client_connection_token *token);
+
+/**
+ * Aborts the connection attempt this token was passed to. Safe to call from any thread; idempotent; a no-op once
+ * the setup_callback has been delivered. Whichever phase is active is torn down: in-flight socket connects are
+ * closed within one tick of the connection's event loop, and a channel mid TLS negotiation is shut down. The
+ * setup_callback is then invoked with AWS_ERROR_IO_OPERATION_CANCELLED. An in-progress DNS query itself cannot
+ * be interrupted; cancellation takes effect the moment the resolver calls back, before any socket is opened.
+ * Cancelling a token before it is passed to aws_client_bootstrap_new_socket_channel() makes that call fail
+ * synchronously with AWS_ERROR_IO_OPERATION_CANCELLED.
+ */
+AWS_IO_API void aws_client_connection_token_cancel(struct aws_client_connection_token *token);
+
+/**
+ * Creates a channel pool (see aws_channel_pool_options). Thread-safe.
+ */
+AWS_IO_API struct aws_channel_pool *aws_channel_pool_new(
+    struct aws_allocator *allocator,
+    const struct aws_channel_pool_options *options);
+
+/**
+ * Acquires an established channel to host:port. If an idle channel is parked for the endpoint, the
+ * callback fires inline with it; otherwise a new connection is bootstrapped, or - when the endpoint
+ * is at its channel cap - the acquisition waits for the next release. Returns an error only if the
+ * acquisition could not be started; all other outcomes are delivered through the callback.
+ */
+AWS_IO_API int aws_channel_pool_acquire(
+    struct aws_channel_pool *pool,
+    const char *host_name,
+    uint32_t port,
+    aws_channel_pool_on_channel_acquired_fn *callback,
+    void *user_data);
+
+/**
+ * Returns a healthy channel to its pool for reuse; it is handed to the oldest waiting acquisition
+ * or parked idle. Do not release a channel you have shut down or queued writes on - shut it down
+ * instead, and the pool will notice. Can be called from any thread.
+ */
+AWS_IO_API void aws_channel_pool_release(struct aws_channel_pool *pool, struct aws_channel *channel);
+
+/**
+ * Pre-connects up to 'count' channels to host:port (bounded by the endpoint cap) so later
+ * acquisitions find warm channels. Failures are absorbed; warm-up is best effort.
+ */
+AWS_IO_API int aws_channel_pool_warm_up(
+    struct aws_channel_pool *pool,
+    const char *host_name,
+    uint32_t port,
+    size_t count);
+
+/**
+ * Destroys the pool: idle channels are shut down, waiting acquisitions fail with
+ * AWS_IO_SOCKET_CLOSED, and checked-out channels remain valid (releasing them afterwards shuts
+ * them down). The pool memory is freed once the last in-flight connection drops its reference.
+ */
+AWS_IO_API void aws_channel_pool_destroy(struct aws_channel_pool *pool);
+
 /**
  * Initializes the server bootstrap with `allocator` and `el_group`. This object manages listeners, server connections,
  * and channels.
@@ -279,6 +436,19 @@ AWS_IO_API int aws_server_bootstrap_set_alpn_callback(
     struct aws_server_bootstrap *bootstrap,
     aws_channel_on_protocol_negotiated_fn *on_protocol_negotiated);
 
+/**
+ * Pre-initializes the lazily-created per-event-loop machinery (shared message pools, recycled channel
+ * skeletons and their arenas) on every loop in the bootstrap's event loop group, so the first connection
+ * accepted after a fresh start pays no lazy-init cost. Intended to run before the listener is created:
+ * call it, wait for on_complete, then call aws_server_bootstrap_new_socket_listener(). TLS contexts in
+ * this library are process-wide objects the caller builds before the listener exists, so constructing
+ * the aws_tls_ctx ahead of warm-up covers the TLS side. Returns an error only if the warm-up could not
+ * be started. Thread-safe.
+ */
+AWS_IO_API int aws_server_bootstrap_warm_up(
+    struct aws_server_bootstrap *bootstrap,
+    const struct aws_server_bootstrap_warm_up_options *options);
+
 /**
  * Sets up a server socket listener. If you are planning on using TLS, use
  * `aws_server_bootstrap_new_tls_socket_listener` instead. This creates a socket listener bound to `local_endpoint`
@@ -296,6 +466,20 @@ AWS_IO_API int aws_server_bootstrap_set_alpn_callback(
 AWS_IO_API struct aws_socket *aws_server_bootstrap_new_socket_listener(
     const struct aws_server_socket_channel_bootstrap_options *bootstrap_options);
 
+/**
+ * Sets up a channel on an already-connected socket, using the same machinery as a connection accepted by
+ * aws_server_bootstrap_new_socket_listener() — including TLS negotiation when tls_options is set. Intended
+ * for multi-process handoff tiers: one process accepts, passes the descriptor over a unix socket (see
+ * aws_socket_send_fd()), and the receiving process adopts it with aws_socket_init_from_fd() and hands it
+ * here. `socket` must be heap-allocated, open and connected; ownership transfers to the bootstrap, which
+ * cleans it up when the channel shuts down. Listener-only options (host_name, port,
+ * enable_reuseport_sharding) are ignored. Returns an error only if setup could not be started; failures
+ * after that arrive through incoming_callback exactly as they do for accepted connections.
+ */
+AWS_IO_API int aws_server_bootstrap_setup_socket_channel(
+    const struct aws_server_socket_channel_bootstrap_options *bootstrap_options,
+    struct aws_socket *socket);
+
 /**
  * Shuts down 'listener' and cleans up any resources associated with it. Any incoming channels on `listener` will still
  * be active. `destroy_callback` will be invoked after the server socket listener is destroyed, and all associated
@@ -305,6 +489,14 @@ AWS_IO_API void aws_server_bootstrap_destroy_socket_listener(
     struct aws_server_bootstrap *bootstrap,
     struct aws_socket *listener);
 
+/**
+ * Reports the number of accepted connections currently waiting for one of 'listener's concurrent-handshake slots
+ * (see aws_server_socket_channel_bootstrap_options.maximum_concurrent_handshakes). 'listener' must be a socket
+ * returned by aws_server_bootstrap_new_socket_listener. Safe to call from any thread; useful for alarming on
+ * reconnect storms.
+ */
+AWS_IO_API size_t aws_server_bootstrap_listener_get_queued_handshake_count(struct aws_socket *listener);
+
 AWS_EXTERN_C_END
 AWS_POP_SANE_WARNING_LEVEL
 
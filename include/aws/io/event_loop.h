@@ -9,8 +9,10 @@
 #include <aws/common/atomics.h>
 #include <aws/common/hash_table.h>
 #include <aws/common/ref_count.h>
+#include <aws/common/rw_lock.h>
 
 #include <aws/io/io.h>
+#include <aws/io/statistics.h>
 
 AWS_PUSH_SANE_WARNING_LEVEL
 
@@ -20,6 +22,13 @@ enum aws_io_event_type {
     AWS_IO_EVENT_TYPE_REMOTE_HANG_UP = 4,
     AWS_IO_EVENT_TYPE_CLOSED = 8,
     AWS_IO_EVENT_TYPE_ERROR = 16,
+    /**
+     * Subscription modifier, never reported back as an event: requests an exclusive-wakeup
+     * registration so the same fd can be subscribed on several event loops with each readiness
+     * event waking only one of them (EPOLLEXCLUSIVE on Linux). Loops without such a mechanism
+     * ignore the flag and subscribe normally.
+     */
+    AWS_IO_EVENT_TYPE_EXCLUSIVE_WAKEUP = 32,
 };
 
 struct aws_event_loop;
@@ -86,6 +95,9 @@ struct aws_event_loop_vtable {
     int (*stop)(struct aws_event_loop *event_loop);
     int (*wait_for_stop_completion)(struct aws_event_loop *event_loop);
     void (*schedule_task_now)(struct aws_event_loop *event_loop, struct aws_task *task);
+    /* optional: schedules into the loop's budget-limited background band; loops that leave this
+     * NULL run background tasks through schedule_task_now instead */
+    void (*schedule_task_now_background)(struct aws_event_loop *event_loop, struct aws_task *task);
     void (*schedule_task_future)(struct aws_event_loop *event_loop, struct aws_task *task, uint64_t run_at_nanos);
     void (*cancel_task)(struct aws_event_loop *event_loop, struct aws_task *task);
 #if AWS_USE_IO_COMPLETION_PORTS
@@ -110,8 +122,14 @@ struct aws_event_loop {
     struct aws_hash_table local_data;
     struct aws_atomic_var current_load_factor;
     uint64_t latest_tick_start;
+    /* cooperative tick budget in nanoseconds (see aws_event_loop_options.tick_budget_us); 0 disables */
+    uint64_t tick_budget_ns;
+    /* when true, the loop's shared message pool backs its slabs with hugepages
+     * (see aws_event_loop_options.hugepage_message_pool) */
+    bool hugepage_message_pool;
     size_t current_tick_latency_sum;
     struct aws_atomic_var next_flush_time;
+    struct aws_event_loop_tick_stats tick_stats;
     void *impl_data;
 };
 
@@ -127,6 +145,44 @@ struct aws_event_loop_local_object {
 struct aws_event_loop_options {
     aws_io_clock_fn *clock;
     struct aws_thread_options *thread_options;
+
+    /**
+     * If non-zero, the event loop busy-polls for this many microseconds after its last productive
+     * tick before falling back to a blocking wait. Trades a core for wakeup latency: while traffic
+     * is flowing the loop never sleeps, and an idle loop degrades to the normal blocking behavior
+     * once the budget expires. 0 (the default) disables spinning.
+     *
+     * Currently honored by the Linux epoll event loop.
+     */
+    uint64_t busy_poll_spin_duration_us;
+
+    /**
+     * Budget for the slow-task watchdog, in microseconds. A task that holds the loop thread longer
+     * than this gets a warn-level log with its type_tag and a running overrun count for that tag.
+     * 0 (the default) selects the watchdog's built-in budget; the watchdog is always on.
+     *
+     * Currently honored by the Linux epoll event loop.
+     */
+    uint64_t slow_task_budget_us;
+
+    /**
+     * Opt-in cooperative tick budget, in microseconds. Cooperating work loops (the socket
+     * handler's read loop, the TLS decrypt loop) poll aws_event_loop_tick_budget_exhausted()
+     * and, once the current tick has run past this budget, yield and reschedule themselves for
+     * the next tick instead of draining their backlog in one sitting -- bounding how long one
+     * busy channel can starve its neighbors on a shared loop. 0 (the default) disables the
+     * budget; cooperating loops then only yield at their own byte limits.
+     */
+    uint64_t tick_budget_us;
+
+    /**
+     * Opt-in: back the loop's shared message pool with hugepage slabs (MAP_HUGETLB, degrading to
+     * madvise(MADV_HUGEPAGE), then to ordinary pages when neither is available). Each loop gets
+     * its own slab, so a loop thread's message working set stays within a few TLB entries
+     * instead of one entry per 16KB message. Worth enabling on hosts with many loops and large
+     * pooled-message footprints; off by default.
+     */
+    bool hugepage_message_pool;
 };
 
 typedef struct aws_event_loop *(aws_new_event_loop_fn)(struct aws_allocator *alloc,
@@ -138,6 +194,32 @@ struct aws_event_loop_group {
     struct aws_array_list event_loops;
     struct aws_ref_count ref_count;
     struct aws_shutdown_callback_options shutdown_options;
+    /* recorded placement info so channel/bootstrap layers can make node-aware decisions */
+    uint16_t cpu_group;
+    bool is_pinned;
+
+    /* elasticity state (see aws_event_loop_group_grow()/aws_event_loop_group_shrink()).
+     * loops_lock guards event_loops and retired_event_loops; the creation-time clock and loop
+     * factory are kept so additional loops can be built the same way the originals were. */
+    struct aws_rw_lock loops_lock;
+    struct aws_array_list retired_event_loops;
+    aws_io_clock_fn *clock;
+    aws_new_event_loop_fn *new_loop_fn;
+    void *new_loop_user_data;
+    size_t loops_created;
+};
+
+/**
+ * Describes how an event loop group's threads should be pinned to hardware.
+ * If cpu_ids is non-NULL, one loop is created per entry and pinned to that exact CPU id
+ * (cpu_group is then only a label recorded for placement queries). Otherwise the usable,
+ * non-hyper-threaded CPUs of cpu_group are used, as with
+ * aws_event_loop_group_new_pinned_to_cpu_group().
+ */
+struct aws_event_loop_group_pinning_options {
+    const uint16_t *cpu_ids;
+    size_t cpu_id_count;
+    uint16_t cpu_group;
 };
 
 AWS_EXTERN_C_BEGIN
@@ -271,6 +353,41 @@ void aws_event_loop_register_tick_start(struct aws_event_loop *event_loop);
 AWS_IO_API
 void aws_event_loop_register_tick_end(struct aws_event_loop *event_loop);
 
+/**
+ * For event-loop implementations to use for providing metrics info to the base event-loop.
+ * Call this function after each wait/poll call with the number of io events it returned
+ * (0 for a timeout wake-up).
+ */
+AWS_IO_API
+void aws_event_loop_register_wait_result(struct aws_event_loop *event_loop, size_t event_count);
+
+/**
+ * Returns true once the current tick has been running longer than the loop's cooperative tick
+ * budget (see aws_event_loop_options.tick_budget_us). Always false when no budget is configured,
+ * when called outside a tick, or on loops that don't register tick boundaries. One clock read per
+ * call -- cheap enough for a work loop to poll every iteration. May only be called from the event
+ * loop's thread. Cooperating callers should yield by scheduling a continuation task rather than
+ * abandoning work, and should always make at least one unit of progress before checking, so a
+ * tick that starts over budget still advances.
+ */
+AWS_IO_API
+bool aws_event_loop_tick_budget_exhausted(struct aws_event_loop *event_loop);
+
+/**
+ * For event-loop implementations to use for providing metrics info to the base event-loop.
+ * Call this function with the number of timed tasks armed, just before running due tasks.
+ */
+AWS_IO_API
+void aws_event_loop_register_task_queue_depth(struct aws_event_loop *event_loop, size_t depth);
+
+/**
+ * For event-loop implementations to use for providing metrics info to the base event-loop.
+ * Call this function with how late (in nanoseconds) the earliest due timed task is running
+ * relative to its scheduled time.
+ */
+AWS_IO_API
+void aws_event_loop_register_task_latency(struct aws_event_loop *event_loop, uint64_t latency_ns);
+
 /**
  * Returns the current load factor (however that may be calculated). If the event-loop is not invoking
  * aws_event_loop_register_tick_start() and aws_event_loop_register_tick_end(), this value will always be 0.
@@ -296,6 +413,20 @@ int aws_event_loop_wait_for_stop_completion(struct aws_event_loop *event_loop);
 AWS_IO_API
 void aws_event_loop_schedule_task_now(struct aws_event_loop *event_loop, struct aws_task *task);
 
+/**
+ * Like aws_event_loop_schedule_task_now(), but the task lands in the loop's low-priority
+ * background band: each tick runs I/O events and normally-scheduled tasks first, then at most a
+ * small budget of background tasks, so bulky housekeeping (stats gathering, teardown, resolver
+ * notification fan-out) cannot delay the data path by more than one budget's worth of work.
+ * Background tasks still run as soon as the loop has spare capacity, just never ahead of I/O.
+ * Falls back to aws_event_loop_schedule_task_now() on loops without a background band.
+ * This function may be called from outside or inside the event loop thread.
+ *
+ * The task should not be cleaned up or modified until its function is executed.
+ */
+AWS_IO_API
+void aws_event_loop_schedule_task_now_background(struct aws_event_loop *event_loop, struct aws_task *task);
+
 /**
  * The event loop will schedule the task and run it at the specified time.
  * Use aws_event_loop_current_clock_time() to query the current time in nanoseconds.
@@ -441,6 +572,28 @@ struct aws_event_loop_group *aws_event_loop_group_new_default_pinned_to_cpu_grou
     uint16_t cpu_group,
     const struct aws_shutdown_callback_options *shutdown_options);
 
+/**
+ * Creates an event loop group pinned according to an explicit CPU-set/NUMA policy. One loop is
+ * created and pinned per CPU in the policy. Use this instead of
+ * aws_event_loop_group_new_pinned_to_cpu_group() when the CPUs serving NIC interrupts are known and
+ * loops must land next to them.
+ */
+AWS_IO_API
+struct aws_event_loop_group *aws_event_loop_group_new_pinned(
+    struct aws_allocator *alloc,
+    aws_io_clock_fn *clock,
+    const struct aws_event_loop_group_pinning_options *pinning_options,
+    aws_new_event_loop_fn *new_loop_fn,
+    void *new_loop_user_data,
+    const struct aws_shutdown_callback_options *shutdown_options);
+
+/**
+ * Returns true (and the cpu group the loops are pinned to, via out_cpu_group) if this group was
+ * created with a pinning policy, false otherwise.
+ */
+AWS_IO_API
+bool aws_event_loop_group_get_cpu_group(const struct aws_event_loop_group *el_group, uint16_t *out_cpu_group);
+
 /**
  * Increments the reference count on the event loop group, allowing the caller to take a reference to it.
  *
@@ -470,6 +623,32 @@ size_t aws_event_loop_group_get_loop_count(struct aws_event_loop_group *el_group
 AWS_IO_API
 struct aws_event_loop *aws_event_loop_group_get_next_loop(struct aws_event_loop_group *el_group);
 
+/**
+ * Adds additional_loop_count freshly started event loops to the group. The new loops are built
+ * with the clock and loop factory the group was created with and participate in
+ * aws_event_loop_group_get_next_loop() selection immediately.
+ *
+ * Fails with AWS_ERROR_UNSUPPORTED_OPERATION on pinned groups; those are sized to their cpu set.
+ * On partial failure, loops added before the failing one remain in the group.
+ */
+AWS_IO_API
+int aws_event_loop_group_grow(struct aws_event_loop_group *el_group, size_t additional_loop_count);
+
+/**
+ * Retires loops_to_retire event loops (taken from the end of the group) from
+ * aws_event_loop_group_get_next_loop() selection and from the group's visible count.
+ *
+ * Retired loops keep running: channels already assigned to them are unaffected and the loops are
+ * only destroyed when the group itself shuts down. Callers who want the threads quiesced sooner
+ * can record the affected loops (aws_event_loop_group_get_loop_at() before shrinking) and move
+ * their channels off with aws_channel_migrate().
+ *
+ * At least one loop must remain; fails with AWS_ERROR_INVALID_ARGUMENT otherwise, and with
+ * AWS_ERROR_UNSUPPORTED_OPERATION on pinned groups.
+ */
+AWS_IO_API
+int aws_event_loop_group_shrink(struct aws_event_loop_group *el_group, size_t loops_to_retire);
+
 AWS_EXTERN_C_END
 AWS_POP_SANE_WARNING_LEVEL
 
@@ -621,6 +621,46 @@ AWS_IO_API void aws_future_void_set_result(struct aws_future_void *future);
 
 AWS_FUTURE_T_DECLARATION_END(aws_future_void, AWS_IO_API)
 
+/**
+ * Combinators for fan-out/fan-in over multiple futures.
+ *
+ * Both combinators track completion with a single atomic counter in one
+ * allocation, so coordinating N branches doesn't cost a mutex or a heap
+ * allocation per branch. Input futures may be of any aws_future<T> type;
+ * cast them to (struct aws_future_impl *).
+ *
+ * The combinator registers the completion callback on each input future,
+ * so inputs must not have another callback registered (each future supports
+ * only one). The combinator holds a reference on each input until it is done;
+ * inspect the inputs for their individual results after the combined future
+ * completes. To pick the thread the combined result is delivered on, use
+ * aws_future_T_register_event_loop_callback() on the returned future.
+ */
+
+/**
+ * Create a future that completes when every future in the array is done.
+ * Completes successfully if all inputs succeed, otherwise with the first
+ * error code observed (in completion order). count must be at least 1.
+ * Returns NULL and raises AWS_ERROR_INVALID_ARGUMENT if count is 0.
+ */
+AWS_IO_API
+struct aws_future_void *aws_future_when_all(
+    struct aws_allocator *alloc,
+    struct aws_future_impl *const *futures,
+    size_t count);
+
+/**
+ * Create a future that completes as soon as any future in the array succeeds,
+ * holding the index of the winning input. If every input fails, completes with
+ * the error code of the last input to finish. count must be at least 1.
+ * Returns NULL and raises AWS_ERROR_INVALID_ARGUMENT if count is 0.
+ */
+AWS_IO_API
+struct aws_future_size *aws_future_when_any(
+    struct aws_allocator *alloc,
+    struct aws_future_impl *const *futures,
+    size_t count);
+
 AWS_EXTERN_C_END
 AWS_POP_SANE_WARNING_LEVEL
 
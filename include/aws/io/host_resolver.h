@@ -73,11 +73,66 @@ struct aws_host_resolution_config {
     size_t max_ttl;
     void *impl_data;
     uint64_t resolve_frequency_ns; /* 0 defaults to 1 second interval */
+
+    /*
+     * Opt-in TTL-aligned refresh scheduling.  When true, each refresh is scheduled for the earliest
+     * upcoming cached-record expiry minus refresh_lead_time_ns, clamped to
+     * [min_resolve_interval_ns, max_resolve_interval_ns], instead of firing every
+     * resolve_frequency_ns regardless of TTL.  Custom `impl` callbacks that stamp an absolute
+     * expiry on the addresses they return drive the schedule with real record TTLs; with the
+     * default implementation records expire max_ttl after each refresh, so the query rate relaxes
+     * to roughly one per max_ttl.  While the cache is empty (resolution failing), refreshes fall
+     * back to resolve_frequency_ns.
+     */
+    bool ttl_aligned_refresh;
+    uint64_t refresh_lead_time_ns;    /* refresh this long before the earliest expiry; 0 defaults to 1 second */
+    uint64_t min_resolve_interval_ns; /* clamp floor; 0 defaults to resolve_frequency_ns */
+    uint64_t max_resolve_interval_ns; /* clamp ceiling; 0 defaults to max_ttl */
 };
 
 struct aws_host_listener;
 
-struct aws_host_listener_options;
+/**
+ * Invoked once per completed refresh cycle of the listened-to host, on the resolver's background thread
+ * (do not block in it). Delivery is coalesced: a single invocation carries every address the refresh added
+ * (new_addresses) and every address it expired (expired_addresses) as arrays of struct aws_host_address,
+ * valid only for the duration of the callback; either may be empty.
+ *
+ * address_epoch increments once per refresh that changed the address set and holds steady across refreshes
+ * that changed nothing, so a consumer can compare it against the epoch it last acted on and skip no-change
+ * refreshes without touching the arrays.
+ */
+typedef void(aws_host_listener_address_batch_fn)(
+    struct aws_host_listener *listener,
+    const struct aws_array_list *new_addresses,
+    const struct aws_array_list *expired_addresses,
+    uint64_t address_epoch,
+    void *user_data);
+
+/**
+ * Invoked after a removed listener's final callback (if one was in flight) has finished and its memory has
+ * been released. May fire synchronously from aws_host_resolver_remove_host_listener, or later from the
+ * resolver's background thread.
+ */
+typedef void(aws_host_listener_shutdown_fn)(void *user_data);
+
+struct aws_host_listener_options {
+    /** name of the host to receive address-change notifications for */
+    struct aws_byte_cursor host_name;
+    /** required: coalesced per-refresh delivery callback */
+    aws_host_listener_address_batch_fn *on_address_batch;
+    /** optional: invoked once the listener is fully removed */
+    aws_host_listener_shutdown_fn *on_shutdown;
+    void *user_data;
+};
+
+struct aws_host_resolver_prefetch_host_options {
+    /** array of host names to begin continuous background resolution for */
+    const struct aws_string *const *hosts;
+    size_t host_count;
+    /** resolution config for entries created by the prefetch; NULL uses the default */
+    const struct aws_host_resolution_config *config;
+};
 
 struct aws_host_resolver_purge_host_options {
     /* the host to purge the cache for */
@@ -128,6 +183,29 @@ struct aws_host_resolver_vtable {
         struct aws_host_resolver *resolver,
         const struct aws_string *host_name,
         uint32_t flags);
+
+    /** optional: serialize your cached addresses so a future resolver instance can warm-start from them. */
+    int (*save_address_cache)(struct aws_host_resolver *resolver, const char *file_path);
+
+    /** optional: report a successful connection (and its measured connect latency) to an address this resolver
+     * previously vended, so selection can be biased toward the fastest addresses. */
+    int (*record_connection_success)(
+        struct aws_host_resolver *resolver,
+        const struct aws_host_address *address,
+        uint64_t connect_latency_ns);
+
+    /** optional: begin continuous background resolution for a batch of host names known up front. */
+    int (*prefetch_hosts)(
+        struct aws_host_resolver *resolver,
+        const struct aws_host_resolver_prefetch_host_options *options);
+
+    /** optional: register a listener for coalesced per-refresh address-change notifications. */
+    struct aws_host_listener *(*add_host_listener)(
+        struct aws_host_resolver *resolver,
+        const struct aws_host_listener_options *options);
+
+    /** optional: remove a listener previously returned by add_host_listener. */
+    int (*remove_host_listener)(struct aws_host_resolver *resolver, struct aws_host_listener *listener);
 };
 
 struct aws_host_resolver {
@@ -143,6 +221,23 @@ struct aws_host_resolver_default_options {
     struct aws_event_loop_group *el_group;
     const struct aws_shutdown_callback_options *shutdown_options;
     aws_io_clock_fn *system_clock_override_fn;
+
+    /**
+     * Number of threads shared by all host entries for background resolution.  When zero (the default), each
+     * actively-resolved hostname gets a dedicated thread, the historical behavior.  At a few thousand distinct
+     * hostnames that is a few thousand mostly-sleeping threads; a small pool (e.g. 2-8) multiplexes them all
+     * instead.  Resolution itself is unchanged either way (blocking getaddrinfo() on a background thread).
+     */
+    size_t resolution_worker_count;
+
+    /**
+     * Optional path to an address cache file previously written by aws_host_resolver_save_address_cache().
+     * When non-NULL, records whose TTL has not yet run out are loaded at construction and used to seed host
+     * entries as they are first resolved, so the initial resolutions after a process restart are answered from
+     * warm cache instead of a burst of cold DNS queries.  Loading is best effort: a missing or malformed file
+     * is logged and skipped.
+     */
+    const char *warm_address_cache_file_path;
 };
 
 AWS_EXTERN_C_BEGIN
@@ -236,6 +331,26 @@ AWS_IO_API int aws_host_resolver_record_connection_failure(
     struct aws_host_resolver *resolver,
     const struct aws_host_address *address);
 
+/**
+ * calls record_connection_success on the vtable.  Reports a successful connection to `address` along with the
+ * measured connect latency (pass 0 if unknown) so the resolver can bias future selection toward the fastest
+ * addresses.  Implementations that don't track connection outcomes simply ignore the report.
+ */
+AWS_IO_API int aws_host_resolver_record_connection_success(
+    struct aws_host_resolver *resolver,
+    const struct aws_host_address *address,
+    uint64_t connect_latency_ns);
+
+/**
+ * calls prefetch_hosts on the vtable.  Begins background resolution for a batch of host names known up front,
+ * without requiring a dummy resolve callback per name.  Prefetched hosts are pinned: their entries keep
+ * refreshing in the background (instead of retiring after max_ttl of inactivity) until the host's cache is
+ * purged or the resolver shuts down, so connection-time resolution is a cache hit.
+ */
+AWS_IO_API int aws_host_resolver_prefetch_hosts(
+    struct aws_host_resolver *resolver,
+    const struct aws_host_resolver_prefetch_host_options *options);
+
 /**
  * @Deprecated Use purge_cache_with_callback instead
  * calls purge_cache on the vtable.
@@ -258,6 +373,14 @@ AWS_IO_API int aws_host_resolver_purge_host_cache(
     struct aws_host_resolver *resolver,
     const struct aws_host_resolver_purge_host_options *options);
 
+/**
+ * Serializes the resolver's cached A/AAAA records (with their remaining TTLs) to a compact file that can be
+ * handed to a new resolver via aws_host_resolver_default_options.warm_address_cache_file_path.  Intended to be
+ * called shortly before process shutdown so the next incarnation starts with a warm cache.  Only supported by
+ * the default resolver implementation.
+ */
+AWS_IO_API int aws_host_resolver_save_address_cache(struct aws_host_resolver *resolver, const char *file_path);
+
 /**
  * get number of addresses for a given host.
  */
@@ -266,6 +389,24 @@ AWS_IO_API size_t aws_host_resolver_get_host_address_count(
     const struct aws_string *host_name,
     uint32_t flags);
 
+/**
+ * calls add_host_listener on the vtable.  Registers a listener receiving one coalesced callback per refresh
+ * cycle of the host (see aws_host_listener_address_batch_fn).  Notifications only fire while the host has an
+ * active cache entry, i.e. someone is resolving or prefetching it.  The listener holds a reference on the
+ * resolver until it is removed.  Returns NULL on failure.
+ */
+AWS_IO_API struct aws_host_listener *aws_host_resolver_add_host_listener(
+    struct aws_host_resolver *resolver,
+    const struct aws_host_listener_options *options);
+
+/**
+ * calls remove_host_listener on the vtable.  No further batch callbacks fire after this returns unless one
+ * was already in flight; the listener's on_shutdown callback marks the point where its memory is gone.
+ */
+AWS_IO_API int aws_host_resolver_remove_host_listener(
+    struct aws_host_resolver *resolver,
+    struct aws_host_listener *listener);
+
 /**
  * Returns the default host resolution config used internally if none specified.
  *
@@ -26,6 +26,11 @@ enum aws_io_message_type {
     AWS_IO_MESSAGE_APPLICATION_DATA,
 };
 
+enum aws_io_message_priority {
+    AWS_IO_MESSAGE_PRIORITY_NORMAL = 0,
+    AWS_IO_MESSAGE_PRIORITY_HIGH,
+};
+
 struct aws_io_message;
 struct aws_channel;
 
@@ -59,6 +64,13 @@ struct aws_io_message {
      */
     int message_tag;
 
+    /**
+     * Delivery class for the write direction. Most messages are NORMAL and flush strictly FIFO. HIGH marks small
+     * urgent frames (pings, acks, protocol window updates) that may overtake queued NORMAL writes wherever writes
+     * back up, so a keepalive isn't stuck behind megabytes of bulk data. Read-direction messages ignore this.
+     */
+    enum aws_io_message_priority priority;
+
     /**
      * In order to avoid excess allocations/copies, on a partial read or write, the copy mark is set to indicate how
      * much of this message has already been processed or copied.
@@ -254,12 +266,30 @@ enum aws_io_errors {
 
     AWS_ERROR_PEM_MALFORMED,
 
+    AWS_IO_TLS_EARLY_DATA_REJECTED,
+
     AWS_IO_ERROR_END_RANGE = AWS_ERROR_ENUM_END_RANGE(AWS_C_IO_PACKAGE_ID),
     AWS_IO_INVALID_FILE_HANDLE = AWS_ERROR_INVALID_FILE_HANDLE,
 };
 
 AWS_EXTERN_C_BEGIN
 
+/**
+ * Creates a zero-copy slice of `message`: a child message whose message_data points at
+ * `[offset, offset + length)` of the parent's buffer, with no copy. The parent is not returned to
+ * its pool (or allocator) until the parent and every slice taken from it have been released, all
+ * through the usual `aws_mem_release(msg->allocator, msg)`. Slices may themselves be sliced;
+ * nested slices share the root message's buffer directly. Create slices from the owning channel's
+ * thread; releases may come from any thread. Returns NULL on failure, or if the requested range
+ * falls outside the parent's current data.
+ */
+AWS_IO_API
+struct aws_io_message *aws_io_message_new_slice(
+    struct aws_allocator *allocator,
+    struct aws_io_message *message,
+    size_t offset,
+    size_t length);
+
 /**
  * Initializes internal datastructures used by aws-c-io.
  * Must be called before using any functionality in aws-c-io.
@@ -33,8 +33,40 @@ enum aws_io_log_subject {
     AWS_LS_IO_STANDARD_RETRY_STRATEGY,
     AWS_LS_IO_PKCS11,
     AWS_LS_IO_PEM,
+    AWS_LS_IO_ADAPTIVE_RETRY_STRATEGY,
+    AWS_LS_IO_PACING_HANDLER,
     AWS_IO_LS_LAST = AWS_LOG_SUBJECT_END_RANGE(AWS_C_IO_PACKAGE_ID)
 };
+
+struct aws_ring_logger_options {
+    enum aws_log_level level;
+    /* when filename is set the logger opens (and owns) the file; otherwise file is used as-is and
+     * left open on clean-up. Leaving both unset writes to stderr. */
+    const char *filename;
+    FILE *file;
+    /* ring capacity in records (rounded up to a power of two); 0 picks a default. Each record
+     * holds one log line; when producers outrun the drain thread new records are dropped and the
+     * drop count is reported in-line once the ring has room again. */
+    size_t max_records;
+};
+
+AWS_EXTERN_C_BEGIN
+
+/**
+ * Initializes a logger aimed at diagnostic-level logging on hot threads: callers format only the
+ * message body into a slot of a fixed-size lock-free ring, while timestamp rendering, level and
+ * subject lookup, and all file I/O happen on a single drain thread. Event-loop threads never take
+ * a lock or touch the file, which makes leaving DEBUG/TRACE enabled in production considerably
+ * cheaper than the standard logger.
+ */
+AWS_IO_API
+int aws_logger_init_ring(
+    struct aws_logger *logger,
+    struct aws_allocator *allocator,
+    const struct aws_ring_logger_options *options);
+
+AWS_EXTERN_C_END
+
 AWS_POP_SANE_WARNING_LEVEL
 
 #endif /* AWS_IO_LOGGING_H */
@@ -5,6 +5,9 @@
  * SPDX-License-Identifier: Apache-2.0.
  */
 #include <aws/common/array_list.h>
+#include <aws/common/atomics.h>
+#include <aws/common/linked_list.h>
+#include <aws/common/mutex.h>
 #include <aws/io/io.h>
 
 AWS_PUSH_SANE_WARNING_LEVEL
@@ -12,15 +15,89 @@ AWS_PUSH_SANE_WARNING_LEVEL
 struct aws_memory_pool {
     struct aws_allocator *alloc;
     struct aws_array_list stack;
+    /* guards `stack` and `magazines`. The common acquire/release path goes through a per-thread
+     * magazine and only touches the magazine's own (uncontended) lock. */
+    struct aws_mutex lock;
+    struct aws_linked_list magazines;
     uint16_t ideal_segment_count;
     size_t segment_size;
     void *data_ptr;
+    /* occupancy counters, updated with relaxed atomics so the magazine fast path stays
+     * uncontended; read through aws_message_pool_query_metrics() */
+    struct aws_atomic_var acquire_hit_count;
+    struct aws_atomic_var acquire_fallback_count;
+    struct aws_atomic_var outstanding_count;
+    struct aws_atomic_var outstanding_high_watermark;
+    /* optional hugepage-backed slab the warm segments are carved from; NULL when the pool
+     * allocates segments individually. Slab segments are returned to the pool, never freed
+     * one at a time; the whole slab is unmapped at clean up. */
+    void *slab;
+    size_t slab_size;
 };
 
+enum {
+    /* additional application-data size classes that can be added on demand; each class doubles
+     * the previous one, so 8 classes take the default 16KB base up to 4MB */
+    AWS_MESSAGE_POOL_MAX_LARGE_CLASSES = 8,
+};
+
+enum {
+    /* lifetime histogram shape: rows index the message's copy_mark value at release - the
+     * partial read/write progress offset in bytes, NOT a pipeline stage, so any message that saw
+     * a partial I/O (e.g. a short TLS write) clamps into the last row - with log2 buckets of
+     * acquire-to-release residency in microseconds. The last row and bucket absorb overflow. */
+    AWS_MESSAGE_POOL_LIFETIME_SEGMENTS = 8,
+    AWS_MESSAGE_POOL_LIFETIME_BUCKETS = 16,
+};
+
+struct aws_message_pool_metrics {
+    /* acquires served from a warm segment (per-thread magazine or the shared depot) */
+    size_t acquire_hits;
+    /* acquires that fell through to raw allocation because every warm segment was checked out */
+    size_t acquire_fallbacks;
+    /* segments currently checked out */
+    size_t outstanding;
+    /* most segments ever checked out at once; the count a pool would need to never fall back */
+    size_t outstanding_high_watermark;
+};
+
+/* snapshot of message residency: buckets[row][bucket] counts messages whose copy_mark value at
+ * release was `row` (clamped to the last row; copy_mark is a partial-I/O byte offset, so row 0
+ * holds messages released untouched by partial reads/writes and the last row absorbs everything
+ * else) and that lived roughly [2^bucket, 2^(bucket+1)) microseconds between
+ * aws_message_pool_acquire() and aws_message_pool_release() */
+struct aws_message_pool_lifetime_histogram {
+    size_t buckets[AWS_MESSAGE_POOL_LIFETIME_SEGMENTS][AWS_MESSAGE_POOL_LIFETIME_BUCKETS];
+};
+
+struct aws_message_pool;
+
+/**
+ * Invoked from the acquiring thread when the pool's fallback allocations have grown by at least
+ * the configured threshold since the previous invocation. Keep it cheap; it runs on the hot
+ * acquire path.
+ */
+typedef void(aws_message_pool_on_pressure_fn)(
+    struct aws_message_pool *msg_pool,
+    const struct aws_message_pool_metrics *metrics,
+    void *user_data);
+
 struct aws_message_pool {
     struct aws_allocator *alloc;
     struct aws_memory_pool application_data_pool;
     struct aws_memory_pool small_block_pool;
+    /* ascending jumbo size classes, added via aws_message_pool_ensure_block_size(); empty unless
+     * a channel on the owning event-loop asked for fragments above the base class size */
+    struct aws_memory_pool large_block_pools[AWS_MESSAGE_POOL_MAX_LARGE_CLASSES];
+    size_t large_block_pool_count;
+    aws_message_pool_on_pressure_fn *on_pressure;
+    void *on_pressure_user_data;
+    size_t pressure_fallback_threshold;
+    struct aws_atomic_var fallbacks_at_last_pressure;
+    bool track_message_lifetimes;
+    /* carried from creation args so jumbo classes added later get the same slab backing */
+    bool hugepage_backed;
+    struct aws_atomic_var lifetime_buckets[AWS_MESSAGE_POOL_LIFETIME_SEGMENTS][AWS_MESSAGE_POOL_LIFETIME_BUCKETS];
 };
 
 struct aws_message_pool_creation_args {
@@ -28,6 +105,21 @@ struct aws_message_pool_creation_args {
     uint8_t application_data_msg_count;
     size_t small_block_msg_data_size;
     uint8_t small_block_msg_count;
+    /* optional: when on_pressure is set and pressure_fallback_threshold is non-zero, the callback
+     * fires each time that many more acquires have fallen through to raw allocation, signaling
+     * that the counts above are undersized for the observed load */
+    aws_message_pool_on_pressure_fn *on_pressure;
+    void *on_pressure_user_data;
+    size_t pressure_fallback_threshold;
+    /* optional: when true, each message is timestamped at acquire and its residency recorded at
+     * release; read the result through aws_message_pool_query_lifetime_histogram(). Costs one
+     * high-res clock read per acquire and per release, so leave it off outside of profiling. */
+    bool track_message_lifetimes;
+    /* optional: when true, the application-data and jumbo size classes carve their warm segments
+     * out of one contiguous hugepage-backed slab per pool (MAP_HUGETLB, falling back to
+     * madvise(MADV_HUGEPAGE), falling back again to ordinary pages), so a loop's message working
+     * set stays within a few TLB entries. Falls back silently when hugepages are unavailable. */
+    bool hugepage_backed;
 };
 
 AWS_EXTERN_C_BEGIN
@@ -39,17 +131,34 @@ int aws_memory_pool_init(
     uint16_t ideal_segment_count,
     size_t segment_size);
 
+/**
+ * Like aws_memory_pool_init(), but when hugepage_backed is true the warm segments are carved from
+ * one contiguous anonymous mapping, requested with explicit hugepages where the platform offers
+ * them. Unavailability (no hugetlb reservation, unsupported platform) silently degrades to the
+ * per-segment behavior of aws_memory_pool_init().
+ */
+AWS_IO_API
+int aws_memory_pool_init_ex(
+    struct aws_memory_pool *mempool,
+    struct aws_allocator *alloc,
+    uint16_t ideal_segment_count,
+    size_t segment_size,
+    bool hugepage_backed);
+
 AWS_IO_API
 void aws_memory_pool_clean_up(struct aws_memory_pool *mempool);
 
 /**
  * Acquires memory from the pool if available, otherwise, it attempts to allocate and returns the result.
+ * May be called from any thread.
  */
 AWS_IO_API
 void *aws_memory_pool_acquire(struct aws_memory_pool *mempool);
 
 /**
- * Releases memory to the pool if space is available, otherwise frees `to_release`
+ * Releases memory to the pool if space is available, otherwise frees `to_release`.
+ * May be called from any thread: releases land in a per-thread magazine over the shared depot, so
+ * cross-thread message release no longer defeats pooling.
  */
 AWS_IO_API
 void aws_memory_pool_release(struct aws_memory_pool *mempool, void *to_release);
@@ -66,6 +175,14 @@ int aws_message_pool_init(
 AWS_IO_API
 void aws_message_pool_clean_up(struct aws_message_pool *msg_pool);
 
+/**
+ * Ensures the pool has an application-data size class of at least msg_data_size, adding doubling
+ * classes as needed (no-op when one already fits). Like acquire/release, must only be called from
+ * the thread that owns the pool.
+ */
+AWS_IO_API
+int aws_message_pool_ensure_block_size(struct aws_message_pool *msg_pool, size_t msg_data_size);
+
 /**
  * Acquires a message from the pool if available, otherwise, it attempts to allocate. If a message is acquired,
  * note that size_hint is just a hint. the return value's capacity will be set to the actual buffer size.
@@ -83,6 +200,23 @@ struct aws_io_message *aws_message_pool_acquire(
 AWS_IO_API
 void aws_message_pool_release(struct aws_message_pool *msg_pool, struct aws_io_message *message);
 
+/**
+ * Sums occupancy counters across every size class. May be called from any thread; the counters
+ * are independently-updated atomics, so the snapshot is approximate under concurrent traffic.
+ */
+AWS_IO_API
+void aws_message_pool_query_metrics(const struct aws_message_pool *msg_pool, struct aws_message_pool_metrics *metrics);
+
+/**
+ * Copies the pool's acquire-to-release residency histogram into `histogram`. All zeroes unless the
+ * pool was created with track_message_lifetimes set. May be called from any thread; like the
+ * occupancy metrics, the snapshot is approximate under concurrent traffic.
+ */
+AWS_IO_API
+void aws_message_pool_query_lifetime_histogram(
+    const struct aws_message_pool *msg_pool,
+    struct aws_message_pool_lifetime_histogram *histogram);
+
 AWS_EXTERN_C_END
 AWS_POP_SANE_WARNING_LEVEL
 
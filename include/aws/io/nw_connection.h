@@ -0,0 +1,66 @@
+#ifndef AWS_IO_NW_CONNECTION_H
+#define AWS_IO_NW_CONNECTION_H
+
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/io/channel_bootstrap.h>
+
+AWS_PUSH_SANE_WARNING_LEVEL
+AWS_EXTERN_C_BEGIN
+
+/**
+ * Options for creating a client channel whose transport and TLS are provided by Apple's
+ * Network.framework (nw_connection) instead of the kqueue socket + SecureTransport pair.
+ * The resulting channel is an ordinary aws_channel: handlers to the right of the connection
+ * handler see plaintext aws_io_messages and the channel API is unchanged.
+ */
+struct aws_nw_connection_channel_options {
+    struct aws_client_bootstrap *bootstrap;
+
+    /** Host name or address to connect to. Copied. */
+    const char *host_name;
+    uint32_t port;
+
+    /** When true, Network.framework negotiates TLS on the connection before setup completes. */
+    bool enable_tls;
+
+    /**
+     * Optional semi-colon delimited ALPN list (e.g. "h2;http/1.1"), offered during the TLS
+     * handshake. Ignored unless enable_tls is set. Copied.
+     */
+    const char *alpn_list;
+
+    /**
+     * When true, the connection is created with multipath handover service, so established
+     * sessions survive interface changes (Wi-Fi to cellular and back).
+     */
+    bool enable_multipath;
+
+    bool enable_read_back_pressure;
+
+    aws_client_bootstrap_on_channel_event_fn *setup_callback;
+    aws_client_bootstrap_on_channel_event_fn *shutdown_callback;
+    void *user_data;
+
+    /** Optional: pin the channel to a specific loop instead of the group's next pick. */
+    struct aws_event_loop *requested_event_loop;
+};
+
+/**
+ * Creates a client channel backed by an nw_connection. setup_callback fires on the channel's
+ * event-loop thread once the connection (and TLS, when enabled) is ready, or with an error code
+ * and a NULL channel if establishment fails; shutdown_callback fires when the channel shuts down.
+ *
+ * Only available on Apple platforms when the library is built with USE_APPLE_NETWORK_FRAMEWORK;
+ * elsewhere the symbol is not compiled in.
+ */
+AWS_IO_API int aws_client_bootstrap_new_nw_connection_channel(
+    const struct aws_nw_connection_channel_options *options);
+
+AWS_EXTERN_C_END
+AWS_POP_SANE_WARNING_LEVEL
+
+#endif /* AWS_IO_NW_CONNECTION_H */
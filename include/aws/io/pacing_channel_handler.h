@@ -0,0 +1,47 @@
+#ifndef AWS_IO_PACING_CHANNEL_HANDLER_H
+#define AWS_IO_PACING_CHANNEL_HANDLER_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/io/io.h>
+
+AWS_PUSH_SANE_WARNING_LEVEL
+
+struct aws_channel_handler;
+struct aws_socket;
+
+struct aws_pacing_handler_options {
+    /* sustained egress rate in bytes per second. Must be non-zero. */
+    uint64_t rate_bytes_per_sec;
+    /* token-bucket depth: how many bytes may leave back-to-back after an idle period before
+     * shaping kicks in. 0 means one channel max-fragment worth (g_aws_channel_max_fragment_size). */
+    size_t burst_size_bytes;
+    /* Optional. When set, the handler also asks the kernel to pace this socket at
+     * rate_bytes_per_sec (SO_MAX_PACING_RATE on Linux, honored by the fq qdisc and TCP internal
+     * pacing), smoothing bursts below message granularity. Best effort: a no-op on platforms and
+     * socket types without kernel pacing, and userspace shaping applies either way. */
+    struct aws_socket *socket;
+};
+
+AWS_EXTERN_C_BEGIN
+
+/**
+ * Creates a channel handler that rate-limits the write direction of a channel with a token
+ * bucket: messages are forwarded immediately while tokens last, queued otherwise, and queued
+ * messages are released in batches from a channel timer task as the bucket refills. The read
+ * direction passes through untouched. Insert it to the right of the socket handler (and any TLS
+ * handler, so shaping applies to ciphertext-sized messages the socket actually sends).
+ *
+ * On graceful shutdown the queue is flushed downstream unshaped; on error shutdown queued
+ * messages are completed with the shutdown error code.
+ */
+AWS_IO_API struct aws_channel_handler *aws_pacing_handler_new(
+    struct aws_allocator *allocator,
+    const struct aws_pacing_handler_options *options);
+
+AWS_EXTERN_C_END
+AWS_POP_SANE_WARNING_LEVEL
+
+#endif /* AWS_IO_PACING_CHANNEL_HANDLER_H */
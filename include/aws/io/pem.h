@@ -57,6 +57,17 @@ struct aws_pem_object {
     struct aws_byte_buf data;
 };
 
+/*
+ * Describes a PEM object decoded by 'aws_pem_objects_init_views_from_file_contents()'.
+ * type_string and data are views into the arena buffer passed to that call and stay
+ * valid until the arena is cleaned up; nothing is allocated per object.
+ */
+struct aws_pem_object_view {
+    enum aws_pem_object_type type;
+    struct aws_byte_cursor type_string;
+    struct aws_byte_cursor data;
+};
+
 /**
  * Cleans up elements of pem_objects list 'aws_pem_objects_init_from_file_contents()'
  * and 'aws_pem_objects_init_from_file_path()'.
@@ -95,5 +106,26 @@ AWS_IO_API int aws_pem_objects_init_from_file_path(
     struct aws_allocator *allocator,
     const char *filename);
 
+/**
+ * Variant of 'aws_pem_objects_init_from_file_contents()' for large bundles (e.g. CA stores):
+ * decodes the whole PEM in a single pass into one contiguous arena buffer and returns views
+ * into it instead of per-object allocations.
+ * pem_object_views stores aws_pem_object_view by value; both the list and the arena are
+ * initialized by this call and must be released together with
+ * 'aws_pem_object_views_clean_up()'.
+ * Error semantics match aws_pem_objects_init_from_file_contents().
+ */
+AWS_IO_API int aws_pem_objects_init_views_from_file_contents(
+    struct aws_array_list *pem_object_views,
+    struct aws_byte_buf *arena,
+    struct aws_allocator *allocator,
+    struct aws_byte_cursor pem_cursor);
+
+/**
+ * Cleans up the views list and arena initialized by
+ * 'aws_pem_objects_init_views_from_file_contents()'.
+ */
+AWS_IO_API void aws_pem_object_views_clean_up(struct aws_array_list *pem_object_views, struct aws_byte_buf *arena);
+
 AWS_EXTERN_C_END
 #endif /* AWS_IO_PEM_H */
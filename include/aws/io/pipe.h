@@ -47,6 +47,17 @@ typedef void(aws_pipe_on_write_completed_fn)(
     struct aws_byte_cursor src_buffer,
     void *user_data);
 
+/**
+ * Callback for when an aws_pipe_write_multiple() operation has either completed or failed.
+ * `write_end` will be NULL if this callback is invoked after the write-end has been cleaned up.
+ * `error_code` will be AWS_ERROR_SUCCESS if every buffer was written in full.
+ * This callback is always invoked on the write-end's event-loop thread.
+ */
+typedef void(aws_pipe_on_write_multiple_completed_fn)(
+    struct aws_pipe_write_end *write_end,
+    int error_code,
+    void *user_data);
+
 AWS_EXTERN_C_BEGIN
 
 /**
@@ -104,6 +115,69 @@ int aws_pipe_write(
     aws_pipe_on_write_completed_fn *on_completed,
     void *user_data);
 
+/**
+ * Like aws_pipe_write(), but gathers from multiple buffers with one kernel call (writev) instead
+ * of queueing one request per buffer. The buffer array is copied, but the data each cursor points
+ * to must remain in memory until the operation completes. The buffers are written in order and
+ * complete as a unit; `on_completed` fires once, after the last byte of the last buffer.
+ * This must be called on the thread of the connected event-loop.
+ * On Windows this is not currently implemented and raises AWS_ERROR_PLATFORM_NOT_SUPPORTED.
+ */
+AWS_IO_API
+int aws_pipe_write_multiple(
+    struct aws_pipe_write_end *write_end,
+    const struct aws_byte_cursor *buffers,
+    size_t buffer_count,
+    aws_pipe_on_write_multiple_completed_fn *on_completed,
+    void *user_data);
+
+/**
+ * Moves up to `max_bytes` bytes from `source_fd` (typically a socket) into the pipe without the
+ * data touching userspace (Linux splice(2)). Never blocks: `*out_bytes_spliced` is set to the
+ * number of bytes moved, and AWS_IO_READ_WOULD_BLOCK is raised when nothing could move because
+ * the source is empty or the pipe is full. Must not be mixed with in-flight aws_pipe_write()
+ * requests (raises AWS_ERROR_INVALID_STATE), since spliced bytes would interleave with queued
+ * writes. This must be called on the thread of the connected event-loop.
+ * On platforms without splice() this raises AWS_ERROR_PLATFORM_NOT_SUPPORTED.
+ */
+AWS_IO_API
+int aws_pipe_splice_from_fd(
+    struct aws_pipe_write_end *write_end,
+    int source_fd,
+    size_t max_bytes,
+    size_t *out_bytes_spliced);
+
+/**
+ * Moves up to `max_bytes` bytes from the pipe into `destination_fd` (typically a socket) without
+ * the data touching userspace (Linux splice(2)). Never blocks: `*out_bytes_spliced` is set to the
+ * number of bytes moved, and AWS_IO_READ_WOULD_BLOCK is raised when nothing could move because
+ * the pipe is empty or the destination is full. This must be called on the thread of the
+ * connected event-loop.
+ * On platforms without splice() this raises AWS_ERROR_PLATFORM_NOT_SUPPORTED.
+ */
+AWS_IO_API
+int aws_pipe_splice_to_fd(
+    struct aws_pipe_read_end *read_end,
+    int destination_fd,
+    size_t max_bytes,
+    size_t *out_bytes_spliced);
+
+/**
+ * Duplicates up to `max_bytes` bytes from `from`'s pipe into `to`'s pipe without consuming them
+ * from the source (Linux tee(2)); the bytes remain readable on `from`. Never blocks:
+ * `*out_bytes_teed` is set to the number of bytes duplicated, and AWS_IO_READ_WOULD_BLOCK is
+ * raised when nothing could move. Both ends must belong to the same event-loop thread as the
+ * caller, and `to` must have no in-flight aws_pipe_write() requests (raises
+ * AWS_ERROR_INVALID_STATE).
+ * On platforms without tee() this raises AWS_ERROR_PLATFORM_NOT_SUPPORTED.
+ */
+AWS_IO_API
+int aws_pipe_tee(
+    struct aws_pipe_read_end *from,
+    struct aws_pipe_write_end *to,
+    size_t max_bytes,
+    size_t *out_bytes_teed);
+
 /**
  * Read data from the pipe into the destination buffer.
  * Attempts to read enough to fill all remaining space in the buffer, from `dst_buffer->len` to `dst_buffer->capacity`.
@@ -4,6 +4,7 @@
  * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
  * SPDX-License-Identifier: Apache-2.0.
  */
+#include <aws/io/future.h>
 #include <aws/io/io.h>
 
 AWS_PUSH_SANE_WARNING_LEVEL
@@ -15,6 +16,11 @@ struct aws_allocator;
  */
 struct aws_pkcs11_lib;
 
+/**
+ * aws_future<aws_pkcs11_lib*>
+ */
+AWS_FUTURE_T_POINTER_WITH_DESTROY_DECLARATION(aws_future_pkcs11_lib, struct aws_pkcs11_lib, AWS_IO_API)
+
 /**
  * Controls how aws_pkcs11_lib calls C_Initialize() and C_Finalize() on the PKCS#11 library.
  */
@@ -76,6 +82,25 @@ struct aws_pkcs11_lib *aws_pkcs11_lib_new(
     struct aws_allocator *allocator,
     const struct aws_pkcs11_lib_options *options);
 
+/**
+ * Load and initialize a PKCS#11 library on a background thread.
+ *
+ * Identical to aws_pkcs11_lib_new(), except the call returns immediately and the
+ * dlopen()/C_Initialize() work happens off the calling thread. Use this when the
+ * library fronts a network HSM whose C_Initialize() can take seconds: process
+ * startup overlaps HSM warmup with everything else, and things that need the
+ * library (ex: building TLS options with aws_pkcs11_tls_op_handler) queue behind
+ * the future via aws_future_pkcs11_lib_register_callback().
+ *
+ * The returned future completes with an aws_pkcs11_lib (ownership transferred to
+ * whoever takes the result) or an error code. Never returns NULL. You must call
+ * aws_future_pkcs11_lib_release() when you are done with the future.
+ */
+AWS_IO_API
+struct aws_future_pkcs11_lib *aws_pkcs11_lib_new_async(
+    struct aws_allocator *allocator,
+    const struct aws_pkcs11_lib_options *options);
+
 /**
  * Acquire a reference to a PKCS#11 library, preventing it from being cleaned up.
  * You must call aws_pkcs11_lib_release() when you are done with it.
@@ -0,0 +1,72 @@
+#ifndef AWS_IO_PRIVATE_EVENT_LOOP_IO_URING_H
+#define AWS_IO_PRIVATE_EVENT_LOOP_IO_URING_H
+
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/io/io.h>
+
+struct aws_event_loop;
+struct aws_io_handle;
+struct aws_io_message;
+
+/**
+ * Zero-copy receive path backed by io_uring provided-buffer rings.
+ *
+ * When the io_uring event loop owns a handle, reads can be issued as IORING_OP_RECV with
+ * kernel-selected buffers: the kernel receives directly into a ring of pre-registered buffers and
+ * each completion is surfaced as an aws_io_message whose message_data aliases the ring buffer,
+ * removing the copy that read(2) into a pooled message performs. Releasing the message (the normal
+ * aws_mem_release(message->allocator, message)) returns the buffer to the kernel ring.
+ *
+ * Only available on Linux kernels with provided-buffer-ring support (5.19+); callers must check
+ * aws_event_loop_is_io_uring_zero_copy_recv_available() and fall back to the readiness +
+ * aws_socket_read() path otherwise. All of these functions must be called on the event-loop thread.
+ */
+struct aws_io_uring_zero_copy_recv;
+
+/**
+ * Invoked on the event-loop thread for each receive completion.
+ * On success, error_code is 0 and message aliases a kernel ring buffer; ownership of the message
+ * transfers to the callee. On socket EOF or error, error_code is non-zero and message is NULL.
+ * Return true to immediately re-arm the receive, false to leave it quiescent until
+ * aws_event_loop_io_uring_zero_copy_recv_resume() is called (e.g. while back-pressured).
+ */
+typedef bool(aws_io_uring_on_zero_copy_recv_fn)(int error_code, struct aws_io_message *message, void *user_data);
+
+AWS_EXTERN_C_BEGIN
+
+AWS_IO_API
+bool aws_event_loop_is_io_uring_zero_copy_recv_available(struct aws_event_loop *event_loop);
+
+/**
+ * Arms a zero-copy receive on handle and returns a tracking object, or NULL on failure.
+ * The receive is one-shot-with-re-arm: each completion re-arms only if the callback asks for it,
+ * so the channel's read-window back-pressure semantics are preserved exactly.
+ */
+AWS_IO_API
+struct aws_io_uring_zero_copy_recv *aws_event_loop_io_uring_zero_copy_recv_start(
+    struct aws_event_loop *event_loop,
+    struct aws_io_handle *handle,
+    aws_io_uring_on_zero_copy_recv_fn *on_recv,
+    void *user_data);
+
+/**
+ * Re-arms a receive that was left quiescent (callback returned false, or the buffer ring was
+ * exhausted).
+ */
+AWS_IO_API
+int aws_event_loop_io_uring_zero_copy_recv_resume(struct aws_io_uring_zero_copy_recv *zc_recv);
+
+/**
+ * Cancels the receive and releases the tracking object (asynchronously; in-flight completions are
+ * recycled without being delivered). No callbacks fire after this returns.
+ */
+AWS_IO_API
+void aws_event_loop_io_uring_zero_copy_recv_stop(struct aws_io_uring_zero_copy_recv *zc_recv);
+
+AWS_EXTERN_C_END
+
+#endif /* AWS_IO_PRIVATE_EVENT_LOOP_IO_URING_H */
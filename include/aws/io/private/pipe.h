@@ -0,0 +1,25 @@
+#ifndef AWS_IO_PIPE_PRIVATE_H
+#define AWS_IO_PIPE_PRIVATE_H
+
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/io/io.h>
+
+struct aws_event_loop;
+
+AWS_EXTERN_C_BEGIN
+
+#ifdef _WIN32
+/**
+ * Closes and discards any pooled pipe handle pairs associated with this event loop.  Called by the IOCP
+ * event loop during destruction: pooled handles are permanently associated with the loop's completion port
+ * and must not outlive it.
+ */
+AWS_IO_API
+void aws_pipe_pool_purge_event_loop(struct aws_event_loop *event_loop);
+#endif /* _WIN32 */
+
+AWS_EXTERN_C_END
+#endif /* AWS_IO_PIPE_PRIVATE_H */
@@ -41,6 +41,12 @@ int aws_import_public_and_private_keys_to_identity(
     const struct aws_byte_cursor *private_key,
     CFArrayRef *identity,
     const struct aws_string *keychain_path);
+
+/**
+ * Releases the process-wide identity cache populated by aws_import_public_and_private_keys_to_identity.
+ * Called during library clean-up.
+ */
+void aws_pki_release_identity_cache(void);
 #    endif /* AWS_OS_IOS */
 
 /**
@@ -102,6 +108,12 @@ AWS_IO_API int aws_import_trusted_certificates(
  */
 AWS_IO_API void aws_close_cert_store(HCERTSTORE cert_store);
 
+/**
+ * Releases the process-wide cert store cache populated by aws_load_cert_from_system_cert_store and
+ * aws_import_trusted_certificates. Called during library clean-up.
+ */
+AWS_IO_API void aws_pki_release_cert_store_cache(void);
+
 /**
  * Imports a PEM armored PKCS#7 public/private key pair into certs for use as a certificate with SSPI.
  */
@@ -0,0 +1,63 @@
+#ifndef AWS_IO_PRIVATE_TASK_WATCHDOG_H
+#define AWS_IO_PRIVATE_TASK_WATCHDOG_H
+
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/common/hash_table.h>
+#include <aws/common/task_scheduler.h>
+#include <aws/io/io.h>
+
+/**
+ * Watchdog for tasks that stall an event loop. A task over budget gets a warn-level log with its
+ * type_tag, how long it ran, and a running overrun count for that tag, so loop-stallers can be
+ * found from logs instead of a debugger. Overhead is two clock reads per watched task, and the
+ * per-tag bookkeeping only runs on the (rare) overrun path.
+ *
+ * Not thread safe: owned by an event loop and only touched from the loop thread.
+ */
+struct aws_task_watchdog {
+    struct aws_allocator *alloc;
+    aws_io_clock_fn *clock;
+    uint64_t budget_ns;
+    /* type_tag pointer (a string literal) -> cumulative overrun count */
+    struct aws_hash_table overrun_counts;
+};
+
+AWS_EXTERN_C_BEGIN
+
+/**
+ * budget_ns of 0 selects the default budget (100ms).
+ */
+AWS_IO_API
+int aws_task_watchdog_init(
+    struct aws_task_watchdog *watchdog,
+    struct aws_allocator *alloc,
+    aws_io_clock_fn *clock,
+    uint64_t budget_ns);
+
+AWS_IO_API
+void aws_task_watchdog_clean_up(struct aws_task_watchdog *watchdog);
+
+/**
+ * Runs the task's function with the given status, logging if it exceeds the budget.
+ */
+AWS_IO_API
+void aws_task_watchdog_run_task(
+    struct aws_task_watchdog *watchdog,
+    struct aws_task *task,
+    enum aws_task_status status);
+
+/**
+ * For task batches the watchdog can't instrument individually (the aws-c-common scheduler runs its
+ * own loop internally): logs if the whole pass from start_ns to end_ns exceeded the budget.
+ * Attribution is per-pass rather than per-task, but it still flags which loop is stalling.
+ */
+AWS_IO_API
+void aws_task_watchdog_report_pass(struct aws_task_watchdog *watchdog, uint64_t start_ns, uint64_t end_ns);
+
+AWS_EXTERN_C_END
+
+#endif /* AWS_IO_PRIVATE_TASK_WATCHDOG_H */
@@ -0,0 +1,88 @@
+#ifndef AWS_IO_PRIVATE_TIMER_WHEEL_H
+#define AWS_IO_PRIVATE_TIMER_WHEEL_H
+
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/common/linked_list.h>
+#include <aws/common/task_scheduler.h>
+#include <aws/io/io.h>
+
+/**
+ * Two-level hashed timer wheel for event-loop future tasks.
+ *
+ * The priority-queue scheduler in aws-c-common is O(log n) per insert/cancel; with hundreds of
+ * thousands of armed (and mostly cancelled-before-firing) connection timers per loop, that shows up
+ * in profiles. The wheel gives O(1) insert and cancel for anything inside its horizon: level 0
+ * covers ~0.5s at 1ms granularity, level 1 covers ~2 minutes at 0.5s granularity, and level-1 slots
+ * cascade into level 0 as they come due. Timers beyond the horizon are rejected so the caller can
+ * fall back to the priority-queue scheduler.
+ *
+ * Not thread safe: an event loop only touches its wheel from the loop thread. The wheel claims
+ * aws_task.node for its intrusive slot lists and aws_task.reserved for membership tagging, same as
+ * the aws-c-common scheduler claims them for its own bookkeeping.
+ */
+
+enum {
+    AWS_TIMER_WHEEL_LEVEL0_SLOTS = 512,
+    AWS_TIMER_WHEEL_LEVEL1_SLOTS = 256,
+};
+
+struct aws_task_watchdog;
+
+struct aws_timer_wheel {
+    struct aws_linked_list level0[AWS_TIMER_WHEEL_LEVEL0_SLOTS];
+    struct aws_linked_list level1[AWS_TIMER_WHEEL_LEVEL1_SLOTS];
+    uint64_t current_tick0;
+    uint64_t current_tick1;
+    uint64_t last_now_ns;
+    size_t level0_count;
+    size_t level1_count;
+    /* optional: when set by the owning loop, due tasks run under the watchdog's timing */
+    struct aws_task_watchdog *watchdog;
+};
+
+AWS_EXTERN_C_BEGIN
+
+AWS_IO_API
+void aws_timer_wheel_init(struct aws_timer_wheel *wheel, uint64_t now_ns);
+
+/**
+ * Cancels (runs with AWS_TASK_STATUS_CANCELED) everything still armed.
+ */
+AWS_IO_API
+void aws_timer_wheel_clean_up(struct aws_timer_wheel *wheel);
+
+/**
+ * Accepts the task if run_at_nanos is within the wheel's horizon and returns true; returns false
+ * (caller should use its fallback scheduler) otherwise.
+ */
+AWS_IO_API
+bool aws_timer_wheel_try_schedule(struct aws_timer_wheel *wheel, struct aws_task *task, uint64_t run_at_nanos);
+
+/**
+ * If the task is armed in this wheel, unlinks it, runs it with AWS_TASK_STATUS_CANCELED, and
+ * returns true. Returns false if the task isn't ours.
+ */
+AWS_IO_API
+bool aws_timer_wheel_try_cancel(struct aws_timer_wheel *wheel, struct aws_task *task);
+
+/**
+ * Advances the wheel to now_ns, running everything that has come due.
+ */
+AWS_IO_API
+void aws_timer_wheel_run_due(struct aws_timer_wheel *wheel, uint64_t now_ns);
+
+/**
+ * Returns true if any timers are armed; *next_run_time_ns is set to the next time the wheel needs
+ * to be advanced (a slot boundary, not the exact task deadline - the wheel trades sub-tick
+ * precision for O(1) operations).
+ */
+AWS_IO_API
+bool aws_timer_wheel_has_tasks(const struct aws_timer_wheel *wheel, uint64_t *next_run_time_ns);
+
+AWS_EXTERN_C_END
+
+#endif /* AWS_IO_PRIVATE_TIMER_WHEEL_H */
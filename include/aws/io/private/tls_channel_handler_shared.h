@@ -11,12 +11,16 @@
 #include <aws/io/statistics.h>
 
 struct aws_tls_connection_options;
+struct aws_tls_session_cache;
+struct aws_tls_session_cache_options;
 
 struct aws_tls_channel_handler_shared {
     uint32_t tls_timeout_ms;
     struct aws_channel_handler *handler;
     struct aws_channel_task timeout_task;
     struct aws_crt_statistics_tls stats;
+    /* High-res timestamp taken when the handler was created; anchors stats.handshake_first_byte_delay_ns. */
+    uint64_t handler_created_ns;
 };
 
 AWS_EXTERN_C_BEGIN
@@ -45,6 +49,54 @@ AWS_IO_API void aws_on_tls_negotiation_completed(
  */
 AWS_IO_API bool aws_tls_options_buf_is_set(const struct aws_byte_buf *buf);
 
+/**
+ * Creates a TLS session store from the user's cache options.  When no callbacks were supplied, sessions are held
+ * in an internal mutex-protected LRU cache; otherwise puts and gets are delegated to the user's callbacks.
+ */
+AWS_IO_API struct aws_tls_session_cache *aws_tls_session_cache_new(
+    struct aws_allocator *allocator,
+    const struct aws_tls_session_cache_options *options);
+
+AWS_IO_API void aws_tls_session_cache_destroy(struct aws_tls_session_cache *cache);
+
+/**
+ * Stores a serialized session under key, replacing any previous entry.  The cursors need only remain valid for the
+ * duration of the call.
+ */
+AWS_IO_API int aws_tls_session_cache_put(
+    struct aws_tls_session_cache *cache,
+    struct aws_byte_cursor key,
+    struct aws_byte_cursor session);
+
+/**
+ * Appends the serialized session stored under key to out_session (which must be initialized).  Raises
+ * AWS_ERROR_HASHTBL_ITEM_NOT_FOUND on a cache miss.
+ */
+AWS_IO_API int aws_tls_session_cache_get(
+    struct aws_tls_session_cache *cache,
+    struct aws_byte_cursor key,
+    struct aws_byte_buf *out_session);
+
+/**
+ * Process-wide bounded TTL cache of peer chain verification verdicts, shared by the TLS backends so reconnect
+ * waves to the same fleet skip repeated full path building. Keys are the exact bytes the backend considers
+ * decisive: the identity of the validation policy that judges the chain (so contexts with different validation
+ * callbacks never share verdicts) plus the DER chain and the server name; exact-match keys rule out
+ * collision-induced false verdicts. Returns true and writes the cached verdict's error code (AWS_ERROR_SUCCESS
+ * for a trusted chain) when an unexpired entry exists.
+ */
+AWS_IO_API bool aws_tls_verification_cache_check(struct aws_byte_cursor key, int *out_error_code);
+
+/**
+ * Records a verification verdict. Expired and least-recently-used entries are evicted as needed.
+ */
+AWS_IO_API void aws_tls_verification_cache_put(
+    struct aws_allocator *allocator,
+    struct aws_byte_cursor key,
+    int error_code);
+
+AWS_IO_API void aws_tls_verification_cache_clean_up(void);
+
 AWS_EXTERN_C_END
 
 #endif /* AWS_IO_TLS_CHANNEL_HANDLER_SHARED_H */
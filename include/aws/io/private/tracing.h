@@ -14,6 +14,38 @@ extern __itt_string_handle *tracing_event_loop_run_tasks;
 extern __itt_string_handle *tracing_event_loop_event;
 extern __itt_string_handle *tracing_event_loop_events;
 
+/*
+ * Optional USDT (dtrace/systemtap) probes for production Linux tracing with perf/bpftrace,
+ * alongside the ITT instrumentation above. Compile with -DAWS_IO_TRACING_USDT (see the
+ * AWS_USE_USDT_TRACING CMake option); a disarmed probe costs a single nop, and when the
+ * define is absent the macros compile to nothing.
+ *
+ * The provider is "aws_c_io". Each probe leads with a stable identifier (channel pointer
+ * or fd) so a single connection's latency can be followed through the stack, e.g.:
+ *   bpftrace -e 'usdt:./libaws-c-io.so:aws_c_io:socket_read /arg0 == $1/ { ... }'
+ */
+#if defined(AWS_IO_TRACING_USDT)
+#    include <sys/sdt.h>
+#    define AWS_IO_USDT_CHANNEL_SEND_MESSAGE(channel, slot, dir, len)                                                  \
+        DTRACE_PROBE4(aws_c_io, channel_send_message, (channel), (slot), (dir), (len))
+#    define AWS_IO_USDT_SOCKET_READ(fd, socket, amount) DTRACE_PROBE3(aws_c_io, socket_read, (fd), (socket), (amount))
+#    define AWS_IO_USDT_SOCKET_WRITE(fd, socket, amount)                                                               \
+        DTRACE_PROBE3(aws_c_io, socket_write, (fd), (socket), (amount))
+#    define AWS_IO_USDT_MESSAGE_POOL_ACQUIRE(pool, message, capacity)                                                  \
+        DTRACE_PROBE3(aws_c_io, message_pool_acquire, (pool), (message), (capacity))
+#    define AWS_IO_USDT_MESSAGE_POOL_RELEASE(pool, message)                                                            \
+        DTRACE_PROBE2(aws_c_io, message_pool_release, (pool), (message))
+#    define AWS_IO_USDT_TLS_NEGOTIATION_STATE(channel, handler, status, error_code)                                    \
+        DTRACE_PROBE4(aws_c_io, tls_negotiation_state, (channel), (handler), (status), (error_code))
+#else
+#    define AWS_IO_USDT_CHANNEL_SEND_MESSAGE(channel, slot, dir, len)
+#    define AWS_IO_USDT_SOCKET_READ(fd, socket, amount)
+#    define AWS_IO_USDT_SOCKET_WRITE(fd, socket, amount)
+#    define AWS_IO_USDT_MESSAGE_POOL_ACQUIRE(pool, message, capacity)
+#    define AWS_IO_USDT_MESSAGE_POOL_RELEASE(pool, message)
+#    define AWS_IO_USDT_TLS_NEGOTIATION_STATE(channel, handler, status, error_code)
+#endif /* AWS_IO_TRACING_USDT */
+
 AWS_EXTERN_C_BEGIN
 
 void aws_io_tracing_init(void);
@@ -13,6 +13,7 @@ AWS_PUSH_SANE_WARNING_LEVEL
 
 struct aws_retry_strategy;
 struct aws_retry_token;
+struct aws_event_loop;
 struct aws_event_loop_group;
 
 /**
@@ -71,6 +72,24 @@ struct aws_retry_strategy_vtable {
         void *user_data);
     int (*record_success)(struct aws_retry_token *token);
     void (*release_token)(struct aws_retry_token *token);
+    /**
+     * Optional. Like acquire_token, but the token is bound to pinned_event_loop instead of one picked from the
+     * strategy's event loop group, and on_acquired may be invoked synchronously if the caller is already on that
+     * loop's thread. If NULL, aws_retry_strategy_acquire_retry_token_pinned() falls back to acquire_token.
+     */
+    int (*acquire_token_pinned)(
+        struct aws_retry_strategy *retry_strategy,
+        const struct aws_byte_cursor *partition_id,
+        aws_retry_strategy_on_retry_token_acquired_fn *on_acquired,
+        void *user_data,
+        uint64_t timeout_ms,
+        struct aws_event_loop *pinned_event_loop);
+    /**
+     * Optional. Returns how long the caller should wait before sending the request associated with this token, in
+     * nanoseconds. Strategies that don't perform client-side rate limiting leave this NULL, and
+     * aws_retry_token_get_send_delay_ns() reports no delay.
+     */
+    uint64_t (*token_get_send_delay_ns)(const struct aws_retry_token *token);
 };
 
 struct aws_retry_strategy {
@@ -145,6 +164,15 @@ struct aws_standard_retry_options {
     size_t initial_bucket_capacity;
 };
 
+struct aws_adaptive_retry_options {
+    struct aws_standard_retry_options standard_options;
+    /**
+     * Optional. Clock override for the rate limiter, mainly for testing.
+     * Defaults to aws_high_res_clock_get_ticks().
+     */
+    int (*clock_override)(uint64_t *timestamp);
+};
+
 AWS_EXTERN_C_BEGIN
 /**
  * Acquire a reference count on retry_strategy.
@@ -167,6 +195,25 @@ AWS_IO_API int aws_retry_strategy_acquire_retry_token(
     void *user_data,
     uint64_t timeout_ms);
 
+/**
+ * Like aws_retry_strategy_acquire_retry_token(), but binds the token's scheduling to pinned_event_loop instead of a
+ * loop picked from the strategy's event loop group. Use this when the caller's connection already lives on a loop:
+ * retries are scheduled there, avoiding two cross-thread task hops per retry.
+ *
+ * Unlike aws_retry_strategy_acquire_retry_token(), on_acquired MAY be invoked synchronously from within this call
+ * when the caller is already on pinned_event_loop's thread.
+ *
+ * Passing a NULL pinned_event_loop, or calling this on a strategy that doesn't support pinning, behaves exactly like
+ * aws_retry_strategy_acquire_retry_token().
+ */
+AWS_IO_API int aws_retry_strategy_acquire_retry_token_pinned(
+    struct aws_retry_strategy *retry_strategy,
+    const struct aws_byte_cursor *partition_id,
+    aws_retry_strategy_on_retry_token_acquired_fn *on_acquired,
+    void *user_data,
+    uint64_t timeout_ms,
+    struct aws_event_loop *pinned_event_loop);
+
 /**
  * Schedules a retry based on the backoff and token based strategies. retry_ready is invoked when the retry is either
  * ready for execution or if it has been canceled due to application shutdown.
@@ -198,6 +245,14 @@ AWS_IO_API void aws_retry_token_acquire(struct aws_retry_token *token);
  * aws_retry_strategy_schedule_retry() and failing, or after calling aws_retry_token_record_success().
  */
 AWS_IO_API void aws_retry_token_release(struct aws_retry_token *token);
+
+/**
+ * Returns how long the caller should wait before sending the request associated with this token, in nanoseconds.
+ * Strategies that perform client-side rate limiting (see aws_retry_strategy_new_adaptive()) use this to smooth
+ * request admission toward a throttling backend's sustainable rate. Returns 0 for strategies without rate limiting.
+ * Re-read the hint after each call to aws_retry_strategy_schedule_retry(); it's recomputed as responses come in.
+ */
+AWS_IO_API uint64_t aws_retry_token_get_send_delay_ns(const struct aws_retry_token *token);
 /**
  * Creates a retry strategy using exponential backoff. This strategy does not perform any bookkeeping on error types and
  * success. There is no circuit breaker functionality in here. See the comments above for
@@ -235,6 +290,24 @@ AWS_IO_API struct aws_retry_strategy *aws_retry_strategy_new_standard(
     struct aws_allocator *allocator,
     const struct aws_standard_retry_options *config);
 
+/**
+ * This is the standard retry strategy plus client-side rate limiting, equivalent to the SDKs' adaptive retry mode.
+ *
+ * Each partition tracks the client's measured transmission rate and adjusts a token-fill rate with a cubic/AIMD
+ * curve: a throttling response multiplicatively cuts the fill rate, and subsequent successes grow it back along a
+ * cubic toward (and then past) the rate at which throttling was last observed. The rate limiter stays dormant until
+ * the first throttling response, so well-behaved backends pay nothing.
+ *
+ * The smoothed admission rate is surfaced as a delay-before-send hint on each token; callers should check
+ * aws_retry_token_get_send_delay_ns() before sending and wait that long (e.g. via a scheduled task). This keeps a
+ * browning-out backend at its sustainable rate instead of sawtoothing through retry-bucket exhaustion.
+ *
+ * All bookkeeping from the standard strategy (retry buckets, exponential backoff) applies unchanged.
+ */
+AWS_IO_API struct aws_retry_strategy *aws_retry_strategy_new_adaptive(
+    struct aws_allocator *allocator,
+    const struct aws_adaptive_retry_options *config);
+
 AWS_EXTERN_C_END
 AWS_POP_SANE_WARNING_LEVEL
 
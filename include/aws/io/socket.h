@@ -43,10 +43,52 @@ struct aws_socket_options {
      * lost. If zero OS defaults are used. On Windows, this option is meaningless until Windows 10 1703.*/
     uint16_t keep_alive_max_failed_probes;
     bool keepalive;
+    /* If set, SO_REUSEPORT is applied before bind (where the platform supports it), allowing
+     * several sockets to bind the same address with the kernel load balancing incoming
+     * connections between them. */
+    bool reuse_port;
+    /* If set, large sends are issued with MSG_ZEROCOPY (Linux only, ignored elsewhere) and the
+     * write-completed callback for those sends is deferred until the kernel reports on the
+     * socket's error queue that it is done with the caller's pages. Only worthwhile for
+     * sustained large transfers; requires the buffers behind aws_socket_write() to stay
+     * untouched until the completion callback fires (which the channel already guarantees). */
+    bool zero_copy_send;
+    /* If set, TCP Fast Open is enabled where the platform supports it: listeners accept data in
+     * the SYN, and client connects defer the SYN to the first write so that payload (e.g. the TLS
+     * ClientHello) rides it, saving a round trip when a fast-open cookie for the peer is cached.
+     * Ignored for non-TCP sockets. */
+    bool tcp_fast_open;
+    /* UDP generic segmentation offload (Linux only, ignored elsewhere): when non-zero, writes
+     * larger than this are handed to the kernel as one super-datagram and split into wire
+     * datagrams of this size on the way out, traversing the stack once. */
+    uint16_t udp_gso_segment_size;
+    /* UDP generic receive offload (Linux only, ignored elsewhere): consecutive datagrams from the
+     * same sender may be coalesced by the kernel and surface as one large read. Only enable when
+     * the protocol on top can handle coalesced payloads. */
+    bool udp_gro;
+    /* If non-zero, the kernel busy-polls the NIC receive queue for this many microseconds before
+     * falling back to interrupt-driven delivery (Linux SO_BUSY_POLL, ignored elsewhere). Cuts
+     * wakeup latency and raises the sustainable rate for small-datagram workloads at the cost of
+     * CPU; requires CAP_NET_ADMIN on older kernels. */
+    uint32_t busy_poll_usec;
+    /* Kernel send/receive buffer sizes (SO_SNDBUF/SO_RCVBUF); zero leaves the OS defaults. Like
+     * the rest of these options they can be changed on a live socket via aws_socket_set_options(),
+     * e.g. to shrink buffers on idle connections and grow them again for bulk transfers.
+     * On AWS_SOCKET_VSOCK sockets these size the credit window (SO_VM_SOCKETS_BUFFER_SIZE, the
+     * larger of the two wins) instead; zero picks a bulk-transfer default rather than the
+     * kernel's, which is far too small for enclave traffic. */
+    uint32_t send_buffer_size;
+    uint32_t receive_buffer_size;
+    /* TCP only, where the platform supports TCP_NOTSENT_LOWAT: the socket reports writable only
+     * while its unsent byte count is below this, so a slow receiver accumulates at most this much
+     * unsent data in the kernel and the rest queues in user space where it can still be
+     * reprioritized or dropped. Zero leaves the kernel default (no limit). */
+    uint32_t not_sent_low_water_bytes;
 };
 
 struct aws_socket;
 struct aws_event_loop;
+struct aws_event_loop_group;
 
 /**
  * Called in client mode when an outgoing connection has succeeded or an error has occurred.
@@ -201,6 +243,25 @@ AWS_IO_API int aws_socket_start_accept(
     aws_socket_on_accept_result_fn *on_accept_result,
     void *user_data);
 
+/**
+ * TCP, LOCAL and VSOCK only. Like aws_socket_start_accept(), but subscribes the listening socket on
+ * every loop in el_group using exclusive wakeups (EPOLLEXCLUSIVE on Linux), so accept processing is
+ * distributed across the group instead of funneling through one loop. On platforms without an
+ * exclusive-wakeup mechanism each connection may wake more than one loop, but accepts still succeed.
+ *
+ * Because of this, `on_accept_result` may be invoked concurrently from any loop in the group: it
+ * must be thread safe, and it must not close the listening socket from inside the callback. Use
+ * aws_socket_stop_accept()/aws_socket_close() from outside the callback as usual; they tear down
+ * every subscription in the group.
+ *
+ * aws_socket_bind() and aws_socket_listen() must be called before calling this function.
+ */
+AWS_IO_API int aws_socket_start_accept_multi_loop(
+    struct aws_socket *socket,
+    struct aws_event_loop_group *el_group,
+    aws_socket_on_accept_result_fn *on_accept_result,
+    void *user_data);
+
 /**
  * TCP, LOCAL and VSOCK only. The listening socket will stop accepting new connections.
  * It is safe to call `aws_socket_start_accept()` again after
@@ -241,6 +302,15 @@ AWS_IO_API int aws_socket_set_options(struct aws_socket *socket, const struct aw
  */
 AWS_IO_API int aws_socket_assign_to_event_loop(struct aws_socket *socket, struct aws_event_loop *event_loop);
 
+/**
+ * Detaches the socket from the event loop it is currently assigned to, unsubscribing it from io events. Must be
+ * called from the assigned loop's thread. Afterwards the socket can be handed to another loop with
+ * aws_socket_assign_to_event_loop(); pending reads and writes resume once the new subscription is established.
+ *
+ * Not supported on IOCP (Windows): a socket cannot be disassociated from a completion port.
+ */
+AWS_IO_API int aws_socket_unassign_from_event_loop(struct aws_socket *socket);
+
 /**
  * Gets the event-loop the socket is assigned to.
  */
@@ -290,12 +360,143 @@ AWS_IO_API int aws_socket_write(
     aws_socket_on_write_completed_fn *written_fn,
     void *user_data);
 
+/**
+ * Variant of aws_socket_write() for small urgent payloads (pings, acks, protocol control frames): when writes have
+ * backed up, the payload is queued ahead of pending normal writes instead of behind them. It never preempts a write
+ * the kernel has already partially accepted, and never overtakes an earlier urgent write, so byte streams stay intact
+ * and urgent writes stay ordered relative to each other. On platforms that hand every write straight to the kernel
+ * (Windows IOCP) this behaves exactly like aws_socket_write(). Same threading and completion rules as
+ * aws_socket_write().
+ */
+AWS_IO_API int aws_socket_write_urgent(
+    struct aws_socket *socket,
+    const struct aws_byte_cursor *cursor,
+    aws_socket_on_write_completed_fn *written_fn,
+    void *user_data);
+
+/**
+ * Writes a region of an open file to the socket without routing the bytes through userspace,
+ * using the platform's file-to-socket primitive (sendfile on Linux and Apple). Queued and
+ * completed through the same machinery as aws_socket_write(): written_fn is invoked once the
+ * whole region has been handed to the kernel, or the write failed or was cancelled. The file
+ * descriptor must stay open and the region unmodified until then.
+ *
+ * Only useful below TLS: encrypted channels must route bytes through the TLS handler, so they
+ * fall back to streamed reads and aws_socket_write(). On platforms without a zero-copy
+ * primitive this raises AWS_ERROR_PLATFORM_NOT_SUPPORTED and the caller should use the same
+ * fallback.
+ *
+ * NOTE! This function must be called from the event-loop used in aws_socket_assign_to_event_loop
+ */
+AWS_IO_API int aws_socket_write_file_region(
+    struct aws_socket *socket,
+    int file_fd,
+    uint64_t offset,
+    size_t length,
+    aws_socket_on_write_completed_fn *written_fn,
+    void *user_data);
+
+/**
+ * Reads up to `buffer_count` datagrams from an AWS_SOCKET_DGRAM socket, one datagram per buffer,
+ * using a single syscall where the platform supports it (recvmmsg). Each datagram is appended at
+ * its buffer's current length, and `num_received` is set to the number of buffers filled. Returns
+ * `AWS_IO_READ_WOULD_BLOCK` if no datagrams are pending. Datagrams larger than a buffer's
+ * remaining capacity are truncated, as with aws_socket_read().
+ *
+ * NOTE! This function must be called from the event-loop used in aws_socket_assign_to_event_loop
+ */
+AWS_IO_API int aws_socket_read_datagrams(
+    struct aws_socket *socket,
+    struct aws_byte_buf *buffers,
+    size_t buffer_count,
+    size_t *num_received);
+
+/**
+ * Writes up to `datagram_count` datagrams to an AWS_SOCKET_DGRAM socket, one datagram per cursor,
+ * using a single syscall where the platform supports it (sendmmsg). Unlike aws_socket_write() this
+ * is synchronous and nothing is queued: each datagram is sent whole or not at all, `num_sent` is
+ * set to how many left the socket, and a short count (including zero, when the socket's buffer is
+ * full) means the caller should retry the remainder once the socket goes writable again.
+ *
+ * NOTE! This function must be called from the event-loop used in aws_socket_assign_to_event_loop
+ */
+AWS_IO_API int aws_socket_write_datagrams(
+    struct aws_socket *socket,
+    const struct aws_byte_cursor *datagrams,
+    size_t datagram_count,
+    size_t *num_sent);
+
+/**
+ * Initializes a socket from an already-connected file descriptor — for example one received from another
+ * process via aws_socket_read_with_fd(). The socket takes ownership of the descriptor and puts it in
+ * non-blocking mode. `options` must describe the connection the descriptor refers to (domain and type).
+ * The socket starts out connected for read and write; assign it to an event loop before using it.
+ * Only implemented on posix platforms.
+ */
+AWS_IO_API int aws_socket_init_from_fd(
+    struct aws_socket *socket,
+    struct aws_allocator *alloc,
+    const struct aws_socket_options *options,
+    int connected_fd);
+
+/**
+ * LOCAL (Unix domain) STREAM sockets only. Sends payload with fd_to_send attached as SCM_RIGHTS ancillary
+ * data, giving the receiving process a duplicate of the descriptor. payload must be at least one byte;
+ * ancillary data cannot travel alone. The call is synchronous and non-blocking: amount_written receives how
+ * much of payload was accepted (the descriptor travels with the first byte), and AWS_IO_READ_WOULD_BLOCK is
+ * raised when the kernel buffer is full — retry when the socket is writable. Must be called from the
+ * socket's event loop thread. Only implemented on posix platforms.
+ */
+AWS_IO_API int aws_socket_send_fd(
+    struct aws_socket *socket,
+    const struct aws_byte_cursor *payload,
+    int fd_to_send,
+    size_t *amount_written);
+
+/**
+ * LOCAL (Unix domain) STREAM sockets only. Like aws_socket_read(), but also captures a file descriptor if
+ * SCM_RIGHTS ancillary data accompanies the bytes read. *out_fd is set to the received descriptor (owned by
+ * the caller, opened close-on-exec) or -1 when this read carried none. Only implemented on posix platforms.
+ */
+AWS_IO_API int aws_socket_read_with_fd(
+    struct aws_socket *socket,
+    struct aws_byte_buf *buffer,
+    size_t *amount_read,
+    int *out_fd);
+
 /**
  * Gets the latest error from the socket. If no error has occurred AWS_OP_SUCCESS will be returned. This function does
  * not raise any errors to the installed error handlers.
  */
 AWS_IO_API int aws_socket_get_error(struct aws_socket *socket);
 
+/**
+ * Kernel-derived transport health signals for a connected TCP socket, sampled at call time.
+ * All fields are best-effort gauges: a field the platform cannot report is left zero.
+ */
+struct aws_socket_transport_telemetry {
+    /* smoothed round-trip time estimate, in nanoseconds */
+    uint64_t round_trip_time_ns;
+    /* round-trip time variance, in nanoseconds */
+    uint64_t round_trip_time_variance_ns;
+    /* segments retransmitted since the connection was established */
+    uint64_t retransmit_count;
+    /* congestion window in bytes (send cwnd segments * sender mss) */
+    uint64_t congestion_window_bytes;
+    /* bytes accepted by the kernel but not yet sent on the wire */
+    uint64_t kernel_send_queue_bytes;
+};
+
+/**
+ * Samples transport telemetry for a connected TCP socket. This is a single getsockopt()/ioctl() round trip
+ * (TCP_INFO and SIOCOUTQ), cheap enough to call on every statistics gather. Currently implemented on Linux;
+ * elsewhere raises AWS_ERROR_PLATFORM_NOT_SUPPORTED. Raises AWS_IO_SOCKET_INVALID_OPERATION_FOR_TYPE for
+ * non-TCP sockets.
+ */
+AWS_IO_API int aws_socket_fetch_transport_telemetry(
+    struct aws_socket *socket,
+    struct aws_socket_transport_telemetry *out_telemetry);
+
 /**
  * Returns true if the socket is still open (doesn't mean connected or listening, only that it hasn't had close()
  * called.
@@ -26,6 +26,27 @@ AWS_IO_API struct aws_channel_handler *aws_socket_handler_new(
     struct aws_channel_slot *slot,
     size_t max_read_size);
 
+struct aws_socket_handler_options {
+    struct aws_socket *socket;
+    struct aws_channel_slot *slot;
+    /* per-tick read budget in bytes; once it is spent a continuation task is scheduled so other
+     * channels on the loop get a turn. 0 means g_aws_channel_max_fragment_size. */
+    size_t max_read_size;
+    /* starting per-message read size for adaptive sizing: reads begin at this size and double
+     * toward max_read_size while the socket keeps filling buffers, shrinking back on short reads.
+     * Bulk-transfer channels reach full-size reads in a few ticks while mostly-idle ones keep
+     * small buffers. 0 disables adaptation and every read requests max_read_size. */
+    size_t initial_read_size;
+};
+
+/**
+ * Same as aws_socket_handler_new(), with the read budget and adaptive read sizing configurable
+ * per handler.
+ */
+AWS_IO_API struct aws_channel_handler *aws_socket_handler_new_with_options(
+    struct aws_allocator *allocator,
+    const struct aws_socket_handler_options *options);
+
 /* Get aws_socket from socket channel handler */
 AWS_IO_API const struct aws_socket *aws_socket_handler_get_socket(const struct aws_channel_handler *handler);
 
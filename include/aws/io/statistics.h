@@ -8,14 +8,18 @@
 
 #include <aws/io/io.h>
 
+#include <aws/common/atomics.h>
 #include <aws/common/statistics.h>
 #include <aws/io/tls_channel_handler.h>
 
+struct aws_event_loop;
+
 AWS_PUSH_SANE_WARNING_LEVEL
 
 enum aws_crt_io_statistics_category {
     AWSCRT_STAT_CAT_SOCKET = AWS_CRT_STATISTICS_CATEGORY_BEGIN_RANGE(AWS_C_IO_PACKAGE_ID),
     AWSCRT_STAT_CAT_TLS,
+    AWSCRT_STAT_CAT_CHANNEL,
 };
 
 /**
@@ -25,6 +29,25 @@ struct aws_crt_statistics_socket {
     aws_crt_statistics_category_t category;
     uint64_t bytes_read;
     uint64_t bytes_written;
+    /* gauges sampled when statistics are gathered, not interval counters */
+    /* bytes submitted to the socket but not yet accepted by the kernel */
+    uint64_t bytes_queued_write;
+    /* downstream read window remaining; 0 means reads are stalled. UINT64_MAX when the
+     * channel was created without read back pressure. */
+    uint64_t read_window_remaining;
+    /*
+     * Kernel transport gauges sampled at gather time via aws_socket_fetch_transport_telemetry();
+     * all zero for non-TCP sockets and on platforms without TCP_INFO support.
+     */
+    /* smoothed round-trip time estimate and its variance, in nanoseconds */
+    uint64_t round_trip_time_ns;
+    uint64_t round_trip_time_variance_ns;
+    /* segments retransmitted since the connection was established (cumulative, not per-interval) */
+    uint64_t retransmit_count;
+    /* congestion window, in bytes */
+    uint64_t congestion_window_bytes;
+    /* bytes accepted by the kernel but not yet sent on the wire */
+    uint64_t kernel_send_queue_bytes;
 };
 
 /**
@@ -34,9 +57,84 @@ struct aws_crt_statistics_tls {
     aws_crt_statistics_category_t category;
     uint64_t handshake_start_ns;
     uint64_t handshake_end_ns;
+    /*
+     * Handshake phase attribution; total negotiation time is handshake_end_ns - handshake_start_ns.
+     * All three are zero until the corresponding phase has happened at least once.
+     */
+    /* handler attach to first negotiation drive; on a server this is the accept-to-ClientHello gap */
+    uint64_t handshake_first_byte_delay_ns;
+    /* cumulative wall time inside the TLS library's negotiation calls (record processing plus
+     * asymmetric crypto) */
+    uint64_t handshake_crypto_ns;
+    /* cumulative wall time the handshake sat suspended waiting on an offloaded operation (custom or
+     * PKCS#11 private key operations, asynchronous chain validation) */
+    uint64_t handshake_key_op_ns;
     enum aws_tls_negotiation_status handshake_status;
 };
 
+/**
+ * Channel-level statistics record. Measures how much of its event-loop thread's time a channel
+ * actually consumes, so placement and rebalancing decisions (and chargeback) can weigh channels
+ * by cost rather than by connection count. Time is sampled with the loop's clock around the
+ * channel's task execution and message dispatch paths; no extra thread-cpu-time syscalls are made,
+ * so the numbers are coarse wall time on the loop thread, which is the quantity a loop can spend.
+ */
+struct aws_crt_statistics_channel {
+    aws_crt_statistics_category_t category;
+    /* time spent executing this channel's tasks on its event-loop thread during the interval */
+    uint64_t task_execution_ns;
+    uint64_t task_execution_count;
+    /* time spent inside handler message processing, measured at the outermost dispatch so nested
+     * hops through the pipeline are not double-counted */
+    uint64_t message_processing_ns;
+    uint64_t message_processing_count;
+};
+
+enum {
+    /* value v lands in bucket floor(log2(v)), clamped to the last bucket; bucket 0 holds 0 and 1 */
+    AWS_EVENT_LOOP_HISTOGRAM_BUCKET_COUNT = 32,
+};
+
+/**
+ * Log2-bucketed histogram maintained by an event-loop. Written only from the loop thread with
+ * relaxed atomics, so recording a sample is a handful of uncontended loads and stores and readers
+ * on other threads never block the loop. Counters are size_t for the same reason the load factor
+ * is: a 64-bit integer can't be made reliably atomic across every supported platform.
+ */
+struct aws_event_loop_histogram {
+    struct aws_atomic_var buckets[AWS_EVENT_LOOP_HISTOGRAM_BUCKET_COUNT];
+    struct aws_atomic_var sample_count;
+    struct aws_atomic_var max_sample;
+};
+
+/**
+ * Per-tick instrumentation an event-loop accumulates over its lifetime (counters are cumulative;
+ * diff two snapshots to get a rate). Cheap enough to leave on in production.
+ */
+struct aws_event_loop_tick_stats {
+    /* events returned by each wait/poll call (epoll_wait, kevent, GetQueuedCompletionStatusEx) */
+    struct aws_event_loop_histogram io_events_per_wait;
+    /* timed tasks armed (scheduler + timer wheel) at the start of each task-execution pass */
+    struct aws_event_loop_histogram task_queue_depth;
+    /* how late the earliest due timed task ran relative to its scheduled time, in nanoseconds */
+    struct aws_event_loop_histogram task_latency_ns;
+    /* wall time of each tick between register_tick_start and register_tick_end, in nanoseconds */
+    struct aws_event_loop_histogram tick_duration_ns;
+};
+
+struct aws_event_loop_histogram_snapshot {
+    size_t buckets[AWS_EVENT_LOOP_HISTOGRAM_BUCKET_COUNT];
+    size_t sample_count;
+    size_t max_sample;
+};
+
+struct aws_event_loop_tick_stats_snapshot {
+    struct aws_event_loop_histogram_snapshot io_events_per_wait;
+    struct aws_event_loop_histogram_snapshot task_queue_depth;
+    struct aws_event_loop_histogram_snapshot task_latency_ns;
+    struct aws_event_loop_histogram_snapshot tick_duration_ns;
+};
+
 AWS_EXTERN_C_BEGIN
 
 /**
@@ -75,6 +173,34 @@ void aws_crt_statistics_tls_cleanup(struct aws_crt_statistics_tls *stats);
 AWS_IO_API
 void aws_crt_statistics_tls_reset(struct aws_crt_statistics_tls *stats);
 
+/**
+ * Initializes channel statistics
+ */
+AWS_IO_API
+int aws_crt_statistics_channel_init(struct aws_crt_statistics_channel *stats);
+
+/**
+ * Cleans up channel statistics
+ */
+AWS_IO_API
+void aws_crt_statistics_channel_cleanup(struct aws_crt_statistics_channel *stats);
+
+/**
+ * Resets channel statistics for the next gather interval.
+ */
+AWS_IO_API
+void aws_crt_statistics_channel_reset(struct aws_crt_statistics_channel *stats);
+
+/**
+ * Copies the event-loop's tick instrumentation into snapshot. Safe to call from any thread;
+ * buckets are read individually, so a snapshot taken while the loop is running may be torn
+ * across samples, which is fine for monitoring purposes.
+ */
+AWS_IO_API
+void aws_event_loop_fetch_tick_stats(
+    struct aws_event_loop *event_loop,
+    struct aws_event_loop_tick_stats_snapshot *snapshot);
+
 AWS_EXTERN_C_END
 AWS_POP_SANE_WARNING_LEVEL
 
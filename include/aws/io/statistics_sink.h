@@ -0,0 +1,136 @@
+#ifndef AWS_IO_STATISTICS_SINK_H
+#define AWS_IO_STATISTICS_SINK_H
+
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/io/io.h>
+
+AWS_PUSH_SANE_WARNING_LEVEL
+
+struct aws_crt_statistics_handler;
+struct aws_event_loop;
+struct aws_shm_stats_sink;
+struct aws_shm_stats_ring;
+
+/**
+ * Shared-memory statistics sink.
+ *
+ * Publishes per-event-loop statistics into lock-free single-producer/single-consumer rings in a
+ * POSIX shared-memory segment, so an out-of-process agent can scrape every loop at 1Hz without
+ * interrupting a loop thread or taking a lock. All channels pinned to one event loop publish into
+ * that loop's ring from the loop thread, preserving the single-producer invariant.
+ *
+ * Binary layout of the segment (all offsets in bytes; assumes a 64-bit platform, the only place
+ * this sink is supported):
+ *
+ *   [0, 64)     segment header:
+ *                 u32 magic            0x41575353 ("AWSS")
+ *                 u32 layout_version   currently 1
+ *                 u32 ring_count
+ *                 u32 ring_capacity    power of two, records per ring
+ *                 u32 record_size      sizeof(aws_shm_stats_record), currently 64
+ *                 u32 reserved[11]
+ *   [64, 64 + ring_count*64)
+ *               one 64-byte ring header per ring:
+ *                 u64 head             count of records ever published; written with release
+ *                                      ordering by the producer, read with acquire by the agent.
+ *                                      slot of record n is n % ring_capacity
+ *                 u64 owner            event loop identifier, 0 while unclaimed
+ *                 u8  reserved[48]
+ *   [64 + ring_count*64, ...)
+ *               ring_count * ring_capacity records, 64 bytes each, ring-major
+ *                 (ring r's records start at 64 + ring_count*64 + r*ring_capacity*64)
+ *
+ * The ring is a broadcast ring: the producer never blocks and overwrites the oldest record. An
+ * agent should copy the records it wants, then re-read head; if head advanced by more than
+ * ring_capacity since the first read, the copy may have been overwritten mid-read and should be
+ * retried.
+ */
+
+/**
+ * One published statistics sample. 64 bytes, all fields little-endian u64 on the platforms this
+ * sink supports.
+ */
+struct aws_shm_stats_record {
+    /** high-res clock timestamp when the record was published */
+    uint64_t timestamp_ns;
+    /** identifies the publisher within the ring (e.g. the channel address); rings are per-loop */
+    uint64_t owner_id;
+    /** interval counters from aws_crt_statistics_socket */
+    uint64_t bytes_read;
+    uint64_t bytes_written;
+    /** gauges from aws_crt_statistics_socket */
+    uint64_t bytes_queued_write;
+    uint64_t read_window_remaining;
+    /** enum aws_tls_negotiation_status, or 0 if the channel has no TLS slot */
+    uint64_t tls_handshake_status;
+    uint64_t reserved;
+};
+
+struct aws_shm_stats_sink_options {
+    /**
+     * Name for the shared-memory segment (shm_open() semantics: must begin with '/').
+     * NULL picks "/aws-c-io-stats-<pid>".
+     */
+    const char *shm_name;
+    /** number of rings; one is claimed per event loop. 0 means default (64). */
+    uint32_t ring_count;
+    /** records per ring, rounded up to a power of two. 0 means default (64). */
+    uint32_t ring_capacity;
+};
+
+AWS_EXTERN_C_BEGIN
+
+/**
+ * Creates a shared-memory statistics sink: creates (or replaces) the named segment, sizes it for
+ * the requested rings, and writes the segment header. Returns NULL on failure. On platforms
+ * without POSIX shared memory, returns NULL and raises AWS_ERROR_PLATFORM_NOT_SUPPORTED.
+ */
+AWS_IO_API
+struct aws_shm_stats_sink *aws_shm_stats_sink_new(
+    struct aws_allocator *allocator,
+    const struct aws_shm_stats_sink_options *options);
+
+/**
+ * Unmaps and unlinks the segment. The sink must outlive every statistics handler created from it.
+ */
+AWS_IO_API
+void aws_shm_stats_sink_destroy(struct aws_shm_stats_sink *sink);
+
+/**
+ * Returns the ring claimed for event_loop, claiming a free one on first use.
+ * Returns NULL (and raises AWS_ERROR_INVALID_STATE) once every ring is claimed.
+ * Claiming takes the sink's lock; publishing never does.
+ */
+AWS_IO_API
+struct aws_shm_stats_ring *aws_shm_stats_sink_ring_for_event_loop(
+    struct aws_shm_stats_sink *sink,
+    struct aws_event_loop *event_loop);
+
+/**
+ * Publishes one record into the ring, overwriting the oldest if the consumer is behind.
+ * Lock-free and wait-free. Must only be called from the thread of the event loop the ring
+ * was claimed for.
+ */
+AWS_IO_API
+void aws_shm_stats_ring_publish(struct aws_shm_stats_ring *ring, const struct aws_shm_stats_record *record);
+
+/**
+ * Creates a statistics handler (for aws_channel_set_statistics_handler()) that folds each
+ * interval's gathered socket/TLS statistics into one record and publishes it to the ring of
+ * event_loop — the loop the channel is pinned to. Reports at a 1-second interval to match a
+ * 1Hz scraper.
+ */
+AWS_IO_API
+struct aws_crt_statistics_handler *aws_crt_statistics_handler_new_shm_sink(
+    struct aws_allocator *allocator,
+    struct aws_shm_stats_sink *sink,
+    struct aws_event_loop *event_loop);
+
+AWS_EXTERN_C_END
+AWS_POP_SANE_WARNING_LEVEL
+
+#endif /* AWS_IO_STATISTICS_SINK_H */
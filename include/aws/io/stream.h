@@ -39,6 +39,13 @@ struct aws_input_stream_vtable {
      * without touching the destination buffer.
      */
     int (*read)(struct aws_input_stream *stream, struct aws_byte_buf *dest);
+    /**
+     * Optional.
+     * Read into several buffers with one call, filling each in turn and stopping early
+     * at end of stream.  Same per-buffer rules as read().
+     * If not set, aws_input_stream_readv() falls back to one read() call per buffer.
+     */
+    int (*readv)(struct aws_input_stream *stream, struct aws_byte_buf *dest_array, size_t dest_count);
     int (*get_status)(struct aws_input_stream *stream, struct aws_stream_status *status);
     int (*get_length)(struct aws_input_stream *stream, int64_t *out_length);
 
@@ -92,6 +99,17 @@ AWS_IO_API int aws_input_stream_seek(struct aws_input_stream *stream, int64_t of
  */
 AWS_IO_API int aws_input_stream_read(struct aws_input_stream *stream, struct aws_byte_buf *dest);
 
+/*
+ * Read from a stream into several buffers with a single call, filling each in turn and
+ * stopping early at end of stream.  Lets callers that fill batches of fixed-size buffers
+ * (e.g. one aws_io_message per channel fragment) pay one stream call instead of one per
+ * buffer.  If AWS_OP_ERR is returned, data already written to the buffers must be ignored.
+ */
+AWS_IO_API int aws_input_stream_readv(
+    struct aws_input_stream *stream,
+    struct aws_byte_buf *dest_array,
+    size_t dest_count);
+
 /*
  * Queries miscellaneous properties of the stream
  */
@@ -130,6 +148,29 @@ AWS_IO_API struct aws_input_stream *aws_input_stream_new_from_file(
  */
 AWS_IO_API struct aws_input_stream *aws_input_stream_new_from_open_file(struct aws_allocator *allocator, FILE *file);
 
+/*
+ * Creates a stream that serves a file through a read-only memory mapping instead of buffered stdio,
+ * skipping the libc buffer so reads copy straight from page cache; intended for large request
+ * bodies.  Huge files are mapped in bounded windows that slide with the read position, and each
+ * window is flagged for sequential access.  Falls back to the buffered file stream on platforms
+ * without mmap.  Destruction unmaps and closes the file.
+ */
+AWS_IO_API struct aws_input_stream *aws_input_stream_new_from_file_mapped(
+    struct aws_allocator *allocator,
+    const char *file_name);
+
+/*
+ * Creates a stream that reads a file without polluting the page cache; intended for bulk
+ * sequential streaming of data that will never be re-read, so caching it would only evict
+ * other processes' hot pages.  Uses O_DIRECT with an aligned staging buffer where the
+ * platform and filesystem support it, and otherwise falls back to buffered reads that
+ * advise consumed pages out of the cache behind the read position.  Falls back to the
+ * buffered file stream on platforms with neither.  Destruction closes the file.
+ */
+AWS_IO_API struct aws_input_stream *aws_input_stream_new_from_file_unbuffered(
+    struct aws_allocator *allocator,
+    const char *file_name);
+
 AWS_EXTERN_C_END
 AWS_POP_SANE_WARNING_LEVEL
 
@@ -137,6 +137,16 @@ struct aws_tls_connection_options {
     struct aws_tls_ctx *ctx;
     bool advertise_alpn_message;
     uint32_t timeout_ms;
+    /**
+     * Dynamic TLS record sizing (currently honored by the s2n backend).  When dynamic_record_resize_threshold
+     * is non-zero, the connection starts with small records sized to fit a single TCP segment -- the peer can
+     * decrypt each one as soon as it arrives, improving time-to-first-byte -- then grows toward full 16KB
+     * records once that many bytes have been sent.  After dynamic_record_timeout_threshold seconds without a
+     * write, the record size drops back down so the first bytes of a fresh burst get the low-latency treatment
+     * again.  Zero disables it: records are always full-size.
+     */
+    uint32_t dynamic_record_resize_threshold;
+    uint16_t dynamic_record_timeout_threshold;
 };
 
 /**
@@ -145,6 +155,43 @@ struct aws_tls_connection_options {
  * to be operated on, like performing a sign operation or a decrypt operation.
  */
 struct aws_tls_key_operation;
+struct aws_tls_chain_validation_operation;
+
+/**
+ * Invoked on the connection's event-loop thread after the backend's built-in certificate chain validation
+ * succeeds, so the application can layer on expensive checks (CRL/OCSP fetches, policy engines) without stalling
+ * the loop: dispatch the work to your own thread pool, then finish with
+ * aws_tls_chain_validation_operation_complete() from any thread. The handshake stays suspended until then.
+ */
+typedef void(aws_tls_on_chain_validation_fn)(struct aws_tls_chain_validation_operation *operation, void *user_data);
+
+/**
+ * Stores a serialized TLS session under `key` in an external session store.  Return AWS_OP_SUCCESS if the
+ * session was stored.  Both cursors are only valid for the duration of the call; copy what you keep.
+ */
+typedef int(aws_tls_session_cache_put_fn)(struct aws_byte_cursor key, struct aws_byte_cursor session, void *user_data);
+
+/**
+ * Fetches the serialized TLS session stored under `key` into out_session (append to the initialized buffer).
+ * Return AWS_OP_SUCCESS with out_session non-empty on a hit; raise an error on a miss.
+ */
+typedef int(aws_tls_session_cache_get_fn)(struct aws_byte_cursor key, struct aws_byte_buf *out_session, void *user_data);
+
+struct aws_tls_session_cache_options {
+    /**
+     * Max sessions held by the built-in in-memory LRU cache.  0 selects a sensible default.  Ignored when
+     * external store callbacks are provided.
+     */
+    size_t capacity;
+
+    /**
+     * Optional external store (e.g. shared across processes).  Provide both or neither; when set, they replace
+     * the built-in cache.
+     */
+    aws_tls_session_cache_put_fn *put_fn;
+    aws_tls_session_cache_get_fn *get_fn;
+    void *user_data;
+};
 
 struct aws_tls_ctx_options {
     struct aws_allocator *allocator;
@@ -167,6 +214,13 @@ struct aws_tls_ctx_options {
      * Only use this if it's a CA not currently installed on your system.
      */
     struct aws_byte_buf ca_file;
+    /**
+     * When ca_file aliases a shared memory-mapped trust-store cache, the mapping is tracked here
+     * and unmapped by aws_tls_ctx_options_clean_up(). Managed by
+     * aws_tls_ctx_options_override_default_trust_store_from_shared_cache(); do not set directly.
+     */
+    void *ca_file_shared_mapping;
+    size_t ca_file_shared_mapping_size;
     /**
      * Only used on Unix systems using an openssl style trust API.
      * this is typically something like /etc/pki/tls/certs/"
@@ -252,6 +306,35 @@ struct aws_tls_ctx_options {
      * cipher preferences that allow TLS 1.3. If this is set, we will always use non TLS 1.3 preferences.
      */
     struct aws_custom_key_op_handler *custom_key_op_handler;
+
+    /**
+     * Set via aws_tls_ctx_options_set_session_cache().  When enabled, negotiated TLS sessions are captured and
+     * replayed across connections so reconnects complete with an abbreviated (resumed) handshake.
+     */
+    bool session_cache_enabled;
+    struct aws_tls_session_cache_options session_cache_options;
+
+    /**
+     * Set via aws_tls_ctx_options_set_ktls_offload(). Best-effort; see the setter's documentation for the
+     * conditions under which offload actually engages.
+     */
+    bool ktls_offload_enabled;
+
+    /**
+     * Set via aws_tls_ctx_options_set_send_buffer_size(). 0 means implementation default.
+     */
+    size_t send_buffer_size;
+
+    /**
+     * Set via aws_tls_ctx_options_set_chain_validation_callback(). Only honored by the s2n backend.
+     */
+    aws_tls_on_chain_validation_fn *on_chain_validation;
+    void *chain_validation_user_data;
+
+    /**
+     * Set via aws_tls_ctx_options_set_verification_caching().
+     */
+    bool verification_cache_enabled;
 };
 
 struct aws_tls_negotiated_protocol_message {
@@ -481,6 +564,16 @@ struct aws_tls_ctx_pkcs11_options {
      * Zero out if passing in certificate by some other means (such as file path).
      */
     struct aws_byte_cursor cert_file_contents;
+
+    /**
+     * Maximum number of PKCS#11 sessions to use for private key operations.
+     * Private key operations from concurrent TLS handshakes execute in parallel,
+     * one per session, up to this limit; additional operations wait for a session
+     * to free up. Set this no higher than the number of parallel sessions your
+     * token supports (PKCS11-UG-v2.40 section 2.6.7).
+     * If zero, a single session is used, as before.
+     */
+    size_t max_sessions;
 };
 
 /**
@@ -654,12 +747,73 @@ AWS_IO_API int aws_tls_ctx_options_override_default_trust_store_from_path(
     const char *ca_path,
     const char *ca_file);
 
+/**
+ * Override the default trust store with a shared, memory-mapped cache of sanitized PEM data.
+ * cache_path names the cache file: if it already exists (built by an earlier process), it is mmap'd
+ * read-only and used directly — no per-process bundle copy or PEM parsing — so every process on the
+ * host shares one set of physical pages for the bundle. Otherwise the bundle at ca_file is loaded,
+ * sanitized, written atomically to cache_path, and then mapped, so the first process pays the parse
+ * once on behalf of the rest. ca_file may be NULL when the cache is known to exist. Only supported
+ * on Unix systems.
+ */
+AWS_IO_API int aws_tls_ctx_options_override_default_trust_store_from_shared_cache(
+    struct aws_tls_ctx_options *options,
+    const char *ca_file,
+    const char *cache_path);
+
 /**
  * When implementing BYO_CRYPTO, if you need extra data to pass to your tls implementation, set it here. The lifetime of
  * extension_data must outlive the options object and be cleaned up after options is cleaned up.
  */
 AWS_IO_API void aws_tls_ctx_options_set_extension_data(struct aws_tls_ctx_options *options, void *extension_data);
 
+/**
+ * Enables TLS session resumption for contexts created from these options.  cache_options may be NULL for the
+ * built-in in-memory LRU cache with its default capacity; supply callbacks in cache_options to plug in an
+ * external store instead.  On Windows and Apple platforms the operating system's own per-process session cache
+ * is used; external store callbacks are not supported there.
+ */
+AWS_IO_API int aws_tls_ctx_options_set_session_cache(
+    struct aws_tls_ctx_options *options,
+    const struct aws_tls_session_cache_options *cache_options);
+
+/**
+ * Requests that, once the handshake completes, record protection be handed off to the kernel (Linux kTLS) so bulk
+ * data bypasses userspace crypto entirely. Only honored by the s2n backend on Linux when the library was built
+ * with USE_KTLS, the kernel has the tls module loaded, and the negotiated cipher is supported; otherwise
+ * connections silently continue with userspace TLS.
+ */
+AWS_IO_API void aws_tls_ctx_options_set_ktls_offload(struct aws_tls_ctx_options *options, bool ktls_offload);
+
+/**
+ * Caps the size of the internal buffer the TLS implementation uses to assemble outgoing records, trading peak
+ * throughput for a smaller per-connection footprint (significant with tens of thousands of concurrent
+ * connections). 0 (the default) keeps the implementation's default sizing. Currently only honored by the s2n
+ * backend; values below the s2n minimum will fail context creation.
+ */
+AWS_IO_API void aws_tls_ctx_options_set_send_buffer_size(struct aws_tls_ctx_options *options, size_t send_buffer_size);
+
+/**
+ * Registers a callback that runs after the backend's built-in chain validation succeeds, allowing additional
+ * asynchronous validation off the event-loop thread; see aws_tls_on_chain_validation_fn. Currently only honored
+ * by the s2n backend; other backends log a warning and validate inline as before.
+ */
+AWS_IO_API void aws_tls_ctx_options_set_chain_validation_callback(
+    struct aws_tls_ctx_options *options,
+    aws_tls_on_chain_validation_fn *on_chain_validation,
+    void *user_data);
+
+/**
+ * Enables a process-wide, bounded, time-limited cache of peer chain verification verdicts. When the same peer
+ * chain (and server name) is seen again, under the same validation policy (verdicts are keyed on the context's
+ * validation configuration, so contexts with different callbacks or trust stores never share them), before the
+ * entry expires, the expensive X.509 path building is skipped
+ * and the cached verdict is applied, which matters during reconnect storms against a fleet sharing a small set of
+ * certificates. Trades revocation/expiry recheck latency (bounded by the cache TTL) for handshake CPU; leave
+ * disabled if certificates in your fleet are revoked on shorter notice than the TTL.
+ */
+AWS_IO_API void aws_tls_ctx_options_set_verification_caching(struct aws_tls_ctx_options *options, bool enabled);
+
 /**
  * Initializes default connection options from an instance ot aws_tls_ctx.
  */
@@ -710,6 +864,16 @@ AWS_IO_API int aws_tls_connection_options_set_alpn_list(
     struct aws_allocator *allocator,
     const char *alpn_list);
 
+/**
+ * Enables dynamic TLS record sizing: small records for the first resize_threshold bytes after the handshake
+ * or after timeout_threshold seconds of write inactivity, full-size records beyond that.  See the field
+ * documentation on aws_tls_connection_options.
+ */
+AWS_IO_API void aws_tls_connection_options_set_dynamic_record_threshold(
+    struct aws_tls_connection_options *conn_options,
+    uint32_t resize_threshold,
+    uint16_t timeout_threshold);
+
 /********************************* TLS context and state management *********************************/
 
 /**
@@ -789,6 +953,23 @@ AWS_IO_API struct aws_tls_ctx *aws_tls_server_ctx_new(
 AWS_IO_API struct aws_tls_ctx *aws_tls_client_ctx_new(
     struct aws_allocator *alloc,
     const struct aws_tls_ctx_options *options);
+
+/**
+ * Like aws_tls_client_ctx_new(), but interns the result in a process-wide registry keyed by a fingerprint of the
+ * options. Calling again with functionally identical options returns a new reference to the same context instead
+ * of re-parsing certificates and rebuilding the backend config, collapsing both setup time and the per-context
+ * trust store memory. The registry keeps its own reference to every interned context; call
+ * aws_tls_ctx_cache_clean_up() (before aws_io_library_clean_up()) to drop them.
+ */
+AWS_IO_API struct aws_tls_ctx *aws_tls_client_ctx_new_cached(
+    struct aws_allocator *alloc,
+    const struct aws_tls_ctx_options *options);
+
+/**
+ * Releases every context interned by aws_tls_client_ctx_new_cached(). Contexts still referenced elsewhere remain
+ * valid; subsequent aws_tls_client_ctx_new_cached() calls start a fresh registry.
+ */
+AWS_IO_API void aws_tls_ctx_cache_clean_up(void);
 #endif /* BYO_CRYPTO */
 
 /**
@@ -814,6 +995,35 @@ AWS_IO_API struct aws_byte_buf aws_tls_handler_protocol(struct aws_channel_handl
  */
 AWS_IO_API struct aws_byte_buf aws_tls_handler_server_name(struct aws_channel_handler *handler);
 
+enum aws_tls_early_data_status {
+    /** No early data was offered on this connection. */
+    AWS_TLS_EARLY_DATA_STATUS_NONE,
+    /** The peer accepted the early data; it does not need to be resent. */
+    AWS_TLS_EARLY_DATA_STATUS_ACCEPTED,
+    /** The peer rejected the early data; the caller must replay it after negotiation completes. */
+    AWS_TLS_EARLY_DATA_STATUS_REJECTED,
+};
+
+/**
+ * Client mode only. Reports the fate of any application data written to the handler before negotiation completed
+ * (TLS 1.3 0-RTT early data). Call from the aws_tls_on_negotiation_result_fn callback or later; if the result is
+ * AWS_TLS_EARLY_DATA_STATUS_REJECTED the server discarded the early data and the caller must write it again.
+ * Only the s2n backend can send early data; other backends always report AWS_TLS_EARLY_DATA_STATUS_NONE.
+ */
+AWS_IO_API enum aws_tls_early_data_status aws_tls_handler_early_data_status(struct aws_channel_handler *handler);
+
+/**
+ * Finishes an asynchronous chain validation operation, from any thread. Pass AWS_ERROR_SUCCESS to accept the
+ * peer's chain and resume the handshake, or an error code to reject it and shut the connection down.
+ * The operation is freed by this call.
+ *
+ * You MUST call this exactly once per operation; failure to do so stalls the TLS connection indefinitely and
+ * leaks memory.
+ */
+AWS_IO_API void aws_tls_chain_validation_operation_complete(
+    struct aws_tls_chain_validation_operation *operation,
+    int error_code);
+
 /**************************** TLS KEY OPERATION *******************************/
 
 /* Note: Currently this assumes the user knows what key is being used for key/cert pairs
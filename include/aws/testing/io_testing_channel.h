@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: Apache-2.0.
  */
 #include <aws/common/clock.h>
+#include <aws/common/math.h>
 #include <aws/common/task_scheduler.h>
 #include <aws/io/channel.h>
 #include <aws/io/event_loop.h>
@@ -103,6 +104,10 @@ struct testing_channel_handler {
     testing_channel_handler_on_shutdown_fn *on_shutdown;
     void *on_shutdown_user_data;
     struct aws_crt_statistics_socket stats;
+
+    /* running totals of everything this handler has absorbed, for benchmark accounting */
+    uint64_t total_message_count;
+    uint64_t total_message_bytes;
 };
 
 static int s_testing_channel_handler_process_read_message(
@@ -114,6 +119,8 @@ static int s_testing_channel_handler_process_read_message(
     (void)message;
 
     struct testing_channel_handler *testing_handler = handler->impl;
+    testing_handler->total_message_count += 1;
+    testing_handler->total_message_bytes += message->message_data.len;
     aws_linked_list_push_back(&testing_handler->messages, &message->queueing_handle);
     return AWS_OP_SUCCESS;
 }
@@ -125,6 +132,8 @@ static int s_testing_channel_handler_process_write_message(
     (void)slot;
 
     struct testing_channel_handler *testing_handler = handler->impl;
+    testing_handler->total_message_count += 1;
+    testing_handler->total_message_bytes += message->message_data.len;
     aws_linked_list_push_back(&testing_handler->messages, &message->queueing_handle);
 
     /* Invoke completion callback if this is the left-most handler */
@@ -384,6 +393,8 @@ static inline void testing_channel_set_is_on_users_thread(struct testing_channel
 
 struct aws_testing_channel_options {
     aws_io_clock_fn *clock_fn;
+    enum aws_channel_statistics_mode statistics_mode;
+    bool enable_deferred_write_flush;
 };
 
 static inline int testing_channel_init(
@@ -402,6 +413,8 @@ static inline int testing_channel_init(
         .shutdown_user_data = testing,
         .event_loop = testing->loop,
         .enable_read_back_pressure = true,
+        .statistics_mode = options->statistics_mode,
+        .enable_deferred_write_flush = options->enable_deferred_write_flush,
     };
 
     testing->channel = aws_channel_new(allocator, &args);
@@ -634,4 +647,151 @@ static inline int testing_channel_push_write_str(struct testing_channel *channel
     return testing_channel_send_data(channel, aws_byte_cursor_from_c_str(str), AWS_CHANNEL_DIR_WRITE, false);
 }
 
+/* ---------------------------------------------------------------------------------------------------------------
+ * Benchmark harness: virtual clock, deterministic message generators, and per-run byte/cycle accounting.
+ * Use these when you want stable, reproducible numbers for A/B-ing a handler change in CI.
+ * ------------------------------------------------------------------------------------------------------------- */
+
+/** State for the virtual monotonic clock. One per translation unit, which is fine: tests that want
+ * virtual time pass testing_channel_virtual_clock as aws_testing_channel_options.clock_fn, and every
+ * testing channel in that file shares the same deterministic timeline. */
+static uint64_t s_testing_channel_virtual_time_ns = 0;
+
+/** Virtual monotonic clock. Time only moves when the test says so (testing_channel_advance_virtual_time),
+ * so future-task execution order is fully deterministic across runs and machines. */
+static inline int testing_channel_virtual_clock(uint64_t *timestamp) {
+    *timestamp = s_testing_channel_virtual_time_ns;
+    return AWS_OP_SUCCESS;
+}
+
+/** Reset/seed the virtual clock. Call at the start of each test so runs don't bleed into each other. */
+static inline void testing_channel_set_virtual_time(uint64_t time_ns) {
+    s_testing_channel_virtual_time_ns = time_ns;
+}
+
+/** Advance the virtual clock and run every task that comes due, including chain reactions.
+ * Requires the testing channel to have been created with testing_channel_virtual_clock. */
+static inline void testing_channel_advance_virtual_time(struct testing_channel *testing, uint64_t amount_ns) {
+    s_testing_channel_virtual_time_ns += amount_ns;
+    testing_channel_drain_queued_tasks(testing);
+}
+
+/** Deterministic message-source generator. Two generators with the same settings and seed emit
+ * byte-for-byte identical workloads, so a benchmark's input never varies between A and B runs. */
+struct testing_channel_message_generator {
+    /** PRNG state; set to a nonzero value of your choosing, read back to resume a sequence */
+    uint64_t seed;
+    size_t min_message_size;
+    /** when max <= min every message is exactly min_message_size bytes */
+    size_t max_message_size;
+    /** messages emitted per call to testing_channel_generator_push_burst */
+    size_t messages_per_burst;
+};
+
+static inline uint64_t s_testing_channel_generator_next(struct testing_channel_message_generator *generator) {
+    /* xorshift64: cheap, deterministic, plenty for varying message sizes */
+    uint64_t x = generator->seed ? generator->seed : 0x9E3779B97F4A7C15ULL;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    generator->seed = x;
+    return x;
+}
+
+static inline size_t s_testing_channel_generator_next_size(struct testing_channel_message_generator *generator) {
+    if (generator->max_message_size <= generator->min_message_size) {
+        return generator->min_message_size;
+    }
+    size_t range = generator->max_message_size - generator->min_message_size + 1;
+    return generator->min_message_size + (size_t)(s_testing_channel_generator_next(generator) % range);
+}
+
+/** Emit one burst of generated messages into the channel in the given direction.
+ * Messages larger than the pool's message size are clipped to what the pool hands back.
+ * Bytes actually pushed are accumulated into *out_bytes_pushed (not zeroed here, so bursts can sum). */
+static inline int testing_channel_generator_push_burst(
+    struct testing_channel *testing,
+    struct testing_channel_message_generator *generator,
+    enum aws_channel_direction dir,
+    uint64_t *out_bytes_pushed) {
+
+    for (size_t i = 0; i < generator->messages_per_burst; ++i) {
+        size_t size = s_testing_channel_generator_next_size(generator);
+
+        struct aws_io_message *msg =
+            aws_channel_acquire_message_from_pool(testing->channel, AWS_IO_MESSAGE_APPLICATION_DATA, size);
+        ASSERT_NOT_NULL(msg);
+
+        size_t actual_size = aws_min_size(size, msg->message_data.capacity);
+        memset(msg->message_data.buffer, (int)(0xA0 | (i & 0x0F)), actual_size);
+        msg->message_data.len = actual_size;
+
+        int err;
+        if (dir == AWS_CHANNEL_DIR_READ) {
+            err = testing_channel_push_read_message(testing, msg);
+        } else {
+            err = testing_channel_push_write_message(testing, msg);
+        }
+
+        if (err) {
+            aws_mem_release(msg->allocator, msg);
+            ASSERT_SUCCESS(err);
+        }
+
+        *out_bytes_pushed += actual_size;
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+struct testing_channel_benchmark_stats {
+    uint64_t bytes_pushed;
+    uint64_t messages_pushed;
+    /** what actually reached the terminal handler on the far side of the handler under test */
+    uint64_t bytes_delivered;
+    uint64_t messages_delivered;
+    /** real high-res nanoseconds spent executing channel tasks (the only wall-clock-dependent number) */
+    uint64_t task_execution_ns;
+};
+
+/** Drive `burst_count` bursts through the channel, advancing the virtual clock by `nanos_per_burst`
+ * after each and draining all due tasks. Workload content and task interleaving are deterministic;
+ * task_execution_ns wraps only the task-execution phase with the real high-res clock, so the cost of
+ * the handler under test dominates the measurement. Delivery accounting reads the terminal testing
+ * handler's running totals, so install a downstream handler before benchmarking the read direction. */
+static inline int testing_channel_run_generator_benchmark(
+    struct testing_channel *testing,
+    struct testing_channel_message_generator *generator,
+    enum aws_channel_direction dir,
+    size_t burst_count,
+    uint64_t nanos_per_burst,
+    struct testing_channel_benchmark_stats *out_stats) {
+
+    AWS_ZERO_STRUCT(*out_stats);
+
+    struct testing_channel_handler *sink =
+        (dir == AWS_CHANNEL_DIR_READ) ? testing->right_handler_impl : testing->left_handler_impl;
+    ASSERT_NOT_NULL(sink);
+
+    uint64_t sink_bytes_start = sink->total_message_bytes;
+    uint64_t sink_messages_start = sink->total_message_count;
+
+    for (size_t i = 0; i < burst_count; ++i) {
+        ASSERT_SUCCESS(testing_channel_generator_push_burst(testing, generator, dir, &out_stats->bytes_pushed));
+        out_stats->messages_pushed += generator->messages_per_burst;
+
+        uint64_t start = 0;
+        uint64_t end = 0;
+        aws_high_res_clock_get_ticks(&start);
+        testing_channel_advance_virtual_time(testing, nanos_per_burst);
+        aws_high_res_clock_get_ticks(&end);
+        out_stats->task_execution_ns += (end - start);
+    }
+
+    out_stats->bytes_delivered = sink->total_message_bytes - sink_bytes_start;
+    out_stats->messages_delivered = sink->total_message_count - sink_messages_start;
+
+    return AWS_OP_SUCCESS;
+}
+
 #endif /* AWS_TESTING_IO_TESTING_CHANNEL_H */
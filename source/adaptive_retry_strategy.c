@@ -0,0 +1,514 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/io/logging.h>
+#include <aws/io/retry_strategy.h>
+
+#include <aws/common/byte_buf.h>
+#include <aws/common/clock.h>
+#include <aws/common/hash_table.h>
+#include <aws/common/mutex.h>
+#include <aws/common/string.h>
+
+#include <inttypes.h>
+#include <math.h>
+
+/* Constants from the SDKs' adaptive retry specification. */
+static const double s_rate_smoothing = 0.8;
+static const double s_beta = 0.7;
+static const double s_scale_constant = 0.4;
+static const double s_min_fill_rate = 0.5;
+static const double s_min_capacity = 1.0;
+
+AWS_STRING_FROM_LITERAL(s_adaptive_empty_string, "");
+static struct aws_byte_cursor s_adaptive_empty_string_cur = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("");
+
+/*
+ * Per-partition client-side rate limiter.
+ *
+ * Tracks the client's measured transmission rate and adjusts a token-bucket
+ * fill rate with a cubic/AIMD curve: throttling responses multiplicatively cut
+ * the fill rate, successes grow it back along a cubic toward the last rate at
+ * which throttling was observed. The bucket stays disabled (no send delays)
+ * until the first throttling response.
+ *
+ * The lock guards a handful of doubles updated once per response; the hot
+ * acquire path is a single short critical section.
+ */
+struct adaptive_rate_limiter {
+    struct aws_allocator *allocator;
+    struct aws_retry_strategy *owner;
+    struct aws_string *partition_id;
+    struct aws_byte_cursor partition_id_cur;
+
+    struct {
+        struct aws_mutex lock;
+        bool enabled;
+        /* token bucket */
+        double fill_rate; /* tokens per second */
+        double max_capacity;
+        double current_tokens; /* may go negative; successive acquirers queue up behind the deficit */
+        uint64_t last_refill_ns;
+        /* measured client tx rate, smoothed over half-second buckets */
+        double measured_tx_rate;
+        double request_count;
+        double last_tx_rate_bucket; /* in seconds */
+        /* cubic state */
+        double last_max_rate;
+        double time_window;
+        double last_throttle_secs;
+    } synced_data;
+};
+
+static double s_ns_to_secs(uint64_t ns) {
+    return (double)ns / (double)AWS_TIMESTAMP_NANOS;
+}
+
+static void s_rate_limiter_destroy(void *rate_limiter) {
+    struct adaptive_rate_limiter *limiter = rate_limiter;
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_ADAPTIVE_RETRY_STRATEGY,
+        "id=%p: destroying rate limiter for partition " PRInSTR,
+        (void *)limiter->owner,
+        AWS_BYTE_CURSOR_PRI(limiter->partition_id_cur));
+    aws_string_destroy(limiter->partition_id);
+    aws_mutex_clean_up(&limiter->synced_data.lock);
+    aws_mem_release(limiter->allocator, limiter);
+}
+
+/* must be called with the limiter's lock held */
+static void s_rate_limiter_refill(struct adaptive_rate_limiter *limiter, uint64_t now_ns) {
+    if (limiter->synced_data.last_refill_ns != 0 && now_ns > limiter->synced_data.last_refill_ns) {
+        double elapsed_secs = s_ns_to_secs(now_ns - limiter->synced_data.last_refill_ns);
+        double refilled = limiter->synced_data.current_tokens + elapsed_secs * limiter->synced_data.fill_rate;
+        limiter->synced_data.current_tokens = aws_min_double(refilled, limiter->synced_data.max_capacity);
+    }
+    limiter->synced_data.last_refill_ns = now_ns;
+}
+
+/* must be called with the limiter's lock held */
+static void s_rate_limiter_update_rate(struct adaptive_rate_limiter *limiter, double new_rate, uint64_t now_ns) {
+    s_rate_limiter_refill(limiter, now_ns);
+    limiter->synced_data.fill_rate = aws_max_double(new_rate, s_min_fill_rate);
+    limiter->synced_data.max_capacity = aws_max_double(new_rate, s_min_capacity);
+    limiter->synced_data.current_tokens =
+        aws_min_double(limiter->synced_data.current_tokens, limiter->synced_data.max_capacity);
+}
+
+/* must be called with the limiter's lock held */
+static void s_rate_limiter_update_measured_rate(struct adaptive_rate_limiter *limiter, uint64_t now_ns) {
+    double now_secs = s_ns_to_secs(now_ns);
+    double time_bucket = floor(now_secs * 2.0) / 2.0;
+
+    limiter->synced_data.request_count += 1.0;
+    if (time_bucket > limiter->synced_data.last_tx_rate_bucket) {
+        double current_rate =
+            limiter->synced_data.request_count / (time_bucket - limiter->synced_data.last_tx_rate_bucket);
+        limiter->synced_data.measured_tx_rate =
+            current_rate * s_rate_smoothing + limiter->synced_data.measured_tx_rate * (1.0 - s_rate_smoothing);
+        limiter->synced_data.request_count = 0.0;
+        limiter->synced_data.last_tx_rate_bucket = time_bucket;
+    }
+}
+
+/* must be called with the limiter's lock held */
+static void s_rate_limiter_calculate_time_window(struct adaptive_rate_limiter *limiter) {
+    limiter->synced_data.time_window =
+        pow(limiter->synced_data.last_max_rate * (1.0 - s_beta) / s_scale_constant, 1.0 / 3.0);
+}
+
+/* Update the sending rate from a response. is_throttling is true when the service told us to back off. */
+static void s_rate_limiter_on_response(struct adaptive_rate_limiter *limiter, uint64_t now_ns, bool is_throttling) {
+    double calculated_rate = 0.0;
+    double now_secs = s_ns_to_secs(now_ns);
+
+    AWS_FATAL_ASSERT(!aws_mutex_lock(&limiter->synced_data.lock) && "rate limiter mutex lock failed");
+
+    s_rate_limiter_update_measured_rate(limiter, now_ns);
+
+    if (is_throttling) {
+        double rate_to_use = limiter->synced_data.enabled
+                                 ? aws_min_double(limiter->synced_data.measured_tx_rate, limiter->synced_data.fill_rate)
+                                 : limiter->synced_data.measured_tx_rate;
+        limiter->synced_data.last_max_rate = rate_to_use;
+        s_rate_limiter_calculate_time_window(limiter);
+        limiter->synced_data.last_throttle_secs = now_secs;
+        calculated_rate = rate_to_use * s_beta;
+        limiter->synced_data.enabled = true;
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_ADAPTIVE_RETRY_STRATEGY,
+            "id=%p: partition=" PRInSTR ": throttling response received, cutting fill rate to %f tokens/sec",
+            (void *)limiter->owner,
+            AWS_BYTE_CURSOR_PRI(limiter->partition_id_cur),
+            aws_max_double(calculated_rate, s_min_fill_rate));
+    } else {
+        s_rate_limiter_calculate_time_window(limiter);
+        double dt = now_secs - limiter->synced_data.last_throttle_secs;
+        calculated_rate =
+            s_scale_constant * pow(dt - limiter->synced_data.time_window, 3.0) + limiter->synced_data.last_max_rate;
+    }
+
+    if (limiter->synced_data.enabled) {
+        /* never run faster than double the rate we've actually observed ourselves sending */
+        double new_rate = aws_min_double(calculated_rate, 2.0 * limiter->synced_data.measured_tx_rate);
+        s_rate_limiter_update_rate(limiter, new_rate, now_ns);
+    }
+
+    AWS_FATAL_ASSERT(!aws_mutex_unlock(&limiter->synced_data.lock) && "rate limiter mutex unlock failed");
+}
+
+/* Debit one token from the bucket, returning how long the caller should wait before sending. */
+static uint64_t s_rate_limiter_acquire_delay_ns(struct adaptive_rate_limiter *limiter, uint64_t now_ns) {
+    uint64_t delay_ns = 0;
+
+    AWS_FATAL_ASSERT(!aws_mutex_lock(&limiter->synced_data.lock) && "rate limiter mutex lock failed");
+    if (limiter->synced_data.enabled) {
+        s_rate_limiter_refill(limiter, now_ns);
+        limiter->synced_data.current_tokens -= 1.0;
+        if (limiter->synced_data.current_tokens < 0.0) {
+            double wait_secs = -limiter->synced_data.current_tokens / limiter->synced_data.fill_rate;
+            delay_ns = (uint64_t)(wait_secs * (double)AWS_TIMESTAMP_NANOS);
+        }
+    }
+    AWS_FATAL_ASSERT(!aws_mutex_unlock(&limiter->synced_data.lock) && "rate limiter mutex unlock failed");
+
+    return delay_ns;
+}
+
+struct adaptive_strategy {
+    struct aws_retry_strategy base;
+    struct aws_retry_strategy *standard_strategy;
+    int (*clock_fn)(uint64_t *timestamp);
+    struct {
+        struct aws_hash_table rate_limiters;
+        struct aws_mutex lock;
+    } synced_data;
+};
+
+struct adaptive_retry_token {
+    struct aws_retry_token base;
+    struct adaptive_rate_limiter *rate_limiter;
+    struct aws_retry_token *standard_token;
+    aws_retry_strategy_on_retry_token_acquired_fn *original_on_acquired;
+    aws_retry_strategy_on_retry_ready_fn *original_on_ready;
+    void *original_user_data;
+    struct aws_atomic_var send_delay_ns;
+};
+
+static uint64_t s_adaptive_strategy_now_ns(struct adaptive_strategy *adaptive_strategy) {
+    uint64_t now_ns = 0;
+    adaptive_strategy->clock_fn(&now_ns);
+    return now_ns;
+}
+
+static bool s_adaptive_partition_id_equals_byte_cur(const void *seated_cur, const void *cur_ptr) {
+    return aws_byte_cursor_eq_ignore_case(seated_cur, cur_ptr);
+}
+
+static uint64_t s_adaptive_hash_partition_id(const void *seated_partition_ptr) {
+    return aws_hash_byte_cursor_ptr_ignore_case(seated_partition_ptr);
+}
+
+static void s_adaptive_retry_destroy(struct aws_retry_strategy *retry_strategy) {
+    AWS_LOGF_TRACE(AWS_LS_IO_ADAPTIVE_RETRY_STRATEGY, "id=%p: destroying self", (void *)retry_strategy);
+    struct adaptive_strategy *adaptive_strategy = retry_strategy->impl;
+    aws_retry_strategy_release(adaptive_strategy->standard_strategy);
+    aws_hash_table_clean_up(&adaptive_strategy->synced_data.rate_limiters);
+    aws_mutex_clean_up(&adaptive_strategy->synced_data.lock);
+    aws_mem_release(retry_strategy->allocator, adaptive_strategy);
+}
+
+/* Find or create the rate limiter for partition_id, mirroring the standard strategy's bucket table. */
+static struct adaptive_rate_limiter *s_adaptive_get_rate_limiter(
+    struct adaptive_strategy *adaptive_strategy,
+    const struct aws_byte_cursor *partition_id_ptr) {
+
+    struct aws_hash_element *element_ptr = NULL;
+    struct adaptive_rate_limiter *limiter = NULL;
+
+    AWS_FATAL_ASSERT(!aws_mutex_lock(&adaptive_strategy->synced_data.lock) && "Lock acquisition failed.");
+    aws_hash_table_find(&adaptive_strategy->synced_data.rate_limiters, partition_id_ptr, &element_ptr);
+    if (element_ptr) {
+        limiter = element_ptr->value;
+        goto unlock;
+    }
+
+    limiter = aws_mem_calloc(adaptive_strategy->base.allocator, 1, sizeof(struct adaptive_rate_limiter));
+    if (!limiter) {
+        goto unlock;
+    }
+
+    limiter->allocator = adaptive_strategy->base.allocator;
+    limiter->owner = &adaptive_strategy->base;
+    limiter->partition_id = partition_id_ptr->len > 0
+                                ? aws_string_new_from_cursor(adaptive_strategy->base.allocator, partition_id_ptr)
+                                : (struct aws_string *)s_adaptive_empty_string;
+    if (!limiter->partition_id) {
+        aws_mem_release(adaptive_strategy->base.allocator, limiter);
+        limiter = NULL;
+        goto unlock;
+    }
+    limiter->partition_id_cur = aws_byte_cursor_from_string(limiter->partition_id);
+    AWS_FATAL_ASSERT(!aws_mutex_init(&limiter->synced_data.lock) && "mutex init failed!");
+    limiter->synced_data.last_tx_rate_bucket = s_ns_to_secs(s_adaptive_strategy_now_ns(adaptive_strategy));
+
+    if (aws_hash_table_put(
+            &adaptive_strategy->synced_data.rate_limiters, &limiter->partition_id_cur, limiter, NULL)) {
+        s_rate_limiter_destroy(limiter);
+        limiter = NULL;
+        goto unlock;
+    }
+
+    AWS_LOGF_DEBUG(
+        AWS_LS_IO_ADAPTIVE_RETRY_STRATEGY,
+        "id=%p: rate limiter %p for partition_id " PRInSTR " created",
+        (void *)&adaptive_strategy->base,
+        (void *)limiter,
+        AWS_BYTE_CURSOR_PRI(*partition_id_ptr));
+
+unlock:
+    AWS_FATAL_ASSERT(!aws_mutex_unlock(&adaptive_strategy->synced_data.lock) && "Mutex unlock failed");
+    return limiter;
+}
+
+static void s_on_adaptive_inner_token_acquired(
+    struct aws_retry_strategy *retry_strategy,
+    int error_code,
+    struct aws_retry_token *token,
+    void *user_data) {
+    (void)retry_strategy;
+
+    struct adaptive_retry_token *adaptive_token = user_data;
+    struct adaptive_strategy *adaptive_strategy = adaptive_token->base.retry_strategy->impl;
+
+    if (!error_code) {
+        adaptive_token->standard_token = token;
+        uint64_t delay_ns = s_rate_limiter_acquire_delay_ns(
+            adaptive_token->rate_limiter, s_adaptive_strategy_now_ns(adaptive_strategy));
+        aws_atomic_store_int(&adaptive_token->send_delay_ns, (size_t)delay_ns);
+        if (delay_ns > 0) {
+            AWS_LOGF_DEBUG(
+                AWS_LS_IO_ADAPTIVE_RETRY_STRATEGY,
+                "token_id=%p: rate limiter suggests delaying send by %" PRIu64 " ns",
+                (void *)&adaptive_token->base,
+                delay_ns);
+        }
+        adaptive_token->original_on_acquired(
+            adaptive_token->base.retry_strategy, error_code, &adaptive_token->base, adaptive_token->original_user_data);
+    } else {
+        adaptive_token->original_on_acquired(
+            adaptive_token->base.retry_strategy, error_code, NULL, adaptive_token->original_user_data);
+        aws_retry_token_release(&adaptive_token->base);
+    }
+}
+
+static int s_adaptive_retry_acquire_token_impl(
+    struct aws_retry_strategy *retry_strategy,
+    const struct aws_byte_cursor *partition_id,
+    aws_retry_strategy_on_retry_token_acquired_fn *on_acquired,
+    void *user_data,
+    uint64_t timeout_ms,
+    struct aws_event_loop *pinned_event_loop) {
+    struct adaptive_strategy *adaptive_strategy = retry_strategy->impl;
+
+    const struct aws_byte_cursor *partition_id_ptr =
+        !partition_id || partition_id->len == 0 ? &s_adaptive_empty_string_cur : partition_id;
+
+    struct adaptive_rate_limiter *limiter = s_adaptive_get_rate_limiter(adaptive_strategy, partition_id_ptr);
+    if (!limiter) {
+        return AWS_OP_ERR;
+    }
+
+    struct adaptive_retry_token *adaptive_token =
+        aws_mem_calloc(retry_strategy->allocator, 1, sizeof(struct adaptive_retry_token));
+    if (!adaptive_token) {
+        return AWS_OP_ERR;
+    }
+
+    adaptive_token->base.allocator = retry_strategy->allocator;
+    adaptive_token->base.retry_strategy = retry_strategy;
+    aws_atomic_init_int(&adaptive_token->base.ref_count, 1u);
+    aws_retry_strategy_acquire(retry_strategy);
+    adaptive_token->base.impl = adaptive_token;
+    adaptive_token->rate_limiter = limiter;
+    adaptive_token->original_on_acquired = on_acquired;
+    adaptive_token->original_user_data = user_data;
+    aws_atomic_init_int(&adaptive_token->send_delay_ns, 0);
+
+    if (aws_retry_strategy_acquire_retry_token_pinned(
+            adaptive_strategy->standard_strategy,
+            partition_id_ptr,
+            s_on_adaptive_inner_token_acquired,
+            adaptive_token,
+            timeout_ms,
+            pinned_event_loop)) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_ADAPTIVE_RETRY_STRATEGY,
+            "id=%p: error acquiring retry token from backing standard strategy: %s",
+            (void *)retry_strategy,
+            aws_error_debug_str(aws_last_error()));
+        aws_retry_token_release(&adaptive_token->base);
+        return AWS_OP_ERR;
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_adaptive_retry_acquire_token(
+    struct aws_retry_strategy *retry_strategy,
+    const struct aws_byte_cursor *partition_id,
+    aws_retry_strategy_on_retry_token_acquired_fn *on_acquired,
+    void *user_data,
+    uint64_t timeout_ms) {
+    return s_adaptive_retry_acquire_token_impl(
+        retry_strategy, partition_id, on_acquired, user_data, timeout_ms, NULL /*pinned_event_loop*/);
+}
+
+static int s_adaptive_retry_acquire_token_pinned(
+    struct aws_retry_strategy *retry_strategy,
+    const struct aws_byte_cursor *partition_id,
+    aws_retry_strategy_on_retry_token_acquired_fn *on_acquired,
+    void *user_data,
+    uint64_t timeout_ms,
+    struct aws_event_loop *pinned_event_loop) {
+    return s_adaptive_retry_acquire_token_impl(
+        retry_strategy, partition_id, on_acquired, user_data, timeout_ms, pinned_event_loop);
+}
+
+static void s_adaptive_retry_on_inner_retry_ready(struct aws_retry_token *token, int error_code, void *user_data) {
+    (void)token;
+
+    struct adaptive_retry_token *adaptive_token = user_data;
+    adaptive_token->original_on_ready(&adaptive_token->base, error_code, adaptive_token->original_user_data);
+    /* release the acquire done before scheduling */
+    aws_retry_token_release(&adaptive_token->base);
+}
+
+static int s_adaptive_retry_strategy_schedule_retry(
+    struct aws_retry_token *token,
+    enum aws_retry_error_type error_type,
+    aws_retry_strategy_on_retry_ready_fn *retry_ready,
+    void *user_data) {
+    struct adaptive_retry_token *adaptive_token = token->impl;
+    struct adaptive_strategy *adaptive_strategy = token->retry_strategy->impl;
+
+    uint64_t now_ns = s_adaptive_strategy_now_ns(adaptive_strategy);
+    s_rate_limiter_on_response(
+        adaptive_token->rate_limiter, now_ns, error_type == AWS_RETRY_ERROR_TYPE_THROTTLING /*is_throttling*/);
+
+    /* re-derive the send hint for the retry attempt, now that the fill rate may have changed */
+    uint64_t delay_ns = s_rate_limiter_acquire_delay_ns(adaptive_token->rate_limiter, now_ns);
+    aws_atomic_store_int(&adaptive_token->send_delay_ns, (size_t)delay_ns);
+
+    adaptive_token->original_on_ready = retry_ready;
+    adaptive_token->original_user_data = user_data;
+
+    /* acquire before scheduling to prevent clean up before the callback runs. */
+    aws_retry_token_acquire(&adaptive_token->base);
+    if (aws_retry_strategy_schedule_retry(
+            adaptive_token->standard_token, error_type, s_adaptive_retry_on_inner_retry_ready, adaptive_token)) {
+        aws_retry_token_release(&adaptive_token->base);
+        return AWS_OP_ERR;
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_adaptive_retry_strategy_record_success(struct aws_retry_token *token) {
+    struct adaptive_retry_token *adaptive_token = token->impl;
+    struct adaptive_strategy *adaptive_strategy = token->retry_strategy->impl;
+
+    s_rate_limiter_on_response(
+        adaptive_token->rate_limiter, s_adaptive_strategy_now_ns(adaptive_strategy), false /*is_throttling*/);
+
+    return aws_retry_token_record_success(adaptive_token->standard_token);
+}
+
+static void s_adaptive_retry_strategy_release_token(struct aws_retry_token *token) {
+    if (token) {
+        AWS_LOGF_TRACE(AWS_LS_IO_ADAPTIVE_RETRY_STRATEGY, "id=%p: releasing token", (void *)token);
+        struct adaptive_retry_token *adaptive_token = token->impl;
+        aws_retry_token_release(adaptive_token->standard_token);
+        aws_retry_strategy_release(token->retry_strategy);
+        aws_mem_release(token->allocator, adaptive_token);
+    }
+}
+
+static uint64_t s_adaptive_retry_token_get_send_delay_ns(const struct aws_retry_token *token) {
+    struct adaptive_retry_token *adaptive_token = token->impl;
+    /* conceptually const; atomics API wants a mutable pointer */
+    struct aws_atomic_var *mutable_delay = (struct aws_atomic_var *)&adaptive_token->send_delay_ns;
+    return (uint64_t)aws_atomic_load_int(mutable_delay);
+}
+
+static struct aws_retry_strategy_vtable s_adaptive_retry_vtable = {
+    .destroy = s_adaptive_retry_destroy,
+    .acquire_token = s_adaptive_retry_acquire_token,
+    .schedule_retry = s_adaptive_retry_strategy_schedule_retry,
+    .record_success = s_adaptive_retry_strategy_record_success,
+    .release_token = s_adaptive_retry_strategy_release_token,
+    .acquire_token_pinned = s_adaptive_retry_acquire_token_pinned,
+    .token_get_send_delay_ns = s_adaptive_retry_token_get_send_delay_ns,
+};
+
+struct aws_retry_strategy *aws_retry_strategy_new_adaptive(
+    struct aws_allocator *allocator,
+    const struct aws_adaptive_retry_options *config) {
+    AWS_PRECONDITION(allocator);
+    AWS_PRECONDITION(config);
+
+    AWS_LOGF_INFO(AWS_LS_IO_ADAPTIVE_RETRY_STRATEGY, "static: creating new adaptive retry strategy");
+    struct adaptive_strategy *adaptive_strategy = aws_mem_calloc(allocator, 1, sizeof(struct adaptive_strategy));
+
+    if (!adaptive_strategy) {
+        AWS_LOGF_ERROR(AWS_LS_IO_ADAPTIVE_RETRY_STRATEGY, "static: allocation of new adaptive retry strategy failed");
+        return NULL;
+    }
+
+    aws_atomic_init_int(&adaptive_strategy->base.ref_count, 1);
+    adaptive_strategy->clock_fn = config->clock_override ? config->clock_override : aws_high_res_clock_get_ticks;
+
+    adaptive_strategy->standard_strategy = aws_retry_strategy_new_standard(allocator, &config->standard_options);
+    if (!adaptive_strategy->standard_strategy) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_ADAPTIVE_RETRY_STRATEGY,
+            "id=%p: creation of backing standard retry strategy failed: %s",
+            (void *)&adaptive_strategy->base,
+            aws_error_debug_str(aws_last_error()));
+        goto error;
+    }
+
+    if (aws_hash_table_init(
+            &adaptive_strategy->synced_data.rate_limiters,
+            allocator,
+            16u,
+            s_adaptive_hash_partition_id,
+            s_adaptive_partition_id_equals_byte_cur,
+            NULL,
+            s_rate_limiter_destroy)) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_ADAPTIVE_RETRY_STRATEGY,
+            "id=%p: rate limiter table creation failed: %s",
+            (void *)&adaptive_strategy->base,
+            aws_error_debug_str(aws_last_error()));
+        goto error;
+    }
+
+    AWS_FATAL_ASSERT(!aws_mutex_init(&adaptive_strategy->synced_data.lock) && "mutex init failed");
+
+    adaptive_strategy->base.allocator = allocator;
+    adaptive_strategy->base.vtable = &s_adaptive_retry_vtable;
+    adaptive_strategy->base.impl = adaptive_strategy;
+    return &adaptive_strategy->base;
+
+error:
+    if (adaptive_strategy->standard_strategy) {
+        aws_retry_strategy_release(adaptive_strategy->standard_strategy);
+    }
+
+    aws_mem_release(allocator, adaptive_strategy);
+
+    return NULL;
+}
@@ -39,8 +39,13 @@ static int s_alpn_process_read_message(
         return aws_raise_error(AWS_IO_UNHANDLED_ALPN_PROTOCOL_MESSAGE);
     }
 
+    /* both calls complete in place on the channel thread: the slot splice is synchronous, and
+     * set_handler pushes the new handler's initial window upstream within this same tick, so the
+     * first application bytes can ride the read dispatch that delivered the negotiation message */
     aws_channel_slot_replace(slot, new_slot);
-    aws_channel_slot_set_handler(new_slot, new_handler);
+    if (aws_channel_slot_set_handler(new_slot, new_handler)) {
+        return AWS_OP_ERR;
+    }
     return AWS_OP_SUCCESS;
 }
 
@@ -6,6 +6,9 @@
 #include <aws/io/async_stream.h>
 
 #include <aws/common/byte_buf.h>
+#include <aws/common/mutex.h>
+#include <aws/common/task.h>
+#include <aws/io/event_loop.h>
 #include <aws/io/future.h>
 #include <aws/io/stream.h>
 
@@ -151,3 +154,465 @@ struct aws_future_bool *aws_async_input_stream_read_to_fill(
 
     return future;
 }
+
+/* Data to perform the aws_async_input_stream_readv() job */
+struct aws_async_input_stream_readv_job {
+    struct aws_allocator *alloc;
+    struct aws_async_input_stream *stream;
+    struct aws_byte_buf *dest_array;
+    size_t dest_count;
+    size_t dest_index;
+    /* Future for filling the current buffer */
+    struct aws_future_bool *fill_step_future;
+    /* Future to set when this readv job completes */
+    struct aws_future_bool *on_complete_future;
+};
+
+static void s_async_stream_readv_job_complete(
+    struct aws_async_input_stream_readv_job *readv_job,
+    bool eof,
+    int error_code) {
+
+    if (error_code) {
+        aws_future_bool_set_error(readv_job->on_complete_future, error_code);
+    } else {
+        aws_future_bool_set_result(readv_job->on_complete_future, eof);
+    }
+    aws_future_bool_release(readv_job->on_complete_future);
+    aws_async_input_stream_release(readv_job->stream);
+    aws_mem_release(readv_job->alloc, readv_job);
+}
+
+/* Fill one buffer after another, looping like s_async_stream_fill_job_loop() does
+ * so the call stack can't grow with many small synchronous reads. */
+static void s_async_stream_readv_job_loop(void *user_data) {
+    struct aws_async_input_stream_readv_job *readv_job = user_data;
+
+    while (true) {
+        if (readv_job->fill_step_future) {
+            if (aws_future_bool_register_callback_if_not_done(
+                    readv_job->fill_step_future, s_async_stream_readv_job_loop, readv_job)) {
+
+                /* not done, we'll resume this loop when callback fires */
+                return;
+            }
+
+            /* fill_step_future is done */
+            int error_code = aws_future_bool_get_error(readv_job->fill_step_future);
+            bool eof = error_code ? false : aws_future_bool_get_result(readv_job->fill_step_future);
+            readv_job->fill_step_future =
+                aws_future_bool_release(readv_job->fill_step_future); /* release and NULL */
+
+            readv_job->dest_index++;
+            if (error_code || eof || readv_job->dest_index == readv_job->dest_count) {
+                /* job complete! */
+                s_async_stream_readv_job_complete(readv_job, eof, error_code);
+                return;
+            }
+        }
+
+        /* Kick off filling the next buffer, which may or may not complete async */
+        readv_job->fill_step_future =
+            aws_async_input_stream_read_to_fill(readv_job->stream, &readv_job->dest_array[readv_job->dest_index]);
+    }
+}
+
+struct aws_future_bool *aws_async_input_stream_readv(
+    struct aws_async_input_stream *stream,
+    struct aws_byte_buf *dest_array,
+    size_t dest_count) {
+
+    AWS_PRECONDITION(stream);
+    AWS_PRECONDITION(dest_array != NULL || dest_count == 0);
+
+    if (stream->vtable->readv != NULL) {
+        return stream->vtable->readv(stream, dest_array, dest_count);
+    }
+
+    struct aws_future_bool *future = aws_future_bool_new(stream->alloc);
+
+    if (dest_count == 0) {
+        aws_future_bool_set_result(future, false);
+        return future;
+    }
+
+    /* Prepare for async job */
+    struct aws_async_input_stream_readv_job *readv_job =
+        aws_mem_calloc(stream->alloc, 1, sizeof(struct aws_async_input_stream_readv_job));
+    readv_job->alloc = stream->alloc;
+    readv_job->stream = aws_async_input_stream_acquire(stream);
+    readv_job->dest_array = dest_array;
+    readv_job->dest_count = dest_count;
+    readv_job->on_complete_future = aws_future_bool_acquire(future);
+
+    /* Kick off work */
+    s_async_stream_readv_job_loop(readv_job);
+
+    return future;
+}
+
+/*
+ * file-backed async stream
+ *
+ * Reads run as tasks on an event loop pinned from a caller-provided group, so the caller's
+ * thread never blocks on disk. One loop is pinned at creation: reads must be sequential
+ * anyway (the vtable forbids overlapping reads), and keeping them on one thread keeps the
+ * file's pages warm in that thread's cache.
+ */
+struct aws_async_input_stream_file_impl {
+    struct aws_async_input_stream base;
+    /* synchronous stream that does the actual file I/O, only touched on the read loop */
+    struct aws_input_stream *source;
+    struct aws_event_loop_group *reading_elg;
+    struct aws_event_loop *read_loop;
+    struct aws_task read_task;
+    /* in-flight read; NULL between reads (only one read at a time, per the vtable contract) */
+    struct aws_byte_buf *read_dest;
+    struct aws_future_bool *read_future;
+};
+
+static void s_async_file_stream_destroy(struct aws_async_input_stream *stream) {
+    struct aws_async_input_stream_file_impl *impl = stream->impl;
+
+    aws_input_stream_release(impl->source);
+    aws_event_loop_group_release(impl->reading_elg);
+    aws_mem_release(stream->alloc, impl);
+}
+
+static void s_async_file_stream_read_task(struct aws_task *task, void *user_data, enum aws_task_status status) {
+    (void)task;
+    struct aws_async_input_stream_file_impl *impl = user_data;
+
+    /* Take ownership of the in-flight read, clearing it before completing the future,
+     * since the completion callback may immediately start another read. */
+    struct aws_byte_buf *dest = impl->read_dest;
+    struct aws_future_bool *future = impl->read_future;
+    impl->read_dest = NULL;
+    impl->read_future = NULL;
+
+    if (status == AWS_TASK_STATUS_CANCELED) {
+        aws_future_bool_set_error(future, AWS_IO_EVENT_LOOP_SHUTDOWN);
+        goto done;
+    }
+
+    if (aws_input_stream_read(impl->source, dest)) {
+        aws_future_bool_set_error(future, aws_last_error());
+        goto done;
+    }
+
+    struct aws_stream_status stream_status;
+    AWS_ZERO_STRUCT(stream_status);
+    if (aws_input_stream_get_status(impl->source, &stream_status)) {
+        aws_future_bool_set_error(future, aws_last_error());
+        goto done;
+    }
+
+    aws_future_bool_set_result(future, stream_status.is_end_of_stream);
+
+done:
+    aws_future_bool_release(future);
+    aws_async_input_stream_release(&impl->base);
+}
+
+static struct aws_future_bool *s_async_file_stream_read(
+    struct aws_async_input_stream *stream,
+    struct aws_byte_buf *dest) {
+
+    struct aws_async_input_stream_file_impl *impl = stream->impl;
+
+    struct aws_future_bool *future = aws_future_bool_new(stream->alloc);
+
+    AWS_FATAL_ASSERT(impl->read_future == NULL && "Overlapping read() calls are forbidden");
+    impl->read_dest = dest;
+    impl->read_future = aws_future_bool_acquire(future);
+
+    /* keep the stream alive until the task completes the read */
+    aws_async_input_stream_acquire(stream);
+    aws_event_loop_schedule_task_now(impl->read_loop, &impl->read_task);
+
+    return future;
+}
+
+static const struct aws_async_input_stream_vtable s_async_file_stream_vtable = {
+    .destroy = s_async_file_stream_destroy,
+    .read = s_async_file_stream_read,
+};
+
+struct aws_async_input_stream *aws_async_input_stream_new_from_file(
+    struct aws_allocator *alloc,
+    const char *file_name,
+    struct aws_event_loop_group *reading_elg) {
+
+    AWS_PRECONDITION(alloc);
+    AWS_PRECONDITION(file_name);
+    AWS_PRECONDITION(reading_elg);
+
+    struct aws_async_input_stream_file_impl *impl =
+        aws_mem_calloc(alloc, 1, sizeof(struct aws_async_input_stream_file_impl));
+
+    impl->source = aws_input_stream_new_from_file(alloc, file_name);
+    if (impl->source == NULL) {
+        goto on_error;
+    }
+
+    impl->reading_elg = aws_event_loop_group_acquire(reading_elg);
+    impl->read_loop = aws_event_loop_group_get_next_loop(reading_elg);
+    aws_task_init(&impl->read_task, s_async_file_stream_read_task, impl, "async_file_stream_read");
+
+    aws_async_input_stream_init_base(&impl->base, alloc, &s_async_file_stream_vtable, impl);
+
+    return &impl->base;
+
+on_error:
+    aws_mem_release(alloc, impl);
+    return NULL;
+}
+
+/*
+ * read-ahead adapter
+ *
+ * Wraps another async stream and keeps reading from it into a ring of pooled buffers while the
+ * caller is busy elsewhere, so the caller's next read() usually completes instantly from
+ * prefetched data. Source reads stay strictly serial (the vtable forbids overlapping reads on
+ * a stream); the pipeline depth comes from filling buffers back-to-back between caller reads.
+ */
+struct aws_async_input_stream_read_ahead_impl {
+    struct aws_async_input_stream base;
+    struct aws_async_input_stream *source;
+    struct aws_mutex lock;
+
+    struct aws_byte_buf *ring;
+    size_t buffer_count;
+
+    /* All following state is protected by lock.
+     * Ring invariant: filled buffers are ring[consume_index..consume_index+filled_count) (mod
+     * buffer_count); the buffer being filled, if any, is the one just past them. */
+    size_t consume_index;
+    size_t consumed_bytes; /* bytes already copied out of ring[consume_index] */
+    size_t filled_count;
+
+    bool fill_in_flight;
+    struct aws_future_bool *fill_future;
+    bool source_eof;
+    int source_error_code;
+
+    /* caller's read, parked until data or EOF/error arrives; NULL when none is waiting */
+    struct aws_byte_buf *pending_dest;
+    struct aws_future_bool *pending_future;
+};
+
+static void s_read_ahead_destroy(struct aws_async_input_stream *stream) {
+    struct aws_async_input_stream_read_ahead_impl *impl = stream->impl;
+
+    for (size_t i = 0; i < impl->buffer_count; ++i) {
+        aws_byte_buf_clean_up(&impl->ring[i]);
+    }
+    aws_mem_release(stream->alloc, impl->ring);
+    aws_mutex_clean_up(&impl->lock);
+    aws_async_input_stream_release(impl->source);
+    aws_mem_release(stream->alloc, impl);
+}
+
+/* Copy out of the front buffer into dest (lock held).
+ * Returns true if this copy drained the stream (EOF). */
+static bool s_read_ahead_copy_locked(struct aws_async_input_stream_read_ahead_impl *impl, struct aws_byte_buf *dest) {
+    struct aws_byte_buf *front = &impl->ring[impl->consume_index];
+
+    size_t available = front->len - impl->consumed_bytes;
+    size_t to_copy = dest->capacity - dest->len;
+    if (to_copy > available) {
+        to_copy = available;
+    }
+
+    aws_byte_buf_write(dest, front->buffer + impl->consumed_bytes, to_copy);
+    impl->consumed_bytes += to_copy;
+
+    if (impl->consumed_bytes == front->len) {
+        impl->consume_index = (impl->consume_index + 1) % impl->buffer_count;
+        impl->consumed_bytes = 0;
+        impl->filled_count--;
+    }
+
+    return impl->source_eof && impl->filled_count == 0;
+}
+
+static void s_read_ahead_on_fill_done(void *user_data);
+
+/* Start filling the next ring buffer, if there's room and the source isn't done. */
+static void s_read_ahead_begin_fill(struct aws_async_input_stream_read_ahead_impl *impl) {
+    struct aws_byte_buf *fill_buf = NULL;
+
+    aws_mutex_lock(&impl->lock);
+    if (!impl->fill_in_flight && !impl->source_eof && impl->source_error_code == 0 &&
+        impl->filled_count < impl->buffer_count) {
+
+        impl->fill_in_flight = true;
+        fill_buf = &impl->ring[(impl->consume_index + impl->filled_count) % impl->buffer_count];
+        fill_buf->len = 0;
+    }
+    aws_mutex_unlock(&impl->lock);
+
+    if (fill_buf == NULL) {
+        return;
+    }
+
+    /* keep the adapter alive until the fill completes */
+    aws_async_input_stream_acquire(&impl->base);
+
+    struct aws_future_bool *fill_future = aws_async_input_stream_read(impl->source, fill_buf);
+
+    /* store before registering: the callback may fire synchronously */
+    aws_mutex_lock(&impl->lock);
+    impl->fill_future = fill_future;
+    aws_mutex_unlock(&impl->lock);
+
+    aws_future_bool_register_callback(fill_future, s_read_ahead_on_fill_done, impl);
+}
+
+static void s_read_ahead_on_fill_done(void *user_data) {
+    struct aws_async_input_stream_read_ahead_impl *impl = user_data;
+
+    struct aws_byte_buf *pending_dest = NULL;
+    struct aws_future_bool *pending_future = NULL;
+    int pending_error_code = 0;
+    bool pending_eof = false;
+
+    aws_mutex_lock(&impl->lock);
+
+    struct aws_future_bool *fill_future = impl->fill_future;
+    impl->fill_future = NULL;
+
+    int error_code = aws_future_bool_get_error(fill_future);
+    if (error_code != 0) {
+        impl->source_error_code = error_code;
+    } else {
+        if (aws_future_bool_get_result(fill_future)) {
+            impl->source_eof = true;
+        }
+
+        /* a final read may deliver EOF with 0 bytes; don't enqueue an empty buffer */
+        if (impl->ring[(impl->consume_index + impl->filled_count) % impl->buffer_count].len > 0) {
+            impl->filled_count++;
+        }
+    }
+
+    impl->fill_in_flight = false;
+
+    /* satisfy a parked caller read, now that there's data (or a final answer) */
+    if (impl->pending_future != NULL &&
+        (impl->filled_count > 0 || impl->source_eof || impl->source_error_code != 0)) {
+
+        pending_dest = impl->pending_dest;
+        pending_future = impl->pending_future;
+        impl->pending_dest = NULL;
+        impl->pending_future = NULL;
+
+        if (impl->source_error_code != 0) {
+            pending_error_code = impl->source_error_code;
+        } else if (impl->filled_count > 0) {
+            pending_eof = s_read_ahead_copy_locked(impl, pending_dest);
+        } else {
+            pending_eof = true;
+        }
+    }
+
+    aws_mutex_unlock(&impl->lock);
+
+    aws_future_bool_release(fill_future);
+
+    /* keep the pipeline full before handing results back */
+    s_read_ahead_begin_fill(impl);
+
+    if (pending_future != NULL) {
+        if (pending_error_code != 0) {
+            aws_future_bool_set_error(pending_future, pending_error_code);
+        } else {
+            aws_future_bool_set_result(pending_future, pending_eof);
+        }
+        aws_future_bool_release(pending_future);
+    }
+
+    aws_async_input_stream_release(&impl->base);
+}
+
+static struct aws_future_bool *s_read_ahead_read(struct aws_async_input_stream *stream, struct aws_byte_buf *dest) {
+    struct aws_async_input_stream_read_ahead_impl *impl = stream->impl;
+
+    struct aws_future_bool *future = aws_future_bool_new(stream->alloc);
+
+    int error_code = 0;
+    bool complete_now = false;
+    bool eof = false;
+
+    aws_mutex_lock(&impl->lock);
+
+    AWS_FATAL_ASSERT(impl->pending_future == NULL && "Overlapping read() calls are forbidden");
+
+    if (impl->source_error_code != 0) {
+        error_code = impl->source_error_code;
+        complete_now = true;
+    } else if (impl->filled_count > 0) {
+        eof = s_read_ahead_copy_locked(impl, dest);
+        complete_now = true;
+    } else if (impl->source_eof) {
+        eof = true;
+        complete_now = true;
+    } else {
+        impl->pending_dest = dest;
+        impl->pending_future = aws_future_bool_acquire(future);
+    }
+
+    aws_mutex_unlock(&impl->lock);
+
+    if (complete_now) {
+        if (error_code != 0) {
+            aws_future_bool_set_error(future, error_code);
+        } else {
+            aws_future_bool_set_result(future, eof);
+        }
+    }
+
+    /* consuming may have opened a ring slot; a parked read needs a fill in flight */
+    s_read_ahead_begin_fill(impl);
+
+    return future;
+}
+
+static const struct aws_async_input_stream_vtable s_read_ahead_vtable = {
+    .destroy = s_read_ahead_destroy,
+    .read = s_read_ahead_read,
+};
+
+struct aws_async_input_stream *aws_async_input_stream_new_read_ahead(
+    struct aws_allocator *alloc,
+    struct aws_async_input_stream *source,
+    size_t buffer_size,
+    size_t buffer_count) {
+
+    AWS_PRECONDITION(alloc);
+    AWS_PRECONDITION(source);
+
+    if (buffer_size == 0 || buffer_count == 0) {
+        aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        return NULL;
+    }
+
+    struct aws_async_input_stream_read_ahead_impl *impl =
+        aws_mem_calloc(alloc, 1, sizeof(struct aws_async_input_stream_read_ahead_impl));
+
+    impl->source = aws_async_input_stream_acquire(source);
+    aws_mutex_init(&impl->lock);
+
+    impl->buffer_count = buffer_count;
+    impl->ring = aws_mem_calloc(alloc, buffer_count, sizeof(struct aws_byte_buf));
+    for (size_t i = 0; i < buffer_count; ++i) {
+        aws_byte_buf_init(&impl->ring[i], alloc, buffer_size);
+    }
+
+    aws_async_input_stream_init_base(&impl->base, alloc, &s_read_ahead_vtable, impl);
+
+    /* start priming the ring immediately */
+    s_read_ahead_begin_fill(impl);
+
+    return &impl->base;
+}
@@ -30,6 +30,7 @@ static int s_run(struct aws_event_loop *event_loop);
 static int s_stop(struct aws_event_loop *event_loop);
 static int s_wait_for_stop_completion(struct aws_event_loop *event_loop);
 static void s_schedule_task_now(struct aws_event_loop *event_loop, struct aws_task *task);
+static void s_schedule_task_now_background(struct aws_event_loop *event_loop, struct aws_task *task);
 static void s_schedule_task_future(struct aws_event_loop *event_loop, struct aws_task *task, uint64_t run_at_nanos);
 static void s_cancel_task(struct aws_event_loop *event_loop, struct aws_task *task);
 static int s_subscribe_to_io_events(
@@ -57,6 +58,15 @@ enum pipe_fd_index {
     WRITE_FD,
 };
 
+enum {
+    DEFAULT_TIMEOUT_SEC = 100, /* Max kevent() timeout per loop of the event-thread */
+    MAX_EVENTS = 100,          /* Max kevents to process per loop of the event-thread */
+    MAX_PENDING_CHANGES = 100, /* Max registration changes accumulated before a forced flush */
+    /* background tasks run per loop of the event-thread; a non-empty backlog keeps the next
+     * kevent() timeout at zero, so spare capacity drains it without starving the data path */
+    BACKGROUND_TASK_BUDGET_PER_TICK = 16,
+};
+
 struct kqueue_loop {
     /* thread_created_on is the handle to the event loop thread. */
     struct aws_thread thread_created_on;
@@ -69,8 +79,11 @@ struct kqueue_loop {
     struct aws_atomic_var running_thread_id;
     int kq_fd; /* kqueue file descriptor */
 
-    /* Pipe for signaling to event-thread that cross_thread_data has changed. */
+#ifndef EVFILT_USER
+    /* Pipe for signaling to event-thread that cross_thread_data has changed.
+     * Only used where EVFILT_USER is unavailable; a user event needs no pipe and no drain read. */
     int cross_thread_signal_pipe[2];
+#endif
 
     /* cross_thread_data holds things that must be communicated across threads.
      * When the event-thread is running, the mutex must be locked while anyone touches anything in cross_thread_data.
@@ -79,6 +92,7 @@ struct kqueue_loop {
         struct aws_mutex mutex;
         bool thread_signaled; /* whether thread has been signaled about changes to cross_thread_data */
         struct aws_linked_list tasks_to_schedule;
+        struct aws_linked_list background_tasks_to_schedule;
         enum event_thread_state state;
     } cross_thread_data;
 
@@ -86,8 +100,18 @@ struct kqueue_loop {
     struct {
         struct aws_task_scheduler scheduler;
 
+        /* FIFO low band: at most BACKGROUND_TASK_BUDGET_PER_TICK of these run per loop, after
+         * I/O events and the normal scheduler pass */
+        struct aws_linked_list background_tasks;
+
         int connected_handle_count;
 
+        /* Registration changes accumulated on the event-thread and submitted together with the
+         * next wait call (kevent accepts a combined changelist+eventlist), so subscription churn
+         * costs one syscall per tick instead of one per operation. */
+        struct kevent pending_changes[MAX_PENDING_CHANGES];
+        int pending_change_count;
+
         /* These variables duplicate ones in cross_thread_data. We move values out while holding the mutex and operate
          * on them later */
         enum event_thread_state state;
@@ -112,17 +136,13 @@ struct handle_data {
     struct aws_task cleanup_task;
 };
 
-enum {
-    DEFAULT_TIMEOUT_SEC = 100, /* Max kevent() timeout per loop of the event-thread */
-    MAX_EVENTS = 100,          /* Max kevents to process per loop of the event-thread */
-};
-
 struct aws_event_loop_vtable s_kqueue_vtable = {
     .destroy = s_destroy,
     .run = s_run,
     .stop = s_stop,
     .wait_for_stop_completion = s_wait_for_stop_completion,
     .schedule_task_now = s_schedule_task_now,
+    .schedule_task_now_background = s_schedule_task_now_background,
     .schedule_task_future = s_schedule_task_future,
     .subscribe_to_io_events = s_subscribe_to_io_events,
     .cancel_task = s_cancel_task,
@@ -144,7 +164,9 @@ struct aws_event_loop *aws_event_loop_new_default_with_options(
     bool clean_up_impl_mem = false;
     bool clean_up_thread = false;
     bool clean_up_kqueue = false;
+#ifndef EVFILT_USER
     bool clean_up_signal_pipe = false;
+#endif
     bool clean_up_signal_kevent = false;
     bool clean_up_mutex = false;
 
@@ -162,6 +184,10 @@ struct aws_event_loop *aws_event_loop_new_default_with_options(
     }
     clean_up_event_loop_base = true;
 
+    event_loop->tick_budget_ns =
+        aws_timestamp_convert(options->tick_budget_us, AWS_TIMESTAMP_MICROS, AWS_TIMESTAMP_NANOS, NULL);
+    event_loop->hugepage_message_pool = options->hugepage_message_pool;
+
     struct kqueue_loop *impl = aws_mem_calloc(alloc, 1, sizeof(struct kqueue_loop));
     if (!impl) {
         goto clean_up;
@@ -191,6 +217,19 @@ struct aws_event_loop *aws_event_loop_new_default_with_options(
     }
     clean_up_kqueue = true;
 
+    struct kevent thread_signal_kevent;
+#ifdef EVFILT_USER
+    /* Set up a user event for cross-thread signaling; triggering it is a single kevent() call
+     * and there is nothing to drain on wake-up. */
+    EV_SET(
+        &thread_signal_kevent,
+        0 /*ident*/,
+        EVFILT_USER /*filter*/,
+        EV_ADD | EV_CLEAR /*flags*/,
+        0 /*fflags*/,
+        0 /*data*/,
+        NULL /*udata*/);
+#else
     err = aws_open_nonblocking_posix_pipe(impl->cross_thread_signal_pipe);
     if (err) {
         AWS_LOGF_FATAL(AWS_LS_IO_EVENT_LOOP, "id=%p: failed to open pipe handle.", (void *)event_loop);
@@ -205,7 +244,6 @@ struct aws_event_loop *aws_event_loop_new_default_with_options(
     clean_up_signal_pipe = true;
 
     /* Set up kevent to handle activity on the cross_thread_signal_pipe */
-    struct kevent thread_signal_kevent;
     EV_SET(
         &thread_signal_kevent,
         impl->cross_thread_signal_pipe[READ_FD],
@@ -214,6 +252,7 @@ struct aws_event_loop *aws_event_loop_new_default_with_options(
         0 /*fflags*/,
         0 /*data*/,
         NULL /*udata*/);
+#endif /* EVFILT_USER */
 
     int res = kevent(
         impl->kq_fd,
@@ -239,6 +278,7 @@ struct aws_event_loop *aws_event_loop_new_default_with_options(
     impl->cross_thread_data.thread_signaled = false;
 
     aws_linked_list_init(&impl->cross_thread_data.tasks_to_schedule);
+    aws_linked_list_init(&impl->cross_thread_data.background_tasks_to_schedule);
 
     impl->cross_thread_data.state = EVENT_THREAD_STATE_READY_TO_RUN;
 
@@ -246,6 +286,7 @@ struct aws_event_loop *aws_event_loop_new_default_with_options(
     if (err) {
         goto clean_up;
     }
+    aws_linked_list_init(&impl->thread_data.background_tasks);
 
     impl->thread_data.state = EVENT_THREAD_STATE_READY_TO_RUN;
 
@@ -270,10 +311,12 @@ clean_up:
             0 /*nevents*/,
             NULL /*timeout*/);
     }
+#ifndef EVFILT_USER
     if (clean_up_signal_pipe) {
         close(impl->cross_thread_signal_pipe[READ_FD]);
         close(impl->cross_thread_signal_pipe[WRITE_FD]);
     }
+#endif
     if (clean_up_kqueue) {
         close(impl->kq_fd);
     }
@@ -316,12 +359,25 @@ static void s_destroy(struct aws_event_loop *event_loop) {
 
     aws_task_scheduler_clean_up(&impl->thread_data.scheduler); /* Tasks in scheduler get cancelled*/
 
+    while (!aws_linked_list_empty(&impl->thread_data.background_tasks)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&impl->thread_data.background_tasks);
+        struct aws_task *task = AWS_CONTAINER_OF(node, struct aws_task, node);
+        task->fn(task, task->arg, AWS_TASK_STATUS_CANCELED);
+    }
+
     while (!aws_linked_list_empty(&impl->cross_thread_data.tasks_to_schedule)) {
         struct aws_linked_list_node *node = aws_linked_list_pop_front(&impl->cross_thread_data.tasks_to_schedule);
         struct aws_task *task = AWS_CONTAINER_OF(node, struct aws_task, node);
         task->fn(task, task->arg, AWS_TASK_STATUS_CANCELED);
     }
 
+    while (!aws_linked_list_empty(&impl->cross_thread_data.background_tasks_to_schedule)) {
+        struct aws_linked_list_node *node =
+            aws_linked_list_pop_front(&impl->cross_thread_data.background_tasks_to_schedule);
+        struct aws_task *task = AWS_CONTAINER_OF(node, struct aws_task, node);
+        task->fn(task, task->arg, AWS_TASK_STATUS_CANCELED);
+    }
+
     /* Warn user if aws_io_handle was subscribed, but never unsubscribed. This would cause memory leaks. */
     AWS_ASSERT(impl->thread_data.connected_handle_count == 0);
 
@@ -329,6 +385,16 @@ static void s_destroy(struct aws_event_loop *event_loop) {
     aws_mutex_clean_up(&impl->cross_thread_data.mutex);
 
     struct kevent thread_signal_kevent;
+#ifdef EVFILT_USER
+    EV_SET(
+        &thread_signal_kevent,
+        0 /*ident*/,
+        EVFILT_USER /*filter*/,
+        EV_DELETE /*flags*/,
+        0 /*fflags*/,
+        0 /*data*/,
+        NULL /*udata*/);
+#else
     EV_SET(
         &thread_signal_kevent,
         impl->cross_thread_signal_pipe[READ_FD],
@@ -337,6 +403,7 @@ static void s_destroy(struct aws_event_loop *event_loop) {
         0 /*fflags*/,
         0 /*data*/,
         NULL /*udata*/);
+#endif /* EVFILT_USER */
 
     kevent(
         impl->kq_fd,
@@ -346,8 +413,10 @@ static void s_destroy(struct aws_event_loop *event_loop) {
         0 /*nevents*/,
         NULL /*timeout*/);
 
+#ifndef EVFILT_USER
     close(impl->cross_thread_signal_pipe[READ_FD]);
     close(impl->cross_thread_signal_pipe[WRITE_FD]);
+#endif
     close(impl->kq_fd);
     aws_thread_clean_up(&impl->thread_created_on);
     aws_mem_release(event_loop->alloc, impl);
@@ -392,11 +461,19 @@ void signal_cross_thread_data_changed(struct aws_event_loop *event_loop) {
         AWS_LS_IO_EVENT_LOOP,
         "id=%p: signaling event-loop that cross-thread tasks need to be scheduled.",
         (void *)event_loop);
+#ifdef EVFILT_USER
+    /* Trigger the user event. kevent() with an empty eventlist returns as soon as the changelist
+     * is processed; the EV_CLEAR on the registration re-arms it after each delivery. */
+    struct kevent trigger;
+    EV_SET(&trigger, 0 /*ident*/, EVFILT_USER /*filter*/, 0 /*flags*/, NOTE_TRIGGER /*fflags*/, 0 /*data*/, NULL);
+    kevent(impl->kq_fd, &trigger /*changelist*/, 1 /*nchanges*/, NULL /*eventlist*/, 0 /*nevents*/, NULL /*timeout*/);
+#else
     /* Doesn't actually matter what we write, any activity on pipe signals that cross_thread_data has changed,
      * If the pipe is full and the write fails, that's fine, the event-thread will get the signal from some previous
      * write */
     uint32_t write_whatever = 0xC0FFEE;
     write(impl->cross_thread_signal_pipe[WRITE_FD], &write_whatever, sizeof(write_whatever));
+#endif /* EVFILT_USER */
 }
 
 static int s_stop(struct aws_event_loop *event_loop) {
@@ -503,12 +580,110 @@ static void s_schedule_task_future(struct aws_event_loop *event_loop, struct aws
     s_schedule_task_common(event_loop, task, run_at_nanos);
 }
 
+static void s_schedule_task_now_background(struct aws_event_loop *event_loop, struct aws_task *task) {
+    AWS_ASSERT(task);
+    struct kqueue_loop *impl = event_loop->impl_data;
+
+    if (s_is_event_thread(event_loop)) {
+        AWS_LOGF_TRACE(
+            AWS_LS_IO_EVENT_LOOP, "id=%p: scheduling background task %p in-thread", (void *)event_loop, (void *)task);
+        aws_linked_list_push_back(&impl->thread_data.background_tasks, &task->node);
+        return;
+    }
+
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_EVENT_LOOP, "id=%p: scheduling background task %p cross-thread", (void *)event_loop, (void *)task);
+    task->timestamp = 0;
+    bool should_signal_thread = false;
+
+    /* Begin critical section */
+    aws_mutex_lock(&impl->cross_thread_data.mutex);
+    aws_linked_list_push_back(&impl->cross_thread_data.background_tasks_to_schedule, &task->node);
+
+    if (!impl->cross_thread_data.thread_signaled) {
+        should_signal_thread = true;
+        impl->cross_thread_data.thread_signaled = true;
+    }
+
+    aws_mutex_unlock(&impl->cross_thread_data.mutex);
+    /* End critical section */
+
+    if (should_signal_thread) {
+        signal_cross_thread_data_changed(event_loop);
+    }
+}
+
 static void s_cancel_task(struct aws_event_loop *event_loop, struct aws_task *task) {
     struct kqueue_loop *kqueue_loop = event_loop->impl_data;
     AWS_LOGF_TRACE(AWS_LS_IO_EVENT_LOOP, "id=%p: cancelling task %p", (void *)event_loop, (void *)task);
+    /* background tasks are covered too: they carry timestamp 0 and are linked through the same
+     * aws_task node, so the scheduler's cancel path unlinks them from the band's list */
     aws_task_scheduler_cancel_task(&kqueue_loop->thread_data.scheduler, task);
 }
 
+/* Called from thread.
+ * Submits accumulated registration changes immediately. EV_RECEIPT keeps kevent() from also
+ * returning ready io events, so this never consumes events meant for the main wait. Failed
+ * changes on live subscriptions are reported to the handler as error events. */
+static void s_flush_pending_changes(struct aws_event_loop *event_loop) {
+    struct kqueue_loop *impl = event_loop->impl_data;
+
+    int change_count = impl->thread_data.pending_change_count;
+    if (change_count == 0) {
+        return;
+    }
+    impl->thread_data.pending_change_count = 0;
+
+    for (int i = 0; i < change_count; ++i) {
+        impl->thread_data.pending_changes[i].flags |= EV_RECEIPT;
+    }
+
+    struct kevent receipts[MAX_PENDING_CHANGES];
+    struct timespec no_wait = {0};
+    int num_receipts = kevent(
+        impl->kq_fd,
+        impl->thread_data.pending_changes /*changelist*/,
+        change_count /*nchanges*/,
+        receipts /*eventlist*/,
+        change_count /*nevents*/,
+        &no_wait /*timeout*/);
+    if (num_receipts == -1) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_EVENT_LOOP, "id=%p: failed to submit kevent changelist.", (void *)event_loop);
+        return;
+    }
+
+    for (int i = 0; i < num_receipts; ++i) {
+        /* Every receipt is flagged as error, that's just how EV_RECEIPT works;
+         * a real error puts the error code in .data */
+        AWS_ASSERT(receipts[i].flags & EV_ERROR);
+        if (receipts[i].data != 0 && receipts[i].udata != NULL) {
+            struct handle_data *handle_data = receipts[i].udata;
+            if (handle_data->state == HANDLE_STATE_SUBSCRIBED) {
+                AWS_LOGF_ERROR(
+                    AWS_LS_IO_EVENT_LOOP,
+                    "id=%p: failed to register events on fd %d",
+                    (void *)event_loop,
+                    handle_data->owner->data.fd);
+                handle_data->on_event(
+                    event_loop, handle_data->owner, AWS_IO_EVENT_TYPE_ERROR, handle_data->on_event_user_data);
+            }
+        }
+    }
+}
+
+/* Called from thread.
+ * Reserves a slot in the pending changelist, flushing first if it's full. */
+static struct kevent *s_reserve_pending_change(struct aws_event_loop *event_loop) {
+    struct kqueue_loop *impl = event_loop->impl_data;
+
+    if (impl->thread_data.pending_change_count == MAX_PENDING_CHANGES) {
+        s_flush_pending_changes(event_loop);
+    }
+
+    return &impl->thread_data.pending_changes[impl->thread_data.pending_change_count++];
+}
+
 /* Scheduled task that connects aws_io_handle with the kqueue */
 static void s_subscribe_task(struct aws_task *task, void *user_data, enum aws_task_status status) {
     (void)task;
@@ -532,85 +707,32 @@ static void s_subscribe_task(struct aws_task *task, void *user_data, enum aws_ta
     AWS_LOGF_TRACE(
         AWS_LS_IO_EVENT_LOOP, "id=%p: subscribing to events on fd %d", (void *)event_loop, handle_data->owner->data.fd);
 
-    /* In order to monitor both reads and writes, kqueue requires you to add two separate kevents.
-     * If we're adding two separate kevents, but one of those fails, we need to remove the other kevent.
-     * Therefore we use the EV_RECEIPT flag. This causes kevent() to tell whether each EV_ADD succeeded,
-     * rather than the usual behavior of telling us about recent events. */
-    struct kevent changelist[2];
-    AWS_ZERO_ARRAY(changelist);
-
-    int changelist_size = 0;
-
+    /* In order to monitor both reads and writes, kqueue requires two separate kevents.
+     * The registrations go into the pending changelist and ride along with the next wait call.
+     * A failed EV_ADD comes back as an EV_ERROR event (with our udata intact), which the event
+     * dispatch below delivers to the handler as AWS_IO_EVENT_TYPE_ERROR. */
     if (handle_data->events_subscribed & AWS_IO_EVENT_TYPE_READABLE) {
         EV_SET(
-            &changelist[changelist_size++],
+            s_reserve_pending_change(event_loop),
             handle_data->owner->data.fd,
             EVFILT_READ /*filter*/,
-            EV_ADD | EV_RECEIPT | EV_CLEAR /*flags*/,
+            EV_ADD | EV_CLEAR /*flags*/,
             0 /*fflags*/,
             0 /*data*/,
             handle_data /*udata*/);
     }
     if (handle_data->events_subscribed & AWS_IO_EVENT_TYPE_WRITABLE) {
         EV_SET(
-            &changelist[changelist_size++],
+            s_reserve_pending_change(event_loop),
             handle_data->owner->data.fd,
             EVFILT_WRITE /*filter*/,
-            EV_ADD | EV_RECEIPT | EV_CLEAR /*flags*/,
+            EV_ADD | EV_CLEAR /*flags*/,
             0 /*fflags*/,
             0 /*data*/,
             handle_data /*udata*/);
     }
 
-    int num_events = kevent(
-        impl->kq_fd,
-        changelist /*changelist*/,
-        changelist_size /*nchanges*/,
-        changelist /*eventlist. It's OK to re-use the same memory for changelist input and eventlist output*/,
-        changelist_size /*nevents*/,
-        NULL /*timeout*/);
-    if (num_events == -1) {
-        goto subscribe_failed;
-    }
-
-    /* Look through results to see if any failed */
-    for (int i = 0; i < num_events; ++i) {
-        /* Every result should be flagged as error, that's just how EV_RECEIPT works */
-        AWS_ASSERT(changelist[i].flags & EV_ERROR);
-
-        /* If a real error occurred, .data contains the error code */
-        if (changelist[i].data != 0) {
-            goto subscribe_failed;
-        }
-    }
-
-    /* Success */
     handle_data->state = HANDLE_STATE_SUBSCRIBED;
-    return;
-
-subscribe_failed:
-    AWS_LOGF_ERROR(
-        AWS_LS_IO_EVENT_LOOP,
-        "id=%p: failed to subscribe to events on fd %d",
-        (void *)event_loop,
-        handle_data->owner->data.fd);
-    /* Remove any related kevents that succeeded */
-    for (int i = 0; i < num_events; ++i) {
-        if (changelist[i].data == 0) {
-            changelist[i].flags = EV_DELETE;
-            kevent(
-                impl->kq_fd,
-                &changelist[i] /*changelist*/,
-                1 /*nchanges*/,
-                NULL /*eventlist*/,
-                0 /*nevents*/,
-                NULL /*timeout*/);
-        }
-    }
-
-    /* We can't return an error code because this was a scheduled task.
-     * Notify the user of the failed subscription by passing AWS_IO_EVENT_TYPE_ERROR to the callback. */
-    handle_data->on_event(event_loop, handle_data->owner, AWS_IO_EVENT_TYPE_ERROR, handle_data->on_event_user_data);
 }
 
 static int s_subscribe_to_io_events(
@@ -683,31 +805,46 @@ static int s_unsubscribe_from_io_events(struct aws_event_loop *event_loop, struc
 
     /* If the handle was successfully subscribed to kqueue, then remove it. */
     if (handle_data->state == HANDLE_STATE_SUBSCRIBED) {
-        struct kevent changelist[2];
-        int changelist_size = 0;
-
-        if (handle_data->events_subscribed & AWS_IO_EVENT_TYPE_READABLE) {
-            EV_SET(
-                &changelist[changelist_size++],
-                handle_data->owner->data.fd,
-                EVFILT_READ /*filter*/,
-                EV_DELETE /*flags*/,
-                0 /*fflags*/,
-                0 /*data*/,
-                handle_data /*udata*/);
+        /* If this handle's registrations are still sitting in the pending changelist, they never
+         * reached the kernel; dropping them here makes a subscribe/unsubscribe within one tick
+         * cost zero syscalls. */
+        int kept = 0;
+        for (int i = 0; i < impl->thread_data.pending_change_count; ++i) {
+            if (impl->thread_data.pending_changes[i].udata == handle_data) {
+                continue;
+            }
+            impl->thread_data.pending_changes[kept++] = impl->thread_data.pending_changes[i];
         }
-        if (handle_data->events_subscribed & AWS_IO_EVENT_TYPE_WRITABLE) {
-            EV_SET(
-                &changelist[changelist_size++],
-                handle_data->owner->data.fd,
-                EVFILT_WRITE /*filter*/,
-                EV_DELETE /*flags*/,
-                0 /*fflags*/,
-                0 /*data*/,
-                handle_data /*udata*/);
+        bool reached_kernel = (kept == impl->thread_data.pending_change_count);
+        impl->thread_data.pending_change_count = kept;
+
+        if (reached_kernel) {
+            /* Queue the deletes with NULL udata: the handle_data may be freed before they're
+             * submitted, and a NULL udata marks any resulting error receipt as ignorable.
+             * kevent() applies the changelist before gathering the eventlist, and deleting a
+             * knote discards its queued events, so the combined call on the next wait can't
+             * deliver events for these subscriptions. */
+            if (handle_data->events_subscribed & AWS_IO_EVENT_TYPE_READABLE) {
+                EV_SET(
+                    s_reserve_pending_change(event_loop),
+                    handle_data->owner->data.fd,
+                    EVFILT_READ /*filter*/,
+                    EV_DELETE /*flags*/,
+                    0 /*fflags*/,
+                    0 /*data*/,
+                    NULL /*udata*/);
+            }
+            if (handle_data->events_subscribed & AWS_IO_EVENT_TYPE_WRITABLE) {
+                EV_SET(
+                    s_reserve_pending_change(event_loop),
+                    handle_data->owner->data.fd,
+                    EVFILT_WRITE /*filter*/,
+                    EV_DELETE /*flags*/,
+                    0 /*fflags*/,
+                    0 /*data*/,
+                    NULL /*udata*/);
+            }
         }
-
-        kevent(impl->kq_fd, changelist, changelist_size, NULL /*eventlist*/, 0 /*nevents*/, NULL /*timeout*/);
     }
 
     /* Schedule a task to clean up the memory. This is done in a task to prevent the following scenario:
@@ -764,6 +901,8 @@ static void s_process_cross_thread_data(struct aws_event_loop *event_loop) {
      * We'll process them later, so that we minimize time spent holding the mutex. */
     struct aws_linked_list tasks_to_schedule;
     aws_linked_list_init(&tasks_to_schedule);
+    struct aws_linked_list background_tasks_to_schedule;
+    aws_linked_list_init(&background_tasks_to_schedule);
 
     { /* Begin critical section */
         aws_mutex_lock(&impl->cross_thread_data.mutex);
@@ -776,11 +915,18 @@ static void s_process_cross_thread_data(struct aws_event_loop *event_loop) {
         }
 
         aws_linked_list_swap_contents(&impl->cross_thread_data.tasks_to_schedule, &tasks_to_schedule);
+        aws_linked_list_swap_contents(
+            &impl->cross_thread_data.background_tasks_to_schedule, &background_tasks_to_schedule);
 
         aws_mutex_unlock(&impl->cross_thread_data.mutex);
     } /* End critical section */
 
     s_process_tasks_to_schedule(event_loop, &tasks_to_schedule);
+
+    while (!aws_linked_list_empty(&background_tasks_to_schedule)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&background_tasks_to_schedule);
+        aws_linked_list_push_back(&impl->thread_data.background_tasks, node);
+    }
 }
 
 static int s_aws_event_flags_from_kevent(struct kevent *kevent) {
@@ -818,8 +964,13 @@ static int s_aws_event_flags_from_kevent(struct kevent *kevent) {
  * that it's doing nothing on purpose. It's waiting for events to happen...
  */
 AWS_NO_INLINE
-static int aws_event_loop_listen_for_io_events(int kq_fd, struct kevent kevents[MAX_EVENTS], struct timespec *timeout) {
-    return kevent(kq_fd, NULL /*changelist*/, 0 /*nchanges*/, kevents /*eventlist*/, MAX_EVENTS /*nevents*/, timeout);
+static int aws_event_loop_listen_for_io_events(
+    int kq_fd,
+    struct kevent *changelist,
+    int nchanges,
+    struct kevent kevents[MAX_EVENTS],
+    struct timespec *timeout) {
+    return kevent(kq_fd, changelist, nchanges, kevents /*eventlist*/, MAX_EVENTS /*nevents*/, timeout);
 }
 
 static void s_aws_kqueue_cleanup_aws_lc_thread_local_state(void *user_data) {
@@ -872,10 +1023,15 @@ static void aws_event_loop_thread(void *user_data) {
             (int)timeout.tv_sec,
             (unsigned long long)timeout.tv_nsec);
 
-        /* Process kqueue events */
-        int num_kevents = aws_event_loop_listen_for_io_events(impl->kq_fd, kevents, &timeout);
+        /* Process kqueue events, submitting any accumulated registration changes with the same
+         * call; kevent() applies the changelist before gathering the eventlist */
+        int pending_change_count = impl->thread_data.pending_change_count;
+        impl->thread_data.pending_change_count = 0;
+        int num_kevents = aws_event_loop_listen_for_io_events(
+            impl->kq_fd, impl->thread_data.pending_changes, pending_change_count, kevents, &timeout);
 
         aws_event_loop_register_tick_start(event_loop);
+        aws_event_loop_register_wait_result(event_loop, num_kevents > 0 ? (size_t)num_kevents : 0);
         AWS_LOGF_TRACE(
             AWS_LS_IO_EVENT_LOOP, "id=%p: wake up with %d events to process.", (void *)event_loop, num_kevents);
         if (num_kevents == -1) {
@@ -884,6 +1040,14 @@ static void aws_event_loop_thread(void *user_data) {
              * but we can still process scheduled tasks */
             aws_raise_error(AWS_ERROR_SYS_CALL_FAILURE);
 
+            /* The failed wait may not have applied the changelist; resubmit it. Re-adding an
+             * already-applied change is idempotent, and re-deleting just produces an ignorable
+             * receipt. The entries are still intact since nothing else has been queued yet. */
+            if (pending_change_count != 0) {
+                impl->thread_data.pending_change_count = pending_change_count;
+                s_flush_pending_changes(event_loop);
+            }
+
             /* Force the cross_thread_data to be processed.
              * There might be valuable info in there, like the message to stop the thread.
              * It's fine to do this even if nothing has changed, it just costs a mutex lock/unlock. */
@@ -894,6 +1058,13 @@ static void aws_event_loop_thread(void *user_data) {
             struct kevent *kevent = &kevents[i];
 
             /* Was this event to signal that cross_thread_data has changed? */
+#ifdef EVFILT_USER
+            if (kevent->filter == EVFILT_USER) {
+                /* EV_CLEAR on the registration re-armed the trigger; nothing to drain */
+                should_process_cross_thread_data = true;
+                continue;
+            }
+#else
             if ((int)kevent->ident == impl->cross_thread_signal_pipe[READ_FD]) {
                 should_process_cross_thread_data = true;
 
@@ -904,6 +1075,13 @@ static void aws_event_loop_thread(void *user_data) {
 
                 continue;
             }
+#endif /* EVFILT_USER */
+
+            /* Results for changelist entries submitted without udata (e.g. a deferred EV_DELETE
+             * whose knote was already gone) carry nothing to dispatch; skip them */
+            if (kevent->udata == NULL) {
+                continue;
+            }
 
             /* Otherwise this was a normal event on a subscribed handle. Figure out which flags to report. */
             int event_flags = s_aws_event_flags_from_kevent(kevent);
@@ -948,6 +1126,16 @@ static void aws_event_loop_thread(void *user_data) {
         AWS_LOGF_TRACE(AWS_LS_IO_EVENT_LOOP, "id=%p: running scheduled tasks.", (void *)event_loop);
         aws_task_scheduler_run_all(&impl->thread_data.scheduler, now_ns);
 
+        /* low band: at most a budget's worth of background work per loop, after I/O and the
+         * normal scheduler pass, bounding the latency housekeeping can inject into the data path */
+        for (int i = 0;
+             i < BACKGROUND_TASK_BUDGET_PER_TICK && !aws_linked_list_empty(&impl->thread_data.background_tasks);
+             ++i) {
+            struct aws_linked_list_node *bg_node = aws_linked_list_pop_front(&impl->thread_data.background_tasks);
+            struct aws_task *bg_task = AWS_CONTAINER_OF(bg_node, struct aws_task, node);
+            bg_task->fn(bg_task, bg_task->arg, AWS_TASK_STATUS_RUN_READY);
+        }
+
         /* Set timeout for next kevent() call.
          * If clock fails, or scheduler has no tasks, use default timeout */
         bool use_default_timeout = false;
@@ -993,6 +1181,13 @@ static void aws_event_loop_thread(void *user_data) {
             timeout.tv_nsec = (long)(timeout_remainder_ns);
         }
 
+        /* leftover background work: poll rather than block, so spare capacity keeps draining
+         * the low band while I/O stays ahead of it */
+        if (!aws_linked_list_empty(&impl->thread_data.background_tasks)) {
+            timeout.tv_sec = 0;
+            timeout.tv_nsec = 0;
+        }
+
         aws_event_loop_register_tick_end(event_loop);
     }
 
@@ -12,20 +12,43 @@
 #include <aws/io/event_loop.h>
 #include <aws/io/logging.h>
 #include <aws/io/message_pool.h>
+#include <aws/io/private/tracing.h>
 #include <aws/io/statistics.h>
 
 #ifdef _MSC_VER
 #    pragma warning(disable : 4204) /* non-constant aggregate initializer */
 #endif
 
-static size_t s_message_pool_key = 0; /* Address of variable serves as key in hash table */
+static size_t s_message_pool_key = 0;       /* Address of variable serves as key in hash table */
+static size_t s_channel_cache_key = 0;      /* Address of variable serves as key in hash table */
+static size_t s_stats_coordinator_key = 0;  /* Address of variable serves as key in hash table */
+static size_t s_idle_service_key = 0;       /* Address of variable serves as key in hash table */
 
 enum {
     KB_16 = 16 * 1024,
 };
 
+enum {
+    /* adaptive statistics sampling: each interval with zero activity doubles a channel's reporting
+     * period, up to base << MAX_SHIFT */
+    CHANNEL_STATS_IDLE_DECAY_MAX_SHIFT = 4,
+    /* a decayed-idle channel that moves at least this many bytes is reported on the very next tick */
+    CHANNEL_STATS_ACTIVITY_REPORT_THRESHOLD = 1024,
+    /* AWS_CHANNEL_STATS_SAMPLED with no explicit rate: one channel in 100 fully instrumented */
+    CHANNEL_STATS_DEFAULT_SAMPLE_RATE = 100,
+};
+
 size_t g_aws_channel_max_fragment_size = KB_16;
 
+/* aggregate-only instrumentation: dispatch counts land in the loop coordinator's rollup
+ * (definitions live next to the coordinator, below) */
+static void s_stats_rollup_task_execution(struct aws_channel *channel);
+static void s_stats_rollup_message_processing(struct aws_channel *channel);
+
+/* shared per-loop idle-timeout service (definitions live together, below) */
+static int s_idle_service_register(struct aws_channel *channel);
+static void s_idle_service_unregister(struct aws_channel *channel);
+
 #define INITIAL_STATISTIC_LIST_SIZE 5
 
 enum aws_channel_state {
@@ -49,6 +72,56 @@ struct shutdown_task {
     bool shutdown_immediately;
 };
 
+/* Per-channel bump arena. Channel construction allocates a handful of small objects whose lifetime
+ * matches the channel's (slots, handler impls); at high connection churn, carving each from the heap
+ * and freeing each at shutdown is measurable allocator traffic. The arena bumps out of chunks and
+ * frees the chunks in one pass when the channel is destroyed; releasing an individual allocation
+ * through the arena's allocator is a no-op, so existing aws_mem_release() call sites need no
+ * changes. */
+enum {
+    CHANNEL_ARENA_CHUNK_SIZE = 4096,
+    CHANNEL_ARENA_ALIGNMENT = 16,
+};
+
+struct channel_arena_chunk {
+    struct aws_linked_list_node node;
+    size_t capacity;
+    size_t offset;
+    /* chunk storage follows the header, at the next CHANNEL_ARENA_ALIGNMENT boundary */
+};
+
+struct channel_arena {
+    struct aws_allocator bump_allocator;
+    struct aws_allocator *alloc;
+    struct aws_linked_list chunks;
+};
+
+/* Fused dispatch for linear channels. Channels are almost always a short, stable chain
+ * ([socket]->[tls]->[app]); per-message delivery through adj_left/adj_right plus a
+ * vtable load per hop costs pointer chases and indirect-branch mispredicts at high message
+ * rates. When the topology is linear and every slot has a handler, the chain is flattened
+ * into parallel arrays (slots, handlers, and the process fns side by side) so a hop is one
+ * index and one well-predicted call. Any slot insert/remove/replace or handler change
+ * invalidates the table; it is rebuilt lazily on the next delivery. */
+enum {
+    CHANNEL_FUSED_DISPATCH_MAX_SLOTS = 8,
+};
+
+struct channel_fused_dispatch {
+    bool valid;
+    size_t slot_count;
+    struct aws_channel_slot *slots[CHANNEL_FUSED_DISPATCH_MAX_SLOTS];
+    struct aws_channel_handler *handlers[CHANNEL_FUSED_DISPATCH_MAX_SLOTS];
+    int (*process_read[CHANNEL_FUSED_DISPATCH_MAX_SLOTS])(
+        struct aws_channel_handler *handler,
+        struct aws_channel_slot *slot,
+        struct aws_io_message *message);
+    int (*process_write[CHANNEL_FUSED_DISPATCH_MAX_SLOTS])(
+        struct aws_channel_handler *handler,
+        struct aws_channel_slot *slot,
+        struct aws_io_message *message);
+};
+
 struct aws_channel {
     struct aws_allocator *alloc;
     struct aws_event_loop *loop;
@@ -61,11 +134,43 @@ struct aws_channel {
     struct aws_atomic_var refcount;
     struct aws_task deletion_task;
 
-    struct aws_task statistics_task;
     struct aws_crt_statistics_handler *statistics_handler;
     uint64_t statistics_interval_start_time_ms;
     struct aws_array_list statistic_list;
 
+    /* per-channel cpu accounting (loop-thread only), reported through the statistics handler;
+     * busy_time_depth keeps nested message dispatch from being double-counted */
+    struct aws_crt_statistics_channel cpu_stats;
+    uint32_t busy_time_depth;
+
+    /* adaptive statistics sampling; all fields are loop-thread only */
+    struct aws_linked_list_node statistics_node;
+    struct channel_stats_coordinator *statistics_coordinator;
+    uint64_t statistics_base_interval_ms;
+    uint64_t statistics_next_due_ms;
+    uint64_t statistics_activity_bytes;
+    uint32_t statistics_idle_intervals;
+
+    /* instrumentation mode (see aws_channel_statistics_mode). requested_mode comes from the
+     * creation options; statistics_mode is the effective mode, resolved on first registration
+     * with the loop's coordinator (AWS_CHANNEL_STATS_SAMPLED resolves to FULL or AGGREGATE_ONLY)
+     * and then sticky, so migrating loops doesn't re-roll the sampling decision. */
+    enum aws_channel_statistics_mode statistics_requested_mode;
+    enum aws_channel_statistics_mode statistics_mode;
+    uint32_t statistics_sample_rate;
+    bool statistics_mode_resolved;
+
+    /* coarse idle-timeout service (see aws_channel_set_idle_timeout); all fields loop-thread only.
+     * idle_touched is the O(1) activity mark: the deadline is only recomputed from it when the
+     * service visits this channel's bucket. */
+    struct aws_linked_list_node idle_node;
+    struct channel_idle_service *idle_service;
+    uint64_t idle_timeout_ms;
+    uint64_t idle_deadline_ms;
+    aws_channel_on_idle_timeout_fn *on_idle_timeout;
+    void *idle_timeout_user_data;
+    bool idle_touched;
+
     struct {
         struct aws_linked_list list;
     } channel_thread_tasks;
@@ -78,11 +183,185 @@ struct aws_channel {
     } cross_thread_tasks;
 
     size_t window_update_batch_emit_threshold;
+    size_t max_fragment_size;
     struct aws_channel_task window_update_task;
     bool read_back_pressure_enabled;
     bool window_update_scheduled;
+
+    /* tick-end write flush coalescing (see enable_deferred_write_flush); loop-thread only.
+     * flush_running keeps messages produced during the flush pass itself from being re-deferred. */
+    struct aws_channel_task deferred_write_flush_task;
+    bool deferred_write_flush_enabled;
+    bool deferred_write_flush_scheduled;
+    bool deferred_write_flush_running;
+
+    /* congestion watermarks (see aws_channel_options) */
+    size_t write_queue_high_watermark;
+    size_t write_queue_low_watermark;
+    aws_channel_on_watermark_fn *on_write_watermark;
+    size_t read_window_low_watermark;
+    size_t read_window_high_watermark;
+    aws_channel_on_watermark_fn *on_read_watermark;
+    void *watermark_user_data;
+    size_t write_queue_bytes;
+    bool write_queue_congested;
+    bool read_window_congested;
+
+    struct channel_arena *arena;
+    struct aws_linked_list_node cache_node; /* linkage while parked in the per-loop channel cache */
+    struct channel_fused_dispatch fused_dispatch;
+};
+
+static void s_invalidate_fused_dispatch(struct aws_channel *channel) {
+    channel->fused_dispatch.valid = false;
+}
+
+static bool s_rebuild_fused_dispatch(struct aws_channel *channel) {
+    struct channel_fused_dispatch *dispatch = &channel->fused_dispatch;
+
+    size_t count = 0;
+    for (struct aws_channel_slot *cur = channel->first; cur; cur = cur->adj_right) {
+        if (!cur->handler || count == CHANNEL_FUSED_DISPATCH_MAX_SLOTS) {
+            return false;
+        }
+
+        cur->fused_index = count;
+        dispatch->slots[count] = cur;
+        dispatch->handlers[count] = cur->handler;
+        dispatch->process_read[count] = cur->handler->vtable->process_read_message;
+        dispatch->process_write[count] = cur->handler->vtable->process_write_message;
+        ++count;
+    }
+
+    if (count == 0) {
+        return false;
+    }
+
+    dispatch->slot_count = count;
+    dispatch->valid = true;
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_CHANNEL, "id=%p: built fused dispatch table over %zu slots.", (void *)channel, count);
+    return true;
+}
+
+/* Returns the slot's position in the dispatch table, rebuilding it if a topology change
+ * invalidated it, or SIZE_MAX if this channel can't be fused (fall back to pointer walking). */
+static size_t s_fused_dispatch_index_of(struct aws_channel *channel, struct aws_channel_slot *slot) {
+    struct channel_fused_dispatch *dispatch = &channel->fused_dispatch;
+
+    if (!dispatch->valid && !s_rebuild_fused_dispatch(channel)) {
+        return SIZE_MAX;
+    }
+
+    size_t index = slot->fused_index;
+    if (index >= dispatch->slot_count || dispatch->slots[index] != slot) {
+        return SIZE_MAX;
+    }
+
+    return index;
+}
+
+/* Recycled channel skeletons. Reconnect waves create and destroy channels on the same event loop at
+ * a high rate; since final deletion always runs on the loop thread, dead channels can be parked in
+ * event-loop local storage (the same mechanism the message pool uses) and handed back to
+ * aws_channel_new() calls made from that thread, reusing the channel struct and its arena chunk
+ * instead of going back to the heap. */
+enum {
+    CHANNEL_CACHE_MAX_PARKED = 8,
+};
+
+struct channel_cache {
+    struct aws_allocator *alloc;
+    struct aws_linked_list channels;
+    size_t count;
 };
 
+static size_t s_arena_align(size_t size) {
+    return (size + (CHANNEL_ARENA_ALIGNMENT - 1)) & ~(size_t)(CHANNEL_ARENA_ALIGNMENT - 1);
+}
+
+static void *s_arena_mem_acquire(struct aws_allocator *allocator, size_t size) {
+    struct channel_arena *arena = allocator->impl;
+    size_t aligned_size = s_arena_align(size);
+
+    struct channel_arena_chunk *chunk = NULL;
+    if (!aws_linked_list_empty(&arena->chunks)) {
+        chunk = AWS_CONTAINER_OF(aws_linked_list_front(&arena->chunks), struct channel_arena_chunk, node);
+    }
+
+    if (!chunk || chunk->capacity - chunk->offset < aligned_size) {
+        size_t chunk_capacity = aligned_size > CHANNEL_ARENA_CHUNK_SIZE ? aligned_size : CHANNEL_ARENA_CHUNK_SIZE;
+        chunk = aws_mem_acquire(arena->alloc, s_arena_align(sizeof(struct channel_arena_chunk)) + chunk_capacity);
+        if (!chunk) {
+            return NULL;
+        }
+        chunk->capacity = chunk_capacity;
+        chunk->offset = 0;
+        aws_linked_list_push_front(&arena->chunks, &chunk->node);
+    }
+
+    void *mem = (uint8_t *)chunk + s_arena_align(sizeof(struct channel_arena_chunk)) + chunk->offset;
+    chunk->offset += aligned_size;
+    return mem;
+}
+
+static void s_arena_mem_release(struct aws_allocator *allocator, void *ptr) {
+    /* arena memory is released wholesale in s_channel_arena_destroy() */
+    (void)allocator;
+    (void)ptr;
+}
+
+static void s_channel_arena_destroy(struct channel_arena *arena) {
+    if (!arena) {
+        return;
+    }
+
+    while (!aws_linked_list_empty(&arena->chunks)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&arena->chunks);
+        aws_mem_release(arena->alloc, AWS_CONTAINER_OF(node, struct channel_arena_chunk, node));
+    }
+
+    aws_mem_release(arena->alloc, arena);
+}
+
+/* prepare a parked channel's arena for reuse: keep one chunk, drop the rest */
+static void s_channel_arena_reset(struct channel_arena *arena) {
+    struct channel_arena_chunk *front = NULL;
+    while (!aws_linked_list_empty(&arena->chunks)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&arena->chunks);
+        struct channel_arena_chunk *chunk = AWS_CONTAINER_OF(node, struct channel_arena_chunk, node);
+        if (!front) {
+            front = chunk;
+        } else {
+            aws_mem_release(arena->alloc, chunk);
+        }
+    }
+
+    if (front) {
+        front->offset = 0;
+        aws_linked_list_push_front(&arena->chunks, &front->node);
+    }
+}
+
+struct aws_allocator *aws_channel_get_arena_allocator(struct aws_channel *channel) {
+    if (!channel->arena) {
+        struct channel_arena *arena = aws_mem_calloc(channel->alloc, 1, sizeof(struct channel_arena));
+        if (!arena) {
+            /* the channel's allocator is a correct stand-in: releases just become real frees */
+            return channel->alloc;
+        }
+
+        arena->alloc = channel->alloc;
+        aws_linked_list_init(&arena->chunks);
+        arena->bump_allocator.impl = arena;
+        arena->bump_allocator.mem_acquire = s_arena_mem_acquire;
+        arena->bump_allocator.mem_release = s_arena_mem_release;
+        channel->arena = arena;
+    }
+
+    return &channel->arena->bump_allocator;
+}
+
 struct channel_setup_args {
     struct aws_allocator *alloc;
     struct aws_channel *channel;
@@ -104,64 +383,108 @@ static void s_on_msg_pool_removed(struct aws_event_loop_local_object *object) {
     aws_mem_release(alloc, object);
 }
 
-static void s_on_channel_setup_complete(struct aws_task *task, void *arg, enum aws_task_status task_status) {
+/* Fetch the loop's shared message pool from local storage, creating it on first use with
+ * `creation_args` (or the channel defaults when NULL). Must be called on the loop's thread.
+ * Returns NULL on failure. */
+static struct aws_message_pool *s_fetch_or_create_message_pool(
+    struct aws_allocator *alloc,
+    struct aws_event_loop *loop,
+    const struct aws_message_pool_creation_args *creation_args) {
 
-    (void)task;
-    struct channel_setup_args *setup_args = arg;
-    struct aws_message_pool *message_pool = NULL;
-    struct aws_event_loop_local_object *local_object = NULL;
+    struct aws_event_loop_local_object stack_obj;
+    AWS_ZERO_STRUCT(stack_obj);
 
-    AWS_LOGF_DEBUG(AWS_LS_IO_CHANNEL, "id=%p: setup complete, notifying caller.", (void *)setup_args->channel);
-    if (task_status == AWS_TASK_STATUS_RUN_READY) {
-        struct aws_event_loop_local_object stack_obj;
-        AWS_ZERO_STRUCT(stack_obj);
-        local_object = &stack_obj;
+    if (!aws_event_loop_fetch_local_object(loop, &s_message_pool_key, &stack_obj)) {
+        struct aws_message_pool *message_pool = stack_obj.object;
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_CHANNEL,
+            "static: message pool %p found in event-loop local storage: using it.",
+            (void *)message_pool);
+        return message_pool;
+    }
 
-        if (aws_event_loop_fetch_local_object(setup_args->channel->loop, &s_message_pool_key, local_object)) {
+    struct aws_event_loop_local_object *local_object =
+        aws_mem_calloc(alloc, 1, sizeof(struct aws_event_loop_local_object));
+    if (!local_object) {
+        return NULL;
+    }
 
-            local_object = aws_mem_calloc(setup_args->alloc, 1, sizeof(struct aws_event_loop_local_object));
-            if (!local_object) {
-                goto cleanup_setup_args;
-            }
+    struct aws_message_pool *message_pool = aws_mem_acquire(alloc, sizeof(struct aws_message_pool));
+    if (!message_pool) {
+        goto cleanup_local_obj;
+    }
 
-            message_pool = aws_mem_acquire(setup_args->alloc, sizeof(struct aws_message_pool));
-            if (!message_pool) {
-                goto cleanup_local_obj;
-            }
+    struct aws_message_pool_creation_args default_creation_args = {
+        .application_data_msg_data_size = g_aws_channel_max_fragment_size,
+        .application_data_msg_count = 4,
+        .small_block_msg_count = 4,
+        /* sized so a socket handler's small-read acquisitions land here instead of in the
+         * full-size application-data class */
+        .small_block_msg_data_size = 512,
+        .hugepage_backed = loop->hugepage_message_pool,
+    };
+
+    if (creation_args == NULL) {
+        creation_args = &default_creation_args;
+    }
 
-            AWS_LOGF_DEBUG(
-                AWS_LS_IO_CHANNEL,
-                "id=%p: no message pool is currently stored in the event-loop "
-                "local storage, adding %p with max message size %zu, "
-                "message count 4, with 4 small blocks of 128 bytes.",
-                (void *)setup_args->channel,
-                (void *)message_pool,
-                g_aws_channel_max_fragment_size);
-
-            struct aws_message_pool_creation_args creation_args = {
-                .application_data_msg_data_size = g_aws_channel_max_fragment_size,
-                .application_data_msg_count = 4,
-                .small_block_msg_count = 4,
-                .small_block_msg_data_size = 128,
-            };
-
-            if (aws_message_pool_init(message_pool, setup_args->alloc, &creation_args)) {
-                goto cleanup_msg_pool_mem;
-            }
+    AWS_LOGF_DEBUG(
+        AWS_LS_IO_CHANNEL,
+        "static: no message pool is currently stored in the event-loop "
+        "local storage, adding %p with max message size %zu, "
+        "message count %d, with %d small blocks of %zu bytes.",
+        (void *)message_pool,
+        creation_args->application_data_msg_data_size,
+        (int)creation_args->application_data_msg_count,
+        (int)creation_args->small_block_msg_count,
+        creation_args->small_block_msg_data_size);
+
+    if (aws_message_pool_init(message_pool, alloc, creation_args)) {
+        goto cleanup_msg_pool_mem;
+    }
 
-            local_object->key = &s_message_pool_key;
-            local_object->object = message_pool;
-            local_object->on_object_removed = s_on_msg_pool_removed;
+    local_object->key = &s_message_pool_key;
+    local_object->object = message_pool;
+    local_object->on_object_removed = s_on_msg_pool_removed;
 
-            if (aws_event_loop_put_local_object(setup_args->channel->loop, local_object)) {
-                goto cleanup_msg_pool;
-            }
-        } else {
-            message_pool = local_object->object;
-            AWS_LOGF_DEBUG(
+    if (aws_event_loop_put_local_object(loop, local_object)) {
+        goto cleanup_msg_pool;
+    }
+
+    return message_pool;
+
+cleanup_msg_pool:
+    aws_message_pool_clean_up(message_pool);
+
+cleanup_msg_pool_mem:
+    aws_mem_release(alloc, message_pool);
+
+cleanup_local_obj:
+    aws_mem_release(alloc, local_object);
+    return NULL;
+}
+
+static void s_on_channel_setup_complete(struct aws_task *task, void *arg, enum aws_task_status task_status) {
+
+    (void)task;
+    struct channel_setup_args *setup_args = arg;
+
+    AWS_LOGF_DEBUG(AWS_LS_IO_CHANNEL, "id=%p: setup complete, notifying caller.", (void *)setup_args->channel);
+    if (task_status == AWS_TASK_STATUS_RUN_READY) {
+        struct aws_message_pool *message_pool =
+            s_fetch_or_create_message_pool(setup_args->alloc, setup_args->channel->loop, NULL);
+        if (!message_pool) {
+            goto cleanup_setup_args;
+        }
+
+        /* no-op unless this channel asked for fragments above the pool's base size class */
+        if (aws_message_pool_ensure_block_size(message_pool, setup_args->channel->max_fragment_size)) {
+            AWS_LOGF_WARN(
                 AWS_LS_IO_CHANNEL,
-                "id=%p: message pool %p found in event-loop local storage: using it.",
+                "id=%p: failed to add a %zu byte size class to message pool %p; "
+                "large fragments will be split at the pool's current largest class.",
                 (void *)setup_args->channel,
+                setup_args->channel->max_fragment_size,
                 (void *)message_pool);
         }
 
@@ -173,17 +496,6 @@ static void s_on_channel_setup_complete(struct aws_task *task, void *arg, enum a
         return;
     }
 
-    goto cleanup_setup_args;
-
-cleanup_msg_pool:
-    aws_message_pool_clean_up(message_pool);
-
-cleanup_msg_pool_mem:
-    aws_mem_release(setup_args->alloc, message_pool);
-
-cleanup_local_obj:
-    aws_mem_release(setup_args->alloc, local_object);
-
 cleanup_setup_args:
     setup_args->on_setup_completed(setup_args->channel, AWS_OP_ERR, setup_args->user_data);
     aws_channel_release_hold(setup_args->channel);
@@ -199,15 +511,171 @@ static void s_destroy_partially_constructed_channel(struct aws_channel *channel)
 
     aws_array_list_clean_up(&channel->statistic_list);
 
+    s_channel_arena_destroy(channel->arena);
     aws_mem_release(channel->alloc, channel);
 }
 
+static void s_on_channel_cache_removed(struct aws_event_loop_local_object *object) {
+    struct channel_cache *cache = object->object;
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_CHANNEL,
+        "static: channel cache %p has been purged from the event-loop: likely because of shutdown",
+        (void *)cache);
+
+    while (!aws_linked_list_empty(&cache->channels)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&cache->channels);
+        struct aws_channel *channel = AWS_CONTAINER_OF(node, struct aws_channel, cache_node);
+        s_channel_arena_destroy(channel->arena);
+        aws_mem_release(channel->alloc, channel);
+    }
+
+    struct aws_allocator *alloc = cache->alloc;
+    aws_mem_release(alloc, cache);
+    aws_mem_release(alloc, object);
+}
+
+/* Runs on the loop thread (final deletion is always funneled there). Returns true if the channel's
+ * memory was parked for reuse and must not be freed. */
+static bool s_try_park_channel(struct aws_channel *channel) {
+    struct aws_event_loop_local_object stack_obj;
+    AWS_ZERO_STRUCT(stack_obj);
+    struct channel_cache *cache = NULL;
+
+    if (aws_event_loop_fetch_local_object(channel->loop, &s_channel_cache_key, &stack_obj)) {
+        struct aws_event_loop_local_object *local_object =
+            aws_mem_calloc(channel->alloc, 1, sizeof(struct aws_event_loop_local_object));
+        if (!local_object) {
+            return false;
+        }
+
+        cache = aws_mem_calloc(channel->alloc, 1, sizeof(struct channel_cache));
+        if (!cache) {
+            aws_mem_release(channel->alloc, local_object);
+            return false;
+        }
+
+        cache->alloc = channel->alloc;
+        aws_linked_list_init(&cache->channels);
+
+        local_object->key = &s_channel_cache_key;
+        local_object->object = cache;
+        local_object->on_object_removed = s_on_channel_cache_removed;
+
+        if (aws_event_loop_put_local_object(channel->loop, local_object)) {
+            aws_mem_release(channel->alloc, cache);
+            aws_mem_release(channel->alloc, local_object);
+            return false;
+        }
+    } else {
+        cache = stack_obj.object;
+    }
+
+    if (cache->count >= CHANNEL_CACHE_MAX_PARKED) {
+        return false;
+    }
+
+    struct aws_allocator *alloc = channel->alloc;
+    struct aws_event_loop *loop = channel->loop;
+    struct channel_arena *arena = channel->arena;
+    if (arena) {
+        s_channel_arena_reset(arena);
+    }
+
+    AWS_ZERO_STRUCT(*channel);
+    channel->alloc = alloc;
+    channel->loop = loop;
+    channel->arena = arena;
+
+    aws_linked_list_push_front(&cache->channels, &channel->cache_node);
+    ++cache->count;
+    return true;
+}
+
+/* Hands back a zeroed channel struct, preferring a parked skeleton when called from the loop's
+ * thread (the bootstrap paths create channels from socket callbacks, which run there). */
+static struct aws_channel *s_acquire_channel_memory(struct aws_allocator *alloc, struct aws_event_loop *loop) {
+    if (aws_event_loop_thread_is_callers_thread(loop)) {
+        struct aws_event_loop_local_object stack_obj;
+        AWS_ZERO_STRUCT(stack_obj);
+        if (!aws_event_loop_fetch_local_object(loop, &s_channel_cache_key, &stack_obj)) {
+            struct channel_cache *cache = stack_obj.object;
+            if (cache->count > 0) {
+                struct aws_channel *channel =
+                    AWS_CONTAINER_OF(aws_linked_list_front(&cache->channels), struct aws_channel, cache_node);
+                /* a skeleton from a different allocator can't be handed out: its memory must
+                 * eventually go back to the allocator that produced it */
+                if (channel->alloc == alloc) {
+                    aws_linked_list_pop_front(&cache->channels);
+                    --cache->count;
+                    struct channel_arena *arena = channel->arena;
+                    AWS_ZERO_STRUCT(*channel);
+                    channel->arena = arena;
+                    AWS_LOGF_TRACE(
+                        AWS_LS_IO_CHANNEL, "static: recycling parked channel skeleton %p.", (void *)channel);
+                    return channel;
+                }
+            }
+        }
+    }
+
+    return aws_mem_calloc(alloc, 1, sizeof(struct aws_channel));
+}
+
+int aws_channel_prime_event_loop(
+    struct aws_allocator *allocator,
+    struct aws_event_loop *event_loop,
+    const struct aws_message_pool_creation_args *message_pool_creation_args,
+    size_t parked_channel_count) {
+
+    AWS_PRECONDITION(allocator);
+    AWS_PRECONDITION(event_loop);
+
+    if (!aws_event_loop_thread_is_callers_thread(event_loop)) {
+        return aws_raise_error(AWS_ERROR_IO_EVENT_LOOP_THREAD_ONLY);
+    }
+
+    if (s_fetch_or_create_message_pool(allocator, event_loop, message_pool_creation_args) == NULL) {
+        return AWS_OP_ERR;
+    }
+
+    for (size_t i = 0; i < parked_channel_count; ++i) {
+        struct aws_channel *channel = aws_mem_calloc(allocator, 1, sizeof(struct aws_channel));
+        if (!channel) {
+            return AWS_OP_ERR;
+        }
+        channel->alloc = allocator;
+        channel->loop = event_loop;
+
+        /* force the arena to own its first chunk now, so the first connection doesn't allocate it */
+        struct aws_allocator *arena_allocator = aws_channel_get_arena_allocator(channel);
+        if (channel->arena != NULL) {
+            (void)aws_mem_acquire(arena_allocator, 1);
+            s_channel_arena_reset(channel->arena);
+        }
+
+        if (!s_try_park_channel(channel)) {
+            /* the cache is already at capacity (or its storage could not be created); warm enough */
+            s_channel_arena_destroy(channel->arena);
+            aws_mem_release(allocator, channel);
+            break;
+        }
+    }
+
+    AWS_LOGF_DEBUG(
+        AWS_LS_IO_CHANNEL,
+        "static: primed event-loop %p: message pool ready, %zu channel skeleton(s) requested.",
+        (void *)event_loop,
+        parked_channel_count);
+
+    return AWS_OP_SUCCESS;
+}
+
 struct aws_channel *aws_channel_new(struct aws_allocator *alloc, const struct aws_channel_options *creation_args) {
     AWS_PRECONDITION(creation_args);
     AWS_PRECONDITION(creation_args->event_loop);
     AWS_PRECONDITION(creation_args->on_setup_completed);
 
-    struct aws_channel *channel = aws_mem_calloc(alloc, 1, sizeof(struct aws_channel));
+    struct aws_channel *channel = s_acquire_channel_memory(alloc, creation_args->event_loop);
     if (!channel) {
         return NULL;
     }
@@ -217,12 +685,29 @@ struct aws_channel *aws_channel_new(struct aws_allocator *alloc, const struct aw
     channel->loop = creation_args->event_loop;
     channel->on_shutdown_completed = creation_args->on_shutdown_completed;
     channel->shutdown_user_data = creation_args->shutdown_user_data;
+    channel->max_fragment_size =
+        creation_args->max_fragment_size != 0 ? creation_args->max_fragment_size : g_aws_channel_max_fragment_size;
+    channel->write_queue_high_watermark = creation_args->write_queue_high_watermark;
+    channel->write_queue_low_watermark = creation_args->write_queue_low_watermark;
+    channel->on_write_watermark = creation_args->on_write_watermark;
+    channel->read_window_low_watermark = creation_args->read_window_low_watermark;
+    channel->read_window_high_watermark = creation_args->read_window_high_watermark;
+    channel->on_read_watermark = creation_args->on_read_watermark;
+    channel->watermark_user_data = creation_args->watermark_user_data;
+    channel->statistics_requested_mode = creation_args->statistics_mode;
+    channel->deferred_write_flush_enabled = creation_args->enable_deferred_write_flush;
+    channel->statistics_sample_rate = creation_args->statistics_sample_rate != 0
+                                          ? creation_args->statistics_sample_rate
+                                          : CHANNEL_STATS_DEFAULT_SAMPLE_RATE;
 
     if (aws_array_list_init_dynamic(
             &channel->statistic_list, alloc, INITIAL_STATISTIC_LIST_SIZE, sizeof(struct aws_crt_statistics_base *))) {
         goto on_error;
     }
 
+    aws_crt_statistics_channel_init(&channel->cpu_stats);
+    channel->busy_time_depth = 0;
+
     /* Start refcount at 2:
      * 1 for self-reference, released from aws_channel_destroy()
      * 1 for the setup task, released when task executes */
@@ -240,9 +725,13 @@ struct aws_channel *aws_channel_new(struct aws_allocator *alloc, const struct aw
 
     if (creation_args->enable_read_back_pressure) {
         channel->read_back_pressure_enabled = true;
-        /* we probably only need room for one fragment, but let's avoid potential deadlocks
-         * on things like tls that need extra head-room. */
-        channel->window_update_batch_emit_threshold = g_aws_channel_max_fragment_size * 2;
+        if (creation_args->window_update_batch_emit_threshold != 0) {
+            channel->window_update_batch_emit_threshold = creation_args->window_update_batch_emit_threshold;
+        } else {
+            /* we probably only need room for one fragment, but let's avoid potential deadlocks
+             * on things like tls that need extra head-room. */
+            channel->window_update_batch_emit_threshold = channel->max_fragment_size * 2;
+        }
     }
 
     aws_task_init(
@@ -270,6 +759,15 @@ on_error:
 
 static void s_cleanup_slot(struct aws_channel_slot *slot) {
     if (slot) {
+        /* a slot removed/replaced before the tick-end flush ran takes its parked writes with it */
+        while (!aws_linked_list_empty(&slot->deferred_writes)) {
+            struct aws_linked_list_node *node = aws_linked_list_pop_front(&slot->deferred_writes);
+            struct aws_io_message *message = AWS_CONTAINER_OF(node, struct aws_io_message, queueing_handle);
+            if (message->on_completion) {
+                message->on_completion(slot->channel, message, AWS_ERROR_IO_OPERATION_CANCELLED, message->user_data);
+            }
+            aws_mem_release(message->allocator, message);
+        }
         if (slot->handler) {
             aws_channel_handler_destroy(slot->handler);
         }
@@ -285,7 +783,6 @@ void aws_channel_destroy(struct aws_channel *channel) {
 
 static void s_final_channel_deletion_task(struct aws_task *task, void *arg, enum aws_task_status status) {
     (void)task;
-    (void)status;
     struct aws_channel *channel = arg;
 
     struct aws_channel_slot *current = channel->first;
@@ -297,6 +794,9 @@ static void s_final_channel_deletion_task(struct aws_task *task, void *arg, enum
 
     AWS_ASSERT(channel->channel_state == AWS_CHANNEL_SHUT_DOWN);
 
+    /* channels that never went through s_shutdown_task (no valid slots) may still be armed */
+    s_idle_service_unregister(channel);
+
     while (current) {
         struct aws_channel_slot *tmp = current->adj_right;
         s_cleanup_slot(current);
@@ -307,7 +807,12 @@ static void s_final_channel_deletion_task(struct aws_task *task, void *arg, enum
 
     aws_channel_set_statistics_handler(channel, NULL);
 
-    aws_mem_release(channel->alloc, channel);
+    /* all arena-backed objects (slots, handler impls) are dead by this point; park the skeleton for
+     * reuse on this loop, unless the loop is going away (canceled task) or the cache is full */
+    if (status != AWS_TASK_STATUS_RUN_READY || !s_try_park_channel(channel)) {
+        s_channel_arena_destroy(channel->arena);
+        aws_mem_release(channel->alloc, channel);
+    }
 }
 
 void aws_channel_acquire_hold(struct aws_channel *channel) {
@@ -353,6 +858,8 @@ static void s_shutdown_task(struct aws_channel_task *task, void *arg, enum aws_t
     if (channel->channel_state < AWS_CHANNEL_SHUTTING_DOWN) {
         AWS_LOGF_DEBUG(AWS_LS_IO_CHANNEL, "id=%p: beginning shutdown process", (void *)channel);
 
+        s_idle_service_unregister(channel);
+
         struct aws_channel_slot *slot = channel->first;
         channel->channel_state = AWS_CHANNEL_SHUTTING_DOWN;
 
@@ -416,11 +923,83 @@ int aws_channel_shutdown(struct aws_channel *channel, int error_code) {
     return s_channel_shutdown(channel, error_code, false);
 }
 
+int aws_channel_shutdown_abortive(struct aws_channel *channel, int error_code) {
+    return s_channel_shutdown(channel, error_code, true);
+}
+
+void aws_channel_report_write_queue_size(struct aws_channel *channel, size_t bytes_queued) {
+    AWS_ASSERT(aws_channel_thread_is_callers_thread(channel));
+    channel->write_queue_bytes = bytes_queued;
+
+    if (!channel->on_write_watermark || channel->write_queue_high_watermark == 0) {
+        return;
+    }
+
+    if (!channel->write_queue_congested && bytes_queued >= channel->write_queue_high_watermark) {
+        channel->write_queue_congested = true;
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_CHANNEL,
+            "id=%p: write queue reached high watermark with %zu bytes queued.",
+            (void *)channel,
+            bytes_queued);
+        channel->on_write_watermark(channel, true, channel->watermark_user_data);
+    } else if (channel->write_queue_congested && bytes_queued <= channel->write_queue_low_watermark) {
+        channel->write_queue_congested = false;
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_CHANNEL,
+            "id=%p: write queue drained to low watermark with %zu bytes queued.",
+            (void *)channel,
+            bytes_queued);
+        channel->on_write_watermark(channel, false, channel->watermark_user_data);
+    }
+}
+
+size_t aws_channel_get_write_queue_size(const struct aws_channel *channel) {
+    return channel->write_queue_bytes;
+}
+
+/* checks the transport's downstream read window (the window that throttles socket reads) against
+ * the configured watermarks; called wherever that window shrinks or grows */
+static void s_check_read_window_watermark(struct aws_channel *channel) {
+    if (!channel->on_read_watermark || channel->read_window_low_watermark == 0 ||
+        !channel->read_back_pressure_enabled) {
+        return;
+    }
+
+    struct aws_channel_slot *first = channel->first;
+    if (!first || !first->adj_right) {
+        return;
+    }
+
+    size_t remaining = first->adj_right->window_size;
+    if (!channel->read_window_congested && remaining <= channel->read_window_low_watermark) {
+        channel->read_window_congested = true;
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_CHANNEL,
+            "id=%p: read window drained to low watermark with %zu bytes remaining.",
+            (void *)channel,
+            remaining);
+        channel->on_read_watermark(channel, true, channel->watermark_user_data);
+    } else if (channel->read_window_congested && remaining >= channel->read_window_high_watermark) {
+        channel->read_window_congested = false;
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_CHANNEL,
+            "id=%p: read window recovered to high watermark with %zu bytes remaining.",
+            (void *)channel,
+            remaining);
+        channel->on_read_watermark(channel, false, channel->watermark_user_data);
+    }
+}
+
 struct aws_io_message *aws_channel_acquire_message_from_pool(
     struct aws_channel *channel,
     enum aws_io_message_type message_type,
     size_t size_hint) {
 
+    /* the pool pointer is resolved from event-loop local storage exactly once, at channel setup;
+     * this path must stay a direct pool hit with no hash probe */
+    AWS_PRECONDITION(channel->msg_pool);
+
     struct aws_io_message *message = aws_message_pool_acquire(channel->msg_pool, message_type, size_hint);
 
     if (AWS_LIKELY(message)) {
@@ -439,14 +1018,20 @@ struct aws_io_message *aws_channel_acquire_message_from_pool(
 }
 
 struct aws_channel_slot *aws_channel_slot_new(struct aws_channel *channel) {
-    struct aws_channel_slot *new_slot = aws_mem_calloc(channel->alloc, 1, sizeof(struct aws_channel_slot));
+    /* slots live until the channel dies (removed slots just stop being referenced), so draw them
+     * from the channel arena; s_cleanup_slot's release becomes a no-op and the memory goes back
+     * with the channel */
+    struct aws_allocator *slot_alloc = aws_channel_get_arena_allocator(channel);
+    struct aws_channel_slot *new_slot = aws_mem_calloc(slot_alloc, 1, sizeof(struct aws_channel_slot));
     if (!new_slot) {
         return NULL;
     }
 
     AWS_LOGF_TRACE(AWS_LS_IO_CHANNEL, "id=%p: creating new slot %p.", (void *)channel, (void *)new_slot);
-    new_slot->alloc = channel->alloc;
+    s_invalidate_fused_dispatch(channel);
+    new_slot->alloc = slot_alloc;
     new_slot->channel = channel;
+    aws_linked_list_init(&new_slot->deferred_writes);
 
     if (!channel->first) {
         channel->first = new_slot;
@@ -493,7 +1078,30 @@ static void s_channel_task_run(struct aws_task *task, void *arg, enum aws_task_s
     }
 
     aws_linked_list_remove(&channel_task->node);
+
+    if (channel->statistics_handler == NULL) {
+        channel_task->task_fn(channel_task, channel_task->arg, status);
+        return;
+    }
+
+    if (channel->statistics_mode == AWS_CHANNEL_STATS_AGGREGATE_ONLY) {
+        /* no clock reads for aggregate-only channels; just count into the loop rollup */
+        channel_task->task_fn(channel_task, channel_task->arg, status);
+        s_stats_rollup_task_execution(channel);
+        return;
+    }
+
+    /* cpu accounting via the loop's clock; channel destruction is always deferred through the
+     * deletion task, so the channel outlives whatever task_fn does */
+    uint64_t start_ns = 0;
+    aws_event_loop_current_clock_time(channel->loop, &start_ns);
+
     channel_task->task_fn(channel_task, channel_task->arg, status);
+
+    uint64_t end_ns = 0;
+    aws_event_loop_current_clock_time(channel->loop, &end_ns);
+    channel->cpu_stats.task_execution_ns += end_ns - start_ns;
+    channel->cpu_stats.task_execution_count++;
 }
 
 static void s_schedule_cross_thread_tasks(struct aws_task *task, void *arg, enum aws_task_status status) {
@@ -667,9 +1275,22 @@ static void s_update_channel_slot_message_overheads(struct aws_channel *channel)
 int aws_channel_slot_set_handler(struct aws_channel_slot *slot, struct aws_channel_handler *handler) {
     slot->handler = handler;
     slot->handler->slot = slot;
+    s_invalidate_fused_dispatch(slot->channel);
     s_update_channel_slot_message_overheads(slot->channel);
 
-    return aws_channel_slot_increment_read_window(slot, slot->handler->vtable->initial_window_size(handler));
+    size_t initial_window = slot->handler->vtable->initial_window_size(handler);
+
+    /* setting a handler on the channel thread (channel setup, or the ALPN transition swapping in
+     * the negotiated handler mid-tick) pushes the initial window upstream in place rather than
+     * bouncing through the window-update task, so the first application bytes can flow in the
+     * same tick. Normal read-path increments still batch through the task. */
+    if (slot->channel->read_back_pressure_enabled && slot->channel->channel_state < AWS_CHANNEL_SHUTTING_DOWN &&
+        aws_channel_thread_is_callers_thread(slot->channel) && slot->adj_left && slot->adj_left->handler) {
+        slot->window_size = aws_add_size_saturating(slot->window_size, initial_window);
+        return aws_channel_handler_increment_read_window(slot->adj_left->handler, slot->adj_left, initial_window);
+    }
+
+    return aws_channel_slot_increment_read_window(slot, initial_window);
 }
 
 int aws_channel_slot_remove(struct aws_channel_slot *slot) {
@@ -689,6 +1310,7 @@ int aws_channel_slot_remove(struct aws_channel_slot *slot) {
         slot->channel->first = NULL;
     }
 
+    s_invalidate_fused_dispatch(slot->channel);
     s_update_channel_slot_message_overheads(slot->channel);
     s_cleanup_slot(slot);
     return AWS_OP_SUCCESS;
@@ -711,6 +1333,7 @@ int aws_channel_slot_replace(struct aws_channel_slot *remove, struct aws_channel
         remove->channel->first = new_slot;
     }
 
+    s_invalidate_fused_dispatch(remove->channel);
     s_update_channel_slot_message_overheads(remove->channel);
     s_cleanup_slot(remove);
     return AWS_OP_SUCCESS;
@@ -726,6 +1349,7 @@ int aws_channel_slot_insert_right(struct aws_channel_slot *slot, struct aws_chan
     slot->adj_right = to_add;
     to_add->adj_left = slot;
 
+    s_invalidate_fused_dispatch(slot->channel);
     return AWS_OP_SUCCESS;
 }
 
@@ -760,14 +1384,28 @@ int aws_channel_slot_insert_left(struct aws_channel_slot *slot, struct aws_chann
         slot->channel->first = to_add;
     }
 
+    s_invalidate_fused_dispatch(slot->channel);
     return AWS_OP_SUCCESS;
 }
 
-int aws_channel_slot_send_message(
+static int s_channel_slot_send_message_impl(
     struct aws_channel_slot *slot,
     struct aws_io_message *message,
     enum aws_channel_direction dir) {
 
+    AWS_IO_USDT_CHANNEL_SEND_MESSAGE(slot->channel, slot, dir, message->message_data.len);
+
+    if (slot->channel->statistics_handler != NULL &&
+        slot->channel->statistics_mode != AWS_CHANNEL_STATS_AGGREGATE_ONLY) {
+        slot->channel->statistics_activity_bytes += message->message_data.len;
+        if (slot->channel->statistics_idle_intervals > 0 &&
+            slot->channel->statistics_activity_bytes >= CHANNEL_STATS_ACTIVITY_REPORT_THRESHOLD) {
+            /* idle channel woke up: pull its report forward to the coordinator's next tick */
+            slot->channel->statistics_idle_intervals = 0;
+            slot->channel->statistics_next_due_ms = 0;
+        }
+    }
+
     if (dir == AWS_CHANNEL_DIR_READ) {
         AWS_ASSERT(slot->adj_right);
         AWS_ASSERT(slot->adj_right->handler);
@@ -783,6 +1421,18 @@ int aws_channel_slot_send_message(
                 (void *)slot->adj_right,
                 (void *)slot->adj_right->handler);
             slot->adj_right->window_size -= message->message_data.len;
+            if (slot == slot->channel->first) {
+                s_check_read_window_watermark(slot->channel);
+            }
+
+            size_t fused_index = s_fused_dispatch_index_of(slot->channel, slot);
+            if (fused_index != SIZE_MAX) {
+                struct channel_fused_dispatch *dispatch = &slot->channel->fused_dispatch;
+                size_t next = fused_index + 1;
+                AWS_ASSERT(next < dispatch->slot_count);
+                return dispatch->process_read[next](dispatch->handlers[next], dispatch->slots[next], message);
+            }
+
             return aws_channel_handler_process_read_message(slot->adj_right->handler, slot->adj_right, message);
         }
         AWS_LOGF_ERROR(
@@ -809,23 +1459,183 @@ int aws_channel_slot_send_message(
         (void *)slot,
         (void *)slot->adj_left,
         (void *)slot->adj_left->handler);
+
+    size_t fused_index = s_fused_dispatch_index_of(slot->channel, slot);
+    if (fused_index != SIZE_MAX) {
+        struct channel_fused_dispatch *dispatch = &slot->channel->fused_dispatch;
+        AWS_ASSERT(fused_index > 0);
+        size_t prev = fused_index - 1;
+        return dispatch->process_write[prev](dispatch->handlers[prev], dispatch->slots[prev], message);
+    }
+
     return aws_channel_handler_process_write_message(slot->adj_left->handler, slot->adj_left, message);
 }
 
-struct aws_io_message *aws_channel_slot_acquire_max_message_for_write(struct aws_channel_slot *slot) {
-    AWS_PRECONDITION(slot);
-    AWS_PRECONDITION(slot->channel);
+static void s_drop_deferred_writes(struct aws_channel *channel, int error_code) {
+    for (struct aws_channel_slot *slot = channel->first; slot; slot = slot->adj_right) {
+        while (!aws_linked_list_empty(&slot->deferred_writes)) {
+            struct aws_linked_list_node *node = aws_linked_list_pop_front(&slot->deferred_writes);
+            struct aws_io_message *message = AWS_CONTAINER_OF(node, struct aws_io_message, queueing_handle);
+            if (message->on_completion) {
+                message->on_completion(channel, message, error_code, message->user_data);
+            }
+            aws_mem_release(message->allocator, message);
+        }
+    }
+}
+
+static void s_deferred_write_flush_task(struct aws_channel_task *channel_task, void *arg, enum aws_task_status status) {
+    (void)channel_task;
+    struct aws_channel *channel = arg;
+
+    channel->deferred_write_flush_scheduled = false;
+
+    if (status != AWS_TASK_STATUS_RUN_READY || channel->channel_state >= AWS_CHANNEL_SHUTTING_DOWN) {
+        s_drop_deferred_writes(channel, AWS_ERROR_IO_OPERATION_CANCELLED);
+        return;
+    }
+
+    struct aws_channel_slot *slot = channel->first;
+    while (slot && slot->adj_right) {
+        slot = slot->adj_right;
+    }
+
+    /* drain right to left: write messages only ever travel leftward, so anything a draining
+     * handler defers in turn lands on a slot this pass hasn't reached yet */
+    channel->deferred_write_flush_running = true;
+    for (; slot; slot = slot->adj_left) {
+        while (!aws_linked_list_empty(&slot->deferred_writes)) {
+            struct aws_linked_list_node *node = aws_linked_list_pop_front(&slot->deferred_writes);
+            struct aws_io_message *message = AWS_CONTAINER_OF(node, struct aws_io_message, queueing_handle);
+
+            if (aws_channel_slot_send_message(slot, message, AWS_CHANNEL_DIR_WRITE)) {
+                int error_code = aws_last_error();
+                AWS_LOGF_ERROR(
+                    AWS_LS_IO_CHANNEL,
+                    "id=%p: deferred write flush failed on slot %p with error %d (%s); shutting down channel.",
+                    (void *)channel,
+                    (void *)slot,
+                    error_code,
+                    aws_error_name(error_code));
+                if (message->on_completion) {
+                    message->on_completion(channel, message, error_code, message->user_data);
+                }
+                aws_mem_release(message->allocator, message);
+                channel->deferred_write_flush_running = false;
+                s_drop_deferred_writes(channel, error_code);
+                aws_channel_shutdown(channel, error_code);
+                return;
+            }
+        }
+    }
+    channel->deferred_write_flush_running = false;
+}
+
+int aws_channel_slot_send_message(
+    struct aws_channel_slot *slot,
+    struct aws_io_message *message,
+    enum aws_channel_direction dir) {
+
+    struct aws_channel *channel = slot->channel;
+
+    if (dir == AWS_CHANNEL_DIR_WRITE && channel->deferred_write_flush_enabled &&
+        !channel->deferred_write_flush_running && channel->channel_state < AWS_CHANNEL_SHUTTING_DOWN) {
+        AWS_LOGF_TRACE(
+            AWS_LS_IO_CHANNEL,
+            "id=%p: deferring write message of size %zu on slot %p until tick end.",
+            (void *)channel,
+            message->message_data.len,
+            (void *)slot);
+        aws_linked_list_push_back(&slot->deferred_writes, &message->queueing_handle);
+
+        if (!channel->deferred_write_flush_scheduled) {
+            channel->deferred_write_flush_scheduled = true;
+            aws_channel_task_init(
+                &channel->deferred_write_flush_task, s_deferred_write_flush_task, channel, "deferred write flush task");
+            aws_channel_schedule_task_now(channel, &channel->deferred_write_flush_task);
+        }
+
+        return AWS_OP_SUCCESS;
+    }
+
+    /* cpu accounting: time the outermost dispatch only; handlers forwarding the message re-enter
+     * this function and would otherwise be counted once per hop */
+    if (channel->statistics_handler == NULL || channel->busy_time_depth > 0 ||
+        channel->statistics_mode == AWS_CHANNEL_STATS_AGGREGATE_ONLY) {
+        bool outermost = channel->busy_time_depth == 0;
+        channel->busy_time_depth++;
+        int result = s_channel_slot_send_message_impl(slot, message, dir);
+        channel->busy_time_depth--;
+        if (outermost && channel->statistics_handler != NULL) {
+            /* aggregate-only: count the dispatch into the loop rollup, without clock reads */
+            s_stats_rollup_message_processing(channel);
+        }
+        return result;
+    }
+
+    uint64_t start_ns = 0;
+    aws_event_loop_current_clock_time(channel->loop, &start_ns);
+
+    channel->busy_time_depth++;
+    int result = s_channel_slot_send_message_impl(slot, message, dir);
+    channel->busy_time_depth--;
+
+    uint64_t end_ns = 0;
+    aws_event_loop_current_clock_time(channel->loop, &end_ns);
+    channel->cpu_stats.message_processing_ns += end_ns - start_ns;
+    channel->cpu_stats.message_processing_count++;
+
+    return result;
+}
+
+int aws_channel_slot_send_broadcast_message(
+    struct aws_channel_slot *slot,
+    struct aws_io_message *shared_message,
+    aws_channel_on_message_write_completed_fn *on_completion,
+    void *user_data) {
+
+    AWS_PRECONDITION(slot);
+    AWS_PRECONDITION(slot->channel);
+    AWS_PRECONDITION(shared_message);
+    AWS_PRECONDITION(aws_channel_thread_is_callers_thread(slot->channel));
+
+    struct aws_channel *channel = slot->channel;
+
+    /* a full-range slice: one small allocation referencing the shared payload, no copy */
+    struct aws_io_message *ref_message =
+        aws_io_message_new_slice(channel->alloc, shared_message, 0, shared_message->message_data.len);
+    if (!ref_message) {
+        return AWS_OP_ERR;
+    }
+
+    ref_message->owning_channel = channel;
+    ref_message->on_completion = on_completion;
+    ref_message->user_data = user_data;
+
+    if (aws_channel_slot_send_message(slot, ref_message, AWS_CHANNEL_DIR_WRITE)) {
+        /* the reference message is ours, not the caller's; drop it so the shared payload's
+         * refcount stays balanced */
+        aws_mem_release(ref_message->allocator, ref_message);
+        return AWS_OP_ERR;
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+struct aws_io_message *aws_channel_slot_acquire_max_message_for_write(struct aws_channel_slot *slot) {
+    AWS_PRECONDITION(slot);
+    AWS_PRECONDITION(slot->channel);
     AWS_PRECONDITION(aws_channel_thread_is_callers_thread(slot->channel));
 
     const size_t overhead = aws_channel_slot_upstream_message_overhead(slot);
-    if (overhead >= g_aws_channel_max_fragment_size) {
+    if (overhead >= slot->channel->max_fragment_size) {
         AWS_LOGF_ERROR(
             AWS_LS_IO_CHANNEL, "id=%p: Upstream overhead exceeds channel's max message size.", (void *)slot->channel);
         aws_raise_error(AWS_ERROR_INVALID_STATE);
         return NULL;
     }
 
-    const size_t size_hint = g_aws_channel_max_fragment_size - overhead;
+    const size_t size_hint = slot->channel->max_fragment_size - overhead;
     return aws_channel_acquire_message_from_pool(slot->channel, AWS_IO_MESSAGE_APPLICATION_DATA, size_hint);
 }
 
@@ -860,6 +1670,8 @@ static void s_window_update_task(struct aws_channel_task *channel_task, void *ar
             }
             slot = slot->adj_left;
         }
+
+        s_check_read_window_watermark(channel);
     }
 }
 
@@ -1068,6 +1880,8 @@ struct aws_channel_slot *aws_channel_get_first_slot(struct aws_channel *channel)
 static void s_reset_statistics(struct aws_channel *channel) {
     AWS_FATAL_ASSERT(aws_channel_thread_is_callers_thread(channel));
 
+    aws_crt_statistics_channel_reset(&channel->cpu_stats);
+
     struct aws_channel_slot *current_slot = channel->first;
     while (current_slot) {
         struct aws_channel_handler *handler = current_slot->handler;
@@ -1078,22 +1892,10 @@ static void s_reset_statistics(struct aws_channel *channel) {
     }
 }
 
-static void s_channel_gather_statistics_task(struct aws_task *task, void *arg, enum aws_task_status status) {
-    if (status != AWS_TASK_STATUS_RUN_READY) {
-        return;
-    }
-
-    struct aws_channel *channel = arg;
-    if (channel->statistics_handler == NULL) {
-        return;
-    }
-
-    if (channel->channel_state == AWS_CHANNEL_SHUTTING_DOWN || channel->channel_state == AWS_CHANNEL_SHUT_DOWN) {
-        return;
-    }
-
-    uint64_t now_ns = 0;
-    if (aws_channel_current_clock_time(channel, &now_ns)) {
+/* Gather, report, and reset one channel's statistics, then adapt its next due time:
+ * each interval with zero activity doubles the period (capped), any activity snaps back to base. */
+static void s_channel_gather_statistics(struct aws_channel *channel, uint64_t now_ns) {
+    if (channel->statistics_handler == NULL || channel->statistics_mode == AWS_CHANNEL_STATS_AGGREGATE_ONLY) {
         return;
     }
 
@@ -1102,6 +1904,9 @@ static void s_channel_gather_statistics_task(struct aws_task *task, void *arg, e
     struct aws_array_list *statistics_list = &channel->statistic_list;
     aws_array_list_clear(statistics_list);
 
+    void *cpu_stats_base = &channel->cpu_stats;
+    aws_array_list_push_back(statistics_list, &cpu_stats_base);
+
     struct aws_channel_slot *current_slot = channel->first;
     while (current_slot) {
         struct aws_channel_handler *handler = current_slot->handler;
@@ -1119,15 +1924,196 @@ static void s_channel_gather_statistics_task(struct aws_task *task, void *arg, e
 
     s_reset_statistics(channel);
 
-    uint64_t reschedule_interval_ns = aws_timestamp_convert(
-        aws_crt_statistics_handler_get_report_interval_ms(channel->statistics_handler),
-        AWS_TIMESTAMP_MILLIS,
-        AWS_TIMESTAMP_NANOS,
-        NULL);
+    if (channel->statistics_activity_bytes == 0) {
+        if (channel->statistics_idle_intervals < CHANNEL_STATS_IDLE_DECAY_MAX_SHIFT) {
+            channel->statistics_idle_intervals++;
+        }
+    } else {
+        channel->statistics_idle_intervals = 0;
+    }
+    channel->statistics_activity_bytes = 0;
+    channel->statistics_next_due_ms =
+        now_ms + (channel->statistics_base_interval_ms << channel->statistics_idle_intervals);
+    channel->statistics_interval_start_time_ms = now_ms;
+}
 
-    aws_event_loop_schedule_task_future(channel->loop, task, now_ns + reschedule_interval_ns);
+/* Per-event-loop statistics coordinator. Instead of one recurring task per channel, every channel on
+ * a loop shares a single tick task that gathers whichever channels have come due. Combined with the
+ * idle decay above, a tick over a mostly-idle fleet touches only the channels that actually did work,
+ * rather than burning loop time collecting zeros from all of them. */
+struct channel_stats_coordinator {
+    struct aws_allocator *allocator;
+    struct aws_event_loop *loop;
+    struct aws_event_loop_local_object local_object;
+    struct aws_linked_list channels;
+    struct aws_task tick_task;
+    uint64_t tick_interval_ns;
+    bool tick_scheduled;
+
+    /* explicit instrumentation modes (see aws_channel_statistics_mode): decides which channel in a
+     * sampled population gets full instrumentation, and holds the rollup that aggregate-only
+     * channels count into instead of keeping per-channel state */
+    uint64_t sampled_channel_counter;
+    uint64_t full_channel_count;
+    uint64_t aggregate_channel_count;
+    struct aws_crt_statistics_channel aggregate_stats;
+};
 
-    channel->statistics_interval_start_time_ms = now_ms;
+static void s_stats_rollup_task_execution(struct aws_channel *channel) {
+    if (channel->statistics_coordinator != NULL) {
+        channel->statistics_coordinator->aggregate_stats.task_execution_count++;
+    }
+}
+
+static void s_stats_rollup_message_processing(struct aws_channel *channel) {
+    if (channel->statistics_coordinator != NULL) {
+        channel->statistics_coordinator->aggregate_stats.message_processing_count++;
+    }
+}
+
+static void s_on_stats_coordinator_removed(struct aws_event_loop_local_object *object) {
+    struct channel_stats_coordinator *coordinator = object->object;
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_CHANNEL,
+        "static: statistics coordinator %p has been purged from the event-loop",
+        (void *)coordinator);
+    aws_mem_release(coordinator->allocator, coordinator);
+}
+
+static void s_stats_coordinator_tick_task(struct aws_task *task, void *arg, enum aws_task_status status) {
+    struct channel_stats_coordinator *coordinator = arg;
+
+    if (status != AWS_TASK_STATUS_RUN_READY) {
+        coordinator->tick_scheduled = false;
+        return;
+    }
+
+    uint64_t now_ns = 0;
+    if (aws_event_loop_current_clock_time(coordinator->loop, &now_ns)) {
+        coordinator->tick_scheduled = false;
+        return;
+    }
+    uint64_t now_ms = aws_timestamp_convert(now_ns, AWS_TIMESTAMP_NANOS, AWS_TIMESTAMP_MILLIS, NULL);
+
+    /* safe iteration: processing statistics can re-enter and unregister the channel */
+    struct aws_linked_list_node *node = aws_linked_list_begin(&coordinator->channels);
+    while (node != aws_linked_list_end(&coordinator->channels)) {
+        struct aws_channel *channel = AWS_CONTAINER_OF(node, struct aws_channel, statistics_node);
+        node = aws_linked_list_next(node);
+
+        if (channel->channel_state == AWS_CHANNEL_SHUTTING_DOWN || channel->channel_state == AWS_CHANNEL_SHUT_DOWN) {
+            continue;
+        }
+
+        if (now_ms >= channel->statistics_next_due_ms) {
+            s_channel_gather_statistics(channel, now_ns);
+        }
+    }
+
+    /* aggregate-only channels never come due; with no fully instrumented channel left,
+     * the tick has nothing to do */
+    if (coordinator->full_channel_count > 0) {
+        aws_event_loop_schedule_task_future(coordinator->loop, task, now_ns + coordinator->tick_interval_ns);
+    } else {
+        coordinator->tick_scheduled = false;
+    }
+}
+
+static int s_stats_coordinator_register(struct aws_channel *channel) {
+    struct aws_event_loop *loop = channel->loop;
+    struct channel_stats_coordinator *coordinator = NULL;
+
+    struct aws_event_loop_local_object stack_obj;
+    AWS_ZERO_STRUCT(stack_obj);
+    if (!aws_event_loop_fetch_local_object(loop, &s_stats_coordinator_key, &stack_obj)) {
+        coordinator = stack_obj.object;
+    } else {
+        coordinator = aws_mem_calloc(channel->alloc, 1, sizeof(struct channel_stats_coordinator));
+        coordinator->allocator = channel->alloc;
+        coordinator->loop = loop;
+        aws_linked_list_init(&coordinator->channels);
+        aws_task_init(&coordinator->tick_task, s_stats_coordinator_tick_task, coordinator, "channel_statistics_tick");
+        coordinator->tick_interval_ns = UINT64_MAX;
+        aws_crt_statistics_channel_init(&coordinator->aggregate_stats);
+        coordinator->local_object.key = &s_stats_coordinator_key;
+        coordinator->local_object.object = coordinator;
+        coordinator->local_object.on_object_removed = s_on_stats_coordinator_removed;
+
+        if (aws_event_loop_put_local_object(loop, &coordinator->local_object)) {
+            aws_mem_release(channel->alloc, coordinator);
+            return AWS_OP_ERR;
+        }
+    }
+
+    if (!channel->statistics_mode_resolved) {
+        channel->statistics_mode = channel->statistics_requested_mode;
+        if (channel->statistics_requested_mode == AWS_CHANNEL_STATS_SAMPLED) {
+            /* every Nth channel registered on this loop gets full instrumentation */
+            channel->statistics_mode =
+                (coordinator->sampled_channel_counter++ % channel->statistics_sample_rate == 0)
+                    ? AWS_CHANNEL_STATS_FULL
+                    : AWS_CHANNEL_STATS_AGGREGATE_ONLY;
+        }
+        channel->statistics_mode_resolved = true;
+    }
+
+    aws_linked_list_push_back(&coordinator->channels, &channel->statistics_node);
+    channel->statistics_coordinator = coordinator;
+
+    if (channel->statistics_mode == AWS_CHANNEL_STATS_AGGREGATE_ONLY) {
+        /* never individually due; its dispatch counts land in the coordinator's rollup instead */
+        channel->statistics_next_due_ms = UINT64_MAX;
+        coordinator->aggregate_channel_count++;
+        return AWS_OP_SUCCESS;
+    }
+    coordinator->full_channel_count++;
+
+    uint64_t base_interval_ns =
+        aws_timestamp_convert(channel->statistics_base_interval_ms, AWS_TIMESTAMP_MILLIS, AWS_TIMESTAMP_NANOS, NULL);
+    bool needs_schedule = !coordinator->tick_scheduled;
+    if (base_interval_ns < coordinator->tick_interval_ns) {
+        coordinator->tick_interval_ns = base_interval_ns;
+        if (coordinator->tick_scheduled) {
+            /* a faster-reporting channel joined: pull the shared tick in */
+            aws_event_loop_cancel_task(loop, &coordinator->tick_task);
+            needs_schedule = true;
+        }
+    }
+
+    if (needs_schedule) {
+        uint64_t now_ns = 0;
+        if (aws_event_loop_current_clock_time(loop, &now_ns)) {
+            return AWS_OP_ERR;
+        }
+        aws_event_loop_schedule_task_future(loop, &coordinator->tick_task, now_ns + coordinator->tick_interval_ns);
+        coordinator->tick_scheduled = true;
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static void s_stats_coordinator_unregister(struct aws_channel *channel) {
+    struct channel_stats_coordinator *coordinator = channel->statistics_coordinator;
+    if (coordinator == NULL) {
+        return;
+    }
+
+    aws_linked_list_remove(&channel->statistics_node);
+    channel->statistics_coordinator = NULL;
+
+    if (channel->statistics_mode == AWS_CHANNEL_STATS_AGGREGATE_ONLY) {
+        coordinator->aggregate_channel_count--;
+    } else {
+        coordinator->full_channel_count--;
+    }
+
+    if (aws_linked_list_empty(&coordinator->channels)) {
+        if (coordinator->tick_scheduled) {
+            aws_event_loop_cancel_task(coordinator->loop, &coordinator->tick_task);
+        }
+        /* removal invokes s_on_stats_coordinator_removed, which frees the coordinator */
+        aws_event_loop_remove_local_object(coordinator->loop, &s_stats_coordinator_key, NULL);
+    }
 }
 
 int aws_channel_set_statistics_handler(struct aws_channel *channel, struct aws_crt_statistics_handler *handler) {
@@ -1135,29 +2121,30 @@ int aws_channel_set_statistics_handler(struct aws_channel *channel, struct aws_c
 
     if (channel->statistics_handler) {
         aws_crt_statistics_handler_destroy(channel->statistics_handler);
-        aws_event_loop_cancel_task(channel->loop, &channel->statistics_task);
+        s_stats_coordinator_unregister(channel);
         channel->statistics_handler = NULL;
     }
 
     if (handler != NULL) {
-        aws_task_init(&channel->statistics_task, s_channel_gather_statistics_task, channel, "gather_statistics");
-
         uint64_t now_ns = 0;
         if (aws_channel_current_clock_time(channel, &now_ns)) {
             return AWS_OP_ERR;
         }
+        uint64_t now_ms = aws_timestamp_convert(now_ns, AWS_TIMESTAMP_NANOS, AWS_TIMESTAMP_MILLIS, NULL);
 
-        uint64_t report_time_ns = now_ns + aws_timestamp_convert(
-                                               aws_crt_statistics_handler_get_report_interval_ms(handler),
-                                               AWS_TIMESTAMP_MILLIS,
-                                               AWS_TIMESTAMP_NANOS,
-                                               NULL);
-
-        channel->statistics_interval_start_time_ms =
-            aws_timestamp_convert(now_ns, AWS_TIMESTAMP_NANOS, AWS_TIMESTAMP_MILLIS, NULL);
+        channel->statistics_base_interval_ms = aws_crt_statistics_handler_get_report_interval_ms(handler);
+        channel->statistics_idle_intervals = 0;
+        channel->statistics_activity_bytes = 0;
+        channel->statistics_next_due_ms = now_ms + channel->statistics_base_interval_ms;
+        channel->statistics_interval_start_time_ms = now_ms;
         s_reset_statistics(channel);
 
-        aws_event_loop_schedule_task_future(channel->loop, &channel->statistics_task, report_time_ns);
+        channel->statistics_handler = handler;
+        if (s_stats_coordinator_register(channel)) {
+            channel->statistics_handler = NULL;
+            return AWS_OP_ERR;
+        }
+        return AWS_OP_SUCCESS;
     }
 
     channel->statistics_handler = handler;
@@ -1165,10 +2152,527 @@ int aws_channel_set_statistics_handler(struct aws_channel *channel, struct aws_c
     return AWS_OP_SUCCESS;
 }
 
+int aws_channel_fetch_aggregate_statistics(
+    struct aws_event_loop *event_loop,
+    struct aws_crt_statistics_channel *out_stats,
+    uint64_t *out_channel_count) {
+
+    AWS_PRECONDITION(event_loop);
+    AWS_PRECONDITION(out_stats);
+
+    if (!aws_event_loop_thread_is_callers_thread(event_loop)) {
+        return aws_raise_error(AWS_ERROR_IO_EVENT_LOOP_THREAD_ONLY);
+    }
+
+    aws_crt_statistics_channel_init(out_stats);
+    if (out_channel_count != NULL) {
+        *out_channel_count = 0;
+    }
+
+    struct aws_event_loop_local_object local_obj;
+    AWS_ZERO_STRUCT(local_obj);
+    if (aws_event_loop_fetch_local_object(event_loop, &s_stats_coordinator_key, &local_obj)) {
+        /* no channels registered on this loop; the rollup is empty */
+        return AWS_OP_SUCCESS;
+    }
+
+    struct channel_stats_coordinator *coordinator = local_obj.object;
+    *out_stats = coordinator->aggregate_stats;
+    if (out_channel_count != NULL) {
+        *out_channel_count = coordinator->aggregate_channel_count;
+    }
+    aws_crt_statistics_channel_reset(&coordinator->aggregate_stats);
+
+    return AWS_OP_SUCCESS;
+}
+
+/* Per-event-loop coarse idle-timeout service. Connection layers arm per-connection idle timers that
+ * are nearly always extended or cancelled before they fire; putting each one in the loop's timer
+ * heap means tens of thousands of long-dated entries churned on every touch. Here a channel's
+ * deadline lives in a hashed second-granularity bucket, one shared task ticks once per second, and
+ * activity is recorded with a flag store -- the deadline is only recomputed when the tick actually
+ * visits the channel's bucket. */
+enum {
+    CHANNEL_IDLE_BUCKET_COUNT = 64, /* power of two; timeouts longer than the wheel span just lap */
+    CHANNEL_IDLE_TICK_INTERVAL_MS = 1000,
+};
+
+struct channel_idle_service {
+    struct aws_allocator *allocator;
+    struct aws_event_loop *loop;
+    struct aws_event_loop_local_object local_object;
+    struct aws_linked_list buckets[CHANNEL_IDLE_BUCKET_COUNT];
+    struct aws_task tick_task;
+    uint64_t last_ticked_second;
+    size_t channel_count;
+    bool tick_scheduled;
+};
+
+static struct aws_linked_list *s_idle_bucket_for_deadline(struct channel_idle_service *service, uint64_t deadline_ms) {
+    return &service->buckets[(deadline_ms / CHANNEL_IDLE_TICK_INTERVAL_MS) & (CHANNEL_IDLE_BUCKET_COUNT - 1)];
+}
+
+static void s_on_idle_service_removed(struct aws_event_loop_local_object *object) {
+    struct channel_idle_service *service = object->object;
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_CHANNEL, "static: idle-timeout service %p has been purged from the event-loop", (void *)service);
+    aws_mem_release(service->allocator, service);
+}
+
+static void s_idle_service_tick_task(struct aws_task *task, void *arg, enum aws_task_status status) {
+    struct channel_idle_service *service = arg;
+
+    if (status != AWS_TASK_STATUS_RUN_READY) {
+        service->tick_scheduled = false;
+        return;
+    }
+
+    uint64_t now_ns = 0;
+    if (aws_event_loop_current_clock_time(service->loop, &now_ns)) {
+        service->tick_scheduled = false;
+        return;
+    }
+    uint64_t now_ms = aws_timestamp_convert(now_ns, AWS_TIMESTAMP_NANOS, AWS_TIMESTAMP_MILLIS, NULL);
+    uint64_t now_second = now_ms / CHANNEL_IDLE_TICK_INTERVAL_MS;
+
+    /* visit every bucket whose second has elapsed since the last tick (normally one; more if the
+     * loop stalled). A stall past a full lap means every bucket is due exactly once. */
+    uint64_t first_second = service->last_ticked_second + 1;
+    if (now_second >= first_second + CHANNEL_IDLE_BUCKET_COUNT) {
+        first_second = now_second - CHANNEL_IDLE_BUCKET_COUNT + 1;
+    }
+    if (first_second > now_second) {
+        first_second = now_second;
+    }
+
+    for (uint64_t second = first_second; second <= now_second; ++second) {
+        struct aws_linked_list *bucket = &service->buckets[second & (CHANNEL_IDLE_BUCKET_COUNT - 1)];
+
+        /* safe iteration: firing a callback can re-arm or disarm channels in this bucket */
+        struct aws_linked_list_node *node = aws_linked_list_begin(bucket);
+        while (node != aws_linked_list_end(bucket)) {
+            struct aws_channel *channel = AWS_CONTAINER_OF(node, struct aws_channel, idle_node);
+            node = aws_linked_list_next(node);
+
+            if (channel->idle_touched) {
+                /* lazy touch-to-extend: fold the activity mark into a fresh deadline now */
+                channel->idle_touched = false;
+                channel->idle_deadline_ms = now_ms + channel->idle_timeout_ms;
+            }
+
+            if (channel->idle_deadline_ms > now_ms) {
+                /* not due: either touched, or a timeout longer than the wheel span lapping around.
+                 * re-park it where its current deadline says it belongs. */
+                struct aws_linked_list *target = s_idle_bucket_for_deadline(service, channel->idle_deadline_ms);
+                if (target != bucket) {
+                    aws_linked_list_remove(&channel->idle_node);
+                    aws_linked_list_push_back(target, &channel->idle_node);
+                }
+                continue;
+            }
+
+            /* due: disarm before the callback so a re-arm from inside it starts clean */
+            aws_linked_list_remove(&channel->idle_node);
+            service->channel_count--;
+            channel->idle_service = NULL;
+            aws_channel_on_idle_timeout_fn *on_idle_timeout = channel->on_idle_timeout;
+            void *user_data = channel->idle_timeout_user_data;
+            channel->on_idle_timeout = NULL;
+            channel->idle_timeout_user_data = NULL;
+
+            AWS_LOGF_DEBUG(
+                AWS_LS_IO_CHANNEL,
+                "id=%p: idle timeout of %llums elapsed without activity",
+                (void *)channel,
+                (unsigned long long)channel->idle_timeout_ms);
+            on_idle_timeout(channel, user_data);
+        }
+    }
+
+    service->last_ticked_second = now_second;
+
+    /* an empty service stays parked on the loop (cheap, and churny fleets re-arm constantly);
+     * the tick itself stops until the next registration */
+    if (service->channel_count > 0) {
+        uint64_t interval_ns = aws_timestamp_convert(
+            CHANNEL_IDLE_TICK_INTERVAL_MS, AWS_TIMESTAMP_MILLIS, AWS_TIMESTAMP_NANOS, NULL);
+        aws_event_loop_schedule_task_future(service->loop, task, now_ns + interval_ns);
+    } else {
+        service->tick_scheduled = false;
+    }
+}
+
+static int s_idle_service_register(struct aws_channel *channel) {
+    struct aws_event_loop *loop = channel->loop;
+    struct channel_idle_service *service = NULL;
+
+    struct aws_event_loop_local_object stack_obj;
+    AWS_ZERO_STRUCT(stack_obj);
+    if (!aws_event_loop_fetch_local_object(loop, &s_idle_service_key, &stack_obj)) {
+        service = stack_obj.object;
+    } else {
+        service = aws_mem_calloc(channel->alloc, 1, sizeof(struct channel_idle_service));
+        service->allocator = channel->alloc;
+        service->loop = loop;
+        for (size_t i = 0; i < CHANNEL_IDLE_BUCKET_COUNT; ++i) {
+            aws_linked_list_init(&service->buckets[i]);
+        }
+        aws_task_init(&service->tick_task, s_idle_service_tick_task, service, "channel_idle_timeout_tick");
+        service->local_object.key = &s_idle_service_key;
+        service->local_object.object = service;
+        service->local_object.on_object_removed = s_on_idle_service_removed;
+
+        if (aws_event_loop_put_local_object(loop, &service->local_object)) {
+            aws_mem_release(channel->alloc, service);
+            return AWS_OP_ERR;
+        }
+    }
+
+    uint64_t now_ns = 0;
+    if (aws_event_loop_current_clock_time(loop, &now_ns)) {
+        return AWS_OP_ERR;
+    }
+    uint64_t now_ms = aws_timestamp_convert(now_ns, AWS_TIMESTAMP_NANOS, AWS_TIMESTAMP_MILLIS, NULL);
+
+    channel->idle_deadline_ms = now_ms + channel->idle_timeout_ms;
+    channel->idle_touched = false;
+    aws_linked_list_push_back(s_idle_bucket_for_deadline(service, channel->idle_deadline_ms), &channel->idle_node);
+    channel->idle_service = service;
+    service->channel_count++;
+
+    if (!service->tick_scheduled) {
+        service->last_ticked_second = now_ms / CHANNEL_IDLE_TICK_INTERVAL_MS;
+        uint64_t interval_ns = aws_timestamp_convert(
+            CHANNEL_IDLE_TICK_INTERVAL_MS, AWS_TIMESTAMP_MILLIS, AWS_TIMESTAMP_NANOS, NULL);
+        aws_event_loop_schedule_task_future(loop, &service->tick_task, now_ns + interval_ns);
+        service->tick_scheduled = true;
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static void s_idle_service_unregister(struct aws_channel *channel) {
+    struct channel_idle_service *service = channel->idle_service;
+    if (service == NULL) {
+        return;
+    }
+
+    aws_linked_list_remove(&channel->idle_node);
+    service->channel_count--;
+    channel->idle_service = NULL;
+}
+
+int aws_channel_set_idle_timeout(
+    struct aws_channel *channel,
+    uint64_t timeout_ms,
+    aws_channel_on_idle_timeout_fn *on_idle_timeout,
+    void *user_data) {
+
+    if (!aws_channel_thread_is_callers_thread(channel)) {
+        return aws_raise_error(AWS_ERROR_IO_EVENT_LOOP_THREAD_ONLY);
+    }
+
+    s_idle_service_unregister(channel);
+
+    if (timeout_ms == 0) {
+        return AWS_OP_SUCCESS;
+    }
+
+    if (on_idle_timeout == NULL) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    if (channel->channel_state >= AWS_CHANNEL_SHUTTING_DOWN) {
+        return aws_raise_error(AWS_ERROR_INVALID_STATE);
+    }
+
+    channel->idle_timeout_ms = timeout_ms;
+    channel->on_idle_timeout = on_idle_timeout;
+    channel->idle_timeout_user_data = user_data;
+
+    if (s_idle_service_register(channel)) {
+        channel->on_idle_timeout = NULL;
+        channel->idle_timeout_user_data = NULL;
+        return AWS_OP_ERR;
+    }
+
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_CHANNEL, "id=%p: armed idle timeout of %llums", (void *)channel, (unsigned long long)timeout_ms);
+
+    return AWS_OP_SUCCESS;
+}
+
+void aws_channel_touch_idle_timeout(struct aws_channel *channel) {
+    channel->idle_touched = true;
+}
+
 struct aws_event_loop *aws_channel_get_event_loop(struct aws_channel *channel) {
     return channel->loop;
 }
 
+/* Migration to another event loop (contract in channel.h). The move is split across two tasks: a
+ * safe-point task on the current loop's thread detaches everything loop-bound, then an attach task
+ * on the destination loop's thread re-acquires it. */
+struct channel_migration_args {
+    struct aws_allocator *alloc;
+    struct aws_channel *channel;
+    struct aws_event_loop *new_loop;
+    aws_channel_on_migration_completed_fn *on_completed;
+    void *user_data;
+    struct aws_channel_task safe_point_task;
+    struct aws_task attach_task;
+    bool rearm_idle_timeout;
+};
+
+static void s_channel_migration_complete(struct channel_migration_args *args, int error_code) {
+    struct aws_channel *channel = args->channel;
+    aws_channel_on_migration_completed_fn *on_completed = args->on_completed;
+    void *user_data = args->user_data;
+    aws_mem_release(args->alloc, args);
+
+    if (on_completed != NULL) {
+        on_completed(channel, error_code, user_data);
+    }
+}
+
+static int s_channel_attach_handlers(struct aws_channel *channel, struct aws_event_loop *loop) {
+    for (struct aws_channel_slot *slot = channel->first; slot != NULL; slot = slot->adj_right) {
+        struct aws_channel_handler *handler = slot->handler;
+        if (handler != NULL && handler->vtable->attach_to_event_loop != NULL) {
+            if (handler->vtable->attach_to_event_loop(handler, loop)) {
+                return AWS_OP_ERR;
+            }
+        }
+    }
+    return AWS_OP_SUCCESS;
+}
+
+static int s_channel_detach_handlers(struct aws_channel *channel) {
+    for (struct aws_channel_slot *slot = channel->first; slot != NULL; slot = slot->adj_right) {
+        struct aws_channel_handler *handler = slot->handler;
+        if (handler == NULL || handler->vtable->detach_from_event_loop == NULL) {
+            continue;
+        }
+        AWS_ASSERT(handler->vtable->attach_to_event_loop != NULL);
+
+        if (handler->vtable->detach_from_event_loop(handler)) {
+            int error_code = aws_last_error();
+
+            /* roll the handlers detached so far back onto the current loop */
+            for (struct aws_channel_slot *undo = channel->first; undo != slot; undo = undo->adj_right) {
+                if (undo->handler != NULL && undo->handler->vtable->detach_from_event_loop != NULL) {
+                    if (undo->handler->vtable->attach_to_event_loop(undo->handler, channel->loop)) {
+                        /* the channel can't be restored either; nothing sane left but shutting it down */
+                        aws_channel_shutdown(channel, aws_last_error());
+                        break;
+                    }
+                }
+            }
+            return aws_raise_error(error_code);
+        }
+    }
+    return AWS_OP_SUCCESS;
+}
+
+/* common exit for safe-point failures after statistics were unregistered */
+static void s_channel_migration_abort_on_source_loop(struct channel_migration_args *args, int error_code) {
+    struct aws_channel *channel = args->channel;
+
+    if (channel->statistics_handler != NULL && channel->channel_state == AWS_CHANNEL_ACTIVE) {
+        if (s_stats_coordinator_register(channel)) {
+            AWS_LOGF_WARN(
+                AWS_LS_IO_CHANNEL,
+                "id=%p: could not re-register statistics sampling after refused migration",
+                (void *)channel);
+        }
+    }
+
+    if (args->rearm_idle_timeout && channel->channel_state == AWS_CHANNEL_ACTIVE) {
+        if (s_idle_service_register(channel)) {
+            AWS_LOGF_WARN(
+                AWS_LS_IO_CHANNEL,
+                "id=%p: could not re-arm idle timeout after refused migration",
+                (void *)channel);
+        }
+    }
+
+    s_channel_migration_complete(args, error_code);
+}
+
+static void s_channel_migration_safe_point_task(
+    struct aws_channel_task *task,
+    void *arg,
+    enum aws_task_status status) {
+    (void)task;
+    struct channel_migration_args *args = arg;
+    struct aws_channel *channel = args->channel;
+
+    if (status != AWS_TASK_STATUS_RUN_READY || channel->channel_state != AWS_CHANNEL_ACTIVE) {
+        s_channel_migration_complete(args, AWS_ERROR_INVALID_STATE);
+        return;
+    }
+
+    /* Safe point means nothing else is in flight on this channel: a pending task would otherwise run
+     * on whichever loop happened to hold it when the switch occurred. The caller simply retries. */
+    if (!aws_linked_list_empty(&channel->channel_thread_tasks.list)) {
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_CHANNEL,
+            "id=%p: migration to event loop %p refused: channel tasks are pending",
+            (void *)channel,
+            (void *)args->new_loop);
+        s_channel_migration_complete(args, AWS_ERROR_INVALID_STATE);
+        return;
+    }
+
+    /* the sampling coordinator belongs to this loop; the attach task re-registers on the new one */
+    if (channel->statistics_handler != NULL) {
+        s_stats_coordinator_unregister(channel);
+    }
+
+    /* so does the idle-timeout service; the deadline restarts fresh on the destination loop */
+    args->rearm_idle_timeout = channel->idle_service != NULL;
+    s_idle_service_unregister(channel);
+
+    if (s_channel_detach_handlers(channel)) {
+        s_channel_migration_abort_on_source_loop(args, aws_last_error());
+        return;
+    }
+
+    /* Swap the loop under the cross-thread lock: producers read channel->loop while holding it, so
+     * after the unlock every new cross-thread task lands on the destination loop. A task that
+     * slipped in before the lock means we aren't quiescent after all; put everything back. */
+    bool cross_thread_tasks_pending = false;
+    aws_mutex_lock(&channel->cross_thread_tasks.lock);
+    cross_thread_tasks_pending = !aws_linked_list_empty(&channel->cross_thread_tasks.list);
+    if (!cross_thread_tasks_pending) {
+        channel->loop = args->new_loop;
+    }
+    aws_mutex_unlock(&channel->cross_thread_tasks.lock);
+
+    if (cross_thread_tasks_pending) {
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_CHANNEL,
+            "id=%p: migration to event loop %p refused: cross-thread tasks are pending",
+            (void *)channel,
+            (void *)args->new_loop);
+        if (s_channel_attach_handlers(channel, channel->loop)) {
+            aws_channel_shutdown(channel, aws_last_error());
+        }
+        s_channel_migration_abort_on_source_loop(args, AWS_ERROR_INVALID_STATE);
+        return;
+    }
+
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_CHANNEL,
+        "id=%p: detached from source loop, handing off to event loop %p",
+        (void *)channel,
+        (void *)args->new_loop);
+    aws_event_loop_schedule_task_now(args->new_loop, &args->attach_task);
+}
+
+static void s_channel_migration_attach_task(struct aws_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    struct channel_migration_args *args = arg;
+    struct aws_channel *channel = args->channel;
+
+    int error_code = 0;
+
+    if (status != AWS_TASK_STATUS_RUN_READY) {
+        /* the destination loop is going down; the channel is already detached and cannot recover */
+        error_code = AWS_ERROR_INVALID_STATE;
+        goto failed;
+    }
+
+    struct aws_message_pool *message_pool = s_fetch_or_create_message_pool(channel->alloc, channel->loop, NULL);
+    if (message_pool == NULL) {
+        error_code = aws_last_error();
+        goto failed;
+    }
+    channel->msg_pool = message_pool;
+
+    if (s_channel_attach_handlers(channel, channel->loop)) {
+        error_code = aws_last_error();
+        goto failed;
+    }
+
+    if (channel->statistics_handler != NULL) {
+        uint64_t now_ns = 0;
+        aws_channel_current_clock_time(channel, &now_ns);
+        uint64_t now_ms = aws_timestamp_convert(now_ns, AWS_TIMESTAMP_NANOS, AWS_TIMESTAMP_MILLIS, NULL);
+
+        channel->statistics_idle_intervals = 0;
+        channel->statistics_activity_bytes = 0;
+        channel->statistics_next_due_ms = now_ms + channel->statistics_base_interval_ms;
+        channel->statistics_interval_start_time_ms = now_ms;
+        if (s_stats_coordinator_register(channel)) {
+            AWS_LOGF_WARN(
+                AWS_LS_IO_CHANNEL,
+                "id=%p: could not re-register statistics sampling after migration",
+                (void *)channel);
+        }
+    }
+
+    if (args->rearm_idle_timeout) {
+        if (s_idle_service_register(channel)) {
+            AWS_LOGF_WARN(
+                AWS_LS_IO_CHANNEL, "id=%p: could not re-arm idle timeout after migration", (void *)channel);
+        }
+    }
+
+    AWS_LOGF_INFO(AWS_LS_IO_CHANNEL, "id=%p: migrated to event loop %p", (void *)channel, (void *)channel->loop);
+    s_channel_migration_complete(args, AWS_ERROR_SUCCESS);
+    return;
+
+failed:
+    aws_channel_shutdown(channel, error_code);
+    s_channel_migration_complete(args, error_code);
+}
+
+int aws_channel_migrate(
+    struct aws_channel *channel,
+    struct aws_event_loop *new_loop,
+    aws_channel_on_migration_completed_fn *on_completed,
+    void *user_data) {
+
+    AWS_PRECONDITION(channel != NULL);
+    AWS_PRECONDITION(new_loop != NULL);
+
+    if (new_loop == channel->loop) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    if (channel->channel_state != AWS_CHANNEL_ACTIVE) {
+        return aws_raise_error(AWS_ERROR_INVALID_STATE);
+    }
+
+    struct channel_migration_args *args = aws_mem_calloc(channel->alloc, 1, sizeof(struct channel_migration_args));
+    if (args == NULL) {
+        return AWS_OP_ERR;
+    }
+
+    args->alloc = channel->alloc;
+    args->channel = channel;
+    args->new_loop = new_loop;
+    args->on_completed = on_completed;
+    args->user_data = user_data;
+    aws_channel_task_init(
+        &args->safe_point_task, s_channel_migration_safe_point_task, args, "channel_migration_safe_point");
+    aws_task_init(&args->attach_task, s_channel_migration_attach_task, args, "channel_migration_attach");
+
+    AWS_LOGF_DEBUG(
+        AWS_LS_IO_CHANNEL,
+        "id=%p: migration to event loop %p requested",
+        (void *)channel,
+        (void *)new_loop);
+
+    aws_channel_schedule_task_now(channel, &args->safe_point_task);
+    return AWS_OP_SUCCESS;
+}
+
+size_t aws_channel_get_max_fragment_size(const struct aws_channel *channel) {
+    return channel->max_fragment_size;
+}
+
 int aws_channel_trigger_read(struct aws_channel *channel) {
     if (channel == NULL) {
         return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
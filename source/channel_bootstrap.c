@@ -4,14 +4,34 @@
  */
 #include <aws/io/channel_bootstrap.h>
 
+#include <aws/common/atomics.h>
+#include <aws/common/clock.h>
+#include <aws/common/hash_table.h>
+#include <aws/common/linked_list.h>
+#include <aws/common/mutex.h>
 #include <aws/common/ref_count.h>
 #include <aws/common/string.h>
 #include <aws/io/event_loop.h>
 #include <aws/io/logging.h>
+#include <aws/io/message_pool.h>
 #include <aws/io/socket.h>
 #include <aws/io/socket_channel_handler.h>
 #include <aws/io/tls_channel_handler.h>
 
+#include <stdio.h>
+
+enum {
+    /* RFC 8305 (Happy Eyeballs) connection attempt delay: each staggered connection attempt
+     * starts this long after the previous one, rather than all racing at once or each waiting
+     * out a full connect timeout. */
+    AWS_HAPPY_EYEBALLS_ATTEMPT_DELAY_MS = 250,
+
+    /* Default channel fragment size for vsock connections. Vsock has no MTU or congestion
+     * window; data moves a virtio-ring descriptor at a time, so the TCP-sized default fragment
+     * just multiplies per-message handler traversal. Bigger fragments keep the ring full. */
+    AWS_VSOCK_CHANNEL_FRAGMENT_SIZE = 256 * 1024,
+};
+
 #ifdef _MSC_VER
 /* non-constant aggregate initializer */
 #    pragma warning(disable : 4204)
@@ -111,6 +131,11 @@ struct client_channel_data {
     bool use_tls;
 };
 
+struct connection_attempt_timing {
+    struct aws_socket *socket;
+    uint64_t connect_start_timestamp_ns;
+};
+
 struct client_connection_args {
     struct aws_client_bootstrap *bootstrap;
     aws_client_bootstrap_on_channel_event_fn *creation_callback;
@@ -128,6 +153,32 @@ struct client_connection_args {
     bool enable_read_back_pressure;
     struct aws_event_loop *requested_event_loop;
 
+    /*
+     * Start-of-connect timestamps for the in-flight attempts, keyed by socket; used to report connect latency
+     * to the host resolver when an attempt wins.  Only touched from the connect event loop (or inline before
+     * any other attempt has been scheduled), so no synchronization is needed.
+     */
+    struct connection_attempt_timing *attempt_timings;
+    uint8_t attempt_timing_count;
+
+    /* Token the caller may use to abort this attempt (acquired, may be NULL). */
+    struct aws_client_connection_token *cancellation_token;
+
+    /*
+     * True when a cancellation token or overall deadline is in play. Every connection attempt is then
+     * funneled through a task on the (pinned) connect loop - no inline attempts - so the attempt-timing
+     * registry below is only ever touched from that loop's thread and cancellation can safely close
+     * whatever it finds there.
+     */
+    bool cancellation_armed;
+
+    /*
+     * Non-zero once the attempt has been cancelled (by token or overall deadline); holds the error code
+     * to report. Written from the connection's event-loop thread, read from the resolver thread as well,
+     * hence atomic.
+     */
+    struct aws_atomic_var cancel_error_code;
+
     /*
      * It is likely that all reference adjustments to the connection args take place in a single event loop
      * thread and are thus thread-safe. I can imagine some complex future scenarios where that might not hold true
@@ -160,6 +211,12 @@ static void s_client_connection_args_destroy(struct client_connection_args *args
         aws_tls_connection_options_clean_up(&args->channel_data.tls_options);
     }
 
+    if (args->attempt_timings) {
+        aws_mem_release(allocator, args->attempt_timings);
+    }
+
+    aws_client_connection_token_release(args->cancellation_token);
+
     aws_mem_release(allocator, args);
 }
 
@@ -170,6 +227,152 @@ static void s_client_connection_args_release(struct client_connection_args *args
     }
 }
 
+/* Runs on the connection's event-loop thread; tears down whichever connection phase is active. */
+static void s_client_connection_args_cancel(struct client_connection_args *args, int error_code);
+
+struct aws_client_connection_token {
+    struct aws_allocator *allocator;
+    struct aws_ref_count ref_count;
+    struct aws_mutex lock;
+    bool cancel_requested;
+    bool completed;
+    /* Bound while an attempt is in flight; holds a reference. The args -> token reference in the other
+     * direction is dropped only when the args are destroyed, so the cycle is broken here at setup time. */
+    struct client_connection_args *args;
+    struct aws_event_loop *connect_loop;
+};
+
+/* Heap-allocated so it outlives both the token and any caller; used for token cancellation
+ * and for the overall-deadline timer. */
+struct connection_cancel_task {
+    struct aws_allocator *allocator;
+    struct aws_task task;
+    struct client_connection_args *args; /* ref held */
+    int error_code;
+};
+
+static void s_connection_cancel_task_fn(struct aws_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    struct connection_cancel_task *cancel_task = arg;
+
+    if (status == AWS_TASK_STATUS_RUN_READY) {
+        s_client_connection_args_cancel(cancel_task->args, cancel_task->error_code);
+    }
+
+    s_client_connection_args_release(cancel_task->args);
+    aws_mem_release(cancel_task->allocator, cancel_task);
+}
+
+static struct connection_cancel_task *s_connection_cancel_task_new(
+    struct aws_allocator *allocator,
+    struct client_connection_args *args,
+    int error_code) {
+
+    struct connection_cancel_task *cancel_task =
+        aws_mem_calloc(allocator, 1, sizeof(struct connection_cancel_task));
+    cancel_task->allocator = allocator;
+    cancel_task->args = s_client_connection_args_acquire(args);
+    cancel_task->error_code = error_code;
+    aws_task_init(&cancel_task->task, s_connection_cancel_task_fn, cancel_task, "client_connection_cancel");
+
+    return cancel_task;
+}
+
+static void s_client_connection_token_destroy(struct aws_client_connection_token *token) {
+    AWS_ASSERT(token->args == NULL);
+    aws_mutex_clean_up(&token->lock);
+    aws_mem_release(token->allocator, token);
+}
+
+struct aws_client_connection_token *aws_client_connection_token_new(struct aws_allocator *allocator) {
+    struct aws_client_connection_token *token =
+        aws_mem_calloc(allocator, 1, sizeof(struct aws_client_connection_token));
+    token->allocator = allocator;
+    aws_ref_count_init(&token->ref_count, token, (aws_simple_completion_callback *)s_client_connection_token_destroy);
+    aws_mutex_init(&token->lock);
+
+    return token;
+}
+
+struct aws_client_connection_token *aws_client_connection_token_acquire(struct aws_client_connection_token *token) {
+    if (token != NULL) {
+        aws_ref_count_acquire(&token->ref_count);
+    }
+
+    return token;
+}
+
+void aws_client_connection_token_release(struct aws_client_connection_token *token) {
+    if (token != NULL) {
+        aws_ref_count_release(&token->ref_count);
+    }
+}
+
+void aws_client_connection_token_cancel(struct aws_client_connection_token *token) {
+    struct connection_cancel_task *cancel_task = NULL;
+    struct aws_event_loop *connect_loop = NULL;
+
+    aws_mutex_lock(&token->lock);
+    if (!token->cancel_requested && !token->completed) {
+        token->cancel_requested = true;
+        if (token->args != NULL) {
+            cancel_task = s_connection_cancel_task_new(
+                token->allocator, token->args, AWS_ERROR_IO_OPERATION_CANCELLED);
+            connect_loop = token->connect_loop;
+        }
+    }
+    aws_mutex_unlock(&token->lock);
+
+    if (cancel_task != NULL) {
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_CHANNEL_BOOTSTRAP, "token=%p: connection attempt cancellation requested", (void *)token);
+        aws_event_loop_schedule_task_now(connect_loop, &cancel_task->task);
+    }
+}
+
+/* Ties a token to the connection attempt it aborts. Fails if the token is already in use (or used up),
+ * or if it was cancelled before the attempt ever started. */
+static int s_client_connection_token_bind(
+    struct aws_client_connection_token *token,
+    struct client_connection_args *args,
+    struct aws_event_loop *connect_loop) {
+
+    int result = AWS_OP_SUCCESS;
+
+    aws_mutex_lock(&token->lock);
+    if (token->args != NULL || token->completed) {
+        result = aws_raise_error(AWS_ERROR_INVALID_STATE);
+    } else if (token->cancel_requested) {
+        result = aws_raise_error(AWS_ERROR_IO_OPERATION_CANCELLED);
+    } else {
+        token->args = s_client_connection_args_acquire(args);
+        token->connect_loop = connect_loop;
+    }
+    aws_mutex_unlock(&token->lock);
+
+    if (result == AWS_OP_SUCCESS) {
+        args->cancellation_token = aws_client_connection_token_acquire(token);
+    }
+
+    return result;
+}
+
+/* Called exactly once, when the setup callback is delivered; further cancels become no-ops. */
+static void s_client_connection_token_on_setup_complete(struct client_connection_args *args) {
+    struct aws_client_connection_token *token = args->cancellation_token;
+    if (token == NULL) {
+        return;
+    }
+
+    aws_mutex_lock(&token->lock);
+    token->completed = true;
+    struct client_connection_args *bound_args = token->args;
+    token->args = NULL;
+    aws_mutex_unlock(&token->lock);
+
+    s_client_connection_args_release(bound_args);
+}
+
 static struct aws_event_loop *s_get_connection_event_loop(struct client_connection_args *args) {
     if (args == NULL) {
         return NULL;
@@ -197,6 +400,7 @@ static void s_connect_args_setup_callback_safe(
     aws_client_bootstrap_on_channel_event_fn *setup_callback = args->setup_callback;
     setup_callback(args->bootstrap, error_code, channel, args->user_data);
     args->setup_called = true;
+    s_client_connection_token_on_setup_complete(args);
     /* if setup_callback is called with an error, we will not call shutdown_callback */
     if (error_code) {
         args->shutdown_callback = NULL;
@@ -447,11 +651,12 @@ static void s_on_client_channel_on_setup_completed(struct aws_channel *channel,
             goto error;
         }
 
+        /* the handler's lifetime matches the channel's, so draw it from the channel arena */
         struct aws_channel_handler *socket_channel_handler = aws_socket_handler_new(
-            connection_args->bootstrap->allocator,
+            aws_channel_get_arena_allocator(channel),
             connection_args->channel_data.socket,
             socket_slot,
-            g_aws_channel_max_fragment_size);
+            aws_channel_get_max_fragment_size(channel));
 
         if (!socket_channel_handler) {
             err_code = aws_last_error();
@@ -523,6 +728,60 @@ static bool s_aws_socket_domain_uses_dns(enum aws_socket_domain domain) {
     return domain == AWS_SOCKET_IPV4 || domain == AWS_SOCKET_IPV6;
 }
 
+static void s_record_connection_attempt_start(
+    struct client_connection_args *args,
+    struct aws_socket *socket,
+    struct aws_event_loop *connect_loop) {
+    if (args->attempt_timings == NULL) {
+        return;
+    }
+
+    uint64_t now = 0;
+    if (aws_event_loop_current_clock_time(connect_loop, &now)) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < args->attempt_timing_count; ++i) {
+        if (args->attempt_timings[i].socket == NULL) {
+            args->attempt_timings[i].socket = socket;
+            args->attempt_timings[i].connect_start_timestamp_ns = now;
+            return;
+        }
+    }
+}
+
+/* The timing table doubles as the registry of in-flight socket connects (for cancellation), so entries
+ * must be dropped once an attempt's callback has fired and the socket's fate is decided. */
+static void s_clear_connection_attempt_timing(struct client_connection_args *args, struct aws_socket *socket) {
+    for (uint8_t i = 0; i < args->attempt_timing_count; ++i) {
+        if (args->attempt_timings[i].socket == socket) {
+            args->attempt_timings[i].socket = NULL;
+            return;
+        }
+    }
+}
+
+/* returns 0 when no start timestamp was recorded for the socket (or the clock misbehaved) */
+static uint64_t s_get_connection_attempt_latency(struct client_connection_args *args, struct aws_socket *socket) {
+    if (args->attempt_timings == NULL) {
+        return 0;
+    }
+
+    for (uint8_t i = 0; i < args->attempt_timing_count; ++i) {
+        if (args->attempt_timings[i].socket == socket) {
+            uint64_t now = 0;
+            if (aws_event_loop_current_clock_time(aws_socket_get_event_loop(socket), &now) ||
+                now <= args->attempt_timings[i].connect_start_timestamp_ns) {
+                return 0;
+            }
+
+            return now - args->attempt_timings[i].connect_start_timestamp_ns;
+        }
+    }
+
+    return 0;
+}
+
 static void s_on_client_connection_established(struct aws_socket *socket, int error_code, void *user_data) {
     struct client_connection_args *connection_args = user_data;
 
@@ -564,6 +823,7 @@ static void s_on_client_connection_established(struct aws_socket *socket, int er
             "successful connection or because it errored out.",
             (void *)connection_args->bootstrap,
             (void *)socket);
+        s_clear_connection_attempt_timing(connection_args, socket);
         aws_socket_close(socket);
 
         aws_socket_clean_up(socket);
@@ -571,6 +831,12 @@ static void s_on_client_connection_established(struct aws_socket *socket, int er
 
         /* if this is the last attempted connection and it failed, notify the user */
         if (connection_args->failed_count == connection_args->addresses_count) {
+            /* if the attempt was cancelled, report the cancellation rather than whatever error the
+             * doomed socket happened to die with */
+            int cancel_error_code = (int)aws_atomic_load_int(&connection_args->cancel_error_code);
+            if (cancel_error_code != 0) {
+                error_code = cancel_error_code;
+            }
             AWS_LOGF_ERROR(
                 AWS_LS_IO_CHANNEL_BOOTSTRAP,
                 "id=%p: Connection failed with error_code %d.",
@@ -588,6 +854,26 @@ static void s_on_client_connection_established(struct aws_socket *socket, int er
     connection_args->connection_chosen = true;
     connection_args->channel_data.socket = socket;
 
+    if (s_aws_socket_domain_uses_dns(connection_args->outgoing_options.domain)) {
+        struct aws_host_address host_address;
+        host_address.host = connection_args->host_name;
+        host_address.address =
+            aws_string_new_from_c_str(connection_args->bootstrap->allocator, socket->remote_endpoint.address);
+        host_address.record_type =
+            socket->options.domain == AWS_SOCKET_IPV6 ? AWS_ADDRESS_RECORD_TYPE_AAAA : AWS_ADDRESS_RECORD_TYPE_A;
+
+        if (host_address.address) {
+            aws_host_resolver_record_connection_success(
+                connection_args->bootstrap->host_resolver,
+                &host_address,
+                s_get_connection_attempt_latency(connection_args, socket));
+            aws_string_destroy((void *)host_address.address);
+        }
+    }
+
+    /* the winning socket now belongs to the channel; it is no longer an in-flight attempt */
+    s_clear_connection_attempt_timing(connection_args, socket);
+
     struct aws_channel_options args = {
         .on_setup_completed = s_on_client_channel_on_setup_completed,
         .setup_user_data = connection_args,
@@ -598,6 +884,10 @@ static void s_on_client_connection_established(struct aws_socket *socket, int er
     args.enable_read_back_pressure = connection_args->enable_read_back_pressure;
     args.event_loop = aws_socket_get_event_loop(socket);
 
+    if (socket->options.domain == AWS_SOCKET_VSOCK) {
+        args.max_fragment_size = AWS_VSOCK_CHANNEL_FRAGMENT_SIZE;
+    }
+
     AWS_LOGF_TRACE(
         AWS_LS_IO_CHANNEL_BOOTSTRAP,
         "id=%p: Successful connection, creating a new channel using socket %p.",
@@ -620,6 +910,55 @@ static void s_on_client_connection_established(struct aws_socket *socket, int er
     }
 }
 
+static void s_client_connection_args_cancel(struct client_connection_args *args, int error_code) {
+    if (args->setup_called) {
+        /* the channel was already delivered (or the attempt already failed); nothing to abort */
+        return;
+    }
+
+    AWS_LOGF_DEBUG(
+        AWS_LS_IO_CHANNEL_BOOTSTRAP,
+        "id=%p: aborting in-flight connection attempt with error %d.",
+        (void *)args->bootstrap,
+        error_code);
+
+    /* pending attempt tasks and the resolver callback observe this and bail out */
+    aws_atomic_store_int(&args->cancel_error_code, (size_t)error_code);
+
+    if (args->channel_data.channel != NULL) {
+        /* the channel is being set up or TLS is negotiating; shutting it down delivers the setup callback
+         * through the normal shutdown path */
+        aws_channel_shutdown(args->channel_data.channel, error_code);
+        return;
+    }
+
+    /* Close every in-flight socket connect. Closing a connecting socket detaches its connect callback,
+     * so the failure accounting that callback would have done happens here instead. The caller of this
+     * function holds a reference on args, so releasing the per-attempt references is safe. */
+    for (uint8_t i = 0; i < args->attempt_timing_count; ++i) {
+        struct aws_socket *socket = args->attempt_timings[i].socket;
+        if (socket == NULL) {
+            continue;
+        }
+        args->attempt_timings[i].socket = NULL;
+
+        aws_socket_close(socket);
+        aws_socket_clean_up(socket);
+        aws_mem_release(args->bootstrap->allocator, socket);
+
+        args->failed_count++;
+        s_client_connection_args_release(args);
+    }
+
+    /* Staggered attempt tasks that haven't run yet still hold references and will account for themselves
+     * (as cancelled failures) when they fire; the setup callback is delivered by whichever bookkeeping
+     * path records the final failure. If resolution is still outstanding, the resolver callback delivers
+     * it instead. */
+    if (args->addresses_count > 0 && args->failed_count == args->addresses_count) {
+        s_connection_args_setup_callback(args, error_code, NULL);
+    }
+}
+
 struct connection_task_data {
     struct aws_task task;
     struct aws_socket_endpoint endpoint;
@@ -639,6 +978,26 @@ static void s_attempt_connection(struct aws_task *task, void *arg, enum aws_task
         goto task_cancelled;
     }
 
+    /* don't start a socket for an attempt the user has already cancelled */
+    int cancel_error_code = (int)aws_atomic_load_int(&task_data->args->cancel_error_code);
+    if (cancel_error_code != 0) {
+        aws_raise_error(cancel_error_code);
+        goto task_cancelled;
+    }
+
+    /* a staggered attempt may wake up after an earlier attempt has already won the race;
+     * don't waste a socket (and a SYN) on a loser */
+    if (task_data->args->connection_chosen) {
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_CHANNEL_BOOTSTRAP,
+            "id=%p: skipping connection attempt to %s: an earlier attempt already succeeded.",
+            (void *)task_data->args->bootstrap,
+            task_data->endpoint.address);
+        task_data->args->failed_count++;
+        s_client_connection_args_release(task_data->args);
+        goto cleanup_task;
+    }
+
     struct aws_socket *outgoing_socket = aws_mem_acquire(allocator, sizeof(struct aws_socket));
     if (aws_socket_init(outgoing_socket, allocator, &task_data->options)) {
         goto socket_init_failed;
@@ -654,10 +1013,15 @@ static void s_attempt_connection(struct aws_task *task, void *arg, enum aws_task
         goto socket_connect_failed;
     }
 
+    s_record_connection_attempt_start(task_data->args, outgoing_socket, task_data->connect_loop);
+
     goto cleanup_task;
 
 socket_connect_failed:
-    aws_host_resolver_record_connection_failure(task_data->args->bootstrap->host_resolver, &task_data->host_address);
+    if (s_aws_socket_domain_uses_dns(task_data->options.domain)) {
+        aws_host_resolver_record_connection_failure(
+            task_data->args->bootstrap->host_resolver, &task_data->host_address);
+    }
     aws_socket_clean_up(outgoing_socket);
 socket_init_failed:
     aws_mem_release(allocator, outgoing_socket);
@@ -710,6 +1074,18 @@ static void s_on_host_resolved(
         return;
     }
 
+    /* a DNS query can't be interrupted mid-flight; a cancel that arrived while it was outstanding
+     * takes effect here, before any socket is opened */
+    int cancel_error_code = (int)aws_atomic_load_int(&client_connection_args->cancel_error_code);
+    if (cancel_error_code != 0) {
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_CHANNEL_BOOTSTRAP,
+            "id=%p: connection attempt was cancelled while dns resolution was outstanding.",
+            (void *)client_connection_args->bootstrap);
+        s_connection_args_setup_callback(client_connection_args, cancel_error_code, NULL);
+        return;
+    }
+
     size_t host_addresses_len = aws_array_list_length(host_addresses);
     AWS_FATAL_ASSERT(host_addresses_len > 0);
     AWS_LOGF_TRACE(
@@ -722,6 +1098,40 @@ static void s_on_host_resolved(
     struct aws_event_loop *connect_loop = s_get_connection_event_loop(client_connection_args);
     client_connection_args->addresses_count = (uint8_t)host_addresses_len;
 
+    /* best effort; a failed allocation just means no latency feedback for this round of attempts */
+    client_connection_args->attempt_timings =
+        aws_mem_calloc(allocator, host_addresses_len, sizeof(struct connection_attempt_timing));
+    client_connection_args->attempt_timing_count =
+        client_connection_args->attempt_timings != NULL ? (uint8_t)host_addresses_len : 0;
+
+    /* RFC 8305 ordering: IPv6 first, then alternate families, so a broken family costs one
+     * attempt delay instead of serializing behind every address of that family */
+    AWS_VARIABLE_LENGTH_ARRAY(size_t, ipv6_indices, host_addresses_len);
+    AWS_VARIABLE_LENGTH_ARRAY(size_t, ipv4_indices, host_addresses_len);
+    size_t ipv6_count = 0;
+    size_t ipv4_count = 0;
+    for (size_t i = 0; i < host_addresses_len; ++i) {
+        struct aws_host_address *host_address_ptr = NULL;
+        aws_array_list_get_at_ptr(host_addresses, (void **)&host_address_ptr, i);
+        if (host_address_ptr->record_type == AWS_ADDRESS_RECORD_TYPE_AAAA) {
+            ipv6_indices[ipv6_count++] = i;
+        } else {
+            ipv4_indices[ipv4_count++] = i;
+        }
+    }
+
+    AWS_VARIABLE_LENGTH_ARRAY(size_t, address_order, host_addresses_len);
+    size_t order_len = 0;
+    for (size_t i = 0; i < host_addresses_len; ++i) {
+        if (i < ipv6_count) {
+            address_order[order_len++] = ipv6_indices[i];
+        }
+        if (i < ipv4_count) {
+            address_order[order_len++] = ipv4_indices[i];
+        }
+    }
+    AWS_ASSERT(order_len == host_addresses_len);
+
     /* allocate all the task data first, in case it fails... */
     AWS_VARIABLE_LENGTH_ARRAY(struct connection_task_data *, tasks, host_addresses_len);
     for (size_t i = 0; i < host_addresses_len; ++i) {
@@ -730,7 +1140,7 @@ static void s_on_host_resolved(
         bool failed = task_data == NULL;
         if (!failed) {
             struct aws_host_address *host_address_ptr = NULL;
-            aws_array_list_get_at_ptr(host_addresses, (void **)&host_address_ptr, i);
+            aws_array_list_get_at_ptr(host_addresses, (void **)&host_address_ptr, address_order[i]);
 
             task_data->endpoint.port = client_connection_args->outgoing_port;
             AWS_ASSERT(sizeof(task_data->endpoint.address) >= host_address_ptr->address->len + 1);
@@ -781,10 +1191,32 @@ static void s_on_host_resolved(
         s_client_connection_args_acquire(task_data->args);
     }
 
+    /* stagger the attempts (RFC 8305): the first goes out immediately, each subsequent one an
+     * attempt-delay later. Winners cause still-pending attempts to no-op when they run.
+     *
+     * The first attempt is made inline, right here on the resolver's thread, rather than
+     * waiting for a task hop to the connect loop: the SYN for the preferred address goes out
+     * the moment resolution produces it, overlapping the loop handoff with the TCP handshake.
+     * None of the other attempts have been scheduled yet, so the inline call can't race their
+     * accounting; its own connect callbacks land on the connect loop like everyone else's. */
+    uint64_t now = 0;
+    bool have_clock = aws_event_loop_current_clock_time(connect_loop, &now) == AWS_OP_SUCCESS;
     for (size_t i = 0; i < host_addresses_len; ++i) {
         struct connection_task_data *task_data = tasks[i];
         aws_task_init(&task_data->task, s_attempt_connection, task_data, "attempt_connection");
-        aws_event_loop_schedule_task_now(connect_loop, &task_data->task);
+        if (i == 0 && !client_connection_args->cancellation_armed) {
+            s_attempt_connection(&task_data->task, task_data, AWS_TASK_STATUS_RUN_READY);
+        } else if (!have_clock || i == 0) {
+            aws_event_loop_schedule_task_now(connect_loop, &task_data->task);
+        } else {
+            uint64_t run_at = now +
+                              aws_timestamp_convert(
+                                  (uint64_t)i * AWS_HAPPY_EYEBALLS_ATTEMPT_DELAY_MS,
+                                  AWS_TIMESTAMP_MILLIS,
+                                  AWS_TIMESTAMP_NANOS,
+                                  NULL);
+            aws_event_loop_schedule_task_future(connect_loop, &task_data->task, run_at);
+        }
     }
 }
 
@@ -859,6 +1291,45 @@ int aws_client_bootstrap_new_socket_channel(struct aws_socket_channel_bootstrap_
     client_connection_args->outgoing_port = port;
     client_connection_args->enable_read_back_pressure = options->enable_read_back_pressure;
     client_connection_args->requested_event_loop = options->requested_event_loop;
+    aws_atomic_init_int(&client_connection_args->cancel_error_code, 0);
+
+    if (options->cancellation_token != NULL || options->overall_timeout_ms > 0) {
+        /* Cancellation and the overall deadline need a loop to aim their tasks at before resolution has
+         * picked one, so pin the connection to a loop up front. */
+        client_connection_args->cancellation_armed = true;
+        if (client_connection_args->requested_event_loop == NULL) {
+            client_connection_args->requested_event_loop =
+                aws_event_loop_group_get_next_loop(bootstrap->event_loop_group);
+        }
+
+        if (options->cancellation_token != NULL &&
+            s_client_connection_token_bind(
+                options->cancellation_token,
+                client_connection_args,
+                client_connection_args->requested_event_loop)) {
+            goto error;
+        }
+
+        if (options->overall_timeout_ms > 0) {
+            uint64_t now = 0;
+            if (aws_event_loop_current_clock_time(client_connection_args->requested_event_loop, &now) ==
+                AWS_OP_SUCCESS) {
+                struct connection_cancel_task *deadline_task =
+                    s_connection_cancel_task_new(bootstrap->allocator, client_connection_args, AWS_IO_SOCKET_TIMEOUT);
+                uint64_t run_at =
+                    now +
+                    aws_timestamp_convert(
+                        options->overall_timeout_ms, AWS_TIMESTAMP_MILLIS, AWS_TIMESTAMP_NANOS, NULL);
+                aws_event_loop_schedule_task_future(
+                    client_connection_args->requested_event_loop, &deadline_task->task, run_at);
+            } else {
+                AWS_LOGF_WARN(
+                    AWS_LS_IO_CHANNEL_BOOTSTRAP,
+                    "id=%p: unable to read the event-loop clock; overall connection deadline will not be enforced.",
+                    (void *)bootstrap);
+            }
+        }
+    }
 
     if (tls_options) {
         if (aws_tls_connection_options_copy(&client_connection_args->channel_data.tls_options, tls_options)) {
@@ -930,28 +1401,55 @@ int aws_client_bootstrap_new_socket_channel(struct aws_socket_channel_bootstrap_
             endpoint.port = 0;
         }
 
-        struct aws_socket *outgoing_socket = aws_mem_acquire(bootstrap->allocator, sizeof(struct aws_socket));
+        client_connection_args->addresses_count = 1;
 
-        if (!outgoing_socket) {
-            goto error;
-        }
+        struct aws_event_loop *connect_loop = s_get_connection_event_loop(client_connection_args);
 
-        if (aws_socket_init(outgoing_socket, bootstrap->allocator, socket_options)) {
-            aws_mem_release(bootstrap->allocator, outgoing_socket);
-            goto error;
-        }
+        if (client_connection_args->cancellation_armed) {
+            /* connect from the pinned loop's thread so the attempt lands in the in-flight registry
+             * there, where cancellation can find and close it */
+            client_connection_args->attempt_timings =
+                aws_mem_calloc(bootstrap->allocator, 1, sizeof(struct connection_attempt_timing));
+            client_connection_args->attempt_timing_count = client_connection_args->attempt_timings != NULL ? 1 : 0;
 
-        client_connection_args->addresses_count = 1;
+            struct connection_task_data *task_data =
+                aws_mem_calloc(bootstrap->allocator, 1, sizeof(struct connection_task_data));
+            if (!task_data) {
+                goto error;
+            }
 
-        struct aws_event_loop *connect_loop = s_get_connection_event_loop(client_connection_args);
+            task_data->endpoint = endpoint;
+            task_data->options = *socket_options;
+            task_data->args = client_connection_args;
+            task_data->connect_loop = connect_loop;
 
-        s_client_connection_args_acquire(client_connection_args);
-        if (aws_socket_connect(
-                outgoing_socket, &endpoint, connect_loop, s_on_client_connection_established, client_connection_args)) {
-            aws_socket_clean_up(outgoing_socket);
-            aws_mem_release(client_connection_args->bootstrap->allocator, outgoing_socket);
-            s_client_connection_args_release(client_connection_args);
-            goto error;
+            s_client_connection_args_acquire(client_connection_args);
+            aws_task_init(&task_data->task, s_attempt_connection, task_data, "attempt_connection");
+            aws_event_loop_schedule_task_now(connect_loop, &task_data->task);
+        } else {
+            struct aws_socket *outgoing_socket = aws_mem_acquire(bootstrap->allocator, sizeof(struct aws_socket));
+
+            if (!outgoing_socket) {
+                goto error;
+            }
+
+            if (aws_socket_init(outgoing_socket, bootstrap->allocator, socket_options)) {
+                aws_mem_release(bootstrap->allocator, outgoing_socket);
+                goto error;
+            }
+
+            s_client_connection_args_acquire(client_connection_args);
+            if (aws_socket_connect(
+                    outgoing_socket,
+                    &endpoint,
+                    connect_loop,
+                    s_on_client_connection_established,
+                    client_connection_args)) {
+                aws_socket_clean_up(outgoing_socket);
+                aws_mem_release(client_connection_args->bootstrap->allocator, outgoing_socket);
+                s_client_connection_args_release(client_connection_args);
+                goto error;
+            }
         }
     }
 
@@ -959,6 +1457,9 @@ int aws_client_bootstrap_new_socket_channel(struct aws_socket_channel_bootstrap_
 
 error:
     if (client_connection_args) {
+        /* a synchronous failure ends the attempt; retire the token binding so the token's reference
+         * on the args is dropped and later cancels become no-ops */
+        s_client_connection_token_on_setup_complete(client_connection_args);
         /* tls opt will also be freed when we clean up the connection arg */
         s_client_connection_args_release(client_connection_args);
     }
@@ -1027,10 +1528,22 @@ struct server_connection_args {
     aws_tls_on_negotiation_result_fn *user_on_negotiation_result;
     aws_tls_on_error_fn *user_on_error;
     struct aws_task listener_destroy_task;
+    /* SO_REUSEPORT sharded mode: additional listeners bound to the same address, one per
+     * remaining loop in the group; the kernel load-balances incoming connections between them */
+    struct aws_socket *shard_listeners;
+    size_t shard_listener_count;
     void *tls_user_data;
     void *user_data;
     bool use_tls;
     bool enable_read_back_pressure;
+    bool sharded;
+    /* Handshake throttling (see aws_server_socket_channel_bootstrap_options.maximum_concurrent_handshakes).
+     * Channels on different event loops contend for handshake slots, so these fields are mutex-guarded. */
+    struct aws_mutex handshake_lock;
+    struct aws_linked_list pending_handshakes; /* of server_channel_data.handshake_queue_node */
+    size_t active_handshake_count;
+    size_t pending_handshake_count;
+    size_t maximum_concurrent_handshakes; /* 0 means unlimited */
     struct aws_ref_count ref_count;
 };
 
@@ -1038,7 +1551,13 @@ struct server_channel_data {
     struct aws_channel *channel;
     struct aws_socket *socket;
     struct server_connection_args *server_connection_args;
+    struct aws_linked_list_node handshake_queue_node;
+    struct aws_channel_task start_tls_task;
     bool incoming_called;
+    /* this channel holds one of the listener's concurrent-handshake slots */
+    bool handshake_counted;
+    /* this channel is waiting in pending_handshakes for a slot */
+    bool handshake_queued;
 };
 
 static struct server_connection_args *s_server_connection_args_acquire(struct server_connection_args *args) {
@@ -1064,6 +1583,7 @@ static void s_server_connection_args_destroy(struct server_connection_args *args
     if (args->use_tls) {
         aws_tls_connection_options_clean_up(&args->tls_options);
     }
+    aws_mutex_clean_up(&args->handshake_lock);
 
     aws_mem_release(allocator, args);
 }
@@ -1085,6 +1605,91 @@ static void s_server_incoming_callback(
     channel_data->incoming_called = true;
 }
 
+/* Tries to claim one of the listener's concurrent-handshake slots. Returns true if the handshake may start now;
+ * otherwise the channel was queued cheaply (socket accepted and channel running, TLS slot not yet driven) and its
+ * negotiation starts when an active handshake finishes. */
+static bool s_try_acquire_handshake_slot(struct server_channel_data *channel_data) {
+    struct server_connection_args *args = channel_data->server_connection_args;
+
+    if (args->maximum_concurrent_handshakes == 0) {
+        return true;
+    }
+
+    bool acquired = false;
+    aws_mutex_lock(&args->handshake_lock);
+    if (args->active_handshake_count < args->maximum_concurrent_handshakes) {
+        args->active_handshake_count++;
+        channel_data->handshake_counted = true;
+        acquired = true;
+    } else {
+        aws_linked_list_push_back(&args->pending_handshakes, &channel_data->handshake_queue_node);
+        channel_data->handshake_queued = true;
+        args->pending_handshake_count++;
+    }
+    aws_mutex_unlock(&args->handshake_lock);
+
+    if (!acquired) {
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_CHANNEL_BOOTSTRAP,
+            "id=%p: concurrent handshake limit reached, queuing TLS negotiation for channel %p",
+            (void *)args->bootstrap,
+            (void *)channel_data->channel);
+    }
+
+    return acquired;
+}
+
+/* Releases this channel's handshake slot, or removes it from the queue if its negotiation never started, and
+ * kicks off the next queued handshake if one is waiting. Called both when negotiation completes and when the
+ * channel shuts down, whichever comes first; only the first call has any effect. */
+static void s_release_handshake_slot(struct server_channel_data *channel_data) {
+    struct server_connection_args *args = channel_data->server_connection_args;
+
+    if (args->maximum_concurrent_handshakes == 0) {
+        return;
+    }
+
+    struct server_channel_data *next = NULL;
+    aws_mutex_lock(&args->handshake_lock);
+    if (channel_data->handshake_queued) {
+        aws_linked_list_remove(&channel_data->handshake_queue_node);
+        channel_data->handshake_queued = false;
+        args->pending_handshake_count--;
+    }
+    if (channel_data->handshake_counted) {
+        channel_data->handshake_counted = false;
+        args->active_handshake_count--;
+        if (!aws_linked_list_empty(&args->pending_handshakes)) {
+            struct aws_linked_list_node *node = aws_linked_list_pop_front(&args->pending_handshakes);
+            next = AWS_CONTAINER_OF(node, struct server_channel_data, handshake_queue_node);
+            next->handshake_queued = false;
+            next->handshake_counted = true;
+            args->active_handshake_count++;
+            args->pending_handshake_count--;
+        }
+    }
+    aws_mutex_unlock(&args->handshake_lock);
+
+    if (next != NULL) {
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_CHANNEL_BOOTSTRAP,
+            "id=%p: starting queued TLS negotiation on channel %p",
+            (void *)args->bootstrap,
+            (void *)next->channel);
+        /* negotiation must be driven from the channel's own event-loop thread */
+        aws_channel_schedule_task_now(next->channel, &next->start_tls_task);
+    }
+}
+
+size_t aws_server_bootstrap_listener_get_queued_handshake_count(struct aws_socket *listener) {
+    struct server_connection_args *args = AWS_CONTAINER_OF(listener, struct server_connection_args, listener);
+
+    aws_mutex_lock(&args->handshake_lock);
+    size_t count = args->pending_handshake_count;
+    aws_mutex_unlock(&args->handshake_lock);
+    return count;
+}
+
 static void s_tls_server_on_negotiation_result(
     struct aws_channel_handler *handler,
     struct aws_channel_slot *slot,
@@ -1093,6 +1698,9 @@ static void s_tls_server_on_negotiation_result(
     struct server_channel_data *channel_data = user_data;
     struct server_connection_args *connection_args = channel_data->server_connection_args;
 
+    /* free this channel's handshake slot as soon as the asymmetric crypto is done */
+    s_release_handshake_slot(channel_data);
+
     if (connection_args->user_on_negotiation_result) {
         connection_args->user_on_negotiation_result(handler, slot, err_code, connection_args->tls_user_data);
     }
@@ -1226,6 +1834,21 @@ static inline int s_setup_server_tls(struct server_channel_data *channel_data, s
     return AWS_OP_SUCCESS;
 }
 
+/* Drives TLS negotiation on a channel that was queued behind the listener's concurrent-handshake limit. */
+static void s_start_queued_handshake_task(struct aws_channel_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    struct server_channel_data *channel_data = arg;
+
+    if (status != AWS_TASK_STATUS_RUN_READY) {
+        /* channel is going away; its shutdown path releases the handshake slot */
+        return;
+    }
+
+    if (s_setup_server_tls(channel_data, channel_data->channel)) {
+        aws_channel_shutdown(channel_data->channel, aws_last_error());
+    }
+}
+
 static void s_on_server_channel_on_setup_completed(struct aws_channel *channel, int error_code, void *user_data) {
     struct server_channel_data *channel_data = user_data;
 
@@ -1263,11 +1886,12 @@ static void s_on_server_channel_on_setup_completed(struct aws_channel *channel,
         goto error;
     }
 
+    /* the handler's lifetime matches the channel's, so draw it from the channel arena */
     struct aws_channel_handler *socket_channel_handler = aws_socket_handler_new(
-        channel_data->server_connection_args->bootstrap->allocator,
+        aws_channel_get_arena_allocator(channel),
         channel_data->socket,
         socket_slot,
-        g_aws_channel_max_fragment_size);
+        aws_channel_get_max_fragment_size(channel));
 
     if (!socket_channel_handler) {
         err_code = aws_last_error();
@@ -1291,11 +1915,16 @@ static void s_on_server_channel_on_setup_completed(struct aws_channel *channel,
     }
 
     if (channel_data->server_connection_args->use_tls) {
+        aws_channel_task_init(
+            &channel_data->start_tls_task, s_start_queued_handshake_task, channel_data, "server_queued_tls_handshake");
+
         /* incoming callback will be invoked upon the negotiation completion so don't do it
          * here. */
-        if (s_setup_server_tls(channel_data, channel)) {
-            err_code = aws_last_error();
-            goto error;
+        if (s_try_acquire_handshake_slot(channel_data)) {
+            if (s_setup_server_tls(channel_data, channel)) {
+                err_code = aws_last_error();
+                goto error;
+            }
         }
     } else {
         s_server_incoming_callback(channel_data, AWS_OP_SUCCESS, channel);
@@ -1310,6 +1939,10 @@ error:
 static void s_on_server_channel_on_shutdown(struct aws_channel *channel, int error_code, void *user_data) {
     struct server_channel_data *channel_data = user_data;
     struct server_connection_args *args = channel_data->server_connection_args;
+
+    /* covers channels that die while queued or mid-handshake; a no-op if negotiation already released the slot */
+    s_release_handshake_slot(channel_data);
+
     AWS_LOGF_DEBUG(
         AWS_LS_IO_CHANNEL_BOOTSTRAP,
         "id=%p: channel %p shutdown with error %d.",
@@ -1368,8 +2001,12 @@ void s_on_server_connection_result(
         channel_data->socket = new_socket;
         channel_data->server_connection_args = connection_args;
 
+        /* sharded listeners each live on their own loop; keeping the channel there avoids the
+         * cross-loop handoff entirely */
         struct aws_event_loop *event_loop =
-            aws_event_loop_group_get_next_loop(connection_args->bootstrap->event_loop_group);
+            connection_args->sharded
+                ? socket->event_loop
+                : aws_event_loop_group_get_next_loop(connection_args->bootstrap->event_loop_group);
 
         struct aws_channel_options channel_args = {
             .on_setup_completed = s_on_server_channel_on_setup_completed,
@@ -1381,6 +2018,10 @@ void s_on_server_connection_result(
         channel_args.event_loop = event_loop;
         channel_args.enable_read_back_pressure = channel_data->server_connection_args->enable_read_back_pressure;
 
+        if (new_socket->options.domain == AWS_SOCKET_VSOCK) {
+            channel_args.max_fragment_size = AWS_VSOCK_CHANNEL_FRAGMENT_SIZE;
+        }
+
         if (aws_socket_assign_to_event_loop(new_socket, event_loop)) {
             aws_mem_release(connection_args->bootstrap->allocator, (void *)channel_data);
             goto error_cleanup;
@@ -1415,17 +2056,70 @@ static void s_listener_destroy_task(struct aws_task *task, void *arg, enum aws_t
     (void)task;
     struct server_connection_args *server_connection_args = arg;
 
+    /* shard listeners live on other loops; stop_accept marshals to each one and blocks until
+     * the unsubscribe completes, which is safe because those loops progress independently */
+    for (size_t i = 0; i < server_connection_args->shard_listener_count; ++i) {
+        struct aws_socket *shard = &server_connection_args->shard_listeners[i];
+        aws_socket_stop_accept(shard);
+        aws_socket_clean_up(shard);
+    }
+    if (server_connection_args->shard_listeners) {
+        aws_mem_release(server_connection_args->bootstrap->allocator, server_connection_args->shard_listeners);
+        server_connection_args->shard_listeners = NULL;
+        server_connection_args->shard_listener_count = 0;
+    }
+
     aws_socket_stop_accept(&server_connection_args->listener);
     aws_socket_clean_up(&server_connection_args->listener);
     s_server_connection_args_release(server_connection_args);
 }
 
-struct aws_socket *aws_server_bootstrap_new_socket_listener(
+/* Copies tls_options into the connection args, wrapping any user-installed callbacks with the
+ * bootstrap's proxies. */
+static int s_server_connection_args_setup_tls(
+    struct server_connection_args *server_connection_args,
     const struct aws_server_socket_channel_bootstrap_options *bootstrap_options) {
-    AWS_PRECONDITION(bootstrap_options);
-    AWS_PRECONDITION(bootstrap_options->bootstrap);
-    AWS_PRECONDITION(bootstrap_options->incoming_callback);
-    AWS_PRECONDITION(bootstrap_options->shutdown_callback);
+    AWS_LOGF_INFO(AWS_LS_IO_CHANNEL_BOOTSTRAP, "id=%p: using tls on listener", (void *)bootstrap_options->tls_options);
+    if (aws_tls_connection_options_copy(&server_connection_args->tls_options, bootstrap_options->tls_options)) {
+        return AWS_OP_ERR;
+    }
+
+    server_connection_args->use_tls = true;
+
+    server_connection_args->tls_user_data = bootstrap_options->tls_options->user_data;
+
+    /* in order to honor any callbacks a user may have installed on their tls_connection_options,
+     * we need to wrap them if they were set.*/
+    if (bootstrap_options->bootstrap->on_protocol_negotiated) {
+        server_connection_args->tls_options.advertise_alpn_message = true;
+    }
+
+    if (bootstrap_options->tls_options->on_data_read) {
+        server_connection_args->user_on_data_read = bootstrap_options->tls_options->on_data_read;
+        server_connection_args->tls_options.on_data_read = s_tls_server_on_data_read;
+    }
+
+    if (bootstrap_options->tls_options->on_error) {
+        server_connection_args->user_on_error = bootstrap_options->tls_options->on_error;
+        server_connection_args->tls_options.on_error = s_tls_server_on_error;
+    }
+
+    if (bootstrap_options->tls_options->on_negotiation_result) {
+        server_connection_args->user_on_negotiation_result = bootstrap_options->tls_options->on_negotiation_result;
+    }
+
+    server_connection_args->tls_options.on_negotiation_result = s_tls_server_on_negotiation_result;
+    server_connection_args->tls_options.user_data = server_connection_args;
+
+    return AWS_OP_SUCCESS;
+}
+
+struct aws_socket *aws_server_bootstrap_new_socket_listener(
+    const struct aws_server_socket_channel_bootstrap_options *bootstrap_options) {
+    AWS_PRECONDITION(bootstrap_options);
+    AWS_PRECONDITION(bootstrap_options->bootstrap);
+    AWS_PRECONDITION(bootstrap_options->incoming_callback);
+    AWS_PRECONDITION(bootstrap_options->shutdown_callback);
 
     struct server_connection_args *server_connection_args =
         aws_mem_calloc(bootstrap_options->bootstrap->allocator, 1, sizeof(struct server_connection_args));
@@ -1452,6 +2146,9 @@ struct aws_socket *aws_server_bootstrap_new_socket_listener(
     server_connection_args->destroy_callback = bootstrap_options->destroy_callback;
     server_connection_args->on_protocol_negotiated = bootstrap_options->bootstrap->on_protocol_negotiated;
     server_connection_args->enable_read_back_pressure = bootstrap_options->enable_read_back_pressure;
+    server_connection_args->maximum_concurrent_handshakes = bootstrap_options->maximum_concurrent_handshakes;
+    aws_mutex_init(&server_connection_args->handshake_lock);
+    aws_linked_list_init(&server_connection_args->pending_handshakes);
 
     aws_task_init(
         &server_connection_args->listener_destroy_task,
@@ -1460,47 +2157,31 @@ struct aws_socket *aws_server_bootstrap_new_socket_listener(
         "listener socket destroy");
 
     if (bootstrap_options->tls_options) {
-        AWS_LOGF_INFO(
-            AWS_LS_IO_CHANNEL_BOOTSTRAP, "id=%p: using tls on listener", (void *)bootstrap_options->tls_options);
-        if (aws_tls_connection_options_copy(&server_connection_args->tls_options, bootstrap_options->tls_options)) {
+        if (s_server_connection_args_setup_tls(server_connection_args, bootstrap_options)) {
             goto cleanup_server_connection_args;
         }
+    }
 
-        server_connection_args->use_tls = true;
-
-        server_connection_args->tls_user_data = bootstrap_options->tls_options->user_data;
-
-        /* in order to honor any callbacks a user may have installed on their tls_connection_options,
-         * we need to wrap them if they were set.*/
-        if (bootstrap_options->bootstrap->on_protocol_negotiated) {
-            server_connection_args->tls_options.advertise_alpn_message = true;
-        }
-
-        if (bootstrap_options->tls_options->on_data_read) {
-            server_connection_args->user_on_data_read = bootstrap_options->tls_options->on_data_read;
-            server_connection_args->tls_options.on_data_read = s_tls_server_on_data_read;
-        }
-
-        if (bootstrap_options->tls_options->on_error) {
-            server_connection_args->user_on_error = bootstrap_options->tls_options->on_error;
-            server_connection_args->tls_options.on_error = s_tls_server_on_error;
-        }
-
-        if (bootstrap_options->tls_options->on_negotiation_result) {
-            server_connection_args->user_on_negotiation_result = bootstrap_options->tls_options->on_negotiation_result;
-        }
+    struct aws_event_loop_group *el_group = bootstrap_options->bootstrap->event_loop_group;
+    size_t group_loop_count = aws_event_loop_group_get_loop_count(el_group);
 
-        server_connection_args->tls_options.on_negotiation_result = s_tls_server_on_negotiation_result;
-        server_connection_args->tls_options.user_data = server_connection_args;
+    struct aws_socket_options listener_socket_options = *bootstrap_options->socket_options;
+    server_connection_args->sharded = bootstrap_options->enable_reuseport_sharding && group_loop_count > 1 &&
+                                      listener_socket_options.type == AWS_SOCKET_STREAM;
+    if (server_connection_args->sharded) {
+        listener_socket_options.reuse_port = true;
     }
 
-    struct aws_event_loop *connection_loop =
-        aws_event_loop_group_get_next_loop(bootstrap_options->bootstrap->event_loop_group);
+    /* in sharded mode every loop gets exactly one listener, so walk the group in order instead of
+     * drawing loops from the load balancer */
+    struct aws_event_loop *connection_loop = server_connection_args->sharded
+                                                 ? aws_event_loop_group_get_loop_at(el_group, 0)
+                                                 : aws_event_loop_group_get_next_loop(el_group);
 
     if (aws_socket_init(
             &server_connection_args->listener,
             bootstrap_options->bootstrap->allocator,
-            bootstrap_options->socket_options)) {
+            &listener_socket_options)) {
         goto cleanup_server_connection_args;
     }
 
@@ -1530,6 +2211,51 @@ struct aws_socket *aws_server_bootstrap_new_socket_listener(
         goto cleanup_listener;
     }
 
+    if (server_connection_args->sharded) {
+        /* shards bind the resolved address, so a port-0 request shards onto the right port */
+        struct aws_socket_endpoint bound_endpoint = endpoint;
+        aws_socket_get_bound_address(&server_connection_args->listener, &bound_endpoint);
+
+        server_connection_args->shard_listeners = aws_mem_calloc(
+            bootstrap_options->bootstrap->allocator, group_loop_count - 1, sizeof(struct aws_socket));
+
+        /* shard failures are soft: the kernel keeps balancing across whatever listeners exist,
+         * so a partially sharded listener still beats tearing the whole thing down */
+        for (size_t i = 1; server_connection_args->shard_listeners != NULL && i < group_loop_count; ++i) {
+            struct aws_socket *shard =
+                &server_connection_args->shard_listeners[server_connection_args->shard_listener_count];
+
+            if (aws_socket_init(shard, bootstrap_options->bootstrap->allocator, &listener_socket_options)) {
+                break;
+            }
+
+            if (aws_socket_bind(shard, &bound_endpoint) || aws_socket_listen(shard, 1024) ||
+                aws_socket_start_accept(
+                    shard,
+                    aws_event_loop_group_get_loop_at(el_group, i),
+                    s_on_server_connection_result,
+                    server_connection_args)) {
+                AWS_LOGF_WARN(
+                    AWS_LS_IO_CHANNEL_BOOTSTRAP,
+                    "id=%p: failed to set up shard listener %zu (%s), continuing with %zu",
+                    (void *)bootstrap_options->bootstrap,
+                    i,
+                    aws_error_str(aws_last_error()),
+                    server_connection_args->shard_listener_count + 1);
+                aws_socket_clean_up(shard);
+                break;
+            }
+
+            server_connection_args->shard_listener_count++;
+        }
+
+        AWS_LOGF_INFO(
+            AWS_LS_IO_CHANNEL_BOOTSTRAP,
+            "id=%p: listener sharded across %zu SO_REUSEPORT sockets",
+            (void *)bootstrap_options->bootstrap,
+            server_connection_args->shard_listener_count + 1);
+    }
+
     return &server_connection_args->listener;
 
 cleanup_listener:
@@ -1541,6 +2267,60 @@ cleanup_server_connection_args:
     return NULL;
 }
 
+int aws_server_bootstrap_setup_socket_channel(
+    const struct aws_server_socket_channel_bootstrap_options *bootstrap_options,
+    struct aws_socket *socket) {
+    AWS_PRECONDITION(bootstrap_options);
+    AWS_PRECONDITION(bootstrap_options->bootstrap);
+    AWS_PRECONDITION(bootstrap_options->incoming_callback);
+    AWS_PRECONDITION(bootstrap_options->shutdown_callback);
+    AWS_PRECONDITION(socket);
+
+    struct server_connection_args *server_connection_args =
+        aws_mem_calloc(bootstrap_options->bootstrap->allocator, 1, sizeof(struct server_connection_args));
+    if (!server_connection_args) {
+        return AWS_OP_ERR;
+    }
+
+    AWS_LOGF_INFO(
+        AWS_LS_IO_CHANNEL_BOOTSTRAP,
+        "id=%p: setting up a channel on adopted socket %p",
+        (void *)bootstrap_options->bootstrap,
+        (void *)socket);
+
+    aws_ref_count_init(
+        &server_connection_args->ref_count,
+        server_connection_args,
+        (aws_simple_completion_callback *)s_server_connection_args_destroy);
+    server_connection_args->user_data = bootstrap_options->user_data;
+    server_connection_args->bootstrap = aws_server_bootstrap_acquire(bootstrap_options->bootstrap);
+    server_connection_args->shutdown_callback = bootstrap_options->shutdown_callback;
+    server_connection_args->incoming_callback = bootstrap_options->incoming_callback;
+    server_connection_args->destroy_callback = bootstrap_options->destroy_callback;
+    server_connection_args->on_protocol_negotiated = bootstrap_options->bootstrap->on_protocol_negotiated;
+    server_connection_args->enable_read_back_pressure = bootstrap_options->enable_read_back_pressure;
+    server_connection_args->maximum_concurrent_handshakes = bootstrap_options->maximum_concurrent_handshakes;
+    aws_mutex_init(&server_connection_args->handshake_lock);
+    aws_linked_list_init(&server_connection_args->pending_handshakes);
+
+    if (bootstrap_options->tls_options) {
+        if (s_server_connection_args_setup_tls(server_connection_args, bootstrap_options)) {
+            s_server_connection_args_release(server_connection_args);
+            return AWS_OP_ERR;
+        }
+    }
+
+    /* drive the regular accepted-connection path. It acquires its own reference that lives with the
+     * channel (and reports any later failure through incoming_callback), so the creation reference
+     * can be dropped immediately. The embedded listener socket stays zeroed; it is only used here as
+     * the container for the connection args. */
+    s_on_server_connection_result(&server_connection_args->listener, AWS_OP_SUCCESS, socket, server_connection_args);
+
+    s_server_connection_args_release(server_connection_args);
+
+    return AWS_OP_SUCCESS;
+}
+
 void aws_server_bootstrap_destroy_socket_listener(struct aws_server_bootstrap *bootstrap, struct aws_socket *listener) {
     struct server_connection_args *server_connection_args =
         AWS_CONTAINER_OF(listener, struct server_connection_args, listener);
@@ -1557,3 +2337,805 @@ int aws_server_bootstrap_set_alpn_callback(
     bootstrap->on_protocol_negotiated = on_protocol_negotiated;
     return AWS_OP_SUCCESS;
 }
+
+struct server_warm_up_args {
+    struct aws_allocator *allocator;
+    struct aws_server_bootstrap *bootstrap; /* acquired */
+    struct aws_message_pool_creation_args pool_creation_args;
+    bool has_pool_creation_args;
+    size_t parked_channels_per_loop;
+    aws_server_bootstrap_on_warm_up_complete_fn *on_complete;
+    void *user_data;
+    struct aws_atomic_var remaining_loops;
+};
+
+struct server_warm_up_task {
+    struct aws_task task;
+    struct aws_event_loop *loop;
+    struct server_warm_up_args *args;
+};
+
+static void s_server_warm_up_task_fn(struct aws_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    struct server_warm_up_task *warm_up_task = arg;
+    struct server_warm_up_args *args = warm_up_task->args;
+    struct aws_allocator *allocator = args->allocator;
+
+    if (status == AWS_TASK_STATUS_RUN_READY) {
+        if (aws_channel_prime_event_loop(
+                allocator,
+                warm_up_task->loop,
+                args->has_pool_creation_args ? &args->pool_creation_args : NULL,
+                args->parked_channels_per_loop)) {
+            /* warm-up is an optimization; a loop that couldn't be primed just lazy-inits as before */
+            AWS_LOGF_WARN(
+                AWS_LS_IO_CHANNEL_BOOTSTRAP,
+                "id=%p: failed to warm up event-loop %p with error %d; first connections on it will lazy-init.",
+                (void *)args->bootstrap,
+                (void *)warm_up_task->loop,
+                aws_last_error());
+        }
+    }
+
+    aws_mem_release(allocator, warm_up_task);
+
+    if (aws_atomic_fetch_sub(&args->remaining_loops, 1) == 1) {
+        if (args->on_complete) {
+            args->on_complete(args->bootstrap, args->user_data);
+        }
+        aws_server_bootstrap_release(args->bootstrap);
+        aws_mem_release(allocator, args);
+    }
+}
+
+int aws_server_bootstrap_warm_up(
+    struct aws_server_bootstrap *bootstrap,
+    const struct aws_server_bootstrap_warm_up_options *options) {
+
+    AWS_ASSERT(bootstrap);
+    AWS_ASSERT(options);
+
+    struct aws_allocator *allocator = bootstrap->allocator;
+    size_t loop_count = aws_event_loop_group_get_loop_count(bootstrap->event_loop_group);
+    if (loop_count == 0) {
+        return aws_raise_error(AWS_ERROR_INVALID_STATE);
+    }
+
+    struct server_warm_up_args *warm_up_args = aws_mem_calloc(allocator, 1, sizeof(struct server_warm_up_args));
+    if (!warm_up_args) {
+        return AWS_OP_ERR;
+    }
+
+    warm_up_args->allocator = allocator;
+    warm_up_args->bootstrap = aws_server_bootstrap_acquire(bootstrap);
+    if (options->message_pool_creation_args != NULL) {
+        warm_up_args->pool_creation_args = *options->message_pool_creation_args;
+        warm_up_args->has_pool_creation_args = true;
+    }
+    warm_up_args->parked_channels_per_loop = options->parked_channels_per_loop;
+    warm_up_args->on_complete = options->on_complete;
+    warm_up_args->user_data = options->user_data;
+    aws_atomic_init_int(&warm_up_args->remaining_loops, loop_count);
+
+    AWS_LOGF_INFO(
+        AWS_LS_IO_CHANNEL_BOOTSTRAP,
+        "id=%p: warming up %zu event loop(s), %zu parked channel(s) per loop.",
+        (void *)bootstrap,
+        loop_count,
+        options->parked_channels_per_loop);
+
+    /* allocate every task up front so the fan-out cannot fail halfway through */
+    AWS_VARIABLE_LENGTH_ARRAY(struct server_warm_up_task *, tasks, loop_count);
+    for (size_t i = 0; i < loop_count; ++i) {
+        tasks[i] = aws_mem_calloc(allocator, 1, sizeof(struct server_warm_up_task));
+        if (!tasks[i]) {
+            for (size_t j = 0; j < i; ++j) {
+                aws_mem_release(allocator, tasks[j]);
+            }
+            aws_server_bootstrap_release(warm_up_args->bootstrap);
+            aws_mem_release(allocator, warm_up_args);
+            return AWS_OP_ERR;
+        }
+
+        tasks[i]->loop = aws_event_loop_group_get_loop_at(bootstrap->event_loop_group, i);
+        tasks[i]->args = warm_up_args;
+        aws_task_init(&tasks[i]->task, s_server_warm_up_task_fn, tasks[i], "server_bootstrap_warm_up");
+    }
+
+    for (size_t i = 0; i < loop_count; ++i) {
+        aws_event_loop_schedule_task_now(tasks[i]->loop, &tasks[i]->task);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+/*
+ * Channel pool: acquire/release of established (and TLS-negotiated) channels keyed by host:port,
+ * so request bursts reuse warm channels instead of paying DNS + TCP + TLS per request. One mutex
+ * guards the pool; callbacks are always invoked with the lock dropped.
+ */
+
+enum {
+    AWS_CHANNEL_POOL_DEFAULT_MAX_PER_ENDPOINT = 8,
+};
+
+struct aws_channel_pool {
+    struct aws_allocator *allocator;
+    struct aws_client_bootstrap *bootstrap;
+    struct aws_socket_options socket_options;
+    struct aws_tls_connection_options tls_options;
+    bool has_tls_options;
+    size_t max_channels_per_endpoint;
+    uint64_t idle_timeout_ns;
+    bool enable_read_back_pressure;
+
+    struct aws_mutex lock;
+    /* aws_string* "host:port" -> struct pool_endpoint* */
+    struct aws_hash_table endpoints;
+    /* aws_channel* -> struct pooled_channel* */
+    struct aws_hash_table channels;
+    bool shutting_down;
+
+    struct aws_event_loop *reaper_loop;
+    struct aws_task reaper_task;
+    bool reaper_scheduled;
+
+    struct aws_ref_count ref_count;
+};
+
+struct pool_endpoint {
+    struct aws_channel_pool *pool;
+    struct aws_string *key;
+    struct aws_string *host;
+    uint32_t port;
+    struct aws_linked_list idle_channels;        /* struct pooled_channel */
+    struct aws_linked_list pending_acquisitions; /* struct pool_acquisition */
+    /* idle + checked out + still connecting; the cap applies to this */
+    size_t live_count;
+};
+
+struct pooled_channel {
+    struct aws_linked_list_node node;
+    struct aws_channel *channel;
+    struct pool_endpoint *endpoint;
+    uint64_t idle_since_ns;
+    bool idle;
+};
+
+struct pool_acquisition {
+    struct aws_linked_list_node node;
+    aws_channel_pool_on_channel_acquired_fn *callback;
+    void *user_data;
+};
+
+/* per-connection bootstrap user_data; holds a pool reference from connect start to shutdown */
+struct pool_connection_ctx {
+    struct aws_channel_pool *pool;
+    struct pool_endpoint *endpoint;
+};
+
+static void s_pool_endpoint_destroy(void *value) {
+    struct pool_endpoint *endpoint = value;
+    AWS_ASSERT(aws_linked_list_empty(&endpoint->idle_channels));
+    AWS_ASSERT(aws_linked_list_empty(&endpoint->pending_acquisitions));
+    struct aws_allocator *allocator = endpoint->pool->allocator;
+    aws_string_destroy(endpoint->host);
+    aws_string_destroy(endpoint->key);
+    aws_mem_release(allocator, endpoint);
+}
+
+static void s_pool_destroy_impl(void *arg) {
+    struct aws_channel_pool *pool = arg;
+    AWS_LOGF_DEBUG(AWS_LS_IO_CHANNEL_BOOTSTRAP, "id=%p: channel pool destroying", (void *)pool);
+
+    aws_hash_table_clean_up(&pool->channels);
+    aws_hash_table_clean_up(&pool->endpoints);
+    aws_mutex_clean_up(&pool->lock);
+    if (pool->has_tls_options) {
+        aws_tls_connection_options_clean_up(&pool->tls_options);
+    }
+    aws_client_bootstrap_release(pool->bootstrap);
+    aws_mem_release(pool->allocator, pool);
+}
+
+struct aws_channel_pool *aws_channel_pool_new(
+    struct aws_allocator *allocator,
+    const struct aws_channel_pool_options *options) {
+    AWS_PRECONDITION(options);
+    AWS_PRECONDITION(options->bootstrap);
+    AWS_PRECONDITION(options->socket_options);
+
+    struct aws_channel_pool *pool = aws_mem_calloc(allocator, 1, sizeof(struct aws_channel_pool));
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->allocator = allocator;
+    pool->socket_options = *options->socket_options;
+    pool->max_channels_per_endpoint = options->max_channels_per_endpoint != 0
+                                          ? options->max_channels_per_endpoint
+                                          : AWS_CHANNEL_POOL_DEFAULT_MAX_PER_ENDPOINT;
+    pool->idle_timeout_ns =
+        aws_timestamp_convert(options->idle_timeout_ms, AWS_TIMESTAMP_MILLIS, AWS_TIMESTAMP_NANOS, NULL);
+    pool->enable_read_back_pressure = options->enable_read_back_pressure;
+    pool->lock = (struct aws_mutex)AWS_MUTEX_INIT;
+
+    if (options->tls_options) {
+        if (aws_tls_connection_options_copy(&pool->tls_options, options->tls_options)) {
+            goto on_error;
+        }
+        pool->has_tls_options = true;
+    }
+
+    if (aws_hash_table_init(
+            &pool->endpoints,
+            allocator,
+            4,
+            aws_hash_string,
+            aws_hash_callback_string_eq,
+            NULL,
+            s_pool_endpoint_destroy)) {
+        goto on_error;
+    }
+
+    if (aws_hash_table_init(&pool->channels, allocator, 8, aws_hash_ptr, aws_ptr_eq, NULL, NULL)) {
+        aws_hash_table_clean_up(&pool->endpoints);
+        goto on_error;
+    }
+
+    pool->bootstrap = aws_client_bootstrap_acquire(options->bootstrap);
+    pool->reaper_loop = aws_event_loop_group_get_next_loop(pool->bootstrap->event_loop_group);
+    aws_ref_count_init(&pool->ref_count, pool, s_pool_destroy_impl);
+
+    AWS_LOGF_INFO(
+        AWS_LS_IO_CHANNEL_BOOTSTRAP,
+        "id=%p: channel pool created, max %zu channels per endpoint.",
+        (void *)pool,
+        pool->max_channels_per_endpoint);
+    return pool;
+
+on_error:
+    if (pool->has_tls_options) {
+        aws_tls_connection_options_clean_up(&pool->tls_options);
+    }
+    aws_mem_release(allocator, pool);
+    return NULL;
+}
+
+static struct aws_channel_pool *s_pool_acquire_ref(struct aws_channel_pool *pool) {
+    aws_ref_count_acquire(&pool->ref_count);
+    return pool;
+}
+
+static void s_pool_release_ref(struct aws_channel_pool *pool) {
+    aws_ref_count_release(&pool->ref_count);
+}
+
+static void s_pool_reap_task(struct aws_task *task, void *arg, enum aws_task_status status);
+
+/* must hold pool->lock */
+static void s_pool_schedule_reaper(struct aws_channel_pool *pool) {
+    if (pool->idle_timeout_ns == 0 || pool->reaper_scheduled || pool->shutting_down) {
+        return;
+    }
+
+    uint64_t now = 0;
+    if (aws_event_loop_current_clock_time(pool->reaper_loop, &now)) {
+        return;
+    }
+
+    pool->reaper_scheduled = true;
+    s_pool_acquire_ref(pool);
+    aws_task_init(&pool->reaper_task, s_pool_reap_task, pool, "channel_pool_reaper");
+    aws_event_loop_schedule_task_future(pool->reaper_loop, &pool->reaper_task, now + pool->idle_timeout_ns / 2);
+}
+
+static void s_pool_reap_task(struct aws_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    struct aws_channel_pool *pool = arg;
+
+    struct aws_linked_list expired;
+    aws_linked_list_init(&expired);
+
+    aws_mutex_lock(&pool->lock);
+    pool->reaper_scheduled = false;
+
+    if (status == AWS_TASK_STATUS_RUN_READY && !pool->shutting_down) {
+        uint64_t now = 0;
+        aws_high_res_clock_get_ticks(&now);
+
+        bool any_idle_left = false;
+        for (struct aws_hash_iter iter = aws_hash_iter_begin(&pool->endpoints); !aws_hash_iter_done(&iter);
+             aws_hash_iter_next(&iter)) {
+            struct pool_endpoint *endpoint = iter.element.value;
+
+            struct aws_linked_list_node *node = aws_linked_list_begin(&endpoint->idle_channels);
+            while (node != aws_linked_list_end(&endpoint->idle_channels)) {
+                struct pooled_channel *record = AWS_CONTAINER_OF(node, struct pooled_channel, node);
+                node = aws_linked_list_next(node);
+
+                if (now - record->idle_since_ns >= pool->idle_timeout_ns) {
+                    AWS_LOGF_DEBUG(
+                        AWS_LS_IO_CHANNEL_BOOTSTRAP,
+                        "id=%p: reaping idle pooled channel %p for %s.",
+                        (void *)pool,
+                        (void *)record->channel,
+                        aws_string_c_str(endpoint->key));
+                    aws_linked_list_remove(&record->node);
+                    aws_hash_table_remove(&pool->channels, record->channel, NULL, NULL);
+                    /* live_count is decremented by the shutdown callback, which still runs */
+                    aws_linked_list_push_back(&expired, &record->node);
+                } else {
+                    any_idle_left = true;
+                }
+            }
+        }
+
+        if (any_idle_left) {
+            s_pool_schedule_reaper(pool);
+        }
+    }
+    aws_mutex_unlock(&pool->lock);
+
+    while (!aws_linked_list_empty(&expired)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&expired);
+        struct pooled_channel *record = AWS_CONTAINER_OF(node, struct pooled_channel, node);
+        aws_channel_shutdown(record->channel, AWS_ERROR_SUCCESS);
+        aws_mem_release(pool->allocator, record);
+    }
+
+    s_pool_release_ref(pool);
+}
+
+/* must hold pool->lock; returns NULL on allocation failure */
+static struct pool_endpoint *s_pool_get_endpoint(
+    struct aws_channel_pool *pool,
+    const char *host_name,
+    uint32_t port) {
+
+    char key_buffer[300];
+    int key_len = snprintf(key_buffer, sizeof(key_buffer), "%s:%u", host_name, (unsigned)port);
+    if (key_len < 0 || (size_t)key_len >= sizeof(key_buffer)) {
+        aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        return NULL;
+    }
+
+    struct aws_hash_element *element = NULL;
+    struct aws_string *key = aws_string_new_from_array(pool->allocator, (const uint8_t *)key_buffer, (size_t)key_len);
+    if (!key) {
+        return NULL;
+    }
+
+    if (!aws_hash_table_find(&pool->endpoints, key, &element) && element != NULL) {
+        aws_string_destroy(key);
+        return element->value;
+    }
+
+    struct pool_endpoint *endpoint = aws_mem_calloc(pool->allocator, 1, sizeof(struct pool_endpoint));
+    if (!endpoint) {
+        aws_string_destroy(key);
+        return NULL;
+    }
+
+    endpoint->pool = pool;
+    endpoint->key = key;
+    endpoint->port = port;
+    endpoint->host = aws_string_new_from_c_str(pool->allocator, host_name);
+    aws_linked_list_init(&endpoint->idle_channels);
+    aws_linked_list_init(&endpoint->pending_acquisitions);
+
+    if (!endpoint->host || aws_hash_table_put(&pool->endpoints, key, endpoint, NULL)) {
+        aws_string_destroy(endpoint->host);
+        aws_string_destroy(key);
+        aws_mem_release(pool->allocator, endpoint);
+        return NULL;
+    }
+
+    return endpoint;
+}
+
+static void s_pool_on_channel_setup(
+    struct aws_client_bootstrap *bootstrap,
+    int error_code,
+    struct aws_channel *channel,
+    void *user_data);
+
+static void s_pool_on_channel_shutdown(
+    struct aws_client_bootstrap *bootstrap,
+    int error_code,
+    struct aws_channel *channel,
+    void *user_data);
+
+/* kicks off one bootstrap connection for the endpoint; caller has already counted it in live_count */
+static int s_pool_connect(struct pool_connection_ctx *ctx) {
+    struct aws_channel_pool *pool = ctx->pool;
+
+    struct aws_socket_channel_bootstrap_options options = {
+        .bootstrap = pool->bootstrap,
+        .host_name = aws_string_c_str(ctx->endpoint->host),
+        .port = ctx->endpoint->port,
+        .socket_options = &pool->socket_options,
+        .tls_options = pool->has_tls_options ? &pool->tls_options : NULL,
+        .setup_callback = s_pool_on_channel_setup,
+        .shutdown_callback = s_pool_on_channel_shutdown,
+        .enable_read_back_pressure = pool->enable_read_back_pressure,
+        .user_data = ctx,
+    };
+
+    return aws_client_bootstrap_new_socket_channel(&options);
+}
+
+static struct pool_connection_ctx *s_pool_connection_ctx_new(
+    struct aws_channel_pool *pool,
+    struct pool_endpoint *endpoint) {
+
+    struct pool_connection_ctx *ctx = aws_mem_calloc(pool->allocator, 1, sizeof(struct pool_connection_ctx));
+    if (!ctx) {
+        return NULL;
+    }
+
+    ctx->pool = s_pool_acquire_ref(pool);
+    ctx->endpoint = endpoint;
+    return ctx;
+}
+
+static void s_pool_connection_ctx_destroy(struct pool_connection_ctx *ctx) {
+    struct aws_channel_pool *pool = ctx->pool;
+    aws_mem_release(pool->allocator, ctx);
+    s_pool_release_ref(pool);
+}
+
+static void s_pool_on_channel_setup(
+    struct aws_client_bootstrap *bootstrap,
+    int error_code,
+    struct aws_channel *channel,
+    void *user_data) {
+    (void)bootstrap;
+
+    struct pool_connection_ctx *ctx = user_data;
+    struct aws_channel_pool *pool = ctx->pool;
+    struct pool_endpoint *endpoint = ctx->endpoint;
+    struct pool_acquisition *acquisition = NULL;
+
+    if (error_code) {
+        aws_mutex_lock(&pool->lock);
+        endpoint->live_count--;
+        if (!aws_linked_list_empty(&endpoint->pending_acquisitions)) {
+            acquisition = AWS_CONTAINER_OF(
+                aws_linked_list_pop_front(&endpoint->pending_acquisitions), struct pool_acquisition, node);
+        }
+        aws_mutex_unlock(&pool->lock);
+
+        if (acquisition) {
+            acquisition->callback(pool, error_code, NULL, acquisition->user_data);
+            aws_mem_release(pool->allocator, acquisition);
+        }
+
+        /* no shutdown callback follows a failed setup */
+        s_pool_connection_ctx_destroy(ctx);
+        return;
+    }
+
+    struct pooled_channel *record = aws_mem_calloc(pool->allocator, 1, sizeof(struct pooled_channel));
+    if (!record) {
+        aws_channel_shutdown(channel, AWS_ERROR_OOM);
+        return;
+    }
+
+    record->channel = channel;
+    record->endpoint = endpoint;
+
+    bool shutdown_now = false;
+    aws_mutex_lock(&pool->lock);
+    if (pool->shutting_down) {
+        shutdown_now = true;
+    } else if (aws_hash_table_put(&pool->channels, channel, record, NULL)) {
+        shutdown_now = true;
+    } else if (!aws_linked_list_empty(&endpoint->pending_acquisitions)) {
+        acquisition = AWS_CONTAINER_OF(
+            aws_linked_list_pop_front(&endpoint->pending_acquisitions), struct pool_acquisition, node);
+    } else {
+        record->idle = true;
+        aws_high_res_clock_get_ticks(&record->idle_since_ns);
+        aws_linked_list_push_back(&endpoint->idle_channels, &record->node);
+        s_pool_schedule_reaper(pool);
+    }
+    aws_mutex_unlock(&pool->lock);
+
+    if (shutdown_now) {
+        aws_mem_release(pool->allocator, record);
+        aws_channel_shutdown(channel, AWS_ERROR_SUCCESS);
+        return;
+    }
+
+    if (acquisition) {
+        acquisition->callback(pool, AWS_ERROR_SUCCESS, channel, acquisition->user_data);
+        aws_mem_release(pool->allocator, acquisition);
+    }
+}
+
+static void s_pool_on_channel_shutdown(
+    struct aws_client_bootstrap *bootstrap,
+    int error_code,
+    struct aws_channel *channel,
+    void *user_data) {
+    (void)bootstrap;
+    (void)error_code;
+
+    struct pool_connection_ctx *ctx = user_data;
+    struct aws_channel_pool *pool = ctx->pool;
+    struct pool_endpoint *endpoint = ctx->endpoint;
+    struct pooled_channel *record = NULL;
+    struct pool_connection_ctx *replacement_ctx = NULL;
+    struct pool_acquisition *failed_acquisition = NULL;
+
+    aws_mutex_lock(&pool->lock);
+    struct aws_hash_element *element = NULL;
+    if (!aws_hash_table_find(&pool->channels, channel, &element) && element != NULL) {
+        record = element->value;
+        if (record->idle) {
+            aws_linked_list_remove(&record->node);
+        }
+        aws_hash_table_remove(&pool->channels, channel, NULL, NULL);
+    }
+
+    endpoint->live_count--;
+
+    /* don't strand a waiter: if acquisitions are queued and we're under the cap, replace the
+     * connection that just died */
+    if (!pool->shutting_down && !aws_linked_list_empty(&endpoint->pending_acquisitions) &&
+        endpoint->live_count < pool->max_channels_per_endpoint) {
+        replacement_ctx = s_pool_connection_ctx_new(pool, endpoint);
+        if (replacement_ctx) {
+            endpoint->live_count++;
+        }
+    }
+    aws_mutex_unlock(&pool->lock);
+
+    if (record) {
+        aws_mem_release(pool->allocator, record);
+    }
+
+    if (replacement_ctx && s_pool_connect(replacement_ctx)) {
+        int connect_error = aws_last_error();
+        aws_mutex_lock(&pool->lock);
+        endpoint->live_count--;
+        if (!aws_linked_list_empty(&endpoint->pending_acquisitions)) {
+            failed_acquisition = AWS_CONTAINER_OF(
+                aws_linked_list_pop_front(&endpoint->pending_acquisitions), struct pool_acquisition, node);
+        }
+        aws_mutex_unlock(&pool->lock);
+        s_pool_connection_ctx_destroy(replacement_ctx);
+
+        if (failed_acquisition) {
+            failed_acquisition->callback(pool, connect_error, NULL, failed_acquisition->user_data);
+            aws_mem_release(pool->allocator, failed_acquisition);
+        }
+    }
+
+    s_pool_connection_ctx_destroy(ctx);
+}
+
+int aws_channel_pool_acquire(
+    struct aws_channel_pool *pool,
+    const char *host_name,
+    uint32_t port,
+    aws_channel_pool_on_channel_acquired_fn *callback,
+    void *user_data) {
+    AWS_PRECONDITION(callback);
+
+    struct aws_channel *idle_channel = NULL;
+    struct pool_connection_ctx *ctx = NULL;
+    struct pool_acquisition *acquisition = NULL;
+
+    aws_mutex_lock(&pool->lock);
+
+    if (pool->shutting_down) {
+        aws_mutex_unlock(&pool->lock);
+        return aws_raise_error(AWS_IO_SOCKET_CLOSED);
+    }
+
+    struct pool_endpoint *endpoint = s_pool_get_endpoint(pool, host_name, port);
+    if (!endpoint) {
+        aws_mutex_unlock(&pool->lock);
+        return AWS_OP_ERR;
+    }
+
+    if (!aws_linked_list_empty(&endpoint->idle_channels)) {
+        struct pooled_channel *record =
+            AWS_CONTAINER_OF(aws_linked_list_pop_front(&endpoint->idle_channels), struct pooled_channel, node);
+        record->idle = false;
+        idle_channel = record->channel;
+        aws_mutex_unlock(&pool->lock);
+
+        AWS_LOGF_TRACE(
+            AWS_LS_IO_CHANNEL_BOOTSTRAP,
+            "id=%p: handing out idle pooled channel %p for %s:%u.",
+            (void *)pool,
+            (void *)idle_channel,
+            host_name,
+            (unsigned)port);
+        callback(pool, AWS_ERROR_SUCCESS, idle_channel, user_data);
+        return AWS_OP_SUCCESS;
+    }
+
+    acquisition = aws_mem_calloc(pool->allocator, 1, sizeof(struct pool_acquisition));
+    if (!acquisition) {
+        aws_mutex_unlock(&pool->lock);
+        return AWS_OP_ERR;
+    }
+    acquisition->callback = callback;
+    acquisition->user_data = user_data;
+    aws_linked_list_push_back(&endpoint->pending_acquisitions, &acquisition->node);
+
+    if (endpoint->live_count < pool->max_channels_per_endpoint) {
+        ctx = s_pool_connection_ctx_new(pool, endpoint);
+        if (!ctx) {
+            aws_linked_list_remove(&acquisition->node);
+            aws_mutex_unlock(&pool->lock);
+            aws_mem_release(pool->allocator, acquisition);
+            return AWS_OP_ERR;
+        }
+        endpoint->live_count++;
+    }
+    /* else: at the cap; the acquisition waits for the next release or shutdown-replacement */
+    aws_mutex_unlock(&pool->lock);
+
+    if (ctx && s_pool_connect(ctx)) {
+        int connect_error = aws_last_error();
+        bool still_queued = false;
+
+        aws_mutex_lock(&pool->lock);
+        endpoint->live_count--;
+        /* the acquisition may have been satisfied by a concurrent release already */
+        for (struct aws_linked_list_node *node = aws_linked_list_begin(&endpoint->pending_acquisitions);
+             node != aws_linked_list_end(&endpoint->pending_acquisitions);
+             node = aws_linked_list_next(node)) {
+            if (node == &acquisition->node) {
+                aws_linked_list_remove(&acquisition->node);
+                still_queued = true;
+                break;
+            }
+        }
+        aws_mutex_unlock(&pool->lock);
+
+        s_pool_connection_ctx_destroy(ctx);
+
+        if (still_queued) {
+            aws_mem_release(pool->allocator, acquisition);
+            return aws_raise_error(connect_error);
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+void aws_channel_pool_release(struct aws_channel_pool *pool, struct aws_channel *channel) {
+    struct pool_acquisition *acquisition = NULL;
+    bool shutdown_now = false;
+
+    aws_mutex_lock(&pool->lock);
+
+    struct aws_hash_element *element = NULL;
+    if (aws_hash_table_find(&pool->channels, channel, &element) || element == NULL) {
+        /* already shut down (the shutdown callback dropped the record), or not ours */
+        aws_mutex_unlock(&pool->lock);
+        return;
+    }
+
+    struct pooled_channel *record = element->value;
+    struct pool_endpoint *endpoint = record->endpoint;
+
+    if (pool->shutting_down) {
+        shutdown_now = true;
+    } else if (!aws_linked_list_empty(&endpoint->pending_acquisitions)) {
+        acquisition = AWS_CONTAINER_OF(
+            aws_linked_list_pop_front(&endpoint->pending_acquisitions), struct pool_acquisition, node);
+    } else {
+        record->idle = true;
+        aws_high_res_clock_get_ticks(&record->idle_since_ns);
+        aws_linked_list_push_back(&endpoint->idle_channels, &record->node);
+        s_pool_schedule_reaper(pool);
+    }
+    aws_mutex_unlock(&pool->lock);
+
+    if (shutdown_now) {
+        aws_channel_shutdown(channel, AWS_ERROR_SUCCESS);
+    } else if (acquisition) {
+        AWS_LOGF_TRACE(
+            AWS_LS_IO_CHANNEL_BOOTSTRAP,
+            "id=%p: released channel %p handed directly to a waiting acquisition.",
+            (void *)pool,
+            (void *)channel);
+        acquisition->callback(pool, AWS_ERROR_SUCCESS, channel, acquisition->user_data);
+        aws_mem_release(pool->allocator, acquisition);
+    }
+}
+
+int aws_channel_pool_warm_up(struct aws_channel_pool *pool, const char *host_name, uint32_t port, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        struct pool_connection_ctx *ctx = NULL;
+
+        aws_mutex_lock(&pool->lock);
+        if (pool->shutting_down) {
+            aws_mutex_unlock(&pool->lock);
+            return aws_raise_error(AWS_IO_SOCKET_CLOSED);
+        }
+
+        struct pool_endpoint *endpoint = s_pool_get_endpoint(pool, host_name, port);
+        if (!endpoint) {
+            aws_mutex_unlock(&pool->lock);
+            return AWS_OP_ERR;
+        }
+
+        if (endpoint->live_count >= pool->max_channels_per_endpoint) {
+            aws_mutex_unlock(&pool->lock);
+            break;
+        }
+
+        ctx = s_pool_connection_ctx_new(pool, endpoint);
+        if (!ctx) {
+            aws_mutex_unlock(&pool->lock);
+            return AWS_OP_ERR;
+        }
+        endpoint->live_count++;
+        aws_mutex_unlock(&pool->lock);
+
+        if (s_pool_connect(ctx)) {
+            aws_mutex_lock(&pool->lock);
+            endpoint->live_count--;
+            aws_mutex_unlock(&pool->lock);
+            s_pool_connection_ctx_destroy(ctx);
+            return AWS_OP_ERR;
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+void aws_channel_pool_destroy(struct aws_channel_pool *pool) {
+    if (!pool) {
+        return;
+    }
+
+    struct aws_linked_list idle;
+    aws_linked_list_init(&idle);
+    struct aws_linked_list waiters;
+    aws_linked_list_init(&waiters);
+
+    aws_mutex_lock(&pool->lock);
+    pool->shutting_down = true;
+
+    for (struct aws_hash_iter iter = aws_hash_iter_begin(&pool->endpoints); !aws_hash_iter_done(&iter);
+         aws_hash_iter_next(&iter)) {
+        struct pool_endpoint *endpoint = iter.element.value;
+
+        while (!aws_linked_list_empty(&endpoint->idle_channels)) {
+            struct aws_linked_list_node *node = aws_linked_list_pop_front(&endpoint->idle_channels);
+            struct pooled_channel *record = AWS_CONTAINER_OF(node, struct pooled_channel, node);
+            aws_hash_table_remove(&pool->channels, record->channel, NULL, NULL);
+            aws_linked_list_push_back(&idle, &record->node);
+        }
+
+        while (!aws_linked_list_empty(&endpoint->pending_acquisitions)) {
+            aws_linked_list_push_back(&waiters, aws_linked_list_pop_front(&endpoint->pending_acquisitions));
+        }
+    }
+    aws_mutex_unlock(&pool->lock);
+
+    while (!aws_linked_list_empty(&waiters)) {
+        struct pool_acquisition *acquisition =
+            AWS_CONTAINER_OF(aws_linked_list_pop_front(&waiters), struct pool_acquisition, node);
+        acquisition->callback(pool, AWS_IO_SOCKET_CLOSED, NULL, acquisition->user_data);
+        aws_mem_release(pool->allocator, acquisition);
+    }
+
+    while (!aws_linked_list_empty(&idle)) {
+        struct pooled_channel *record =
+            AWS_CONTAINER_OF(aws_linked_list_pop_front(&idle), struct pooled_channel, node);
+        aws_channel_shutdown(record->channel, AWS_ERROR_SUCCESS);
+        aws_mem_release(pool->allocator, record);
+    }
+
+    s_pool_release_ref(pool);
+}
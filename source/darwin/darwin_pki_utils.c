@@ -4,6 +4,8 @@
  */
 #include <aws/io/private/pki_utils.h>
 
+#include <aws/cal/hash.h>
+#include <aws/common/hash_table.h>
 #include <aws/common/mutex.h>
 #include <aws/common/string.h>
 #include <aws/io/logging.h>
@@ -19,6 +21,137 @@ static struct aws_mutex s_sec_mutex = AWS_MUTEX_INIT;
 
 #if !defined(AWS_OS_IOS)
 
+/* Keychain import costs tens of milliseconds per context and serializes on a framework-global
+ * lock, so identities are cached keyed by a SHA-256 digest of the certificate chain, private key
+ * and keychain path; repeated context creation with the same material becomes a hash lookup plus
+ * a CFRetain. The cache holds one CF reference per entry and is guarded by s_sec_mutex like the
+ * imports themselves. */
+struct identity_cache_entry {
+    struct aws_allocator *alloc;
+    struct aws_byte_cursor key; /* points at digest */
+    uint8_t digest[AWS_SHA256_LEN];
+    CFArrayRef identity; /* the cache's own reference */
+};
+
+static struct aws_hash_table s_identity_cache;
+static bool s_identity_cache_valid;
+
+static uint64_t s_identity_cache_hash_key(const void *key) {
+    return aws_hash_byte_cursor_ptr(key);
+}
+
+static bool s_identity_cache_key_eq(const void *a, const void *b) {
+    return aws_byte_cursor_eq(a, b);
+}
+
+static void s_identity_cache_destroy_entry(void *value) {
+    struct identity_cache_entry *entry = value;
+    CFRelease(entry->identity);
+    aws_mem_release(entry->alloc, entry);
+}
+
+static int s_compute_identity_cache_digest(
+    struct aws_allocator *alloc,
+    const struct aws_byte_cursor *public_cert_chain,
+    const struct aws_byte_cursor *private_key,
+    const struct aws_string *keychain_path,
+    uint8_t *out_digest) {
+
+    struct aws_hash *sha256 = aws_sha256_new(alloc);
+    if (!sha256) {
+        return AWS_OP_ERR;
+    }
+
+    int result = AWS_OP_ERR;
+
+    /* length-prefix the fields so bytes cannot shift between them and still produce the digest */
+    uint64_t lengths[] = {public_cert_chain->len, private_key->len, keychain_path ? keychain_path->len : 0};
+    struct aws_byte_cursor lengths_cursor = aws_byte_cursor_from_array((const uint8_t *)lengths, sizeof(lengths));
+
+    if (aws_hash_update(sha256, &lengths_cursor) || aws_hash_update(sha256, public_cert_chain) ||
+        aws_hash_update(sha256, private_key)) {
+        goto done;
+    }
+
+    if (keychain_path) {
+        struct aws_byte_cursor path_cursor = aws_byte_cursor_from_string(keychain_path);
+        if (aws_hash_update(sha256, &path_cursor)) {
+            goto done;
+        }
+    }
+
+    struct aws_byte_buf digest_buf = aws_byte_buf_from_empty_array(out_digest, AWS_SHA256_LEN);
+    if (aws_hash_finalize(sha256, &digest_buf, 0)) {
+        goto done;
+    }
+
+    result = AWS_OP_SUCCESS;
+
+done:
+    aws_hash_destroy(sha256);
+    return result;
+}
+
+/* must be called while holding s_sec_mutex; the returned array carries a reference for the caller */
+static CFArrayRef s_identity_cache_find(const uint8_t *digest) {
+    if (!s_identity_cache_valid) {
+        return NULL;
+    }
+
+    struct aws_byte_cursor key = aws_byte_cursor_from_array(digest, AWS_SHA256_LEN);
+    struct aws_hash_element *element = NULL;
+    aws_hash_table_find(&s_identity_cache, &key, &element);
+    if (!element) {
+        return NULL;
+    }
+
+    struct identity_cache_entry *entry = element->value;
+    CFRetain(entry->identity);
+    return entry->identity;
+}
+
+/* must be called while holding s_sec_mutex; the cache is best-effort, failures just skip caching */
+static void s_identity_cache_put(struct aws_allocator *alloc, const uint8_t *digest, CFArrayRef identity) {
+    if (!s_identity_cache_valid) {
+        if (aws_hash_table_init(
+                &s_identity_cache,
+                alloc,
+                4,
+                s_identity_cache_hash_key,
+                s_identity_cache_key_eq,
+                NULL,
+                s_identity_cache_destroy_entry)) {
+            return;
+        }
+        s_identity_cache_valid = true;
+    }
+
+    struct identity_cache_entry *entry = aws_mem_calloc(alloc, 1, sizeof(struct identity_cache_entry));
+    if (!entry) {
+        return;
+    }
+
+    entry->alloc = alloc;
+    memcpy(entry->digest, digest, AWS_SHA256_LEN);
+    entry->key = aws_byte_cursor_from_array(entry->digest, AWS_SHA256_LEN);
+    entry->identity = identity;
+    CFRetain(identity);
+
+    if (aws_hash_table_put(&s_identity_cache, &entry->key, entry, NULL)) {
+        CFRelease(identity);
+        aws_mem_release(alloc, entry);
+    }
+}
+
+void aws_pki_release_identity_cache(void) {
+    aws_mutex_lock(&s_sec_mutex);
+    if (s_identity_cache_valid) {
+        s_identity_cache_valid = false;
+        aws_hash_table_clean_up(&s_identity_cache);
+    }
+    aws_mutex_unlock(&s_sec_mutex);
+}
+
 /*
  * Helper function to import ECC private key in PEM format into `import_keychain`. Return
  * AWS_OP_SUCCESS if successfully imported a private key or find a duplicate key in the
@@ -99,6 +232,23 @@ int aws_import_public_and_private_keys_to_identity(
     AWS_PRECONDITION(public_cert_chain != NULL);
     AWS_PRECONDITION(private_key != NULL);
 
+    uint8_t cache_digest[AWS_SHA256_LEN];
+    bool digest_computed =
+        s_compute_identity_cache_digest(alloc, public_cert_chain, private_key, keychain_path, cache_digest) ==
+        AWS_OP_SUCCESS;
+
+    if (digest_computed) {
+        aws_mutex_lock(&s_sec_mutex);
+        CFArrayRef cached_identity = s_identity_cache_find(cache_digest);
+        aws_mutex_unlock(&s_sec_mutex);
+
+        if (cached_identity) {
+            AWS_LOGF_DEBUG(AWS_LS_IO_PKI, "static: reusing previously imported identity for certificate.");
+            *identity = cached_identity;
+            return AWS_OP_SUCCESS;
+        }
+    }
+
     int result = AWS_OP_ERR;
 
     CFDataRef cert_data = NULL;
@@ -256,6 +406,11 @@ int aws_import_public_and_private_keys_to_identity(
     *identity = CFArrayCreate(cf_alloc, (const void **)certs, 1L, &kCFTypeArrayCallBacks);
     result = AWS_OP_SUCCESS;
 
+    if (digest_computed && *identity) {
+        /* still under s_sec_mutex here */
+        s_identity_cache_put(alloc, cache_digest, *identity);
+    }
+
 done:
     aws_mutex_unlock(&s_sec_mutex);
     if (certificate_ref) {
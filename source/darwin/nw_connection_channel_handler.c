@@ -0,0 +1,705 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#ifdef AWS_USE_APPLE_NETWORK_FRAMEWORK
+
+#    include <aws/io/nw_connection.h>
+
+#    include <aws/common/atomics.h>
+#    include <aws/common/string.h>
+#    include <aws/common/task_scheduler.h>
+#    include <aws/io/channel.h>
+#    include <aws/io/event_loop.h>
+#    include <aws/io/logging.h>
+#    include <aws/io/statistics.h>
+
+#    include <Network/Network.h>
+#    include <dispatch/dispatch.h>
+
+#    include <stdio.h>
+#    include <string.h>
+
+/*
+ * Client channels backed by Network.framework. The nw_connection provides connect and TLS; this
+ * handler sits in the channel's left-most slot and translates between aws_io_messages and
+ * dispatch_data. Network.framework delivers completions on a private serial dispatch queue, so
+ * every interaction with the channel is marshalled across with aws_channel_schedule_task_now()
+ * (the only cross-thread-safe channel entry point); channel-thread code may call nw_connection
+ * APIs directly, as those are thread-safe.
+ *
+ * Lifetime: the handler is reference counted. The channel owns one reference (dropped in the
+ * vtable destroy), the connection's state-changed handler owns one (dropped when the cancelled
+ * state is delivered), and every in-flight receive/send completion owns one. The `active` flag is
+ * only touched on the dispatch queue: once it flips false (at write-direction shutdown, and again
+ * via a synchronous barrier in destroy), completions stop scheduling channel tasks, so nothing
+ * reaches the channel after it starts tearing down.
+ */
+
+struct nw_connection_handler {
+    struct aws_channel_handler handler;
+    struct aws_allocator *allocator;
+    struct aws_channel_slot *slot;
+    nw_connection_t connection;
+    dispatch_queue_t queue;
+    struct aws_atomic_var ref_count;
+    struct aws_crt_statistics_socket stats;
+    /* bytes handed to nw_connection_send but not yet completed */
+    size_t pending_write_bytes;
+    /* back pointer to the bootstrap args, for the setup callback on first readiness */
+    struct nw_channel_args *bootstrap_args;
+    bool receive_outstanding;
+    bool shutdown_in_progress;
+    /* dispatch-queue-thread only; gates scheduling of channel tasks from completions */
+    bool active;
+};
+
+struct nw_channel_args {
+    struct aws_allocator *allocator;
+    struct aws_client_bootstrap *bootstrap;
+    struct aws_string *host_name;
+    struct aws_string *alpn_list;
+    uint32_t port;
+    bool enable_tls;
+    bool enable_multipath;
+    aws_client_bootstrap_on_channel_event_fn *setup_callback;
+    aws_client_bootstrap_on_channel_event_fn *shutdown_callback;
+    void *user_data;
+    struct aws_channel *channel;
+    bool setup_succeeded;
+};
+
+enum nw_handler_event_type {
+    NW_EVENT_CONNECTION_READY,
+    NW_EVENT_CONNECTION_ERROR,
+    NW_EVENT_DATA_RECEIVED,
+    NW_EVENT_WRITE_COMPLETED,
+};
+
+struct nw_handler_event {
+    struct aws_channel_task task;
+    struct nw_connection_handler *connection_handler;
+    enum nw_handler_event_type type;
+    dispatch_data_t data;
+    struct aws_io_message *message;
+    int error_code;
+    bool read_complete;
+};
+
+static void s_handler_acquire(struct nw_connection_handler *connection_handler) {
+    aws_atomic_fetch_add(&connection_handler->ref_count, 1);
+}
+
+static void s_handler_release(struct nw_connection_handler *connection_handler) {
+    if (aws_atomic_fetch_sub(&connection_handler->ref_count, 1) == 1) {
+        if (connection_handler->connection) {
+            nw_release(connection_handler->connection);
+        }
+        if (connection_handler->queue) {
+            dispatch_release(connection_handler->queue);
+        }
+        aws_crt_statistics_socket_cleanup(&connection_handler->stats);
+        aws_mem_release(connection_handler->allocator, connection_handler);
+    }
+}
+
+static int s_error_code_from_nw_error(nw_error_t error, bool connected) {
+    if (error == NULL) {
+        return connected ? AWS_IO_SOCKET_CLOSED : AWS_IO_SOCKET_CONNECT_ABORTED;
+    }
+
+    switch (nw_error_get_error_domain(error)) {
+        case nw_error_domain_posix:
+            switch (nw_error_get_error_code(error)) {
+                case ECONNREFUSED:
+                    return AWS_IO_SOCKET_CONNECTION_REFUSED;
+                case ETIMEDOUT:
+                    return AWS_IO_SOCKET_TIMEOUT;
+                case ECONNRESET:
+                case EPIPE:
+                    return AWS_IO_SOCKET_CLOSED;
+                default:
+                    return connected ? AWS_IO_SOCKET_CLOSED : AWS_IO_SOCKET_CONNECT_ABORTED;
+            }
+        case nw_error_domain_tls:
+            return AWS_IO_TLS_ERROR_NEGOTIATION_FAILURE;
+        default:
+            return connected ? AWS_IO_SOCKET_CLOSED : AWS_IO_SOCKET_CONNECT_ABORTED;
+    }
+}
+
+static void s_post_receive(struct nw_connection_handler *connection_handler);
+static void s_handler_event_task(struct aws_channel_task *task, void *arg, enum aws_task_status status);
+
+/* dispatch-queue thread: wraps a completion in a channel task. Takes over the caller's handler
+ * reference and the data/message references it is given. */
+static void s_schedule_event(
+    struct nw_connection_handler *connection_handler,
+    enum nw_handler_event_type type,
+    dispatch_data_t data,
+    struct aws_io_message *message,
+    int error_code,
+    bool read_complete) {
+
+    struct nw_handler_event *event =
+        aws_mem_calloc(connection_handler->allocator, 1, sizeof(struct nw_handler_event));
+    if (!event) {
+        /* allocation failure with the channel unreachable from this thread; drop the payload */
+        if (data) {
+            dispatch_release(data);
+        }
+        if (message) {
+            aws_mem_release(message->allocator, message);
+        }
+        s_handler_release(connection_handler);
+        return;
+    }
+
+    event->connection_handler = connection_handler;
+    event->type = type;
+    event->data = data;
+    event->message = message;
+    event->error_code = error_code;
+    event->read_complete = read_complete;
+    aws_channel_task_init(&event->task, s_handler_event_task, event, "nw_connection_event");
+    aws_channel_schedule_task_now(connection_handler->slot->channel, &event->task);
+}
+
+/* channel thread: copies received dispatch_data into pool messages and sends them downstream */
+static int s_deliver_received_data(struct nw_connection_handler *connection_handler, dispatch_data_t data) {
+    struct aws_channel_slot *slot = connection_handler->slot;
+    __block int result = AWS_OP_SUCCESS;
+    __block size_t total_delivered = 0;
+
+    dispatch_data_apply(data, ^bool(dispatch_data_t region, size_t offset, const void *buffer, size_t size) {
+        (void)region;
+        (void)offset;
+        struct aws_byte_cursor chunk = aws_byte_cursor_from_array(buffer, size);
+        while (chunk.len > 0) {
+            struct aws_io_message *message = aws_channel_acquire_message_from_pool(
+                slot->channel, AWS_IO_MESSAGE_APPLICATION_DATA, chunk.len);
+            if (!message) {
+                result = AWS_OP_ERR;
+                return false;
+            }
+
+            size_t to_copy = message->message_data.capacity < chunk.len ? message->message_data.capacity : chunk.len;
+            struct aws_byte_cursor slice = aws_byte_cursor_advance(&chunk, to_copy);
+            aws_byte_buf_append(&message->message_data, &slice);
+
+            if (aws_channel_slot_send_message(slot, message, AWS_CHANNEL_DIR_READ)) {
+                aws_mem_release(message->allocator, message);
+                result = AWS_OP_ERR;
+                return false;
+            }
+            total_delivered += to_copy;
+        }
+        return true;
+    });
+
+    connection_handler->stats.bytes_read += total_delivered;
+    if (total_delivered > 0) {
+        aws_channel_touch_idle_timeout(slot->channel);
+    }
+    return result;
+}
+
+static void s_handler_event_task(struct aws_channel_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    struct nw_handler_event *event = arg;
+    struct nw_connection_handler *connection_handler = event->connection_handler;
+    struct aws_channel *channel = connection_handler->slot->channel;
+
+    if (status != AWS_TASK_STATUS_RUN_READY) {
+        if (event->message) {
+            if (event->message->on_completion) {
+                event->message->on_completion(
+                    channel, event->message, AWS_ERROR_IO_OPERATION_CANCELLED, event->message->user_data);
+            }
+            aws_mem_release(event->message->allocator, event->message);
+            event->message = NULL;
+        }
+        goto done;
+    }
+
+    switch (event->type) {
+        case NW_EVENT_CONNECTION_READY: {
+            struct nw_channel_args *args = connection_handler->bootstrap_args;
+            if (!args->setup_succeeded) {
+                args->setup_succeeded = true;
+                AWS_LOGF_DEBUG(
+                    AWS_LS_IO_CHANNEL_BOOTSTRAP,
+                    "id=%p: nw_connection ready, channel %p setup completed",
+                    (void *)&connection_handler->handler,
+                    (void *)channel);
+                args->setup_callback(args->bootstrap, AWS_ERROR_SUCCESS, channel, args->user_data);
+            }
+            s_post_receive(connection_handler);
+            break;
+        }
+        case NW_EVENT_CONNECTION_ERROR:
+            AWS_LOGF_DEBUG(
+                AWS_LS_IO_SOCKET_HANDLER,
+                "id=%p: nw_connection reported error %d, shutting down channel",
+                (void *)&connection_handler->handler,
+                event->error_code);
+            aws_channel_shutdown(channel, event->error_code);
+            break;
+        case NW_EVENT_DATA_RECEIVED:
+            connection_handler->receive_outstanding = false;
+            if (event->data && s_deliver_received_data(connection_handler, event->data)) {
+                aws_channel_shutdown(channel, aws_last_error());
+                break;
+            }
+            if (event->error_code) {
+                aws_channel_shutdown(channel, event->error_code);
+            } else if (event->read_complete) {
+                /* peer finished sending; same graceful path as a zero-byte socket read */
+                aws_channel_shutdown(channel, AWS_ERROR_SUCCESS);
+            } else {
+                s_post_receive(connection_handler);
+            }
+            break;
+        case NW_EVENT_WRITE_COMPLETED: {
+            struct aws_io_message *message = event->message;
+            event->message = NULL;
+            connection_handler->pending_write_bytes -= message->message_data.len;
+            connection_handler->stats.bytes_written += message->message_data.len;
+            aws_channel_touch_idle_timeout(channel);
+            if (message->on_completion) {
+                message->on_completion(channel, message, event->error_code, message->user_data);
+            }
+            aws_mem_release(message->allocator, message);
+            if (event->error_code) {
+                aws_channel_shutdown(channel, event->error_code);
+            }
+            break;
+        }
+    }
+
+done:
+    if (event->data) {
+        dispatch_release(event->data);
+    }
+    aws_mem_release(connection_handler->allocator, event);
+    s_handler_release(connection_handler);
+}
+
+/* channel thread: keeps exactly one receive outstanding, sized to the downstream window */
+static void s_post_receive(struct nw_connection_handler *connection_handler) {
+    if (connection_handler->receive_outstanding || connection_handler->shutdown_in_progress) {
+        return;
+    }
+
+    size_t window = SIZE_MAX;
+    if (connection_handler->slot->adj_right) {
+        window = aws_channel_slot_downstream_read_window(connection_handler->slot);
+    }
+    size_t max_fragment = aws_channel_get_max_fragment_size(connection_handler->slot->channel);
+    size_t max_receive = window < max_fragment ? window : max_fragment;
+    if (max_receive == 0) {
+        /* increment_read_window re-arms once downstream opens back up */
+        return;
+    }
+    if (max_receive > UINT32_MAX) {
+        max_receive = UINT32_MAX;
+    }
+
+    connection_handler->receive_outstanding = true;
+    s_handler_acquire(connection_handler);
+    struct nw_connection_handler *capture = connection_handler;
+    nw_connection_receive(
+        connection_handler->connection,
+        1,
+        (uint32_t)max_receive,
+        ^(dispatch_data_t content, nw_content_context_t context, bool is_complete, nw_error_t receive_error) {
+            if (!capture->active) {
+                s_handler_release(capture);
+                return;
+            }
+            dispatch_data_t retained = NULL;
+            if (content) {
+                dispatch_retain(content);
+                retained = content;
+            }
+            bool read_complete = is_complete && context != NULL && nw_content_context_get_is_final(context);
+            int error_code = receive_error ? s_error_code_from_nw_error(receive_error, true /*connected*/) : 0;
+            s_schedule_event(capture, NW_EVENT_DATA_RECEIVED, retained, NULL, error_code, read_complete);
+        });
+}
+
+/* vtable */
+
+static int s_nw_process_read_message(
+    struct aws_channel_handler *handler,
+    struct aws_channel_slot *slot,
+    struct aws_io_message *message) {
+    (void)handler;
+    (void)slot;
+    (void)message;
+    /* left-most handler; nothing is upstream to feed it */
+    return aws_raise_error(AWS_IO_CHANNEL_ERROR_ERROR_CANT_ACCEPT_INPUT);
+}
+
+static int s_nw_process_write_message(
+    struct aws_channel_handler *handler,
+    struct aws_channel_slot *slot,
+    struct aws_io_message *message) {
+    (void)slot;
+    struct nw_connection_handler *connection_handler = handler->impl;
+
+    if (connection_handler->shutdown_in_progress) {
+        return aws_raise_error(AWS_IO_SOCKET_CLOSED);
+    }
+
+    /* no-copy: the empty destructor means dispatch_data borrows the message's bytes; the message
+     * stays alive until the send completion hands it back for completion and release */
+    dispatch_data_t data = dispatch_data_create(
+        message->message_data.buffer, message->message_data.len, connection_handler->queue, ^{
+        });
+    if (!data) {
+        return aws_raise_error(AWS_ERROR_OOM);
+    }
+
+    connection_handler->pending_write_bytes += message->message_data.len;
+    s_handler_acquire(connection_handler);
+    struct nw_connection_handler *capture = connection_handler;
+    nw_connection_send(
+        connection_handler->connection, data, NW_CONNECTION_DEFAULT_MESSAGE_CONTEXT, false, ^(nw_error_t send_error) {
+            if (!capture->active) {
+                /* channel is gone; nobody left to run the completion callback */
+                aws_mem_release(message->allocator, message);
+                s_handler_release(capture);
+                return;
+            }
+            int error_code = send_error ? s_error_code_from_nw_error(send_error, true /*connected*/) : 0;
+            s_schedule_event(capture, NW_EVENT_WRITE_COMPLETED, NULL, message, error_code, false);
+        });
+    dispatch_release(data);
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_nw_increment_read_window(struct aws_channel_handler *handler, struct aws_channel_slot *slot, size_t size) {
+    (void)slot;
+    (void)size;
+    struct nw_connection_handler *connection_handler = handler->impl;
+    s_post_receive(connection_handler);
+    return AWS_OP_SUCCESS;
+}
+
+static int s_nw_shutdown(
+    struct aws_channel_handler *handler,
+    struct aws_channel_slot *slot,
+    enum aws_channel_direction dir,
+    int error_code,
+    bool free_scarce_resource_immediately) {
+    struct nw_connection_handler *connection_handler = handler->impl;
+
+    connection_handler->shutdown_in_progress = true;
+
+    if (dir == AWS_CHANNEL_DIR_WRITE || free_scarce_resource_immediately) {
+        /* quiesce completions before cancelling so nothing schedules onto the draining channel */
+        struct nw_connection_handler *capture = connection_handler;
+        dispatch_async(connection_handler->queue, ^{
+            capture->active = false;
+        });
+        nw_connection_cancel(connection_handler->connection);
+    }
+
+    return aws_channel_slot_on_handler_shutdown_complete(slot, dir, error_code, free_scarce_resource_immediately);
+}
+
+static size_t s_nw_initial_window_size(struct aws_channel_handler *handler) {
+    (void)handler;
+    return SIZE_MAX;
+}
+
+static size_t s_nw_message_overhead(struct aws_channel_handler *handler) {
+    (void)handler;
+    return 0;
+}
+
+static void s_nw_destroy(struct aws_channel_handler *handler) {
+    if (handler == NULL) {
+        return;
+    }
+    struct nw_connection_handler *connection_handler = handler->impl;
+
+    /* synchronous barrier: after this, no completion block schedules another channel task */
+    struct nw_connection_handler *capture = connection_handler;
+    dispatch_sync(connection_handler->queue, ^{
+        capture->active = false;
+    });
+
+    s_handler_release(connection_handler);
+}
+
+static void s_nw_reset_statistics(struct aws_channel_handler *handler) {
+    struct nw_connection_handler *connection_handler = handler->impl;
+    aws_crt_statistics_socket_reset(&connection_handler->stats);
+}
+
+static void s_nw_gather_statistics(struct aws_channel_handler *handler, struct aws_array_list *stats_list) {
+    struct nw_connection_handler *connection_handler = handler->impl;
+
+    connection_handler->stats.bytes_queued_write = connection_handler->pending_write_bytes;
+    connection_handler->stats.read_window_remaining = connection_handler->slot->adj_right
+                                                          ? aws_channel_slot_downstream_read_window(
+                                                                connection_handler->slot)
+                                                          : 0;
+
+    void *stats_base = &connection_handler->stats;
+    aws_array_list_push_back(stats_list, &stats_base);
+}
+
+static void s_nw_trigger_read(struct aws_channel_handler *handler) {
+    struct nw_connection_handler *connection_handler = handler->impl;
+    s_post_receive(connection_handler);
+}
+
+static struct aws_channel_handler_vtable s_nw_connection_vtable = {
+    .process_read_message = s_nw_process_read_message,
+    .process_write_message = s_nw_process_write_message,
+    .increment_read_window = s_nw_increment_read_window,
+    .shutdown = s_nw_shutdown,
+    .initial_window_size = s_nw_initial_window_size,
+    .message_overhead = s_nw_message_overhead,
+    .destroy = s_nw_destroy,
+    .reset_statistics = s_nw_reset_statistics,
+    .gather_statistics = s_nw_gather_statistics,
+    .trigger_read = s_nw_trigger_read,
+};
+
+/* bootstrap plumbing */
+
+static void s_destroy_channel_args(struct nw_channel_args *args) {
+    aws_string_destroy(args->host_name);
+    aws_string_destroy(args->alpn_list);
+    aws_client_bootstrap_release(args->bootstrap);
+    aws_mem_release(args->allocator, args);
+}
+
+/* adds each semi-colon delimited token of the alpn list to the connection's TLS options */
+static void s_apply_alpn_list(sec_protocol_options_t sec_options, const struct aws_string *alpn_list) {
+    const char *cursor = aws_string_c_str(alpn_list);
+    while (*cursor) {
+        const char *delimiter = strchr(cursor, ';');
+        size_t token_len = delimiter ? (size_t)(delimiter - cursor) : strlen(cursor);
+        char token[256];
+        if (token_len > 0 && token_len < sizeof(token)) {
+            memcpy(token, cursor, token_len);
+            token[token_len] = '\0';
+            sec_protocol_options_add_tls_application_protocol(sec_options, token);
+        }
+        cursor = delimiter ? delimiter + 1 : cursor + token_len;
+    }
+}
+
+static void s_on_channel_setup_complete(struct aws_channel *channel, int error_code, void *user_data) {
+    struct nw_channel_args *args = user_data;
+
+    if (error_code) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_CHANNEL_BOOTSTRAP, "static: nw_connection channel setup failed with error %d", error_code);
+        goto error;
+    }
+
+    args->channel = channel;
+
+    struct aws_channel_slot *slot = aws_channel_slot_new(channel);
+    if (!slot) {
+        error_code = aws_last_error();
+        goto error;
+    }
+
+    struct nw_connection_handler *connection_handler =
+        aws_mem_calloc(args->allocator, 1, sizeof(struct nw_connection_handler));
+    if (!connection_handler) {
+        error_code = aws_last_error();
+        goto error;
+    }
+
+    connection_handler->allocator = args->allocator;
+    connection_handler->handler.alloc = args->allocator;
+    connection_handler->handler.impl = connection_handler;
+    connection_handler->handler.vtable = &s_nw_connection_vtable;
+    connection_handler->bootstrap_args = args;
+    aws_atomic_init_int(&connection_handler->ref_count, 1);
+    aws_crt_statistics_socket_init(&connection_handler->stats);
+
+    connection_handler->queue = dispatch_queue_create("aws-nw-connection", DISPATCH_QUEUE_SERIAL);
+
+    char port_str[16];
+    snprintf(port_str, sizeof(port_str), "%u", (unsigned)args->port);
+    nw_endpoint_t endpoint = nw_endpoint_create_host(aws_string_c_str(args->host_name), port_str);
+
+    nw_parameters_t parameters = NULL;
+    if (args->enable_tls) {
+        struct aws_string *alpn_list = args->alpn_list;
+        parameters = nw_parameters_create_secure_tcp(
+            ^(nw_protocol_options_t tls_options) {
+                if (alpn_list) {
+                    sec_protocol_options_t sec_options = nw_tls_copy_sec_protocol_options(tls_options);
+                    s_apply_alpn_list(sec_options, alpn_list);
+                    nw_release(sec_options);
+                }
+            },
+            NW_PARAMETERS_DEFAULT_CONFIGURATION);
+    } else {
+        parameters = nw_parameters_create_secure_tcp(NW_PARAMETERS_DISABLE_PROTOCOL, NW_PARAMETERS_DEFAULT_CONFIGURATION);
+    }
+    if (args->enable_multipath) {
+        nw_parameters_set_multipath_service(parameters, nw_multipath_service_handover);
+    }
+
+    connection_handler->connection = nw_connection_create(endpoint, parameters);
+    nw_release(endpoint);
+    nw_release(parameters);
+
+    if (!connection_handler->connection) {
+        s_handler_release(connection_handler);
+        error_code = AWS_ERROR_SYS_CALL_FAILURE;
+        aws_raise_error(error_code);
+        goto error;
+    }
+
+    if (aws_channel_slot_set_handler(slot, &connection_handler->handler)) {
+        error_code = aws_last_error();
+        s_handler_release(connection_handler);
+        goto error;
+    }
+    connection_handler->slot = slot;
+
+    AWS_LOGF_DEBUG(
+        AWS_LS_IO_CHANNEL_BOOTSTRAP,
+        "id=%p: starting nw_connection to %s:%u (tls=%d, multipath=%d)",
+        (void *)&connection_handler->handler,
+        aws_string_c_str(args->host_name),
+        (unsigned)args->port,
+        (int)args->enable_tls,
+        (int)args->enable_multipath);
+
+    connection_handler->active = true;
+    nw_connection_set_queue(connection_handler->connection, connection_handler->queue);
+
+    /* the state handler owns a reference until the cancelled state is delivered */
+    s_handler_acquire(connection_handler);
+    struct nw_connection_handler *capture = connection_handler;
+    nw_connection_set_state_changed_handler(
+        connection_handler->connection, ^(nw_connection_state_t state, nw_error_t state_error) {
+            switch (state) {
+                case nw_connection_state_ready:
+                    if (capture->active) {
+                        s_handler_acquire(capture);
+                        s_schedule_event(capture, NW_EVENT_CONNECTION_READY, NULL, NULL, 0, false);
+                    }
+                    break;
+                case nw_connection_state_failed:
+                    if (capture->active) {
+                        s_handler_acquire(capture);
+                        s_schedule_event(
+                            capture,
+                            NW_EVENT_CONNECTION_ERROR,
+                            NULL,
+                            NULL,
+                            s_error_code_from_nw_error(state_error, capture->bootstrap_args->setup_succeeded),
+                            false);
+                    }
+                    break;
+                case nw_connection_state_cancelled:
+                    s_handler_release(capture);
+                    break;
+                default:
+                    break;
+            }
+        });
+
+    nw_connection_start(connection_handler->connection);
+    return;
+
+error:
+    if (args->channel) {
+        /* slot/handler cleanup rides the normal channel teardown; the setup callback fires with
+         * the error from s_on_channel_shutdown_complete since setup never succeeded */
+        aws_channel_shutdown(args->channel, error_code);
+        return;
+    }
+    args->setup_callback(args->bootstrap, error_code, NULL, args->user_data);
+    s_destroy_channel_args(args);
+}
+
+static void s_on_channel_shutdown_complete(struct aws_channel *channel, int error_code, void *user_data) {
+    struct nw_channel_args *args = user_data;
+
+    if (!args->setup_succeeded) {
+        args->setup_callback(
+            args->bootstrap, error_code ? error_code : AWS_IO_SOCKET_CONNECT_ABORTED, NULL, args->user_data);
+    } else if (args->shutdown_callback) {
+        args->shutdown_callback(args->bootstrap, error_code, channel, args->user_data);
+    }
+
+    aws_channel_destroy(channel);
+    s_destroy_channel_args(args);
+}
+
+int aws_client_bootstrap_new_nw_connection_channel(const struct aws_nw_connection_channel_options *options) {
+    AWS_PRECONDITION(options);
+
+    if (!options->bootstrap || !options->host_name || !options->setup_callback) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    struct aws_allocator *allocator = options->bootstrap->allocator;
+    struct nw_channel_args *args = aws_mem_calloc(allocator, 1, sizeof(struct nw_channel_args));
+    if (!args) {
+        return AWS_OP_ERR;
+    }
+
+    args->allocator = allocator;
+    args->bootstrap = aws_client_bootstrap_acquire(options->bootstrap);
+    args->port = options->port;
+    args->enable_tls = options->enable_tls;
+    args->enable_multipath = options->enable_multipath;
+    args->setup_callback = options->setup_callback;
+    args->shutdown_callback = options->shutdown_callback;
+    args->user_data = options->user_data;
+
+    args->host_name = aws_string_new_from_c_str(allocator, options->host_name);
+    if (!args->host_name) {
+        goto error;
+    }
+    if (options->alpn_list) {
+        args->alpn_list = aws_string_new_from_c_str(allocator, options->alpn_list);
+        if (!args->alpn_list) {
+            goto error;
+        }
+    }
+
+    struct aws_event_loop *event_loop = options->requested_event_loop
+                                            ? options->requested_event_loop
+                                            : aws_event_loop_group_get_next_loop(
+                                                  options->bootstrap->event_loop_group);
+
+    struct aws_channel_options channel_options = {
+        .event_loop = event_loop,
+        .on_setup_completed = s_on_channel_setup_complete,
+        .on_shutdown_completed = s_on_channel_shutdown_complete,
+        .setup_user_data = args,
+        .shutdown_user_data = args,
+        .enable_read_back_pressure = options->enable_read_back_pressure,
+    };
+
+    if (!aws_channel_new(allocator, &channel_options)) {
+        goto error;
+    }
+
+    return AWS_OP_SUCCESS;
+
+error:
+    s_destroy_channel_args(args);
+    return AWS_OP_ERR;
+}
+
+#endif /* AWS_USE_APPLE_NETWORK_FRAMEWORK */
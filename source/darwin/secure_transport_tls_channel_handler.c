@@ -85,7 +85,11 @@ void aws_tls_init_static_state(struct aws_allocator *alloc) {
     }
 }
 
-void aws_tls_clean_up_static_state(void) { /* no op */ }
+void aws_tls_clean_up_static_state(void) {
+#if !defined(AWS_OS_IOS)
+    aws_pki_release_identity_cache();
+#endif
+}
 
 struct secure_transport_handler {
     struct aws_channel_handler handler;
@@ -756,6 +760,12 @@ struct aws_byte_buf aws_tls_handler_protocol(struct aws_channel_handler *handler
     return secure_transport_handler->protocol;
 }
 
+enum aws_tls_early_data_status aws_tls_handler_early_data_status(struct aws_channel_handler *handler) {
+    /* Secure Transport does not support sending 0-RTT early data. */
+    (void)handler;
+    return AWS_TLS_EARLY_DATA_STATUS_NONE;
+}
+
 struct aws_byte_buf aws_tls_handler_server_name(struct aws_channel_handler *handler) {
     struct secure_transport_handler *secure_transport_handler = handler->impl;
     const uint8_t *bytes = NULL;
@@ -787,6 +797,7 @@ struct secure_transport_ctx {
     enum aws_tls_versions minimum_version;
     struct aws_string *alpn_list;
     bool veriify_peer;
+    bool session_cache_enabled;
 };
 
 static struct aws_channel_handler *s_tls_handler_new(
@@ -911,6 +922,13 @@ static struct aws_channel_handler *s_tls_handler_new(
         secure_transport_handler->server_name = aws_string_new_from_string(allocator, options->server_name);
         size_t server_name_len = options->server_name->len;
         SSLSetPeerDomainName(secure_transport_handler->ctx, aws_string_c_str(options->server_name), server_name_len);
+
+        /* Setting a peer id opts this connection into Secure Transport's process-wide session cache, enabling
+         * resumption across connections to the same server. External session stores are not supported here. */
+        if (secure_transport_ctx->session_cache_enabled && protocol_side == kSSLClientSide) {
+            SSLSetPeerID(
+                secure_transport_handler->ctx, aws_string_bytes(options->server_name), options->server_name->len);
+        }
     }
 
     struct aws_string *alpn_list = NULL;
@@ -1004,6 +1022,25 @@ static struct aws_tls_ctx *s_tls_ctx_new(struct aws_allocator *alloc, const stru
     }
 
     secure_transport_ctx->veriify_peer = options->verify_peer;
+    if (options->on_chain_validation != NULL) {
+        AWS_LOGF_WARN(
+            AWS_LS_IO_TLS,
+            "static: asynchronous chain validation callbacks are not supported with Secure Transport; "
+            "validation runs inline as before.");
+    }
+    if (options->verification_cache_enabled) {
+        AWS_LOGF_WARN(
+            AWS_LS_IO_TLS,
+            "static: verification verdict caching is not supported with Secure Transport; "
+            "chains are verified on every handshake.");
+    }
+    secure_transport_ctx->session_cache_enabled = options->session_cache_enabled;
+    if (options->session_cache_enabled && options->session_cache_options.put_fn != NULL) {
+        AWS_LOGF_WARN(
+            AWS_LS_IO_TLS,
+            "static: external session store callbacks are not supported with Secure Transport; "
+            "the OS session cache will be used instead.");
+    }
     secure_transport_ctx->ca_cert = NULL;
     secure_transport_ctx->certs = NULL;
     secure_transport_ctx->ctx.alloc = alloc;
@@ -43,7 +43,20 @@ static void s_aws_event_loop_group_shutdown_sync(struct aws_event_loop_group *el
         aws_array_list_pop_back(&el_group->event_loops);
     }
 
+    /* loops retired by aws_event_loop_group_shrink() keep running until the group dies */
+    while (aws_array_list_length(&el_group->retired_event_loops) > 0) {
+        struct aws_event_loop *loop = NULL;
+
+        if (!aws_array_list_back(&el_group->retired_event_loops, &loop)) {
+            aws_event_loop_destroy(loop);
+        }
+
+        aws_array_list_pop_back(&el_group->retired_event_loops);
+    }
+
     aws_array_list_clean_up(&el_group->event_loops);
+    aws_array_list_clean_up(&el_group->retired_event_loops);
+    aws_rw_lock_clean_up(&el_group->loops_lock);
 }
 
 static void s_event_loop_destroy_async_thread_fn(void *thread_data) {
@@ -78,6 +91,8 @@ static struct aws_event_loop_group *s_event_loop_group_new(
     uint16_t el_count,
     uint16_t cpu_group,
     bool pin_threads,
+    const uint16_t *explicit_cpu_ids,
+    size_t explicit_cpu_id_count,
     aws_new_event_loop_fn *new_loop_fn,
     void *new_loop_user_data,
     const struct aws_shutdown_callback_options *shutdown_options) {
@@ -86,7 +101,14 @@ static struct aws_event_loop_group *s_event_loop_group_new(
     size_t group_cpu_count = 0;
     struct aws_cpu_info *usable_cpus = NULL;
 
-    if (pin_threads) {
+    if (explicit_cpu_ids != NULL) {
+        /* the caller's CPU set is authoritative: one loop per listed CPU */
+        if (explicit_cpu_id_count == 0 || explicit_cpu_id_count > UINT16_MAX) {
+            aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+            return NULL;
+        }
+        el_count = (uint16_t)explicit_cpu_id_count;
+    } else if (pin_threads) {
         group_cpu_count = aws_get_cpu_count_for_group(cpu_group);
 
         if (!group_cpu_count) {
@@ -109,16 +131,32 @@ static struct aws_event_loop_group *s_event_loop_group_new(
     }
 
     el_group->allocator = alloc;
+    el_group->cpu_group = cpu_group;
+    el_group->is_pinned = pin_threads;
+    el_group->clock = clock;
+    el_group->new_loop_fn = new_loop_fn;
+    el_group->new_loop_user_data = new_loop_user_data;
     aws_ref_count_init(
         &el_group->ref_count, el_group, (aws_simple_completion_callback *)s_aws_event_loop_group_shutdown_async);
 
+    if (aws_rw_lock_init(&el_group->loops_lock)) {
+        aws_mem_release(alloc, usable_cpus);
+        aws_mem_release(alloc, el_group);
+        return NULL;
+    }
+
     if (aws_array_list_init_dynamic(&el_group->event_loops, alloc, el_count, sizeof(struct aws_event_loop *))) {
         goto on_error;
     }
 
+    if (aws_array_list_init_dynamic(&el_group->retired_event_loops, alloc, 0, sizeof(struct aws_event_loop *))) {
+        goto on_error;
+    }
+
     for (uint16_t i = 0; i < el_count; ++i) {
         /* Don't pin to hyper-threads if a user cared enough to specify a NUMA node */
-        if (!pin_threads || (i < group_cpu_count && !usable_cpus[i].suspected_hyper_thread)) {
+        if (!pin_threads || explicit_cpu_ids != NULL ||
+            (i < group_cpu_count && !usable_cpus[i].suspected_hyper_thread)) {
             struct aws_thread_options thread_options = *aws_default_thread_options();
 
             struct aws_event_loop_options options = {
@@ -126,7 +164,9 @@ static struct aws_event_loop_group *s_event_loop_group_new(
                 .thread_options = &thread_options,
             };
 
-            if (pin_threads) {
+            if (explicit_cpu_ids != NULL) {
+                thread_options.cpu_id = (int32_t)explicit_cpu_ids[i];
+            } else if (pin_threads) {
                 thread_options.cpu_id = usable_cpus[i].cpu_id;
             }
 
@@ -155,6 +195,8 @@ static struct aws_event_loop_group *s_event_loop_group_new(
         }
     }
 
+    el_group->loops_created = aws_array_list_length(&el_group->event_loops);
+
     if (shutdown_options != NULL) {
         el_group->shutdown_options = *shutdown_options;
     }
@@ -189,7 +231,8 @@ struct aws_event_loop_group *aws_event_loop_group_new(
     AWS_ASSERT(new_loop_fn);
     AWS_ASSERT(el_count);
 
-    return s_event_loop_group_new(alloc, clock, el_count, 0, false, new_loop_fn, new_loop_user_data, shutdown_options);
+    return s_event_loop_group_new(
+        alloc, clock, el_count, 0, false, NULL, 0, new_loop_fn, new_loop_user_data, shutdown_options);
 }
 
 static struct aws_event_loop *s_default_new_event_loop(
@@ -227,7 +270,42 @@ struct aws_event_loop_group *aws_event_loop_group_new_pinned_to_cpu_group(
     AWS_ASSERT(el_count);
 
     return s_event_loop_group_new(
-        alloc, clock, el_count, cpu_group, true, new_loop_fn, new_loop_user_data, shutdown_options);
+        alloc, clock, el_count, cpu_group, true, NULL, 0, new_loop_fn, new_loop_user_data, shutdown_options);
+}
+
+struct aws_event_loop_group *aws_event_loop_group_new_pinned(
+    struct aws_allocator *alloc,
+    aws_io_clock_fn *clock,
+    const struct aws_event_loop_group_pinning_options *pinning_options,
+    aws_new_event_loop_fn *new_loop_fn,
+    void *new_loop_user_data,
+    const struct aws_shutdown_callback_options *shutdown_options) {
+    AWS_ASSERT(new_loop_fn);
+
+    if (pinning_options == NULL || pinning_options->cpu_ids == NULL || pinning_options->cpu_id_count == 0) {
+        aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        return NULL;
+    }
+
+    return s_event_loop_group_new(
+        alloc,
+        clock,
+        0 /* derived from the cpu id list */,
+        pinning_options->cpu_group,
+        true,
+        pinning_options->cpu_ids,
+        pinning_options->cpu_id_count,
+        new_loop_fn,
+        new_loop_user_data,
+        shutdown_options);
+}
+
+bool aws_event_loop_group_get_cpu_group(const struct aws_event_loop_group *el_group, uint16_t *out_cpu_group) {
+    AWS_PRECONDITION(el_group != NULL);
+    AWS_PRECONDITION(out_cpu_group != NULL);
+
+    *out_cpu_group = el_group->cpu_group;
+    return el_group->is_pinned;
 }
 
 struct aws_event_loop_group *aws_event_loop_group_new_default_pinned_to_cpu_group(
@@ -261,37 +339,66 @@ void aws_event_loop_group_release(struct aws_event_loop_group *el_group) {
 }
 
 size_t aws_event_loop_group_get_loop_count(struct aws_event_loop_group *el_group) {
-    return aws_array_list_length(&el_group->event_loops);
+    aws_rw_lock_rlock(&el_group->loops_lock);
+    size_t count = aws_array_list_length(&el_group->event_loops);
+    aws_rw_lock_runlock(&el_group->loops_lock);
+    return count;
 }
 
 struct aws_event_loop *aws_event_loop_group_get_loop_at(struct aws_event_loop_group *el_group, size_t index) {
     struct aws_event_loop *el = NULL;
+    aws_rw_lock_rlock(&el_group->loops_lock);
     aws_array_list_get_at(&el_group->event_loops, &el, index);
+    aws_rw_lock_runlock(&el_group->loops_lock);
     return el;
 }
 
+/* cheap per-thread xorshift32, seeded once from the device random source. Loop selection happens on
+ * every channel setup, and hitting an actual entropy source each time is measurable under connection
+ * churn; statistical-quality randomness is all best-of-two needs. */
+static AWS_THREAD_LOCAL uint32_t tl_loop_selection_rng_state = 0;
+
+static uint32_t s_loop_selection_random(void) {
+    uint32_t state = tl_loop_selection_rng_state;
+    if (AWS_UNLIKELY(state == 0)) {
+        aws_device_random_u32(&state);
+        /* xorshift has a single fixed point at zero; nudge it off */
+        state |= 1u;
+    }
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    tl_loop_selection_rng_state = state;
+    return state;
+}
+
 struct aws_event_loop *aws_event_loop_group_get_next_loop(struct aws_event_loop_group *el_group) {
+    aws_rw_lock_rlock(&el_group->loops_lock);
+
     size_t loop_count = aws_array_list_length(&el_group->event_loops);
     AWS_ASSERT(loop_count > 0);
     if (loop_count == 0) {
+        aws_rw_lock_runlock(&el_group->loops_lock);
         return NULL;
     }
 
-    /* do one call to get 32 random bits because this hits an actual entropy source and it's not cheap */
-    uint32_t random_32_bit_num = 0;
-    aws_device_random_u32(&random_32_bit_num);
+    uint32_t random_32_bit_num = s_loop_selection_random();
 
-    /* use the best of two algorithm to select the loop with the lowest load.
-     * If we find device random is too hard on the kernel, we can seed it and use another random
-     * number generator. */
+    /* use the best of two algorithm to select the loop with the lowest load. */
 
-    /* it's fine and intentional, the case will throw off the top 16 bits and that's what we want. */
+    /* it's fine and intentional, the cast will throw off the top 16 bits and that's what we want. */
     uint16_t random_num_a = (uint16_t)random_32_bit_num;
     random_num_a = random_num_a % loop_count;
 
     uint16_t random_num_b = (uint16_t)(random_32_bit_num >> 16);
     random_num_b = random_num_b % loop_count;
 
+    /* sampling the same loop twice degenerates to plain random assignment, which matters most with
+     * small groups (a two-loop group would ignore load half the time). Force distinct probes. */
+    if (random_num_a == random_num_b && loop_count > 1) {
+        random_num_b = (uint16_t)((random_num_b + 1) % loop_count);
+    }
+
     struct aws_event_loop *random_loop_a = NULL;
     struct aws_event_loop *random_loop_b = NULL;
     aws_array_list_get_at(&el_group->event_loops, &random_loop_a, random_num_a);
@@ -300,12 +407,121 @@ struct aws_event_loop *aws_event_loop_group_get_next_loop(struct aws_event_loop_
     /* there's no logical reason why this should ever be possible. It's just best to die if it happens. */
     AWS_FATAL_ASSERT((random_loop_a && random_loop_b) && "random_loop_a or random_loop_b is NULL.");
 
+    aws_rw_lock_runlock(&el_group->loops_lock);
+
     size_t load_a = aws_event_loop_get_load_factor(random_loop_a);
     size_t load_b = aws_event_loop_get_load_factor(random_loop_b);
 
     return load_a < load_b ? random_loop_a : random_loop_b;
 }
 
+int aws_event_loop_group_grow(struct aws_event_loop_group *el_group, size_t additional_loop_count) {
+    AWS_PRECONDITION(el_group != NULL);
+
+    if (additional_loop_count == 0) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    if (el_group->is_pinned) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_EVENT_LOOP,
+            "elg %p: cannot grow a pinned event loop group; it is sized to its cpu set",
+            (void *)el_group);
+        return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+    }
+
+    int result = AWS_OP_SUCCESS;
+    aws_rw_lock_wlock(&el_group->loops_lock);
+
+    for (size_t i = 0; i < additional_loop_count; ++i) {
+        struct aws_thread_options thread_options = *aws_default_thread_options();
+
+        struct aws_event_loop_options options = {
+            .clock = el_group->clock,
+            .thread_options = &thread_options,
+        };
+
+        /* Thread name should be <= 15 characters */
+        char thread_name[32] = {0};
+        int thread_name_len =
+            snprintf(thread_name, sizeof(thread_name), "AwsEventLoop %d", (int)(el_group->loops_created + 1));
+        if (thread_name_len > AWS_THREAD_NAME_RECOMMENDED_STRLEN) {
+            snprintf(thread_name, sizeof(thread_name), "AwsEventLoop");
+        }
+        thread_options.name = aws_byte_cursor_from_c_str(thread_name);
+
+        struct aws_event_loop *loop =
+            el_group->new_loop_fn(el_group->allocator, &options, el_group->new_loop_user_data);
+
+        if (!loop) {
+            result = AWS_OP_ERR;
+            break;
+        }
+
+        if (aws_event_loop_run(loop) || aws_array_list_push_back(&el_group->event_loops, (const void *)&loop)) {
+            aws_event_loop_destroy(loop);
+            result = AWS_OP_ERR;
+            break;
+        }
+
+        el_group->loops_created++;
+
+        AWS_LOGF_INFO(
+            AWS_LS_IO_EVENT_LOOP, "elg %p: grew group with new event loop %p", (void *)el_group, (void *)loop);
+    }
+
+    aws_rw_lock_wunlock(&el_group->loops_lock);
+    return result;
+}
+
+int aws_event_loop_group_shrink(struct aws_event_loop_group *el_group, size_t loops_to_retire) {
+    AWS_PRECONDITION(el_group != NULL);
+
+    if (loops_to_retire == 0) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    if (el_group->is_pinned) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_EVENT_LOOP,
+            "elg %p: cannot shrink a pinned event loop group; it is sized to its cpu set",
+            (void *)el_group);
+        return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+    }
+
+    int result = AWS_OP_SUCCESS;
+    aws_rw_lock_wlock(&el_group->loops_lock);
+
+    if (loops_to_retire >= aws_array_list_length(&el_group->event_loops)) {
+        /* a group with zero selectable loops would break every get_next_loop() caller */
+        result = aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        goto done;
+    }
+
+    for (size_t i = 0; i < loops_to_retire; ++i) {
+        struct aws_event_loop *loop = NULL;
+        aws_array_list_back(&el_group->event_loops, &loop);
+        aws_array_list_pop_back(&el_group->event_loops);
+
+        if (aws_array_list_push_back(&el_group->retired_event_loops, (const void *)&loop)) {
+            /* capacity for the re-push is guaranteed: we just popped this slot */
+            aws_array_list_push_back(&el_group->event_loops, (const void *)&loop);
+            result = AWS_OP_ERR;
+            goto done;
+        }
+
+        AWS_LOGF_INFO(
+            AWS_LS_IO_EVENT_LOOP,
+            "elg %p: retired event loop %p from selection; it runs until the group shuts down",
+            (void *)el_group,
+            (void *)loop);
+    }
+
+done:
+    aws_rw_lock_wunlock(&el_group->loops_lock);
+    return result;
+}
+
 static void s_object_removed(void *value) {
     struct aws_event_loop_local_object *object = (struct aws_event_loop_local_object *)value;
     if (object->on_object_removed) {
@@ -313,6 +529,68 @@ static void s_object_removed(void *value) {
     }
 }
 
+static void s_histogram_init(struct aws_event_loop_histogram *histogram) {
+    for (size_t i = 0; i < AWS_EVENT_LOOP_HISTOGRAM_BUCKET_COUNT; ++i) {
+        aws_atomic_init_int(&histogram->buckets[i], 0u);
+    }
+    aws_atomic_init_int(&histogram->sample_count, 0u);
+    aws_atomic_init_int(&histogram->max_sample, 0u);
+}
+
+/* single writer (the loop thread); relaxed loads and stores keep a sample down to a few
+ * uncontended cache accesses, no RMW instructions on the hot path. */
+static void s_histogram_record(struct aws_event_loop_histogram *histogram, uint64_t value) {
+    size_t bucket = 0;
+    for (uint64_t v = value; v > 1 && bucket < AWS_EVENT_LOOP_HISTOGRAM_BUCKET_COUNT - 1; v >>= 1) {
+        ++bucket;
+    }
+
+    size_t count = aws_atomic_load_int_explicit(&histogram->buckets[bucket], aws_memory_order_relaxed);
+    aws_atomic_store_int_explicit(&histogram->buckets[bucket], count + 1, aws_memory_order_relaxed);
+
+    count = aws_atomic_load_int_explicit(&histogram->sample_count, aws_memory_order_relaxed);
+    aws_atomic_store_int_explicit(&histogram->sample_count, count + 1, aws_memory_order_relaxed);
+
+    size_t clamped = (size_t)aws_min_u64(value, SIZE_MAX);
+    if (clamped > aws_atomic_load_int_explicit(&histogram->max_sample, aws_memory_order_relaxed)) {
+        aws_atomic_store_int_explicit(&histogram->max_sample, clamped, aws_memory_order_relaxed);
+    }
+}
+
+static void s_histogram_snapshot(
+    const struct aws_event_loop_histogram *histogram,
+    struct aws_event_loop_histogram_snapshot *snapshot) {
+    for (size_t i = 0; i < AWS_EVENT_LOOP_HISTOGRAM_BUCKET_COUNT; ++i) {
+        snapshot->buckets[i] = aws_atomic_load_int_explicit(&histogram->buckets[i], aws_memory_order_relaxed);
+    }
+    snapshot->sample_count = aws_atomic_load_int_explicit(&histogram->sample_count, aws_memory_order_relaxed);
+    snapshot->max_sample = aws_atomic_load_int_explicit(&histogram->max_sample, aws_memory_order_relaxed);
+}
+
+void aws_event_loop_fetch_tick_stats(
+    struct aws_event_loop *event_loop,
+    struct aws_event_loop_tick_stats_snapshot *snapshot) {
+    AWS_PRECONDITION(event_loop != NULL);
+    AWS_PRECONDITION(snapshot != NULL);
+
+    s_histogram_snapshot(&event_loop->tick_stats.io_events_per_wait, &snapshot->io_events_per_wait);
+    s_histogram_snapshot(&event_loop->tick_stats.task_queue_depth, &snapshot->task_queue_depth);
+    s_histogram_snapshot(&event_loop->tick_stats.task_latency_ns, &snapshot->task_latency_ns);
+    s_histogram_snapshot(&event_loop->tick_stats.tick_duration_ns, &snapshot->tick_duration_ns);
+}
+
+void aws_event_loop_register_wait_result(struct aws_event_loop *event_loop, size_t event_count) {
+    s_histogram_record(&event_loop->tick_stats.io_events_per_wait, event_count);
+}
+
+void aws_event_loop_register_task_queue_depth(struct aws_event_loop *event_loop, size_t depth) {
+    s_histogram_record(&event_loop->tick_stats.task_queue_depth, depth);
+}
+
+void aws_event_loop_register_task_latency(struct aws_event_loop *event_loop, uint64_t latency_ns) {
+    s_histogram_record(&event_loop->tick_stats.task_latency_ns, latency_ns);
+}
+
 int aws_event_loop_init_base(struct aws_event_loop *event_loop, struct aws_allocator *alloc, aws_io_clock_fn *clock) {
     AWS_ZERO_STRUCT(*event_loop);
 
@@ -320,6 +598,10 @@ int aws_event_loop_init_base(struct aws_event_loop *event_loop, struct aws_alloc
     event_loop->clock = clock;
     aws_atomic_init_int(&event_loop->current_load_factor, 0u);
     aws_atomic_init_int(&event_loop->next_flush_time, 0u);
+    s_histogram_init(&event_loop->tick_stats.io_events_per_wait);
+    s_histogram_init(&event_loop->tick_stats.task_queue_depth);
+    s_histogram_init(&event_loop->tick_stats.task_latency_ns);
+    s_histogram_init(&event_loop->tick_stats.tick_duration_ns);
 
     if (aws_hash_table_init(&event_loop->local_data, alloc, 20, aws_hash_ptr, aws_ptr_eq, NULL, s_object_removed)) {
         return AWS_OP_ERR;
@@ -336,6 +618,16 @@ void aws_event_loop_register_tick_start(struct aws_event_loop *event_loop) {
     aws_high_res_clock_get_ticks(&event_loop->latest_tick_start);
 }
 
+bool aws_event_loop_tick_budget_exhausted(struct aws_event_loop *event_loop) {
+    if (event_loop->tick_budget_ns == 0 || event_loop->latest_tick_start == 0) {
+        return false;
+    }
+
+    uint64_t now = 0;
+    aws_high_res_clock_get_ticks(&now);
+    return now - event_loop->latest_tick_start > event_loop->tick_budget_ns;
+}
+
 void aws_event_loop_register_tick_end(struct aws_event_loop *event_loop) {
     /* increment the timestamp diff counter (this should always be called from the same thread), the concurrency
      * work happens during the flush. */
@@ -344,6 +636,7 @@ void aws_event_loop_register_tick_end(struct aws_event_loop *event_loop) {
 
     size_t elapsed = (size_t)aws_min_u64(end_tick - event_loop->latest_tick_start, SIZE_MAX);
     event_loop->current_tick_latency_sum = aws_add_size_saturating(event_loop->current_tick_latency_sum, elapsed);
+    s_histogram_record(&event_loop->tick_stats.tick_duration_ns, end_tick - event_loop->latest_tick_start);
     event_loop->latest_tick_start = 0;
 
     size_t next_flush_time_secs = aws_atomic_load_int(&event_loop->next_flush_time);
@@ -467,6 +760,16 @@ void aws_event_loop_schedule_task_now(struct aws_event_loop *event_loop, struct
     event_loop->vtable->schedule_task_now(event_loop, task);
 }
 
+void aws_event_loop_schedule_task_now_background(struct aws_event_loop *event_loop, struct aws_task *task) {
+    AWS_ASSERT(event_loop->vtable && event_loop->vtable->schedule_task_now);
+    AWS_ASSERT(task);
+    if (event_loop->vtable->schedule_task_now_background) {
+        event_loop->vtable->schedule_task_now_background(event_loop, task);
+        return;
+    }
+    event_loop->vtable->schedule_task_now(event_loop, task);
+}
+
 void aws_event_loop_schedule_task_future(
     struct aws_event_loop *event_loop,
     struct aws_task *task,
@@ -33,6 +33,9 @@ struct exponential_backoff_retry_token {
     uint64_t (*generate_random)(void);
     aws_generate_random_fn *generate_random_impl;
     void *generate_random_user_data;
+    /* state for the default jitter source, seeded once from the device random source at token creation.
+     * No synchronization needed: a token drives one retry at a time. */
+    uint64_t jitter_prng_state[4];
     struct aws_task retry_task;
 
     struct {
@@ -59,6 +62,52 @@ static void s_exponential_retry_destroy(struct aws_retry_strategy *retry_strateg
     }
 }
 
+/*
+ * Default jitter source: a per-token xoshiro256** generator seeded once from the device random source.
+ * Backoff jitter needs cheap, well-distributed numbers, not cryptographic quality, and reading the device
+ * source on every retry scheduling decision is a syscall we don't need to make.
+ */
+static uint64_t s_splitmix64_next(uint64_t *state) {
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static void s_seed_jitter_prng(struct exponential_backoff_retry_token *token) {
+    uint64_t seed = 0;
+    if (aws_device_random_u64(&seed)) {
+        /* not fatal, jitter just gets a weaker seed. */
+        aws_high_res_clock_get_ticks(&seed);
+        seed ^= (uint64_t)(uintptr_t)token;
+    }
+
+    /* splitmix64 is the recommended way to expand one seed into the xoshiro state words,
+     * which must not be all zero. */
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(token->jitter_prng_state); ++i) {
+        token->jitter_prng_state[i] = s_splitmix64_next(&seed);
+    }
+}
+
+static uint64_t s_rotl_u64(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+static uint64_t s_jitter_prng_next(struct exponential_backoff_retry_token *token) {
+    uint64_t *s = token->jitter_prng_state;
+    uint64_t result = s_rotl_u64(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = s_rotl_u64(s[3], 45);
+
+    return result;
+}
+
 static void s_exponential_retry_task(struct aws_task *task, void *arg, enum aws_task_status status) {
     (void)task;
 
@@ -106,12 +155,13 @@ static void s_exponential_retry_task(struct aws_task *task, void *arg, enum aws_
     aws_retry_token_release(&backoff_retry_token->base);
 }
 
-static int s_exponential_retry_acquire_token(
+static int s_exponential_retry_acquire_token_impl(
     struct aws_retry_strategy *retry_strategy,
     const struct aws_byte_cursor *partition_id,
     aws_retry_strategy_on_retry_token_acquired_fn *on_acquired,
     void *user_data,
-    uint64_t timeout_ms) {
+    uint64_t timeout_ms,
+    struct aws_event_loop *pinned_event_loop) {
     (void)partition_id;
     /* no resource contention here so no timeouts. */
     (void)timeout_ms;
@@ -136,7 +186,9 @@ static int s_exponential_retry_acquire_token(
     backoff_retry_token->base.impl = backoff_retry_token;
 
     struct exponential_backoff_strategy *exponential_backoff_strategy = retry_strategy->impl;
-    backoff_retry_token->bound_loop = aws_event_loop_group_get_next_loop(exponential_backoff_strategy->config.el_group);
+    backoff_retry_token->bound_loop = pinned_event_loop != NULL
+                                          ? pinned_event_loop
+                                          : aws_event_loop_group_get_next_loop(exponential_backoff_strategy->config.el_group);
     backoff_retry_token->max_retries = exponential_backoff_strategy->config.max_retries;
     backoff_retry_token->backoff_scale_factor_ns = aws_timestamp_convert(
         exponential_backoff_strategy->config.backoff_scale_factor_ms, AWS_TIMESTAMP_MILLIS, AWS_TIMESTAMP_NANOS, NULL);
@@ -147,6 +199,10 @@ static int s_exponential_retry_acquire_token(
     backoff_retry_token->generate_random_impl = exponential_backoff_strategy->config.generate_random_impl;
     backoff_retry_token->generate_random_user_data = exponential_backoff_strategy->config.generate_random_user_data;
 
+    if (!backoff_retry_token->generate_random && !backoff_retry_token->generate_random_impl) {
+        s_seed_jitter_prng(backoff_retry_token);
+    }
+
     aws_atomic_init_int(&backoff_retry_token->current_retry_count, 0);
     aws_atomic_init_int(&backoff_retry_token->last_backoff, 0);
 
@@ -160,11 +216,40 @@ static int s_exponential_retry_acquire_token(
         s_exponential_retry_task,
         backoff_retry_token,
         "aws_exponential_backoff_retry_task");
-    aws_event_loop_schedule_task_now(backoff_retry_token->bound_loop, &backoff_retry_token->retry_task);
+
+    /* when the token was pinned to the loop we're already running on, skip the task hop and
+     * vend the token inline. Only legal for the pinned variant: the plain acquire documents
+     * that on_acquired is never invoked synchronously. */
+    if (pinned_event_loop != NULL && aws_event_loop_thread_is_callers_thread(pinned_event_loop)) {
+        s_exponential_retry_task(&backoff_retry_token->retry_task, backoff_retry_token, AWS_TASK_STATUS_RUN_READY);
+    } else {
+        aws_event_loop_schedule_task_now(backoff_retry_token->bound_loop, &backoff_retry_token->retry_task);
+    }
 
     return AWS_OP_SUCCESS;
 }
 
+static int s_exponential_retry_acquire_token(
+    struct aws_retry_strategy *retry_strategy,
+    const struct aws_byte_cursor *partition_id,
+    aws_retry_strategy_on_retry_token_acquired_fn *on_acquired,
+    void *user_data,
+    uint64_t timeout_ms) {
+    return s_exponential_retry_acquire_token_impl(
+        retry_strategy, partition_id, on_acquired, user_data, timeout_ms, NULL /*pinned_event_loop*/);
+}
+
+static int s_exponential_retry_acquire_token_pinned(
+    struct aws_retry_strategy *retry_strategy,
+    const struct aws_byte_cursor *partition_id,
+    aws_retry_strategy_on_retry_token_acquired_fn *on_acquired,
+    void *user_data,
+    uint64_t timeout_ms,
+    struct aws_event_loop *pinned_event_loop) {
+    return s_exponential_retry_acquire_token_impl(
+        retry_strategy, partition_id, on_acquired, user_data, timeout_ms, pinned_event_loop);
+}
+
 static inline uint64_t s_random_in_range(uint64_t from, uint64_t to, struct exponential_backoff_retry_token *token) {
     uint64_t max = aws_max_u64(from, to);
     uint64_t min = aws_min_u64(from, to);
@@ -177,8 +262,10 @@ static inline uint64_t s_random_in_range(uint64_t from, uint64_t to, struct expo
     uint64_t random;
     if (token->generate_random_impl) {
         random = token->generate_random_impl(token->generate_random_user_data);
-    } else {
+    } else if (token->generate_random) {
         random = token->generate_random();
+    } else {
+        random = s_jitter_prng_next(token);
     }
     return min + random % (diff);
 }
@@ -316,15 +403,9 @@ static struct aws_retry_strategy_vtable s_exponential_retry_vtable = {
     .schedule_retry = s_exponential_retry_schedule_retry,
     .record_success = s_exponential_backoff_record_success,
     .release_token = s_exponential_backoff_release_token,
+    .acquire_token_pinned = s_exponential_retry_acquire_token_pinned,
 };
 
-static uint64_t s_default_gen_rand(void *user_data) {
-    (void)user_data;
-    uint64_t res = 0;
-    aws_device_random_u64(&res);
-    return res;
-}
-
 struct aws_retry_strategy *aws_retry_strategy_new_exponential_backoff(
     struct aws_allocator *allocator,
     const struct aws_exponential_backoff_retry_options *config) {
@@ -363,11 +444,6 @@ struct aws_retry_strategy *aws_retry_strategy_new_exponential_backoff(
     exponential_backoff_strategy->config.el_group =
         aws_ref_count_acquire(&exponential_backoff_strategy->config.el_group->ref_count);
 
-    if (!exponential_backoff_strategy->config.generate_random &&
-        !exponential_backoff_strategy->config.generate_random_impl) {
-        exponential_backoff_strategy->config.generate_random_impl = s_default_gen_rand;
-    }
-
     if (!exponential_backoff_strategy->config.max_retries) {
         exponential_backoff_strategy->config.max_retries = 5;
     }
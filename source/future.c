@@ -4,6 +4,7 @@
  */
 #include <aws/io/future.h>
 
+#include <aws/common/atomics.h>
 #include <aws/common/condition_variable.h>
 #include <aws/common/mutex.h>
 #include <aws/common/ref_count.h>
@@ -33,11 +34,28 @@ struct aws_future_callback_data {
     } type;
 };
 
+/* Lifecycle of a future, tracked in an atomic so completion and callback registration
+ * don't need the lock.  The lock and condition variable only come into play when someone
+ * blocks in aws_future_impl_wait(). */
+enum aws_future_state {
+    AWS_FUTURE_STATE_PENDING = 0,
+    /* callback stored, waiting for completion */
+    AWS_FUTURE_STATE_REGISTERED = 1,
+    /* a completer won the claim and is writing the result */
+    AWS_FUTURE_STATE_COMPLETING = 2,
+    AWS_FUTURE_STATE_DONE = 3,
+};
+
 /* When allocating aws_future<T> on the heap, we make 1 allocation containing:
  * aws_future_impl followed by T */
 struct aws_future_impl {
     struct aws_allocator *alloc;
     struct aws_ref_count ref_count;
+    /* holds an aws_future_state */
+    struct aws_atomic_var state;
+    /* number of threads blocked in aws_future_impl_wait(); completion only touches the
+     * lock/cvar when this is nonzero */
+    struct aws_atomic_var wait_count;
     struct aws_mutex lock;
     struct aws_condition_variable wait_cvar;
     struct aws_future_callback_data callback;
@@ -48,13 +66,18 @@ struct aws_future_impl {
     } result_dtor;
     int error_code;
     /* sum of bit fields should be 32 */
-#define BIT_COUNT_FOR_SIZEOF_RESULT 27
+#define BIT_COUNT_FOR_SIZEOF_RESULT 28
     unsigned int sizeof_result : BIT_COUNT_FOR_SIZEOF_RESULT;
     unsigned int type : 3; /* aws_future_type */
-    unsigned int is_done : 1;
     unsigned int owns_result : 1;
 };
 
+static bool s_future_impl_state_is_done(const struct aws_future_impl *future) {
+    /* conceptually const; atomics API wants a mutable pointer */
+    struct aws_atomic_var *mutable_state = (struct aws_atomic_var *)&future->state;
+    return aws_atomic_load_int(mutable_state) == AWS_FUTURE_STATE_DONE;
+}
+
 static void s_future_impl_result_dtor(struct aws_future_impl *future, void *result_addr) {
     switch (future->type) {
         case AWS_FUTURE_T_BY_VALUE_WITH_CLEAN_UP: {
@@ -101,6 +124,8 @@ static struct aws_future_impl *s_future_impl_new(struct aws_allocator *alloc, si
     future->sizeof_result = (unsigned int)sizeof_result;
 
     aws_ref_count_init(&future->ref_count, future, s_future_impl_destroy);
+    aws_atomic_init_int(&future->state, AWS_FUTURE_STATE_PENDING);
+    aws_atomic_init_int(&future->wait_count, 0);
     aws_mutex_init(&future->lock);
     aws_condition_variable_init(&future->wait_cvar);
     return future;
@@ -169,29 +194,20 @@ struct aws_future_impl *aws_future_impl_acquire(struct aws_future_impl *future)
 bool aws_future_impl_is_done(const struct aws_future_impl *future) {
     AWS_ASSERT(future);
 
-    /* this function is conceptually const, but we need to hold the lock a moment */
-    struct aws_mutex *mutable_lock = (struct aws_mutex *)&future->lock;
-
-    /* BEGIN CRITICAL SECTION */
-    aws_mutex_lock(mutable_lock);
-    bool is_done = future->is_done != 0;
-    aws_mutex_unlock(mutable_lock);
-    /* END CRITICAL SECTION */
-
-    return is_done;
+    return s_future_impl_state_is_done(future);
 }
 
 int aws_future_impl_get_error(const struct aws_future_impl *future) {
     AWS_ASSERT(future != NULL);
-    /* not bothering with lock, none of this can change after future is done */
-    AWS_FATAL_ASSERT(future->is_done && "Cannot get error before future is done");
+    /* none of this can change after future is done */
+    AWS_FATAL_ASSERT(s_future_impl_state_is_done(future) && "Cannot get error before future is done");
     return future->error_code;
 }
 
 void *aws_future_impl_get_result_address(const struct aws_future_impl *future) {
     AWS_ASSERT(future != NULL);
-    /* not bothering with lock, none of this can change after future is done */
-    AWS_FATAL_ASSERT(future->is_done && "Cannot get result before future is done");
+    /* none of this can change after future is done */
+    AWS_FATAL_ASSERT(s_future_impl_state_is_done(future) && "Cannot get result before future is done");
     AWS_FATAL_ASSERT(!future->error_code && "Cannot get result from future that failed with an error");
     AWS_FATAL_ASSERT(future->owns_result && "Result was already moved from future");
 
@@ -282,37 +298,55 @@ static void s_future_impl_invoke_callback(struct aws_future_callback_data *callb
 static void s_future_impl_set_done(struct aws_future_impl *future, void *src_address, int error_code) {
     bool is_error = error_code != 0;
 
-    /* BEGIN CRITICAL SECTION */
-    aws_mutex_lock(&future->lock);
-
-    struct aws_future_callback_data callback = future->callback;
+    /* Claim the right to complete the future.
+     * COMPLETING keeps a concurrent register_callback() from touching future->callback
+     * while we're copying it out and writing the result. */
+    size_t prev_state = AWS_FUTURE_STATE_PENDING;
+    while (!aws_atomic_compare_exchange_int(&future->state, &prev_state, AWS_FUTURE_STATE_COMPLETING)) {
+        if (prev_state >= AWS_FUTURE_STATE_COMPLETING) {
+            /* future was already done, so just destroy this newer result */
+            if (!is_error) {
+                s_future_impl_result_dtor(future, src_address);
+            }
+            return;
+        }
+        /* prev_state was REGISTERED, retry the exchange from there */
+    }
 
-    bool first_time = !future->is_done;
-    if (first_time) {
-        future->is_done = true;
+    /* We won the claim: either PENDING->COMPLETING or REGISTERED->COMPLETING.
+     * Only touch future->callback if a registration was published; when we claimed from
+     * PENDING a racing register_callback() may still be writing its speculative store
+     * (it will see our state change, keep its local copy, and invoke it itself). */
+    struct aws_future_callback_data callback;
+    AWS_ZERO_STRUCT(callback);
+    if (prev_state == AWS_FUTURE_STATE_REGISTERED) {
+        callback = future->callback;
         AWS_ZERO_STRUCT(future->callback);
-        if (is_error) {
-            future->error_code = error_code;
-        } else {
-            future->owns_result = true;
-            AWS_FATAL_ASSERT(src_address != NULL);
-            memcpy(aws_future_impl_get_result_address(future), src_address, future->sizeof_result);
-        }
+    }
+    if (is_error) {
+        future->error_code = error_code;
+    } else {
+        future->owns_result = true;
+        AWS_FATAL_ASSERT(src_address != NULL);
+        memcpy(aws_future_impl_get_result_address(future), src_address, future->sizeof_result);
+    }
 
+    aws_atomic_store_int(&future->state, AWS_FUTURE_STATE_DONE);
+
+    /* Only bother with the lock/cvar if a thread is (or is about to be) blocked in wait().
+     * The seq-cst store of DONE above, paired with wait()'s increment of wait_count before
+     * it checks the state, ensures we can't both miss each other. */
+    if (aws_atomic_load_int(&future->wait_count) > 0) {
+        /* taking the lock ensures a waiter that saw state != DONE is parked on the cvar
+         * (or checking its predicate) before we signal, so the wakeup can't be lost */
+        aws_mutex_lock(&future->lock);
+        aws_mutex_unlock(&future->lock);
         aws_condition_variable_notify_all(&future->wait_cvar);
     }
 
-    aws_mutex_unlock(&future->lock);
-    /* END CRITICAL SECTION */
-
-    if (first_time) {
-        /* if callback was registered, invoke it now, outside of critical section to avoid deadlock */
-        if (callback.fn != NULL) {
-            s_future_impl_invoke_callback(&callback, future->alloc);
-        }
-    } else if (!error_code) {
-        /* future was already done, so just destroy this newer result */
-        s_future_impl_result_dtor(future, src_address);
+    /* if callback was registered, invoke it now, after completion, to avoid deadlock */
+    if (callback.fn != NULL) {
+        s_future_impl_invoke_callback(&callback, future->alloc);
     }
 }
 
@@ -345,27 +379,31 @@ static bool s_future_impl_register_callback(
     struct aws_future_callback_data *callback,
     bool invoke_if_already_done) {
 
-    /* BEGIN CRITICAL SECTION */
-    aws_mutex_lock(&future->lock);
+    /* Optimistically store the callback, then publish it by moving PENDING -> REGISTERED.
+     * If the future completes concurrently, the CAS fails and we take the already-done path;
+     * set_done() never reads future->callback unless it observed REGISTERED, so the
+     * speculative store is harmless. */
+    future->callback = *callback;
 
-    AWS_FATAL_ASSERT(future->callback.fn == NULL && "Future done callback must only be set once");
+    size_t prev_state = AWS_FUTURE_STATE_PENDING;
+    if (aws_atomic_compare_exchange_int(&future->state, &prev_state, AWS_FUTURE_STATE_REGISTERED)) {
+        /* callback stored for later, set_done() will invoke it */
+        return true;
+    }
 
-    bool already_done = future->is_done != 0;
+    AWS_FATAL_ASSERT(prev_state != AWS_FUTURE_STATE_REGISTERED && "Future done callback must only be set once");
 
-    /* if not done, store callback for later */
-    if (!already_done) {
-        future->callback = *callback;
+    /* future is completing on another thread right now, wait for the result to be in place */
+    while (prev_state == AWS_FUTURE_STATE_COMPLETING) {
+        prev_state = aws_atomic_load_int(&future->state);
     }
 
-    aws_mutex_unlock(&future->lock);
-    /* END CRITICAL SECTION */
-
-    /* if already done, invoke callback now */
-    if (already_done && invoke_if_already_done) {
+    /* already done, invoke callback now */
+    if (invoke_if_already_done) {
         s_future_impl_invoke_callback(callback, future->alloc);
     }
 
-    return !already_done || invoke_if_already_done;
+    return invoke_if_already_done;
 }
 
 void aws_future_impl_register_callback(
@@ -444,7 +482,7 @@ void aws_future_impl_register_channel_callback(
 
 static bool s_future_impl_is_done_pred(void *user_data) {
     struct aws_future_impl *future = user_data;
-    return future->is_done != 0;
+    return s_future_impl_state_is_done(future);
 }
 
 bool aws_future_impl_wait(const struct aws_future_impl *future, uint64_t timeout_ns) {
@@ -456,6 +494,11 @@ bool aws_future_impl_wait(const struct aws_future_impl *future, uint64_t timeout
     /* condition-variable takes signed timeout, so clamp to INT64_MAX (292+ years) */
     int64_t timeout_i64 = aws_min_u64(timeout_ns, INT64_MAX);
 
+    /* Announce ourselves before checking the state, so that a concurrent set_done()
+     * either sees our increment and signals the cvar, or we see its DONE store and
+     * never block. Both are seq-cst, so at least one side must observe the other. */
+    aws_atomic_fetch_add(&mutable_future->wait_count, 1);
+
     /* BEGIN CRITICAL SECTION */
     aws_mutex_lock(&mutable_future->lock);
 
@@ -469,6 +512,8 @@ bool aws_future_impl_wait(const struct aws_future_impl *future, uint64_t timeout
     aws_mutex_unlock(&mutable_future->lock);
     /* END CRITICAL SECTION */
 
+    aws_atomic_fetch_sub(&mutable_future->wait_count, 1);
+
     return is_done;
 }
 
@@ -544,3 +589,170 @@ void aws_future_void_set_result(struct aws_future_void *future) {
 }
 
 AWS_FUTURE_T_IMPLEMENTATION_END(aws_future_void)
+
+/**
+ * when_all / when_any combinators.
+ *
+ * One allocation holds the combinator and a small per-branch record
+ * (needed so each callback knows which input future completed).
+ * Completion is tracked with atomics; no lock is taken on any branch.
+ */
+
+struct aws_future_combinator;
+
+struct aws_future_combinator_branch {
+    struct aws_future_combinator *combinator;
+    struct aws_future_impl *future;
+};
+
+struct aws_future_combinator {
+    struct aws_allocator *alloc;
+    struct aws_future_impl *result;
+
+    /* branches whose callback hasn't fired yet; the branch that drops this to 0
+     * destroys the combinator */
+    struct aws_atomic_var remaining;
+
+    /* when_all: first nonzero error code observed (0 until then).
+     * when_any: index+1 of the winning branch (0 until claimed). */
+    struct aws_atomic_var status;
+
+    size_t count;
+    /* struct aws_future_combinator_branch branches[count] stored after this struct */
+};
+
+static struct aws_future_combinator_branch *s_future_combinator_get_branches(struct aws_future_combinator *combinator) {
+    return (struct aws_future_combinator_branch *)(combinator + 1);
+}
+
+/* Called by the final branch callback. Releases every reference the combinator holds. */
+static void s_future_combinator_destroy(struct aws_future_combinator *combinator) {
+    struct aws_future_combinator_branch *branches = s_future_combinator_get_branches(combinator);
+    for (size_t i = 0; i < combinator->count; ++i) {
+        aws_future_impl_release(branches[i].future);
+    }
+    aws_future_impl_release(combinator->result);
+    aws_mem_release(combinator->alloc, combinator);
+}
+
+static struct aws_future_combinator *s_future_combinator_new(
+    struct aws_allocator *alloc,
+    struct aws_future_impl *const *futures,
+    size_t count,
+    struct aws_future_impl *result) {
+
+    struct aws_future_combinator *combinator = aws_mem_calloc(
+        alloc, 1, sizeof(struct aws_future_combinator) + count * sizeof(struct aws_future_combinator_branch));
+
+    combinator->alloc = alloc;
+    combinator->count = count;
+    combinator->result = aws_future_impl_acquire(result);
+    aws_atomic_init_int(&combinator->remaining, count);
+    aws_atomic_init_int(&combinator->status, 0);
+
+    struct aws_future_combinator_branch *branches = s_future_combinator_get_branches(combinator);
+    for (size_t i = 0; i < count; ++i) {
+        branches[i].combinator = combinator;
+        branches[i].future = aws_future_impl_acquire(futures[i]);
+    }
+
+    return combinator;
+}
+
+static void s_future_when_all_on_branch_done(void *user_data) {
+    struct aws_future_combinator_branch *branch = user_data;
+    struct aws_future_combinator *combinator = branch->combinator;
+
+    int error_code = aws_future_impl_get_error(branch->future);
+    if (error_code != 0) {
+        /* only the first error observed sticks */
+        size_t expected = 0;
+        aws_atomic_compare_exchange_int(&combinator->status, &expected, (size_t)error_code);
+    }
+
+    if (aws_atomic_fetch_sub(&combinator->remaining, 1) == 1) {
+        /* last branch in: complete the combined future */
+        size_t first_error = aws_atomic_load_int(&combinator->status);
+        if (first_error != 0) {
+            aws_future_impl_set_error(combinator->result, (int)first_error);
+        } else {
+            aws_future_void_set_result((struct aws_future_void *)combinator->result);
+        }
+        s_future_combinator_destroy(combinator);
+    }
+}
+
+struct aws_future_void *aws_future_when_all(
+    struct aws_allocator *alloc,
+    struct aws_future_impl *const *futures,
+    size_t count) {
+
+    AWS_PRECONDITION(alloc != NULL);
+    AWS_PRECONDITION(futures != NULL || count == 0);
+    if (count == 0) {
+        aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        return NULL;
+    }
+
+    struct aws_future_void *result = aws_future_void_new(alloc);
+    struct aws_future_combinator *combinator =
+        s_future_combinator_new(alloc, futures, count, (struct aws_future_impl *)result);
+
+    /* The combinator may be destroyed from within any of these registrations
+     * (a branch callback can fire synchronously if its future is already done),
+     * so don't touch it after this loop. */
+    struct aws_future_combinator_branch *branches = s_future_combinator_get_branches(combinator);
+    for (size_t i = 0; i < count; ++i) {
+        aws_future_impl_register_callback(branches[i].future, s_future_when_all_on_branch_done, &branches[i]);
+    }
+
+    return result;
+}
+
+static void s_future_when_any_on_branch_done(void *user_data) {
+    struct aws_future_combinator_branch *branch = user_data;
+    struct aws_future_combinator *combinator = branch->combinator;
+
+    int error_code = aws_future_impl_get_error(branch->future);
+    if (error_code == 0) {
+        /* first successful branch claims the win and completes the combined future */
+        size_t index = (size_t)(branch - s_future_combinator_get_branches(combinator));
+        size_t expected = 0;
+        if (aws_atomic_compare_exchange_int(&combinator->status, &expected, index + 1)) {
+            aws_future_size_set_result((struct aws_future_size *)combinator->result, index);
+        }
+    }
+
+    if (aws_atomic_fetch_sub(&combinator->remaining, 1) == 1) {
+        if (aws_atomic_load_int(&combinator->status) == 0) {
+            /* every branch failed; report the last error to come in */
+            aws_future_impl_set_error(combinator->result, error_code);
+        }
+        s_future_combinator_destroy(combinator);
+    }
+}
+
+struct aws_future_size *aws_future_when_any(
+    struct aws_allocator *alloc,
+    struct aws_future_impl *const *futures,
+    size_t count) {
+
+    AWS_PRECONDITION(alloc != NULL);
+    AWS_PRECONDITION(futures != NULL || count == 0);
+    if (count == 0) {
+        aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        return NULL;
+    }
+
+    struct aws_future_size *result = aws_future_size_new(alloc);
+    struct aws_future_combinator *combinator =
+        s_future_combinator_new(alloc, futures, count, (struct aws_future_impl *)result);
+
+    /* see aws_future_when_all() for why the combinator must not be touched after this loop */
+    struct aws_future_combinator_branch *branches = s_future_combinator_get_branches(combinator);
+    for (size_t i = 0; i < count; ++i) {
+        aws_future_impl_register_callback(branches[i].future, s_future_when_any_on_branch_done, &branches[i]);
+    }
+
+    return result;
+}
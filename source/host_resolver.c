@@ -8,6 +8,8 @@
 #include <aws/common/atomics.h>
 #include <aws/common/clock.h>
 #include <aws/common/condition_variable.h>
+#include <aws/common/device_random.h>
+#include <aws/common/file.h>
 #include <aws/common/hash_table.h>
 #include <aws/common/lru_cache.h>
 #include <aws/common/mutex.h>
@@ -17,6 +19,7 @@
 
 #include <aws/io/logging.h>
 
+#include <errno.h>
 #include <inttypes.h>
 
 const uint64_t NS_PER_SEC = 1000000000;
@@ -87,6 +90,19 @@ int aws_host_resolver_purge_cache_with_callback(
     return resolver->vtable->purge_cache_with_callback(resolver, on_purge_cache_complete_callback, user_data);
 }
 
+int aws_host_resolver_prefetch_hosts(
+    struct aws_host_resolver *resolver,
+    const struct aws_host_resolver_prefetch_host_options *options) {
+    AWS_PRECONDITION(resolver);
+    AWS_PRECONDITION(resolver->vtable);
+
+    if (!resolver->vtable->prefetch_hosts) {
+        AWS_LOGF_ERROR(AWS_LS_IO_DNS, "prefetch_hosts function is not supported");
+        return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+    }
+    return resolver->vtable->prefetch_hosts(resolver, options);
+}
+
 int aws_host_resolver_purge_host_cache(
     struct aws_host_resolver *resolver,
     const struct aws_host_resolver_purge_host_options *options) {
@@ -107,6 +123,56 @@ int aws_host_resolver_record_connection_failure(
     return resolver->vtable->record_connection_failure(resolver, address);
 }
 
+int aws_host_resolver_record_connection_success(
+    struct aws_host_resolver *resolver,
+    const struct aws_host_address *address,
+    uint64_t connect_latency_ns) {
+    AWS_PRECONDITION(resolver);
+    AWS_PRECONDITION(resolver->vtable);
+
+    /* success reports are advisory; implementations that don't track them can simply drop them */
+    if (!resolver->vtable->record_connection_success) {
+        return AWS_OP_SUCCESS;
+    }
+    return resolver->vtable->record_connection_success(resolver, address, connect_latency_ns);
+}
+
+int aws_host_resolver_save_address_cache(struct aws_host_resolver *resolver, const char *file_path) {
+    AWS_PRECONDITION(resolver);
+    AWS_PRECONDITION(resolver->vtable);
+
+    if (!resolver->vtable->save_address_cache) {
+        AWS_LOGF_ERROR(AWS_LS_IO_DNS, "save_address_cache function is not supported");
+        return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+    }
+    return resolver->vtable->save_address_cache(resolver, file_path);
+}
+
+struct aws_host_listener *aws_host_resolver_add_host_listener(
+    struct aws_host_resolver *resolver,
+    const struct aws_host_listener_options *options) {
+    AWS_PRECONDITION(resolver);
+    AWS_PRECONDITION(resolver->vtable);
+
+    if (!resolver->vtable->add_host_listener) {
+        AWS_LOGF_ERROR(AWS_LS_IO_DNS, "add_host_listener function is not supported");
+        aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+        return NULL;
+    }
+    return resolver->vtable->add_host_listener(resolver, options);
+}
+
+int aws_host_resolver_remove_host_listener(struct aws_host_resolver *resolver, struct aws_host_listener *listener) {
+    AWS_PRECONDITION(resolver);
+    AWS_PRECONDITION(resolver->vtable);
+
+    if (!resolver->vtable->remove_host_listener) {
+        AWS_LOGF_ERROR(AWS_LS_IO_DNS, "remove_host_listener function is not supported");
+        return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+    }
+    return resolver->vtable->remove_host_listener(resolver, listener);
+}
+
 /*
  * Used by both the resolver for its lifetime state as well as individual host entries for theirs.
  */
@@ -115,24 +181,41 @@ enum default_resolver_state {
     DRS_SHUTTING_DOWN,
 };
 
+enum {
+    /* power of two; hostnames hash onto shards, so concurrent resolves of distinct hosts rarely share a lock */
+    AWS_RESOLVER_TABLE_SHARD_COUNT = 16,
+};
+
+/*
+ * One shard of the host entry table.  The shard lock covers its table and plays the role the old resolver-wide
+ * lock played for entry lookup/insert/remove: once an entry is retrieved under its shard lock, the lock MAY be
+ * dropped, but logic that removes an entry must hold both the shard and the entry lock, taken in that order.
+ */
+struct resolver_table_shard {
+    struct aws_mutex lock;
+
+    /* host_name (aws_string*) -> host_entry* */
+    struct aws_hash_table host_entry_table;
+};
+
 struct default_host_resolver {
     struct aws_allocator *allocator;
 
     /*
-     * Mutually exclusion for the whole resolver, includes all member data and all host_entry_table operations.  Once
-     * an entry is retrieved, this lock MAY be dropped but certain logic may hold both the resolver and the entry lock.
-     * The two locks must be taken in that order.
+     * Guards the resolver-wide members below (state, the pending-shutdown count, and the listener table).  Host
+     * entry lookups go through the shards instead, so cache-hit resolution of distinct hosts does not contend
+     * here.  This lock may be taken while holding a shard lock, never the reverse.
      */
     struct aws_mutex resolver_lock;
 
-    /* host_name (aws_string*) -> host_entry* */
-    struct aws_hash_table host_entry_table;
+    struct resolver_table_shard shards[AWS_RESOLVER_TABLE_SHARD_COUNT];
 
     /* Hash table of listener entries per host name. We keep this decoupled from the host entry table to allow for
      * listeners to be added/removed regardless of whether or not a corresponding host entry exists.
      *
-     * Any time the listener list in the listener entry becomes empty, we remove the entry from the table.  This
-     * includes when a resolver thread moves all of the available listeners to its local list.
+     * An entry is removed from the table once its listener list is empty AND no listeners are checked out to a
+     * servicing thread for notification; the entry must outlive in-flight notifications because it owns the
+     * host's address epoch.
      */
     /* host_name (aws_string*) -> host_listener_entry* */
     struct aws_hash_table listener_entry_table;
@@ -151,8 +234,71 @@ struct default_host_resolver {
     aws_io_clock_fn *system_clock_fn;
 
     struct aws_event_loop_group *event_loop_group;
+
+    /*
+     * Optional shared worker pool (resolution_worker_count > 0 in the construction options).  When present,
+     * host entries are serviced by the pool's workers rather than a dedicated thread each.  NULL means the
+     * historical thread-per-entry behavior.
+     */
+    struct resolver_worker_pool *worker_pool;
+
+    /*
+     * Addresses loaded from a warm-start cache file at construction; host_name (aws_string*) -> aws_array_list*
+     * of aws_host_address (by-value).  Immutable after construction -- host entries copy matching records out
+     * as they are created, so no additional locking is needed.
+     */
+    struct aws_hash_table warm_address_table;
+};
+
+/*
+ * Per-host bucket of registered listeners.  The resolver lock guards everything here.  While a servicing
+ * thread is delivering a batch, the listeners are checked out onto that thread's local list so the callbacks
+ * run without the resolver lock held; checked_out_count keeps the entry (and its epoch) alive until they
+ * come back.
+ */
+struct host_listener_entry {
+    struct aws_allocator *allocator;
+
+    /* owned; doubles as the table key */
+    struct aws_string *host_name;
+
+    /* list of struct host_listener */
+    struct aws_linked_list listeners;
+
+    /* number of listeners currently checked out to a servicing thread for notification */
+    uint32_t checked_out_count;
+
+    /* bumped once per refresh whose new/expired delta was non-empty; never reset while the entry lives */
+    uint64_t address_epoch;
 };
 
+struct host_listener {
+    struct aws_allocator *allocator;
+
+    /* strong reference, released when the listener is finally destroyed */
+    struct aws_host_resolver *resolver;
+
+    struct aws_string *host_name;
+
+    /* immutable after creation, so notification threads can invoke without the resolver lock */
+    aws_host_listener_address_batch_fn *on_address_batch;
+    aws_host_listener_shutdown_fn *on_shutdown;
+    void *user_data;
+
+    /* membership in either the entry's list or a servicing thread's checked-out list */
+    struct aws_linked_list_node node;
+
+    /* both guarded by the resolver lock */
+    bool checked_out_for_notification;
+    bool pending_destroy;
+};
+
+static void s_notify_host_listeners(
+    struct aws_host_resolver *resolver,
+    const struct aws_string *host_name,
+    const struct aws_array_list *new_address_list,
+    const struct aws_array_list *expired_address_list);
+
 struct host_entry {
     /* immutable post-creation */
     struct aws_allocator *allocator;
@@ -161,6 +307,26 @@ struct host_entry {
     const struct aws_string *host_name;
     int64_t resolve_frequency_ns;
     struct aws_host_resolution_config resolution_config;
+    /* NULL when this entry has a dedicated resolver thread */
+    struct resolver_worker_pool *worker_pool;
+
+    /* scheduling state for pooled entries; protected by the worker pool's lock, not entry_lock */
+    struct aws_linked_list_node pool_node;
+    uint64_t pool_due_time_ns;
+    uint64_t pool_min_service_time_ns;
+    uint64_t pool_deferred_due_time_ns;
+    bool in_pool_queue;
+
+    /*
+     * Lock-free resolve fast path.  address_snapshot holds an immutable copy of the entry's current best
+     * address pair (struct host_entry_address_snapshot *), republished after every service pass and after
+     * connection-failure mutations.  Readers copy it out under a brief reader count without ever touching
+     * entry_lock; unserviced_fast_path_hits records the solicitations the fast path made so the next service
+     * pass can fold them into last_resolve_request_timestamp_ns.
+     */
+    struct aws_atomic_var address_snapshot;
+    struct aws_atomic_var snapshot_reader_count;
+    struct aws_atomic_var unserviced_fast_path_hits;
 
     /* synchronized data and its lock */
     struct aws_mutex entry_lock;
@@ -170,6 +336,17 @@ struct host_entry {
     struct aws_cache *failed_connection_aaaa_records;
     struct aws_cache *failed_connection_a_records;
     struct aws_linked_list pending_resolution_callbacks;
+    /* prefetched hosts are pinned: they keep refreshing instead of retiring after max_ttl of inactivity */
+    bool pinned;
+    /*
+     * Negative cache: when a resolution attempt fails and nothing remains to vend, the error is remembered
+     * for a short, jittered window so the resolve path can fail fast instead of piling callbacks onto the
+     * pending list.  AWS_ERROR_SUCCESS means no failure is cached.
+     */
+    int negative_cache_error_code;
+    uint64_t negative_cache_expiry_ns;
+    /* rolls over harmlessly; only consulted modulo the probe interval */
+    uint32_t address_selection_counter;
     uint32_t resolves_since_last_request;
     uint64_t last_resolve_request_timestamp_ns;
     enum default_resolver_state state;
@@ -188,6 +365,13 @@ struct host_entry {
 struct aws_host_address_cache_entry {
     struct aws_host_address address;
     struct host_entry *entry;
+
+    /*
+     * Connection-outcome feedback, protected by the owning entry's lock.  A latency of zero means no sample
+     * has been reported yet; such addresses are selected eagerly so they can acquire one.
+     */
+    uint64_t ewma_connect_latency_ns;
+    double ewma_failure_rate;
 };
 
 int aws_host_address_cache_entry_copy(
@@ -198,10 +382,242 @@ int aws_host_address_cache_entry_copy(
     }
 
     to->entry = from->entry;
+    to->ewma_connect_latency_ns = from->ewma_connect_latency_ns;
+    to->ewma_failure_rate = from->ewma_failure_rate;
 
     return AWS_OP_SUCCESS;
 }
 
+/*
+ * Smoothing divisor of 8 for the per-address connect feedback: heavy enough that a couple of slow connects
+ * move the needle, light enough that a single outlier doesn't banish an address.
+ */
+#define AWS_ADDRESS_FEEDBACK_EWMA_DIVISOR 8
+
+enum {
+    /* every Nth selection falls back to plain LRU rotation so stale or unsampled addresses keep getting probed */
+    AWS_ADDRESS_PROBE_SELECTION_INTERVAL = 16,
+};
+
+static void s_address_entry_record_connection_outcome(
+    struct aws_host_address_cache_entry *cache_entry,
+    bool success,
+    uint64_t connect_latency_ns) {
+
+    double failure_sample = success ? 0.0 : 1.0;
+    cache_entry->ewma_failure_rate +=
+        (failure_sample - cache_entry->ewma_failure_rate) / AWS_ADDRESS_FEEDBACK_EWMA_DIVISOR;
+
+    if (success && connect_latency_ns > 0) {
+        if (cache_entry->ewma_connect_latency_ns == 0) {
+            cache_entry->ewma_connect_latency_ns = connect_latency_ns;
+        } else {
+            int64_t latency_delta =
+                (int64_t)connect_latency_ns - (int64_t)cache_entry->ewma_connect_latency_ns;
+            cache_entry->ewma_connect_latency_ns = (uint64_t)(
+                (int64_t)cache_entry->ewma_connect_latency_ns + latency_delta / AWS_ADDRESS_FEEDBACK_EWMA_DIVISOR);
+        }
+    }
+}
+
+static double s_address_entry_selection_score(const struct aws_host_address_cache_entry *cache_entry) {
+    /* an unsampled address scores best; it needs traffic before it can be ranked */
+    if (cache_entry->ewma_connect_latency_ns == 0) {
+        return 0.0;
+    }
+
+    return (double)cache_entry->ewma_connect_latency_ns * (1.0 + cache_entry->ewma_failure_rate);
+}
+
+/*
+ * An immutable copy of a host entry's current best address pair, published via an atomic pointer swap.  The
+ * resolve fast path copies addresses out of it without taking entry_lock; all mutation goes through
+ * s_publish_address_snapshot under the entry lock.
+ */
+struct host_entry_address_snapshot {
+    struct aws_allocator *allocator;
+    struct aws_host_address aaaa_address;
+    struct aws_host_address a_address;
+    bool has_aaaa;
+    bool has_a;
+};
+
+static void s_destroy_address_snapshot(struct host_entry_address_snapshot *snapshot) {
+    if (snapshot == NULL) {
+        return;
+    }
+
+    if (snapshot->has_aaaa) {
+        aws_host_address_clean_up(&snapshot->aaaa_address);
+    }
+
+    if (snapshot->has_a) {
+        aws_host_address_clean_up(&snapshot->a_address);
+    }
+
+    aws_mem_release(snapshot->allocator, snapshot);
+}
+
+static void s_publish_address_snapshot(struct host_entry *host_entry);
+
+/*
+ * Shared resolution worker pool.
+ *
+ * The historical model dedicates one thread per host entry; at a few thousand distinct hostnames that is a few
+ * thousand mostly-sleeping threads, each with stack and scheduler cost.  The pool multiplexes every host entry
+ * onto a fixed set of workers instead: entries queue with a due time, workers service whichever entry is due
+ * next, and the per-entry resolve/cache/callback logic is shared with the dedicated-thread path, which remains
+ * the default.
+ *
+ * Lock order where multiple locks are held: shard lock -> entry_lock -> pool lock.
+ */
+struct resolver_worker_pool {
+    struct aws_allocator *allocator;
+    aws_io_clock_fn *system_clock_fn;
+
+    struct aws_mutex lock;
+    struct aws_condition_variable signal;
+
+    /* entries awaiting service, unordered; workers scan for the earliest due time.  An entry currently being
+     * serviced by a worker is absent from this list. */
+    struct aws_linked_list pending_entries;
+
+    struct aws_thread *threads;
+    size_t thread_count;
+
+    /* workers still running; the last one out frees the pool, which is why the pool's lifetime is independent
+     * of the resolver's */
+    size_t living_thread_count;
+    bool shutting_down;
+};
+
+static void s_resolver_worker_thread(void *arg);
+
+static void s_worker_pool_destroy(struct resolver_worker_pool *pool) {
+    aws_condition_variable_clean_up(&pool->signal);
+    aws_mutex_clean_up(&pool->lock);
+    aws_mem_release(pool->allocator, pool->threads);
+    aws_mem_release(pool->allocator, pool);
+}
+
+/* runs via aws_thread_current_at_exit on each worker thread */
+static void s_on_worker_shutdown_completion(void *user_data) {
+    struct resolver_worker_pool *pool = user_data;
+
+    aws_mutex_lock(&pool->lock);
+    bool last_one_out = --pool->living_thread_count == 0;
+    aws_mutex_unlock(&pool->lock);
+
+    if (last_one_out) {
+        s_worker_pool_destroy(pool);
+    }
+}
+
+static struct resolver_worker_pool *s_worker_pool_new(
+    struct aws_allocator *allocator,
+    size_t thread_count,
+    aws_io_clock_fn *system_clock_fn) {
+
+    struct resolver_worker_pool *pool = aws_mem_calloc(allocator, 1, sizeof(struct resolver_worker_pool));
+    if (pool == NULL) {
+        return NULL;
+    }
+
+    pool->allocator = allocator;
+    pool->system_clock_fn = system_clock_fn;
+    aws_mutex_init(&pool->lock);
+    aws_condition_variable_init(&pool->signal);
+    aws_linked_list_init(&pool->pending_entries);
+
+    pool->threads = aws_mem_calloc(allocator, thread_count, sizeof(struct aws_thread));
+    if (pool->threads == NULL) {
+        goto on_error;
+    }
+
+    struct aws_thread_options thread_options = *aws_default_thread_options();
+    thread_options.join_strategy = AWS_TJS_MANAGED;
+    thread_options.name = aws_byte_cursor_from_c_str("AwsDnsWorker"); /* 15 characters is max for Linux */
+
+    size_t launched = 0;
+    for (size_t i = 0; i < thread_count; ++i) {
+        if (aws_thread_init(&pool->threads[i], allocator)) {
+            break;
+        }
+
+        if (aws_thread_launch(&pool->threads[i], s_resolver_worker_thread, pool, &thread_options)) {
+            aws_thread_clean_up(&pool->threads[i]);
+            break;
+        }
+
+        ++launched;
+    }
+
+    if (launched == 0) {
+        goto on_error;
+    }
+
+    /* under the lock so the counts are visible to workers that read them there */
+    aws_mutex_lock(&pool->lock);
+    pool->thread_count = launched;
+    pool->living_thread_count = launched;
+    aws_mutex_unlock(&pool->lock);
+
+    return pool;
+
+on_error:
+
+    aws_condition_variable_clean_up(&pool->signal);
+    aws_mutex_clean_up(&pool->lock);
+    aws_mem_release(allocator, pool->threads);
+    aws_mem_release(allocator, pool);
+
+    return NULL;
+}
+
+static void s_worker_pool_start_shutdown(struct resolver_worker_pool *pool) {
+    aws_mutex_lock(&pool->lock);
+    pool->shutting_down = true;
+    aws_condition_variable_notify_all(&pool->signal);
+    aws_mutex_unlock(&pool->lock);
+}
+
+/*
+ * Pulls a pooled entry's next service forward: to "immediately" for shutdown notices, otherwise to the earliest
+ * time the minimum inter-query spacing allows (mirroring the dedicated thread's chained waits).  Safe to call
+ * with the entry lock held; the pool lock nests inside it.
+ */
+static void s_worker_pool_poke_entry(struct host_entry *entry, bool entry_shutting_down) {
+    struct resolver_worker_pool *pool = entry->worker_pool;
+
+    aws_mutex_lock(&pool->lock);
+
+    uint64_t due_time = entry_shutting_down ? 0 : entry->pool_min_service_time_ns;
+    if (entry->in_pool_queue) {
+        if (due_time < entry->pool_due_time_ns) {
+            entry->pool_due_time_ns = due_time;
+            aws_condition_variable_notify_all(&pool->signal);
+        }
+    } else if (due_time < entry->pool_deferred_due_time_ns) {
+        /* a worker has the entry in hand; it applies the new due time when it re-queues */
+        entry->pool_deferred_due_time_ns = due_time;
+    }
+
+    aws_mutex_unlock(&pool->lock);
+}
+
+static void s_worker_pool_add_entry(struct resolver_worker_pool *pool, struct host_entry *entry) {
+    aws_mutex_lock(&pool->lock);
+
+    entry->in_pool_queue = true;
+    entry->pool_due_time_ns = 0; /* the first resolve is due immediately */
+    entry->pool_min_service_time_ns = 0;
+    entry->pool_deferred_due_time_ns = UINT64_MAX;
+    aws_linked_list_push_back(&pool->pending_entries, &entry->pool_node);
+    aws_condition_variable_notify_all(&pool->signal);
+
+    aws_mutex_unlock(&pool->lock);
+}
+
 static void s_shutdown_host_entry(struct host_entry *entry) {
     aws_mutex_lock(&entry->entry_lock);
     entry->state = DRS_SHUTTING_DOWN;
@@ -210,6 +626,9 @@ static void s_shutdown_host_entry(struct host_entry *entry) {
      * is still around once the lock is released.
      */
     aws_condition_variable_notify_all(&entry->entry_signal);
+    if (entry->worker_pool != NULL) {
+        s_worker_pool_poke_entry(entry, true /*entry_shutting_down*/);
+    }
     aws_mutex_unlock(&entry->entry_lock);
 }
 
@@ -245,25 +664,32 @@ static void s_purge_cache_callback(void *user_data) {
     aws_ref_count_release(&purge_callback_options->ref_count);
 }
 
-/*
- * resolver lock must be held before calling this function
- */
-static void s_clear_default_resolver_entry_table_synced(struct default_host_resolver *resolver) {
-    struct aws_hash_table *table = &resolver->host_entry_table;
-    for (struct aws_hash_iter iter = aws_hash_iter_begin(table); !aws_hash_iter_done(&iter);
-         aws_hash_iter_next(&iter)) {
-        struct host_entry *entry = iter.element.value;
-        s_shutdown_host_entry(entry);
-    }
+static struct resolver_table_shard *s_get_table_shard(
+    struct default_host_resolver *resolver,
+    const struct aws_string *host_name) {
+    return &resolver->shards[aws_hash_string(host_name) & (AWS_RESOLVER_TABLE_SHARD_COUNT - 1)];
+}
 
-    aws_hash_table_clear(table);
+static void s_clear_default_resolver_entry_tables(struct default_host_resolver *resolver) {
+    for (size_t i = 0; i < AWS_RESOLVER_TABLE_SHARD_COUNT; ++i) {
+        struct resolver_table_shard *shard = &resolver->shards[i];
+
+        aws_mutex_lock(&shard->lock);
+        struct aws_hash_table *table = &shard->host_entry_table;
+        for (struct aws_hash_iter iter = aws_hash_iter_begin(table); !aws_hash_iter_done(&iter);
+             aws_hash_iter_next(&iter)) {
+            struct host_entry *entry = iter.element.value;
+            s_shutdown_host_entry(entry);
+        }
+
+        aws_hash_table_clear(table);
+        aws_mutex_unlock(&shard->lock);
+    }
 }
 
 static int s_resolver_purge_cache(struct aws_host_resolver *resolver) {
     struct default_host_resolver *default_host_resolver = resolver->impl;
-    aws_mutex_lock(&default_host_resolver->resolver_lock);
-    s_clear_default_resolver_entry_table_synced(default_host_resolver);
-    aws_mutex_unlock(&default_host_resolver->resolver_lock);
+    s_clear_default_resolver_entry_tables(default_host_resolver);
 
     return AWS_OP_SUCCESS;
 }
@@ -297,27 +723,31 @@ static int s_resolver_purge_cache_with_callback(
     }
 
     struct default_host_resolver *default_host_resolver = resolver->impl;
-    aws_mutex_lock(&default_host_resolver->resolver_lock);
-    struct aws_hash_table *table = &default_host_resolver->host_entry_table;
 
     struct host_purge_callback_options *purge_callback_options = s_host_purge_callback_options_new(
         default_host_resolver->allocator, on_purge_cache_complete_callback, user_data);
 
-    /* purge all cache */
-    for (struct aws_hash_iter iter = aws_hash_iter_begin(table); !aws_hash_iter_done(&iter);
-         aws_hash_iter_next(&iter)) {
-        struct host_entry *entry = iter.element.value;
-        /* acquire a refernce to wait for the callback to trigger */
-        aws_ref_count_acquire(&purge_callback_options->ref_count);
-        aws_mutex_lock(&entry->entry_lock);
-        entry->on_host_purge_complete = s_purge_cache_callback;
-        entry->on_host_purge_complete_user_data = purge_callback_options;
-        entry->state = DRS_SHUTTING_DOWN;
-        aws_mutex_unlock(&entry->entry_lock);
-    }
+    /* purge all cache, one shard at a time */
+    for (size_t i = 0; i < AWS_RESOLVER_TABLE_SHARD_COUNT; ++i) {
+        struct resolver_table_shard *shard = &default_host_resolver->shards[i];
+
+        aws_mutex_lock(&shard->lock);
+        struct aws_hash_table *table = &shard->host_entry_table;
+        for (struct aws_hash_iter iter = aws_hash_iter_begin(table); !aws_hash_iter_done(&iter);
+             aws_hash_iter_next(&iter)) {
+            struct host_entry *entry = iter.element.value;
+            /* acquire a refernce to wait for the callback to trigger */
+            aws_ref_count_acquire(&purge_callback_options->ref_count);
+            aws_mutex_lock(&entry->entry_lock);
+            entry->on_host_purge_complete = s_purge_cache_callback;
+            entry->on_host_purge_complete_user_data = purge_callback_options;
+            entry->state = DRS_SHUTTING_DOWN;
+            aws_mutex_unlock(&entry->entry_lock);
+        }
 
-    aws_hash_table_clear(table);
-    aws_mutex_unlock(&default_host_resolver->resolver_lock);
+        aws_hash_table_clear(table);
+        aws_mutex_unlock(&shard->lock);
+    }
 
     /* release the original reference async */
     s_sechdule_purge_cache_callback_async(default_host_resolver, purge_callback_options);
@@ -327,9 +757,18 @@ static int s_resolver_purge_cache_with_callback(
 static void s_cleanup_default_resolver(struct aws_host_resolver *resolver) {
     struct default_host_resolver *default_host_resolver = resolver->impl;
 
+    /* every entry has already retired; the workers wake, see the flag, and the last one out frees the pool */
+    if (default_host_resolver->worker_pool != NULL) {
+        s_worker_pool_start_shutdown(default_host_resolver->worker_pool);
+    }
+
     aws_event_loop_group_release(default_host_resolver->event_loop_group);
-    aws_hash_table_clean_up(&default_host_resolver->host_entry_table);
+    for (size_t i = 0; i < AWS_RESOLVER_TABLE_SHARD_COUNT; ++i) {
+        aws_hash_table_clean_up(&default_host_resolver->shards[i].host_entry_table);
+        aws_mutex_clean_up(&default_host_resolver->shards[i].lock);
+    }
     aws_hash_table_clean_up(&default_host_resolver->listener_entry_table);
+    aws_hash_table_clean_up(&default_host_resolver->warm_address_table);
 
     aws_mutex_clean_up(&default_host_resolver->resolver_lock);
 
@@ -350,10 +789,16 @@ static void resolver_destroy(struct aws_host_resolver *resolver) {
     bool cleanup_resolver = false;
 
     aws_mutex_lock(&default_host_resolver->resolver_lock);
-
     AWS_FATAL_ASSERT(default_host_resolver->state == DRS_ACTIVE);
+    aws_mutex_unlock(&default_host_resolver->resolver_lock);
 
-    s_clear_default_resolver_entry_table_synced(default_host_resolver);
+    s_clear_default_resolver_entry_tables(default_host_resolver);
+
+    /*
+     * Entries retiring between the sweep above and here just decrement the pending count early; exactly one of
+     * this check and the final entry's shutdown completion sees (shutting-down && zero pending) and cleans up.
+     */
+    aws_mutex_lock(&default_host_resolver->resolver_lock);
     default_host_resolver->state = DRS_SHUTTING_DOWN;
     if (default_host_resolver->pending_host_entry_shutdown_completion_callbacks == 0) {
         cleanup_resolver = true;
@@ -408,6 +853,9 @@ static void s_clean_up_host_entry(struct host_entry *entry) {
         aws_mem_release(entry->allocator, pending_callback);
     }
 
+    /* no readers can remain by now; the entry left the shard table before shutdown completed */
+    s_destroy_address_snapshot(aws_atomic_load_ptr(&entry->address_snapshot));
+
     aws_cache_destroy(entry->aaaa_records);
     aws_cache_destroy(entry->a_records);
     aws_cache_destroy(entry->failed_connection_a_records);
@@ -486,6 +934,18 @@ static uint64_t s_get_system_time_for_default_resolver(struct aws_host_resolver
     return timestamp;
 }
 
+/*
+ * How long a cached resolution failure stays servable: one second, jittered by +/- 25% so that a fleet of
+ * synchronized clients doesn't re-probe a dead name in lockstep when the window closes.
+ */
+static uint64_t s_jittered_negative_cache_interval_ns(void) {
+    uint64_t random_value = 0;
+    aws_device_random_u64(&random_value);
+
+    uint64_t half_window = NS_PER_SEC / 4;
+    return NS_PER_SEC - half_window + random_value % (2 * half_window + 1);
+}
+
 /* this only ever gets called after resolution has already run. We expect that the entry's lock
    has been acquired for writing before this function is called and released afterwards. */
 static inline void process_records(
@@ -576,14 +1036,15 @@ static int s_resolver_purge_host_cache(
     struct default_host_resolver *default_host_resolver = resolver->impl;
     AWS_LOGF_INFO(AWS_LS_IO_DNS, "id=%p: purging record for %s", (void *)resolver, options->host->bytes);
 
-    aws_mutex_lock(&default_host_resolver->resolver_lock);
+    struct resolver_table_shard *shard = s_get_table_shard(default_host_resolver, options->host);
+    aws_mutex_lock(&shard->lock);
 
     struct aws_hash_element *element = NULL;
-    aws_hash_table_find(&default_host_resolver->host_entry_table, options->host, &element);
+    aws_hash_table_find(&shard->host_entry_table, options->host, &element);
 
     /* Success if entry doesn't exist in cache. */
     if (element == NULL) {
-        aws_mutex_unlock(&default_host_resolver->resolver_lock);
+        aws_mutex_unlock(&shard->lock);
         if (options->on_host_purge_complete_callback != NULL) {
             /* Schedule completion callback asynchronouly */
             struct host_purge_callback_options *purge_callback_options = s_host_purge_callback_options_new(
@@ -606,9 +1067,9 @@ static int s_resolver_purge_host_cache(
     aws_mutex_unlock(&host_entry->entry_lock);
 
     s_shutdown_host_entry(host_entry);
-    aws_hash_table_remove_element(&default_host_resolver->host_entry_table, element);
+    aws_hash_table_remove_element(&shard->host_entry_table, element);
 
-    aws_mutex_unlock(&default_host_resolver->resolver_lock);
+    aws_mutex_unlock(&shard->lock);
     return AWS_OP_SUCCESS;
 }
 
@@ -624,11 +1085,12 @@ static int resolver_record_connection_failure(
         address->address->bytes,
         address->host->bytes);
 
-    aws_mutex_lock(&default_host_resolver->resolver_lock);
+    struct resolver_table_shard *shard = s_get_table_shard(default_host_resolver, address->host);
+    aws_mutex_lock(&shard->lock);
 
     struct aws_hash_element *element = NULL;
-    if (aws_hash_table_find(&default_host_resolver->host_entry_table, address->host, &element)) {
-        aws_mutex_unlock(&default_host_resolver->resolver_lock);
+    if (aws_hash_table_find(&shard->host_entry_table, address->host, &element)) {
+        aws_mutex_unlock(&shard->lock);
         return AWS_OP_ERR;
     }
 
@@ -642,7 +1104,7 @@ static int resolver_record_connection_failure(
         struct aws_host_address_cache_entry *cached_address_entry = NULL;
 
         aws_mutex_lock(&host_entry->entry_lock);
-        aws_mutex_unlock(&default_host_resolver->resolver_lock);
+        aws_mutex_unlock(&shard->lock);
         struct aws_cache *address_table =
             address->record_type == AWS_ADDRESS_RECORD_TYPE_AAAA ? host_entry->aaaa_records : host_entry->a_records;
 
@@ -669,6 +1131,7 @@ static int resolver_record_connection_failure(
             }
 
             address_entry_copy->address.connection_failure_count += 1;
+            s_address_entry_record_connection_outcome(address_entry_copy, false /*success*/, 0);
 
             if (aws_cache_put(failed_table, address_entry_copy->address.address, address_entry_copy)) {
                 goto error_host_entry_cleanup;
@@ -680,8 +1143,13 @@ static int resolver_record_connection_failure(
 
             if (cached_address_entry) {
                 cached_address_entry->address.connection_failure_count += 1;
+                s_address_entry_record_connection_outcome(cached_address_entry, false /*success*/, 0);
             }
         }
+
+        /* the good/bad caches just changed shape; refresh the lock-free readers' view */
+        s_publish_address_snapshot(host_entry);
+
         aws_mutex_unlock(&host_entry->entry_lock);
         return AWS_OP_SUCCESS;
 
@@ -694,40 +1162,403 @@ static int resolver_record_connection_failure(
         return AWS_OP_ERR;
     }
 
-    aws_mutex_unlock(&default_host_resolver->resolver_lock);
+    aws_mutex_unlock(&shard->lock);
 
     return AWS_OP_SUCCESS;
 }
 
-/*
- * A bunch of convenience functions for the host resolver background thread function
- */
-
-static struct aws_host_address_cache_entry *s_find_cached_address_entry_aux(
-    struct aws_cache *primary_records,
-    struct aws_cache *fallback_records,
-    const struct aws_string *address) {
+static int s_resolver_record_connection_success(
+    struct aws_host_resolver *resolver,
+    const struct aws_host_address *address,
+    uint64_t connect_latency_ns) {
 
-    struct aws_host_address_cache_entry *found = NULL;
-    aws_cache_find(primary_records, address, (void **)&found);
-    if (found == NULL) {
-        aws_cache_find(fallback_records, address, (void **)&found);
-    }
+    struct default_host_resolver *default_host_resolver = resolver->impl;
 
-    return found;
-}
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_DNS,
+        "id=%p: recording connection success for record %s for %s, connect latency %llu ns",
+        (void *)resolver,
+        address->address->bytes,
+        address->host->bytes,
+        (unsigned long long)connect_latency_ns);
 
-/*
- * Looks in both the good and failed connection record sets for a given host record
- */
-static struct aws_host_address_cache_entry *s_find_cached_address_entry(
-    struct host_entry *entry,
-    const struct aws_string *address,
-    enum aws_address_record_type record_type) {
+    struct resolver_table_shard *shard = s_get_table_shard(default_host_resolver, address->host);
+    aws_mutex_lock(&shard->lock);
 
-    switch (record_type) {
-        case AWS_ADDRESS_RECORD_TYPE_AAAA:
-            return s_find_cached_address_entry_aux(entry->aaaa_records, entry->failed_connection_aaaa_records, address);
+    struct aws_hash_element *element = NULL;
+    if (aws_hash_table_find(&shard->host_entry_table, address->host, &element)) {
+        aws_mutex_unlock(&shard->lock);
+        return AWS_OP_ERR;
+    }
+
+    if (element == NULL) {
+        aws_mutex_unlock(&shard->lock);
+        return AWS_OP_SUCCESS;
+    }
+
+    struct host_entry *host_entry = element->value;
+    AWS_FATAL_ASSERT(host_entry);
+
+    aws_mutex_lock(&host_entry->entry_lock);
+    aws_mutex_unlock(&shard->lock);
+
+    struct aws_cache *address_table =
+        address->record_type == AWS_ADDRESS_RECORD_TYPE_AAAA ? host_entry->aaaa_records : host_entry->a_records;
+
+    struct aws_cache *failed_table = address->record_type == AWS_ADDRESS_RECORD_TYPE_AAAA
+                                         ? host_entry->failed_connection_aaaa_records
+                                         : host_entry->failed_connection_a_records;
+
+    struct aws_host_address_cache_entry *cached_address_entry = NULL;
+    aws_cache_find(address_table, address->address, (void **)&cached_address_entry);
+    if (cached_address_entry == NULL) {
+        /* a success against a demoted address still improves its standing for the next promotion pass */
+        aws_cache_find(failed_table, address->address, (void **)&cached_address_entry);
+    }
+
+    if (cached_address_entry != NULL) {
+        s_address_entry_record_connection_outcome(cached_address_entry, true /*success*/, connect_latency_ns);
+    }
+
+    aws_mutex_unlock(&host_entry->entry_lock);
+
+    return AWS_OP_SUCCESS;
+}
+
+/*
+ * Warm-start address cache serialization.
+ *
+ * The format is line-oriented text: a version header followed by one record per line,
+ *
+ *   aws-dns-address-cache-v1
+ *   <record_type> <remaining_ttl_ns> <connection_failure_count> <address> <host_name>
+ *
+ * TTLs are stored as time remaining at save rather than as absolute expiry, since the default clock is
+ * monotonic and its epoch does not survive a process restart.
+ */
+static const char *s_warm_address_cache_header = "aws-dns-address-cache-v1";
+
+static void s_destroy_warm_address_list(void *value) {
+    struct aws_array_list *address_list = value;
+    struct aws_allocator *allocator = address_list->alloc;
+
+    s_clear_address_list(address_list);
+    aws_array_list_clean_up(address_list);
+    aws_mem_release(allocator, address_list);
+}
+
+static int s_append_cache_records_to_buffer(struct aws_byte_buf *buffer, struct aws_cache *records, uint64_t now) {
+    size_t record_count = aws_cache_get_element_count(records);
+    for (size_t i = 0; i < record_count; ++i) {
+        struct aws_host_address_cache_entry *cache_entry = aws_lru_cache_use_lru_element(records);
+        if (cache_entry == NULL || cache_entry->address.expiry <= now) {
+            continue;
+        }
+
+        char line[1024];
+        int line_length = snprintf(
+            line,
+            sizeof(line),
+            "%d %llu %llu %s %s\n",
+            (int)cache_entry->address.record_type,
+            (unsigned long long)(cache_entry->address.expiry - now),
+            (unsigned long long)cache_entry->address.connection_failure_count,
+            cache_entry->address.address->bytes,
+            cache_entry->address.host->bytes);
+        if (line_length < 0 || (size_t)line_length >= sizeof(line)) {
+            continue;
+        }
+
+        struct aws_byte_cursor line_cursor = aws_byte_cursor_from_array(line, (size_t)line_length);
+        if (aws_byte_buf_append_dynamic(buffer, &line_cursor)) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_resolver_save_address_cache(struct aws_host_resolver *resolver, const char *file_path) {
+    struct default_host_resolver *default_host_resolver = resolver->impl;
+    uint64_t now = s_get_system_time_for_default_resolver(resolver);
+
+    struct aws_byte_buf serialized_records;
+    if (aws_byte_buf_init(&serialized_records, default_host_resolver->allocator, 1024)) {
+        return AWS_OP_ERR;
+    }
+
+    struct aws_byte_cursor header_cursor = aws_byte_cursor_from_c_str(s_warm_address_cache_header);
+    struct aws_byte_cursor newline_cursor = aws_byte_cursor_from_c_str("\n");
+    if (aws_byte_buf_append_dynamic(&serialized_records, &header_cursor) ||
+        aws_byte_buf_append_dynamic(&serialized_records, &newline_cursor)) {
+        goto on_error;
+    }
+
+    for (size_t i = 0; i < AWS_RESOLVER_TABLE_SHARD_COUNT; ++i) {
+        struct resolver_table_shard *shard = &default_host_resolver->shards[i];
+
+        aws_mutex_lock(&shard->lock);
+        struct aws_hash_table *table = &shard->host_entry_table;
+        for (struct aws_hash_iter iter = aws_hash_iter_begin(table); !aws_hash_iter_done(&iter);
+             aws_hash_iter_next(&iter)) {
+            struct host_entry *entry = iter.element.value;
+
+            aws_mutex_lock(&entry->entry_lock);
+            int append_result = s_append_cache_records_to_buffer(&serialized_records, entry->aaaa_records, now);
+            append_result |= s_append_cache_records_to_buffer(&serialized_records, entry->a_records, now);
+            aws_mutex_unlock(&entry->entry_lock);
+
+            if (append_result) {
+                aws_mutex_unlock(&shard->lock);
+                goto on_error;
+            }
+        }
+        aws_mutex_unlock(&shard->lock);
+    }
+
+    FILE *cache_file = aws_fopen(file_path, "wb");
+    if (cache_file == NULL) {
+        goto on_error;
+    }
+
+    size_t written = fwrite(serialized_records.buffer, 1, serialized_records.len, cache_file);
+    int errno_value = errno; /* Always cache errno before potential side-effect */
+    fclose(cache_file);
+
+    if (written != serialized_records.len) {
+        aws_translate_and_raise_io_error(errno_value);
+        goto on_error;
+    }
+
+    AWS_LOGF_INFO(
+        AWS_LS_IO_DNS,
+        "id=%p: saved address cache (%llu bytes) to '%s'",
+        (void *)resolver,
+        (unsigned long long)serialized_records.len,
+        file_path);
+
+    aws_byte_buf_clean_up(&serialized_records);
+    return AWS_OP_SUCCESS;
+
+on_error:
+
+    aws_byte_buf_clean_up(&serialized_records);
+    return AWS_OP_ERR;
+}
+
+static void s_load_warm_address_cache(struct default_host_resolver *resolver, const char *file_path) {
+    struct aws_allocator *allocator = resolver->allocator;
+
+    struct aws_byte_buf file_contents;
+    AWS_ZERO_STRUCT(file_contents);
+    if (aws_byte_buf_init_from_file(&file_contents, allocator, file_path)) {
+        AWS_LOGF_WARN(
+            AWS_LS_IO_DNS,
+            "static: could not read warm address cache file '%s', starting with a cold cache",
+            file_path);
+        return;
+    }
+
+    uint64_t now = 0;
+    (*resolver->system_clock_fn)(&now);
+
+    size_t loaded_record_count = 0;
+    bool header_checked = false;
+
+    struct aws_byte_cursor contents_cursor = aws_byte_cursor_from_buf(&file_contents);
+    struct aws_byte_cursor raw_line_cursor;
+    AWS_ZERO_STRUCT(raw_line_cursor);
+    while (aws_byte_cursor_next_split(&contents_cursor, '\n', &raw_line_cursor)) {
+        struct aws_byte_cursor line = aws_byte_cursor_trim_pred(&raw_line_cursor, aws_isspace);
+        if (line.len == 0) {
+            continue;
+        }
+
+        if (!header_checked) {
+            if (!aws_byte_cursor_eq_c_str(&line, s_warm_address_cache_header)) {
+                AWS_LOGF_WARN(
+                    AWS_LS_IO_DNS,
+                    "static: warm address cache file '%s' has an unrecognized header, ignoring it",
+                    file_path);
+                goto done;
+            }
+            header_checked = true;
+            continue;
+        }
+
+        struct aws_byte_cursor field;
+        AWS_ZERO_STRUCT(field);
+        uint64_t record_type_value = 0;
+        uint64_t remaining_ttl_ns = 0;
+        uint64_t connection_failure_count = 0;
+
+        bool valid = aws_byte_cursor_next_split(&line, ' ', &field) &&
+                     !aws_byte_cursor_utf8_parse_u64(field, &record_type_value);
+        valid = valid && aws_byte_cursor_next_split(&line, ' ', &field) &&
+                !aws_byte_cursor_utf8_parse_u64(field, &remaining_ttl_ns);
+        valid = valid && aws_byte_cursor_next_split(&line, ' ', &field) &&
+                !aws_byte_cursor_utf8_parse_u64(field, &connection_failure_count);
+
+        struct aws_byte_cursor address_cursor;
+        AWS_ZERO_STRUCT(address_cursor);
+        valid = valid && aws_byte_cursor_next_split(&line, ' ', &address_cursor) && address_cursor.len > 0;
+
+        struct aws_byte_cursor host_cursor;
+        AWS_ZERO_STRUCT(host_cursor);
+        valid = valid && aws_byte_cursor_next_split(&line, ' ', &host_cursor) && host_cursor.len > 0;
+
+        valid = valid && (record_type_value == AWS_ADDRESS_RECORD_TYPE_A ||
+                          record_type_value == AWS_ADDRESS_RECORD_TYPE_AAAA);
+
+        if (!valid) {
+            AWS_LOGF_WARN(
+                AWS_LS_IO_DNS, "static: skipping malformed record in warm address cache file '%s'", file_path);
+            continue;
+        }
+
+        struct aws_host_address address;
+        AWS_ZERO_STRUCT(address);
+        address.allocator = allocator;
+        address.host = aws_string_new_from_cursor(allocator, &host_cursor);
+        address.address = aws_string_new_from_cursor(allocator, &address_cursor);
+        address.record_type = (enum aws_address_record_type)record_type_value;
+        address.expiry = now + remaining_ttl_ns;
+        address.connection_failure_count = (size_t)connection_failure_count;
+
+        if (address.host == NULL || address.address == NULL) {
+            aws_host_address_clean_up(&address);
+            continue;
+        }
+
+        struct aws_hash_element *element = NULL;
+        aws_hash_table_find(&resolver->warm_address_table, address.host, &element);
+
+        struct aws_array_list *host_address_list = NULL;
+        if (element != NULL) {
+            host_address_list = element->value;
+        } else {
+            struct aws_string *table_key = aws_string_new_from_string(allocator, address.host);
+            host_address_list = aws_mem_calloc(allocator, 1, sizeof(struct aws_array_list));
+            if (table_key == NULL || host_address_list == NULL ||
+                aws_array_list_init_dynamic(host_address_list, allocator, 2, sizeof(struct aws_host_address)) ||
+                aws_hash_table_put(&resolver->warm_address_table, table_key, host_address_list, NULL)) {
+                aws_string_destroy(table_key);
+                if (host_address_list != NULL) {
+                    aws_array_list_clean_up(host_address_list);
+                    aws_mem_release(allocator, host_address_list);
+                }
+                aws_host_address_clean_up(&address);
+                continue;
+            }
+        }
+
+        if (aws_array_list_push_back(host_address_list, &address)) {
+            aws_host_address_clean_up(&address);
+            continue;
+        }
+
+        ++loaded_record_count;
+    }
+
+    AWS_LOGF_INFO(
+        AWS_LS_IO_DNS,
+        "static: loaded %llu warm address records from '%s'",
+        (unsigned long long)loaded_record_count,
+        file_path);
+
+done:
+
+    aws_byte_buf_clean_up(&file_contents);
+}
+
+/*
+ * Copies any still-valid warm-start records for the entry's host into its address caches.  Only called during
+ * entry construction, before the entry is visible to any other thread; the warm table itself is immutable after
+ * resolver construction, so no locking is required.
+ */
+static void s_seed_host_entry_from_warm_cache(struct default_host_resolver *resolver, struct host_entry *host_entry) {
+    struct aws_hash_element *element = NULL;
+    aws_hash_table_find(&resolver->warm_address_table, host_entry->host_name, &element);
+    if (element == NULL) {
+        return;
+    }
+
+    uint64_t now = 0;
+    (*resolver->system_clock_fn)(&now);
+
+    struct aws_array_list *host_address_list = element->value;
+    size_t seeded_count = 0;
+
+    for (size_t i = 0; i < aws_array_list_length(host_address_list); ++i) {
+        struct aws_host_address *address = NULL;
+        aws_array_list_get_at_ptr(host_address_list, (void **)&address, i);
+
+        if (address->expiry <= now) {
+            continue;
+        }
+
+        struct aws_host_address_cache_entry *cache_entry =
+            aws_mem_calloc(host_entry->allocator, 1, sizeof(struct aws_host_address_cache_entry));
+        if (cache_entry == NULL || aws_host_address_copy(address, &cache_entry->address)) {
+            aws_mem_release(host_entry->allocator, cache_entry);
+            continue;
+        }
+
+        cache_entry->entry = host_entry;
+
+        struct aws_cache *address_table = cache_entry->address.record_type == AWS_ADDRESS_RECORD_TYPE_AAAA
+                                              ? host_entry->aaaa_records
+                                              : host_entry->a_records;
+
+        if (aws_cache_put(address_table, cache_entry->address.address, cache_entry)) {
+            aws_host_address_clean_up(&cache_entry->address);
+            aws_mem_release(host_entry->allocator, cache_entry);
+            continue;
+        }
+
+        ++seeded_count;
+    }
+
+    if (seeded_count > 0) {
+        s_publish_address_snapshot(host_entry);
+
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_DNS,
+            "static: seeded %llu warm addresses for host %s",
+            (unsigned long long)seeded_count,
+            host_entry->host_name->bytes);
+    }
+}
+
+/*
+ * A bunch of convenience functions for the host resolver background thread function
+ */
+
+static struct aws_host_address_cache_entry *s_find_cached_address_entry_aux(
+    struct aws_cache *primary_records,
+    struct aws_cache *fallback_records,
+    const struct aws_string *address) {
+
+    struct aws_host_address_cache_entry *found = NULL;
+    aws_cache_find(primary_records, address, (void **)&found);
+    if (found == NULL) {
+        aws_cache_find(fallback_records, address, (void **)&found);
+    }
+
+    return found;
+}
+
+/*
+ * Looks in both the good and failed connection record sets for a given host record
+ */
+static struct aws_host_address_cache_entry *s_find_cached_address_entry(
+    struct host_entry *entry,
+    const struct aws_string *address,
+    enum aws_address_record_type record_type) {
+
+    switch (record_type) {
+        case AWS_ADDRESS_RECORD_TYPE_AAAA:
+            return s_find_cached_address_entry_aux(entry->aaaa_records, entry->failed_connection_aaaa_records, address);
 
         case AWS_ADDRESS_RECORD_TYPE_A:
             return s_find_cached_address_entry_aux(entry->a_records, entry->failed_connection_a_records, address);
@@ -739,34 +1570,104 @@ static struct aws_host_address_cache_entry *s_find_cached_address_entry(
 
 static struct aws_host_address_cache_entry *s_get_lru_address_entry_aux(
     struct aws_cache *primary_records,
-    struct aws_cache *fallback_records) {
+    struct aws_cache *fallback_records,
+    bool probe_selection) {
 
-    struct aws_host_address_cache_entry *address_entry = aws_lru_cache_use_lru_element(primary_records);
-    if (address_entry == NULL) {
+    size_t record_count = aws_cache_get_element_count(primary_records);
+    if (record_count == 0) {
         aws_lru_cache_use_lru_element(fallback_records);
+        return NULL;
     }
 
-    return address_entry;
+    if (record_count == 1 || probe_selection) {
+        return aws_lru_cache_use_lru_element(primary_records);
+    }
+
+    /*
+     * Rotate once through the good records and keep the one with the best (lowest) feedback score.  A full
+     * rotation leaves the cache ordered as it started, so probe selections still see genuine LRU order.
+     */
+    struct aws_host_address_cache_entry *best_entry = NULL;
+    double best_score = 0.0;
+    for (size_t i = 0; i < record_count; ++i) {
+        struct aws_host_address_cache_entry *candidate_entry = aws_lru_cache_use_lru_element(primary_records);
+        if (candidate_entry == NULL) {
+            break;
+        }
+
+        double candidate_score = s_address_entry_selection_score(candidate_entry);
+        if (best_entry == NULL || candidate_score < best_score) {
+            best_entry = candidate_entry;
+            best_score = candidate_score;
+        }
+    }
+
+    return best_entry;
 }
 
 /*
- * Looks in both the good and failed connection record sets for the LRU host record
+ * Looks in both the good and failed connection record sets for the next host record to vend.  Selection among
+ * good records is biased toward the lowest smoothed connect latency when feedback is available; periodically it
+ * reverts to plain LRU rotation so the other addresses keep receiving probe traffic.
  */
 static struct aws_host_address_cache_entry *s_get_lru_address(
     struct host_entry *entry,
     enum aws_address_record_type record_type) {
+
+    bool probe_selection = entry->address_selection_counter++ % AWS_ADDRESS_PROBE_SELECTION_INTERVAL == 0;
+
     switch (record_type) {
         case AWS_ADDRESS_RECORD_TYPE_AAAA:
-            return s_get_lru_address_entry_aux(entry->aaaa_records, entry->failed_connection_aaaa_records);
+            return s_get_lru_address_entry_aux(
+                entry->aaaa_records, entry->failed_connection_aaaa_records, probe_selection);
 
         case AWS_ADDRESS_RECORD_TYPE_A:
-            return s_get_lru_address_entry_aux(entry->a_records, entry->failed_connection_a_records);
+            return s_get_lru_address_entry_aux(entry->a_records, entry->failed_connection_a_records, probe_selection);
 
         default:
             return NULL;
     }
 }
 
+/*
+ * Captures the entry's current LRU address pair into a fresh snapshot and swaps it in for lock-free readers.
+ * The entry lock must be held.  The previous snapshot is freed once any copy-out sections in flight have
+ * drained; those sections only copy a couple of strings, so the wait is short and bounded.
+ */
+static void s_publish_address_snapshot(struct host_entry *host_entry) {
+    struct host_entry_address_snapshot *snapshot = NULL;
+
+    struct aws_host_address_cache_entry *aaaa_entry = s_get_lru_address(host_entry, AWS_ADDRESS_RECORD_TYPE_AAAA);
+    struct aws_host_address_cache_entry *a_entry = s_get_lru_address(host_entry, AWS_ADDRESS_RECORD_TYPE_A);
+
+    if (aaaa_entry != NULL || a_entry != NULL) {
+        snapshot = aws_mem_calloc(host_entry->allocator, 1, sizeof(struct host_entry_address_snapshot));
+        if (snapshot != NULL) {
+            snapshot->allocator = host_entry->allocator;
+            if (aaaa_entry != NULL) {
+                aws_host_address_copy(&aaaa_entry->address, &snapshot->aaaa_address);
+                snapshot->has_aaaa = true;
+            }
+            if (a_entry != NULL) {
+                aws_host_address_copy(&a_entry->address, &snapshot->a_address);
+                snapshot->has_a = true;
+            }
+        }
+        /* on allocation failure we publish NULL below and readers simply fall back to the locked path */
+    }
+
+    struct host_entry_address_snapshot *previous_snapshot =
+        aws_atomic_exchange_ptr(&host_entry->address_snapshot, snapshot);
+
+    if (previous_snapshot != NULL) {
+        while (aws_atomic_load_int(&host_entry->snapshot_reader_count) > 0) {
+            aws_thread_current_sleep(1000 /*ns*/);
+        }
+
+        s_destroy_address_snapshot(previous_snapshot);
+    }
+}
+
 static void s_update_address_cache(
     struct host_entry *host_entry,
     struct aws_array_list *address_list,
@@ -779,23 +1680,28 @@ static void s_update_address_cache(
         struct aws_host_address *fresh_resolved_address = NULL;
         aws_array_list_get_at_ptr(address_list, (void **)&fresh_resolved_address, i);
 
+        /* custom implementations may stamp a real record TTL as an absolute expiry; keep it,
+         * falling back to the max_ttl-derived expiration otherwise */
+        uint64_t expiration =
+            fresh_resolved_address->expiry != 0 ? fresh_resolved_address->expiry : new_expiration;
+
         struct aws_host_address_cache_entry *address_to_cache_entry = s_find_cached_address_entry(
             host_entry, fresh_resolved_address->address, fresh_resolved_address->record_type);
 
         if (address_to_cache_entry) {
-            address_to_cache_entry->address.expiry = new_expiration;
+            address_to_cache_entry->address.expiry = expiration;
             AWS_LOGF_TRACE(
                 AWS_LS_IO_DNS,
                 "static: updating expiry for %s for host %s to %llu",
                 address_to_cache_entry->address.address->bytes,
                 host_entry->host_name->bytes,
-                (unsigned long long)new_expiration);
+                (unsigned long long)expiration);
         } else {
             address_to_cache_entry =
                 aws_mem_calloc(host_entry->allocator, 1, sizeof(struct aws_host_address_cache_entry));
 
             aws_host_address_move(fresh_resolved_address, &address_to_cache_entry->address);
-            address_to_cache_entry->address.expiry = new_expiration;
+            address_to_cache_entry->address.expiry = expiration;
             address_to_cache_entry->entry = host_entry;
 
             struct aws_cache *address_table =
@@ -882,169 +1788,334 @@ static bool s_host_entry_finished_or_pending_request_pred(void *user_data) {
 
 static const uint64_t AWS_MINIMUM_WAIT_BETWEEN_DNS_QUERIES_NS = 100000000; /* 100 ms */
 
-static void aws_host_resolver_thread(void *arg) {
-    struct host_entry *host_entry = arg;
+/* reusable scratch lists for service passes over a host entry */
+struct host_entry_service_lists {
+    struct aws_array_list address_list;
+    struct aws_array_list new_address_list;
+    struct aws_array_list expired_address_list;
+};
 
-    uint64_t max_no_solicitation_interval = aws_timestamp_convert(
-        aws_max_u64(1, host_entry->resolution_config.max_ttl), AWS_TIMESTAMP_SECS, AWS_TIMESTAMP_NANOS, NULL);
+static int s_host_entry_service_lists_init(struct host_entry_service_lists *lists, struct aws_allocator *allocator) {
+    AWS_ZERO_STRUCT(*lists);
 
-    uint64_t wait_between_resolves_interval =
-        aws_min_u64(max_no_solicitation_interval, host_entry->resolve_frequency_ns);
+    if (aws_array_list_init_dynamic(&lists->address_list, allocator, 4, sizeof(struct aws_host_address))) {
+        return AWS_OP_ERR;
+    }
 
-    uint64_t shutdown_only_wait_time = AWS_MINIMUM_WAIT_BETWEEN_DNS_QUERIES_NS;
-    uint64_t request_interruptible_wait_time = 0;
-    if (wait_between_resolves_interval > shutdown_only_wait_time) {
-        request_interruptible_wait_time = wait_between_resolves_interval - shutdown_only_wait_time;
+    if (aws_array_list_init_dynamic(&lists->new_address_list, allocator, 4, sizeof(struct aws_host_address))) {
+        return AWS_OP_ERR;
     }
 
-    struct aws_linked_list listener_list;
-    aws_linked_list_init(&listener_list);
+    if (aws_array_list_init_dynamic(&lists->expired_address_list, allocator, 4, sizeof(struct aws_host_address))) {
+        return AWS_OP_ERR;
+    }
 
-    struct aws_linked_list listener_destroy_list;
-    aws_linked_list_init(&listener_destroy_list);
+    return AWS_OP_SUCCESS;
+}
 
-    bool keep_going = true;
+static void s_host_entry_service_lists_clean_up(struct host_entry_service_lists *lists) {
+    AWS_FATAL_ASSERT(aws_array_list_length(&lists->address_list) == 0);
+    AWS_FATAL_ASSERT(aws_array_list_length(&lists->new_address_list) == 0);
+    AWS_FATAL_ASSERT(aws_array_list_length(&lists->expired_address_list) == 0);
 
-    struct aws_array_list address_list;
-    AWS_ZERO_STRUCT(address_list);
-    struct aws_array_list new_address_list;
-    AWS_ZERO_STRUCT(new_address_list);
-    struct aws_array_list expired_address_list;
-    AWS_ZERO_STRUCT(expired_address_list);
+    aws_array_list_clean_up(&lists->address_list);
+    aws_array_list_clean_up(&lists->new_address_list);
+    aws_array_list_clean_up(&lists->expired_address_list);
+}
 
-    if (aws_array_list_init_dynamic(&address_list, host_entry->allocator, 4, sizeof(struct aws_host_address))) {
-        goto done;
+/*
+ * One resolve/cache-update/notification pass over an entry; shared by the dedicated per-entry resolver threads
+ * and the worker pool.
+ */
+static void s_service_host_entry_once(struct host_entry *host_entry, struct host_entry_service_lists *lists) {
+
+    /* resolve and then process each record */
+    int err_code = AWS_ERROR_SUCCESS;
+    if (host_entry->resolution_config.impl(
+            host_entry->allocator,
+            host_entry->host_name,
+            &lists->address_list,
+            host_entry->resolution_config.impl_data)) {
+
+        err_code = aws_last_error();
     }
 
-    if (aws_array_list_init_dynamic(&new_address_list, host_entry->allocator, 4, sizeof(struct aws_host_address))) {
-        goto done;
+    if (err_code == AWS_ERROR_SUCCESS) {
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_DNS,
+            "static, resolving host %s successful, returned %d addresses",
+            aws_string_c_str(host_entry->host_name),
+            (int)aws_array_list_length(&lists->address_list));
+    } else {
+        AWS_LOGF_WARN(
+            AWS_LS_IO_DNS,
+            "static, resolving host %s failed, ec %d (%s)",
+            aws_string_c_str(host_entry->host_name),
+            err_code,
+            aws_error_debug_str(err_code));
     }
 
-    if (aws_array_list_init_dynamic(&expired_address_list, host_entry->allocator, 4, sizeof(struct aws_host_address))) {
-        goto done;
+    uint64_t timestamp = s_get_system_time_for_default_resolver(host_entry->resolver);
+    uint64_t new_expiry = timestamp + (host_entry->resolution_config.max_ttl * NS_PER_SEC);
+
+    struct aws_linked_list pending_resolve_copy;
+    aws_linked_list_init(&pending_resolve_copy);
+
+    /*
+     * Within the lock we
+     *  (1) Update the cache with the newly resolved addresses
+     *  (2) Process all held addresses looking for expired or promotable ones
+     *  (3) Prep for callback invocations
+     */
+    aws_mutex_lock(&host_entry->entry_lock);
+
+    if (!err_code) {
+        s_update_address_cache(host_entry, &lists->address_list, new_expiry);
     }
 
-    while (keep_going) {
+    /*
+     * process and clean_up records in the entry. occasionally, failed connect records will be upgraded
+     * for retry.
+     */
+    process_records(host_entry, host_entry->aaaa_records, host_entry->failed_connection_aaaa_records);
+    process_records(host_entry, host_entry->a_records, host_entry->failed_connection_a_records);
 
-        /* resolve and then process each record */
-        int err_code = AWS_ERROR_SUCCESS;
-        if (host_entry->resolution_config.impl(
-                host_entry->allocator, host_entry->host_name, &address_list, host_entry->resolution_config.impl_data)) {
+    if (err_code != AWS_ERROR_SUCCESS && aws_cache_get_element_count(host_entry->aaaa_records) == 0 &&
+        aws_cache_get_element_count(host_entry->a_records) == 0) {
+        host_entry->negative_cache_error_code = err_code;
+        host_entry->negative_cache_expiry_ns = timestamp + s_jittered_negative_cache_interval_ns();
+    } else {
+        host_entry->negative_cache_error_code = AWS_ERROR_SUCCESS;
+    }
 
-            err_code = aws_last_error();
-        }
+    aws_linked_list_swap_contents(&pending_resolve_copy, &host_entry->pending_resolution_callbacks);
+
+    aws_mutex_unlock(&host_entry->entry_lock);
+
+    /*
+     * Clean up resolved addressed outside of the lock
+     */
+    s_clear_address_list(&lists->address_list);
 
-        if (err_code == AWS_ERROR_SUCCESS) {
+    struct aws_host_address address_array[2];
+    AWS_ZERO_ARRAY(address_array);
+
+    /*
+     * Perform the actual subscriber notifications
+     */
+    while (!aws_linked_list_empty(&pending_resolve_copy)) {
+        struct aws_linked_list_node *resolution_callback_node = aws_linked_list_pop_front(&pending_resolve_copy);
+        struct pending_callback *pending_callback =
+            AWS_CONTAINER_OF(resolution_callback_node, struct pending_callback, node);
+
+        struct aws_array_list callback_address_list;
+        aws_array_list_init_static(&callback_address_list, address_array, 2, sizeof(struct aws_host_address));
+
+        aws_mutex_lock(&host_entry->entry_lock);
+        s_copy_address_into_callback_set(
+            s_get_lru_address(host_entry, AWS_ADDRESS_RECORD_TYPE_AAAA),
+            &callback_address_list,
+            host_entry->host_name);
+        s_copy_address_into_callback_set(
+            s_get_lru_address(host_entry, AWS_ADDRESS_RECORD_TYPE_A),
+            &callback_address_list,
+            host_entry->host_name);
+        aws_mutex_unlock(&host_entry->entry_lock);
+
+        size_t callback_address_list_size = aws_array_list_length(&callback_address_list);
+        if (callback_address_list_size > 0) {
             AWS_LOGF_DEBUG(
                 AWS_LS_IO_DNS,
-                "static, resolving host %s successful, returned %d addresses",
+                "static, invoking resolution callback for host %s with %d addresses",
                 aws_string_c_str(host_entry->host_name),
-                (int)aws_array_list_length(&address_list));
+                (int)callback_address_list_size);
         } else {
-            AWS_LOGF_WARN(
+            AWS_LOGF_DEBUG(
                 AWS_LS_IO_DNS,
-                "static, resolving host %s failed, ec %d (%s)",
-                aws_string_c_str(host_entry->host_name),
-                err_code,
-                aws_error_debug_str(err_code));
+                "static, invoking resolution callback for host %s with failure",
+                aws_string_c_str(host_entry->host_name));
+        }
+
+        if (callback_address_list_size > 0) {
+            pending_callback->callback(
+                host_entry->resolver,
+                host_entry->host_name,
+                AWS_OP_SUCCESS,
+                &callback_address_list,
+                pending_callback->user_data);
+
+        } else {
+            int error_code = (err_code != AWS_ERROR_SUCCESS) ? err_code : AWS_IO_DNS_QUERY_FAILED;
+            pending_callback->callback(
+                host_entry->resolver, host_entry->host_name, error_code, NULL, pending_callback->user_data);
         }
 
-        uint64_t timestamp = s_get_system_time_for_default_resolver(host_entry->resolver);
-        uint64_t new_expiry = timestamp + (host_entry->resolution_config.max_ttl * NS_PER_SEC);
+        s_clear_address_list(&callback_address_list);
 
-        struct aws_linked_list pending_resolve_copy;
-        aws_linked_list_init(&pending_resolve_copy);
+        aws_mem_release(host_entry->allocator, pending_callback);
+    }
 
-        /*
-         * Within the lock we
-         *  (1) Update the cache with the newly resolved addresses
-         *  (2) Process all held addresses looking for expired or promotable ones
-         *  (3) Prep for callback invocations
-         */
-        aws_mutex_lock(&host_entry->entry_lock);
+    aws_mutex_lock(&host_entry->entry_lock);
+
+    /*
+     * Fast-path hits are solicitations too; without folding them in here, an entry whose every request was
+     * answered from the snapshot would look idle and retire out from under active users.
+     */
+    size_t fast_path_hits = aws_atomic_exchange_int(&host_entry->unserviced_fast_path_hits, 0);
+    if (fast_path_hits > 0) {
+        host_entry->last_resolve_request_timestamp_ns = s_get_system_time_for_default_resolver(host_entry->resolver);
+        host_entry->resolves_since_last_request = 0;
+    } else {
+        ++host_entry->resolves_since_last_request;
+    }
+
+    s_publish_address_snapshot(host_entry);
+    aws_mutex_unlock(&host_entry->entry_lock);
+}
+
+/*
+ * Decides whether an entry stays alive after a service pass: it retires once no requests have arrived for its
+ * maximum TTL, or once it was told to shut down; retiring removes it from the resolver's table.  Returns true
+ * if the entry should be serviced again later; on false the caller owns running the entry's shutdown epilogue.
+ */
+static bool s_evaluate_host_entry_retirement(struct host_entry *host_entry, struct host_entry_service_lists *lists) {
+
+    uint64_t max_no_solicitation_interval = aws_timestamp_convert(
+        aws_max_u64(1, host_entry->resolution_config.max_ttl), AWS_TIMESTAMP_SECS, AWS_TIMESTAMP_NANOS, NULL);
+
+    /*
+     * This is a bit awkward that we unlock the entry and then relock both the shard and the entry, but it
+     * is mandatory that -- in order to maintain the consistent view of the shard's table (entry exist => entry
+     * is alive and can be queried) -- we have the shard lock as well before making the decision to remove
+     * the entry from the table and terminate the thread.
+     */
+    struct default_host_resolver *resolver = host_entry->resolver->impl;
+    struct resolver_table_shard *shard = s_get_table_shard(resolver, host_entry->host_name);
+    aws_mutex_lock(&shard->lock);
+
+    aws_mutex_lock(&host_entry->entry_lock);
+
+    uint64_t now = s_get_system_time_for_default_resolver(host_entry->resolver);
+
+    /*
+     * The only way we terminate the loop with pending queries is if the resolver itself has no more references
+     * to it and is going away.  In that case, the pending queries will be completed (with failure) by the
+     * final clean up of this entry.
+     */
+    if (!host_entry->pinned && aws_linked_list_empty(&host_entry->pending_resolution_callbacks) &&
+        host_entry->last_resolve_request_timestamp_ns + max_no_solicitation_interval < now) {
+        host_entry->state = DRS_SHUTTING_DOWN;
+    }
 
-        if (!err_code) {
-            s_update_address_cache(host_entry, &address_list, new_expiry);
+    bool keep_going = host_entry->state == DRS_ACTIVE;
+    if (!keep_going) {
+        aws_hash_table_remove(&shard->host_entry_table, host_entry->host_name, NULL, NULL);
+    }
+
+    aws_array_list_swap_contents(&host_entry->new_addresses, &lists->new_address_list);
+    aws_array_list_swap_contents(&host_entry->expired_addresses, &lists->expired_address_list);
+
+    aws_mutex_unlock(&host_entry->entry_lock);
+    aws_mutex_unlock(&shard->lock);
+
+    /* one coalesced notification per service pass, delivered before the delta lists are recycled */
+    s_notify_host_listeners(
+        host_entry->resolver, host_entry->host_name, &lists->new_address_list, &lists->expired_address_list);
+
+    s_clear_address_list(&lists->new_address_list);
+    s_clear_address_list(&lists->expired_address_list);
+
+    return keep_going;
+}
+
+/* minimum absolute expiry across the cache's records; rotates the LRU order like process_records
+ * does, which is harmless. Call with the entry lock held. */
+static uint64_t s_earliest_record_expiry(struct aws_cache *records, uint64_t earliest) {
+    size_t record_count = aws_cache_get_element_count(records);
+    for (size_t index = 0; index < record_count; ++index) {
+        struct aws_host_address_cache_entry *lru_element_entry = aws_lru_cache_use_lru_element(records);
+        if (lru_element_entry->address.expiry < earliest) {
+            earliest = lru_element_entry->address.expiry;
         }
+    }
 
-        /*
-         * process and clean_up records in the entry. occasionally, failed connect records will be upgraded
-         * for retry.
-         */
-        process_records(host_entry, host_entry->aaaa_records, host_entry->failed_connection_aaaa_records);
-        process_records(host_entry, host_entry->a_records, host_entry->failed_connection_a_records);
+    return earliest;
+}
 
-        aws_linked_list_swap_contents(&pending_resolve_copy, &host_entry->pending_resolution_callbacks);
+/*
+ * TTL-aligned refresh scheduling: aim the next refresh at the earliest cached-record expiry minus
+ * the configured lead time, clamped to the configured floor/ceiling, so cache freshness is
+ * maintained with the minimum query rate.  Returns fallback_interval_ns when the entry isn't
+ * opted in, or while the cache is empty (so a failing host keeps retrying at the old cadence).
+ */
+static uint64_t s_ttl_aligned_wait_interval_ns(struct host_entry *host_entry, uint64_t fallback_interval_ns) {
+    const struct aws_host_resolution_config *config = &host_entry->resolution_config;
+    if (!config->ttl_aligned_refresh) {
+        return fallback_interval_ns;
+    }
 
-        aws_mutex_unlock(&host_entry->entry_lock);
+    uint64_t lead_ns = config->refresh_lead_time_ns != 0 ? config->refresh_lead_time_ns : NS_PER_SEC;
+    uint64_t floor_ns = config->min_resolve_interval_ns != 0 ? config->min_resolve_interval_ns : fallback_interval_ns;
+    uint64_t ceiling_ns = config->max_resolve_interval_ns != 0
+                              ? config->max_resolve_interval_ns
+                              : aws_timestamp_convert(
+                                    aws_max_u64(1, config->max_ttl), AWS_TIMESTAMP_SECS, AWS_TIMESTAMP_NANOS, NULL);
 
-        /*
-         * Clean up resolved addressed outside of the lock
-         */
-        s_clear_address_list(&address_list);
+    aws_mutex_lock(&host_entry->entry_lock);
+    uint64_t earliest = UINT64_MAX;
+    earliest = s_earliest_record_expiry(host_entry->aaaa_records, earliest);
+    earliest = s_earliest_record_expiry(host_entry->a_records, earliest);
+    aws_mutex_unlock(&host_entry->entry_lock);
 
-        struct aws_host_address address_array[2];
-        AWS_ZERO_ARRAY(address_array);
+    if (earliest == UINT64_MAX) {
+        return fallback_interval_ns;
+    }
 
-        /*
-         * Perform the actual subscriber notifications
-         */
-        while (!aws_linked_list_empty(&pending_resolve_copy)) {
-            struct aws_linked_list_node *resolution_callback_node = aws_linked_list_pop_front(&pending_resolve_copy);
-            struct pending_callback *pending_callback =
-                AWS_CONTAINER_OF(resolution_callback_node, struct pending_callback, node);
+    uint64_t now = s_get_system_time_for_default_resolver(host_entry->resolver);
+    uint64_t until_expiry = earliest > now ? earliest - now : 0;
+    uint64_t interval = until_expiry > lead_ns ? until_expiry - lead_ns : 0;
 
-            struct aws_array_list callback_address_list;
-            aws_array_list_init_static(&callback_address_list, address_array, 2, sizeof(struct aws_host_address));
+    if (interval < floor_ns) {
+        interval = floor_ns;
+    }
+    if (interval > ceiling_ns) {
+        interval = ceiling_ns;
+    }
 
-            aws_mutex_lock(&host_entry->entry_lock);
-            s_copy_address_into_callback_set(
-                s_get_lru_address(host_entry, AWS_ADDRESS_RECORD_TYPE_AAAA),
-                &callback_address_list,
-                host_entry->host_name);
-            s_copy_address_into_callback_set(
-                s_get_lru_address(host_entry, AWS_ADDRESS_RECORD_TYPE_A),
-                &callback_address_list,
-                host_entry->host_name);
-            aws_mutex_unlock(&host_entry->entry_lock);
+    return interval;
+}
 
-            size_t callback_address_list_size = aws_array_list_length(&callback_address_list);
-            if (callback_address_list_size > 0) {
-                AWS_LOGF_DEBUG(
-                    AWS_LS_IO_DNS,
-                    "static, invoking resolution callback for host %s with %d addresses",
-                    aws_string_c_str(host_entry->host_name),
-                    (int)callback_address_list_size);
-            } else {
-                AWS_LOGF_DEBUG(
-                    AWS_LS_IO_DNS,
-                    "static, invoking resolution callback for host %s with failure",
-                    aws_string_c_str(host_entry->host_name));
-            }
+static void aws_host_resolver_thread(void *arg) {
+    struct host_entry *host_entry = arg;
 
-            if (callback_address_list_size > 0) {
-                pending_callback->callback(
-                    host_entry->resolver,
-                    host_entry->host_name,
-                    AWS_OP_SUCCESS,
-                    &callback_address_list,
-                    pending_callback->user_data);
+    uint64_t max_no_solicitation_interval = aws_timestamp_convert(
+        aws_max_u64(1, host_entry->resolution_config.max_ttl), AWS_TIMESTAMP_SECS, AWS_TIMESTAMP_NANOS, NULL);
 
-            } else {
-                int error_code = (err_code != AWS_ERROR_SUCCESS) ? err_code : AWS_IO_DNS_QUERY_FAILED;
-                pending_callback->callback(
-                    host_entry->resolver, host_entry->host_name, error_code, NULL, pending_callback->user_data);
-            }
+    bool keep_going = true;
 
-            s_clear_address_list(&callback_address_list);
+    struct host_entry_service_lists service_lists;
+    if (s_host_entry_service_lists_init(&service_lists, host_entry->allocator)) {
+        goto done;
+    }
+
+    while (keep_going) {
 
-            aws_mem_release(host_entry->allocator, pending_callback);
+        s_service_host_entry_once(host_entry, &service_lists);
+
+        /* recomputed per pass: with TTL-aligned scheduling the interval tracks the cache's
+         * earliest expiry, which moves with every refresh */
+        uint64_t wait_between_resolves_interval =
+            aws_min_u64(max_no_solicitation_interval, host_entry->resolve_frequency_ns);
+        wait_between_resolves_interval = s_ttl_aligned_wait_interval_ns(host_entry, wait_between_resolves_interval);
+
+        uint64_t shutdown_only_wait_time = AWS_MINIMUM_WAIT_BETWEEN_DNS_QUERIES_NS;
+        uint64_t request_interruptible_wait_time = 0;
+        if (wait_between_resolves_interval > shutdown_only_wait_time) {
+            request_interruptible_wait_time = wait_between_resolves_interval - shutdown_only_wait_time;
         }
 
         aws_mutex_lock(&host_entry->entry_lock);
 
-        ++host_entry->resolves_since_last_request;
-
         /*
          * A long resolve frequency matched with a connection failure can induce a state of DNS starvation, where
          * additional resolution requests go into the queue but since there's no good records and the thread is sleeping
@@ -1089,42 +2160,7 @@ static void aws_host_resolver_thread(void *arg) {
 
         aws_mutex_unlock(&host_entry->entry_lock);
 
-        /*
-         * This is a bit awkward that we unlock the entry and then relock both the resolver and the entry, but it
-         * is mandatory that -- in order to maintain the consistent view of the resolver table (entry exist => entry
-         * is alive and can be queried) -- we have the resolver lock as well before making the decision to remove
-         * the entry from the table and terminate the thread.
-         */
-        struct default_host_resolver *resolver = host_entry->resolver->impl;
-        aws_mutex_lock(&resolver->resolver_lock);
-
-        aws_mutex_lock(&host_entry->entry_lock);
-
-        uint64_t now = s_get_system_time_for_default_resolver(host_entry->resolver);
-
-        /*
-         * The only way we terminate the loop with pending queries is if the resolver itself has no more references
-         * to it and is going away.  In that case, the pending queries will be completed (with failure) by the
-         * final clean up of this entry.
-         */
-        if (aws_linked_list_empty(&host_entry->pending_resolution_callbacks) &&
-            host_entry->last_resolve_request_timestamp_ns + max_no_solicitation_interval < now) {
-            host_entry->state = DRS_SHUTTING_DOWN;
-        }
-
-        keep_going = host_entry->state == DRS_ACTIVE;
-        if (!keep_going) {
-            aws_hash_table_remove(&resolver->host_entry_table, host_entry->host_name, NULL, NULL);
-        }
-
-        aws_array_list_swap_contents(&host_entry->new_addresses, &new_address_list);
-        aws_array_list_swap_contents(&host_entry->expired_addresses, &expired_address_list);
-
-        aws_mutex_unlock(&host_entry->entry_lock);
-        aws_mutex_unlock(&resolver->resolver_lock);
-
-        s_clear_address_list(&new_address_list);
-        s_clear_address_list(&expired_address_list);
+        keep_going = s_evaluate_host_entry_retirement(host_entry, &service_lists);
     }
 
     AWS_LOGF_DEBUG(
@@ -1135,13 +2171,7 @@ static void aws_host_resolver_thread(void *arg) {
 
 done:
 
-    AWS_FATAL_ASSERT(aws_array_list_length(&address_list) == 0);
-    AWS_FATAL_ASSERT(aws_array_list_length(&new_address_list) == 0);
-    AWS_FATAL_ASSERT(aws_array_list_length(&expired_address_list) == 0);
-
-    aws_array_list_clean_up(&address_list);
-    aws_array_list_clean_up(&new_address_list);
-    aws_array_list_clean_up(&expired_address_list);
+    s_host_entry_service_lists_clean_up(&service_lists);
 
     /* trigger the purge complete callback */
     if (host_entry->on_host_purge_complete != NULL) {
@@ -1151,6 +2181,117 @@ done:
     aws_thread_current_at_exit(s_on_host_entry_shutdown_completion, host_entry);
 }
 
+/*
+ * Worker pool servicing loop.  Each worker repeatedly picks whichever queued entry is due soonest; if nothing
+ * is due yet it sleeps until the earliest deadline (or a poke).  Entries are absent from the queue while a
+ * worker has them in hand, so no entry is ever serviced by two workers at once.
+ */
+static void s_resolver_worker_thread(void *arg) {
+    struct resolver_worker_pool *pool = arg;
+
+    aws_thread_current_at_exit(s_on_worker_shutdown_completion, pool);
+
+    struct host_entry_service_lists service_lists;
+    if (s_host_entry_service_lists_init(&service_lists, pool->allocator)) {
+        /* the pool degrades to fewer workers; the remaining ones still service every entry */
+        s_host_entry_service_lists_clean_up(&service_lists);
+        return;
+    }
+
+    aws_mutex_lock(&pool->lock);
+
+    for (;;) {
+        uint64_t now = 0;
+        pool->system_clock_fn(&now);
+
+        struct host_entry *next_entry = NULL;
+        uint64_t earliest_due_time = UINT64_MAX;
+        for (struct aws_linked_list_node *node = aws_linked_list_begin(&pool->pending_entries);
+             node != aws_linked_list_end(&pool->pending_entries);
+             node = aws_linked_list_next(node)) {
+            struct host_entry *entry = AWS_CONTAINER_OF(node, struct host_entry, pool_node);
+            if (entry->pool_due_time_ns < earliest_due_time) {
+                earliest_due_time = entry->pool_due_time_ns;
+                next_entry = entry;
+            }
+        }
+
+        if (next_entry != NULL && earliest_due_time <= now) {
+            aws_linked_list_remove(&next_entry->pool_node);
+            next_entry->in_pool_queue = false;
+            next_entry->pool_min_service_time_ns = now + AWS_MINIMUM_WAIT_BETWEEN_DNS_QUERIES_NS;
+            aws_mutex_unlock(&pool->lock);
+
+            s_service_host_entry_once(next_entry, &service_lists);
+            bool keep_going = s_evaluate_host_entry_retirement(next_entry, &service_lists);
+
+            if (keep_going) {
+                /*
+                 * mirror the dedicated thread's chained waits: the next service lands at the resolve interval,
+                 * pulled forward to the minimum inter-query spacing when requests are already waiting
+                 */
+                aws_mutex_lock(&next_entry->entry_lock);
+                bool pending_requests = !aws_linked_list_empty(&next_entry->pending_resolution_callbacks);
+                aws_mutex_unlock(&next_entry->entry_lock);
+
+                uint64_t max_no_solicitation_interval = aws_timestamp_convert(
+                    aws_max_u64(1, next_entry->resolution_config.max_ttl),
+                    AWS_TIMESTAMP_SECS,
+                    AWS_TIMESTAMP_NANOS,
+                    NULL);
+                uint64_t wait_between_resolves_interval =
+                    aws_min_u64(max_no_solicitation_interval, next_entry->resolve_frequency_ns);
+                wait_between_resolves_interval =
+                    s_ttl_aligned_wait_interval_ns(next_entry, wait_between_resolves_interval);
+
+                uint64_t service_complete_time = 0;
+                pool->system_clock_fn(&service_complete_time);
+
+                uint64_t due_time = service_complete_time + wait_between_resolves_interval;
+                if (pending_requests && next_entry->pool_min_service_time_ns < due_time) {
+                    due_time = next_entry->pool_min_service_time_ns;
+                }
+
+                aws_mutex_lock(&pool->lock);
+                if (next_entry->pool_deferred_due_time_ns < due_time) {
+                    /* a poke landed while the entry was in hand */
+                    due_time = next_entry->pool_deferred_due_time_ns;
+                }
+                next_entry->pool_deferred_due_time_ns = UINT64_MAX;
+                next_entry->pool_due_time_ns = due_time;
+                next_entry->in_pool_queue = true;
+                aws_linked_list_push_back(&pool->pending_entries, &next_entry->pool_node);
+                /* another worker may be sleeping toward a later deadline */
+                aws_condition_variable_notify_all(&pool->signal);
+            } else {
+                /* the same epilogue a dedicated thread runs when its entry retires */
+                if (next_entry->on_host_purge_complete != NULL) {
+                    next_entry->on_host_purge_complete(next_entry->on_host_purge_complete_user_data);
+                }
+                s_on_host_entry_shutdown_completion(next_entry);
+
+                aws_mutex_lock(&pool->lock);
+            }
+
+            continue;
+        }
+
+        if (pool->shutting_down && aws_linked_list_empty(&pool->pending_entries)) {
+            break;
+        }
+
+        if (next_entry == NULL) {
+            aws_condition_variable_wait(&pool->signal, &pool->lock);
+        } else {
+            aws_condition_variable_wait_for(&pool->signal, &pool->lock, (int64_t)(earliest_due_time - now));
+        }
+    }
+
+    aws_mutex_unlock(&pool->lock);
+
+    s_host_entry_service_lists_clean_up(&service_lists);
+}
+
 static void on_cache_entry_removed_helper(struct aws_host_address_cache_entry *entry) {
     AWS_LOGF_DEBUG(
         AWS_LS_IO_DNS,
@@ -1182,7 +2323,8 @@ static void on_failed_address_entry_removed(void *value) {
 }
 
 /*
- * The resolver lock must be held before calling this function
+ * The host's shard lock must be held before calling this function.  `res` may be NULL (prefetch); in that case
+ * no pending callback is queued and the entry simply begins background resolution.
  */
 static inline int create_and_init_host_entry(
     struct aws_host_resolver *resolver,
@@ -1190,6 +2332,7 @@ static inline int create_and_init_host_entry(
     aws_on_host_resolved_result_fn *res,
     const struct aws_host_resolution_config *config,
     uint64_t timestamp,
+    bool pin_entry,
     void *user_data) {
     struct host_entry *new_host_entry = aws_mem_calloc(resolver->allocator, 1, sizeof(struct host_entry));
     if (!new_host_entry) {
@@ -1203,6 +2346,7 @@ static inline int create_and_init_host_entry(
     new_host_entry->resolve_frequency_ns =
         (config->resolve_frequency_ns != 0) ? config->resolve_frequency_ns : NS_PER_SEC;
     new_host_entry->state = DRS_ACTIVE;
+    new_host_entry->pinned = pin_entry;
 
     bool thread_init = false;
     struct pending_callback *pending_callback = NULL;
@@ -1268,37 +2412,59 @@ static inline int create_and_init_host_entry(
 
     aws_linked_list_init(&new_host_entry->pending_resolution_callbacks);
 
-    pending_callback = aws_mem_acquire(resolver->allocator, sizeof(struct pending_callback));
+    if (res != NULL) {
+        pending_callback = aws_mem_acquire(resolver->allocator, sizeof(struct pending_callback));
 
-    if (AWS_UNLIKELY(!pending_callback)) {
-        goto setup_host_entry_error;
-    }
+        if (AWS_UNLIKELY(!pending_callback)) {
+            goto setup_host_entry_error;
+        }
 
-    /*add the current callback here */
-    pending_callback->user_data = user_data;
-    pending_callback->callback = res;
-    aws_linked_list_push_back(&new_host_entry->pending_resolution_callbacks, &pending_callback->node);
+        /*add the current callback here */
+        pending_callback->user_data = user_data;
+        pending_callback->callback = res;
+        aws_linked_list_push_back(&new_host_entry->pending_resolution_callbacks, &pending_callback->node);
+    }
 
     aws_mutex_init(&new_host_entry->entry_lock);
     new_host_entry->resolution_config = *config;
     aws_condition_variable_init(&new_host_entry->entry_signal);
 
-    aws_thread_init(&new_host_entry->resolver_thread, resolver->allocator);
-    thread_init = true;
+    aws_atomic_init_ptr(&new_host_entry->address_snapshot, NULL);
+    aws_atomic_init_int(&new_host_entry->snapshot_reader_count, 0);
+    aws_atomic_init_int(&new_host_entry->unserviced_fast_path_hits, 0);
+
     struct default_host_resolver *default_host_resolver = resolver->impl;
-    if (AWS_UNLIKELY(
-            aws_hash_table_put(&default_host_resolver->host_entry_table, host_string_copy, new_host_entry, NULL))) {
-        goto setup_host_entry_error;
+    new_host_entry->worker_pool = default_host_resolver->worker_pool;
+    new_host_entry->pool_deferred_due_time_ns = UINT64_MAX;
+
+    s_seed_host_entry_from_warm_cache(default_host_resolver, new_host_entry);
+
+    if (new_host_entry->worker_pool == NULL) {
+        aws_thread_init(&new_host_entry->resolver_thread, resolver->allocator);
+        thread_init = true;
     }
 
-    struct aws_thread_options thread_options = *aws_default_thread_options();
-    thread_options.join_strategy = AWS_TJS_MANAGED;
-    thread_options.name = aws_byte_cursor_from_c_str("AwsHostResolver"); /* 15 characters is max for Linux */
-    if (aws_thread_launch(
-            &new_host_entry->resolver_thread, aws_host_resolver_thread, new_host_entry, &thread_options)) {
+    /* the caller holds this shard's lock */
+    struct resolver_table_shard *shard = s_get_table_shard(default_host_resolver, host_name);
+    if (AWS_UNLIKELY(aws_hash_table_put(&shard->host_entry_table, host_string_copy, new_host_entry, NULL))) {
         goto setup_host_entry_error;
     }
+
+    if (new_host_entry->worker_pool != NULL) {
+        s_worker_pool_add_entry(new_host_entry->worker_pool, new_host_entry);
+    } else {
+        struct aws_thread_options thread_options = *aws_default_thread_options();
+        thread_options.join_strategy = AWS_TJS_MANAGED;
+        thread_options.name = aws_byte_cursor_from_c_str("AwsHostResolver"); /* 15 characters is max for Linux */
+        if (aws_thread_launch(
+                &new_host_entry->resolver_thread, aws_host_resolver_thread, new_host_entry, &thread_options)) {
+            goto setup_host_entry_error;
+        }
+    }
+
+    aws_mutex_lock(&default_host_resolver->resolver_lock);
     ++default_host_resolver->pending_host_entry_shutdown_completion_callbacks;
+    aws_mutex_unlock(&default_host_resolver->resolver_lock);
 
     return AWS_OP_SUCCESS;
 
@@ -1317,6 +2483,69 @@ setup_host_entry_error:
     return AWS_OP_ERR;
 }
 
+static int s_resolver_prefetch_hosts(
+    struct aws_host_resolver *resolver,
+    const struct aws_host_resolver_prefetch_host_options *options) {
+
+    if (options == NULL || options->hosts == NULL || options->host_count == 0) {
+        AWS_LOGF_ERROR(AWS_LS_IO_DNS, "Cannot prefetch hosts; no host names were supplied.");
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    struct default_host_resolver *default_host_resolver = resolver->impl;
+
+    struct aws_host_resolution_config resolution_config = aws_host_resolver_init_default_resolution_config();
+    if (options->config != NULL) {
+        resolution_config = *options->config;
+    }
+
+    AWS_LOGF_INFO(
+        AWS_LS_IO_DNS,
+        "id=%p: prefetching %llu hosts for continuous background resolution",
+        (void *)resolver,
+        (unsigned long long)options->host_count);
+
+    for (size_t i = 0; i < options->host_count; ++i) {
+        const struct aws_string *host_name = options->hosts[i];
+        uint64_t timestamp = s_get_system_time_for_default_resolver(resolver);
+
+        struct resolver_table_shard *shard = s_get_table_shard(default_host_resolver, host_name);
+        aws_mutex_lock(&shard->lock);
+
+        struct aws_hash_element *element = NULL;
+        aws_hash_table_find(&shard->host_entry_table, host_name, &element);
+
+        if (element != NULL) {
+            struct host_entry *host_entry = element->value;
+            AWS_FATAL_ASSERT(host_entry != NULL);
+
+            aws_mutex_lock(&host_entry->entry_lock);
+            host_entry->pinned = true;
+            host_entry->last_resolve_request_timestamp_ns = timestamp;
+            host_entry->resolves_since_last_request = 0;
+            aws_mutex_unlock(&host_entry->entry_lock);
+
+            aws_mutex_unlock(&shard->lock);
+            continue;
+        }
+
+        int result = create_and_init_host_entry(
+            resolver, host_name, NULL /*res*/, &resolution_config, timestamp, true /*pin_entry*/, NULL /*user_data*/);
+        aws_mutex_unlock(&shard->lock);
+
+        if (result) {
+            AWS_LOGF_ERROR(
+                AWS_LS_IO_DNS,
+                "id=%p: failed to begin prefetch resolution for host %s",
+                (void *)resolver,
+                host_name->bytes);
+            return AWS_OP_ERR;
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
 static int default_resolve_host(
     struct aws_host_resolver *resolver,
     const struct aws_string *host_name,
@@ -1330,11 +2559,12 @@ static int default_resolve_host(
     uint64_t timestamp = s_get_system_time_for_default_resolver(resolver);
 
     struct default_host_resolver *default_host_resolver = resolver->impl;
-    aws_mutex_lock(&default_host_resolver->resolver_lock);
+    struct resolver_table_shard *shard = s_get_table_shard(default_host_resolver, host_name);
+    aws_mutex_lock(&shard->lock);
 
     struct aws_hash_element *element = NULL;
     /* we don't care about the error code here, only that the host_entry was found or not. */
-    aws_hash_table_find(&default_host_resolver->host_entry_table, host_name, &element);
+    aws_hash_table_find(&shard->host_entry_table, host_name, &element);
 
     struct host_entry *host_entry = NULL;
     if (element != NULL) {
@@ -1349,26 +2579,106 @@ static int default_resolve_host(
             (void *)resolver,
             host_name->bytes);
 
-        result = create_and_init_host_entry(resolver, host_name, res, config, timestamp, user_data);
-        aws_mutex_unlock(&default_host_resolver->resolver_lock);
+        result = create_and_init_host_entry(resolver, host_name, res, config, timestamp, false /*pin_entry*/, user_data);
+        aws_mutex_unlock(&shard->lock);
 
         return result;
     }
 
+    /*
+     * Fast path: answer from the entry's published address snapshot without touching the entry lock.  The shard
+     * lock keeps the entry alive while we look, and the reader count keeps the snapshot alive while we copy; the
+     * increment must happen before the pointer load so the publisher can't free the snapshot underneath us.
+     */
+    {
+        struct aws_host_address fast_path_address_array[2];
+        AWS_ZERO_ARRAY(fast_path_address_array);
+        struct aws_array_list fast_path_address_list;
+        aws_array_list_init_static(&fast_path_address_list, fast_path_address_array, 2, sizeof(struct aws_host_address));
+
+        aws_atomic_fetch_add(&host_entry->snapshot_reader_count, 1);
+
+        struct host_entry_address_snapshot *snapshot = aws_atomic_load_ptr(&host_entry->address_snapshot);
+        if (snapshot != NULL) {
+            if (snapshot->has_aaaa) {
+                struct aws_host_address aaaa_record_cpy;
+                aws_host_address_copy(&snapshot->aaaa_address, &aaaa_record_cpy);
+                aws_array_list_push_back(&fast_path_address_list, &aaaa_record_cpy);
+            }
+            if (snapshot->has_a) {
+                struct aws_host_address a_record_cpy;
+                aws_host_address_copy(&snapshot->a_address, &a_record_cpy);
+                aws_array_list_push_back(&fast_path_address_list, &a_record_cpy);
+            }
+        }
+
+        aws_atomic_fetch_sub(&host_entry->snapshot_reader_count, 1);
+
+        if (aws_array_list_length(&fast_path_address_list) > 0) {
+            /* let the next service pass know this entry is still being solicited */
+            aws_atomic_fetch_add(&host_entry->unserviced_fast_path_hits, 1);
+            aws_mutex_unlock(&shard->lock);
+
+            AWS_LOGF_DEBUG(
+                AWS_LS_IO_DNS,
+                "id=%p: snapshot entries found for %s returning to caller.",
+                (void *)resolver,
+                host_name->bytes);
+
+            res(resolver, host_name, AWS_OP_SUCCESS, &fast_path_address_list, user_data);
+
+            for (size_t i = 0; i < aws_array_list_length(&fast_path_address_list); ++i) {
+                struct aws_host_address *address_ptr = NULL;
+                aws_array_list_get_at_ptr(&fast_path_address_list, (void **)&address_ptr, i);
+                aws_host_address_clean_up(address_ptr);
+            }
+
+            aws_array_list_clean_up(&fast_path_address_list);
+
+            return result;
+        }
+
+        aws_array_list_clean_up(&fast_path_address_list);
+    }
+
     aws_mutex_lock(&host_entry->entry_lock);
 
     /*
      * We don't need to make any resolver side-affects in the remaining logic and it's impossible for the entry
-     * to disappear underneath us while holding its lock, so its safe to release the resolver lock and let other
+     * to disappear underneath us while holding its lock, so its safe to release the shard lock and let other
      * things query other entries.
      */
-    aws_mutex_unlock(&default_host_resolver->resolver_lock);
+    aws_mutex_unlock(&shard->lock);
     host_entry->last_resolve_request_timestamp_ns = timestamp;
     host_entry->resolves_since_last_request = 0;
 
-    struct aws_host_address_cache_entry *aaaa_entry = aws_lru_cache_use_lru_element(host_entry->aaaa_records);
+    /*
+     * Negative cache check: a recent failed resolution with nothing left to vend fails fast here instead of
+     * queuing another pending callback.  Requests arriving after the window closes still coalesce on
+     * pending_resolution_callbacks while the next resolution attempt is in flight.
+     */
+    if (host_entry->negative_cache_error_code != AWS_ERROR_SUCCESS &&
+        timestamp < host_entry->negative_cache_expiry_ns &&
+        aws_cache_get_element_count(host_entry->aaaa_records) == 0 &&
+        aws_cache_get_element_count(host_entry->a_records) == 0) {
+        int negative_cache_error_code = host_entry->negative_cache_error_code;
+        aws_mutex_unlock(&host_entry->entry_lock);
+
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_DNS,
+            "id=%p: cached resolution failure found for %s, failing fast with ec %d",
+            (void *)resolver,
+            host_name->bytes,
+            negative_cache_error_code);
+
+        res(resolver, host_name, negative_cache_error_code, NULL, user_data);
+
+        return result;
+    }
+
+    struct aws_host_address_cache_entry *aaaa_entry = s_get_lru_address(host_entry, AWS_ADDRESS_RECORD_TYPE_AAAA);
     struct aws_host_address *aaaa_record = (aaaa_entry != NULL) ? &aaaa_entry->address : NULL;
-    struct aws_host_address_cache_entry *a_entry = aws_lru_cache_use_lru_element(host_entry->a_records);
+    struct aws_host_address_cache_entry *a_entry = s_get_lru_address(host_entry, AWS_ADDRESS_RECORD_TYPE_A);
     struct aws_host_address *a_record = (a_entry != NULL) ? &a_entry->address : NULL;
 
     struct aws_host_address address_array[2];
@@ -1434,6 +2744,9 @@ static int default_resolve_host(
          * is still around once the lock is released.
          */
         aws_condition_variable_notify_all(&host_entry->entry_signal);
+        if (host_entry->worker_pool != NULL) {
+            s_worker_pool_poke_entry(host_entry, false /*entry_shutting_down*/);
+        }
     } else {
         result = AWS_OP_ERR;
     }
@@ -1450,10 +2763,11 @@ static size_t default_get_host_address_count(
     struct default_host_resolver *default_host_resolver = host_resolver->impl;
     size_t address_count = 0;
 
-    aws_mutex_lock(&default_host_resolver->resolver_lock);
+    struct resolver_table_shard *shard = s_get_table_shard(default_host_resolver, host_name);
+    aws_mutex_lock(&shard->lock);
 
     struct aws_hash_element *element = NULL;
-    aws_hash_table_find(&default_host_resolver->host_entry_table, host_name, &element);
+    aws_hash_table_find(&shard->host_entry_table, host_name, &element);
     if (element != NULL) {
         struct host_entry *host_entry = element->value;
         if (host_entry != NULL) {
@@ -1471,11 +2785,260 @@ static size_t default_get_host_address_count(
         }
     }
 
-    aws_mutex_unlock(&default_host_resolver->resolver_lock);
+    aws_mutex_unlock(&shard->lock);
 
     return address_count;
 }
 
+static void s_host_listener_entry_destroy(struct host_listener_entry *listener_entry) {
+    AWS_ASSERT(aws_linked_list_empty(&listener_entry->listeners) && listener_entry->checked_out_count == 0);
+
+    aws_string_destroy(listener_entry->host_name);
+    aws_mem_release(listener_entry->allocator, listener_entry);
+}
+
+/* resolver lock must be held */
+static struct host_listener_entry *s_find_host_listener_entry(
+    struct default_host_resolver *default_host_resolver,
+    const struct aws_string *host_name) {
+
+    struct aws_hash_element *element = NULL;
+    aws_hash_table_find(&default_host_resolver->listener_entry_table, host_name, &element);
+
+    return element != NULL ? element->value : NULL;
+}
+
+/* resolver lock must be held */
+static void s_remove_host_listener_entry_if_empty(
+    struct default_host_resolver *default_host_resolver,
+    struct host_listener_entry *listener_entry) {
+
+    if (aws_linked_list_empty(&listener_entry->listeners) && listener_entry->checked_out_count == 0) {
+        aws_hash_table_remove(&default_host_resolver->listener_entry_table, listener_entry->host_name, NULL, NULL);
+        s_host_listener_entry_destroy(listener_entry);
+    }
+}
+
+/* final destruction; must not be called with the resolver lock held since it may release the resolver */
+static void s_host_listener_destroy(struct host_listener *listener) {
+    struct aws_host_resolver *resolver = listener->resolver;
+    aws_host_listener_shutdown_fn *on_shutdown = listener->on_shutdown;
+    void *user_data = listener->user_data;
+
+    aws_string_destroy(listener->host_name);
+    aws_mem_release(listener->allocator, listener);
+
+    if (on_shutdown != NULL) {
+        on_shutdown(user_data);
+    }
+
+    aws_host_resolver_release(resolver);
+}
+
+static struct aws_host_listener *s_resolver_add_host_listener(
+    struct aws_host_resolver *resolver,
+    const struct aws_host_listener_options *options) {
+
+    if (options == NULL || options->on_address_batch == NULL || options->host_name.len == 0) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_DNS, "id=%p: invalid options passed to add_host_listener.", (void *)resolver);
+        aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        return NULL;
+    }
+
+    struct default_host_resolver *default_host_resolver = resolver->impl;
+
+    struct host_listener *listener = aws_mem_calloc(resolver->allocator, 1, sizeof(struct host_listener));
+    listener->allocator = resolver->allocator;
+    listener->on_address_batch = options->on_address_batch;
+    listener->on_shutdown = options->on_shutdown;
+    listener->user_data = options->user_data;
+
+    listener->host_name = aws_string_new_from_cursor(resolver->allocator, &options->host_name);
+    if (listener->host_name == NULL) {
+        goto on_error;
+    }
+
+    listener->resolver = aws_host_resolver_acquire(resolver);
+
+    aws_mutex_lock(&default_host_resolver->resolver_lock);
+
+    if (default_host_resolver->state != DRS_ACTIVE) {
+        aws_mutex_unlock(&default_host_resolver->resolver_lock);
+        aws_raise_error(AWS_ERROR_INVALID_STATE);
+        goto on_error;
+    }
+
+    struct host_listener_entry *listener_entry = s_find_host_listener_entry(default_host_resolver, listener->host_name);
+    if (listener_entry == NULL) {
+        listener_entry = aws_mem_calloc(resolver->allocator, 1, sizeof(struct host_listener_entry));
+        listener_entry->allocator = resolver->allocator;
+        aws_linked_list_init(&listener_entry->listeners);
+
+        listener_entry->host_name = aws_string_new_from_string(resolver->allocator, listener->host_name);
+        if (listener_entry->host_name == NULL ||
+            aws_hash_table_put(
+                &default_host_resolver->listener_entry_table, listener_entry->host_name, listener_entry, NULL)) {
+            aws_mutex_unlock(&default_host_resolver->resolver_lock);
+            s_host_listener_entry_destroy(listener_entry);
+            goto on_error;
+        }
+    }
+
+    aws_linked_list_push_back(&listener_entry->listeners, &listener->node);
+
+    aws_mutex_unlock(&default_host_resolver->resolver_lock);
+
+    AWS_LOGF_DEBUG(
+        AWS_LS_IO_DNS,
+        "id=%p: added listener %p for host %s.",
+        (void *)resolver,
+        (void *)listener,
+        listener->host_name->bytes);
+
+    return (struct aws_host_listener *)listener;
+
+on_error:
+
+    aws_host_resolver_release(listener->resolver);
+    aws_string_destroy(listener->host_name);
+    aws_mem_release(listener->allocator, listener);
+
+    return NULL;
+}
+
+static int s_resolver_remove_host_listener(
+    struct aws_host_resolver *resolver,
+    struct aws_host_listener *listener_opaque) {
+
+    struct default_host_resolver *default_host_resolver = resolver->impl;
+    struct host_listener *listener = (struct host_listener *)listener_opaque;
+
+    bool destroy_now = false;
+
+    aws_mutex_lock(&default_host_resolver->resolver_lock);
+
+    if (listener->checked_out_for_notification) {
+        /* a servicing thread is mid-delivery with this listener; it finishes the destruction at check-in */
+        listener->pending_destroy = true;
+    } else {
+        aws_linked_list_remove(&listener->node);
+
+        struct host_listener_entry *listener_entry =
+            s_find_host_listener_entry(default_host_resolver, listener->host_name);
+        if (listener_entry != NULL) {
+            s_remove_host_listener_entry_if_empty(default_host_resolver, listener_entry);
+        }
+
+        destroy_now = true;
+    }
+
+    aws_mutex_unlock(&default_host_resolver->resolver_lock);
+
+    AWS_LOGF_DEBUG(
+        AWS_LS_IO_DNS,
+        "id=%p: removing listener %p%s.",
+        (void *)resolver,
+        (void *)listener,
+        destroy_now ? "" : " (deferred until the in-flight notification completes)");
+
+    if (destroy_now) {
+        s_host_listener_destroy(listener);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+/*
+ * Delivers one coalesced batch callback per listener for a just-completed refresh of host_name.  Only the
+ * single thread servicing the host entry calls this for a given host, so the checked-out listeners and the
+ * entry pointer are stable across the unlocked callback section.
+ */
+static void s_notify_host_listeners(
+    struct aws_host_resolver *resolver,
+    const struct aws_string *host_name,
+    const struct aws_array_list *new_address_list,
+    const struct aws_array_list *expired_address_list) {
+
+    struct default_host_resolver *default_host_resolver = resolver->impl;
+
+    bool address_set_changed =
+        aws_array_list_length(new_address_list) > 0 || aws_array_list_length(expired_address_list) > 0;
+
+    struct aws_linked_list checked_out_listeners;
+    aws_linked_list_init(&checked_out_listeners);
+
+    uint64_t address_epoch = 0;
+
+    aws_mutex_lock(&default_host_resolver->resolver_lock);
+
+    struct host_listener_entry *listener_entry = s_find_host_listener_entry(default_host_resolver, host_name);
+    if (listener_entry != NULL) {
+        if (address_set_changed) {
+            ++listener_entry->address_epoch;
+        }
+        address_epoch = listener_entry->address_epoch;
+
+        /* check every listener out onto a local list so the callbacks run without the resolver lock held */
+        while (!aws_linked_list_empty(&listener_entry->listeners)) {
+            struct aws_linked_list_node *node = aws_linked_list_pop_front(&listener_entry->listeners);
+            struct host_listener *listener = AWS_CONTAINER_OF(node, struct host_listener, node);
+
+            listener->checked_out_for_notification = true;
+            ++listener_entry->checked_out_count;
+
+            aws_linked_list_push_back(&checked_out_listeners, node);
+        }
+    }
+
+    aws_mutex_unlock(&default_host_resolver->resolver_lock);
+
+    if (aws_linked_list_empty(&checked_out_listeners)) {
+        return;
+    }
+
+    for (struct aws_linked_list_node *node = aws_linked_list_begin(&checked_out_listeners);
+         node != aws_linked_list_end(&checked_out_listeners);
+         node = aws_linked_list_next(node)) {
+        struct host_listener *listener = AWS_CONTAINER_OF(node, struct host_listener, node);
+
+        listener->on_address_batch(
+            (struct aws_host_listener *)listener,
+            new_address_list,
+            expired_address_list,
+            address_epoch,
+            listener->user_data);
+    }
+
+    struct aws_linked_list destroy_list;
+    aws_linked_list_init(&destroy_list);
+
+    aws_mutex_lock(&default_host_resolver->resolver_lock);
+
+    while (!aws_linked_list_empty(&checked_out_listeners)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&checked_out_listeners);
+        struct host_listener *listener = AWS_CONTAINER_OF(node, struct host_listener, node);
+
+        listener->checked_out_for_notification = false;
+        --listener_entry->checked_out_count;
+
+        if (listener->pending_destroy) {
+            aws_linked_list_push_back(&destroy_list, node);
+        } else {
+            aws_linked_list_push_back(&listener_entry->listeners, node);
+        }
+    }
+
+    s_remove_host_listener_entry_if_empty(default_host_resolver, listener_entry);
+
+    aws_mutex_unlock(&default_host_resolver->resolver_lock);
+
+    while (!aws_linked_list_empty(&destroy_list)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&destroy_list);
+        s_host_listener_destroy(AWS_CONTAINER_OF(node, struct host_listener, node));
+    }
+}
+
 static struct aws_host_resolver_vtable s_vtable = {
     .purge_cache = s_resolver_purge_cache,
     .purge_cache_with_callback = s_resolver_purge_cache_with_callback,
@@ -1484,6 +3047,11 @@ static struct aws_host_resolver_vtable s_vtable = {
     .get_host_address_count = default_get_host_address_count,
     .destroy = resolver_destroy,
     .purge_host_cache = s_resolver_purge_host_cache,
+    .save_address_cache = s_resolver_save_address_cache,
+    .record_connection_success = s_resolver_record_connection_success,
+    .prefetch_hosts = s_resolver_prefetch_hosts,
+    .add_host_listener = s_resolver_add_host_listener,
+    .remove_host_listener = s_resolver_remove_host_listener,
 };
 
 static void s_aws_host_resolver_destroy(struct aws_host_resolver *resolver) {
@@ -1529,10 +3097,38 @@ struct aws_host_resolver *aws_host_resolver_new_default(
     default_host_resolver->state = DRS_ACTIVE;
     aws_mutex_init(&default_host_resolver->resolver_lock);
 
+    for (size_t i = 0; i < AWS_RESOLVER_TABLE_SHARD_COUNT; ++i) {
+        struct resolver_table_shard *table_shard = &default_host_resolver->shards[i];
+
+        aws_mutex_init(&table_shard->lock);
+        if (aws_hash_table_init(
+                &table_shard->host_entry_table,
+                allocator,
+                options->max_entries / AWS_RESOLVER_TABLE_SHARD_COUNT + 1,
+                aws_hash_string,
+                aws_hash_callback_string_eq,
+                NULL,
+                NULL)) {
+            goto on_error;
+        }
+    }
+
+    if (aws_hash_table_init(
+            &default_host_resolver->warm_address_table,
+            allocator,
+            4,
+            aws_hash_string,
+            aws_hash_callback_string_eq,
+            aws_hash_callback_string_destroy,
+            s_destroy_warm_address_list)) {
+        goto on_error;
+    }
+
+    /* keys and values are owned by the listener entries themselves; removal is always explicit */
     if (aws_hash_table_init(
-            &default_host_resolver->host_entry_table,
+            &default_host_resolver->listener_entry_table,
             allocator,
-            options->max_entries,
+            4,
             aws_hash_string,
             aws_hash_callback_string_eq,
             NULL,
@@ -1552,6 +3148,21 @@ struct aws_host_resolver *aws_host_resolver_new_default(
         default_host_resolver->system_clock_fn = aws_high_res_clock_get_ticks;
     }
 
+    if (options->resolution_worker_count > 0) {
+        default_host_resolver->worker_pool = s_worker_pool_new(
+            allocator, options->resolution_worker_count, default_host_resolver->system_clock_fn);
+        if (default_host_resolver->worker_pool == NULL) {
+            AWS_LOGF_WARN(
+                AWS_LS_IO_DNS,
+                "id=%p: failed to start the resolution worker pool, falling back to a thread per host entry.",
+                (void *)resolver);
+        }
+    }
+
+    if (options->warm_address_cache_file_path != NULL) {
+        s_load_warm_address_cache(default_host_resolver, options->warm_address_cache_file_path);
+    }
+
     return resolver;
 
 on_error:
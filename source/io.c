@@ -305,6 +305,9 @@ static struct aws_error_info s_errors[] = {
         AWS_IO_TLS_ERROR_READ_FAILURE,
         "Failure during TLS read."),
     AWS_DEFINE_ERROR_INFO_IO(AWS_ERROR_PEM_MALFORMED, "Malformed PEM object encountered."),
+    AWS_DEFINE_ERROR_INFO_IO(
+        AWS_IO_TLS_EARLY_DATA_REJECTED,
+        "The peer rejected TLS 1.3 early data; the data must be replayed after the handshake completes."),
 
 };
 /* clang-format on */
@@ -342,7 +345,12 @@ static struct aws_log_subject_info s_io_log_subject_infos[] = {
         "standard-retry-strategy",
         "Subject for standard retry strategy"),
     DEFINE_LOG_SUBJECT_INFO(AWS_LS_IO_PKCS11, "pkcs11", "Subject for PKCS#11 library operations"),
-    DEFINE_LOG_SUBJECT_INFO(AWS_LS_IO_PEM, "pem", "Subject for pem operations")};
+    DEFINE_LOG_SUBJECT_INFO(AWS_LS_IO_PEM, "pem", "Subject for pem operations"),
+    DEFINE_LOG_SUBJECT_INFO(
+        AWS_LS_IO_ADAPTIVE_RETRY_STRATEGY,
+        "adaptive-retry-strategy",
+        "Subject for adaptive retry strategy"),
+    DEFINE_LOG_SUBJECT_INFO(AWS_LS_IO_PACING_HANDLER, "pacing-handler", "Subject for the egress pacing handler")};
 
 static struct aws_log_subject_info_list s_io_log_subject_list = {
     .subject_list = s_io_log_subject_infos,
@@ -8,9 +8,10 @@
 #include <aws/cal/cal.h>
 #include <aws/common/atomics.h>
 #include <aws/common/clock.h>
-#include <aws/common/mutex.h>
 #include <aws/common/task_scheduler.h>
 #include <aws/common/thread.h>
+#include <aws/io/private/task_watchdog.h>
+#include <aws/io/private/timer_wheel.h>
 #include <aws/io/private/tracing.h>
 
 #include <aws/io/logging.h>
@@ -50,6 +51,7 @@ static int s_run(struct aws_event_loop *event_loop);
 static int s_stop(struct aws_event_loop *event_loop);
 static int s_wait_for_stop_completion(struct aws_event_loop *event_loop);
 static void s_schedule_task_now(struct aws_event_loop *event_loop, struct aws_task *task);
+static void s_schedule_task_now_background(struct aws_event_loop *event_loop, struct aws_task *task);
 static void s_schedule_task_future(struct aws_event_loop *event_loop, struct aws_task *task, uint64_t run_at_nanos);
 static void s_cancel_task(struct aws_event_loop *event_loop, struct aws_task *task);
 static int s_subscribe_to_io_events(
@@ -70,6 +72,7 @@ static struct aws_event_loop_vtable s_vtable = {
     .stop = s_stop,
     .wait_for_stop_completion = s_wait_for_stop_completion,
     .schedule_task_now = s_schedule_task_now,
+    .schedule_task_now_background = s_schedule_task_now_background,
     .schedule_task_future = s_schedule_task_future,
     .cancel_task = s_cancel_task,
     .subscribe_to_io_events = s_subscribe_to_io_events,
@@ -80,16 +83,31 @@ static struct aws_event_loop_vtable s_vtable = {
 
 struct epoll_loop {
     struct aws_task_scheduler scheduler;
+    /* O(1) insert/cancel for the vast majority of timers; the priority-queue scheduler above is
+     * only the fallback for timers beyond the wheel's horizon. Loop-thread access only. */
+    struct aws_timer_wheel timer_wheel;
+    /* flags tasks that hold the loop thread past their budget; loop-thread access only */
+    struct aws_task_watchdog task_watchdog;
     struct aws_thread thread_created_on;
     struct aws_thread_options thread_options;
     aws_thread_id_t thread_joined_to;
     struct aws_atomic_var running_thread_id;
     struct aws_io_handle read_task_handle;
     struct aws_io_handle write_task_handle;
-    struct aws_mutex task_pre_queue_mutex;
-    struct aws_linked_list task_pre_queue;
+    /* lock-free MPSC stack of cross-thread tasks (aws_task.node.next used as the link);
+     * the loop thread detaches the whole stack at once and reverses it to recover FIFO order. */
+    struct aws_atomic_var task_pre_queue_head;
+    /* same shape, for cross-thread submissions to the background band */
+    struct aws_atomic_var background_pre_queue_head;
+    /* FIFO low band: at most BACKGROUND_TASK_BUDGET_PER_TICK of these run per tick, after I/O
+     * events and the normal scheduler pass. Loop-thread access only. */
+    struct aws_linked_list background_tasks;
+    /* 1 while a wakeup write is pending on the pipe/eventfd, so N submissions cost one write */
+    struct aws_atomic_var wakeup_scheduled;
     struct aws_task stop_task;
     struct aws_atomic_var stop_task_ptr;
+    /* see aws_event_loop_options.busy_poll_spin_duration_us; 0 disables spinning */
+    uint64_t busy_poll_spin_duration_ns;
     int epoll_fd;
     bool should_process_task_pre_queue;
     bool should_continue;
@@ -108,10 +126,17 @@ struct epoll_event_data {
 enum {
     DEFAULT_TIMEOUT = 100 * 1000,
     MAX_EVENTS = 100,
+    /* background tasks run per tick; a non-empty backlog keeps the next epoll_wait at zero
+     * timeout, so spare capacity drains it without ever starving the data path */
+    BACKGROUND_TASK_BUDGET_PER_TICK = 16,
 };
 
 int aws_open_nonblocking_posix_pipe(int pipe_fds[2]);
 
+struct aws_event_loop *aws_event_loop_new_io_uring_with_options(
+    struct aws_allocator *alloc,
+    const struct aws_event_loop_options *options);
+
 /* Setup edge triggered epoll with a scheduler. */
 struct aws_event_loop *aws_event_loop_new_default_with_options(
     struct aws_allocator *alloc,
@@ -119,6 +144,15 @@ struct aws_event_loop *aws_event_loop_new_default_with_options(
     AWS_PRECONDITION(options);
     AWS_PRECONDITION(options->clock);
 
+    /* Prefer the io_uring loop where the kernel supports it: readiness arrives as batched completions
+     * rather than one epoll_ctl/epoll_wait round-trip per descriptor. Falls back to epoll below. */
+    struct aws_event_loop *uring_loop = aws_event_loop_new_io_uring_with_options(alloc, options);
+    if (uring_loop) {
+        return uring_loop;
+    }
+    AWS_LOGF_DEBUG(
+        AWS_LS_IO_EVENT_LOOP, "static: io_uring event loop unavailable, falling back to edge-triggered epoll");
+
     struct aws_event_loop *loop = aws_mem_calloc(alloc, 1, sizeof(struct aws_event_loop));
     if (!loop) {
         return NULL;
@@ -140,11 +174,20 @@ struct aws_event_loop *aws_event_loop_new_default_with_options(
         epoll_loop->thread_options = *aws_default_thread_options();
     }
 
+    epoll_loop->busy_poll_spin_duration_ns = aws_timestamp_convert(
+        options->busy_poll_spin_duration_us, AWS_TIMESTAMP_MICROS, AWS_TIMESTAMP_NANOS, NULL);
+
+    loop->tick_budget_ns =
+        aws_timestamp_convert(options->tick_budget_us, AWS_TIMESTAMP_MICROS, AWS_TIMESTAMP_NANOS, NULL);
+    loop->hugepage_message_pool = options->hugepage_message_pool;
+
     /* initialize thread id to NULL, it should be updated when the event loop thread starts. */
     aws_atomic_init_ptr(&epoll_loop->running_thread_id, NULL);
 
-    aws_linked_list_init(&epoll_loop->task_pre_queue);
-    epoll_loop->task_pre_queue_mutex = (struct aws_mutex)AWS_MUTEX_INIT;
+    aws_atomic_init_ptr(&epoll_loop->task_pre_queue_head, NULL);
+    aws_atomic_init_ptr(&epoll_loop->background_pre_queue_head, NULL);
+    aws_linked_list_init(&epoll_loop->background_tasks);
+    aws_atomic_init_int(&epoll_loop->wakeup_scheduled, 0);
     aws_atomic_init_ptr(&epoll_loop->stop_task_ptr, NULL);
 
     epoll_loop->epoll_fd = epoll_create(100);
@@ -194,6 +237,19 @@ struct aws_event_loop *aws_event_loop_new_default_with_options(
         goto clean_up_pipe;
     }
 
+    uint64_t now_ns = 0;
+    options->clock(&now_ns);
+    aws_timer_wheel_init(&epoll_loop->timer_wheel, now_ns);
+
+    if (aws_task_watchdog_init(
+            &epoll_loop->task_watchdog,
+            alloc,
+            options->clock,
+            aws_timestamp_convert(options->slow_task_budget_us, AWS_TIMESTAMP_MICROS, AWS_TIMESTAMP_NANOS, NULL))) {
+        goto clean_up_scheduler;
+    }
+    epoll_loop->timer_wheel.watchdog = &epoll_loop->task_watchdog;
+
     epoll_loop->should_continue = false;
 
     loop->impl_data = epoll_loop;
@@ -201,6 +257,10 @@ struct aws_event_loop *aws_event_loop_new_default_with_options(
 
     return loop;
 
+clean_up_scheduler:
+    aws_timer_wheel_clean_up(&epoll_loop->timer_wheel);
+    aws_task_scheduler_clean_up(&epoll_loop->scheduler);
+
 clean_up_pipe:
 #if USE_EFD
     close(epoll_loop->write_task_handle.data.fd);
@@ -243,12 +303,30 @@ static void s_destroy(struct aws_event_loop *event_loop) {
     /* setting this so that canceled tasks don't blow up when asking if they're on the event-loop thread. */
     epoll_loop->thread_joined_to = aws_thread_current_thread_id();
     aws_atomic_store_ptr(&epoll_loop->running_thread_id, &epoll_loop->thread_joined_to);
+    aws_timer_wheel_clean_up(&epoll_loop->timer_wheel);
     aws_task_scheduler_clean_up(&epoll_loop->scheduler);
+    aws_task_watchdog_clean_up(&epoll_loop->task_watchdog);
+
+    struct aws_linked_list_node *node = aws_atomic_exchange_ptr(&epoll_loop->task_pre_queue_head, NULL);
+    while (node) {
+        struct aws_linked_list_node *next = node->next;
+        struct aws_task *task = AWS_CONTAINER_OF(node, struct aws_task, node);
+        task->fn(task, task->arg, AWS_TASK_STATUS_CANCELED);
+        node = next;
+    }
 
-    while (!aws_linked_list_empty(&epoll_loop->task_pre_queue)) {
-        struct aws_linked_list_node *node = aws_linked_list_pop_front(&epoll_loop->task_pre_queue);
+    while (!aws_linked_list_empty(&epoll_loop->background_tasks)) {
+        struct aws_linked_list_node *bg_node = aws_linked_list_pop_front(&epoll_loop->background_tasks);
+        struct aws_task *task = AWS_CONTAINER_OF(bg_node, struct aws_task, node);
+        task->fn(task, task->arg, AWS_TASK_STATUS_CANCELED);
+    }
+
+    node = aws_atomic_exchange_ptr(&epoll_loop->background_pre_queue_head, NULL);
+    while (node) {
+        struct aws_linked_list_node *next = node->next;
         struct aws_task *task = AWS_CONTAINER_OF(node, struct aws_task, node);
         task->fn(task, task->arg, AWS_TASK_STATUS_CANCELED);
+        node = next;
     }
 
     aws_thread_clean_up(&epoll_loop->thread_created_on);
@@ -326,6 +404,19 @@ static int s_wait_for_stop_completion(struct aws_event_loop *event_loop) {
     return result;
 }
 
+static void s_signal_cross_thread_wakeup(struct aws_event_loop *event_loop, struct epoll_loop *epoll_loop) {
+    /* coalesce wakeups: only the submission that flips the flag pays for the pipe/eventfd write. */
+    if (aws_atomic_exchange_int(&epoll_loop->wakeup_scheduled, 1) == 0) {
+        AWS_LOGF_TRACE(AWS_LS_IO_EVENT_LOOP, "id=%p: Waking up event-loop thread", (void *)event_loop);
+
+        uint64_t counter = 1;
+        /* If the write fails because the buffer is full, we don't actually care because that means there's a pending
+         * read on the pipe/eventfd and thus the event loop will end up checking to see if something has been queued.*/
+        ssize_t do_not_care = write(epoll_loop->write_task_handle.data.fd, (void *)&counter, sizeof(counter));
+        (void)do_not_care;
+    }
+}
+
 static void s_schedule_task_common(struct aws_event_loop *event_loop, struct aws_task *task, uint64_t run_at_nanos) {
     struct epoll_loop *epoll_loop = event_loop->impl_data;
 
@@ -340,7 +431,7 @@ static void s_schedule_task_common(struct aws_event_loop *event_loop, struct aws
         if (run_at_nanos == 0) {
             /* zero denotes "now" task */
             aws_task_scheduler_schedule_now(&epoll_loop->scheduler, task);
-        } else {
+        } else if (!aws_timer_wheel_try_schedule(&epoll_loop->timer_wheel, task, run_at_nanos)) {
             aws_task_scheduler_schedule_future(&epoll_loop->scheduler, task, run_at_nanos);
         }
         return;
@@ -353,29 +444,41 @@ static void s_schedule_task_common(struct aws_event_loop *event_loop, struct aws
         (void *)task,
         (unsigned long long)run_at_nanos);
     task->timestamp = run_at_nanos;
-    aws_mutex_lock(&epoll_loop->task_pre_queue_mutex);
 
-    uint64_t counter = 1;
+    /* lock-free push onto the MPSC stack */
+    void *head = aws_atomic_load_ptr(&epoll_loop->task_pre_queue_head);
+    do {
+        task->node.next = head;
+    } while (!aws_atomic_compare_exchange_ptr(&epoll_loop->task_pre_queue_head, &head, &task->node));
 
-    bool is_first_task = aws_linked_list_empty(&epoll_loop->task_pre_queue);
+    s_signal_cross_thread_wakeup(event_loop, epoll_loop);
+}
 
-    aws_linked_list_push_back(&epoll_loop->task_pre_queue, &task->node);
+static void s_schedule_task_now(struct aws_event_loop *event_loop, struct aws_task *task) {
+    s_schedule_task_common(event_loop, task, 0 /* zero denotes "now" task */);
+}
 
-    /* if the list was not empty, we already have a pending read on the pipe/eventfd, no need to write again. */
-    if (is_first_task) {
-        AWS_LOGF_TRACE(AWS_LS_IO_EVENT_LOOP, "id=%p: Waking up event-loop thread", (void *)event_loop);
+static void s_schedule_task_now_background(struct aws_event_loop *event_loop, struct aws_task *task) {
+    struct epoll_loop *epoll_loop = event_loop->impl_data;
 
-        /* If the write fails because the buffer is full, we don't actually care because that means there's a pending
-         * read on the pipe/eventfd and thus the event loop will end up checking to see if something has been queued.*/
-        ssize_t do_not_care = write(epoll_loop->write_task_handle.data.fd, (void *)&counter, sizeof(counter));
-        (void)do_not_care;
+    if (s_is_on_callers_thread(event_loop)) {
+        AWS_LOGF_TRACE(
+            AWS_LS_IO_EVENT_LOOP, "id=%p: scheduling background task %p in-thread", (void *)event_loop, (void *)task);
+        aws_linked_list_push_back(&epoll_loop->background_tasks, &task->node);
+        return;
     }
 
-    aws_mutex_unlock(&epoll_loop->task_pre_queue_mutex);
-}
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_EVENT_LOOP, "id=%p: Scheduling background task %p cross-thread", (void *)event_loop, (void *)task);
+    task->timestamp = 0;
 
-static void s_schedule_task_now(struct aws_event_loop *event_loop, struct aws_task *task) {
-    s_schedule_task_common(event_loop, task, 0 /* zero denotes "now" task */);
+    /* lock-free push onto the background MPSC stack */
+    void *head = aws_atomic_load_ptr(&epoll_loop->background_pre_queue_head);
+    do {
+        task->node.next = head;
+    } while (!aws_atomic_compare_exchange_ptr(&epoll_loop->background_pre_queue_head, &head, &task->node));
+
+    s_signal_cross_thread_wakeup(event_loop, epoll_loop);
 }
 
 static void s_schedule_task_future(struct aws_event_loop *event_loop, struct aws_task *task, uint64_t run_at_nanos) {
@@ -385,7 +488,11 @@ static void s_schedule_task_future(struct aws_event_loop *event_loop, struct aws
 static void s_cancel_task(struct aws_event_loop *event_loop, struct aws_task *task) {
     AWS_LOGF_TRACE(AWS_LS_IO_EVENT_LOOP, "id=%p: cancelling task %p", (void *)event_loop, (void *)task);
     struct epoll_loop *epoll_loop = event_loop->impl_data;
-    aws_task_scheduler_cancel_task(&epoll_loop->scheduler, task);
+    if (!aws_timer_wheel_try_cancel(&epoll_loop->timer_wheel, task)) {
+        /* background tasks are covered too: they carry timestamp 0 and are linked through the
+         * same aws_task node, so the scheduler's cancel path unlinks them from our band's list */
+        aws_task_scheduler_cancel_task(&epoll_loop->scheduler, task);
+    }
 }
 
 static int s_subscribe_to_io_events(
@@ -412,6 +519,16 @@ static int s_subscribe_to_io_events(
     /*everyone is always registered for edge-triggered, hang up, remote hang up, errors. */
     uint32_t event_mask = EPOLLET | EPOLLHUP | EPOLLRDHUP | EPOLLERR;
 
+#ifdef EPOLLEXCLUSIVE
+    if (events & AWS_IO_EVENT_TYPE_EXCLUSIVE_WAKEUP) {
+        /* the kernel rejects EPOLLEXCLUSIVE combined with anything but IN/OUT/ET/WAKEUP
+         * (HUP and ERR are always reported). Level-triggered on purpose: with several loops
+         * sharing a listen backlog, an edge can be consumed by whichever loop woke last, leaving
+         * pending connections that never re-trigger. */
+        event_mask = EPOLLEXCLUSIVE;
+    }
+#endif
+
     if (events & AWS_IO_EVENT_TYPE_READABLE) {
         event_mask |= EPOLLIN;
     }
@@ -477,7 +594,8 @@ static int s_unsubscribe_from_io_events(struct aws_event_loop *event_loop, struc
         s_unsubscribe_cleanup_task,
         additional_handle_data,
         "epoll_event_loop_unsubscribe_cleanup");
-    s_schedule_task_now(event_loop, &additional_handle_data->cleanup_task);
+    /* teardown bookkeeping; no reason to let it cut in line ahead of I/O continuations */
+    s_schedule_task_now_background(event_loop, &additional_handle_data->cleanup_task);
 
     handle->additional_data = NULL;
     return AWS_OP_SUCCESS;
@@ -518,24 +636,31 @@ static void s_process_task_pre_queue(struct aws_event_loop *event_loop) {
     AWS_LOGF_TRACE(AWS_LS_IO_EVENT_LOOP, "id=%p: processing cross-thread tasks", (void *)event_loop);
     epoll_loop->should_process_task_pre_queue = false;
 
-    struct aws_linked_list task_pre_queue;
-    aws_linked_list_init(&task_pre_queue);
-
     uint64_t count_ignore = 0;
 
-    aws_mutex_lock(&epoll_loop->task_pre_queue_mutex);
-
     /* several tasks could theoretically have been written (though this should never happen), make sure we drain the
      * eventfd/pipe. */
     while (read(epoll_loop->read_task_handle.data.fd, &count_ignore, sizeof(count_ignore)) > -1) {
     }
 
-    aws_linked_list_swap_contents(&epoll_loop->task_pre_queue, &task_pre_queue);
+    /* clear the wakeup flag before detaching the stack: a producer racing with us either lands on the
+     * stack we're about to take, or re-arms the wakeup for the next tick. Either way nothing is lost. */
+    aws_atomic_store_int(&epoll_loop->wakeup_scheduled, 0);
 
-    aws_mutex_unlock(&epoll_loop->task_pre_queue_mutex);
+    struct aws_linked_list_node *detached = aws_atomic_exchange_ptr(&epoll_loop->task_pre_queue_head, NULL);
 
-    while (!aws_linked_list_empty(&task_pre_queue)) {
-        struct aws_linked_list_node *node = aws_linked_list_pop_front(&task_pre_queue);
+    /* producers push LIFO; reverse to recover submission order */
+    struct aws_linked_list_node *reversed = NULL;
+    while (detached) {
+        struct aws_linked_list_node *next = detached->next;
+        detached->next = reversed;
+        reversed = detached;
+        detached = next;
+    }
+
+    while (reversed) {
+        struct aws_linked_list_node *node = reversed;
+        reversed = node->next;
         struct aws_task *task = AWS_CONTAINER_OF(node, struct aws_task, node);
         AWS_LOGF_TRACE(
             AWS_LS_IO_EVENT_LOOP,
@@ -545,10 +670,27 @@ static void s_process_task_pre_queue(struct aws_event_loop *event_loop) {
         /* Timestamp 0 is used to denote "now" tasks */
         if (task->timestamp == 0) {
             aws_task_scheduler_schedule_now(&epoll_loop->scheduler, task);
-        } else {
+        } else if (!aws_timer_wheel_try_schedule(&epoll_loop->timer_wheel, task, task->timestamp)) {
             aws_task_scheduler_schedule_future(&epoll_loop->scheduler, task, task->timestamp);
         }
     }
+
+    /* same drain for the background band */
+    detached = aws_atomic_exchange_ptr(&epoll_loop->background_pre_queue_head, NULL);
+    reversed = NULL;
+    while (detached) {
+        struct aws_linked_list_node *next = detached->next;
+        detached->next = reversed;
+        reversed = detached;
+        detached = next;
+    }
+
+    while (reversed) {
+        struct aws_linked_list_node *node = reversed;
+        reversed = node->next;
+        struct aws_task *task = AWS_CONTAINER_OF(node, struct aws_task, node);
+        aws_linked_list_push_back(&epoll_loop->background_tasks, &task->node);
+    }
 }
 
 /**
@@ -588,6 +730,12 @@ static void aws_event_loop_thread(void *args) {
 
     int timeout = DEFAULT_TIMEOUT;
 
+    /* while busy-polling, epoll_wait is issued with a zero timeout until this deadline passes without work */
+    uint64_t spin_until_ns = 0;
+
+    /* earliest scheduled task time used to size the previous wait, for the task-latency histogram */
+    uint64_t expected_task_run_ns = 0;
+
     struct epoll_event events[MAX_EVENTS];
 
     AWS_LOGF_INFO(
@@ -610,9 +758,27 @@ static void aws_event_loop_thread(void *args) {
      */
     while (epoll_loop->should_continue) {
 
-        AWS_LOGF_TRACE(AWS_LS_IO_EVENT_LOOP, "id=%p: waiting for a maximum of %d ms", (void *)event_loop, timeout);
-        int event_count = aws_event_loop_listen_for_io_events(epoll_loop->epoll_fd, events, timeout);
+        int wait_timeout = timeout;
+        if (spin_until_ns != 0) {
+            uint64_t spin_now_ns = 0;
+            if (!event_loop->clock(&spin_now_ns) && spin_now_ns < spin_until_ns) {
+                wait_timeout = 0;
+            } else {
+                spin_until_ns = 0;
+            }
+        }
+
+        /* leftover background work: poll rather than block, so spare capacity keeps draining
+         * the low band while I/O stays ahead of it */
+        if (!aws_linked_list_empty(&epoll_loop->background_tasks)) {
+            wait_timeout = 0;
+        }
+
+        AWS_LOGF_TRACE(
+            AWS_LS_IO_EVENT_LOOP, "id=%p: waiting for a maximum of %d ms", (void *)event_loop, wait_timeout);
+        int event_count = aws_event_loop_listen_for_io_events(epoll_loop->epoll_fd, events, wait_timeout);
         aws_event_loop_register_tick_start(event_loop);
+        aws_event_loop_register_wait_result(event_loop, event_count > 0 ? (size_t)event_count : 0);
 
         AWS_LOGF_TRACE(
             AWS_LS_IO_EVENT_LOOP, "id=%p: wake up with %d events to process.", (void *)event_loop, event_count);
@@ -662,10 +828,34 @@ static void aws_event_loop_thread(void *args) {
         event_loop->clock(&now_ns); /* if clock fails, now_ns will be 0 and tasks scheduled for a specific time
                                        will not be run. That's ok, we'll handle them next time around. */
         AWS_LOGF_TRACE(AWS_LS_IO_EVENT_LOOP, "id=%p: running scheduled tasks.", (void *)event_loop);
+        aws_event_loop_register_task_queue_depth(
+            event_loop,
+            aws_priority_queue_size(&epoll_loop->scheduler.timed_queue) + epoll_loop->timer_wheel.level0_count +
+                epoll_loop->timer_wheel.level1_count);
+        if (expected_task_run_ns != 0 && now_ns >= expected_task_run_ns) {
+            aws_event_loop_register_task_latency(event_loop, now_ns - expected_task_run_ns);
+            expected_task_run_ns = 0;
+        }
         __itt_task_begin(io_tracing_domain, __itt_null, __itt_null, tracing_event_loop_run_tasks);
+        uint64_t task_pass_start_ns = now_ns;
+        aws_timer_wheel_run_due(&epoll_loop->timer_wheel, now_ns);
         aws_task_scheduler_run_all(&epoll_loop->scheduler, now_ns);
+
+        /* low band: at most a budget's worth of background work per tick, after I/O and the
+         * normal scheduler pass, bounding the latency housekeeping can inject into the data path */
+        for (int i = 0; i < BACKGROUND_TASK_BUDGET_PER_TICK && !aws_linked_list_empty(&epoll_loop->background_tasks);
+             ++i) {
+            struct aws_linked_list_node *bg_node = aws_linked_list_pop_front(&epoll_loop->background_tasks);
+            struct aws_task *bg_task = AWS_CONTAINER_OF(bg_node, struct aws_task, node);
+            bg_task->fn(bg_task, bg_task->arg, AWS_TASK_STATUS_RUN_READY);
+        }
         __itt_task_end(io_tracing_domain);
 
+        /* a productive tick re-arms the spin budget; an idle loop lets it lapse and blocks again */
+        if (epoll_loop->busy_poll_spin_duration_ns > 0 && event_count > 0 && now_ns != 0) {
+            spin_until_ns = now_ns + epoll_loop->busy_poll_spin_duration_ns;
+        }
+
         /* set timeout for next epoll_wait() call.
          * if clock fails, or scheduler has no tasks, use default timeout */
         bool use_default_timeout = false;
@@ -674,8 +864,22 @@ static void aws_event_loop_thread(void *args) {
             use_default_timeout = true;
         }
 
-        uint64_t next_run_time_ns;
-        if (!aws_task_scheduler_has_tasks(&epoll_loop->scheduler, &next_run_time_ns)) {
+        /* wheel tasks are timed individually by the watchdog; this coarse check also covers the
+         * fallback-scheduler pass, whose internal run loop we can't instrument per task */
+        aws_task_watchdog_report_pass(&epoll_loop->task_watchdog, task_pass_start_ns, now_ns);
+
+        uint64_t next_run_time_ns = UINT64_MAX;
+        uint64_t candidate_ns = 0;
+        bool has_pending_timers = false;
+        if (aws_task_scheduler_has_tasks(&epoll_loop->scheduler, &candidate_ns)) {
+            next_run_time_ns = candidate_ns;
+            has_pending_timers = true;
+        }
+        if (aws_timer_wheel_has_tasks(&epoll_loop->timer_wheel, &candidate_ns)) {
+            next_run_time_ns = candidate_ns < next_run_time_ns ? candidate_ns : next_run_time_ns;
+            has_pending_timers = true;
+        }
+        if (!has_pending_timers) {
             use_default_timeout = true;
         }
 
@@ -683,7 +887,9 @@ static void aws_event_loop_thread(void *args) {
             AWS_LOGF_TRACE(
                 AWS_LS_IO_EVENT_LOOP, "id=%p: no more scheduled tasks using default timeout.", (void *)event_loop);
             timeout = DEFAULT_TIMEOUT;
+            expected_task_run_ns = 0;
         } else {
+            expected_task_run_ns = next_run_time_ns;
             /* Translate timestamp (in nanoseconds) to timeout (in milliseconds) */
             uint64_t timeout_ns = (next_run_time_ns > now_ns) ? (next_run_time_ns - now_ns) : 0;
             uint64_t timeout_ms64 = aws_timestamp_convert(timeout_ns, AWS_TIMESTAMP_NANOS, AWS_TIMESTAMP_MILLIS, NULL);
@@ -0,0 +1,1361 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/io/event_loop.h>
+
+#include <aws/cal/cal.h>
+#include <aws/common/atomics.h>
+#include <aws/common/clock.h>
+#include <aws/common/mutex.h>
+#include <aws/common/task_scheduler.h>
+#include <aws/common/thread.h>
+#include <aws/io/private/tracing.h>
+
+#include <aws/io/io.h>
+#include <aws/io/logging.h>
+#include <aws/io/private/event_loop_io_uring.h>
+
+#if defined(__has_include)
+#    if __has_include(<linux/io_uring.h>)
+#        define AWS_HAVE_IO_URING_HEADERS 1
+#    endif
+#endif
+
+#if AWS_HAVE_IO_URING_HEADERS
+#    include <linux/io_uring.h>
+/* IORING_ENTER_EXT_ARG (kernel 5.11) is the oldest feature this backend relies on; if the build system's headers
+ * predate it, compile the backend out entirely and let the caller fall back to epoll. */
+#    if defined(IORING_ENTER_EXT_ARG)
+#        define AWS_USE_IO_URING_IMPL 1
+#    endif
+#endif
+
+struct aws_event_loop *aws_event_loop_new_io_uring_with_options(
+    struct aws_allocator *alloc,
+    const struct aws_event_loop_options *options);
+
+#if !AWS_USE_IO_URING_IMPL
+
+struct aws_event_loop *aws_event_loop_new_io_uring_with_options(
+    struct aws_allocator *alloc,
+    const struct aws_event_loop_options *options) {
+    (void)alloc;
+    (void)options;
+    aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+    return NULL;
+}
+
+bool aws_event_loop_is_io_uring_zero_copy_recv_available(struct aws_event_loop *event_loop) {
+    (void)event_loop;
+    return false;
+}
+
+struct aws_io_uring_zero_copy_recv *aws_event_loop_io_uring_zero_copy_recv_start(
+    struct aws_event_loop *event_loop,
+    struct aws_io_handle *handle,
+    aws_io_uring_on_zero_copy_recv_fn *on_recv,
+    void *user_data) {
+    (void)event_loop;
+    (void)handle;
+    (void)on_recv;
+    (void)user_data;
+    aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+    return NULL;
+}
+
+int aws_event_loop_io_uring_zero_copy_recv_resume(struct aws_io_uring_zero_copy_recv *zc_recv) {
+    (void)zc_recv;
+    return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+}
+
+void aws_event_loop_io_uring_zero_copy_recv_stop(struct aws_io_uring_zero_copy_recv *zc_recv) {
+    (void)zc_recv;
+}
+
+#else /* AWS_USE_IO_URING_IMPL */
+
+#    include <errno.h>
+#    include <limits.h>
+#    include <poll.h>
+#    include <signal.h>
+#    include <string.h>
+#    include <sys/eventfd.h>
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+
+/* Provided-buffer-ring receive (kernel 5.19). If the build headers predate it, the loop still works;
+ * zero-copy recv just reports unavailable and callers use the readiness + read() path. */
+#    if defined(IORING_REGISTER_PBUF_RING) && defined(IOSQE_BUFFER_SELECT)
+#        define AWS_IO_URING_HAVE_PBUF_RING 1
+#    endif
+
+static void s_destroy(struct aws_event_loop *event_loop);
+static int s_run(struct aws_event_loop *event_loop);
+static int s_stop(struct aws_event_loop *event_loop);
+static int s_wait_for_stop_completion(struct aws_event_loop *event_loop);
+static void s_schedule_task_now(struct aws_event_loop *event_loop, struct aws_task *task);
+static void s_schedule_task_future(struct aws_event_loop *event_loop, struct aws_task *task, uint64_t run_at_nanos);
+static void s_cancel_task(struct aws_event_loop *event_loop, struct aws_task *task);
+static int s_subscribe_to_io_events(
+    struct aws_event_loop *event_loop,
+    struct aws_io_handle *handle,
+    int events,
+    aws_event_loop_on_event_fn *on_event,
+    void *user_data);
+static int s_unsubscribe_from_io_events(struct aws_event_loop *event_loop, struct aws_io_handle *handle);
+static void s_free_io_event_resources(void *user_data);
+static bool s_is_on_callers_thread(struct aws_event_loop *event_loop);
+
+static void aws_event_loop_thread(void *args);
+
+static struct aws_event_loop_vtable s_vtable = {
+    .destroy = s_destroy,
+    .run = s_run,
+    .stop = s_stop,
+    .wait_for_stop_completion = s_wait_for_stop_completion,
+    .schedule_task_now = s_schedule_task_now,
+    .schedule_task_future = s_schedule_task_future,
+    .cancel_task = s_cancel_task,
+    .subscribe_to_io_events = s_subscribe_to_io_events,
+    .unsubscribe_from_io_events = s_unsubscribe_from_io_events,
+    .free_io_event_resources = s_free_io_event_resources,
+    .is_on_callers_thread = s_is_on_callers_thread,
+};
+
+enum {
+    /* same wait cap as the epoll loop: 100 seconds */
+    DEFAULT_TIMEOUT_NS = 100ULL * AWS_TIMESTAMP_NANOS,
+    RING_ENTRIES = 256,
+    MAX_COMPLETIONS_PER_TICK = 100,
+    /* provided-buffer ring for zero-copy receive; count must be a power of two */
+    ZC_RECV_BUFFER_COUNT = 256,
+    ZC_RECV_BUFFER_SIZE = 16 * 1024,
+    ZC_RECV_BUF_GROUP = 0,
+};
+
+/* every sqe user_data points at a struct whose first member is one of these, so the completion
+ * reaper can tell polls and zero-copy receives apart. */
+enum io_uring_user_data_type {
+    IO_URING_USER_DATA_POLL,
+    IO_URING_USER_DATA_ZC_RECV,
+};
+
+/* Raw syscall shims; we intentionally do not take a liburing dependency. */
+static int s_sys_io_uring_setup(unsigned entries, struct io_uring_params *params) {
+    return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int s_sys_io_uring_enter(
+    int ring_fd,
+    unsigned to_submit,
+    unsigned min_complete,
+    unsigned flags,
+    const void *arg,
+    size_t arg_size) {
+    return (int)syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, arg, arg_size);
+}
+
+#    if AWS_IO_URING_HAVE_PBUF_RING
+static int s_sys_io_uring_register(int ring_fd, unsigned opcode, void *arg, unsigned nr_args) {
+    return (int)syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args);
+}
+#    endif
+
+/* mmap-ed view of a kernel submission/completion ring pair. */
+struct io_uring_ring {
+    int ring_fd;
+    struct io_uring_params params;
+
+    void *sq_mmap;
+    size_t sq_mmap_size;
+    struct io_uring_sqe *sqes;
+    size_t sqes_mmap_size;
+    unsigned *sq_head;
+    unsigned *sq_tail;
+    unsigned *sq_mask;
+    unsigned *sq_array;
+
+    void *cq_mmap;
+    size_t cq_mmap_size;
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned *cq_mask;
+    struct io_uring_cqe *cqes;
+
+    /* sqes appended since the last io_uring_enter() */
+    unsigned unsubmitted;
+};
+
+/* kernel provided-buffer ring plus the buffer block it hands out slices of. */
+struct io_uring_zc_bufs {
+#    if AWS_IO_URING_HAVE_PBUF_RING
+    struct io_uring_buf_ring *buf_ring;
+    size_t buf_ring_mmap_size;
+    uint8_t *buffer_block;
+    uint16_t tail;
+    bool registered;
+#    else
+    bool registered; /* always false */
+#    endif
+};
+
+struct io_uring_loop {
+    struct aws_task_scheduler scheduler;
+    struct aws_thread thread_created_on;
+    struct aws_thread_options thread_options;
+    aws_thread_id_t thread_joined_to;
+    struct aws_atomic_var running_thread_id;
+    struct io_uring_ring ring;
+    struct aws_io_handle wakeup_handle;
+    struct aws_mutex task_pre_queue_mutex;
+    struct aws_linked_list task_pre_queue;
+    struct aws_task stop_task;
+    struct aws_atomic_var stop_task_ptr;
+    uint64_t wakeup_read_buf;
+    struct aws_allocator *alloc;
+    struct io_uring_zc_bufs zc_bufs;
+    /* zero-copy receives waiting for a ring buffer to come back from the application */
+    struct aws_linked_list zc_starved_list;
+    bool should_process_task_pre_queue;
+    bool should_continue;
+};
+
+struct io_uring_event_data {
+    enum io_uring_user_data_type type;
+    struct aws_allocator *alloc;
+    struct aws_io_handle *handle;
+    aws_event_loop_on_event_fn *on_event;
+    int events;
+    void *user_data;
+    struct aws_task subscribe_task;
+    struct aws_task cleanup_task;
+    struct aws_event_loop *event_loop;
+    bool is_subscribed;
+    bool poll_is_armed; /* a POLL_ADD for this handle is in flight in the kernel */
+};
+
+struct aws_io_uring_zero_copy_recv {
+    enum io_uring_user_data_type type;
+    struct aws_allocator *alloc;
+    struct aws_event_loop *event_loop;
+    struct aws_io_handle *handle;
+    aws_io_uring_on_zero_copy_recv_fn *on_recv;
+    void *user_data;
+    struct aws_task cleanup_task;
+    struct aws_linked_list_node starved_node;
+    bool is_active;
+    bool is_armed;   /* a RECV for this handle is in flight in the kernel */
+    bool is_starved; /* parked on zc_starved_list waiting for a ring buffer */
+};
+
+/* a message whose data aliases a kernel ring buffer; releasing it returns the buffer to the ring.
+ * Same custom-allocator trick that message_pool.c uses to recycle pooled messages. */
+struct io_uring_zc_message {
+    struct aws_io_message message;
+    struct aws_allocator release_allocator;
+    struct io_uring_loop *loop;
+    struct aws_event_loop *event_loop;
+    struct aws_task recycle_task;
+    uint16_t buffer_id;
+};
+
+static int s_ring_init(struct io_uring_ring *ring) {
+    AWS_ZERO_STRUCT(*ring);
+    ring->ring_fd = -1;
+
+    struct io_uring_params params;
+    AWS_ZERO_STRUCT(params);
+
+    int fd = s_sys_io_uring_setup(RING_ENTRIES, &params);
+    if (fd < 0) {
+        return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+    }
+
+    /* We drive waits via the enter() extended-argument timeout rather than timeout sqes. */
+    if (!(params.features & IORING_FEAT_EXT_ARG)) {
+        close(fd);
+        return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+    }
+
+    ring->ring_fd = fd;
+    ring->params = params;
+
+    ring->sq_mmap_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_mmap_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        if (ring->cq_mmap_size > ring->sq_mmap_size) {
+            ring->sq_mmap_size = ring->cq_mmap_size;
+        }
+        ring->cq_mmap_size = ring->sq_mmap_size;
+    }
+
+    ring->sq_mmap =
+        mmap(NULL, ring->sq_mmap_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (ring->sq_mmap == MAP_FAILED) {
+        goto on_error;
+    }
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        ring->cq_mmap = ring->sq_mmap;
+    } else {
+        ring->cq_mmap =
+            mmap(NULL, ring->cq_mmap_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (ring->cq_mmap == MAP_FAILED) {
+            goto on_error;
+        }
+    }
+
+    ring->sqes_mmap_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes =
+        mmap(NULL, ring->sqes_mmap_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) {
+        goto on_error;
+    }
+
+    ring->sq_head = (unsigned *)((uint8_t *)ring->sq_mmap + params.sq_off.head);
+    ring->sq_tail = (unsigned *)((uint8_t *)ring->sq_mmap + params.sq_off.tail);
+    ring->sq_mask = (unsigned *)((uint8_t *)ring->sq_mmap + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned *)((uint8_t *)ring->sq_mmap + params.sq_off.array);
+
+    ring->cq_head = (unsigned *)((uint8_t *)ring->cq_mmap + params.cq_off.head);
+    ring->cq_tail = (unsigned *)((uint8_t *)ring->cq_mmap + params.cq_off.tail);
+    ring->cq_mask = (unsigned *)((uint8_t *)ring->cq_mmap + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)((uint8_t *)ring->cq_mmap + params.cq_off.cqes);
+
+    return AWS_OP_SUCCESS;
+
+on_error:
+    if (ring->sq_mmap && ring->sq_mmap != MAP_FAILED) {
+        if (ring->cq_mmap && ring->cq_mmap != MAP_FAILED && ring->cq_mmap != ring->sq_mmap) {
+            munmap(ring->cq_mmap, ring->cq_mmap_size);
+        }
+        munmap(ring->sq_mmap, ring->sq_mmap_size);
+    }
+    close(fd);
+    ring->ring_fd = -1;
+    return aws_raise_error(AWS_ERROR_SYS_CALL_FAILURE);
+}
+
+static void s_ring_clean_up(struct io_uring_ring *ring) {
+    if (ring->ring_fd < 0) {
+        return;
+    }
+
+    munmap(ring->sqes, ring->sqes_mmap_size);
+    if (ring->cq_mmap != ring->sq_mmap) {
+        munmap(ring->cq_mmap, ring->cq_mmap_size);
+    }
+    munmap(ring->sq_mmap, ring->sq_mmap_size);
+    close(ring->ring_fd);
+    ring->ring_fd = -1;
+}
+
+static int s_ring_flush(struct io_uring_ring *ring) {
+    if (ring->unsubmitted == 0) {
+        return AWS_OP_SUCCESS;
+    }
+
+    int submitted = s_sys_io_uring_enter(ring->ring_fd, ring->unsubmitted, 0, 0, NULL, 0);
+    if (submitted < 0) {
+        return aws_raise_error(AWS_ERROR_SYS_CALL_FAILURE);
+    }
+
+    ring->unsubmitted -= (unsigned)submitted;
+    return AWS_OP_SUCCESS;
+}
+
+/* Grab the next free sqe, flushing the batch to the kernel if the ring is full. Only ever called on the loop thread. */
+static struct io_uring_sqe *s_ring_get_sqe(struct io_uring_ring *ring) {
+    unsigned head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+    unsigned tail = *ring->sq_tail;
+
+    if (tail - head >= ring->params.sq_entries) {
+        if (s_ring_flush(ring)) {
+            return NULL;
+        }
+        head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+        if (tail - head >= ring->params.sq_entries) {
+            return NULL;
+        }
+    }
+
+    unsigned index = tail & *ring->sq_mask;
+    struct io_uring_sqe *sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    ring->sq_array[index] = index;
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    ring->unsubmitted++;
+    return sqe;
+}
+
+static void s_arm_poll(struct io_uring_loop *io_uring_loop, struct io_uring_event_data *event_data) {
+    struct io_uring_sqe *sqe = s_ring_get_sqe(&io_uring_loop->ring);
+    if (!sqe) {
+        /* ring is wedged; the handle will stop receiving events, which surfaces as a hang-up to the subscriber */
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_EVENT_LOOP, "static: failed to obtain an sqe to arm poll on fd %d", event_data->handle->data.fd);
+        return;
+    }
+
+    uint32_t poll_mask = POLLHUP | POLLRDHUP | POLLERR;
+    if (event_data->events & AWS_IO_EVENT_TYPE_READABLE) {
+        poll_mask |= POLLIN;
+    }
+    if (event_data->events & AWS_IO_EVENT_TYPE_WRITABLE) {
+        poll_mask |= POLLOUT;
+    }
+
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = event_data->handle->data.fd;
+    sqe->poll_events = (uint16_t)poll_mask;
+    sqe->user_data = (uint64_t)(uintptr_t)event_data;
+    event_data->poll_is_armed = true;
+}
+
+static void s_schedule_task_common(struct aws_event_loop *event_loop, struct aws_task *task, uint64_t run_at_nanos);
+
+#    if AWS_IO_URING_HAVE_PBUF_RING
+
+static int s_zc_bufs_init(struct io_uring_loop *loop) {
+    struct io_uring_zc_bufs *bufs = &loop->zc_bufs;
+
+    size_t ring_size = ZC_RECV_BUFFER_COUNT * sizeof(struct io_uring_buf);
+    bufs->buf_ring = mmap(NULL, ring_size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+    if (bufs->buf_ring == MAP_FAILED) {
+        bufs->buf_ring = NULL;
+        return aws_raise_error(AWS_ERROR_OOM);
+    }
+    bufs->buf_ring_mmap_size = ring_size;
+
+    struct io_uring_buf_reg reg = {
+        .ring_addr = (uint64_t)(uintptr_t)bufs->buf_ring,
+        .ring_entries = ZC_RECV_BUFFER_COUNT,
+        .bgid = ZC_RECV_BUF_GROUP,
+    };
+
+    if (s_sys_io_uring_register(loop->ring.ring_fd, IORING_REGISTER_PBUF_RING, &reg, 1) < 0) {
+        munmap(bufs->buf_ring, bufs->buf_ring_mmap_size);
+        bufs->buf_ring = NULL;
+        return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+    }
+
+    bufs->buffer_block = aws_mem_acquire(loop->alloc, (size_t)ZC_RECV_BUFFER_COUNT * ZC_RECV_BUFFER_SIZE);
+    if (!bufs->buffer_block) {
+        struct io_uring_buf_reg unreg = {.bgid = ZC_RECV_BUF_GROUP};
+        s_sys_io_uring_register(loop->ring.ring_fd, IORING_UNREGISTER_PBUF_RING, &unreg, 1);
+        munmap(bufs->buf_ring, bufs->buf_ring_mmap_size);
+        bufs->buf_ring = NULL;
+        return AWS_OP_ERR;
+    }
+
+    bufs->tail = 0;
+    for (uint16_t i = 0; i < ZC_RECV_BUFFER_COUNT; ++i) {
+        struct io_uring_buf *buf = &bufs->buf_ring->bufs[i];
+        buf->addr = (uint64_t)(uintptr_t)(bufs->buffer_block + (size_t)i * ZC_RECV_BUFFER_SIZE);
+        buf->len = ZC_RECV_BUFFER_SIZE;
+        buf->bid = i;
+        bufs->tail++;
+    }
+    __atomic_store_n(&bufs->buf_ring->tail, bufs->tail, __ATOMIC_RELEASE);
+
+    bufs->registered = true;
+    return AWS_OP_SUCCESS;
+}
+
+static void s_zc_bufs_clean_up(struct io_uring_loop *loop) {
+    struct io_uring_zc_bufs *bufs = &loop->zc_bufs;
+
+    if (!bufs->registered) {
+        return;
+    }
+
+    struct io_uring_buf_reg unreg = {.bgid = ZC_RECV_BUF_GROUP};
+    s_sys_io_uring_register(loop->ring.ring_fd, IORING_UNREGISTER_PBUF_RING, &unreg, 1);
+    munmap(bufs->buf_ring, bufs->buf_ring_mmap_size);
+    bufs->buf_ring = NULL;
+    aws_mem_release(loop->alloc, bufs->buffer_block);
+    bufs->buffer_block = NULL;
+    bufs->registered = false;
+}
+
+static void s_arm_zc_recv(struct io_uring_loop *loop, struct aws_io_uring_zero_copy_recv *zc_recv);
+
+/* returns a buffer to the kernel ring, and un-parks a starved receive if one is waiting */
+static void s_zc_buf_recycle(struct io_uring_loop *loop, uint16_t buffer_id) {
+    struct io_uring_zc_bufs *bufs = &loop->zc_bufs;
+
+    unsigned mask = ZC_RECV_BUFFER_COUNT - 1;
+    struct io_uring_buf *buf = &bufs->buf_ring->bufs[bufs->tail & mask];
+    buf->addr = (uint64_t)(uintptr_t)(bufs->buffer_block + (size_t)buffer_id * ZC_RECV_BUFFER_SIZE);
+    buf->len = ZC_RECV_BUFFER_SIZE;
+    buf->bid = buffer_id;
+    bufs->tail++;
+    __atomic_store_n(&bufs->buf_ring->tail, bufs->tail, __ATOMIC_RELEASE);
+
+    if (!aws_linked_list_empty(&loop->zc_starved_list)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&loop->zc_starved_list);
+        struct aws_io_uring_zero_copy_recv *zc_recv =
+            AWS_CONTAINER_OF(node, struct aws_io_uring_zero_copy_recv, starved_node);
+        zc_recv->is_starved = false;
+        s_arm_zc_recv(loop, zc_recv);
+    }
+}
+
+static void s_arm_zc_recv(struct io_uring_loop *loop, struct aws_io_uring_zero_copy_recv *zc_recv) {
+    struct io_uring_sqe *sqe = s_ring_get_sqe(&loop->ring);
+    if (!sqe) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_EVENT_LOOP,
+            "static: failed to obtain an sqe to arm zero-copy recv on fd %d",
+            zc_recv->handle->data.fd);
+        return;
+    }
+
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = zc_recv->handle->data.fd;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = ZC_RECV_BUF_GROUP;
+    sqe->user_data = (uint64_t)(uintptr_t)zc_recv;
+    zc_recv->is_armed = true;
+}
+
+static void s_zc_message_destroy(struct io_uring_zc_message *zc_message) {
+    struct io_uring_loop *loop = zc_message->loop;
+    s_zc_buf_recycle(loop, zc_message->buffer_id);
+    aws_mem_release(loop->alloc, zc_message);
+}
+
+static void s_zc_message_recycle_task(struct aws_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    (void)status;
+    /* run even when canceled, so buffers aren't leaked during loop teardown */
+    s_zc_message_destroy(arg);
+}
+
+static void *s_zc_message_mem_acquire(struct aws_allocator *allocator, size_t size) {
+    (void)allocator;
+    (void)size;
+
+    /* no one should ever call this ever. */
+    AWS_ASSERT(0);
+    return NULL;
+}
+
+static void s_zc_message_mem_release(struct aws_allocator *allocator, void *ptr) {
+    struct io_uring_zc_message *zc_message = allocator->impl;
+    (void)ptr;
+
+    /* the buffer ring is single-producer; recycle in place on the loop thread, marshal otherwise */
+    if (s_is_on_callers_thread(zc_message->event_loop)) {
+        s_zc_message_destroy(zc_message);
+    } else {
+        aws_task_init(&zc_message->recycle_task, s_zc_message_recycle_task, zc_message, "io_uring_zc_buffer_recycle");
+        s_schedule_task_common(zc_message->event_loop, &zc_message->recycle_task, 0);
+    }
+}
+
+static void s_on_zc_recv_completion(
+    struct aws_event_loop *event_loop,
+    struct aws_io_uring_zero_copy_recv *zc_recv,
+    struct io_uring_cqe *cqe) {
+
+    struct io_uring_loop *loop = event_loop->impl_data;
+    zc_recv->is_armed = false;
+
+    bool has_buffer = (cqe->flags & IORING_CQE_F_BUFFER) != 0;
+    uint16_t buffer_id = (uint16_t)(cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+
+    if (!zc_recv->is_active) {
+        if (has_buffer) {
+            s_zc_buf_recycle(loop, buffer_id);
+        }
+        return;
+    }
+
+    if (cqe->res > 0 && has_buffer) {
+        struct io_uring_zc_message *zc_message = aws_mem_calloc(loop->alloc, 1, sizeof(struct io_uring_zc_message));
+        if (!zc_message) {
+            s_zc_buf_recycle(loop, buffer_id);
+            zc_recv->on_recv(aws_last_error(), NULL, zc_recv->user_data);
+            return;
+        }
+
+        zc_message->loop = loop;
+        zc_message->event_loop = event_loop;
+        zc_message->buffer_id = buffer_id;
+        zc_message->release_allocator.impl = zc_message;
+        zc_message->release_allocator.mem_acquire = s_zc_message_mem_acquire;
+        zc_message->release_allocator.mem_release = s_zc_message_mem_release;
+        zc_message->message.allocator = &zc_message->release_allocator;
+        zc_message->message.message_type = AWS_IO_MESSAGE_APPLICATION_DATA;
+        zc_message->message.message_data.buffer =
+            loop->zc_bufs.buffer_block + (size_t)buffer_id * ZC_RECV_BUFFER_SIZE;
+        zc_message->message.message_data.len = (size_t)cqe->res;
+        zc_message->message.message_data.capacity = ZC_RECV_BUFFER_SIZE;
+
+        AWS_LOGF_TRACE(
+            AWS_LS_IO_EVENT_LOOP,
+            "id=%p: zero-copy recv of %d bytes on fd %d (buffer %d)",
+            (void *)event_loop,
+            (int)cqe->res,
+            zc_recv->handle->data.fd,
+            (int)buffer_id);
+
+        if (zc_recv->on_recv(AWS_ERROR_SUCCESS, &zc_message->message, zc_recv->user_data)) {
+            s_arm_zc_recv(loop, zc_recv);
+        }
+        return;
+    }
+
+    if (cqe->res == 0) {
+        zc_recv->on_recv(AWS_IO_SOCKET_CLOSED, NULL, zc_recv->user_data);
+        return;
+    }
+
+    if (cqe->res == -ENOBUFS) {
+        /* the provided-buffer ring is empty; park until the application releases a message */
+        AWS_LOGF_TRACE(
+            AWS_LS_IO_EVENT_LOOP,
+            "id=%p: zero-copy recv on fd %d starved for buffers, parking",
+            (void *)event_loop,
+            zc_recv->handle->data.fd);
+        if (!zc_recv->is_starved) {
+            zc_recv->is_starved = true;
+            aws_linked_list_push_back(&loop->zc_starved_list, &zc_recv->starved_node);
+        }
+        return;
+    }
+
+    if (cqe->res == -EINTR || cqe->res == -EAGAIN) {
+        s_arm_zc_recv(loop, zc_recv);
+        return;
+    }
+
+    if (cqe->res == -ECANCELED) {
+        return;
+    }
+
+    int error_code =
+        (cqe->res == -ECONNRESET || cqe->res == -EPIPE) ? AWS_IO_SOCKET_CLOSED : AWS_ERROR_SYS_CALL_FAILURE;
+    zc_recv->on_recv(error_code, NULL, zc_recv->user_data);
+}
+
+#    endif /* AWS_IO_URING_HAVE_PBUF_RING */
+
+bool aws_event_loop_is_io_uring_zero_copy_recv_available(struct aws_event_loop *event_loop) {
+    if (event_loop->vtable != &s_vtable) {
+        return false;
+    }
+    struct io_uring_loop *loop = event_loop->impl_data;
+    return loop->zc_bufs.registered;
+}
+
+struct aws_io_uring_zero_copy_recv *aws_event_loop_io_uring_zero_copy_recv_start(
+    struct aws_event_loop *event_loop,
+    struct aws_io_handle *handle,
+    aws_io_uring_on_zero_copy_recv_fn *on_recv,
+    void *user_data) {
+#    if AWS_IO_URING_HAVE_PBUF_RING
+    AWS_ASSERT(s_is_on_callers_thread(event_loop));
+
+    if (!aws_event_loop_is_io_uring_zero_copy_recv_available(event_loop)) {
+        aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+        return NULL;
+    }
+
+    struct io_uring_loop *loop = event_loop->impl_data;
+
+    struct aws_io_uring_zero_copy_recv *zc_recv =
+        aws_mem_calloc(event_loop->alloc, 1, sizeof(struct aws_io_uring_zero_copy_recv));
+    if (!zc_recv) {
+        return NULL;
+    }
+
+    AWS_LOGF_DEBUG(
+        AWS_LS_IO_EVENT_LOOP, "id=%p: starting zero-copy recv on fd %d", (void *)event_loop, handle->data.fd);
+
+    zc_recv->type = IO_URING_USER_DATA_ZC_RECV;
+    zc_recv->alloc = event_loop->alloc;
+    zc_recv->event_loop = event_loop;
+    zc_recv->handle = handle;
+    zc_recv->on_recv = on_recv;
+    zc_recv->user_data = user_data;
+    zc_recv->is_active = true;
+
+    s_arm_zc_recv(loop, zc_recv);
+    return zc_recv;
+#    else
+    (void)event_loop;
+    (void)handle;
+    (void)on_recv;
+    (void)user_data;
+    aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+    return NULL;
+#    endif
+}
+
+int aws_event_loop_io_uring_zero_copy_recv_resume(struct aws_io_uring_zero_copy_recv *zc_recv) {
+#    if AWS_IO_URING_HAVE_PBUF_RING
+    AWS_ASSERT(s_is_on_callers_thread(zc_recv->event_loop));
+
+    if (!zc_recv->is_active) {
+        return aws_raise_error(AWS_ERROR_INVALID_STATE);
+    }
+
+    if (!zc_recv->is_armed && !zc_recv->is_starved) {
+        struct io_uring_loop *loop = zc_recv->event_loop->impl_data;
+        s_arm_zc_recv(loop, zc_recv);
+    }
+
+    return AWS_OP_SUCCESS;
+#    else
+    (void)zc_recv;
+    return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+#    endif
+}
+
+#    if AWS_IO_URING_HAVE_PBUF_RING
+static void s_zc_recv_cleanup_task(struct aws_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    (void)status;
+    struct aws_io_uring_zero_copy_recv *zc_recv = arg;
+    aws_mem_release(zc_recv->alloc, zc_recv);
+}
+#    endif
+
+void aws_event_loop_io_uring_zero_copy_recv_stop(struct aws_io_uring_zero_copy_recv *zc_recv) {
+#    if AWS_IO_URING_HAVE_PBUF_RING
+    AWS_ASSERT(s_is_on_callers_thread(zc_recv->event_loop));
+
+    struct io_uring_loop *loop = zc_recv->event_loop->impl_data;
+
+    AWS_LOGF_DEBUG(
+        AWS_LS_IO_EVENT_LOOP,
+        "id=%p: stopping zero-copy recv on fd %d",
+        (void *)zc_recv->event_loop,
+        zc_recv->handle->data.fd);
+
+    zc_recv->is_active = false;
+
+    if (zc_recv->is_starved) {
+        aws_linked_list_remove(&zc_recv->starved_node);
+        zc_recv->is_starved = false;
+    }
+
+    if (zc_recv->is_armed) {
+        struct io_uring_sqe *sqe = s_ring_get_sqe(&loop->ring);
+        if (sqe) {
+            sqe->opcode = IORING_OP_ASYNC_CANCEL;
+            sqe->addr = (uint64_t)(uintptr_t)zc_recv;
+            sqe->user_data = 0;
+        }
+    }
+
+    /* a completion referencing this struct may still be in the cq ring; free it a tick later */
+    aws_task_init(&zc_recv->cleanup_task, s_zc_recv_cleanup_task, zc_recv, "io_uring_zc_recv_cleanup");
+    s_schedule_task_common(zc_recv->event_loop, &zc_recv->cleanup_task, 0);
+#    else
+    (void)zc_recv;
+#    endif
+}
+
+int aws_open_nonblocking_posix_pipe(int pipe_fds[2]);
+
+struct aws_event_loop *aws_event_loop_new_io_uring_with_options(
+    struct aws_allocator *alloc,
+    const struct aws_event_loop_options *options) {
+    AWS_PRECONDITION(options);
+    AWS_PRECONDITION(options->clock);
+
+    struct aws_event_loop *loop = aws_mem_calloc(alloc, 1, sizeof(struct aws_event_loop));
+    if (!loop) {
+        return NULL;
+    }
+
+    AWS_LOGF_INFO(AWS_LS_IO_EVENT_LOOP, "id=%p: Initializing io_uring event loop", (void *)loop);
+    if (aws_event_loop_init_base(loop, alloc, options->clock)) {
+        goto clean_up_loop;
+    }
+
+    struct io_uring_loop *io_uring_loop = aws_mem_calloc(alloc, 1, sizeof(struct io_uring_loop));
+    if (!io_uring_loop) {
+        goto cleanup_base_loop;
+    }
+
+    if (options->thread_options) {
+        io_uring_loop->thread_options = *options->thread_options;
+    } else {
+        io_uring_loop->thread_options = *aws_default_thread_options();
+    }
+
+    aws_atomic_init_ptr(&io_uring_loop->running_thread_id, NULL);
+
+    loop->tick_budget_ns =
+        aws_timestamp_convert(options->tick_budget_us, AWS_TIMESTAMP_MICROS, AWS_TIMESTAMP_NANOS, NULL);
+    loop->hugepage_message_pool = options->hugepage_message_pool;
+
+    io_uring_loop->alloc = alloc;
+    aws_linked_list_init(&io_uring_loop->task_pre_queue);
+    aws_linked_list_init(&io_uring_loop->zc_starved_list);
+    io_uring_loop->task_pre_queue_mutex = (struct aws_mutex)AWS_MUTEX_INIT;
+    aws_atomic_init_ptr(&io_uring_loop->stop_task_ptr, NULL);
+
+    if (s_ring_init(&io_uring_loop->ring)) {
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_EVENT_LOOP, "id=%p: io_uring unavailable on this kernel: %d", (void *)loop, aws_last_error());
+        goto clean_up_io_uring_loop;
+    }
+
+#    if AWS_IO_URING_HAVE_PBUF_RING
+    /* best effort: without provided-buffer-ring support the loop still runs, reads just take the copy path */
+    if (s_zc_bufs_init(io_uring_loop)) {
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_EVENT_LOOP,
+            "id=%p: provided-buffer rings unavailable, zero-copy recv disabled: %d",
+            (void *)loop,
+            aws_last_error());
+    }
+#    endif
+
+    if (aws_thread_init(&io_uring_loop->thread_created_on, alloc)) {
+        goto clean_up_ring;
+    }
+
+    int fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (fd < 0) {
+        AWS_LOGF_FATAL(AWS_LS_IO_EVENT_LOOP, "id=%p: Failed to open eventfd handle.", (void *)loop);
+        aws_raise_error(AWS_ERROR_SYS_CALL_FAILURE);
+        goto clean_up_thread;
+    }
+
+    AWS_LOGF_TRACE(AWS_LS_IO_EVENT_LOOP, "id=%p: eventfd descriptor %d.", (void *)loop, fd);
+    io_uring_loop->wakeup_handle = (struct aws_io_handle){.data.fd = fd, .additional_data = NULL};
+
+    if (aws_task_scheduler_init(&io_uring_loop->scheduler, alloc)) {
+        goto clean_up_eventfd;
+    }
+
+    io_uring_loop->should_continue = false;
+
+    loop->impl_data = io_uring_loop;
+    loop->vtable = &s_vtable;
+
+    return loop;
+
+clean_up_eventfd:
+    close(io_uring_loop->wakeup_handle.data.fd);
+
+clean_up_thread:
+    aws_thread_clean_up(&io_uring_loop->thread_created_on);
+
+clean_up_ring:
+#    if AWS_IO_URING_HAVE_PBUF_RING
+    s_zc_bufs_clean_up(io_uring_loop);
+#    endif
+    s_ring_clean_up(&io_uring_loop->ring);
+
+clean_up_io_uring_loop:
+    aws_mem_release(alloc, io_uring_loop);
+
+cleanup_base_loop:
+    aws_event_loop_clean_up_base(loop);
+
+clean_up_loop:
+    aws_mem_release(alloc, loop);
+
+    return NULL;
+}
+
+static void s_destroy(struct aws_event_loop *event_loop) {
+    AWS_LOGF_INFO(AWS_LS_IO_EVENT_LOOP, "id=%p: Destroying event_loop", (void *)event_loop);
+
+    struct io_uring_loop *io_uring_loop = event_loop->impl_data;
+
+    aws_event_loop_stop(event_loop);
+    s_wait_for_stop_completion(event_loop);
+
+    /* setting this so that canceled tasks don't blow up when asking if they're on the event-loop thread. */
+    io_uring_loop->thread_joined_to = aws_thread_current_thread_id();
+    aws_atomic_store_ptr(&io_uring_loop->running_thread_id, &io_uring_loop->thread_joined_to);
+    aws_task_scheduler_clean_up(&io_uring_loop->scheduler);
+
+    while (!aws_linked_list_empty(&io_uring_loop->task_pre_queue)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&io_uring_loop->task_pre_queue);
+        struct aws_task *task = AWS_CONTAINER_OF(node, struct aws_task, node);
+        task->fn(task, task->arg, AWS_TASK_STATUS_CANCELED);
+    }
+
+    aws_thread_clean_up(&io_uring_loop->thread_created_on);
+    close(io_uring_loop->wakeup_handle.data.fd);
+#    if AWS_IO_URING_HAVE_PBUF_RING
+    s_zc_bufs_clean_up(io_uring_loop);
+#    endif
+    s_ring_clean_up(&io_uring_loop->ring);
+    aws_mem_release(event_loop->alloc, io_uring_loop);
+    aws_event_loop_clean_up_base(event_loop);
+    aws_mem_release(event_loop->alloc, event_loop);
+}
+
+static int s_run(struct aws_event_loop *event_loop) {
+    struct io_uring_loop *io_uring_loop = event_loop->impl_data;
+
+    AWS_LOGF_INFO(AWS_LS_IO_EVENT_LOOP, "id=%p: Starting event-loop thread.", (void *)event_loop);
+
+    io_uring_loop->should_continue = true;
+    aws_thread_increment_unjoined_count();
+    if (aws_thread_launch(
+            &io_uring_loop->thread_created_on, &aws_event_loop_thread, event_loop, &io_uring_loop->thread_options)) {
+
+        aws_thread_decrement_unjoined_count();
+        AWS_LOGF_FATAL(AWS_LS_IO_EVENT_LOOP, "id=%p: thread creation failed.", (void *)event_loop);
+        io_uring_loop->should_continue = false;
+        return AWS_OP_ERR;
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static void s_stop_task(struct aws_task *task, void *args, enum aws_task_status status) {
+    (void)task;
+    struct aws_event_loop *event_loop = args;
+    struct io_uring_loop *io_uring_loop = event_loop->impl_data;
+
+    /* now okay to reschedule stop tasks. */
+    aws_atomic_store_ptr(&io_uring_loop->stop_task_ptr, NULL);
+    if (status == AWS_TASK_STATUS_RUN_READY) {
+        io_uring_loop->should_continue = false;
+    }
+}
+
+static int s_stop(struct aws_event_loop *event_loop) {
+    struct io_uring_loop *io_uring_loop = event_loop->impl_data;
+
+    void *expected_ptr = NULL;
+    bool update_succeeded =
+        aws_atomic_compare_exchange_ptr(&io_uring_loop->stop_task_ptr, &expected_ptr, &io_uring_loop->stop_task);
+    if (!update_succeeded) {
+        /* the stop task is already scheduled. */
+        return AWS_OP_SUCCESS;
+    }
+    AWS_LOGF_INFO(AWS_LS_IO_EVENT_LOOP, "id=%p: Stopping event-loop thread.", (void *)event_loop);
+    aws_task_init(&io_uring_loop->stop_task, s_stop_task, event_loop, "io_uring_event_loop_stop");
+    s_schedule_task_now(event_loop, &io_uring_loop->stop_task);
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_wait_for_stop_completion(struct aws_event_loop *event_loop) {
+    struct io_uring_loop *io_uring_loop = event_loop->impl_data;
+    int result = aws_thread_join(&io_uring_loop->thread_created_on);
+    aws_thread_decrement_unjoined_count();
+    return result;
+}
+
+static void s_schedule_task_common(struct aws_event_loop *event_loop, struct aws_task *task, uint64_t run_at_nanos) {
+    struct io_uring_loop *io_uring_loop = event_loop->impl_data;
+
+    /* if event loop and the caller are the same thread, just schedule and be done with it. */
+    if (s_is_on_callers_thread(event_loop)) {
+        AWS_LOGF_TRACE(
+            AWS_LS_IO_EVENT_LOOP,
+            "id=%p: scheduling task %p in-thread for timestamp %llu",
+            (void *)event_loop,
+            (void *)task,
+            (unsigned long long)run_at_nanos);
+        if (run_at_nanos == 0) {
+            aws_task_scheduler_schedule_now(&io_uring_loop->scheduler, task);
+        } else {
+            aws_task_scheduler_schedule_future(&io_uring_loop->scheduler, task, run_at_nanos);
+        }
+        return;
+    }
+
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_EVENT_LOOP,
+        "id=%p: Scheduling task %p cross-thread for timestamp %llu",
+        (void *)event_loop,
+        (void *)task,
+        (unsigned long long)run_at_nanos);
+    task->timestamp = run_at_nanos;
+    aws_mutex_lock(&io_uring_loop->task_pre_queue_mutex);
+
+    uint64_t counter = 1;
+
+    bool is_first_task = aws_linked_list_empty(&io_uring_loop->task_pre_queue);
+
+    aws_linked_list_push_back(&io_uring_loop->task_pre_queue, &task->node);
+
+    /* if the list was not empty, we already have a pending read on the eventfd, no need to write again. */
+    if (is_first_task) {
+        AWS_LOGF_TRACE(AWS_LS_IO_EVENT_LOOP, "id=%p: Waking up event-loop thread", (void *)event_loop);
+
+        ssize_t do_not_care = write(io_uring_loop->wakeup_handle.data.fd, (void *)&counter, sizeof(counter));
+        (void)do_not_care;
+    }
+
+    aws_mutex_unlock(&io_uring_loop->task_pre_queue_mutex);
+}
+
+static void s_schedule_task_now(struct aws_event_loop *event_loop, struct aws_task *task) {
+    s_schedule_task_common(event_loop, task, 0 /* zero denotes "now" task */);
+}
+
+static void s_schedule_task_future(struct aws_event_loop *event_loop, struct aws_task *task, uint64_t run_at_nanos) {
+    s_schedule_task_common(event_loop, task, run_at_nanos);
+}
+
+static void s_cancel_task(struct aws_event_loop *event_loop, struct aws_task *task) {
+    AWS_LOGF_TRACE(AWS_LS_IO_EVENT_LOOP, "id=%p: cancelling task %p", (void *)event_loop, (void *)task);
+    struct io_uring_loop *io_uring_loop = event_loop->impl_data;
+    aws_task_scheduler_cancel_task(&io_uring_loop->scheduler, task);
+}
+
+static void s_subscribe_on_loop_thread(struct aws_event_loop *event_loop, struct io_uring_event_data *event_data) {
+    struct io_uring_loop *io_uring_loop = event_loop->impl_data;
+    s_arm_poll(io_uring_loop, event_data);
+}
+
+static void s_subscribe_task(struct aws_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    struct io_uring_event_data *event_data = arg;
+
+    if (status == AWS_TASK_STATUS_RUN_READY && event_data->is_subscribed) {
+        s_subscribe_on_loop_thread(event_data->event_loop, event_data);
+    }
+}
+
+static int s_subscribe_to_io_events(
+    struct aws_event_loop *event_loop,
+    struct aws_io_handle *handle,
+    int events,
+    aws_event_loop_on_event_fn *on_event,
+    void *user_data) {
+
+    AWS_LOGF_TRACE(AWS_LS_IO_EVENT_LOOP, "id=%p: subscribing to events on fd %d", (void *)event_loop, handle->data.fd);
+    struct io_uring_event_data *event_data =
+        aws_mem_calloc(event_loop->alloc, 1, sizeof(struct io_uring_event_data));
+    handle->additional_data = event_data;
+    if (!event_data) {
+        return AWS_OP_ERR;
+    }
+
+    event_data->type = IO_URING_USER_DATA_POLL;
+    event_data->alloc = event_loop->alloc;
+    event_data->user_data = user_data;
+    event_data->handle = handle;
+    event_data->on_event = on_event;
+    event_data->events = events;
+    event_data->event_loop = event_loop;
+    event_data->is_subscribed = true;
+
+    /* The submission ring is only touched from the loop thread; marshal cross-thread subscriptions over as a task. */
+    if (s_is_on_callers_thread(event_loop)) {
+        s_subscribe_on_loop_thread(event_loop, event_data);
+    } else {
+        aws_task_init(&event_data->subscribe_task, s_subscribe_task, event_data, "io_uring_event_loop_subscribe");
+        s_schedule_task_now(event_loop, &event_data->subscribe_task);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static void s_free_io_event_resources(void *user_data) {
+    struct io_uring_event_data *event_data = user_data;
+    aws_mem_release(event_data->alloc, (void *)event_data);
+}
+
+static void s_unsubscribe_cleanup_task(struct aws_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    (void)status;
+    struct io_uring_event_data *event_data = (struct io_uring_event_data *)arg;
+    s_free_io_event_resources(event_data);
+}
+
+static int s_unsubscribe_from_io_events(struct aws_event_loop *event_loop, struct aws_io_handle *handle) {
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_EVENT_LOOP, "id=%p: un-subscribing from events on fd %d", (void *)event_loop, handle->data.fd);
+    struct io_uring_loop *io_uring_loop = event_loop->impl_data;
+
+    AWS_ASSERT(handle->additional_data);
+    struct io_uring_event_data *event_data = handle->additional_data;
+
+    event_data->is_subscribed = false;
+
+    if (event_data->poll_is_armed) {
+        struct io_uring_sqe *sqe = s_ring_get_sqe(&io_uring_loop->ring);
+        if (sqe) {
+            sqe->opcode = IORING_OP_POLL_REMOVE;
+            sqe->addr = (uint64_t)(uintptr_t)event_data;
+            /* completions for the remove itself carry no event_data we care about */
+            sqe->user_data = 0;
+        }
+        event_data->poll_is_armed = false;
+    }
+
+    /* We can't clean up yet; a completion referencing this struct may still be sitting in the cq ring.
+     * Mark it as unsubscribed and schedule a cleanup task, same as the epoll loop does. */
+    aws_task_init(
+        &event_data->cleanup_task, s_unsubscribe_cleanup_task, event_data, "io_uring_event_loop_unsubscribe_cleanup");
+    s_schedule_task_now(event_loop, &event_data->cleanup_task);
+
+    handle->additional_data = NULL;
+    return AWS_OP_SUCCESS;
+}
+
+static bool s_is_on_callers_thread(struct aws_event_loop *event_loop) {
+    struct io_uring_loop *io_uring_loop = event_loop->impl_data;
+
+    aws_thread_id_t *thread_id = aws_atomic_load_ptr(&io_uring_loop->running_thread_id);
+    return thread_id && aws_thread_thread_id_equal(*thread_id, aws_thread_current_thread_id());
+}
+
+static void s_on_tasks_to_schedule(
+    struct aws_event_loop *event_loop,
+    struct aws_io_handle *handle,
+    int events,
+    void *user_data) {
+
+    (void)handle;
+    (void)user_data;
+
+    AWS_LOGF_TRACE(AWS_LS_IO_EVENT_LOOP, "id=%p: notified of cross-thread tasks to schedule", (void *)event_loop);
+    struct io_uring_loop *io_uring_loop = event_loop->impl_data;
+    if (events & AWS_IO_EVENT_TYPE_READABLE) {
+        io_uring_loop->should_process_task_pre_queue = true;
+    }
+}
+
+static void s_process_task_pre_queue(struct aws_event_loop *event_loop) {
+    struct io_uring_loop *io_uring_loop = event_loop->impl_data;
+
+    if (!io_uring_loop->should_process_task_pre_queue) {
+        return;
+    }
+
+    AWS_LOGF_TRACE(AWS_LS_IO_EVENT_LOOP, "id=%p: processing cross-thread tasks", (void *)event_loop);
+    io_uring_loop->should_process_task_pre_queue = false;
+
+    struct aws_linked_list task_pre_queue;
+    aws_linked_list_init(&task_pre_queue);
+
+    uint64_t count_ignore = 0;
+
+    aws_mutex_lock(&io_uring_loop->task_pre_queue_mutex);
+
+    while (read(io_uring_loop->wakeup_handle.data.fd, &count_ignore, sizeof(count_ignore)) > -1) {
+    }
+
+    aws_linked_list_swap_contents(&io_uring_loop->task_pre_queue, &task_pre_queue);
+
+    aws_mutex_unlock(&io_uring_loop->task_pre_queue_mutex);
+
+    while (!aws_linked_list_empty(&task_pre_queue)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&task_pre_queue);
+        struct aws_task *task = AWS_CONTAINER_OF(node, struct aws_task, node);
+        AWS_LOGF_TRACE(
+            AWS_LS_IO_EVENT_LOOP,
+            "id=%p: task %p pulled to event-loop, scheduling now.",
+            (void *)event_loop,
+            (void *)task);
+        /* Timestamp 0 is used to denote "now" tasks */
+        if (task->timestamp == 0) {
+            aws_task_scheduler_schedule_now(&io_uring_loop->scheduler, task);
+        } else {
+            aws_task_scheduler_schedule_future(&io_uring_loop->scheduler, task, task->timestamp);
+        }
+    }
+}
+
+/**
+ * Submits any batched sqes and waits for at least one completion, capped at timeout_ns.
+ *
+ * Like the epoll loop's aws_event_loop_listen_for_io_events(), this is broken out so the
+ * "idle, waiting for work" state shows up clearly in stack traces.
+ */
+AWS_NO_INLINE
+static int aws_event_loop_listen_for_io_events(struct io_uring_ring *ring, uint64_t timeout_ns) {
+    struct __kernel_timespec ts = {
+        .tv_sec = (int64_t)(timeout_ns / AWS_TIMESTAMP_NANOS),
+        .tv_nsec = (int64_t)(timeout_ns % AWS_TIMESTAMP_NANOS),
+    };
+
+    struct io_uring_getevents_arg arg = {
+        .sigmask = 0,
+        .sigmask_sz = _NSIG / 8,
+        .ts = (uint64_t)(uintptr_t)&ts,
+    };
+
+    unsigned to_submit = ring->unsubmitted;
+    int result = s_sys_io_uring_enter(
+        ring->ring_fd, to_submit, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+    if (result >= 0) {
+        ring->unsubmitted -= (unsigned)result;
+    }
+    return result;
+}
+
+static void s_aws_io_uring_cleanup_aws_lc_thread_local_state(void *user_data) {
+    (void)user_data;
+
+    aws_cal_thread_clean_up();
+}
+
+static void aws_event_loop_thread(void *args) {
+    struct aws_event_loop *event_loop = args;
+    AWS_LOGF_INFO(AWS_LS_IO_EVENT_LOOP, "id=%p: main loop started", (void *)event_loop);
+    struct io_uring_loop *io_uring_loop = event_loop->impl_data;
+
+    /* set thread id to the thread of the event loop */
+    aws_atomic_store_ptr(&io_uring_loop->running_thread_id, &io_uring_loop->thread_created_on.thread_id);
+
+    int err = s_subscribe_to_io_events(
+        event_loop, &io_uring_loop->wakeup_handle, AWS_IO_EVENT_TYPE_READABLE, s_on_tasks_to_schedule, NULL);
+    if (err) {
+        return;
+    }
+
+    aws_thread_current_at_exit(s_aws_io_uring_cleanup_aws_lc_thread_local_state, NULL);
+
+    uint64_t timeout_ns = DEFAULT_TIMEOUT_NS;
+
+    while (io_uring_loop->should_continue) {
+
+        AWS_LOGF_TRACE(
+            AWS_LS_IO_EVENT_LOOP,
+            "id=%p: waiting for a maximum of %llu ns",
+            (void *)event_loop,
+            (unsigned long long)timeout_ns);
+        int enter_result = aws_event_loop_listen_for_io_events(&io_uring_loop->ring, timeout_ns);
+        (void)enter_result;
+        aws_event_loop_register_tick_start(event_loop);
+
+        __itt_task_begin(io_tracing_domain, __itt_null, __itt_null, tracing_event_loop_events);
+
+        /* reap completions; poll completions are re-armed as a batch and submitted on the next enter(). */
+        unsigned head = *io_uring_loop->ring.cq_head;
+        unsigned tail = __atomic_load_n(io_uring_loop->ring.cq_tail, __ATOMIC_ACQUIRE);
+        unsigned mask = *io_uring_loop->ring.cq_mask;
+        int completion_count = 0;
+
+        for (; head != tail && completion_count < MAX_COMPLETIONS_PER_TICK; ++head, ++completion_count) {
+            struct io_uring_cqe *cqe = &io_uring_loop->ring.cqes[head & mask];
+
+            void *cqe_user_data = (void *)(uintptr_t)cqe->user_data;
+            if (!cqe_user_data) {
+                /* completion of a poll-remove, cancel, or similar internal op */
+                continue;
+            }
+
+            if (*(enum io_uring_user_data_type *)cqe_user_data == IO_URING_USER_DATA_ZC_RECV) {
+#    if AWS_IO_URING_HAVE_PBUF_RING
+                s_on_zc_recv_completion(event_loop, cqe_user_data, cqe);
+#    endif
+                continue;
+            }
+
+            struct io_uring_event_data *event_data = cqe_user_data;
+
+            event_data->poll_is_armed = false;
+
+            if (!event_data->is_subscribed) {
+                continue;
+            }
+
+            int event_mask = 0;
+            if (cqe->res >= 0) {
+                if (cqe->res & POLLIN) {
+                    event_mask |= AWS_IO_EVENT_TYPE_READABLE;
+                }
+                if (cqe->res & POLLOUT) {
+                    event_mask |= AWS_IO_EVENT_TYPE_WRITABLE;
+                }
+                if (cqe->res & POLLRDHUP) {
+                    event_mask |= AWS_IO_EVENT_TYPE_REMOTE_HANG_UP;
+                }
+                if (cqe->res & POLLHUP) {
+                    event_mask |= AWS_IO_EVENT_TYPE_CLOSED;
+                }
+                if (cqe->res & POLLERR) {
+                    event_mask |= AWS_IO_EVENT_TYPE_ERROR;
+                }
+            } else if (cqe->res != -ECANCELED) {
+                event_mask |= AWS_IO_EVENT_TYPE_ERROR;
+            }
+
+            if (event_mask != 0) {
+                AWS_LOGF_TRACE(
+                    AWS_LS_IO_EVENT_LOOP,
+                    "id=%p: activity on fd %d, invoking handler.",
+                    (void *)event_loop,
+                    event_data->handle->data.fd);
+                __itt_task_begin(io_tracing_domain, __itt_null, __itt_null, tracing_event_loop_event);
+                event_data->on_event(event_loop, event_data->handle, event_mask, event_data->user_data);
+                __itt_task_end(io_tracing_domain);
+            }
+
+            /* poll ops are one-shot; re-arm if the handler didn't unsubscribe */
+            if (event_data->is_subscribed && !event_data->poll_is_armed) {
+                s_arm_poll(io_uring_loop, event_data);
+            }
+        }
+
+        __atomic_store_n(io_uring_loop->ring.cq_head, head, __ATOMIC_RELEASE);
+        __itt_task_end(io_tracing_domain);
+
+        aws_event_loop_register_wait_result(event_loop, (size_t)completion_count);
+
+        /* run scheduled tasks */
+        s_process_task_pre_queue(event_loop);
+
+        uint64_t now_ns = 0;
+        event_loop->clock(&now_ns); /* if clock fails, now_ns will be 0 and tasks scheduled for a specific time
+                                       will not be run. That's ok, we'll handle them next time around. */
+        AWS_LOGF_TRACE(AWS_LS_IO_EVENT_LOOP, "id=%p: running scheduled tasks.", (void *)event_loop);
+        __itt_task_begin(io_tracing_domain, __itt_null, __itt_null, tracing_event_loop_run_tasks);
+        aws_task_scheduler_run_all(&io_uring_loop->scheduler, now_ns);
+        __itt_task_end(io_tracing_domain);
+
+        /* set timeout for next wait.
+         * if clock fails, or scheduler has no tasks, use default timeout */
+        bool use_default_timeout = false;
+
+        if (event_loop->clock(&now_ns)) {
+            use_default_timeout = true;
+        }
+
+        uint64_t next_run_time_ns;
+        if (!aws_task_scheduler_has_tasks(&io_uring_loop->scheduler, &next_run_time_ns)) {
+            use_default_timeout = true;
+        }
+
+        if (use_default_timeout) {
+            AWS_LOGF_TRACE(
+                AWS_LS_IO_EVENT_LOOP, "id=%p: no more scheduled tasks using default timeout.", (void *)event_loop);
+            timeout_ns = DEFAULT_TIMEOUT_NS;
+        } else {
+            timeout_ns = (next_run_time_ns > now_ns) ? (next_run_time_ns - now_ns) : 0;
+            AWS_LOGF_TRACE(
+                AWS_LS_IO_EVENT_LOOP,
+                "id=%p: detected more scheduled tasks with the next occurring at "
+                "%llu, using timeout of %llu ns.",
+                (void *)event_loop,
+                (unsigned long long)next_run_time_ns,
+                (unsigned long long)timeout_ns);
+        }
+
+        aws_event_loop_register_tick_end(event_loop);
+    }
+
+    AWS_LOGF_DEBUG(AWS_LS_IO_EVENT_LOOP, "id=%p: exiting main loop", (void *)event_loop);
+    s_unsubscribe_from_io_events(event_loop, &io_uring_loop->wakeup_handle);
+    /* make sure the poll-remove for the wakeup eventfd reaches the kernel before the thread exits */
+    s_ring_flush(&io_uring_loop->ring);
+    /* set thread id back to NULL. This should be updated again in destroy, before tasks are canceled. */
+    aws_atomic_store_ptr(&io_uring_loop->running_thread_id, NULL);
+}
+
+#endif /* AWS_USE_IO_URING_IMPL */
@@ -5,7 +5,178 @@
 
 #include <aws/io/message_pool.h>
 
+#include <aws/common/clock.h>
 #include <aws/common/thread.h>
+#include <aws/io/private/tracing.h>
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <sys/mman.h>
+#endif
+
+enum {
+    AWS_MEMORY_POOL_MAGAZINE_SIZE = 8,
+};
+
+enum {
+    /* slab granularity for hugepage-backed pools; the common x86-64/arm64 huge page size */
+    AWS_MEMORY_POOL_HUGE_PAGE_SIZE = 2 * 1024 * 1024,
+};
+
+/* Maps one contiguous slab for a hugepage-backed pool, preferring explicit hugepages and
+ * degrading through transparent hugepages to ordinary pages. Returns NULL when mapping is
+ * impossible, in which case the pool falls back to per-segment heap allocation. */
+static void *s_pool_slab_map(size_t slab_size) {
+#ifdef _WIN32
+    /* large pages require SeLockMemoryPrivilege; try them, then settle for ordinary pages */
+    size_t large_page_size = GetLargePageMinimum();
+    if (large_page_size != 0) {
+        size_t rounded = (slab_size + large_page_size - 1) & ~(large_page_size - 1);
+        void *slab = VirtualAlloc(NULL, rounded, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+        if (slab) {
+            return slab;
+        }
+    }
+    return VirtualAlloc(NULL, slab_size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+    void *slab = MAP_FAILED;
+#    ifdef MAP_HUGETLB
+    slab = mmap(NULL, slab_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#    endif
+    if (slab == MAP_FAILED) {
+        /* no hugetlb reservation; take ordinary pages and ask khugepaged to promote them */
+        slab = mmap(NULL, slab_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (slab == MAP_FAILED) {
+            return NULL;
+        }
+#    ifdef MADV_HUGEPAGE
+        madvise(slab, slab_size, MADV_HUGEPAGE);
+#    endif
+    }
+    return slab;
+#endif
+}
+
+static void s_pool_slab_unmap(void *slab, size_t slab_size) {
+#ifdef _WIN32
+    (void)slab_size;
+    VirtualFree(slab, 0, MEM_RELEASE);
+#else
+    munmap(slab, slab_size);
+#endif
+}
+
+static bool s_segment_is_slab_backed(const struct aws_memory_pool *mempool, void *segment) {
+    return mempool->slab != NULL && (uint8_t *)segment >= (uint8_t *)mempool->slab &&
+           (uint8_t *)segment < (uint8_t *)mempool->slab + mempool->slab_size;
+}
+
+/* frees a segment the pool no longer wants; slab segments are owned by the slab and only go away
+ * when the whole slab is unmapped at clean up */
+static void s_segment_release(struct aws_memory_pool *mempool, void *segment) {
+    if (!s_segment_is_slab_backed(mempool, segment)) {
+        aws_mem_release(mempool->alloc, segment);
+    }
+}
+
+/* Per-thread magazine over each pool's shared depot. The owner thread's acquire/release touch
+ * only the magazine's own lock, which is uncontended except while its pool tears down; refills
+ * and overflows fall through to the depot under the pool lock. Where several locks are taken,
+ * the order is: registry -> pool -> magazine. */
+struct memory_pool_magazine {
+    struct aws_linked_list_node node; /* membership in the owning pool's magazine list */
+    struct memory_pool_magazine *next_for_thread;
+    struct aws_mutex lock;
+    struct aws_memory_pool *pool; /* NULL once the pool has been cleaned up */
+    struct aws_allocator *alloc;
+    size_t count;
+    void *slots[AWS_MEMORY_POOL_MAGAZINE_SIZE];
+};
+
+/* makes a magazine's `pool` pointer stable while held, so flush paths can lock the pool safely */
+static struct aws_mutex s_magazine_registry_lock = AWS_MUTEX_INIT;
+static AWS_THREAD_LOCAL struct memory_pool_magazine *tl_magazines;
+static AWS_THREAD_LOCAL bool tl_magazine_exit_hook_installed;
+
+static void s_flush_thread_magazines(void *user_data) {
+    (void)user_data;
+
+    aws_mutex_lock(&s_magazine_registry_lock);
+    struct memory_pool_magazine *magazine = tl_magazines;
+    tl_magazines = NULL;
+    tl_magazine_exit_hook_installed = false;
+
+    while (magazine) {
+        struct memory_pool_magazine *next = magazine->next_for_thread;
+        struct aws_memory_pool *pool = magazine->pool; /* stable under the registry lock */
+
+        if (pool) {
+            aws_mutex_lock(&pool->lock);
+            aws_mutex_lock(&magazine->lock);
+            for (size_t i = 0; i < magazine->count; ++i) {
+                if (aws_array_list_length(&pool->stack) < pool->ideal_segment_count) {
+                    aws_array_list_push_back(&pool->stack, &magazine->slots[i]);
+                } else {
+                    s_segment_release(pool, magazine->slots[i]);
+                }
+            }
+            aws_linked_list_remove(&magazine->node);
+            magazine->pool = NULL;
+            aws_mutex_unlock(&magazine->lock);
+            aws_mutex_unlock(&pool->lock);
+        }
+
+        struct aws_allocator *alloc = magazine->alloc;
+        aws_mutex_clean_up(&magazine->lock);
+        aws_mem_release(alloc, magazine);
+        magazine = next;
+    }
+
+    aws_mutex_unlock(&s_magazine_registry_lock);
+}
+
+static struct memory_pool_magazine *s_get_thread_magazine(struct aws_memory_pool *mempool, bool create) {
+    for (struct memory_pool_magazine *magazine = tl_magazines; magazine != NULL;
+         magazine = magazine->next_for_thread) {
+        if (magazine->pool == mempool) {
+            return magazine;
+        }
+    }
+
+    if (!create) {
+        return NULL;
+    }
+
+    /* register the thread-exit flush first; on threads that aws_thread doesn't manage this fails
+     * and the caller stays on the shared depot */
+    if (!tl_magazine_exit_hook_installed) {
+        if (aws_thread_current_at_exit(s_flush_thread_magazines, NULL)) {
+            return NULL;
+        }
+        tl_magazine_exit_hook_installed = true;
+    }
+
+    struct memory_pool_magazine *magazine =
+        aws_mem_calloc(mempool->alloc, 1, sizeof(struct memory_pool_magazine));
+    if (!magazine) {
+        return NULL;
+    }
+
+    aws_mutex_init(&magazine->lock);
+    magazine->alloc = mempool->alloc;
+    magazine->pool = mempool;
+
+    aws_mutex_lock(&s_magazine_registry_lock);
+    aws_mutex_lock(&mempool->lock);
+    aws_linked_list_push_back(&mempool->magazines, &magazine->node);
+    aws_mutex_unlock(&mempool->lock);
+    aws_mutex_unlock(&s_magazine_registry_lock);
+
+    magazine->next_for_thread = tl_magazines;
+    tl_magazines = magazine;
+    return magazine;
+}
 
 int aws_memory_pool_init(
     struct aws_memory_pool *mempool,
@@ -13,18 +184,55 @@ int aws_memory_pool_init(
     uint16_t ideal_segment_count,
     size_t segment_size) {
 
+    return aws_memory_pool_init_ex(mempool, alloc, ideal_segment_count, segment_size, false /*hugepage_backed*/);
+}
+
+int aws_memory_pool_init_ex(
+    struct aws_memory_pool *mempool,
+    struct aws_allocator *alloc,
+    uint16_t ideal_segment_count,
+    size_t segment_size,
+    bool hugepage_backed) {
+
     mempool->alloc = alloc;
     mempool->ideal_segment_count = ideal_segment_count;
     mempool->segment_size = segment_size;
+    mempool->slab = NULL;
+    mempool->slab_size = 0;
+    if (aws_mutex_init(&mempool->lock)) {
+        return AWS_OP_ERR;
+    }
+
+    if (hugepage_backed && ideal_segment_count > 0) {
+        size_t slab_size = (size_t)ideal_segment_count * segment_size;
+        slab_size =
+            (slab_size + AWS_MEMORY_POOL_HUGE_PAGE_SIZE - 1) & ~((size_t)AWS_MEMORY_POOL_HUGE_PAGE_SIZE - 1);
+        mempool->slab = s_pool_slab_map(slab_size);
+        if (mempool->slab) {
+            mempool->slab_size = slab_size;
+        }
+        /* NULL slab silently degrades to per-segment heap allocation below */
+    }
+    aws_linked_list_init(&mempool->magazines);
+    aws_atomic_init_int(&mempool->acquire_hit_count, 0);
+    aws_atomic_init_int(&mempool->acquire_fallback_count, 0);
+    aws_atomic_init_int(&mempool->outstanding_count, 0);
+    aws_atomic_init_int(&mempool->outstanding_high_watermark, 0);
     mempool->data_ptr = aws_mem_calloc(alloc, ideal_segment_count, sizeof(void *));
     if (!mempool->data_ptr) {
+        aws_mutex_clean_up(&mempool->lock);
         return AWS_OP_ERR;
     }
 
     aws_array_list_init_static(&mempool->stack, mempool->data_ptr, ideal_segment_count, sizeof(void *));
 
     for (uint16_t i = 0; i < ideal_segment_count; ++i) {
-        void *memory = aws_mem_acquire(alloc, segment_size);
+        void *memory = NULL;
+        if (mempool->slab) {
+            memory = (uint8_t *)mempool->slab + (size_t)i * segment_size;
+        } else {
+            memory = aws_mem_acquire(alloc, segment_size);
+        }
         if (memory) {
             aws_array_list_push_back(&mempool->stack, &memory);
         } else {
@@ -42,39 +250,112 @@ clean_up:
 void aws_memory_pool_clean_up(struct aws_memory_pool *mempool) {
     void *cur = NULL;
 
+    aws_mutex_lock(&s_magazine_registry_lock);
+    aws_mutex_lock(&mempool->lock);
+
+    /* reclaim every magazine's cached segments; the magazine structs themselves are freed by
+     * their owner threads' exit hooks, which see `pool` as NULL and skip the flush */
+    while (!aws_linked_list_empty(&mempool->magazines)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&mempool->magazines);
+        struct memory_pool_magazine *magazine = AWS_CONTAINER_OF(node, struct memory_pool_magazine, node);
+        aws_mutex_lock(&magazine->lock);
+        for (size_t i = 0; i < magazine->count; ++i) {
+            s_segment_release(mempool, magazine->slots[i]);
+        }
+        magazine->count = 0;
+        magazine->pool = NULL;
+        aws_mutex_unlock(&magazine->lock);
+    }
+
     while (aws_array_list_length(&mempool->stack) > 0) {
         /* the only way this fails is not possible since I already checked the length. */
         aws_array_list_back(&mempool->stack, &cur);
         aws_array_list_pop_back(&mempool->stack);
-        aws_mem_release(mempool->alloc, cur);
+        s_segment_release(mempool, cur);
     }
 
+    aws_mutex_unlock(&mempool->lock);
+    aws_mutex_unlock(&s_magazine_registry_lock);
+
     aws_array_list_clean_up(&mempool->stack);
     aws_mem_release(mempool->alloc, mempool->data_ptr);
+    aws_mutex_clean_up(&mempool->lock);
+
+    if (mempool->slab) {
+        s_pool_slab_unmap(mempool->slab, mempool->slab_size);
+        mempool->slab = NULL;
+        mempool->slab_size = 0;
+    }
+}
+
+static void s_memory_pool_track_acquire(struct aws_memory_pool *mempool, bool fallback) {
+    aws_atomic_fetch_add(fallback ? &mempool->acquire_fallback_count : &mempool->acquire_hit_count, 1);
+
+    size_t outstanding = aws_atomic_fetch_add(&mempool->outstanding_count, 1) + 1;
+    size_t high_watermark = aws_atomic_load_int(&mempool->outstanding_high_watermark);
+    while (outstanding > high_watermark &&
+           !aws_atomic_compare_exchange_int(&mempool->outstanding_high_watermark, &high_watermark, outstanding)) {
+    }
 }
 
 void *aws_memory_pool_acquire(struct aws_memory_pool *mempool) {
+    struct memory_pool_magazine *magazine = s_get_thread_magazine(mempool, false /*create*/);
+    if (magazine) {
+        aws_mutex_lock(&magazine->lock);
+        if (magazine->count > 0) {
+            void *mem = magazine->slots[--magazine->count];
+            aws_mutex_unlock(&magazine->lock);
+            s_memory_pool_track_acquire(mempool, false /*fallback*/);
+            return mem;
+        }
+        aws_mutex_unlock(&magazine->lock);
+    }
+
     void *back = NULL;
+    aws_mutex_lock(&mempool->lock);
     if (aws_array_list_length(&mempool->stack) > 0) {
         aws_array_list_back(&mempool->stack, &back);
         aws_array_list_pop_back(&mempool->stack);
+    }
+    aws_mutex_unlock(&mempool->lock);
 
+    if (back) {
+        s_memory_pool_track_acquire(mempool, false /*fallback*/);
         return back;
     }
 
     void *mem = aws_mem_acquire(mempool->alloc, mempool->segment_size);
+    if (mem) {
+        s_memory_pool_track_acquire(mempool, true /*fallback*/);
+    }
     return mem;
 }
 
 void aws_memory_pool_release(struct aws_memory_pool *mempool, void *to_release) {
+    aws_atomic_fetch_sub(&mempool->outstanding_count, 1);
+    struct memory_pool_magazine *magazine = s_get_thread_magazine(mempool, true /*create*/);
+    if (magazine) {
+        aws_mutex_lock(&magazine->lock);
+        /* re-check ownership under the lock; the pool may have torn down since the lookup */
+        if (magazine->pool == mempool && magazine->count < AWS_MEMORY_POOL_MAGAZINE_SIZE) {
+            magazine->slots[magazine->count++] = to_release;
+            aws_mutex_unlock(&magazine->lock);
+            return;
+        }
+        aws_mutex_unlock(&magazine->lock);
+    }
+
+    aws_mutex_lock(&mempool->lock);
     size_t pool_size = aws_array_list_length(&mempool->stack);
 
     if (pool_size >= mempool->ideal_segment_count) {
-        aws_mem_release(mempool->alloc, to_release);
+        aws_mutex_unlock(&mempool->lock);
+        s_segment_release(mempool, to_release);
         return;
     }
 
     aws_array_list_push_back(&mempool->stack, &to_release);
+    aws_mutex_unlock(&mempool->lock);
 }
 
 struct message_pool_allocator {
@@ -97,7 +378,15 @@ void s_message_pool_mem_release(struct aws_allocator *allocator, void *ptr) {
     aws_message_pool_release(msg_pool_alloc->msg_pool, (struct aws_io_message *)ptr);
 }
 
-static size_t MSG_OVERHEAD = sizeof(struct aws_io_message) + sizeof(struct message_pool_allocator);
+struct message_wrapper {
+    struct aws_io_message message;
+    struct message_pool_allocator msg_allocator;
+    /* high-res tick count at aws_message_pool_acquire(); 0 unless the pool tracks lifetimes */
+    uint64_t acquire_timestamp;
+    uint8_t buffer_start[1];
+};
+
+static size_t MSG_OVERHEAD = offsetof(struct message_wrapper, buffer_start);
 
 int aws_message_pool_init(
     struct aws_message_pool *msg_pool,
@@ -108,8 +397,15 @@ int aws_message_pool_init(
 
     size_t msg_data_size = args->application_data_msg_data_size + MSG_OVERHEAD;
 
-    if (aws_memory_pool_init(
-            &msg_pool->application_data_pool, alloc, args->application_data_msg_count, msg_data_size)) {
+    /* the small-block class stays on ordinary pages; its whole footprint fits in a page or two */
+    msg_pool->hugepage_backed = args->hugepage_backed;
+
+    if (aws_memory_pool_init_ex(
+            &msg_pool->application_data_pool,
+            alloc,
+            args->application_data_msg_count,
+            msg_data_size,
+            args->hugepage_backed)) {
         return AWS_OP_ERR;
     }
 
@@ -120,20 +416,111 @@ int aws_message_pool_init(
         return AWS_OP_ERR;
     }
 
+    msg_pool->large_block_pool_count = 0;
+
+    msg_pool->on_pressure = args->on_pressure;
+    msg_pool->on_pressure_user_data = args->on_pressure_user_data;
+    msg_pool->pressure_fallback_threshold = args->pressure_fallback_threshold;
+    aws_atomic_init_int(&msg_pool->fallbacks_at_last_pressure, 0);
+
+    msg_pool->track_message_lifetimes = args->track_message_lifetimes;
+    for (size_t segment = 0; segment < AWS_MESSAGE_POOL_LIFETIME_SEGMENTS; ++segment) {
+        for (size_t bucket = 0; bucket < AWS_MESSAGE_POOL_LIFETIME_BUCKETS; ++bucket) {
+            aws_atomic_init_int(&msg_pool->lifetime_buckets[segment][bucket], 0);
+        }
+    }
+
     return AWS_OP_SUCCESS;
 }
 
+static void s_memory_pool_accumulate_metrics(
+    const struct aws_memory_pool *mempool,
+    struct aws_message_pool_metrics *metrics) {
+    metrics->acquire_hits += aws_atomic_load_int(&mempool->acquire_hit_count);
+    metrics->acquire_fallbacks += aws_atomic_load_int(&mempool->acquire_fallback_count);
+    metrics->outstanding += aws_atomic_load_int(&mempool->outstanding_count);
+    metrics->outstanding_high_watermark += aws_atomic_load_int(&mempool->outstanding_high_watermark);
+}
+
+void aws_message_pool_query_metrics(
+    const struct aws_message_pool *msg_pool,
+    struct aws_message_pool_metrics *metrics) {
+    AWS_ZERO_STRUCT(*metrics);
+    s_memory_pool_accumulate_metrics(&msg_pool->application_data_pool, metrics);
+    s_memory_pool_accumulate_metrics(&msg_pool->small_block_pool, metrics);
+    for (size_t i = 0; i < msg_pool->large_block_pool_count; ++i) {
+        s_memory_pool_accumulate_metrics(&msg_pool->large_block_pools[i], metrics);
+    }
+}
+
+void aws_message_pool_query_lifetime_histogram(
+    const struct aws_message_pool *msg_pool,
+    struct aws_message_pool_lifetime_histogram *histogram) {
+    for (size_t segment = 0; segment < AWS_MESSAGE_POOL_LIFETIME_SEGMENTS; ++segment) {
+        for (size_t bucket = 0; bucket < AWS_MESSAGE_POOL_LIFETIME_BUCKETS; ++bucket) {
+            histogram->buckets[segment][bucket] = aws_atomic_load_int(&msg_pool->lifetime_buckets[segment][bucket]);
+        }
+    }
+}
+
+static void s_message_pool_check_pressure(struct aws_message_pool *msg_pool) {
+    if (!msg_pool->on_pressure || msg_pool->pressure_fallback_threshold == 0) {
+        return;
+    }
+
+    struct aws_message_pool_metrics metrics;
+    aws_message_pool_query_metrics(msg_pool, &metrics);
+
+    size_t last_notified = aws_atomic_load_int(&msg_pool->fallbacks_at_last_pressure);
+    if (metrics.acquire_fallbacks - last_notified < msg_pool->pressure_fallback_threshold) {
+        return;
+    }
+
+    /* one caller wins the exchange, so a burst of fallbacks produces one callback per
+     * threshold crossing rather than one per acquire */
+    if (aws_atomic_compare_exchange_int(
+            &msg_pool->fallbacks_at_last_pressure, &last_notified, metrics.acquire_fallbacks)) {
+        msg_pool->on_pressure(msg_pool, &metrics, msg_pool->on_pressure_user_data);
+    }
+}
+
 void aws_message_pool_clean_up(struct aws_message_pool *msg_pool) {
     aws_memory_pool_clean_up(&msg_pool->application_data_pool);
     aws_memory_pool_clean_up(&msg_pool->small_block_pool);
+    for (size_t i = 0; i < msg_pool->large_block_pool_count; ++i) {
+        aws_memory_pool_clean_up(&msg_pool->large_block_pools[i]);
+    }
     AWS_ZERO_STRUCT(*msg_pool);
 }
 
-struct message_wrapper {
-    struct aws_io_message message;
-    struct message_pool_allocator msg_allocator;
-    uint8_t buffer_start[1];
-};
+int aws_message_pool_ensure_block_size(struct aws_message_pool *msg_pool, size_t msg_data_size) {
+    size_t largest = msg_pool->large_block_pool_count > 0
+                         ? msg_pool->large_block_pools[msg_pool->large_block_pool_count - 1].segment_size - MSG_OVERHEAD
+                         : msg_pool->application_data_pool.segment_size - MSG_OVERHEAD;
+
+    while (largest < msg_data_size) {
+        if (msg_pool->large_block_pool_count == AWS_MESSAGE_POOL_MAX_LARGE_CLASSES) {
+            return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        }
+
+        size_t next = largest * 2;
+        /* jumbo classes keep fewer warm segments than the base class; they only serve the
+         * handful of bulk channels that asked for them */
+        if (aws_memory_pool_init_ex(
+                &msg_pool->large_block_pools[msg_pool->large_block_pool_count],
+                msg_pool->alloc,
+                2,
+                next + MSG_OVERHEAD,
+                msg_pool->hugepage_backed)) {
+            return AWS_OP_ERR;
+        }
+
+        ++msg_pool->large_block_pool_count;
+        largest = next;
+    }
+
+    return AWS_OP_SUCCESS;
+}
 
 struct aws_io_message *aws_message_pool_acquire(
     struct aws_message_pool *msg_pool,
@@ -145,8 +532,19 @@ struct aws_io_message *aws_message_pool_acquire(
     switch (message_type) {
         case AWS_IO_MESSAGE_APPLICATION_DATA:
             if (size_hint > msg_pool->small_block_pool.segment_size - MSG_OVERHEAD) {
-                message_wrapper = aws_memory_pool_acquire(&msg_pool->application_data_pool);
-                max_size = msg_pool->application_data_pool.segment_size - MSG_OVERHEAD;
+                /* smallest size class that fits the hint; requests beyond the largest class get
+                 * the largest class (and a capped capacity), as before tiering existed */
+                struct aws_memory_pool *pool = &msg_pool->application_data_pool;
+                if (size_hint > pool->segment_size - MSG_OVERHEAD) {
+                    for (size_t i = 0; i < msg_pool->large_block_pool_count; ++i) {
+                        pool = &msg_pool->large_block_pools[i];
+                        if (size_hint <= pool->segment_size - MSG_OVERHEAD) {
+                            break;
+                        }
+                    }
+                }
+                message_wrapper = aws_memory_pool_acquire(pool);
+                max_size = pool->segment_size - MSG_OVERHEAD;
             } else {
                 message_wrapper = aws_memory_pool_acquire(&msg_pool->small_block_pool);
                 max_size = msg_pool->small_block_pool.segment_size - MSG_OVERHEAD;
@@ -164,6 +562,7 @@ struct aws_io_message *aws_message_pool_acquire(
 
     message_wrapper->message.message_type = message_type;
     message_wrapper->message.message_tag = 0;
+    message_wrapper->message.priority = AWS_IO_MESSAGE_PRIORITY_NORMAL;
     message_wrapper->message.user_data = NULL;
     message_wrapper->message.copy_mark = 0;
     message_wrapper->message.on_completion = NULL;
@@ -179,21 +578,67 @@ struct aws_io_message *aws_message_pool_acquire(
     message_wrapper->msg_allocator.base_allocator.mem_release = s_message_pool_mem_release;
     message_wrapper->msg_allocator.msg_pool = msg_pool;
 
+    message_wrapper->acquire_timestamp = 0;
+    if (msg_pool->track_message_lifetimes) {
+        aws_high_res_clock_get_ticks(&message_wrapper->acquire_timestamp);
+    }
+
     message_wrapper->message.allocator = &message_wrapper->msg_allocator.base_allocator;
+    AWS_IO_USDT_MESSAGE_POOL_ACQUIRE(msg_pool, &message_wrapper->message, message_wrapper->message.message_data.capacity);
+    s_message_pool_check_pressure(msg_pool);
     return &message_wrapper->message;
 }
 
+static void s_message_pool_record_lifetime(struct aws_message_pool *msg_pool, struct message_wrapper *wrapper) {
+    if (!msg_pool->track_message_lifetimes || wrapper->acquire_timestamp == 0) {
+        return;
+    }
+
+    uint64_t now = 0;
+    aws_high_res_clock_get_ticks(&now);
+    uint64_t elapsed_ns = now > wrapper->acquire_timestamp ? now - wrapper->acquire_timestamp : 0;
+    uint64_t elapsed_us = aws_timestamp_convert(elapsed_ns, AWS_TIMESTAMP_NANOS, AWS_TIMESTAMP_MICROS, NULL);
+
+    size_t segment = wrapper->message.copy_mark;
+    if (segment >= AWS_MESSAGE_POOL_LIFETIME_SEGMENTS) {
+        segment = AWS_MESSAGE_POOL_LIFETIME_SEGMENTS - 1;
+    }
+
+    size_t bucket = 0;
+    while (elapsed_us > 1 && bucket < AWS_MESSAGE_POOL_LIFETIME_BUCKETS - 1) {
+        elapsed_us >>= 1;
+        ++bucket;
+    }
+
+    aws_atomic_fetch_add(&msg_pool->lifetime_buckets[segment][bucket], 1);
+}
+
 void aws_message_pool_release(struct aws_message_pool *msg_pool, struct aws_io_message *message) {
 
+    AWS_IO_USDT_MESSAGE_POOL_RELEASE(msg_pool, message);
+
     memset(message->message_data.buffer, 0, message->message_data.len);
     message->allocator = NULL;
 
     struct message_wrapper *wrapper = AWS_CONTAINER_OF(message, struct message_wrapper, message);
 
+    s_message_pool_record_lifetime(msg_pool, wrapper);
+
     switch (message->message_type) {
         case AWS_IO_MESSAGE_APPLICATION_DATA:
             if (message->message_data.capacity > msg_pool->small_block_pool.segment_size - MSG_OVERHEAD) {
-                aws_memory_pool_release(&msg_pool->application_data_pool, wrapper);
+                /* same first-fit walk as acquire, so the wrapper goes back to the class it came
+                 * from */
+                struct aws_memory_pool *pool = &msg_pool->application_data_pool;
+                if (message->message_data.capacity > pool->segment_size - MSG_OVERHEAD) {
+                    for (size_t i = 0; i < msg_pool->large_block_pool_count; ++i) {
+                        pool = &msg_pool->large_block_pools[i];
+                        if (message->message_data.capacity <= pool->segment_size - MSG_OVERHEAD) {
+                            break;
+                        }
+                    }
+                }
+                aws_memory_pool_release(pool, wrapper);
             } else {
                 aws_memory_pool_release(&msg_pool->small_block_pool, wrapper);
             }
@@ -0,0 +1,129 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/io/io.h>
+
+#include <aws/common/atomics.h>
+
+/* Zero-copy message slicing: a slice is a child aws_io_message whose message_data points into the
+ * parent's buffer. The first slice taken from a message installs a release trampoline in place of
+ * the message's allocator, so the parent's eventual release (from anywhere that calls
+ * aws_mem_release(msg->allocator, msg)) only drops a reference; the parent goes back to its real
+ * allocator - typically the message pool - when the parent and every slice have been released. */
+
+struct sliced_message_state {
+    struct aws_allocator parent_release_trampoline; /* installed as the parent's allocator */
+    struct aws_allocator *original_allocator;       /* restored to actually free the parent */
+    struct aws_io_message *parent;
+    struct aws_allocator *alloc; /* allocator for this struct and the slices */
+    struct aws_atomic_var refcount; /* the parent plus every live slice */
+};
+
+struct message_slice {
+    struct aws_io_message message;
+    struct aws_allocator release_trampoline;
+    struct sliced_message_state *state;
+};
+
+static void *s_slice_mem_acquire(struct aws_allocator *allocator, size_t size) {
+    (void)allocator;
+    (void)size;
+
+    /* release-only trampoline, mirroring the message pool's */
+    AWS_ASSERT(0);
+    return NULL;
+}
+
+static void s_sliced_state_release(struct sliced_message_state *state) {
+    if (aws_atomic_fetch_sub(&state->refcount, 1) == 1) {
+        struct aws_io_message *parent = state->parent;
+        struct aws_allocator *alloc = state->alloc;
+        parent->allocator = state->original_allocator;
+        aws_mem_release(alloc, state);
+        /* back to the message pool (or whatever allocated the parent) */
+        aws_mem_release(parent->allocator, parent);
+    }
+}
+
+static void s_parent_mem_release(struct aws_allocator *allocator, void *ptr) {
+    struct sliced_message_state *state = allocator->impl;
+    AWS_ASSERT(ptr == state->parent);
+    (void)ptr;
+    s_sliced_state_release(state);
+}
+
+static void s_slice_mem_release(struct aws_allocator *allocator, void *ptr) {
+    struct message_slice *slice = allocator->impl;
+    AWS_ASSERT(ptr == &slice->message);
+    (void)ptr;
+    struct sliced_message_state *state = slice->state;
+    aws_mem_release(state->alloc, slice);
+    s_sliced_state_release(state);
+}
+
+struct aws_io_message *aws_io_message_new_slice(
+    struct aws_allocator *allocator,
+    struct aws_io_message *message,
+    size_t offset,
+    size_t length) {
+
+    if (offset > message->message_data.len || length > message->message_data.len - offset) {
+        aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        return NULL;
+    }
+
+    struct sliced_message_state *state = NULL;
+
+    /* slicing a slice shares the root message's state rather than stacking trampolines */
+    if (message->allocator && message->allocator->mem_release == s_slice_mem_release) {
+        struct message_slice *parent_slice = message->allocator->impl;
+        state = parent_slice->state;
+    } else if (message->allocator && message->allocator->mem_release == s_parent_mem_release) {
+        state = message->allocator->impl;
+    }
+
+    if (!state) {
+        state = aws_mem_calloc(allocator, 1, sizeof(struct sliced_message_state));
+        if (!state) {
+            return NULL;
+        }
+        state->original_allocator = message->allocator;
+        state->parent = message;
+        state->alloc = allocator;
+        aws_atomic_init_int(&state->refcount, 1); /* the parent's own reference */
+        state->parent_release_trampoline.impl = state;
+        state->parent_release_trampoline.mem_acquire = s_slice_mem_acquire;
+        state->parent_release_trampoline.mem_realloc = NULL;
+        state->parent_release_trampoline.mem_release = s_parent_mem_release;
+        message->allocator = &state->parent_release_trampoline;
+    }
+
+    struct message_slice *slice = aws_mem_calloc(allocator, 1, sizeof(struct message_slice));
+    if (!slice) {
+        /* a freshly installed trampoline stays put; the parent's reference keeps it correct */
+        return NULL;
+    }
+
+    aws_atomic_fetch_add(&state->refcount, 1);
+    slice->state = state;
+    slice->release_trampoline.impl = slice;
+    slice->release_trampoline.mem_acquire = s_slice_mem_acquire;
+    slice->release_trampoline.mem_realloc = NULL;
+    slice->release_trampoline.mem_release = s_slice_mem_release;
+
+    slice->message.allocator = &slice->release_trampoline;
+    slice->message.message_data.buffer = message->message_data.buffer + offset;
+    slice->message.message_data.len = length;
+    slice->message.message_data.capacity = length;
+    slice->message.message_data.allocator = NULL;
+    slice->message.message_type = message->message_type;
+    slice->message.message_tag = message->message_tag;
+    slice->message.copy_mark = 0;
+    slice->message.owning_channel = message->owning_channel;
+    slice->message.on_completion = NULL;
+    slice->message.user_data = NULL;
+
+    return &slice->message;
+}
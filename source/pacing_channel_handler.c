@@ -0,0 +1,347 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/io/pacing_channel_handler.h>
+
+#include <aws/io/channel.h>
+#include <aws/io/logging.h>
+#include <aws/io/socket.h>
+
+#ifndef _WIN32
+#    include <errno.h>
+#    include <sys/socket.h>
+#endif /* _WIN32 */
+
+enum {
+    /* floor for the release-timer period. Batching a few messages per tick costs a little pacing
+     * smoothness (the kernel pacing backstop covers sub-tick smoothing when available) but keeps
+     * a heavily-shaped channel from waking its loop for every message. */
+    AWS_PACING_HANDLER_MIN_TICK_NS = 1000000,
+};
+
+struct pacing_handler {
+    struct aws_channel_slot *slot;
+    uint64_t rate_bytes_per_sec;
+    uint64_t burst_size_bytes;
+    /* token bucket. Goes negative when a message larger than the remaining tokens is released
+     * (a message is never split), which delays the next batch by the overdraft. */
+    int64_t tokens;
+    /* channel-clock time of the last refill, nanoseconds */
+    uint64_t last_refill_timestamp;
+    /* aws_io_message queueing_handle list, FIFO within NORMAL priority */
+    struct aws_linked_list queued_messages;
+    struct aws_channel_task release_task_storage;
+    bool release_task_scheduled;
+    bool shutdown_in_progress;
+};
+
+/* mint tokens for the time elapsed since the last refill, capped at the bucket depth */
+static void s_refill_tokens(struct pacing_handler *pacing_handler, uint64_t now) {
+    if (now <= pacing_handler->last_refill_timestamp) {
+        return;
+    }
+
+    uint64_t elapsed_ns = now - pacing_handler->last_refill_timestamp;
+    pacing_handler->last_refill_timestamp = now;
+
+    /* split the multiply so elapsed_ns * rate can't overflow for any rate below ~18GB/s */
+    uint64_t earned = (elapsed_ns / AWS_TIMESTAMP_NANOS) * pacing_handler->rate_bytes_per_sec +
+                      ((elapsed_ns % AWS_TIMESTAMP_NANOS) * pacing_handler->rate_bytes_per_sec) / AWS_TIMESTAMP_NANOS;
+
+    if (earned >= pacing_handler->burst_size_bytes) {
+        pacing_handler->tokens = (int64_t)pacing_handler->burst_size_bytes;
+    } else {
+        pacing_handler->tokens += (int64_t)earned;
+        if (pacing_handler->tokens > (int64_t)pacing_handler->burst_size_bytes) {
+            pacing_handler->tokens = (int64_t)pacing_handler->burst_size_bytes;
+        }
+    }
+}
+
+static void s_release_task(struct aws_channel_task *task, void *arg, enum aws_task_status status);
+
+/* arm the release timer for when the bucket will be positive again (at least one min-tick out,
+ * so several refill-worths of messages release per wakeup) */
+static void s_schedule_release_task(struct pacing_handler *pacing_handler, uint64_t now) {
+    if (pacing_handler->release_task_scheduled) {
+        return;
+    }
+
+    uint64_t deficit = pacing_handler->tokens >= 0 ? 0 : (uint64_t)(-pacing_handler->tokens);
+    uint64_t delay_ns = (deficit * AWS_TIMESTAMP_NANOS) / pacing_handler->rate_bytes_per_sec;
+    if (delay_ns < AWS_PACING_HANDLER_MIN_TICK_NS) {
+        delay_ns = AWS_PACING_HANDLER_MIN_TICK_NS;
+    }
+
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_PACING_HANDLER,
+        "id=%p: bucket at %lld bytes, scheduling release task %llu ns out.",
+        (void *)pacing_handler->slot->handler,
+        (long long)pacing_handler->tokens,
+        (unsigned long long)delay_ns);
+
+    aws_channel_task_init(
+        &pacing_handler->release_task_storage, s_release_task, pacing_handler, "pacing_handler_release");
+    aws_channel_schedule_task_future(
+        pacing_handler->slot->channel, &pacing_handler->release_task_storage, now + delay_ns);
+    pacing_handler->release_task_scheduled = true;
+}
+
+/* send queued messages downstream while tokens last. Returns AWS_OP_ERR with the error raised if
+ * a downstream send fails (the failed message has been completed and released). */
+static int s_release_queued_messages(struct pacing_handler *pacing_handler) {
+    struct aws_channel_slot *slot = pacing_handler->slot;
+
+    while (!aws_linked_list_empty(&pacing_handler->queued_messages) && pacing_handler->tokens > 0) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&pacing_handler->queued_messages);
+        struct aws_io_message *message = AWS_CONTAINER_OF(node, struct aws_io_message, queueing_handle);
+
+        pacing_handler->tokens -= (int64_t)message->message_data.len;
+
+        if (aws_channel_slot_send_message(slot, message, AWS_CHANNEL_DIR_WRITE)) {
+            int error_code = aws_last_error();
+            AWS_LOGF_ERROR(
+                AWS_LS_IO_PACING_HANDLER,
+                "id=%p: failed to send queued message downstream with error %d(%s)",
+                (void *)slot->handler,
+                error_code,
+                aws_error_name(error_code));
+            if (message->on_completion) {
+                message->on_completion(slot->channel, message, error_code, message->user_data);
+            }
+            aws_mem_release(message->allocator, message);
+            return aws_raise_error(error_code);
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static void s_release_task(struct aws_channel_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+
+    struct pacing_handler *pacing_handler = arg;
+    pacing_handler->release_task_scheduled = false;
+
+    /* on cancellation the channel is going away; shutdown drains the queue */
+    if (status != AWS_TASK_STATUS_RUN_READY || pacing_handler->shutdown_in_progress) {
+        return;
+    }
+
+    uint64_t now = 0;
+    if (aws_channel_current_clock_time(pacing_handler->slot->channel, &now)) {
+        aws_channel_shutdown(pacing_handler->slot->channel, aws_last_error());
+        return;
+    }
+
+    s_refill_tokens(pacing_handler, now);
+
+    if (s_release_queued_messages(pacing_handler)) {
+        aws_channel_shutdown(pacing_handler->slot->channel, aws_last_error());
+        return;
+    }
+
+    if (!aws_linked_list_empty(&pacing_handler->queued_messages)) {
+        s_schedule_release_task(pacing_handler, now);
+    }
+}
+
+static int s_pacing_process_read_message(
+    struct aws_channel_handler *handler,
+    struct aws_channel_slot *slot,
+    struct aws_io_message *message) {
+    (void)handler;
+
+    /* only egress is shaped; reads pass straight through */
+    return aws_channel_slot_send_message(slot, message, AWS_CHANNEL_DIR_READ);
+}
+
+static int s_pacing_process_write_message(
+    struct aws_channel_handler *handler,
+    struct aws_channel_slot *slot,
+    struct aws_io_message *message) {
+
+    struct pacing_handler *pacing_handler = handler->impl;
+    pacing_handler->slot = slot;
+
+    if (pacing_handler->shutdown_in_progress) {
+        return aws_raise_error(AWS_IO_CHANNEL_ERROR_ERROR_CANT_ACCEPT_INPUT);
+    }
+
+    uint64_t now = 0;
+    if (aws_channel_current_clock_time(slot->channel, &now)) {
+        return AWS_OP_ERR;
+    }
+
+    s_refill_tokens(pacing_handler, now);
+
+    /* HIGH priority frames (pings, acks, window updates) overtake queued bulk data here like they
+     * do everywhere else writes back up; they still drain the bucket so bulk pays for them. */
+    bool overtake = message->priority == AWS_IO_MESSAGE_PRIORITY_HIGH;
+
+    if (overtake || (aws_linked_list_empty(&pacing_handler->queued_messages) && pacing_handler->tokens > 0)) {
+        pacing_handler->tokens -= (int64_t)message->message_data.len;
+        return aws_channel_slot_send_message(slot, message, AWS_CHANNEL_DIR_WRITE);
+    }
+
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_PACING_HANDLER,
+        "id=%p: queueing %zu byte message, bucket at %lld bytes.",
+        (void *)handler,
+        message->message_data.len,
+        (long long)pacing_handler->tokens);
+
+    aws_linked_list_push_back(&pacing_handler->queued_messages, &message->queueing_handle);
+    s_schedule_release_task(pacing_handler, now);
+    return AWS_OP_SUCCESS;
+}
+
+static int s_pacing_increment_read_window(
+    struct aws_channel_handler *handler,
+    struct aws_channel_slot *slot,
+    size_t size) {
+    (void)handler;
+    return aws_channel_slot_increment_read_window(slot, size);
+}
+
+static int s_pacing_shutdown(
+    struct aws_channel_handler *handler,
+    struct aws_channel_slot *slot,
+    enum aws_channel_direction dir,
+    int error_code,
+    bool free_scarce_resources_immediately) {
+
+    struct pacing_handler *pacing_handler = handler->impl;
+
+    if (dir == AWS_CHANNEL_DIR_WRITE) {
+        pacing_handler->shutdown_in_progress = true;
+
+        /* a graceful shutdown flushes the backlog downstream unshaped (the connection is ending,
+         * there is nothing left to be fair to); an error shutdown fails it */
+        bool flush = error_code == AWS_ERROR_SUCCESS && !free_scarce_resources_immediately;
+
+        while (!aws_linked_list_empty(&pacing_handler->queued_messages)) {
+            struct aws_linked_list_node *node = aws_linked_list_pop_front(&pacing_handler->queued_messages);
+            struct aws_io_message *message = AWS_CONTAINER_OF(node, struct aws_io_message, queueing_handle);
+
+            if (flush && aws_channel_slot_send_message(slot, message, AWS_CHANNEL_DIR_WRITE) == AWS_OP_SUCCESS) {
+                continue;
+            }
+
+            if (message->on_completion) {
+                int completion_error = error_code != AWS_ERROR_SUCCESS ? error_code : AWS_IO_SOCKET_CLOSED;
+                message->on_completion(slot->channel, message, completion_error, message->user_data);
+            }
+            aws_mem_release(message->allocator, message);
+        }
+    }
+
+    return aws_channel_slot_on_handler_shutdown_complete(slot, dir, error_code, free_scarce_resources_immediately);
+}
+
+static size_t s_pacing_initial_window_size(struct aws_channel_handler *handler) {
+    (void)handler;
+    return SIZE_MAX;
+}
+
+static size_t s_pacing_message_overhead(struct aws_channel_handler *handler) {
+    (void)handler;
+    return 0;
+}
+
+static void s_pacing_destroy(struct aws_channel_handler *handler) {
+    struct pacing_handler *pacing_handler = handler->impl;
+
+    /* shutdown already drained the queue; belt-and-suspenders for a handler destroyed before
+     * its channel ever shut down the write direction */
+    while (!aws_linked_list_empty(&pacing_handler->queued_messages)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&pacing_handler->queued_messages);
+        struct aws_io_message *message = AWS_CONTAINER_OF(node, struct aws_io_message, queueing_handle);
+        aws_mem_release(message->allocator, message);
+    }
+
+    aws_mem_release(handler->alloc, pacing_handler);
+    aws_mem_release(handler->alloc, handler);
+}
+
+static struct aws_channel_handler_vtable s_pacing_handler_vtable = {
+    .process_read_message = s_pacing_process_read_message,
+    .process_write_message = s_pacing_process_write_message,
+    .increment_read_window = s_pacing_increment_read_window,
+    .shutdown = s_pacing_shutdown,
+    .initial_window_size = s_pacing_initial_window_size,
+    .message_overhead = s_pacing_message_overhead,
+    .destroy = s_pacing_destroy,
+};
+
+/* best effort: hand the shaping rate to the kernel too, where the fq qdisc (or TCP internal
+ * pacing) spreads individual segments out far more smoothly than a timer task can */
+static void s_apply_kernel_pacing(struct aws_socket *socket, uint64_t rate_bytes_per_sec) {
+#if defined(SO_MAX_PACING_RATE)
+    uint32_t pacing_rate = rate_bytes_per_sec > UINT32_MAX ? UINT32_MAX : (uint32_t)rate_bytes_per_sec;
+    if (AWS_UNLIKELY(setsockopt(
+            socket->io_handle.data.fd, SOL_SOCKET, SO_MAX_PACING_RATE, &pacing_rate, sizeof(pacing_rate)))) {
+        int errno_value = errno; /* Always cache errno before potential side-effect */
+        AWS_LOGF_WARN(
+            AWS_LS_IO_PACING_HANDLER,
+            "static: setsockopt() for SO_MAX_PACING_RATE failed with errno %d, "
+            "userspace shaping still applies.",
+            errno_value);
+    } else {
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_PACING_HANDLER,
+            "static: kernel pacing enabled on fd %d at %lu bytes/sec.",
+            socket->io_handle.data.fd,
+            (unsigned long)pacing_rate);
+    }
+#else
+    (void)socket;
+    (void)rate_bytes_per_sec;
+#endif /* SO_MAX_PACING_RATE */
+}
+
+struct aws_channel_handler *aws_pacing_handler_new(
+    struct aws_allocator *allocator,
+    const struct aws_pacing_handler_options *options) {
+
+    if (options->rate_bytes_per_sec == 0) {
+        aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        return NULL;
+    }
+
+    struct aws_channel_handler *handler = aws_mem_calloc(allocator, 1, sizeof(struct aws_channel_handler));
+    if (!handler) {
+        return NULL;
+    }
+
+    struct pacing_handler *pacing_handler = aws_mem_calloc(allocator, 1, sizeof(struct pacing_handler));
+    if (!pacing_handler) {
+        aws_mem_release(allocator, handler);
+        return NULL;
+    }
+
+    pacing_handler->rate_bytes_per_sec = options->rate_bytes_per_sec;
+    pacing_handler->burst_size_bytes =
+        options->burst_size_bytes != 0 ? options->burst_size_bytes : g_aws_channel_max_fragment_size;
+    /* start with a full bucket so a fresh connection's first burst goes out unshaped */
+    pacing_handler->tokens = (int64_t)pacing_handler->burst_size_bytes;
+    aws_linked_list_init(&pacing_handler->queued_messages);
+
+    handler->impl = pacing_handler;
+    handler->alloc = allocator;
+    handler->vtable = &s_pacing_handler_vtable;
+
+    if (options->socket != NULL) {
+        s_apply_kernel_pacing(options->socket, options->rate_bytes_per_sec);
+    }
+
+    AWS_LOGF_DEBUG(
+        AWS_LS_IO_PACING_HANDLER,
+        "id=%p: new pacing handler, rate %llu bytes/sec, burst %llu bytes.",
+        (void *)handler,
+        (unsigned long long)pacing_handler->rate_bytes_per_sec,
+        (unsigned long long)pacing_handler->burst_size_bytes);
+
+    return handler;
+}
@@ -2,13 +2,14 @@
  * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
  * SPDX-License-Identifier: Apache-2.0.
  */
-#include <aws/common/encoding.h>
 #include <aws/common/string.h>
 #include <aws/io/pem.h>
 #include <aws/io/private/pem_utils.h>
 
 #include <aws/io/logging.h>
 
+#include <string.h>
+
 enum aws_pem_parse_state {
     BEGIN,
     ON_DATA,
@@ -225,141 +226,206 @@ static struct aws_byte_cursor s_begin_header_cur = AWS_BYTE_CUR_INIT_FROM_STRING
 static struct aws_byte_cursor s_end_header_cur = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("-----END");
 static struct aws_byte_cursor s_delim_cur = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("-----");
 
-int s_extract_header_type_cur(struct aws_byte_cursor cur, struct aws_byte_cursor *out) {
-    if (!aws_byte_cursor_starts_with(&cur, &s_begin_header_cur)) {
-        AWS_LOGF_ERROR(AWS_LS_IO_PEM, "Invalid PEM buffer: invalid begin token");
-        return aws_raise_error(AWS_ERROR_PEM_MALFORMED);
-    }
+/*
+ * Base64 decode values: 0-63 are data; BASE64_PAD is '='; BASE64_SPACE covers the whitespace the
+ * old line-splitting pass used to strip; BASE64_INVALID is everything else. A table lookup keeps
+ * the decode loop branch-light so multi-megabyte CA bundles decode in one pass over the input.
+ */
+enum {
+    BASE64_SPACE = 0xFD,
+    BASE64_PAD = 0xFE,
+    BASE64_INVALID = 0xFF,
+};
 
-    aws_byte_cursor_advance(&cur, s_begin_header_cur.len);
-    aws_byte_cursor_advance(&cur, 1); // space after begin
+/* clang-format off */
+static const uint8_t s_base64_decode_table[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+/* clang-format on */
 
-    struct aws_byte_cursor type_cur = aws_byte_cursor_advance(&cur, cur.len - s_delim_cur.len);
+/*
+ * Single pass over the input: finds each BEGIN header, copies the type string into the arena and
+ * base64-decodes the body straight after it. The arena never reallocates (the caller sized it to
+ * the whole input, which is a strict upper bound on types plus decoded payloads), so the views
+ * pushed into pem_object_views stay valid.
+ *
+ * Matches the semantics of the old line-splitting parser: a malformed begin header ends the scan
+ * and whatever was parsed before it is returned; a malformed object body (bad base64, missing end
+ * header) fails the whole call.
+ */
+static int s_pem_decode_objects_to_arena(
+    struct aws_byte_cursor pem,
+    struct aws_byte_buf *arena,
+    struct aws_array_list *pem_object_views) {
 
-    if (!aws_byte_cursor_eq(&cur, &s_delim_cur)) {
-        AWS_LOGF_ERROR(AWS_LS_IO_PEM, "Invalid PEM buffer: invalid end token");
-        return aws_raise_error(AWS_ERROR_PEM_MALFORMED);
-    }
+    const uint8_t *ptr = pem.ptr;
+    size_t len = pem.len;
+    size_t i = 0;
 
-    *out = type_cur;
-    return AWS_OP_SUCCESS;
-}
+    while (i < len) {
+        /* Find the next begin header; anything between objects (comments etc.) is skipped. */
+        const uint8_t *dash = memchr(ptr + i, '-', len - i);
+        if (dash == NULL) {
+            break;
+        }
+        i = (size_t)(dash - ptr);
+        if (len - i < s_begin_header_cur.len || memcmp(ptr + i, s_begin_header_cur.ptr, s_begin_header_cur.len) != 0) {
+            ++i;
+            continue;
+        }
+        i += s_begin_header_cur.len;
+        if (i < len && ptr[i] == ' ') {
+            ++i;
+        }
 
-static int s_convert_pem_to_raw_base64(
-    struct aws_allocator *allocator,
-    struct aws_byte_cursor pem,
-    struct aws_array_list *pem_objects) {
+        size_t type_start = i;
+        while (i < len && ptr[i] != '-' && ptr[i] != '\n') {
+            ++i;
+        }
+        if (len - i < s_delim_cur.len || memcmp(ptr + i, s_delim_cur.ptr, s_delim_cur.len) != 0) {
+            AWS_LOGF_ERROR(AWS_LS_IO_PEM, "Invalid PEM buffer: invalid begin token");
+            break;
+        }
+        struct aws_byte_cursor type_cur = {.ptr = ptr + type_start, .len = i - type_start};
+        i += s_delim_cur.len;
+
+        AWS_FATAL_ASSERT(arena->len + type_cur.len <= arena->capacity);
+        size_t type_offset = arena->len;
+        memcpy(arena->buffer + arena->len, type_cur.ptr, type_cur.len);
+        arena->len += type_cur.len;
+
+        size_t data_offset = arena->len;
+        uint32_t bits = 0;
+        size_t group_len = 0;
+        size_t pad = 0;
+        bool malformed = false;
+
+        while (i < len && ptr[i] != '-') {
+            uint8_t value = s_base64_decode_table[ptr[i]];
+            ++i;
+            if (value < 64) {
+                if (pad > 0) {
+                    malformed = true;
+                    break;
+                }
+                bits = (bits << 6) | value;
+                if (++group_len == 4) {
+                    arena->buffer[arena->len++] = (uint8_t)(bits >> 16);
+                    arena->buffer[arena->len++] = (uint8_t)(bits >> 8);
+                    arena->buffer[arena->len++] = (uint8_t)bits;
+                    bits = 0;
+                    group_len = 0;
+                }
+            } else if (value == BASE64_PAD) {
+                if (++pad > 2) {
+                    malformed = true;
+                    break;
+                }
+            } else if (value != BASE64_SPACE) {
+                malformed = true;
+                break;
+            }
+        }
 
-    struct aws_array_list split_buffers;
-    if (aws_array_list_init_dynamic(&split_buffers, allocator, 16, sizeof(struct aws_byte_cursor))) {
-        return AWS_OP_ERR;
+        if (!malformed) {
+            /* Flush the final partial group; padding must complete it to 4 characters. */
+            if (group_len == 3 && pad == 1) {
+                arena->buffer[arena->len++] = (uint8_t)(bits >> 10);
+                arena->buffer[arena->len++] = (uint8_t)(bits >> 2);
+            } else if (group_len == 2 && pad == 2) {
+                arena->buffer[arena->len++] = (uint8_t)(bits >> 4);
+            } else if (group_len != 0 || pad != 0) {
+                malformed = true;
+            }
+        }
+        AWS_FATAL_ASSERT(arena->len <= arena->capacity);
+
+        if (malformed || len - i < s_end_header_cur.len ||
+            memcmp(ptr + i, s_end_header_cur.ptr, s_end_header_cur.len) != 0) {
+            AWS_LOGF_ERROR(AWS_LS_IO_PEM, "Invalid PEM buffer: malformed object body");
+            return aws_raise_error(AWS_ERROR_PEM_MALFORMED);
+        }
+        i += s_end_header_cur.len;
+        /* Skip the rest of the end line; the old parser never validated that the end type matches. */
+        while (i < len && ptr[i] != '\n') {
+            ++i;
+        }
+
+        struct aws_pem_object_view view = {
+            .type = s_map_type_cur_to_type(type_cur),
+            .type_string = {.ptr = arena->buffer + type_offset, .len = type_cur.len},
+            .data = {.ptr = arena->buffer + data_offset, .len = arena->len - data_offset},
+        };
+        if (aws_array_list_push_back(pem_object_views, &view)) {
+            return AWS_OP_ERR;
+        }
     }
 
-    if (aws_byte_cursor_split_on_char(&pem, '\n', &split_buffers)) {
-        aws_array_list_clean_up(&split_buffers);
-        AWS_LOGF_ERROR(AWS_LS_IO_PEM, "Invalid PEM buffer: failed to split on newline");
+    if (aws_array_list_length(pem_object_views) == 0) {
+        AWS_LOGF_ERROR(AWS_LS_IO_PEM, "Invalid PEM buffer.");
         return aws_raise_error(AWS_ERROR_PEM_MALFORMED);
     }
 
-    enum aws_pem_parse_state state = BEGIN;
-    bool on_length_calc = true;
-    size_t current_obj_len = 0;
-    size_t current_obj_start_index = 0;
-    struct aws_byte_buf current_obj_buf;
-    AWS_ZERO_STRUCT(current_obj_buf);
-    struct aws_byte_cursor current_obj_type_cur;
-    AWS_ZERO_STRUCT(current_obj_type_cur);
-    enum aws_pem_object_type current_obj_type = AWS_PEM_TYPE_UNKNOWN;
-
-    size_t split_count = aws_array_list_length(&split_buffers);
-    size_t i = 0;
+    return AWS_OP_SUCCESS;
+}
 
-    while (i < split_count) {
-        struct aws_byte_cursor *line_cur_ptr = NULL;
-        int error = aws_array_list_get_at_ptr(&split_buffers, (void **)&line_cur_ptr, i);
-        /* should never fail as we control array size and how we index into list */
-        AWS_FATAL_ASSERT(error == AWS_OP_SUCCESS);
+void aws_pem_object_views_clean_up(struct aws_array_list *pem_object_views, struct aws_byte_buf *arena) {
+    aws_array_list_clean_up(pem_object_views);
+    aws_byte_buf_clean_up_secure(arena);
+}
 
-        /* Burn off the padding in the buffer first.
-         * Worst case we'll only have to do this once per line in the buffer. */
-        *line_cur_ptr = aws_byte_cursor_left_trim_pred(line_cur_ptr, aws_isspace);
+int aws_pem_objects_init_views_from_file_contents(
+    struct aws_array_list *pem_object_views,
+    struct aws_byte_buf *arena,
+    struct aws_allocator *allocator,
+    struct aws_byte_cursor pem_cursor) {
+    AWS_PRECONDITION(allocator);
+    AWS_PRECONDITION(pem_object_views != NULL);
+    AWS_PRECONDITION(arena != NULL);
 
-        /* And make sure remove any space from right side */
-        *line_cur_ptr = aws_byte_cursor_right_trim_pred(line_cur_ptr, aws_isspace);
+    AWS_ZERO_STRUCT(*arena);
+    if (aws_array_list_init_dynamic(pem_object_views, allocator, 1, sizeof(struct aws_pem_object_view))) {
+        return AWS_OP_ERR;
+    }
 
-        switch (state) {
-            case BEGIN:
-                if (aws_byte_cursor_starts_with(line_cur_ptr, &s_begin_header_cur)) {
-                    if (s_extract_header_type_cur(*line_cur_ptr, &current_obj_type_cur)) {
-                        goto on_end_of_loop;
-                    }
-                    current_obj_type = s_map_type_cur_to_type(current_obj_type_cur);
-                    current_obj_start_index = i + 1;
-                    state = ON_DATA;
-                }
-                ++i;
-                break;
-            /* this loops through the lines containing data twice. First to figure out the length, a second
-             * time to actually copy the data. */
-            case ON_DATA:
-                /* Found end tag. */
-                if (aws_byte_cursor_starts_with(line_cur_ptr, &s_end_header_cur)) {
-                    if (on_length_calc) {
-                        on_length_calc = false;
-                        state = ON_DATA;
-                        i = current_obj_start_index;
-                        aws_byte_buf_init(&current_obj_buf, allocator, current_obj_len);
-
-                    } else {
-                        struct aws_pem_object pem_object = {
-                            .data = current_obj_buf,
-                            .type_string = aws_string_new_from_cursor(allocator, &current_obj_type_cur),
-                            .type = current_obj_type,
-                        };
-
-                        if (aws_array_list_push_back(pem_objects, &pem_object)) {
-                            goto on_end_of_loop;
-                        }
-                        state = BEGIN;
-                        on_length_calc = true;
-                        current_obj_len = 0;
-                        ++i;
-                        AWS_ZERO_STRUCT(current_obj_buf);
-                        AWS_ZERO_STRUCT(current_obj_type_cur);
-                        current_obj_type = AWS_PEM_TYPE_UNKNOWN;
-                    }
-                    /* actually on a line with data in it. */
-                } else {
-                    if (on_length_calc) {
-                        current_obj_len += line_cur_ptr->len;
-                    } else {
-                        if (aws_byte_buf_append(&current_obj_buf, line_cur_ptr)) {
-                            goto on_end_of_loop;
-                        }
-                    }
-                    ++i;
-                }
-                break;
-            default:
-                AWS_FATAL_ASSERT(false);
-        }
+    if (pem_cursor.len == 0) {
+        aws_raise_error(AWS_ERROR_PEM_MALFORMED);
+        goto on_error;
     }
 
-/*
- * Note: this function only hard error if nothing can be parsed out of file.
- * Otherwise it succeeds and returns whatever was parsed successfully.
- */
-on_end_of_loop:
-    aws_array_list_clean_up(&split_buffers);
-    aws_byte_buf_clean_up_secure(&current_obj_buf);
+    /*
+     * Type strings plus decoded payloads can never exceed the input length, so one upfront
+     * allocation covers the whole bundle; the buffer never grows, which is what keeps the
+     * views stable.
+     */
+    if (aws_byte_buf_init(arena, allocator, pem_cursor.len)) {
+        goto on_error;
+    }
 
-    if (state == BEGIN && aws_array_list_length(pem_objects) > 0) {
-        return AWS_OP_SUCCESS;
+    if (s_pem_decode_objects_to_arena(pem_cursor, arena, pem_object_views)) {
+        goto on_error;
     }
 
-    AWS_LOGF_ERROR(AWS_LS_IO_PEM, "Invalid PEM buffer.");
-    aws_pem_objects_clean_up(pem_objects);
-    return aws_raise_error(AWS_ERROR_PEM_MALFORMED);
+    return AWS_OP_SUCCESS;
+
+on_error:
+    aws_pem_object_views_clean_up(pem_object_views, arena);
+    return AWS_OP_ERR;
 }
 
 int aws_pem_objects_init_from_file_contents(
@@ -374,39 +440,42 @@ int aws_pem_objects_init_from_file_contents(
         return AWS_OP_ERR;
     }
 
-    if (s_convert_pem_to_raw_base64(allocator, pem_cursor, pem_objects)) {
-        goto on_error;
+    struct aws_array_list object_views;
+    struct aws_byte_buf arena;
+    if (aws_pem_objects_init_views_from_file_contents(&object_views, &arena, allocator, pem_cursor)) {
+        aws_pem_objects_clean_up(pem_objects);
+        return AWS_OP_ERR;
     }
 
-    for (size_t i = 0; i < aws_array_list_length(pem_objects); ++i) {
-        struct aws_pem_object *pem_obj_ptr = NULL;
-        aws_array_list_get_at_ptr(pem_objects, (void **)&pem_obj_ptr, i);
-        struct aws_byte_cursor byte_cur = aws_byte_cursor_from_buf(&pem_obj_ptr->data);
+    for (size_t i = 0; i < aws_array_list_length(&object_views); ++i) {
+        struct aws_pem_object_view *view = NULL;
+        aws_array_list_get_at_ptr(&object_views, (void **)&view, i);
 
-        size_t decoded_len = 0;
-        if (aws_base64_compute_decoded_len(&byte_cur, &decoded_len)) {
-            AWS_LOGF_ERROR(AWS_LS_IO_PEM, "Failed to get length for decoded base64 pem object.");
-            aws_raise_error(AWS_ERROR_PEM_MALFORMED);
+        struct aws_pem_object pem_object = {
+            .type = view->type,
+            .type_string = aws_string_new_from_cursor(allocator, &view->type_string),
+        };
+        if (pem_object.type_string == NULL) {
             goto on_error;
         }
 
-        struct aws_byte_buf decoded_buffer;
-        aws_byte_buf_init(&decoded_buffer, allocator, decoded_len);
-
-        if (aws_base64_decode(&byte_cur, &decoded_buffer)) {
-            AWS_LOGF_ERROR(AWS_LS_IO_PEM, "Failed to base 64 decode pem object.");
-            aws_raise_error(AWS_ERROR_PEM_MALFORMED);
-            aws_byte_buf_clean_up_secure(&decoded_buffer);
+        if (aws_byte_buf_init_copy_from_cursor(&pem_object.data, allocator, view->data)) {
+            aws_string_destroy(pem_object.type_string);
             goto on_error;
         }
 
-        aws_byte_buf_clean_up_secure(&pem_obj_ptr->data);
-        pem_obj_ptr->data = decoded_buffer;
+        if (aws_array_list_push_back(pem_objects, &pem_object)) {
+            aws_byte_buf_clean_up_secure(&pem_object.data);
+            aws_string_destroy(pem_object.type_string);
+            goto on_error;
+        }
     }
 
+    aws_pem_object_views_clean_up(&object_views, &arena);
     return AWS_OP_SUCCESS;
 
 on_error:
+    aws_pem_object_views_clean_up(&object_views, &arena);
     aws_pem_objects_clean_up(pem_objects);
     return AWS_OP_ERR;
 }
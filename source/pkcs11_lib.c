@@ -6,9 +6,12 @@
 
 #include "pkcs11_private.h"
 
+#include <aws/common/condition_variable.h>
+#include <aws/common/linked_list.h>
 #include <aws/common/mutex.h>
 #include <aws/common/ref_count.h>
 #include <aws/common/string.h>
+#include <aws/common/thread.h>
 #include <aws/io/logging.h>
 #include <aws/io/shared_library.h>
 
@@ -415,6 +418,12 @@ static CK_RV s_pkcs11_unlock_mutex(CK_VOID_PTR mutex_ptr) {
     return CKR_OK;
 }
 
+/* Number of threads servicing asynchronously submitted operations.
+ * Each in-flight operation occupies its own session, so the useful ceiling is the
+ * submitters' session-pool sizes; a handful of workers keeps a network HSM's pipe
+ * full without burning threads on a local token that answers in microseconds. */
+enum { PKCS11_ASYNC_WORKER_COUNT = 4 };
+
 struct aws_pkcs11_lib {
     struct aws_ref_count ref_count;
     struct aws_allocator *allocator;
@@ -425,6 +434,18 @@ struct aws_pkcs11_lib {
 
     /* If true, C_Finalize() should be called when last ref-count is released */
     bool finalize_on_cleanup;
+
+    /* Worker pool for aws_pkcs11_lib_submit_async_ops(). PKCS#11 has no native async
+     * interface (C_Sign etc are one blocking round trip to the token each), so pipelining
+     * is done by running queued operations on these threads, each on its own session.
+     * Threads are launched lazily on first submit; applications that never submit
+     * asynchronously pay nothing. The lock guards the fields below it. */
+    struct aws_mutex async_lock;
+    struct aws_condition_variable async_signal;
+    struct aws_linked_list async_queue; /* aws_pkcs11_async_op.node */
+    struct aws_thread async_workers[PKCS11_ASYNC_WORKER_COUNT];
+    size_t async_worker_count;
+    bool async_shutting_down;
 };
 
 /* Invoked when last ref-count is released. Free all resources.
@@ -438,6 +459,29 @@ static void s_pkcs11_lib_destroy(void *user_data) {
         (void *)pkcs11_lib,
         pkcs11_lib->finalize_on_cleanup ? "yes" : "omit");
 
+    /* Stop the async workers before C_Finalize() and the library unload below.
+     * Submitters hold a ref on the lib until their callbacks fire, so by the time the
+     * last ref drops the queue is empty; the drain below is belt-and-suspenders. */
+    if (pkcs11_lib->async_worker_count > 0) {
+        aws_mutex_lock(&pkcs11_lib->async_lock);
+        pkcs11_lib->async_shutting_down = true;
+        aws_condition_variable_notify_all(&pkcs11_lib->async_signal);
+        aws_mutex_unlock(&pkcs11_lib->async_lock);
+
+        for (size_t i = 0; i < pkcs11_lib->async_worker_count; ++i) {
+            aws_thread_join(&pkcs11_lib->async_workers[i]);
+            aws_thread_clean_up(&pkcs11_lib->async_workers[i]);
+        }
+
+        while (!aws_linked_list_empty(&pkcs11_lib->async_queue)) {
+            struct aws_linked_list_node *node = aws_linked_list_pop_front(&pkcs11_lib->async_queue);
+            struct aws_pkcs11_async_op *op = AWS_CONTAINER_OF(node, struct aws_pkcs11_async_op, node);
+            op->on_complete(op, AWS_ERROR_INVALID_STATE, NULL);
+        }
+    }
+    aws_condition_variable_clean_up(&pkcs11_lib->async_signal);
+    aws_mutex_clean_up(&pkcs11_lib->async_lock);
+
     if (pkcs11_lib->finalize_on_cleanup) {
         CK_RV rv = pkcs11_lib->function_list->C_Finalize(NULL);
         if (rv != CKR_OK) {
@@ -470,6 +514,9 @@ struct aws_pkcs11_lib *aws_pkcs11_lib_new(
     struct aws_pkcs11_lib *pkcs11_lib = aws_mem_calloc(allocator, 1, sizeof(struct aws_pkcs11_lib));
     aws_ref_count_init(&pkcs11_lib->ref_count, pkcs11_lib, s_pkcs11_lib_destroy);
     pkcs11_lib->allocator = allocator;
+    aws_mutex_init(&pkcs11_lib->async_lock);
+    aws_condition_variable_init(&pkcs11_lib->async_signal);
+    aws_linked_list_init(&pkcs11_lib->async_queue);
 
     /* Load the library. */
 
@@ -596,6 +643,84 @@ clean_up:
     return pkcs11_lib;
 }
 
+AWS_FUTURE_T_POINTER_WITH_DESTROY_IMPLEMENTATION(aws_future_pkcs11_lib, struct aws_pkcs11_lib, aws_pkcs11_lib_release)
+
+/* Owns deep copies of everything the background thread needs.
+ * The thread frees this (including the aws_thread struct, per the managed join strategy)
+ * once the future is completed. */
+struct pkcs11_lib_async_new_job {
+    struct aws_allocator *allocator;
+    struct aws_thread thread;
+    struct aws_future_pkcs11_lib *future;
+    struct aws_string *filename;
+    enum aws_pkcs11_lib_behavior initialize_finalize_behavior;
+};
+
+static void s_pkcs11_lib_async_new_thread(void *user_data) {
+    struct pkcs11_lib_async_new_job *job = user_data;
+
+    struct aws_pkcs11_lib_options options = {
+        .initialize_finalize_behavior = job->initialize_finalize_behavior,
+    };
+    if (job->filename != NULL) {
+        options.filename = aws_byte_cursor_from_string(job->filename);
+    }
+
+    struct aws_pkcs11_lib *pkcs11_lib = aws_pkcs11_lib_new(job->allocator, &options);
+    if (pkcs11_lib != NULL) {
+        aws_future_pkcs11_lib_set_result_by_move(job->future, &pkcs11_lib);
+    } else {
+        aws_future_pkcs11_lib_set_error(job->future, aws_last_error());
+    }
+
+    aws_future_pkcs11_lib_release(job->future);
+    aws_string_destroy(job->filename);
+    aws_mem_release(job->allocator, job);
+}
+
+struct aws_future_pkcs11_lib *aws_pkcs11_lib_new_async(
+    struct aws_allocator *allocator,
+    const struct aws_pkcs11_lib_options *options) {
+
+    struct aws_future_pkcs11_lib *future = aws_future_pkcs11_lib_new(allocator);
+
+    struct pkcs11_lib_async_new_job *job = aws_mem_calloc(allocator, 1, sizeof(struct pkcs11_lib_async_new_job));
+    job->allocator = allocator;
+    job->future = aws_future_pkcs11_lib_acquire(future);
+    job->initialize_finalize_behavior = options->initialize_finalize_behavior;
+    if (options->filename.ptr != NULL) {
+        job->filename = aws_string_new_from_cursor(allocator, &options->filename);
+    }
+
+    if (aws_thread_init(&job->thread, allocator)) {
+        goto error;
+    }
+
+    struct aws_thread_options thread_options = *aws_default_thread_options();
+    thread_options.join_strategy = AWS_TJS_MANAGED;
+    thread_options.name = aws_byte_cursor_from_c_str("AwsPkcs11Init"); /* 15 characters is max for Linux */
+    if (aws_thread_launch(&job->thread, s_pkcs11_lib_async_new_thread, job, &thread_options)) {
+        aws_thread_clean_up(&job->thread);
+        goto error;
+    }
+
+    return future;
+
+error:
+    AWS_LOGF_ERROR(
+        AWS_LS_IO_PKCS11,
+        "Failed to launch PKCS#11 initialization thread, error %d (%s)",
+        aws_last_error(),
+        aws_error_name(aws_last_error()));
+
+    /* complete the future here so the caller has one code path; it still owns its ref */
+    aws_future_pkcs11_lib_set_error(future, aws_last_error());
+    aws_future_pkcs11_lib_release(job->future);
+    aws_string_destroy(job->filename);
+    aws_mem_release(allocator, job);
+    return future;
+}
+
 struct aws_pkcs11_lib *aws_pkcs11_lib_acquire(struct aws_pkcs11_lib *pkcs11_lib) {
     aws_ref_count_acquire(&pkcs11_lib->ref_count);
     return pkcs11_lib;
@@ -1346,3 +1471,135 @@ int aws_pkcs11_lib_sign(
             return aws_raise_error(AWS_ERROR_PKCS11_KEY_TYPE_UNSUPPORTED);
     }
 }
+
+/* Runs one asynchronously submitted operation and invokes its completion callback. */
+static void s_pkcs11_async_op_run(struct aws_pkcs11_lib *pkcs11_lib, struct aws_pkcs11_async_op *op) {
+    struct aws_byte_buf output;
+    AWS_ZERO_STRUCT(output);
+
+    int result = AWS_OP_ERR;
+    switch (op->type) {
+        case AWS_PKCS11_ASYNC_OP_SIGN:
+            result = aws_pkcs11_lib_sign(
+                pkcs11_lib,
+                op->session_handle,
+                op->key_handle,
+                op->key_type,
+                op->input,
+                pkcs11_lib->allocator,
+                op->digest_alg,
+                op->signature_alg,
+                &output);
+            break;
+        case AWS_PKCS11_ASYNC_OP_DECRYPT:
+            result = aws_pkcs11_lib_decrypt(
+                pkcs11_lib,
+                op->session_handle,
+                op->key_handle,
+                op->key_type,
+                op->input,
+                pkcs11_lib->allocator,
+                &output);
+            break;
+        default:
+            AWS_LOGF_ERROR(
+                AWS_LS_IO_PKCS11,
+                "id=%p: Unknown async operation type %d",
+                (void *)pkcs11_lib,
+                op->type);
+            result = aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+            break;
+    }
+
+    if (result == AWS_OP_SUCCESS) {
+        op->on_complete(op, 0 /*error_code*/, &output);
+    } else {
+        op->on_complete(op, aws_last_error(), NULL);
+    }
+
+    /* decrypt output is plaintext key material; always scrub */
+    aws_byte_buf_clean_up_secure(&output);
+}
+
+static void s_pkcs11_async_worker(void *user_data) {
+    struct aws_pkcs11_lib *pkcs11_lib = user_data;
+
+    aws_mutex_lock(&pkcs11_lib->async_lock);
+    for (;;) {
+        if (!aws_linked_list_empty(&pkcs11_lib->async_queue)) {
+            struct aws_linked_list_node *node = aws_linked_list_pop_front(&pkcs11_lib->async_queue);
+            aws_mutex_unlock(&pkcs11_lib->async_lock);
+
+            struct aws_pkcs11_async_op *op = AWS_CONTAINER_OF(node, struct aws_pkcs11_async_op, node);
+            s_pkcs11_async_op_run(pkcs11_lib, op);
+
+            aws_mutex_lock(&pkcs11_lib->async_lock);
+            continue;
+        }
+
+        if (pkcs11_lib->async_shutting_down) {
+            break;
+        }
+
+        aws_condition_variable_wait(&pkcs11_lib->async_signal, &pkcs11_lib->async_lock);
+    }
+    aws_mutex_unlock(&pkcs11_lib->async_lock);
+}
+
+int aws_pkcs11_lib_submit_async_ops(
+    struct aws_pkcs11_lib *pkcs11_lib,
+    struct aws_pkcs11_async_op **ops,
+    size_t op_count) {
+
+    if (op_count == 0) {
+        return AWS_OP_SUCCESS;
+    }
+
+    aws_mutex_lock(&pkcs11_lib->async_lock);
+
+    /* Launch the workers on first use. A partial launch is still useful: even one
+     * worker drains the queue correctly, just with less parallelism. */
+    if (pkcs11_lib->async_worker_count == 0) {
+        struct aws_thread_options thread_options = *aws_default_thread_options();
+        thread_options.name = aws_byte_cursor_from_c_str("AwsPkcs11Op"); /* 15 characters is max for Linux */
+        for (size_t i = 0; i < PKCS11_ASYNC_WORKER_COUNT; ++i) {
+            struct aws_thread *worker = &pkcs11_lib->async_workers[pkcs11_lib->async_worker_count];
+            if (aws_thread_init(worker, pkcs11_lib->allocator)) {
+                break;
+            }
+            if (aws_thread_launch(worker, s_pkcs11_async_worker, pkcs11_lib, &thread_options)) {
+                aws_thread_clean_up(worker);
+                break;
+            }
+            pkcs11_lib->async_worker_count++;
+        }
+
+        if (pkcs11_lib->async_worker_count == 0) {
+            aws_mutex_unlock(&pkcs11_lib->async_lock);
+            AWS_LOGF_ERROR(
+                AWS_LS_IO_PKCS11,
+                "id=%p: Failed to launch async operation workers, error %s",
+                (void *)pkcs11_lib,
+                aws_error_name(aws_last_error()));
+            return AWS_OP_ERR;
+        }
+
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_PKCS11,
+            "id=%p: Launched %zu async operation worker(s)",
+            (void *)pkcs11_lib,
+            pkcs11_lib->async_worker_count);
+    }
+
+    for (size_t i = 0; i < op_count; ++i) {
+        aws_linked_list_push_back(&pkcs11_lib->async_queue, &ops[i]->node);
+    }
+    if (op_count == 1) {
+        aws_condition_variable_notify_one(&pkcs11_lib->async_signal);
+    } else {
+        aws_condition_variable_notify_all(&pkcs11_lib->async_signal);
+    }
+
+    aws_mutex_unlock(&pkcs11_lib->async_lock);
+    return AWS_OP_SUCCESS;
+}
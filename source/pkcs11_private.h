@@ -5,6 +5,7 @@
  * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
  * SPDX-License-Identifier: Apache-2.0.
  */
+#include <aws/common/linked_list.h>
 #include <aws/io/tls_channel_handler.h>
 
 #include "pkcs11/v2.40/pkcs11.h"
@@ -115,6 +116,54 @@ int aws_pkcs11_lib_sign(
     enum aws_tls_signature_algorithm signature_alg,
     struct aws_byte_buf *out_signature);
 
+enum aws_pkcs11_async_op_type {
+    AWS_PKCS11_ASYNC_OP_SIGN,
+    AWS_PKCS11_ASYNC_OP_DECRYPT,
+};
+
+struct aws_pkcs11_async_op;
+
+/**
+ * Invoked from a worker thread when an asynchronously submitted operation finishes.
+ * output is only valid when error_code is 0, and only for the duration of the call;
+ * copy out anything that needs to outlive it. The op struct belongs to the submitter
+ * again once this returns.
+ */
+typedef void(aws_pkcs11_async_op_complete_fn)(struct aws_pkcs11_async_op *op, int error_code, struct aws_byte_buf *output);
+
+/**
+ * One sign/decrypt request for aws_pkcs11_lib_submit_async_ops().
+ * The submitter owns the struct and must keep it (and the memory input points into)
+ * alive until on_complete fires. Each op needs its own session: sessions may only be
+ * used by one thread at a time, and queued ops run concurrently.
+ */
+struct aws_pkcs11_async_op {
+    enum aws_pkcs11_async_op_type type;
+    CK_SESSION_HANDLE session_handle;
+    CK_OBJECT_HANDLE key_handle;
+    CK_KEY_TYPE key_type;
+    struct aws_byte_cursor input;
+
+    /* sign-only, ignored for decrypt */
+    enum aws_tls_hash_algorithm digest_alg;
+    enum aws_tls_signature_algorithm signature_alg;
+
+    aws_pkcs11_async_op_complete_fn *on_complete;
+    void *user_data;
+
+    /* used by the implementation while the op is queued, don't touch */
+    struct aws_linked_list_node node;
+};
+
+/**
+ * Queue up a batch of sign/decrypt operations to run on the library's worker threads,
+ * completing each via its on_complete callback. Keeps multiple requests in flight on
+ * the token at once, so bursts (ex: TLS handshake storms against a network HSM) are
+ * limited by the token's throughput rather than per-call round-trip latency.
+ */
+AWS_IO_API
+int aws_pkcs11_lib_submit_async_ops(struct aws_pkcs11_lib *pkcs11_lib, struct aws_pkcs11_async_op **ops, size_t op_count);
+
 /**
  * Get the DER encoded DigestInfo value to be prefixed to the hash, used for RSA signing
  * See https://tools.ietf.org/html/rfc3447#page-43
@@ -144,7 +193,8 @@ struct aws_custom_key_op_handler *aws_pkcs11_tls_op_handler_new(
     const struct aws_byte_cursor *user_pin,
     const struct aws_byte_cursor *match_token_label,
     const struct aws_byte_cursor *match_private_key_label,
-    const uint64_t *match_slot_id);
+    const uint64_t *match_slot_id,
+    size_t max_sessions);
 
 AWS_EXTERN_C_END
 #endif /* AWS_IO_PKCS11_PRIVATE_H */
@@ -6,10 +6,18 @@
 
 #include "pkcs11_private.h"
 
+#include <aws/common/condition_variable.h>
 #include <aws/common/mutex.h>
 #include <aws/common/string.h>
 #include <aws/io/logging.h>
 
+/* An idle session, together with the private key's handle within it.
+ * Object handles are not guaranteed to be identical across sessions, so the key is looked up per session. */
+struct aws_pkcs11_session_pool_entry {
+    CK_SESSION_HANDLE session_handle;
+    CK_OBJECT_HANDLE private_key_handle;
+};
+
 struct aws_pkcs11_tls_op_handler {
     /* The custom key operation handler needed for the callbacks */
     struct aws_custom_key_op_handler base;
@@ -17,105 +25,236 @@ struct aws_pkcs11_tls_op_handler {
     struct aws_allocator *alloc;
     struct aws_pkcs11_lib *lib;
 
-    /* Use a single PKCS#11 session for all TLS connections on an aws_tls_ctx.
-     * We do this because PKCS#11 tokens may only support a
-     * limited number of sessions (PKCS11-UG-v2.40 section 2.6.7).
-     * If this one shared session turns out to be a severe bottleneck,
-     * we could look into other setups (ex: put session on its own thread,
-     * 1 session per event-loop, 1 session per connection, etc).
+    /* Pool of PKCS#11 sessions shared by all TLS connections on an aws_tls_ctx.
+     * A session may only be used by one thread at a time (PKCS11-UG-v2.40 section 2.6.7),
+     * so each operation checks a session out, uses it without holding any lock, and checks
+     * it back in. The pool is bounded because tokens may only support a limited number of
+     * sessions; once every session is checked out, further operations wait on session_signal.
+     * Sessions are opened lazily, up to max_sessions, so a pool limit higher than the
+     * token's actual capacity degrades to whatever the token grants us.
      *
-     * The lock must be held while performing session operations.
-     * Otherwise, it would not be safe for multiple threads to share a
-     * session (PKCS11-UG-v2.40 section 2.6.7). The lock isn't needed for
-     * setup and teardown though, since we ensure nothing parallel is going
-     * on at these times */
+     * The lock guards the fields below it. Setup and teardown don't need it, since we
+     * ensure nothing parallel is going on at those times. */
     struct aws_mutex session_lock;
-    CK_SESSION_HANDLE session_handle;
-    CK_OBJECT_HANDLE private_key_handle;
+    struct aws_condition_variable session_signal;
+    struct aws_pkcs11_session_pool_entry *idle_sessions; /* array of max_sessions entries, used LIFO */
+    size_t idle_session_count;
+    size_t open_session_count;
+    size_t max_sessions;
+
+    CK_SLOT_ID slot_id;
     CK_KEY_TYPE private_key_type;
+    /* retained so the private key can be located in lazily opened sessions */
+    struct aws_string *private_key_object_label;
 };
 
 static void s_aws_custom_key_op_handler_destroy(struct aws_custom_key_op_handler *key_op_handler) {
 
     struct aws_pkcs11_tls_op_handler *handler = (struct aws_pkcs11_tls_op_handler *)key_op_handler->impl;
 
-    if (handler->session_handle != 0) {
-        aws_pkcs11_lib_close_session(handler->lib, handler->session_handle);
+    /* by the time the last reference drops, no operations are in flight, so every open session is idle */
+    for (size_t i = 0; i < handler->idle_session_count; ++i) {
+        aws_pkcs11_lib_close_session(handler->lib, handler->idle_sessions[i].session_handle);
     }
+    aws_mem_release(handler->alloc, handler->idle_sessions);
+    aws_string_destroy(handler->private_key_object_label);
+    aws_condition_variable_clean_up(&handler->session_signal);
     aws_mutex_clean_up(&handler->session_lock);
     aws_pkcs11_lib_release(handler->lib);
 
     aws_mem_release(handler->alloc, handler);
 }
 
+/*
+ * Checks a session out of the pool, opening a new one if every open session is busy and the pool
+ * hasn't reached max_sessions yet. Blocks until a session frees up when the pool is exhausted.
+ */
+static int s_session_checkout(
+    struct aws_pkcs11_tls_op_handler *handler,
+    struct aws_pkcs11_session_pool_entry *out_entry) {
+
+    int result = AWS_OP_ERR;
+
+    aws_mutex_lock(&handler->session_lock);
+
+    for (;;) {
+        if (handler->idle_session_count > 0) {
+            *out_entry = handler->idle_sessions[--handler->idle_session_count];
+            result = AWS_OP_SUCCESS;
+            break;
+        }
+
+        if (handler->open_session_count < handler->max_sessions) {
+            struct aws_pkcs11_session_pool_entry entry;
+            CK_KEY_TYPE key_type = 0;
+            if (aws_pkcs11_lib_open_session(handler->lib, handler->slot_id, &entry.session_handle) == AWS_OP_SUCCESS) {
+                if (aws_pkcs11_lib_find_private_key(
+                        handler->lib,
+                        entry.session_handle,
+                        handler->private_key_object_label,
+                        &entry.private_key_handle /*out*/,
+                        &key_type /*out*/) == AWS_OP_SUCCESS) {
+
+                    handler->open_session_count++;
+                    *out_entry = entry;
+                    result = AWS_OP_SUCCESS;
+                    break;
+                }
+                aws_pkcs11_lib_close_session(handler->lib, entry.session_handle);
+            }
+
+            if (handler->open_session_count == 0) {
+                /* not even one session could be opened; nothing to wait for */
+                break;
+            }
+
+            /* the token granted fewer sessions than requested; settle for what we have */
+            AWS_LOGF_WARN(
+                AWS_LS_IO_PKCS11,
+                "PKCS11 Handler %p: failed to grow session pool past %zu sessions, error %s. "
+                "Operations will share the existing sessions.",
+                (void *)handler,
+                handler->open_session_count,
+                aws_error_name(aws_last_error()));
+            handler->max_sessions = handler->open_session_count;
+            continue;
+        }
+
+        aws_condition_variable_wait(&handler->session_signal, &handler->session_lock);
+    }
+
+    aws_mutex_unlock(&handler->session_lock);
+    return result;
+}
+
+static void s_session_checkin(struct aws_pkcs11_tls_op_handler *handler, struct aws_pkcs11_session_pool_entry entry) {
+    aws_mutex_lock(&handler->session_lock);
+    handler->idle_sessions[handler->idle_session_count++] = entry;
+    aws_condition_variable_notify_one(&handler->session_signal);
+    aws_mutex_unlock(&handler->session_lock);
+}
+
+/* Heap context for one in-flight TLS key operation, alive from submission until completion. */
+struct pkcs11_tls_op_context {
+    struct aws_pkcs11_tls_op_handler *pkcs11_handler;
+    struct aws_tls_key_operation *operation;
+    struct aws_pkcs11_session_pool_entry session_entry;
+    bool retried_stale_key_handle;
+    struct aws_pkcs11_async_op async_op;
+};
+
+/* Checks the session back in, completes the TLS operation, and frees the context.
+ * Runs on a lib worker thread, or on the submitting thread if submission itself failed. */
+static void s_tls_op_context_finish(struct pkcs11_tls_op_context *op_context, int error_code, struct aws_byte_buf *output) {
+    struct aws_pkcs11_tls_op_handler *pkcs11_handler = op_context->pkcs11_handler;
+
+    /* the entry carries any re-resolved key handle back into the pool */
+    s_session_checkin(pkcs11_handler, op_context->session_entry);
+
+    if (error_code == 0) {
+        aws_tls_key_operation_complete(op_context->operation, aws_byte_cursor_from_buf(output));
+    } else {
+        aws_tls_key_operation_complete_with_error(op_context->operation, error_code);
+    }
+
+    aws_mem_release(pkcs11_handler->alloc, op_context);
+    aws_custom_key_op_handler_release(&pkcs11_handler->base);
+}
+
+static void s_on_pkcs11_async_op_complete(struct aws_pkcs11_async_op *op, int error_code, struct aws_byte_buf *output) {
+    struct pkcs11_tls_op_context *op_context = op->user_data;
+    struct aws_pkcs11_tls_op_handler *pkcs11_handler = op_context->pkcs11_handler;
+
+    /* The cached key handle can go stale if the token invalidated it (ex: network HSM failover).
+     * Re-resolve the handle once and resubmit, rather than failing the handshake. */
+    if (error_code == AWS_ERROR_PKCS11_CKR_OBJECT_HANDLE_INVALID && !op_context->retried_stale_key_handle) {
+        AWS_LOGF_WARN(
+            AWS_LS_IO_PKCS11,
+            "PKCS11 Handler %p: cached private key handle is no longer valid, re-resolving and retrying",
+            (void *)pkcs11_handler);
+
+        CK_KEY_TYPE key_type = 0;
+        if (aws_pkcs11_lib_find_private_key(
+                pkcs11_handler->lib,
+                op_context->session_entry.session_handle,
+                pkcs11_handler->private_key_object_label,
+                &op_context->session_entry.private_key_handle /*out*/,
+                &key_type /*out*/) == AWS_OP_SUCCESS) {
+
+            op_context->retried_stale_key_handle = true;
+            op->key_handle = op_context->session_entry.private_key_handle;
+            if (aws_pkcs11_lib_submit_async_ops(pkcs11_handler->lib, &op, 1) == AWS_OP_SUCCESS) {
+                return;
+            }
+        }
+        error_code = aws_last_error();
+    }
+
+    s_tls_op_context_finish(op_context, error_code, output);
+}
+
 /**
- * Performs the PKCS11 TLS private key operation. This is called automatically when performing a mutual TLS handshake.
+ * Queues the PKCS11 TLS private key operation on the library's worker threads and returns
+ * without blocking on the token; the operation is completed from a worker as the token
+ * responds. This is called automatically when performing a mutual TLS handshake, and
+ * handshake bursts stay limited by the token's throughput rather than per-operation
+ * round-trip latency.
  */
 void s_aws_pkcs11_tls_op_handler_do_operation(
     struct aws_custom_key_op_handler *handler,
     struct aws_tls_key_operation *operation) {
 
     struct aws_pkcs11_tls_op_handler *pkcs11_handler = (struct aws_pkcs11_tls_op_handler *)handler->impl;
-    struct aws_byte_buf output_buf; /* initialized later */
-    AWS_ZERO_STRUCT(output_buf);
-
-    /*********** BEGIN CRITICAL SECTION ***********/
-    aws_mutex_lock(&pkcs11_handler->session_lock);
-    bool success_while_locked = false;
 
+    enum aws_pkcs11_async_op_type op_type;
     switch (aws_tls_key_operation_get_type(operation)) {
-        case AWS_TLS_KEY_OPERATION_DECRYPT:
-            if (aws_pkcs11_lib_decrypt(
-                    pkcs11_handler->lib,
-                    pkcs11_handler->session_handle,
-                    pkcs11_handler->private_key_handle,
-                    pkcs11_handler->private_key_type,
-                    aws_tls_key_operation_get_input(operation),
-                    pkcs11_handler->alloc,
-                    &output_buf)) {
-
-                goto unlock;
-            }
-            break;
-
         case AWS_TLS_KEY_OPERATION_SIGN:
-            if (aws_pkcs11_lib_sign(
-                    pkcs11_handler->lib,
-                    pkcs11_handler->session_handle,
-                    pkcs11_handler->private_key_handle,
-                    pkcs11_handler->private_key_type,
-                    aws_tls_key_operation_get_input(operation),
-                    pkcs11_handler->alloc,
-                    aws_tls_key_operation_get_digest_algorithm(operation),
-                    aws_tls_key_operation_get_signature_algorithm(operation),
-                    &output_buf)) {
-
-                goto unlock;
-            }
+            op_type = AWS_PKCS11_ASYNC_OP_SIGN;
+            break;
+        case AWS_TLS_KEY_OPERATION_DECRYPT:
+            op_type = AWS_PKCS11_ASYNC_OP_DECRYPT;
             break;
-
         default:
             AWS_LOGF_ERROR(
                 AWS_LS_IO_PKCS11,
                 "PKCS11 Handler %p: Unknown TLS key operation with value of %u",
-                (void *)handler,
+                (void *)pkcs11_handler,
                 aws_tls_key_operation_get_type(operation));
-            aws_raise_error(AWS_ERROR_INVALID_STATE);
-            goto unlock;
+            aws_tls_key_operation_complete_with_error(operation, AWS_ERROR_INVALID_STATE);
+            return;
     }
 
-    success_while_locked = true;
-unlock:
-    aws_mutex_unlock(&pkcs11_handler->session_lock);
-    /*********** END CRITICAL SECTION ***********/
-
-    if (success_while_locked) {
-        aws_tls_key_operation_complete(operation, aws_byte_cursor_from_buf(&output_buf));
-    } else {
+    /* each operation runs on its own checked-out session, so concurrent handshakes
+     * execute in parallel up to the pool's limit */
+    struct aws_pkcs11_session_pool_entry session_entry;
+    if (s_session_checkout(pkcs11_handler, &session_entry)) {
         aws_tls_key_operation_complete_with_error(operation, aws_last_error());
+        return;
     }
 
-    aws_byte_buf_clean_up(&output_buf);
+    struct pkcs11_tls_op_context *op_context =
+        aws_mem_calloc(pkcs11_handler->alloc, 1, sizeof(struct pkcs11_tls_op_context));
+    op_context->pkcs11_handler = pkcs11_handler;
+    op_context->operation = operation;
+    op_context->session_entry = session_entry;
+    op_context->async_op.type = op_type;
+    op_context->async_op.session_handle = session_entry.session_handle;
+    op_context->async_op.key_handle = session_entry.private_key_handle;
+    op_context->async_op.key_type = pkcs11_handler->private_key_type;
+    /* the input cursor stays valid until the operation is completed */
+    op_context->async_op.input = aws_tls_key_operation_get_input(operation);
+    op_context->async_op.digest_alg = aws_tls_key_operation_get_digest_algorithm(operation);
+    op_context->async_op.signature_alg = aws_tls_key_operation_get_signature_algorithm(operation);
+    op_context->async_op.on_complete = s_on_pkcs11_async_op_complete;
+    op_context->async_op.user_data = op_context;
+
+    /* keep the handler (and through it the pkcs11_lib) alive until the callback fires */
+    aws_custom_key_op_handler_acquire(handler);
+
+    struct aws_pkcs11_async_op *op = &op_context->async_op;
+    if (aws_pkcs11_lib_submit_async_ops(pkcs11_handler->lib, &op, 1)) {
+        s_tls_op_context_finish(op_context, aws_last_error(), NULL);
+    }
 }
 
 static struct aws_custom_key_op_handler_vtable s_aws_custom_key_op_handler_vtable = {
@@ -128,7 +267,8 @@ struct aws_custom_key_op_handler *aws_pkcs11_tls_op_handler_new(
     const struct aws_byte_cursor *user_pin,
     const struct aws_byte_cursor *match_token_label,
     const struct aws_byte_cursor *match_private_key_label,
-    const uint64_t *match_slot_id) {
+    const uint64_t *match_slot_id,
+    size_t max_sessions) {
 
     bool success = false;
 
@@ -158,6 +298,11 @@ struct aws_custom_key_op_handler *aws_pkcs11_tls_op_handler_new(
     }
     pkcs11_handler->lib = aws_pkcs11_lib_acquire(pkcs11_lib); /* cannot fail */
     aws_mutex_init(&pkcs11_handler->session_lock);
+    aws_condition_variable_init(&pkcs11_handler->session_signal);
+
+    pkcs11_handler->max_sessions = max_sessions > 0 ? max_sessions : 1;
+    pkcs11_handler->idle_sessions = aws_mem_calloc(
+        allocator, pkcs11_handler->max_sessions, sizeof(struct aws_pkcs11_session_pool_entry));
 
     /* user_pin is optional */
     if (user_pin->ptr != NULL) {
@@ -174,24 +319,33 @@ struct aws_custom_key_op_handler *aws_pkcs11_tls_op_handler_new(
         pkcs_private_key_object_label = aws_string_new_from_cursor(allocator, match_private_key_label);
     }
 
-    CK_SLOT_ID slot_id;
-    if (aws_pkcs11_lib_find_slot_with_token(pkcs11_handler->lib, match_slot_id, pkcs_token_label, &slot_id /*out*/)) {
+    /* the label is retained so lazily opened pool sessions can locate the key again */
+    pkcs11_handler->private_key_object_label = pkcs_private_key_object_label;
+    pkcs_private_key_object_label = NULL;
+
+    if (aws_pkcs11_lib_find_slot_with_token(
+            pkcs11_handler->lib, match_slot_id, pkcs_token_label, &pkcs11_handler->slot_id /*out*/)) {
         goto done;
     }
 
-    if (aws_pkcs11_lib_open_session(pkcs11_handler->lib, slot_id, &pkcs11_handler->session_handle)) {
+    /* Open the pool's first session eagerly: logging in through it applies to every other session this
+     * application opens with the token (PKCS11-UG-v2.40 section 2.6.8), including ones opened later. */
+    struct aws_pkcs11_session_pool_entry *first_entry = &pkcs11_handler->idle_sessions[0];
+    if (aws_pkcs11_lib_open_session(pkcs11_handler->lib, pkcs11_handler->slot_id, &first_entry->session_handle)) {
         goto done;
     }
+    pkcs11_handler->open_session_count = 1;
+    pkcs11_handler->idle_session_count = 1;
 
-    if (aws_pkcs11_lib_login_user(pkcs11_handler->lib, pkcs11_handler->session_handle, pkcs_user_pin)) {
+    if (aws_pkcs11_lib_login_user(pkcs11_handler->lib, first_entry->session_handle, pkcs_user_pin)) {
         goto done;
     }
 
     if (aws_pkcs11_lib_find_private_key(
             pkcs11_handler->lib,
-            pkcs11_handler->session_handle,
-            pkcs_private_key_object_label,
-            &pkcs11_handler->private_key_handle /*out*/,
+            first_entry->session_handle,
+            pkcs11_handler->private_key_object_label,
+            &first_entry->private_key_handle /*out*/,
             &pkcs11_handler->private_key_type /*out*/)) {
         goto done;
     }
@@ -206,9 +360,6 @@ done:
     if (pkcs_token_label != NULL) {
         aws_string_destroy(pkcs_token_label);
     }
-    if (pkcs_private_key_object_label != NULL) {
-        aws_string_destroy(pkcs_private_key_object_label);
-    }
 
     if (success) {
         return &pkcs11_handler->base;
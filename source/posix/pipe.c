@@ -20,8 +20,12 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
+/* Max buffers handed to one writev() call; requests with more loop through in chunks. */
+enum { MAX_WRITEV_BUFFERS = 16 };
+
 /* This isn't defined on ancient linux distros (breaking the builds).
  * However, if this is a prebuild, we purposely build on an ancient system, but
  * we want the kernel calls to still be the same as a modern build since that's likely the target of the application
@@ -51,9 +55,17 @@ struct pipe_write_request {
     struct aws_byte_cursor cursor; /* tracks progress of write */
     size_t num_bytes_written;
     aws_pipe_on_write_completed_fn *user_callback;
+    /* Set instead of user_callback for aws_pipe_write_multiple() requests. */
+    aws_pipe_on_write_multiple_completed_fn *user_multiple_callback;
     void *user_data;
     struct aws_linked_list_node list_node;
 
+    /* For vectored requests: all buffers, allocated along with the request. `cursor` tracks
+     * progress through cursors[cursor_index]; single-buffer requests leave this NULL. */
+    struct aws_byte_cursor *cursors;
+    size_t cursor_count;
+    size_t cursor_index;
+
     /* True if the write-end is cleaned up while the user callback is being invoked */
     bool did_user_callback_clean_up_write_end;
 };
@@ -424,6 +436,9 @@ static bool s_write_end_complete_front_write_request(struct aws_pipe_write_end *
     if (request->user_callback) {
         request->user_callback(write_end, error_code, request->original_cursor, request->user_data);
         write_end_cleaned_up_during_callback = request->did_user_callback_clean_up_write_end;
+    } else if (request->user_multiple_callback) {
+        request->user_multiple_callback(write_end, error_code, request->user_data);
+        write_end_cleaned_up_during_callback = request->did_user_callback_clean_up_write_end;
     }
 
     if (!write_end_cleaned_up_during_callback) {
@@ -435,6 +450,61 @@ static bool s_write_end_complete_front_write_request(struct aws_pipe_write_end *
     return write_end_cleaned_up_during_callback;
 }
 
+/* True if the request has unwritten bytes remaining. */
+static bool s_write_request_has_remaining_data(const struct pipe_write_request *request) {
+    if (request->cursor.len > 0) {
+        return true;
+    }
+    return request->cursors != NULL && request->cursor_index + 1 < request->cursor_count;
+}
+
+/* Issue one write() or writev() for the request. On success, advances the request's progress and
+ * returns the number of bytes written; on failure returns -1 with errno set. */
+static ssize_t s_write_request_flush_once(struct write_end_impl *write_impl, struct pipe_write_request *request) {
+    ssize_t write_val;
+
+    if (request->cursors == NULL) {
+        write_val = write(write_impl->handle.data.fd, request->cursor.ptr, request->cursor.len);
+    } else {
+        /* Gather the current cursor's remainder plus as many following buffers as fit. */
+        struct iovec iov[MAX_WRITEV_BUFFERS];
+        int iov_count = 0;
+        iov[iov_count].iov_base = request->cursor.ptr;
+        iov[iov_count].iov_len = request->cursor.len;
+        ++iov_count;
+        for (size_t i = request->cursor_index + 1; i < request->cursor_count && iov_count < MAX_WRITEV_BUFFERS; ++i) {
+            iov[iov_count].iov_base = request->cursors[i].ptr;
+            iov[iov_count].iov_len = request->cursors[i].len;
+            ++iov_count;
+        }
+
+        write_val = writev(write_impl->handle.data.fd, iov, iov_count);
+    }
+
+    if (write_val < 0) {
+        return write_val;
+    }
+
+    size_t remaining = (size_t)write_val;
+    while (remaining > 0 || (request->cursor.len == 0 && request->cursors != NULL &&
+                             request->cursor_index + 1 < request->cursor_count)) {
+        if (request->cursor.len == 0) {
+            ++request->cursor_index;
+            request->cursor = request->cursors[request->cursor_index];
+            continue;
+        }
+        size_t advance = aws_min_size(remaining, request->cursor.len);
+        if (advance == 0) {
+            break;
+        }
+        aws_byte_cursor_advance(&request->cursor, advance);
+        remaining -= advance;
+    }
+    request->num_bytes_written += (size_t)write_val;
+
+    return write_val;
+}
+
 /* Process write requests as long as the pipe remains writable */
 static void s_write_end_process_requests(struct aws_pipe_write_end *write_end) {
     struct write_end_impl *write_impl = write_end->impl_data;
@@ -446,8 +516,8 @@ static void s_write_end_process_requests(struct aws_pipe_write_end *write_end) {
 
         int completed_error_code = AWS_ERROR_SUCCESS;
 
-        if (request->cursor.len > 0) {
-            ssize_t write_val = write(write_impl->handle.data.fd, request->cursor.ptr, request->cursor.len);
+        if (s_write_request_has_remaining_data(request)) {
+            ssize_t write_val = s_write_request_flush_once(write_impl, request);
 
             if (write_val < 0) {
                 int errno_value = errno; /* Always cache errno before potential side-effect */
@@ -460,13 +530,9 @@ static void s_write_end_process_requests(struct aws_pipe_write_end *write_end) {
                 /* A non-recoverable error occurred during this write */
                 completed_error_code = s_translate_posix_error(errno_value);
 
-            } else {
-                aws_byte_cursor_advance(&request->cursor, write_val);
-
-                if (request->cursor.len > 0) {
-                    /* There was a partial write, loop again to try and write the rest. */
-                    continue;
-                }
+            } else if (s_write_request_has_remaining_data(request)) {
+                /* There was a partial write, loop again to try and write the rest. */
+                continue;
             }
         }
 
@@ -545,6 +611,188 @@ int aws_pipe_write(
     return AWS_OP_SUCCESS;
 }
 
+int aws_pipe_write_multiple(
+    struct aws_pipe_write_end *write_end,
+    const struct aws_byte_cursor *buffers,
+    size_t buffer_count,
+    aws_pipe_on_write_multiple_completed_fn *on_completed,
+    void *user_data) {
+
+    AWS_ASSERT(buffers);
+
+    struct write_end_impl *write_impl = write_end->impl_data;
+    if (!write_impl) {
+        return aws_raise_error(AWS_IO_BROKEN_PIPE);
+    }
+
+    if (!aws_event_loop_thread_is_callers_thread(write_impl->event_loop)) {
+        return aws_raise_error(AWS_ERROR_IO_EVENT_LOOP_THREAD_ONLY);
+    }
+
+    if (buffer_count == 0) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    struct pipe_write_request *request = NULL;
+    struct aws_byte_cursor *cursors = NULL;
+    if (aws_mem_acquire_many(
+            write_impl->alloc,
+            2,
+            &request,
+            sizeof(struct pipe_write_request),
+            &cursors,
+            buffer_count * sizeof(struct aws_byte_cursor)) == NULL) {
+        return AWS_OP_ERR;
+    }
+    AWS_ZERO_STRUCT(*request);
+
+    memcpy(cursors, buffers, buffer_count * sizeof(struct aws_byte_cursor));
+    request->cursors = cursors;
+    request->cursor_count = buffer_count;
+    request->cursor = cursors[0];
+    request->user_multiple_callback = on_completed;
+    request->user_data = user_data;
+
+    aws_linked_list_push_back(&write_impl->write_list, &request->list_node);
+
+    if (write_impl->is_writable && !write_impl->currently_invoking_write_callback) {
+        s_write_end_process_requests(write_end);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+#if defined(__linux__)
+
+static int s_pipe_splice_nonblocking(int src_fd, int dst_fd, size_t max_bytes, size_t *out_bytes_spliced) {
+    *out_bytes_spliced = 0;
+
+    ssize_t spliced = splice(src_fd, NULL, dst_fd, NULL, max_bytes, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+    if (spliced < 0) {
+        int errno_value = errno; /* Always cache errno before potential side-effect */
+        if (errno_value == EAGAIN || errno_value == EWOULDBLOCK) {
+            return aws_raise_error(AWS_IO_READ_WOULD_BLOCK);
+        }
+        return s_raise_posix_error(errno_value);
+    }
+
+    *out_bytes_spliced = (size_t)spliced;
+    return AWS_OP_SUCCESS;
+}
+
+int aws_pipe_splice_from_fd(
+    struct aws_pipe_write_end *write_end,
+    int source_fd,
+    size_t max_bytes,
+    size_t *out_bytes_spliced) {
+
+    struct write_end_impl *write_impl = write_end->impl_data;
+    if (!write_impl) {
+        return aws_raise_error(AWS_IO_BROKEN_PIPE);
+    }
+
+    if (!aws_event_loop_thread_is_callers_thread(write_impl->event_loop)) {
+        return aws_raise_error(AWS_ERROR_IO_EVENT_LOOP_THREAD_ONLY);
+    }
+
+    /* Spliced bytes would jump the queue ahead of buffered writes and corrupt the stream order. */
+    if (!aws_linked_list_empty(&write_impl->write_list)) {
+        return aws_raise_error(AWS_ERROR_INVALID_STATE);
+    }
+
+    return s_pipe_splice_nonblocking(source_fd, write_impl->handle.data.fd, max_bytes, out_bytes_spliced);
+}
+
+int aws_pipe_splice_to_fd(
+    struct aws_pipe_read_end *read_end,
+    int destination_fd,
+    size_t max_bytes,
+    size_t *out_bytes_spliced) {
+
+    struct read_end_impl *read_impl = read_end->impl_data;
+    if (!read_impl) {
+        return aws_raise_error(AWS_IO_BROKEN_PIPE);
+    }
+
+    if (!aws_event_loop_thread_is_callers_thread(read_impl->event_loop)) {
+        return aws_raise_error(AWS_ERROR_IO_EVENT_LOOP_THREAD_ONLY);
+    }
+
+    return s_pipe_splice_nonblocking(read_impl->handle.data.fd, destination_fd, max_bytes, out_bytes_spliced);
+}
+
+int aws_pipe_tee(
+    struct aws_pipe_read_end *from,
+    struct aws_pipe_write_end *to,
+    size_t max_bytes,
+    size_t *out_bytes_teed) {
+
+    *out_bytes_teed = 0;
+
+    struct read_end_impl *read_impl = from->impl_data;
+    struct write_end_impl *write_impl = to->impl_data;
+    if (!read_impl || !write_impl) {
+        return aws_raise_error(AWS_IO_BROKEN_PIPE);
+    }
+
+    if (!aws_event_loop_thread_is_callers_thread(read_impl->event_loop) ||
+        !aws_event_loop_thread_is_callers_thread(write_impl->event_loop)) {
+        return aws_raise_error(AWS_ERROR_IO_EVENT_LOOP_THREAD_ONLY);
+    }
+
+    if (!aws_linked_list_empty(&write_impl->write_list)) {
+        return aws_raise_error(AWS_ERROR_INVALID_STATE);
+    }
+
+    ssize_t teed = tee(read_impl->handle.data.fd, write_impl->handle.data.fd, max_bytes, SPLICE_F_NONBLOCK);
+    if (teed < 0) {
+        int errno_value = errno; /* Always cache errno before potential side-effect */
+        if (errno_value == EAGAIN || errno_value == EWOULDBLOCK) {
+            return aws_raise_error(AWS_IO_READ_WOULD_BLOCK);
+        }
+        return s_raise_posix_error(errno_value);
+    }
+
+    *out_bytes_teed = (size_t)teed;
+    return AWS_OP_SUCCESS;
+}
+
+#else /* !__linux__ */
+
+int aws_pipe_splice_from_fd(
+    struct aws_pipe_write_end *write_end,
+    int source_fd,
+    size_t max_bytes,
+    size_t *out_bytes_spliced) {
+    (void)write_end;
+    (void)source_fd;
+    (void)max_bytes;
+    *out_bytes_spliced = 0;
+    return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+}
+
+int aws_pipe_splice_to_fd(
+    struct aws_pipe_read_end *read_end,
+    int destination_fd,
+    size_t max_bytes,
+    size_t *out_bytes_spliced) {
+    (void)read_end;
+    (void)destination_fd;
+    (void)max_bytes;
+    *out_bytes_spliced = 0;
+    return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+}
+
+int aws_pipe_tee(struct aws_pipe_read_end *from, struct aws_pipe_write_end *to, size_t max_bytes, size_t *out_bytes_teed) {
+    (void)from;
+    (void)to;
+    (void)max_bytes;
+    *out_bytes_teed = 0;
+    return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+}
+
+#endif /* __linux__ */
+
 int aws_pipe_clean_up_write_end(struct aws_pipe_write_end *write_end) {
     struct write_end_impl *write_impl = write_end->impl_data;
     if (!write_impl) {
@@ -576,6 +824,8 @@ int aws_pipe_clean_up_write_end(struct aws_pipe_write_end *write_end) {
         struct pipe_write_request *request = AWS_CONTAINER_OF(node, struct pipe_write_request, list_node);
         if (request->user_callback) {
             request->user_callback(NULL, AWS_IO_BROKEN_PIPE, request->original_cursor, request->user_data);
+        } else if (request->user_multiple_callback) {
+            request->user_multiple_callback(NULL, AWS_IO_BROKEN_PIPE, request->user_data);
         }
         aws_mem_release(write_impl->alloc, request);
     }
@@ -13,17 +13,26 @@
 
 #include <aws/io/event_loop.h>
 #include <aws/io/logging.h>
+#include <aws/io/private/tracing.h>
 
 #include <arpa/inet.h>
 #include <aws/io/io.h>
 #include <errno.h>
 #include <fcntl.h>
 #include <inttypes.h>
+#include <limits.h>
 #include <netinet/tcp.h>
+#include <netinet/udp.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
+#if defined(__linux__)
+#    include <linux/sockios.h>
+#    include <sys/ioctl.h>
+#endif
+
 /*
  * On OsX, suppress NoPipe signals via flags to setsockopt()
  * On Linux, suppress NoPipe signals via flags to send()
@@ -46,12 +55,57 @@
 #    define O_CLOEXEC 02000000
 #endif
 
+/* TCP_FASTOPEN_CONNECT (kernel 4.11+) postdates several sysroots we prebuild on; same reasoning
+ * as O_CLOEXEC above, the kernel only cares about the value. */
+#if defined(__linux__) && !defined(TCP_FASTOPEN_CONNECT)
+#    define TCP_FASTOPEN_CONNECT 30
+#endif
+
+enum {
+    /* cap on iovecs gathered into one sendmsg() when flushing the write queue; bounded by IOV_MAX
+     * at the call site, this just keeps the stack array small */
+    AWS_SOCKET_WRITEV_BATCH_SIZE = 64,
+    /* cap on datagrams moved per recvmmsg()/sendmmsg() call; keeps the stack arrays small */
+    AWS_SOCKET_DGRAM_BATCH_SIZE = 64,
+    /* cap on connections accepted per pass over a listening socket; the remainder is picked up
+     * by a task on the same loop so one busy listener can't starve everything else sharing it */
+    AWS_SOCKET_ACCEPT_BATCH_SIZE = 64,
+};
+
+/* MSG_ZEROCOPY only pays for itself on large sends; pinning pages and processing the error-queue
+ * notification costs more than a copy for small ones. Threshold per the kernel docs' guidance. */
+#if defined(__linux__) && defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+#    include <linux/errqueue.h>
+#    define AWS_SOCKET_HAVE_MSG_ZEROCOPY 1
+enum {
+    AWS_SOCKET_ZEROCOPY_MIN_SEND_BYTES = 16 * 1024,
+};
+#else
+#    define AWS_SOCKET_HAVE_MSG_ZEROCOPY 0
+#endif
+
+/* Zero-copy file-to-socket transmit. Linux and Apple both provide sendfile(), with different
+ * signatures; platforms without it refuse aws_socket_write_file_region() and callers fall back
+ * to streamed reads through aws_socket_write(). */
+#if defined(__linux__)
+#    include <sys/sendfile.h>
+#    define AWS_SOCKET_HAVE_SENDFILE 1
+#elif defined(__MACH__)
+#    define AWS_SOCKET_HAVE_SENDFILE 1
+#else
+#    define AWS_SOCKET_HAVE_SENDFILE 0
+#endif
+
 #ifdef USE_VSOCK
 #    if defined(__linux__) && defined(AF_VSOCK)
 #        include <linux/vm_sockets.h>
 #    else
 #        error "USE_VSOCK not supported on current platform"
 #    endif
+
+/* Credit window applied to vsock sockets when the caller didn't size the buffers explicitly.
+ * The kernel default (256KB) stalls bulk transfers long before the virtio ring is full. */
+enum { VSOCK_DEFAULT_BUFFER_BYTES = 4 * 1024 * 1024 };
 #endif
 
 /* other than CONNECTED_READ | CONNECTED_WRITE
@@ -173,6 +227,19 @@ struct posix_socket {
     struct aws_linked_list write_queue;
     struct aws_linked_list written_queue;
     struct aws_task written_task;
+    /* continuation of an accept drain that hit AWS_SOCKET_ACCEPT_BATCH_SIZE; only ever touched
+     * on the socket's own event-loop thread */
+    struct aws_task accept_drain_task;
+    /* additional exclusive-wakeup accept subscriptions (struct extra_accept_sub), one per extra
+     * loop when accepting on a whole event-loop group */
+    struct aws_linked_list extra_accept_subs;
+#if AWS_SOCKET_HAVE_MSG_ZEROCOPY
+    /* batches of fully-written zerocopy sends (struct zero_copy_send_batch) whose completion
+     * callbacks are held back until the kernel's error-queue notification releases the pages */
+    struct aws_linked_list zero_copy_in_flight;
+    uint32_t zero_copy_send_counter;
+    bool zero_copy_enabled;
+#endif
     struct posix_socket_connect_args *connect_args;
     /* Note that only the posix_socket impl part is refcounted.
      * The public aws_socket can be a stack variable and cleaned up synchronously
@@ -181,6 +248,7 @@ struct posix_socket {
     struct aws_ref_count internal_refcount;
     struct aws_allocator *allocator;
     bool written_task_scheduled;
+    bool accept_drain_task_scheduled;
     bool currently_subscribed;
     bool continue_accept;
     bool *close_happened;
@@ -209,6 +277,8 @@ static int s_socket_init(
     socket->io_handle.data.fd = -1;
     socket->state = INIT;
     socket->options = *options;
+    /* impl must be visible before options are applied; aws_socket_set_options records state on it */
+    socket->impl = posix_socket;
 
     if (existing_socket_fd < 0) {
         int err = s_create_socket(socket, options);
@@ -227,13 +297,16 @@ static int s_socket_init(
 
     aws_linked_list_init(&posix_socket->write_queue);
     aws_linked_list_init(&posix_socket->written_queue);
+    aws_linked_list_init(&posix_socket->extra_accept_subs);
+#if AWS_SOCKET_HAVE_MSG_ZEROCOPY
+    aws_linked_list_init(&posix_socket->zero_copy_in_flight);
+#endif
     posix_socket->currently_subscribed = false;
     posix_socket->continue_accept = false;
     aws_ref_count_init(&posix_socket->internal_refcount, posix_socket, s_socket_destroy_impl);
     posix_socket->allocator = alloc;
     posix_socket->connect_args = NULL;
     posix_socket->close_happened = NULL;
-    socket->impl = posix_socket;
     return AWS_OP_SUCCESS;
 }
 
@@ -242,6 +315,49 @@ int aws_socket_init(struct aws_socket *socket, struct aws_allocator *alloc, cons
     return s_socket_init(socket, alloc, options, -1);
 }
 
+int aws_socket_init_from_fd(
+    struct aws_socket *socket,
+    struct aws_allocator *alloc,
+    const struct aws_socket_options *options,
+    int connected_fd) {
+    AWS_ASSERT(options);
+
+    if (connected_fd < 0) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    int flags = fcntl(connected_fd, F_GETFL, 0);
+    if (flags == -1 || fcntl(connected_fd, F_SETFL, flags | O_NONBLOCK | O_CLOEXEC) == -1) {
+        int errno_value = errno; /* Always cache errno before potential side-effect */
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_SOCKET,
+            "id=static fd=%d: failed to put adopted descriptor in non-blocking mode, error %s",
+            connected_fd,
+            strerror(errno_value));
+        return aws_raise_error(s_determine_socket_error(errno_value));
+    }
+
+    if (s_socket_init(socket, alloc, options, connected_fd)) {
+        return AWS_OP_ERR;
+    }
+
+    socket->state = CONNECTED_READ | CONNECTED_WRITE;
+
+    /* endpoint info is only used for logging; an adopted descriptor without a resolvable name is still usable */
+    if (s_update_local_endpoint(socket)) {
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_SOCKET,
+            "id=%p fd=%d: could not determine local endpoint of adopted descriptor",
+            (void *)socket,
+            connected_fd);
+    }
+
+    AWS_LOGF_INFO(
+        AWS_LS_IO_SOCKET, "id=%p fd=%d: adopted connected descriptor", (void *)socket, socket->io_handle.data.fd);
+
+    return AWS_OP_SUCCESS;
+}
+
 void aws_socket_clean_up(struct aws_socket *socket) {
     if (!socket->impl) {
         /* protect from double clean */
@@ -915,6 +1031,26 @@ int aws_socket_listen(struct aws_socket *socket, int backlog_size) {
         return aws_raise_error(AWS_IO_SOCKET_ILLEGAL_OPERATION_FOR_STATE);
     }
 
+#ifdef TCP_FASTOPEN
+    if (socket->options.tcp_fast_open && socket->options.type == AWS_SOCKET_STREAM &&
+        socket->options.domain != AWS_SOCKET_LOCAL) {
+        /* the option value is the fast-open request queue depth; the regular backlog is a
+         * reasonable bound for it */
+        int fast_open_queue = backlog_size;
+        if (AWS_UNLIKELY(setsockopt(
+                socket->io_handle.data.fd, IPPROTO_TCP, TCP_FASTOPEN, &fast_open_queue, sizeof(int)))) {
+            int errno_value = errno; /* Always cache errno before potential side-effect */
+            AWS_LOGF_WARN(
+                AWS_LS_IO_SOCKET,
+                "id=%p fd=%d: setsockopt() for TCP_FASTOPEN failed with errno %d, "
+                "accepting without fast open.",
+                (void *)socket,
+                socket->io_handle.data.fd,
+                errno_value);
+        }
+    }
+#endif /* TCP_FASTOPEN */
+
     int error_code = listen(socket->io_handle.data.fd, backlog_size);
 
     if (!error_code) {
@@ -938,128 +1074,194 @@ int aws_socket_listen(struct aws_socket *socket, int backlog_size) {
     return aws_raise_error(s_determine_socket_error(errno_value));
 }
 
-/* this is called by the event loop handler that was installed in start_accept(). It runs once the FD goes readable,
- * accepts as many as it can and then returns control to the event loop. */
-static void s_socket_accept_event(
-    struct aws_event_loop *event_loop,
-    struct aws_io_handle *handle,
-    int events,
-    void *user_data) {
-
-    (void)event_loop;
+static void s_accept_drain_task(struct aws_task *task, void *arg, enum aws_task_status status);
 
-    struct aws_socket *socket = user_data;
+/* accepts up to AWS_SOCKET_ACCEPT_BATCH_SIZE connections from a listening fd, returning true if
+ * more may still be queued. The event loops are edge-triggered, so a caller that stops short of
+ * EAGAIN must arrange another pass (the continuation task below), or queued connections are
+ * stranded until the next SYN arrives. */
+static bool s_drain_accept_queue(struct aws_socket *socket, int listen_fd) {
     struct posix_socket *socket_impl = socket->impl;
 
-    AWS_LOGF_DEBUG(
-        AWS_LS_IO_SOCKET, "id=%p fd=%d: listening event received", (void *)socket, socket->io_handle.data.fd);
-
-    if (socket_impl->continue_accept && events & AWS_IO_EVENT_TYPE_READABLE) {
-        int in_fd = 0;
-        while (socket_impl->continue_accept && in_fd != -1) {
-            struct sockaddr_storage in_addr;
-            socklen_t in_len = sizeof(struct sockaddr_storage);
-
-            in_fd = accept(handle->data.fd, (struct sockaddr *)&in_addr, &in_len);
-            if (in_fd == -1) {
-                int errno_value = errno; /* Always cache errno before potential side-effect */
+    size_t accepted = 0;
+    int in_fd = 0;
+    while (socket_impl->continue_accept && in_fd != -1 && accepted < AWS_SOCKET_ACCEPT_BATCH_SIZE) {
+        struct sockaddr_storage in_addr;
+        socklen_t in_len = sizeof(struct sockaddr_storage);
 
-                if (errno_value == EAGAIN || errno_value == EWOULDBLOCK) {
-                    break;
-                }
+#if defined(__linux__)
+        /* accept4() applies the flags atomically at accept time, saving two fcntl() round trips
+         * per connection on a hot listener */
+        in_fd = accept4(listen_fd, (struct sockaddr *)&in_addr, &in_len, SOCK_NONBLOCK | SOCK_CLOEXEC);
+#else
+        in_fd = accept(listen_fd, (struct sockaddr *)&in_addr, &in_len);
+#endif
+        if (in_fd == -1) {
+            int errno_value = errno; /* Always cache errno before potential side-effect */
 
-                int aws_error = aws_socket_get_error(socket);
-                aws_raise_error(aws_error);
-                s_on_connection_error(socket, aws_error);
+            if (errno_value == EAGAIN || errno_value == EWOULDBLOCK) {
                 break;
             }
 
-            AWS_LOGF_DEBUG(
-                AWS_LS_IO_SOCKET, "id=%p fd=%d: incoming connection", (void *)socket, socket->io_handle.data.fd);
+            int aws_error = aws_socket_get_error(socket);
+            aws_raise_error(aws_error);
+            s_on_connection_error(socket, aws_error);
+            break;
+        }
 
-            struct aws_socket *new_sock = aws_mem_acquire(socket->allocator, sizeof(struct aws_socket));
+        ++accepted;
 
-            if (!new_sock) {
-                close(in_fd);
-                s_on_connection_error(socket, aws_last_error());
-                continue;
-            }
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_SOCKET, "id=%p fd=%d: incoming connection", (void *)socket, socket->io_handle.data.fd);
 
-            if (s_socket_init(new_sock, socket->allocator, &socket->options, in_fd)) {
-                aws_mem_release(socket->allocator, new_sock);
-                s_on_connection_error(socket, aws_last_error());
-                continue;
-            }
+        struct aws_socket *new_sock = aws_mem_acquire(socket->allocator, sizeof(struct aws_socket));
 
-            new_sock->local_endpoint = socket->local_endpoint;
-            new_sock->state = CONNECTED_READ | CONNECTED_WRITE;
-            uint32_t port = 0;
-
-            /* get the info on the incoming socket's address */
-            if (in_addr.ss_family == AF_INET) {
-                struct sockaddr_in *s = (struct sockaddr_in *)&in_addr;
-                port = ntohs(s->sin_port);
-                /* this came from the kernel, a.) it won't fail. b.) even if it does
-                 * its not fatal. come back and add logging later. */
-                if (!inet_ntop(
-                        AF_INET,
-                        &s->sin_addr,
-                        new_sock->remote_endpoint.address,
-                        sizeof(new_sock->remote_endpoint.address))) {
-                    AWS_LOGF_WARN(
-                        AWS_LS_IO_SOCKET,
-                        "id=%p fd=%d:. Failed to determine remote address.",
-                        (void *)socket,
-                        socket->io_handle.data.fd);
-                }
-                new_sock->options.domain = AWS_SOCKET_IPV4;
-            } else if (in_addr.ss_family == AF_INET6) {
-                /* this came from the kernel, a.) it won't fail. b.) even if it does
-                 * its not fatal. come back and add logging later. */
-                struct sockaddr_in6 *s = (struct sockaddr_in6 *)&in_addr;
-                port = ntohs(s->sin6_port);
-                if (!inet_ntop(
-                        AF_INET6,
-                        &s->sin6_addr,
-                        new_sock->remote_endpoint.address,
-                        sizeof(new_sock->remote_endpoint.address))) {
-                    AWS_LOGF_WARN(
-                        AWS_LS_IO_SOCKET,
-                        "id=%p fd=%d:. Failed to determine remote address.",
-                        (void *)socket,
-                        socket->io_handle.data.fd);
-                }
-                new_sock->options.domain = AWS_SOCKET_IPV6;
-            } else if (in_addr.ss_family == AF_UNIX) {
-                new_sock->remote_endpoint = socket->local_endpoint;
-                new_sock->options.domain = AWS_SOCKET_LOCAL;
+        if (!new_sock) {
+            close(in_fd);
+            s_on_connection_error(socket, aws_last_error());
+            continue;
+        }
+
+        if (s_socket_init(new_sock, socket->allocator, &socket->options, in_fd)) {
+            aws_mem_release(socket->allocator, new_sock);
+            s_on_connection_error(socket, aws_last_error());
+            continue;
+        }
+
+        new_sock->local_endpoint = socket->local_endpoint;
+        new_sock->state = CONNECTED_READ | CONNECTED_WRITE;
+        uint32_t port = 0;
+
+        /* get the info on the incoming socket's address */
+        if (in_addr.ss_family == AF_INET) {
+            struct sockaddr_in *s = (struct sockaddr_in *)&in_addr;
+            port = ntohs(s->sin_port);
+            /* this came from the kernel, a.) it won't fail. b.) even if it does
+             * its not fatal. come back and add logging later. */
+            if (!inet_ntop(
+                    AF_INET,
+                    &s->sin_addr,
+                    new_sock->remote_endpoint.address,
+                    sizeof(new_sock->remote_endpoint.address))) {
+                AWS_LOGF_WARN(
+                    AWS_LS_IO_SOCKET,
+                    "id=%p fd=%d:. Failed to determine remote address.",
+                    (void *)socket,
+                    socket->io_handle.data.fd);
+            }
+            new_sock->options.domain = AWS_SOCKET_IPV4;
+        } else if (in_addr.ss_family == AF_INET6) {
+            /* this came from the kernel, a.) it won't fail. b.) even if it does
+             * its not fatal. come back and add logging later. */
+            struct sockaddr_in6 *s = (struct sockaddr_in6 *)&in_addr;
+            port = ntohs(s->sin6_port);
+            if (!inet_ntop(
+                    AF_INET6,
+                    &s->sin6_addr,
+                    new_sock->remote_endpoint.address,
+                    sizeof(new_sock->remote_endpoint.address))) {
+                AWS_LOGF_WARN(
+                    AWS_LS_IO_SOCKET,
+                    "id=%p fd=%d:. Failed to determine remote address.",
+                    (void *)socket,
+                    socket->io_handle.data.fd);
             }
+            new_sock->options.domain = AWS_SOCKET_IPV6;
+        } else if (in_addr.ss_family == AF_UNIX) {
+            new_sock->remote_endpoint = socket->local_endpoint;
+            new_sock->options.domain = AWS_SOCKET_LOCAL;
+        }
 
-            new_sock->remote_endpoint.port = port;
+        new_sock->remote_endpoint.port = port;
 
-            AWS_LOGF_INFO(
-                AWS_LS_IO_SOCKET,
-                "id=%p fd=%d: connected to %s:%d, incoming fd %d",
-                (void *)socket,
-                socket->io_handle.data.fd,
-                new_sock->remote_endpoint.address,
-                new_sock->remote_endpoint.port,
-                in_fd);
+        AWS_LOGF_INFO(
+            AWS_LS_IO_SOCKET,
+            "id=%p fd=%d: connected to %s:%d, incoming fd %d",
+            (void *)socket,
+            socket->io_handle.data.fd,
+            new_sock->remote_endpoint.address,
+            new_sock->remote_endpoint.port,
+            in_fd);
+
+#if !defined(__linux__)
+        int flags = fcntl(in_fd, F_GETFL, 0);
+
+        flags |= O_NONBLOCK | O_CLOEXEC;
+        fcntl(in_fd, F_SETFL, flags);
+#endif
+
+        bool close_occurred = false;
+        socket_impl->close_happened = &close_occurred;
+        socket->accept_result_fn(socket, AWS_ERROR_SUCCESS, new_sock, socket->connect_accept_user_data);
+
+        if (close_occurred) {
+            return false;
+        }
+
+        socket_impl->close_happened = NULL;
+    }
+
+    return accepted == AWS_SOCKET_ACCEPT_BATCH_SIZE && in_fd != -1 && socket_impl->continue_accept;
+}
+
+/* picks an accept drain back up after a full batch yielded the loop thread */
+static void s_accept_drain_task(struct aws_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+
+    struct aws_socket *socket = arg;
+    struct posix_socket *socket_impl = socket->impl;
+
+    socket_impl->accept_drain_task_scheduled = false;
+
+    if (status != AWS_TASK_STATUS_RUN_READY || !socket_impl->continue_accept) {
+        return;
+    }
+
+    if (s_drain_accept_queue(socket, socket->io_handle.data.fd)) {
+        socket_impl->accept_drain_task_scheduled = true;
+        aws_task_init(&socket_impl->accept_drain_task, s_accept_drain_task, socket, "socket_accept_drain_task");
+        aws_event_loop_schedule_task_now(socket->event_loop, &socket_impl->accept_drain_task);
+    }
+}
+
+/* this is called by the event loop handler that was installed in start_accept(). It runs once the FD goes readable,
+ * accepts up to a batch's worth and then returns control to the event loop; any remainder is drained by the
+ * continuation task. */
+static void s_socket_accept_event(
+    struct aws_event_loop *event_loop,
+    struct aws_io_handle *handle,
+    int events,
+    void *user_data) {
 
-            int flags = fcntl(in_fd, F_GETFL, 0);
+    (void)event_loop;
 
-            flags |= O_NONBLOCK | O_CLOEXEC;
-            fcntl(in_fd, F_SETFL, flags);
+    struct aws_socket *socket = user_data;
+    struct posix_socket *socket_impl = socket->impl;
 
-            bool close_occurred = false;
-            socket_impl->close_happened = &close_occurred;
-            socket->accept_result_fn(socket, AWS_ERROR_SUCCESS, new_sock, socket->connect_accept_user_data);
+    AWS_LOGF_DEBUG(
+        AWS_LS_IO_SOCKET, "id=%p fd=%d: listening event received", (void *)socket, socket->io_handle.data.fd);
 
-            if (close_occurred) {
-                return;
+    if (socket_impl->continue_accept && events & AWS_IO_EVENT_TYPE_READABLE) {
+        while (s_drain_accept_queue(socket, handle->data.fd)) {
+            /* only the socket's own loop thread may touch the continuation task; extra
+             * exclusive-wakeup subscriptions run on other loops' threads and drain inline */
+            if (!aws_event_loop_thread_is_callers_thread(socket->event_loop)) {
+                continue;
             }
 
-            socket_impl->close_happened = NULL;
+            if (!socket_impl->accept_drain_task_scheduled) {
+                socket_impl->accept_drain_task_scheduled = true;
+                aws_task_init(
+                    &socket_impl->accept_drain_task, s_accept_drain_task, socket, "socket_accept_drain_task");
+                aws_event_loop_schedule_task_now(socket->event_loop, &socket_impl->accept_drain_task);
+                AWS_LOGF_TRACE(
+                    AWS_LS_IO_SOCKET,
+                    "id=%p fd=%d: accept batch limit reached with connections still queued, "
+                    "scheduling a task to continue draining.",
+                    (void *)socket,
+                    socket->io_handle.data.fd);
+            }
+            break;
         }
     }
 
@@ -1123,6 +1325,178 @@ int aws_socket_start_accept(
     return AWS_OP_SUCCESS;
 }
 
+/* one extra exclusive-wakeup subscription of a listening fd, on a loop other than the socket's
+ * primary loop. Each loop needs its own aws_io_handle because the loop stashes per-subscription
+ * state in handle->additional_data. */
+struct extra_accept_sub {
+    struct aws_linked_list_node node;
+    struct aws_io_handle handle;
+    struct aws_event_loop *loop;
+    struct aws_task teardown_task;
+    struct extra_accept_teardown_args *teardown_args;
+};
+
+struct extra_accept_teardown_args {
+    struct aws_mutex mutex;
+    struct aws_condition_variable condition_variable;
+    struct aws_allocator *allocator;
+    size_t remaining;
+};
+
+int aws_socket_start_accept_multi_loop(
+    struct aws_socket *socket,
+    struct aws_event_loop_group *el_group,
+    aws_socket_on_accept_result_fn *on_accept_result,
+    void *user_data) {
+    AWS_ASSERT(on_accept_result);
+    AWS_ASSERT(el_group);
+
+    if (socket->event_loop) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_SOCKET,
+            "id=%p fd=%d: is already assigned to event-loop %p.",
+            (void *)socket,
+            socket->io_handle.data.fd,
+            (void *)socket->event_loop);
+        return aws_raise_error(AWS_IO_EVENT_LOOP_ALREADY_ASSIGNED);
+    }
+
+    if (socket->state != LISTENING) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_SOCKET,
+            "id=%p fd=%d: invalid state for start_accept operation. You must call listen first.",
+            (void *)socket,
+            socket->io_handle.data.fd);
+        return aws_raise_error(AWS_IO_SOCKET_ILLEGAL_OPERATION_FOR_STATE);
+    }
+
+    size_t loop_count = aws_event_loop_group_get_loop_count(el_group);
+    AWS_ASSERT(loop_count > 0);
+
+    socket->accept_result_fn = on_accept_result;
+    socket->connect_accept_user_data = user_data;
+    /* the first loop is the primary: it owns the socket's own io_handle, and stop_accept/close
+     * marshal to it, exactly as in single-loop mode */
+    socket->event_loop = aws_event_loop_group_get_loop_at(el_group, 0);
+    struct posix_socket *socket_impl = socket->impl;
+    socket_impl->continue_accept = true;
+    socket_impl->currently_subscribed = true;
+
+    if (aws_event_loop_subscribe_to_io_events(
+            socket->event_loop,
+            &socket->io_handle,
+            AWS_IO_EVENT_TYPE_READABLE | AWS_IO_EVENT_TYPE_EXCLUSIVE_WAKEUP,
+            s_socket_accept_event,
+            socket)) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_SOCKET,
+            "id=%p fd=%d: failed to subscribe to event-loop %p.",
+            (void *)socket,
+            socket->io_handle.data.fd,
+            (void *)socket->event_loop);
+        socket_impl->continue_accept = false;
+        socket_impl->currently_subscribed = false;
+        socket->event_loop = NULL;
+
+        return AWS_OP_ERR;
+    }
+
+    for (size_t i = 1; i < loop_count; ++i) {
+        struct aws_event_loop *loop = aws_event_loop_group_get_loop_at(el_group, i);
+
+        struct extra_accept_sub *sub = aws_mem_calloc(socket->allocator, 1, sizeof(struct extra_accept_sub));
+        if (!sub) {
+            break;
+        }
+
+        sub->handle.data.fd = socket->io_handle.data.fd;
+        sub->loop = loop;
+
+        if (aws_event_loop_subscribe_to_io_events(
+                loop,
+                &sub->handle,
+                AWS_IO_EVENT_TYPE_READABLE | AWS_IO_EVENT_TYPE_EXCLUSIVE_WAKEUP,
+                s_socket_accept_event,
+                socket)) {
+            /* not fatal: accepts still flow through the loops that did subscribe */
+            AWS_LOGF_WARN(
+                AWS_LS_IO_SOCKET,
+                "id=%p fd=%d: failed to subscribe to additional event-loop %p, continuing without it.",
+                (void *)socket,
+                socket->io_handle.data.fd,
+                (void *)loop);
+            aws_mem_release(socket->allocator, sub);
+            continue;
+        }
+
+        aws_linked_list_push_back(&socket_impl->extra_accept_subs, &sub->node);
+    }
+
+    AWS_LOGF_INFO(
+        AWS_LS_IO_SOCKET,
+        "id=%p fd=%d: accepting with exclusive wakeups across %zu event-loops",
+        (void *)socket,
+        socket->io_handle.data.fd,
+        loop_count);
+
+    return AWS_OP_SUCCESS;
+}
+
+static bool s_extra_accept_teardown_pred(void *arg) {
+    struct extra_accept_teardown_args *args = arg;
+    return args->remaining == 0;
+}
+
+static void s_extra_accept_teardown_task(struct aws_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    struct extra_accept_sub *sub = arg;
+    struct extra_accept_teardown_args *args = sub->teardown_args;
+
+    /* on cancellation the loop is shutting down and has already dropped its subscriptions */
+    if (status == AWS_TASK_STATUS_RUN_READY) {
+        aws_event_loop_unsubscribe_from_io_events(sub->loop, &sub->handle);
+    }
+
+    struct aws_allocator *allocator = args->allocator;
+    aws_mem_release(allocator, sub);
+
+    aws_mutex_lock(&args->mutex);
+    args->remaining -= 1;
+    aws_condition_variable_notify_one(&args->condition_variable);
+    aws_mutex_unlock(&args->mutex);
+}
+
+/* Unsubscribes every extra accept subscription on its own loop thread and blocks until they're all
+ * gone. Runs on the primary loop's thread (or a non-loop thread); the extra loops make progress
+ * independently, so the wait can't deadlock. */
+static void s_teardown_extra_accept_subs(struct aws_socket *socket) {
+    struct posix_socket *socket_impl = socket->impl;
+
+    if (aws_linked_list_empty(&socket_impl->extra_accept_subs)) {
+        return;
+    }
+
+    struct extra_accept_teardown_args args = {
+        .mutex = AWS_MUTEX_INIT,
+        .condition_variable = AWS_CONDITION_VARIABLE_INIT,
+        .allocator = socket->allocator,
+        .remaining = 0,
+    };
+
+    aws_mutex_lock(&args.mutex);
+    while (!aws_linked_list_empty(&socket_impl->extra_accept_subs)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&socket_impl->extra_accept_subs);
+        struct extra_accept_sub *sub = AWS_CONTAINER_OF(node, struct extra_accept_sub, node);
+
+        sub->teardown_args = &args;
+        args.remaining += 1;
+        aws_task_init(&sub->teardown_task, s_extra_accept_teardown_task, sub, "socket_extra_accept_teardown");
+        aws_event_loop_schedule_task_now(sub->loop, &sub->teardown_task);
+    }
+    aws_condition_variable_wait_pred(&args.condition_variable, &args.mutex, s_extra_accept_teardown_pred, &args);
+    aws_mutex_unlock(&args.mutex);
+}
+
 struct stop_accept_args {
     struct aws_task task;
     struct aws_mutex mutex;
@@ -1203,10 +1577,17 @@ int aws_socket_stop_accept(struct aws_socket *socket) {
     int ret_val = AWS_OP_SUCCESS;
     struct posix_socket *socket_impl = socket->impl;
     if (socket_impl->currently_subscribed) {
+        if (socket_impl->accept_drain_task_scheduled) {
+            aws_event_loop_cancel_task(socket->event_loop, &socket_impl->accept_drain_task);
+            socket_impl->accept_drain_task_scheduled = false;
+        }
         ret_val = aws_event_loop_unsubscribe_from_io_events(socket->event_loop, &socket->io_handle);
         socket_impl->currently_subscribed = false;
         socket_impl->continue_accept = false;
         socket->event_loop = NULL;
+
+        /* multi-loop accept: drop the exclusive-wakeup subscriptions on the other loops too */
+        s_teardown_extra_accept_subs(socket);
     }
 
     return ret_val;
@@ -1255,17 +1636,233 @@ int aws_socket_set_options(struct aws_socket *socket, const struct aws_socket_op
             errno_value);
     }
 
-    if (options->type == AWS_SOCKET_STREAM && options->domain != AWS_SOCKET_LOCAL) {
-        if (socket->options.keepalive) {
-            int keep_alive = 1;
-            if (AWS_UNLIKELY(
-                    setsockopt(socket->io_handle.data.fd, SOL_SOCKET, SO_KEEPALIVE, &keep_alive, sizeof(int)))) {
-                int errno_value = errno; /* Always cache errno before potential side-effect */
-                AWS_LOGF_WARN(
-                    AWS_LS_IO_SOCKET,
-                    "id=%p fd=%d: setsockopt() for enabling SO_KEEPALIVE failed with errno %d.",
-                    (void *)socket,
-                    socket->io_handle.data.fd,
+#ifdef SO_REUSEPORT
+    if (options->reuse_port) {
+        int reuse_port = 1;
+        if (AWS_UNLIKELY(
+                setsockopt(socket->io_handle.data.fd, SOL_SOCKET, SO_REUSEPORT, &reuse_port, sizeof(int)))) {
+            int errno_value = errno; /* Always cache errno before potential side-effect */
+            AWS_LOGF_WARN(
+                AWS_LS_IO_SOCKET,
+                "id=%p fd=%d: setsockopt() for SO_REUSEPORT failed with errno %d.",
+                (void *)socket,
+                socket->io_handle.data.fd,
+                errno_value);
+        }
+    }
+#endif /* SO_REUSEPORT */
+
+#ifdef SO_BUSY_POLL
+    if (options->busy_poll_usec > 0 && options->domain != AWS_SOCKET_LOCAL) {
+        int busy_poll_usec = (int)options->busy_poll_usec;
+        if (AWS_UNLIKELY(
+                setsockopt(socket->io_handle.data.fd, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_usec, sizeof(int)))) {
+            int errno_value = errno; /* Always cache errno before potential side-effect */
+            AWS_LOGF_WARN(
+                AWS_LS_IO_SOCKET,
+                "id=%p fd=%d: setsockopt() for SO_BUSY_POLL failed with errno %d, "
+                "receives stay interrupt-driven.",
+                (void *)socket,
+                socket->io_handle.data.fd,
+                errno_value);
+        }
+#    ifdef SO_PREFER_BUSY_POLL
+        /* 5.11+ extends busy polling to epoll-driven sockets; best effort on older kernels */
+        int prefer_busy_poll = 1;
+        if (AWS_UNLIKELY(setsockopt(
+                socket->io_handle.data.fd, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer_busy_poll, sizeof(int)))) {
+            int errno_value = errno; /* Always cache errno before potential side-effect */
+            AWS_LOGF_DEBUG(
+                AWS_LS_IO_SOCKET,
+                "id=%p fd=%d: setsockopt() for SO_PREFER_BUSY_POLL failed with errno %d.",
+                (void *)socket,
+                socket->io_handle.data.fd,
+                errno_value);
+        }
+#    endif /* SO_PREFER_BUSY_POLL */
+    }
+#endif /* SO_BUSY_POLL */
+
+    if (options->send_buffer_size > 0) {
+        int send_buffer_size = (int)options->send_buffer_size;
+        if (AWS_UNLIKELY(
+                setsockopt(socket->io_handle.data.fd, SOL_SOCKET, SO_SNDBUF, &send_buffer_size, sizeof(int)))) {
+            int errno_value = errno; /* Always cache errno before potential side-effect */
+            AWS_LOGF_WARN(
+                AWS_LS_IO_SOCKET,
+                "id=%p fd=%d: setsockopt() for SO_SNDBUF failed with errno %d.",
+                (void *)socket,
+                socket->io_handle.data.fd,
+                errno_value);
+        }
+    }
+
+    if (options->receive_buffer_size > 0) {
+        int receive_buffer_size = (int)options->receive_buffer_size;
+        if (AWS_UNLIKELY(
+                setsockopt(socket->io_handle.data.fd, SOL_SOCKET, SO_RCVBUF, &receive_buffer_size, sizeof(int)))) {
+            int errno_value = errno; /* Always cache errno before potential side-effect */
+            AWS_LOGF_WARN(
+                AWS_LS_IO_SOCKET,
+                "id=%p fd=%d: setsockopt() for SO_RCVBUF failed with errno %d.",
+                (void *)socket,
+                socket->io_handle.data.fd,
+                errno_value);
+        }
+    }
+
+#ifdef USE_VSOCK
+    if (options->domain == AWS_SOCKET_VSOCK) {
+        /* SO_SNDBUF/SO_RCVBUF have no effect on vsock; flow control runs on a per-socket credit
+         * window sized by SO_VM_SOCKETS_BUFFER_SIZE instead. Map the buffer-size options onto the
+         * window (one window covers both directions, so take the larger of the two) and raise it
+         * to a bulk-transfer-friendly default when neither was set. The max-size cap has to be
+         * lifted first, since the buffer size is clamped against it. */
+        uint64_t vsock_buffer_size = options->send_buffer_size > options->receive_buffer_size
+                                         ? (uint64_t)options->send_buffer_size
+                                         : (uint64_t)options->receive_buffer_size;
+        if (vsock_buffer_size == 0) {
+            vsock_buffer_size = VSOCK_DEFAULT_BUFFER_BYTES;
+        }
+
+        if (AWS_UNLIKELY(setsockopt(
+                socket->io_handle.data.fd,
+                AF_VSOCK,
+                SO_VM_SOCKETS_BUFFER_MAX_SIZE,
+                &vsock_buffer_size,
+                sizeof(vsock_buffer_size)))) {
+            int errno_value = errno; /* Always cache errno before potential side-effect */
+            AWS_LOGF_WARN(
+                AWS_LS_IO_SOCKET,
+                "id=%p fd=%d: setsockopt() for SO_VM_SOCKETS_BUFFER_MAX_SIZE failed with errno %d.",
+                (void *)socket,
+                socket->io_handle.data.fd,
+                errno_value);
+        }
+
+        if (AWS_UNLIKELY(setsockopt(
+                socket->io_handle.data.fd,
+                AF_VSOCK,
+                SO_VM_SOCKETS_BUFFER_SIZE,
+                &vsock_buffer_size,
+                sizeof(vsock_buffer_size)))) {
+            int errno_value = errno; /* Always cache errno before potential side-effect */
+            AWS_LOGF_WARN(
+                AWS_LS_IO_SOCKET,
+                "id=%p fd=%d: setsockopt() for SO_VM_SOCKETS_BUFFER_SIZE failed with errno %d, "
+                "throughput stays bounded by the kernel's default credit window.",
+                (void *)socket,
+                socket->io_handle.data.fd,
+                errno_value);
+        }
+    }
+#endif /* USE_VSOCK */
+
+#if AWS_SOCKET_HAVE_MSG_ZEROCOPY
+    if (socket->impl != NULL) {
+        struct posix_socket *socket_impl = socket->impl;
+        socket_impl->zero_copy_enabled = false;
+        if (options->zero_copy_send && options->type == AWS_SOCKET_STREAM && options->domain != AWS_SOCKET_LOCAL) {
+            int zero_copy = 1;
+            if (AWS_UNLIKELY(
+                    setsockopt(socket->io_handle.data.fd, SOL_SOCKET, SO_ZEROCOPY, &zero_copy, sizeof(int)))) {
+                int errno_value = errno; /* Always cache errno before potential side-effect */
+                AWS_LOGF_WARN(
+                    AWS_LS_IO_SOCKET,
+                    "id=%p fd=%d: setsockopt() for SO_ZEROCOPY failed with errno %d, falling back to copied sends.",
+                    (void *)socket,
+                    socket->io_handle.data.fd,
+                    errno_value);
+            } else {
+                socket_impl->zero_copy_enabled = true;
+            }
+        }
+    }
+#endif /* AWS_SOCKET_HAVE_MSG_ZEROCOPY */
+
+    if (options->type == AWS_SOCKET_DGRAM && options->domain != AWS_SOCKET_LOCAL) {
+#ifdef UDP_SEGMENT
+        if (options->udp_gso_segment_size > 0) {
+            int segment_size = options->udp_gso_segment_size;
+            if (AWS_UNLIKELY(
+                    setsockopt(socket->io_handle.data.fd, SOL_UDP, UDP_SEGMENT, &segment_size, sizeof(int)))) {
+                int errno_value = errno; /* Always cache errno before potential side-effect */
+                AWS_LOGF_WARN(
+                    AWS_LS_IO_SOCKET,
+                    "id=%p fd=%d: setsockopt() for UDP_SEGMENT failed with errno %d, "
+                    "large sends will be segmented in user space.",
+                    (void *)socket,
+                    socket->io_handle.data.fd,
+                    errno_value);
+            }
+        }
+#endif /* UDP_SEGMENT */
+
+#ifdef UDP_GRO
+        if (options->udp_gro) {
+            int gro = 1;
+            if (AWS_UNLIKELY(setsockopt(socket->io_handle.data.fd, SOL_UDP, UDP_GRO, &gro, sizeof(int)))) {
+                int errno_value = errno; /* Always cache errno before potential side-effect */
+                AWS_LOGF_WARN(
+                    AWS_LS_IO_SOCKET,
+                    "id=%p fd=%d: setsockopt() for UDP_GRO failed with errno %d, "
+                    "received datagrams will not be coalesced.",
+                    (void *)socket,
+                    socket->io_handle.data.fd,
+                    errno_value);
+            }
+        }
+#endif /* UDP_GRO */
+    }
+
+    if (options->type == AWS_SOCKET_STREAM && options->domain != AWS_SOCKET_LOCAL) {
+#ifdef TCP_FASTOPEN_CONNECT
+        if (socket->options.tcp_fast_open) {
+            /* with TCP_FASTOPEN_CONNECT, connect() returns immediately and the SYN is deferred to
+             * the first send so queued payload rides it; the normal connect/write flow is unchanged */
+            int fast_open = 1;
+            if (AWS_UNLIKELY(setsockopt(
+                    socket->io_handle.data.fd, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, &fast_open, sizeof(int)))) {
+                int errno_value = errno; /* Always cache errno before potential side-effect */
+                AWS_LOGF_WARN(
+                    AWS_LS_IO_SOCKET,
+                    "id=%p fd=%d: setsockopt() for TCP_FASTOPEN_CONNECT failed with errno %d, "
+                    "connects will pay the full handshake round trip.",
+                    (void *)socket,
+                    socket->io_handle.data.fd,
+                    errno_value);
+            }
+        }
+#endif /* TCP_FASTOPEN_CONNECT */
+
+#ifdef TCP_NOTSENT_LOWAT
+        if (socket->options.not_sent_low_water_bytes > 0) {
+            /* writable (EPOLLOUT/kqueue write) is then reported only while unsent data is below
+             * the mark, so pending writes queue here instead of piling up in the kernel */
+            int low_water = (int)socket->options.not_sent_low_water_bytes;
+            if (AWS_UNLIKELY(setsockopt(
+                    socket->io_handle.data.fd, IPPROTO_TCP, TCP_NOTSENT_LOWAT, &low_water, sizeof(int)))) {
+                int errno_value = errno; /* Always cache errno before potential side-effect */
+                AWS_LOGF_WARN(
+                    AWS_LS_IO_SOCKET,
+                    "id=%p fd=%d: setsockopt() for TCP_NOTSENT_LOWAT failed with errno %d.",
+                    (void *)socket,
+                    socket->io_handle.data.fd,
+                    errno_value);
+            }
+        }
+#endif /* TCP_NOTSENT_LOWAT */
+
+        if (socket->options.keepalive) {
+            int keep_alive = 1;
+            if (AWS_UNLIKELY(
+                    setsockopt(socket->io_handle.data.fd, SOL_SOCKET, SO_KEEPALIVE, &keep_alive, sizeof(int)))) {
+                int errno_value = errno; /* Always cache errno before potential side-effect */
+                AWS_LOGF_WARN(
+                    AWS_LS_IO_SOCKET,
+                    "id=%p fd=%d: setsockopt() for enabling SO_KEEPALIVE failed with errno %d.",
+                    (void *)socket,
+                    socket->io_handle.data.fd,
                     errno_value);
             }
         }
@@ -1323,8 +1920,27 @@ struct socket_write_request {
     struct aws_linked_list_node node;
     size_t original_buffer_len;
     int error_code;
+    /* file-region request (sendfile path): cursor_cpy.ptr stays NULL, cursor_cpy.len tracks the
+     * bytes left to send so completion accounting works unchanged, and file_offset advances as
+     * the kernel accepts bytes */
+    bool is_file_region;
+    int file_fd;
+    uint64_t file_offset;
+    /* urgent writes (aws_socket_write_urgent) jump ahead of queued normal writes */
+    bool high_priority;
 };
 
+#if AWS_SOCKET_HAVE_MSG_ZEROCOPY
+/* The requests completed by one MSG_ZEROCOPY sendmsg(). The kernel numbers zerocopy sends per
+ * socket and acknowledges them (possibly coalesced into ranges) on the error queue; a batch is
+ * released to the written_queue when its sequence number falls inside an acknowledged range. */
+struct zero_copy_send_batch {
+    struct aws_linked_list_node node;
+    struct aws_linked_list requests;
+    uint32_t send_seq;
+};
+#endif
+
 struct posix_socket_close_args {
     struct aws_mutex mutex;
     struct aws_condition_variable condition_variable;
@@ -1437,6 +2053,19 @@ int aws_socket_close(struct aws_socket *socket) {
             aws_event_loop_cancel_task(event_loop, &socket_impl->written_task);
         }
 
+#if AWS_SOCKET_HAVE_MSG_ZEROCOPY
+        /* the fd is closed, so the kernel has dropped its page references; complete any zerocopy
+         * sends still waiting on an error-queue notification */
+        while (!aws_linked_list_empty(&socket_impl->zero_copy_in_flight)) {
+            struct aws_linked_list_node *batch_node = aws_linked_list_pop_front(&socket_impl->zero_copy_in_flight);
+            struct zero_copy_send_batch *batch = AWS_CONTAINER_OF(batch_node, struct zero_copy_send_batch, node);
+            while (!aws_linked_list_empty(&batch->requests)) {
+                aws_linked_list_push_back(&socket_impl->written_queue, aws_linked_list_pop_front(&batch->requests));
+            }
+            aws_mem_release(socket_impl->allocator, batch);
+        }
+#endif
+
         while (!aws_linked_list_empty(&socket_impl->written_queue)) {
             struct aws_linked_list_node *node = aws_linked_list_pop_front(&socket_impl->written_queue);
             struct socket_write_request *write_request = AWS_CONTAINER_OF(node, struct socket_write_request, node);
@@ -1517,6 +2146,84 @@ static void s_written_task(struct aws_task *task, void *arg, enum aws_task_statu
     aws_ref_count_release(&socket_impl->internal_refcount);
 }
 
+#if AWS_SOCKET_HAVE_SENDFILE
+/* Push bytes of a file-region request into the socket with sendfile(), crediting whatever the
+ * kernel accepted. Returns AWS_OP_ERR with the error raised if the region can't be sent;
+ * otherwise *out_would_block says whether the socket buffer filled before the region finished. */
+static int s_flush_file_region_request(
+    struct aws_socket *socket,
+    struct socket_write_request *write_request,
+    bool *out_would_block) {
+
+    *out_would_block = false;
+
+    size_t chunk = write_request->cursor_cpy.len;
+    if (chunk == 0) {
+        return AWS_OP_SUCCESS;
+    }
+
+    size_t bytes_sent = 0;
+
+#    if defined(__linux__)
+    off_t offset = (off_t)write_request->file_offset;
+    ssize_t rc = sendfile(socket->io_handle.data.fd, write_request->file_fd, &offset, chunk);
+    int errno_value = errno; /* Always cache errno before potential side-effect */
+
+    if (rc < 0) {
+        if (errno_value == EAGAIN) {
+            *out_would_block = true;
+            return AWS_OP_SUCCESS;
+        }
+        if (errno_value == EINTR) {
+            return AWS_OP_SUCCESS; /* caller loops and retries */
+        }
+        return aws_raise_error(s_determine_socket_error(errno_value));
+    }
+
+    bytes_sent = (size_t)rc;
+    /* a short count means the socket buffer filled */
+    *out_would_block = bytes_sent < chunk;
+#    else  /* __MACH__ */
+    off_t len_in_out = (off_t)chunk;
+    int rc = sendfile(
+        write_request->file_fd, socket->io_handle.data.fd, (off_t)write_request->file_offset, &len_in_out, NULL, 0);
+    int errno_value = errno; /* Always cache errno before potential side-effect */
+
+    /* partial progress is reported through len_in_out even when the call fails */
+    bytes_sent = (size_t)len_in_out;
+    if (rc == -1) {
+        if (errno_value == EAGAIN) {
+            *out_would_block = true;
+        } else if (errno_value != EINTR) {
+            return aws_raise_error(s_determine_socket_error(errno_value));
+        }
+    }
+#    endif /* __MACH__ */
+
+    if (bytes_sent == 0 && !*out_would_block) {
+        /* the file ended before the requested region did */
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_SOCKET,
+            "id=%p fd=%d: file region ends before the requested length; failing write request",
+            (void *)socket,
+            socket->io_handle.data.fd);
+        return aws_raise_error(AWS_IO_STREAM_READ_FAILED);
+    }
+
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_SOCKET,
+        "id=%p fd=%d: sendfile pushed %llu bytes of file region",
+        (void *)socket,
+        socket->io_handle.data.fd,
+        (unsigned long long)bytes_sent);
+
+    write_request->file_offset += bytes_sent;
+    write_request->cursor_cpy.len -= bytes_sent;
+
+    return AWS_OP_SUCCESS;
+}
+#endif /* AWS_SOCKET_HAVE_SENDFILE */
+
 /* this gets called in two scenarios.
  * 1st scenario, someone called aws_socket_write() and we want to try writing now, so an error can be returned
  * immediately if something bad has happened to the socket. In this case, `parent_request` is set.
@@ -1545,21 +2252,124 @@ static int s_process_socket_write_requests(struct aws_socket *socket, struct soc
 
     /* if a close call happens in the middle, this queue will have been cleaned out from under us. */
     while (!aws_linked_list_empty(&socket_impl->write_queue)) {
-        struct aws_linked_list_node *node = aws_linked_list_front(&socket_impl->write_queue);
-        struct socket_write_request *write_request = AWS_CONTAINER_OF(node, struct socket_write_request, node);
+        struct socket_write_request *front_request =
+            AWS_CONTAINER_OF(aws_linked_list_front(&socket_impl->write_queue), struct socket_write_request, node);
+        if (front_request->is_file_region) {
+#if AWS_SOCKET_HAVE_SENDFILE
+            bool would_block = false;
+            if (s_flush_file_region_request(socket, front_request, &would_block)) {
+                aws_error = aws_last_error();
+                purge = true;
+                break;
+            }
+
+            if (front_request->cursor_cpy.len == 0) {
+                AWS_LOGF_TRACE(
+                    AWS_LS_IO_SOCKET,
+                    "id=%p fd=%d: file region write request completed",
+                    (void *)socket,
+                    socket->io_handle.data.fd);
+                aws_linked_list_remove(&front_request->node);
+                front_request->error_code = AWS_ERROR_SUCCESS;
+                aws_linked_list_push_back(&socket_impl->written_queue, &front_request->node);
+                pushed_to_written_queue = true;
+                continue;
+            }
+
+            if (would_block) {
+                break;
+            }
+
+            continue; /* partial progress without blocking; push more of the region */
+#else
+            AWS_FATAL_ASSERT(false && "file-region request queued on a platform without sendfile");
+#endif /* AWS_SOCKET_HAVE_SENDFILE */
+        }
+
+        /* gather the front of the queue into one vectored send. The layers above tend to emit
+         * several small messages per event-loop tick; draining them with a single sendmsg()
+         * completes multiple requests per syscall. */
+        struct iovec iov[AWS_SOCKET_WRITEV_BATCH_SIZE];
+        size_t iov_count = 0;
+#if AWS_SOCKET_HAVE_MSG_ZEROCOPY
+        size_t gathered_bytes = 0;
+#endif
+
+        size_t max_batch = AWS_SOCKET_WRITEV_BATCH_SIZE;
+#ifdef IOV_MAX
+        if (max_batch > IOV_MAX) {
+            max_batch = IOV_MAX;
+        }
+#endif
+
+        struct aws_linked_list_node *gather_node = aws_linked_list_front(&socket_impl->write_queue);
+        while (gather_node != aws_linked_list_end(&socket_impl->write_queue) && iov_count < max_batch) {
+            struct socket_write_request *gather_request =
+                AWS_CONTAINER_OF(gather_node, struct socket_write_request, node);
+            if (gather_request->is_file_region) {
+                /* flushed separately with sendfile() once the buffers ahead of it drain */
+                break;
+            }
+            iov[iov_count].iov_base = (void *)gather_request->cursor_cpy.ptr;
+            iov[iov_count].iov_len = gather_request->cursor_cpy.len;
+            ++iov_count;
+#if AWS_SOCKET_HAVE_MSG_ZEROCOPY
+            gathered_bytes += gather_request->cursor_cpy.len;
+#endif
+            gather_node = aws_linked_list_next(gather_node);
+        }
+
+        /* msg_iovlen is int on BSD-derived platforms and size_t on Linux; the batch cap keeps the
+         * count well inside both */
+        struct msghdr msg;
+        AWS_ZERO_STRUCT(msg);
+        msg.msg_iov = iov;
+        msg.msg_iovlen = (int)iov_count;
 
         AWS_LOGF_TRACE(
             AWS_LS_IO_SOCKET,
-            "id=%p fd=%d: dequeued write request of size %llu, remaining to write %llu",
+            "id=%p fd=%d: flushing %llu queued write requests with one vectored send",
             (void *)socket,
             socket->io_handle.data.fd,
-            (unsigned long long)write_request->original_buffer_len,
-            (unsigned long long)write_request->cursor_cpy.len);
+            (unsigned long long)iov_count);
+
+        int send_flags = NO_SIGNAL_SEND;
+#if AWS_SOCKET_HAVE_MSG_ZEROCOPY
+        bool use_zero_copy =
+            socket_impl->zero_copy_enabled && gathered_bytes >= AWS_SOCKET_ZEROCOPY_MIN_SEND_BYTES;
+        if (use_zero_copy) {
+            send_flags |= MSG_ZEROCOPY;
+        }
+#endif
 
-        ssize_t written = send(
-            socket->io_handle.data.fd, write_request->cursor_cpy.ptr, write_request->cursor_cpy.len, NO_SIGNAL_SEND);
+        ssize_t written = sendmsg(socket->io_handle.data.fd, &msg, send_flags);
         int errno_value = errno; /* Always cache errno before potential side-effect */
 
+#if AWS_SOCKET_HAVE_MSG_ZEROCOPY
+        if (written < 0 && errno_value == ENOBUFS && use_zero_copy) {
+            /* the per-socket optmem budget for pinned pages is exhausted; retry this flush as a
+             * plain copied send rather than surfacing an error */
+            use_zero_copy = false;
+            send_flags &= ~MSG_ZEROCOPY;
+            written = sendmsg(socket->io_handle.data.fd, &msg, send_flags);
+            errno_value = errno;
+        }
+
+        struct zero_copy_send_batch *zero_copy_batch = NULL;
+        if (use_zero_copy && written >= 0) {
+            /* the kernel numbers every successful MSG_ZEROCOPY send, partial ones included */
+            zero_copy_batch = aws_mem_calloc(socket->allocator, 1, sizeof(struct zero_copy_send_batch));
+            if (zero_copy_batch) {
+                aws_linked_list_init(&zero_copy_batch->requests);
+                zero_copy_batch->send_seq = socket_impl->zero_copy_send_counter;
+                aws_linked_list_push_back(&socket_impl->zero_copy_in_flight, &zero_copy_batch->node);
+            }
+            /* on allocation failure the requests complete eagerly below; the error-queue
+             * notification for this sequence number is then consumed with nothing to release */
+            socket_impl->zero_copy_send_counter++;
+        }
+#endif
+
         AWS_LOGF_TRACE(
             AWS_LS_IO_SOCKET,
             "id=%p fd=%d: send written size %d",
@@ -1598,24 +2408,43 @@ static int s_process_socket_write_requests(struct aws_socket *socket, struct soc
             break;
         }
 
-        size_t remaining_to_write = write_request->cursor_cpy.len;
+        /* credit the written bytes to the front of the queue, completing every request the
+         * vectored send fully covered and advancing the (at most one) partially-written request */
+        size_t bytes_remaining = (size_t)written;
+        while (bytes_remaining > 0) {
+            struct aws_linked_list_node *node = aws_linked_list_front(&socket_impl->write_queue);
+            struct socket_write_request *write_request = AWS_CONTAINER_OF(node, struct socket_write_request, node);
 
-        aws_byte_cursor_advance(&write_request->cursor_cpy, (size_t)written);
-        AWS_LOGF_TRACE(
-            AWS_LS_IO_SOCKET,
-            "id=%p fd=%d: remaining write request to write %llu",
-            (void *)socket,
-            socket->io_handle.data.fd,
-            (unsigned long long)write_request->cursor_cpy.len);
+            size_t advance = write_request->cursor_cpy.len < bytes_remaining ? write_request->cursor_cpy.len
+                                                                             : bytes_remaining;
+            aws_byte_cursor_advance(&write_request->cursor_cpy, advance);
+            bytes_remaining -= advance;
+
+            if (write_request->cursor_cpy.len > 0) {
+                AWS_LOGF_TRACE(
+                    AWS_LS_IO_SOCKET,
+                    "id=%p fd=%d: remaining write request to write %llu",
+                    (void *)socket,
+                    socket->io_handle.data.fd,
+                    (unsigned long long)write_request->cursor_cpy.len);
+                break;
+            }
 
-        if ((size_t)written == remaining_to_write) {
             AWS_LOGF_TRACE(
                 AWS_LS_IO_SOCKET, "id=%p fd=%d: write request completed", (void *)socket, socket->io_handle.data.fd);
 
             aws_linked_list_remove(node);
             write_request->error_code = AWS_ERROR_SUCCESS;
-            aws_linked_list_push_back(&socket_impl->written_queue, node);
-            pushed_to_written_queue = true;
+#if AWS_SOCKET_HAVE_MSG_ZEROCOPY
+            if (zero_copy_batch != NULL) {
+                /* completion is deferred until the kernel releases the pages on the error queue */
+                aws_linked_list_push_back(&zero_copy_batch->requests, node);
+            } else
+#endif
+            {
+                aws_linked_list_push_back(&socket_impl->written_queue, node);
+                pushed_to_written_queue = true;
+            }
         }
     }
 
@@ -1652,6 +2481,82 @@ static int s_process_socket_write_requests(struct aws_socket *socket, struct soc
     return AWS_OP_ERR;
 }
 
+#if AWS_SOCKET_HAVE_MSG_ZEROCOPY
+/* Zerocopy completions arrive as SO_EE_ORIGIN_ZEROCOPY records on the socket's error queue (which
+ * epoll reports as an error event). Drains the queue, releasing every in-flight batch whose
+ * sequence number falls in an acknowledged range, and returns true if any notification was seen. */
+static bool s_drain_zero_copy_completions(struct aws_socket *socket) {
+    struct posix_socket *socket_impl = socket->impl;
+    bool saw_notification = false;
+    bool pushed_to_written_queue = false;
+
+    while (true) {
+        struct msghdr msg;
+        char control_buf[CMSG_SPACE(sizeof(struct sock_extended_err))];
+        AWS_ZERO_STRUCT(msg);
+        AWS_ZERO_ARRAY(control_buf);
+        msg.msg_control = control_buf;
+        msg.msg_controllen = sizeof(control_buf);
+
+        if (recvmsg(socket->io_handle.data.fd, &msg, MSG_ERRQUEUE) < 0) {
+            /* EAGAIN: queue drained. Anything else is left for the caller's error path. */
+            break;
+        }
+
+        for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+            if (!(cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) &&
+                !(cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR)) {
+                continue;
+            }
+
+            struct sock_extended_err *serr = (struct sock_extended_err *)CMSG_DATA(cmsg);
+            if (serr->ee_errno != 0 || serr->ee_origin != SO_EE_ORIGIN_ZEROCOPY) {
+                continue;
+            }
+
+            saw_notification = true;
+            uint32_t range_lo = serr->ee_info;
+            uint32_t range_hi = serr->ee_data;
+            AWS_LOGF_TRACE(
+                AWS_LS_IO_SOCKET,
+                "id=%p fd=%d: zerocopy sends %" PRIu32 "-%" PRIu32 " released by the kernel",
+                (void *)socket,
+                socket->io_handle.data.fd,
+                range_lo,
+                range_hi);
+
+            struct aws_linked_list_node *batch_node = aws_linked_list_begin(&socket_impl->zero_copy_in_flight);
+            while (batch_node != aws_linked_list_end(&socket_impl->zero_copy_in_flight)) {
+                struct zero_copy_send_batch *batch =
+                    AWS_CONTAINER_OF(batch_node, struct zero_copy_send_batch, node);
+                batch_node = aws_linked_list_next(batch_node);
+
+                /* wrap-safe containment check for send_seq in [range_lo, range_hi] */
+                if ((uint32_t)(range_hi - batch->send_seq) > (uint32_t)(range_hi - range_lo)) {
+                    continue;
+                }
+
+                aws_linked_list_remove(&batch->node);
+                while (!aws_linked_list_empty(&batch->requests)) {
+                    aws_linked_list_push_back(
+                        &socket_impl->written_queue, aws_linked_list_pop_front(&batch->requests));
+                    pushed_to_written_queue = true;
+                }
+                aws_mem_release(socket_impl->allocator, batch);
+            }
+        }
+    }
+
+    if (pushed_to_written_queue && !socket_impl->written_task_scheduled && socket->event_loop != NULL) {
+        socket_impl->written_task_scheduled = true;
+        aws_task_init(&socket_impl->written_task, s_written_task, socket, "socket_written_task");
+        aws_event_loop_schedule_task_now(socket->event_loop, &socket_impl->written_task);
+    }
+
+    return saw_notification;
+}
+#endif /* AWS_SOCKET_HAVE_MSG_ZEROCOPY */
+
 static void s_on_socket_io_event(
     struct aws_event_loop *event_loop,
     struct aws_io_handle *handle,
@@ -1695,6 +2600,14 @@ static void s_on_socket_io_event(
     }
 
     if (socket_impl->currently_subscribed && events & AWS_IO_EVENT_TYPE_ERROR) {
+#if AWS_SOCKET_HAVE_MSG_ZEROCOPY
+        /* zerocopy completions surface as error-queue wakeups; if draining them accounts for the
+         * event and SO_ERROR has nothing pending, this wasn't a socket failure */
+        if (socket_impl->zero_copy_enabled && s_drain_zero_copy_completions(socket) &&
+            aws_socket_get_error(socket) == AWS_OP_SUCCESS) {
+            goto end_check;
+        }
+#endif
         int aws_error = aws_socket_get_error(socket);
         aws_raise_error(aws_error);
         AWS_LOGF_TRACE(
@@ -1744,9 +2657,42 @@ int aws_socket_assign_to_event_loop(struct aws_socket *socket, struct aws_event_
     return aws_raise_error(AWS_IO_EVENT_LOOP_ALREADY_ASSIGNED);
 }
 
-struct aws_event_loop *aws_socket_get_event_loop(struct aws_socket *socket) {
-    return socket->event_loop;
-}
+int aws_socket_unassign_from_event_loop(struct aws_socket *socket) {
+    if (!socket->event_loop) {
+        return aws_raise_error(AWS_ERROR_INVALID_STATE);
+    }
+
+    if (!aws_event_loop_thread_is_callers_thread(socket->event_loop)) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_SOCKET,
+            "id=%p fd=%d: aws_socket_unassign_from_event_loop() must be called from the assigned loop's thread",
+            (void *)socket,
+            socket->io_handle.data.fd);
+        return aws_raise_error(AWS_ERROR_IO_EVENT_LOOP_THREAD_ONLY);
+    }
+
+    AWS_LOGF_DEBUG(
+        AWS_LS_IO_SOCKET,
+        "id=%p fd=%d: unassigning from event loop %p",
+        (void *)socket,
+        socket->io_handle.data.fd,
+        (void *)socket->event_loop);
+
+    struct posix_socket *socket_impl = socket->impl;
+    if (socket_impl->currently_subscribed) {
+        if (aws_event_loop_unsubscribe_from_io_events(socket->event_loop, &socket->io_handle)) {
+            return AWS_OP_ERR;
+        }
+        socket_impl->currently_subscribed = false;
+    }
+
+    socket->event_loop = NULL;
+    return AWS_OP_SUCCESS;
+}
+
+struct aws_event_loop *aws_socket_get_event_loop(struct aws_socket *socket) {
+    return socket->event_loop;
+}
 
 int aws_socket_subscribe_to_readable_events(
     struct aws_socket *socket,
@@ -1811,6 +2757,7 @@ int aws_socket_read(struct aws_socket *socket, struct aws_byte_buf *buffer, size
     if (read_val > 0) {
         *amount_read = (size_t)read_val;
         buffer->len += *amount_read;
+        AWS_IO_USDT_SOCKET_READ(socket->io_handle.data.fd, socket, *amount_read);
         return AWS_OP_SUCCESS;
     }
 
@@ -1855,11 +2802,246 @@ int aws_socket_read(struct aws_socket *socket, struct aws_byte_buf *buffer, size
     return aws_raise_error(s_determine_socket_error(errno_value));
 }
 
-int aws_socket_write(
+/* Shared validation for the SCM_RIGHTS send/receive paths. */
+static int s_validate_fd_passing_socket(struct aws_socket *socket, int connected_direction) {
+    if (!aws_event_loop_thread_is_callers_thread(socket->event_loop)) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_SOCKET,
+            "id=%p fd=%d: cannot pass descriptors from a different thread than event loop %p",
+            (void *)socket,
+            socket->io_handle.data.fd,
+            (void *)socket->event_loop);
+        return aws_raise_error(AWS_ERROR_IO_EVENT_LOOP_THREAD_ONLY);
+    }
+
+    if (socket->options.domain != AWS_SOCKET_LOCAL || socket->options.type != AWS_SOCKET_STREAM) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_SOCKET,
+            "id=%p fd=%d: descriptor passing requires a LOCAL stream socket",
+            (void *)socket,
+            socket->io_handle.data.fd);
+        return aws_raise_error(AWS_IO_SOCKET_INVALID_OPERATION_FOR_TYPE);
+    }
+
+    if (!(socket->state & connected_direction)) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_SOCKET,
+            "id=%p fd=%d: cannot pass descriptors because it is not connected",
+            (void *)socket,
+            socket->io_handle.data.fd);
+        return aws_raise_error(AWS_IO_SOCKET_NOT_CONNECTED);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+int aws_socket_send_fd(
+    struct aws_socket *socket,
+    const struct aws_byte_cursor *payload,
+    int fd_to_send,
+    size_t *amount_written) {
+    AWS_ASSERT(amount_written);
+    *amount_written = 0;
+
+    if (s_validate_fd_passing_socket(socket, CONNECTED_WRITE)) {
+        return AWS_OP_ERR;
+    }
+
+    /* the descriptor rides as ancillary data on the first payload byte; it cannot travel alone */
+    if (payload == NULL || payload->len == 0 || fd_to_send < 0) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    struct iovec iov = {
+        .iov_base = payload->ptr,
+        .iov_len = payload->len,
+    };
+
+    char control_storage[CMSG_SPACE(sizeof(int))];
+    AWS_ZERO_ARRAY(control_storage);
+
+    struct msghdr msg = {
+        .msg_iov = &iov,
+        .msg_iovlen = 1,
+        .msg_control = control_storage,
+        .msg_controllen = sizeof(control_storage),
+    };
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(cmsg), &fd_to_send, sizeof(int));
+
+    ssize_t written = sendmsg(socket->io_handle.data.fd, &msg, NO_SIGNAL_SEND);
+    int errno_value = errno; /* Always cache errno before potential side-effect */
+
+    if (written < 0) {
+#if defined(EWOULDBLOCK)
+        if (errno_value == EAGAIN || errno_value == EWOULDBLOCK) {
+#else
+        if (errno_value == EAGAIN) {
+#endif
+            AWS_LOGF_TRACE(
+                AWS_LS_IO_SOCKET, "id=%p fd=%d: sendmsg would block", (void *)socket, socket->io_handle.data.fd);
+            return aws_raise_error(AWS_IO_READ_WOULD_BLOCK);
+        }
+
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_SOCKET,
+            "id=%p fd=%d: sendmsg failed with error: %s",
+            (void *)socket,
+            socket->io_handle.data.fd,
+            strerror(errno_value));
+        return aws_raise_error(s_determine_socket_error(errno_value));
+    }
+
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_SOCKET,
+        "id=%p fd=%d: sent descriptor %d with %d payload bytes",
+        (void *)socket,
+        socket->io_handle.data.fd,
+        fd_to_send,
+        (int)written);
+
+    *amount_written = (size_t)written;
+    return AWS_OP_SUCCESS;
+}
+
+int aws_socket_read_with_fd(struct aws_socket *socket, struct aws_byte_buf *buffer, size_t *amount_read, int *out_fd) {
+    AWS_ASSERT(amount_read);
+    AWS_ASSERT(out_fd);
+    *out_fd = -1;
+
+    if (s_validate_fd_passing_socket(socket, CONNECTED_READ)) {
+        return AWS_OP_ERR;
+    }
+
+    struct iovec iov = {
+        .iov_base = buffer->buffer + buffer->len,
+        .iov_len = buffer->capacity - buffer->len,
+    };
+
+    char control_storage[CMSG_SPACE(sizeof(int))];
+    AWS_ZERO_ARRAY(control_storage);
+
+    struct msghdr msg = {
+        .msg_iov = &iov,
+        .msg_iovlen = 1,
+        .msg_control = control_storage,
+        .msg_controllen = sizeof(control_storage),
+    };
+
+#if defined(MSG_CMSG_CLOEXEC)
+    ssize_t read_val = recvmsg(socket->io_handle.data.fd, &msg, MSG_CMSG_CLOEXEC);
+#else
+    ssize_t read_val = recvmsg(socket->io_handle.data.fd, &msg, 0);
+#endif
+    int errno_value = errno; /* Always cache errno before potential side-effect */
+
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_SOCKET, "id=%p fd=%d: recvmsg of %d", (void *)socket, socket->io_handle.data.fd, (int)read_val);
+
+    if (read_val > 0) {
+        *amount_read = (size_t)read_val;
+        buffer->len += *amount_read;
+
+        for (struct cmsghdr *received_cmsg = CMSG_FIRSTHDR(&msg); received_cmsg != NULL;
+             received_cmsg = CMSG_NXTHDR(&msg, received_cmsg)) {
+            if (received_cmsg->cmsg_level == SOL_SOCKET && received_cmsg->cmsg_type == SCM_RIGHTS) {
+                memcpy(out_fd, CMSG_DATA(received_cmsg), sizeof(int));
+#if !defined(MSG_CMSG_CLOEXEC)
+                if (*out_fd >= 0) {
+                    fcntl(*out_fd, F_SETFD, FD_CLOEXEC);
+                }
+#endif
+                AWS_LOGF_TRACE(
+                    AWS_LS_IO_SOCKET,
+                    "id=%p fd=%d: received descriptor %d",
+                    (void *)socket,
+                    socket->io_handle.data.fd,
+                    *out_fd);
+                break;
+            }
+        }
+
+        if (msg.msg_flags & MSG_CTRUNC) {
+            AWS_LOGF_WARN(
+                AWS_LS_IO_SOCKET,
+                "id=%p fd=%d: ancillary data truncated; a passed descriptor may have been dropped",
+                (void *)socket,
+                socket->io_handle.data.fd);
+        }
+
+        return AWS_OP_SUCCESS;
+    }
+
+    /* read_val of 0 means EOF which we'll treat as AWS_IO_SOCKET_CLOSED */
+    if (read_val == 0) {
+        AWS_LOGF_INFO(
+            AWS_LS_IO_SOCKET, "id=%p fd=%d: zero read, socket is closed", (void *)socket, socket->io_handle.data.fd);
+        *amount_read = 0;
+
+        if (buffer->capacity - buffer->len > 0) {
+            return aws_raise_error(AWS_IO_SOCKET_CLOSED);
+        }
+
+        return AWS_OP_SUCCESS;
+    }
+
+#if defined(EWOULDBLOCK)
+    if (errno_value == EAGAIN || errno_value == EWOULDBLOCK) {
+#else
+    if (errno_value == EAGAIN) {
+#endif
+        AWS_LOGF_TRACE(AWS_LS_IO_SOCKET, "id=%p fd=%d: recvmsg would block", (void *)socket, socket->io_handle.data.fd);
+        return aws_raise_error(AWS_IO_READ_WOULD_BLOCK);
+    }
+
+    AWS_LOGF_ERROR(
+        AWS_LS_IO_SOCKET,
+        "id=%p fd=%d: recvmsg failed with error: %s",
+        (void *)socket,
+        socket->io_handle.data.fd,
+        strerror(errno_value));
+    return aws_raise_error(s_determine_socket_error(errno_value));
+}
+
+/* Urgent requests are inserted ahead of queued normal writes, but never ahead of the front request
+ * once the kernel has accepted part of it (that would corrupt the byte stream), and never ahead of
+ * earlier urgent requests (urgent writes stay FIFO relative to each other). */
+static void s_write_queue_insert(
+    struct posix_socket *socket_impl,
+    struct socket_write_request *write_request,
+    bool high_priority) {
+
+    write_request->high_priority = high_priority;
+
+    if (!high_priority) {
+        aws_linked_list_push_back(&socket_impl->write_queue, &write_request->node);
+        return;
+    }
+
+    struct aws_linked_list_node *node = aws_linked_list_begin(&socket_impl->write_queue);
+    while (node != aws_linked_list_end(&socket_impl->write_queue)) {
+        struct socket_write_request *queued = AWS_CONTAINER_OF(node, struct socket_write_request, node);
+        bool in_progress = (node == aws_linked_list_begin(&socket_impl->write_queue)) &&
+                           queued->cursor_cpy.len != queued->original_buffer_len;
+        if (!queued->high_priority && !in_progress) {
+            break;
+        }
+        node = aws_linked_list_next(node);
+    }
+
+    aws_linked_list_insert_before(node, &write_request->node);
+}
+
+static int s_socket_write_common(
     struct aws_socket *socket,
     const struct aws_byte_cursor *cursor,
     aws_socket_on_write_completed_fn *written_fn,
-    void *user_data) {
+    void *user_data,
+    bool high_priority) {
     if (!aws_event_loop_thread_is_callers_thread(socket->event_loop)) {
         return aws_raise_error(AWS_ERROR_IO_EVENT_LOOP_THREAD_ONLY);
     }
@@ -1882,13 +3064,289 @@ int aws_socket_write(
         return AWS_OP_ERR;
     }
 
+    AWS_IO_USDT_SOCKET_WRITE(socket->io_handle.data.fd, socket, cursor->len);
+
     write_request->original_buffer_len = cursor->len;
     write_request->written_fn = written_fn;
     write_request->write_user_data = user_data;
     write_request->cursor_cpy = *cursor;
+    s_write_queue_insert(socket_impl, write_request, high_priority);
+
+    return s_process_socket_write_requests(socket, write_request);
+}
+
+int aws_socket_write(
+    struct aws_socket *socket,
+    const struct aws_byte_cursor *cursor,
+    aws_socket_on_write_completed_fn *written_fn,
+    void *user_data) {
+    return s_socket_write_common(socket, cursor, written_fn, user_data, false /*high_priority*/);
+}
+
+int aws_socket_write_urgent(
+    struct aws_socket *socket,
+    const struct aws_byte_cursor *cursor,
+    aws_socket_on_write_completed_fn *written_fn,
+    void *user_data) {
+    return s_socket_write_common(socket, cursor, written_fn, user_data, true /*high_priority*/);
+}
+
+int aws_socket_write_file_region(
+    struct aws_socket *socket,
+    int file_fd,
+    uint64_t offset,
+    size_t length,
+    aws_socket_on_write_completed_fn *written_fn,
+    void *user_data) {
+#if AWS_SOCKET_HAVE_SENDFILE
+    if (!aws_event_loop_thread_is_callers_thread(socket->event_loop)) {
+        return aws_raise_error(AWS_ERROR_IO_EVENT_LOOP_THREAD_ONLY);
+    }
+
+    if (!(socket->state & CONNECTED_WRITE)) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_SOCKET,
+            "id=%p fd=%d: cannot write to because it is not connected",
+            (void *)socket,
+            socket->io_handle.data.fd);
+        return aws_raise_error(AWS_IO_SOCKET_NOT_CONNECTED);
+    }
+
+    AWS_ASSERT(written_fn);
+    struct posix_socket *socket_impl = socket->impl;
+    struct socket_write_request *write_request =
+        aws_mem_calloc(socket->allocator, 1, sizeof(struct socket_write_request));
+
+    if (!write_request) {
+        return AWS_OP_ERR;
+    }
+
+    write_request->original_buffer_len = length;
+    write_request->written_fn = written_fn;
+    write_request->write_user_data = user_data;
+    write_request->is_file_region = true;
+    write_request->file_fd = file_fd;
+    write_request->file_offset = offset;
+    write_request->cursor_cpy.len = length; /* remaining bytes; ptr stays NULL */
     aws_linked_list_push_back(&socket_impl->write_queue, &write_request->node);
 
     return s_process_socket_write_requests(socket, write_request);
+#else
+    (void)socket;
+    (void)file_fd;
+    (void)offset;
+    (void)length;
+    (void)written_fn;
+    (void)user_data;
+    return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+#endif /* AWS_SOCKET_HAVE_SENDFILE */
+}
+
+int aws_socket_read_datagrams(
+    struct aws_socket *socket,
+    struct aws_byte_buf *buffers,
+    size_t buffer_count,
+    size_t *num_received) {
+    AWS_ASSERT(num_received);
+    *num_received = 0;
+
+    if (!aws_event_loop_thread_is_callers_thread(socket->event_loop)) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_SOCKET,
+            "id=%p fd=%d: cannot read from a different thread than event loop %p",
+            (void *)socket,
+            socket->io_handle.data.fd,
+            (void *)socket->event_loop);
+        return aws_raise_error(AWS_ERROR_IO_EVENT_LOOP_THREAD_ONLY);
+    }
+
+    if (socket->options.type != AWS_SOCKET_DGRAM) {
+        return aws_raise_error(AWS_IO_SOCKET_ILLEGAL_OPERATION_FOR_STATE);
+    }
+
+    if (!(socket->state & CONNECTED_READ)) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_SOCKET,
+            "id=%p fd=%d: cannot read because it is not connected",
+            (void *)socket,
+            socket->io_handle.data.fd);
+        return aws_raise_error(AWS_IO_SOCKET_NOT_CONNECTED);
+    }
+
+    if (buffer_count > AWS_SOCKET_DGRAM_BATCH_SIZE) {
+        buffer_count = AWS_SOCKET_DGRAM_BATCH_SIZE;
+    }
+
+#if defined(__linux__)
+    struct mmsghdr msgs[AWS_SOCKET_DGRAM_BATCH_SIZE];
+    struct iovec iovs[AWS_SOCKET_DGRAM_BATCH_SIZE];
+
+    for (size_t i = 0; i < buffer_count; ++i) {
+        iovs[i].iov_base = buffers[i].buffer + buffers[i].len;
+        iovs[i].iov_len = buffers[i].capacity - buffers[i].len;
+        AWS_ZERO_STRUCT(msgs[i]);
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    int received = recvmmsg(socket->io_handle.data.fd, msgs, (unsigned int)buffer_count, 0, NULL);
+    int errno_value = errno; /* Always cache errno before potential side-effect */
+
+    if (received < 0) {
+#    if defined(EWOULDBLOCK)
+        if (errno_value == EAGAIN || errno_value == EWOULDBLOCK) {
+#    else
+        if (errno_value == EAGAIN) {
+#    endif
+            AWS_LOGF_TRACE(
+                AWS_LS_IO_SOCKET, "id=%p fd=%d: read would block", (void *)socket, socket->io_handle.data.fd);
+            return aws_raise_error(AWS_IO_READ_WOULD_BLOCK);
+        }
+
+        if (errno_value == EPIPE || errno_value == ECONNRESET) {
+            AWS_LOGF_INFO(
+                AWS_LS_IO_SOCKET, "id=%p fd=%d: socket is closed.", (void *)socket, socket->io_handle.data.fd);
+            return aws_raise_error(AWS_IO_SOCKET_CLOSED);
+        }
+
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_SOCKET,
+            "id=%p fd=%d: batched read failed with error: %s",
+            (void *)socket,
+            socket->io_handle.data.fd,
+            strerror(errno_value));
+        return aws_raise_error(s_determine_socket_error(errno_value));
+    }
+
+    for (int i = 0; i < received; ++i) {
+        buffers[i].len += msgs[i].msg_len;
+    }
+
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_SOCKET,
+        "id=%p fd=%d: read %d datagrams with one syscall",
+        (void *)socket,
+        socket->io_handle.data.fd,
+        received);
+
+    *num_received = (size_t)received;
+    return AWS_OP_SUCCESS;
+#else
+    /* no batched receive on this platform; fall back to one read per datagram */
+    for (size_t i = 0; i < buffer_count; ++i) {
+        size_t amount_read = 0;
+        if (aws_socket_read(socket, &buffers[i], &amount_read)) {
+            if (aws_last_error() == AWS_IO_READ_WOULD_BLOCK && *num_received > 0) {
+                /* the batch drained the socket; report what we got */
+                aws_reset_error();
+                return AWS_OP_SUCCESS;
+            }
+            return AWS_OP_ERR;
+        }
+        ++*num_received;
+    }
+    return AWS_OP_SUCCESS;
+#endif /* __linux__ */
+}
+
+int aws_socket_write_datagrams(
+    struct aws_socket *socket,
+    const struct aws_byte_cursor *datagrams,
+    size_t datagram_count,
+    size_t *num_sent) {
+    AWS_ASSERT(num_sent);
+    *num_sent = 0;
+
+    if (!aws_event_loop_thread_is_callers_thread(socket->event_loop)) {
+        return aws_raise_error(AWS_ERROR_IO_EVENT_LOOP_THREAD_ONLY);
+    }
+
+    if (socket->options.type != AWS_SOCKET_DGRAM) {
+        return aws_raise_error(AWS_IO_SOCKET_ILLEGAL_OPERATION_FOR_STATE);
+    }
+
+    if (!(socket->state & CONNECTED_WRITE)) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_SOCKET,
+            "id=%p fd=%d: cannot write to because it is not connected",
+            (void *)socket,
+            socket->io_handle.data.fd);
+        return aws_raise_error(AWS_IO_SOCKET_NOT_CONNECTED);
+    }
+
+    if (datagram_count > AWS_SOCKET_DGRAM_BATCH_SIZE) {
+        datagram_count = AWS_SOCKET_DGRAM_BATCH_SIZE;
+    }
+
+#if defined(__linux__)
+    struct mmsghdr msgs[AWS_SOCKET_DGRAM_BATCH_SIZE];
+    struct iovec iovs[AWS_SOCKET_DGRAM_BATCH_SIZE];
+
+    for (size_t i = 0; i < datagram_count; ++i) {
+        iovs[i].iov_base = (void *)datagrams[i].ptr;
+        iovs[i].iov_len = datagrams[i].len;
+        AWS_ZERO_STRUCT(msgs[i]);
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    int sent = sendmmsg(socket->io_handle.data.fd, msgs, (unsigned int)datagram_count, NO_SIGNAL_SEND);
+    int errno_value = errno; /* Always cache errno before potential side-effect */
+
+    if (sent < 0) {
+#    if defined(EWOULDBLOCK)
+        if (errno_value == EAGAIN || errno_value == EWOULDBLOCK) {
+#    else
+        if (errno_value == EAGAIN) {
+#    endif
+            AWS_LOGF_TRACE(
+                AWS_LS_IO_SOCKET, "id=%p fd=%d: write would block", (void *)socket, socket->io_handle.data.fd);
+            return AWS_OP_SUCCESS;
+        }
+
+        if (errno_value == EPIPE || errno_value == ECONNRESET) {
+            AWS_LOGF_INFO(
+                AWS_LS_IO_SOCKET, "id=%p fd=%d: socket is closed.", (void *)socket, socket->io_handle.data.fd);
+            return aws_raise_error(AWS_IO_SOCKET_CLOSED);
+        }
+
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_SOCKET,
+            "id=%p fd=%d: batched write failed with error: %s",
+            (void *)socket,
+            socket->io_handle.data.fd,
+            strerror(errno_value));
+        return aws_raise_error(s_determine_socket_error(errno_value));
+    }
+
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_SOCKET,
+        "id=%p fd=%d: sent %d datagrams with one syscall",
+        (void *)socket,
+        socket->io_handle.data.fd,
+        sent);
+
+    *num_sent = (size_t)sent;
+    return AWS_OP_SUCCESS;
+#else
+    /* no batched send on this platform; fall back to one send per datagram */
+    for (size_t i = 0; i < datagram_count; ++i) {
+        ssize_t sent = send(socket->io_handle.data.fd, datagrams[i].ptr, datagrams[i].len, NO_SIGNAL_SEND);
+        if (sent < 0) {
+            int errno_value = errno; /* Always cache errno before potential side-effect */
+#    if defined(EWOULDBLOCK)
+            if (errno_value == EAGAIN || errno_value == EWOULDBLOCK) {
+#    else
+            if (errno_value == EAGAIN) {
+#    endif
+                return AWS_OP_SUCCESS;
+            }
+            return aws_raise_error(s_determine_socket_error(errno_value));
+        }
+        ++*num_sent;
+    }
+    return AWS_OP_SUCCESS;
+#endif /* __linux__ */
 }
 
 int aws_socket_get_error(struct aws_socket *socket) {
@@ -1906,6 +3364,44 @@ int aws_socket_get_error(struct aws_socket *socket) {
     return AWS_OP_SUCCESS;
 }
 
+int aws_socket_fetch_transport_telemetry(
+    struct aws_socket *socket,
+    struct aws_socket_transport_telemetry *out_telemetry) {
+
+    AWS_ZERO_STRUCT(*out_telemetry);
+
+    if (socket->options.type != AWS_SOCKET_STREAM ||
+        (socket->options.domain != AWS_SOCKET_IPV4 && socket->options.domain != AWS_SOCKET_IPV6)) {
+        return aws_raise_error(AWS_IO_SOCKET_INVALID_OPERATION_FOR_TYPE);
+    }
+
+#if defined(__linux__)
+    struct tcp_info info;
+    socklen_t info_length = sizeof(info);
+    if (getsockopt(socket->io_handle.data.fd, IPPROTO_TCP, TCP_INFO, &info, &info_length) < 0) {
+        int errno_value = errno; /* Always cache errno before potential side-effect */
+        return aws_raise_error(s_determine_socket_error(errno_value));
+    }
+
+    /* the kernel reports rtt/rttvar in microseconds and cwnd in segments */
+    out_telemetry->round_trip_time_ns =
+        aws_timestamp_convert(info.tcpi_rtt, AWS_TIMESTAMP_MICROS, AWS_TIMESTAMP_NANOS, NULL);
+    out_telemetry->round_trip_time_variance_ns =
+        aws_timestamp_convert(info.tcpi_rttvar, AWS_TIMESTAMP_MICROS, AWS_TIMESTAMP_NANOS, NULL);
+    out_telemetry->retransmit_count = info.tcpi_total_retrans;
+    out_telemetry->congestion_window_bytes = (uint64_t)info.tcpi_snd_cwnd * info.tcpi_snd_mss;
+
+    int send_queue_bytes = 0;
+    if (ioctl(socket->io_handle.data.fd, SIOCOUTQ, &send_queue_bytes) == 0 && send_queue_bytes > 0) {
+        out_telemetry->kernel_send_queue_bytes = (uint64_t)send_queue_bytes;
+    }
+
+    return AWS_OP_SUCCESS;
+#else
+    return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+#endif /* __linux__ */
+}
+
 bool aws_socket_is_open(struct aws_socket *socket) {
     return socket->io_handle.data.fd >= 0;
 }
@@ -31,6 +31,24 @@ int aws_retry_strategy_acquire_retry_token(
     return retry_strategy->vtable->acquire_token(retry_strategy, partition_id, on_acquired, user_data, timeout_ms);
 }
 
+int aws_retry_strategy_acquire_retry_token_pinned(
+    struct aws_retry_strategy *retry_strategy,
+    const struct aws_byte_cursor *partition_id,
+    aws_retry_strategy_on_retry_token_acquired_fn *on_acquired,
+    void *user_data,
+    uint64_t timeout_ms,
+    struct aws_event_loop *pinned_event_loop) {
+    AWS_PRECONDITION(retry_strategy);
+    AWS_PRECONDITION(retry_strategy->vtable->acquire_token);
+
+    if (pinned_event_loop == NULL || retry_strategy->vtable->acquire_token_pinned == NULL) {
+        return retry_strategy->vtable->acquire_token(retry_strategy, partition_id, on_acquired, user_data, timeout_ms);
+    }
+
+    return retry_strategy->vtable->acquire_token_pinned(
+        retry_strategy, partition_id, on_acquired, user_data, timeout_ms, pinned_event_loop);
+}
+
 int aws_retry_strategy_schedule_retry(
     struct aws_retry_token *token,
     enum aws_retry_error_type error_type,
@@ -43,6 +61,17 @@ int aws_retry_strategy_schedule_retry(
     return token->retry_strategy->vtable->schedule_retry(token, error_type, retry_ready, user_data);
 }
 
+uint64_t aws_retry_token_get_send_delay_ns(const struct aws_retry_token *token) {
+    AWS_PRECONDITION(token);
+    AWS_PRECONDITION(token->retry_strategy);
+
+    if (token->retry_strategy->vtable->token_get_send_delay_ns == NULL) {
+        return 0;
+    }
+
+    return token->retry_strategy->vtable->token_get_send_delay_ns(token);
+}
+
 int aws_retry_token_record_success(struct aws_retry_token *token) {
     AWS_PRECONDITION(token);
     AWS_PRECONDITION(token->retry_strategy);
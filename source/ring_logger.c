@@ -0,0 +1,300 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/io/logging.h>
+
+#include <aws/common/atomics.h>
+#include <aws/common/byte_buf.h>
+#include <aws/common/clock.h>
+#include <aws/common/condition_variable.h>
+#include <aws/common/date_time.h>
+#include <aws/common/mutex.h>
+#include <aws/common/thread.h>
+
+#include <stdarg.h>
+#include <stdio.h>
+
+enum {
+    AWS_RING_LOGGER_DEFAULT_RECORDS = 1024,
+    /* long enough for every message this library emits; anything longer is truncated */
+    AWS_RING_LOGGER_MESSAGE_CAPACITY = 384,
+    AWS_RING_LOGGER_DRAIN_INTERVAL_MS = 50,
+};
+
+/* One slot of the ring. `sequence` implements the classic bounded MPSC protocol: a producer may
+ * claim the slot when sequence == its ticket, publishes with sequence = ticket + 1, and the drain
+ * thread recycles it with sequence = ticket + capacity. Everything but the message body stays
+ * binary; rendering it into text is the drain thread's job. */
+struct ring_log_record {
+    struct aws_atomic_var sequence;
+    struct aws_date_time timestamp;
+    aws_thread_id_t thread_id;
+    enum aws_log_level level;
+    aws_log_subject_t subject;
+    uint16_t message_len;
+    char message[AWS_RING_LOGGER_MESSAGE_CAPACITY];
+};
+
+struct ring_logger {
+    struct aws_allocator *allocator;
+    struct aws_atomic_var level;
+    struct ring_log_record *records;
+    size_t record_mask;
+    struct aws_atomic_var enqueue_pos;
+    size_t dequeue_pos; /* drain thread only */
+    struct aws_atomic_var dropped_count;
+    FILE *file;
+    bool owns_file;
+    struct aws_thread drain_thread;
+    struct aws_mutex drain_mutex;
+    struct aws_condition_variable drain_signal;
+    struct aws_atomic_var shutting_down;
+};
+
+static int s_ring_logger_log(
+    struct aws_logger *logger,
+    enum aws_log_level log_level,
+    aws_log_subject_t subject,
+    const char *format,
+    ...) {
+    struct ring_logger *impl = logger->p_impl;
+
+    size_t pos = aws_atomic_load_int(&impl->enqueue_pos);
+    struct ring_log_record *record = NULL;
+    for (;;) {
+        record = &impl->records[pos & impl->record_mask];
+        size_t sequence = aws_atomic_load_int(&record->sequence);
+
+        if (sequence == pos) {
+            if (aws_atomic_compare_exchange_int(&impl->enqueue_pos, &pos, pos + 1)) {
+                break;
+            }
+            /* pos was reloaded by the failed exchange; retry with it */
+        } else if (sequence < pos) {
+            /* ring is full: dropping beats stalling the event-loop thread. The drop count is
+             * reported in-line by the drain thread once the ring has room again. */
+            aws_atomic_fetch_add(&impl->dropped_count, 1);
+            return AWS_OP_SUCCESS;
+        } else {
+            pos = aws_atomic_load_int(&impl->enqueue_pos);
+        }
+    }
+
+    aws_date_time_init_now(&record->timestamp);
+    record->thread_id = aws_thread_current_thread_id();
+    record->level = log_level;
+    record->subject = subject;
+
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(record->message, AWS_RING_LOGGER_MESSAGE_CAPACITY, format, args);
+    va_end(args);
+
+    if (written < 0) {
+        written = 0;
+    } else if (written >= AWS_RING_LOGGER_MESSAGE_CAPACITY) {
+        written = AWS_RING_LOGGER_MESSAGE_CAPACITY - 1;
+    }
+    record->message_len = (uint16_t)written;
+
+    aws_atomic_store_int(&record->sequence, pos + 1);
+
+    return AWS_OP_SUCCESS;
+}
+
+static enum aws_log_level s_ring_logger_get_log_level(struct aws_logger *logger, aws_log_subject_t subject) {
+    (void)subject;
+    struct ring_logger *impl = logger->p_impl;
+    return (enum aws_log_level)aws_atomic_load_int(&impl->level);
+}
+
+static int s_ring_logger_set_log_level(struct aws_logger *logger, enum aws_log_level level) {
+    struct ring_logger *impl = logger->p_impl;
+    aws_atomic_store_int(&impl->level, (size_t)level);
+    return AWS_OP_SUCCESS;
+}
+
+static void s_ring_logger_drain(struct ring_logger *impl) {
+    bool wrote_anything = false;
+
+    for (;;) {
+        struct ring_log_record *record = &impl->records[impl->dequeue_pos & impl->record_mask];
+        if (aws_atomic_load_int(&record->sequence) != impl->dequeue_pos + 1) {
+            break;
+        }
+
+        const char *level_str = NULL;
+        aws_log_level_to_string(record->level, &level_str);
+
+        uint8_t date_storage[AWS_DATE_TIME_STR_MAX_LEN];
+        struct aws_byte_buf date_buf = aws_byte_buf_from_empty_array(date_storage, sizeof(date_storage));
+        aws_date_time_to_utc_time_str(&record->timestamp, AWS_DATE_FORMAT_ISO_8601, &date_buf);
+
+        char thread_id_str[AWS_THREAD_ID_T_REPR_BUFSZ];
+        aws_thread_id_t_to_string(record->thread_id, thread_id_str, AWS_THREAD_ID_T_REPR_BUFSZ);
+
+        fprintf(
+            impl->file,
+            "[%s] [%.*s] [%s] [%s] - %.*s\n",
+            level_str,
+            (int)date_buf.len,
+            date_buf.buffer,
+            thread_id_str,
+            aws_log_subject_name(record->subject),
+            (int)record->message_len,
+            record->message);
+        wrote_anything = true;
+
+        /* recycle the slot for the producer one full lap ahead */
+        aws_atomic_store_int(&record->sequence, impl->dequeue_pos + impl->record_mask + 1);
+        impl->dequeue_pos++;
+    }
+
+    size_t dropped = aws_atomic_exchange_int(&impl->dropped_count, 0);
+    if (dropped > 0) {
+        fprintf(impl->file, "[WARN] ring logger dropped %zu records; producers outran the drain thread\n", dropped);
+        wrote_anything = true;
+    }
+
+    if (wrote_anything) {
+        fflush(impl->file);
+    }
+}
+
+static void s_ring_logger_drain_thread(void *arg) {
+    struct ring_logger *impl = arg;
+
+    uint64_t wait_nanos = aws_timestamp_convert(
+        AWS_RING_LOGGER_DRAIN_INTERVAL_MS, AWS_TIMESTAMP_MILLIS, AWS_TIMESTAMP_NANOS, NULL);
+
+    while (!aws_atomic_load_int(&impl->shutting_down)) {
+        s_ring_logger_drain(impl);
+
+        aws_mutex_lock(&impl->drain_mutex);
+        if (!aws_atomic_load_int(&impl->shutting_down)) {
+            aws_condition_variable_wait_for(&impl->drain_signal, &impl->drain_mutex, (int64_t)wait_nanos);
+        }
+        aws_mutex_unlock(&impl->drain_mutex);
+    }
+
+    /* final drain so nothing published before shutdown is lost */
+    s_ring_logger_drain(impl);
+}
+
+static void s_ring_logger_clean_up(struct aws_logger *logger) {
+    struct ring_logger *impl = logger->p_impl;
+
+    aws_atomic_store_int(&impl->shutting_down, 1);
+    aws_mutex_lock(&impl->drain_mutex);
+    aws_condition_variable_notify_one(&impl->drain_signal);
+    aws_mutex_unlock(&impl->drain_mutex);
+
+    aws_thread_join(&impl->drain_thread);
+    aws_thread_clean_up(&impl->drain_thread);
+
+    if (impl->owns_file && impl->file) {
+        fclose(impl->file);
+    }
+
+    aws_condition_variable_clean_up(&impl->drain_signal);
+    aws_mutex_clean_up(&impl->drain_mutex);
+    aws_mem_release(impl->allocator, impl->records);
+    aws_mem_release(impl->allocator, impl);
+
+    AWS_ZERO_STRUCT(*logger);
+}
+
+static struct aws_logger_vtable s_ring_logger_vtable = {
+    .log = s_ring_logger_log,
+    .get_log_level = s_ring_logger_get_log_level,
+    .set_log_level = s_ring_logger_set_log_level,
+    .clean_up = s_ring_logger_clean_up,
+};
+
+int aws_logger_init_ring(
+    struct aws_logger *logger,
+    struct aws_allocator *allocator,
+    const struct aws_ring_logger_options *options) {
+    AWS_PRECONDITION(logger);
+    AWS_PRECONDITION(allocator);
+    AWS_PRECONDITION(options);
+
+    size_t capacity = options->max_records != 0 ? options->max_records : AWS_RING_LOGGER_DEFAULT_RECORDS;
+    /* round up to a power of two so slot selection is a mask */
+    size_t rounded_capacity = 1;
+    while (rounded_capacity < capacity) {
+        rounded_capacity <<= 1;
+    }
+
+    struct ring_logger *impl = aws_mem_calloc(allocator, 1, sizeof(struct ring_logger));
+    if (!impl) {
+        return AWS_OP_ERR;
+    }
+
+    impl->allocator = allocator;
+    impl->records = aws_mem_calloc(allocator, rounded_capacity, sizeof(struct ring_log_record));
+    if (!impl->records) {
+        goto error_free_impl;
+    }
+
+    impl->record_mask = rounded_capacity - 1;
+    for (size_t i = 0; i < rounded_capacity; ++i) {
+        aws_atomic_init_int(&impl->records[i].sequence, i);
+    }
+    aws_atomic_init_int(&impl->level, (size_t)options->level);
+    aws_atomic_init_int(&impl->enqueue_pos, 0);
+    aws_atomic_init_int(&impl->dropped_count, 0);
+    aws_atomic_init_int(&impl->shutting_down, 0);
+
+    if (options->filename != NULL) {
+        impl->file = fopen(options->filename, "a");
+        if (!impl->file) {
+            aws_raise_error(AWS_ERROR_FILE_INVALID_PATH);
+            goto error_free_records;
+        }
+        impl->owns_file = true;
+    } else if (options->file != NULL) {
+        impl->file = options->file;
+    } else {
+        impl->file = stderr;
+    }
+
+    if (aws_mutex_init(&impl->drain_mutex)) {
+        goto error_close_file;
+    }
+
+    if (aws_condition_variable_init(&impl->drain_signal)) {
+        goto error_clean_up_mutex;
+    }
+
+    if (aws_thread_init(&impl->drain_thread, allocator)) {
+        goto error_clean_up_condition_variable;
+    }
+
+    if (aws_thread_launch(&impl->drain_thread, s_ring_logger_drain_thread, impl, NULL)) {
+        aws_thread_clean_up(&impl->drain_thread);
+        goto error_clean_up_condition_variable;
+    }
+
+    logger->vtable = &s_ring_logger_vtable;
+    logger->allocator = allocator;
+    logger->p_impl = impl;
+
+    return AWS_OP_SUCCESS;
+
+error_clean_up_condition_variable:
+    aws_condition_variable_clean_up(&impl->drain_signal);
+error_clean_up_mutex:
+    aws_mutex_clean_up(&impl->drain_mutex);
+error_close_file:
+    if (impl->owns_file && impl->file) {
+        fclose(impl->file);
+    }
+error_free_records:
+    aws_mem_release(allocator, impl->records);
+error_free_impl:
+    aws_mem_release(allocator, impl);
+    return AWS_OP_ERR;
+}
@@ -27,6 +27,15 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#if defined(USE_KTLS)
+#    include <aws/io/socket.h>
+#    include <aws/io/socket_channel_handler.h>
+
+#    include <s2n/unstable/ktls.h>
+#endif
+
+#include <s2n/unstable/cert_validation.h>
+
 #define EST_TLS_RECORD_OVERHEAD 53 /* 5 byte header + 32 + 16 bytes for padding */
 #define KB_1 1024
 #define MAX_RECORD_SIZE (KB_1 * 16)
@@ -58,12 +67,31 @@ struct s2n_handler {
     aws_tls_on_error_fn *on_error;
     void *user_data;
     bool advertise_alpn_message;
+    /* Client-only: writes that arrived before negotiation completed, awaiting transmission as 0-RTT early data. */
+    struct aws_linked_list early_data_queue;
+    bool early_data_enabled;
+    enum aws_tls_early_data_status early_data_status;
+    /* True once record protection has been handed off to the kernel; the handler is then pass-through. */
+    bool ktls_active;
+    /* High-res timestamp taken when negotiation suspended on an offloaded key/validation operation;
+     * drained into stats.handshake_key_op_ns on the next drive. Zero when not suspended. */
+    uint64_t negotiation_suspended_ns;
     enum {
         NEGOTIATION_ONGOING,
         NEGOTIATION_FAILED,
         NEGOTIATION_SUCCEEDED,
     } state;
     struct s2n_delayed_shutdown_task delayed_shutdown_task;
+    /*
+     * Small-write coalescing.  Sub-record plaintext writes are copied into coalesce_buf and their messages
+     * parked on coalesce_pending_messages; a task flushes the accumulated bytes through s2n_send as a single
+     * record at the end of the tick (or sooner, once a full record accumulates), so one AEAD operation and one
+     * record's framing cover the whole batch instead of every small message paying for its own.
+     */
+    struct aws_byte_buf coalesce_buf;
+    struct aws_linked_list coalesce_pending_messages;
+    struct aws_channel_task coalesce_flush_task;
+    bool coalesce_flush_scheduled;
 };
 
 struct s2n_ctx {
@@ -82,6 +110,19 @@ struct s2n_ctx {
      * See aws_custom_key_op_handler in tls_channel_handler.h for more details.
      */
     struct aws_custom_key_op_handler *custom_key_handler;
+
+    /* Non-NULL when the user enabled session resumption; sessions are keyed by server name. */
+    struct aws_tls_session_cache *session_cache;
+
+    bool ktls_offload_enabled;
+
+    /* When set, the application finishes chain validation asynchronously; see aws_tls_on_chain_validation_fn. */
+    aws_tls_on_chain_validation_fn *on_chain_validation;
+    void *chain_validation_user_data;
+
+    /* When set, chain validation verdicts are recorded in the process-wide verification cache and repeat
+     * handshakes with a cached, unexpired verdict skip the application's validation callback. */
+    bool verification_cache_enabled;
 };
 
 struct aws_tls_key_operation {
@@ -98,6 +139,19 @@ struct aws_tls_key_operation {
     struct aws_atomic_var complete_count;
 };
 
+struct aws_tls_chain_validation_operation {
+    struct aws_allocator *alloc;
+    struct s2n_cert_validation_info *validation_info;
+    struct s2n_handler *s2n_handler;
+    struct aws_channel_task completion_task;
+    int completion_error_code;
+
+    /* When non-empty, the verdict is recorded in the process-wide verification cache under this key. */
+    struct aws_byte_buf verdict_key;
+
+    struct aws_atomic_var complete_count;
+};
+
 AWS_STATIC_STRING_FROM_LITERAL(s_debian_path, "/etc/ssl/certs");
 AWS_STATIC_STRING_FROM_LITERAL(s_rhel_path, "/etc/pki/tls/certs");
 AWS_STATIC_STRING_FROM_LITERAL(s_android_path, "/system/etc/security/cacerts");
@@ -249,6 +303,8 @@ void aws_tls_init_static_state(struct aws_allocator *alloc) {
 }
 
 void aws_tls_clean_up_static_state(void) {
+    aws_tls_verification_cache_clean_up();
+
     /* only clean up s2n if we were the ones that initialized it */
     if (!s_s2n_initialized_externally) {
         s2n_cleanup();
@@ -373,9 +429,31 @@ static int s_s2n_handler_send(void *io_context, const uint8_t *buf, uint32_t len
     return s_generic_send(handler, &send_buf);
 }
 
+static void s_fail_pending_early_data(struct s2n_handler *s2n_handler, int error_code) {
+    while (!aws_linked_list_empty(&s2n_handler->early_data_queue)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&s2n_handler->early_data_queue);
+        struct aws_io_message *message = AWS_CONTAINER_OF(node, struct aws_io_message, queueing_handle);
+        if (message->on_completion) {
+            message->on_completion(s2n_handler->slot->channel, message, error_code, message->user_data);
+        }
+        aws_mem_release(message->allocator, message);
+    }
+}
+
 static void s_s2n_handler_destroy(struct aws_channel_handler *handler) {
     if (handler) {
         struct s2n_handler *s2n_handler = (struct s2n_handler *)handler->impl;
+        while (!aws_linked_list_empty(&s2n_handler->early_data_queue)) {
+            struct aws_linked_list_node *node = aws_linked_list_pop_front(&s2n_handler->early_data_queue);
+            struct aws_io_message *message = AWS_CONTAINER_OF(node, struct aws_io_message, queueing_handle);
+            aws_mem_release(message->allocator, message);
+        }
+        while (!aws_linked_list_empty(&s2n_handler->coalesce_pending_messages)) {
+            struct aws_linked_list_node *node = aws_linked_list_pop_front(&s2n_handler->coalesce_pending_messages);
+            struct aws_io_message *message = AWS_CONTAINER_OF(node, struct aws_io_message, queueing_handle);
+            aws_mem_release(message->allocator, message);
+        }
+        aws_byte_buf_clean_up(&s2n_handler->coalesce_buf);
         aws_tls_channel_handler_shared_clean_up(&s2n_handler->shared_state);
         if (s2n_handler->connection) {
             s2n_connection_free(s2n_handler->connection);
@@ -402,6 +480,120 @@ static void s_on_negotiation_result(
     }
 }
 
+#if defined(USE_KTLS)
+/*
+ * Hands record protection off to the kernel (TCP_ULP/SOL_TLS on the socket fd, configured by s2n). On success the
+ * handler becomes pass-through: plaintext flows straight between the socket slot and the application slots while
+ * the kernel does the crypto, which also makes sendfile-style transfers possible on the underlying fd. Failure is
+ * not fatal; the connection simply continues with userspace record processing.
+ */
+static void s_try_enable_ktls(struct aws_channel_handler *handler) {
+    struct s2n_handler *s2n_handler = (struct s2n_handler *)handler->impl;
+
+    struct aws_channel_slot *socket_slot = s2n_handler->slot->adj_left;
+    const struct aws_socket *socket =
+        socket_slot != NULL && socket_slot->handler != NULL ? aws_socket_handler_get_socket(socket_slot->handler)
+                                                            : NULL;
+    if (socket == NULL) {
+        AWS_LOGF_WARN(
+            AWS_LS_IO_TLS,
+            "id=%p: kTLS offload requested but no socket handler is adjacent; continuing with userspace TLS",
+            (void *)handler);
+        return;
+    }
+
+    /* Point s2n at the raw fd so the kTLS enable calls can configure it. This replaces our custom IO callbacks,
+     * which must be restored if the handoff fails. */
+    if (s2n_connection_set_fd(s2n_handler->connection, socket->io_handle.data.fd) != S2N_SUCCESS) {
+        AWS_LOGF_WARN(
+            AWS_LS_IO_TLS,
+            "id=%p: kTLS offload failed to bind fd: %s; continuing with userspace TLS",
+            (void *)handler,
+            s2n_strerror(s2n_errno, "EN"));
+        return;
+    }
+
+    if (s2n_connection_ktls_enable_send(s2n_handler->connection) != S2N_SUCCESS ||
+        s2n_connection_ktls_enable_recv(s2n_handler->connection) != S2N_SUCCESS) {
+        AWS_LOGF_WARN(
+            AWS_LS_IO_TLS,
+            "id=%p: kTLS offload unavailable: %s; continuing with userspace TLS",
+            (void *)handler,
+            s2n_strerror(s2n_errno, "EN"));
+
+        s2n_connection_set_recv_cb(s2n_handler->connection, s_s2n_handler_recv);
+        s2n_connection_set_recv_ctx(s2n_handler->connection, s2n_handler);
+        s2n_connection_set_send_cb(s2n_handler->connection, s_s2n_handler_send);
+        s2n_connection_set_send_ctx(s2n_handler->connection, s2n_handler);
+        return;
+    }
+
+    s2n_handler->ktls_active = true;
+    AWS_LOGF_INFO(
+        AWS_LS_IO_TLS, "id=%p: kTLS offload enabled, record protection is now in the kernel", (void *)handler);
+}
+#endif /* USE_KTLS */
+
+/*
+ * Sends queued pre-negotiation writes as TLS 1.3 0-RTT early data. s2n_send_early_data drives the handshake as far
+ * as needed, so the first call here also flushes the ClientHello. copy_mark tracks how much of the front message has
+ * already been handed to s2n across blocked retries.
+ */
+static int s_flush_early_data(struct aws_channel_handler *handler, bool *out_blocked) {
+    struct s2n_handler *s2n_handler = (struct s2n_handler *)handler->impl;
+    *out_blocked = false;
+
+    while (!aws_linked_list_empty(&s2n_handler->early_data_queue)) {
+        struct aws_linked_list_node *node = aws_linked_list_front(&s2n_handler->early_data_queue);
+        struct aws_io_message *message = AWS_CONTAINER_OF(node, struct aws_io_message, queueing_handle);
+
+        ssize_t data_sent = 0;
+        s2n_blocked_status blocked = S2N_NOT_BLOCKED;
+        int send_code = s2n_send_early_data(
+            s2n_handler->connection,
+            message->message_data.buffer + message->copy_mark,
+            (ssize_t)(message->message_data.len - message->copy_mark),
+            &data_sent,
+            &blocked);
+
+        if (data_sent > 0) {
+            message->copy_mark += (size_t)data_sent;
+            AWS_LOGF_TRACE(
+                AWS_LS_IO_TLS,
+                "id=%p: %lld bytes written as early data",
+                (void *)handler,
+                (long long)data_sent);
+        }
+
+        if (send_code != S2N_SUCCESS) {
+            if (s2n_error_get_type(s2n_errno) == S2N_ERR_T_BLOCKED) {
+                *out_blocked = true;
+                return AWS_OP_SUCCESS;
+            }
+
+            AWS_LOGF_WARN(
+                AWS_LS_IO_TLS,
+                "id=%p: early data send failed with error %s (%s)",
+                (void *)handler,
+                s2n_strerror(s2n_errno, "EN"),
+                s2n_strerror_debug(s2n_errno, "EN"));
+            s2n_handler->early_data_enabled = false;
+            s_fail_pending_early_data(s2n_handler, AWS_IO_TLS_ERROR_WRITE_FAILURE);
+            return aws_raise_error(AWS_IO_TLS_ERROR_WRITE_FAILURE);
+        }
+
+        if (message->copy_mark == message->message_data.len) {
+            aws_linked_list_remove(node);
+            if (message->on_completion) {
+                message->on_completion(s2n_handler->slot->channel, message, AWS_ERROR_SUCCESS, message->user_data);
+            }
+            aws_mem_release(message->allocator, message);
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
 static int s_drive_negotiation(struct aws_channel_handler *handler) {
     struct s2n_handler *s2n_handler = (struct s2n_handler *)handler->impl;
 
@@ -409,11 +601,39 @@ static int s_drive_negotiation(struct aws_channel_handler *handler) {
 
     aws_on_drive_tls_negotiation(&s2n_handler->shared_state);
 
+    if (s2n_handler->negotiation_suspended_ns != 0) {
+        uint64_t resumed_ns = 0;
+        aws_high_res_clock_get_ticks(&resumed_ns);
+        if (resumed_ns > s2n_handler->negotiation_suspended_ns) {
+            s2n_handler->shared_state.stats.handshake_key_op_ns += resumed_ns - s2n_handler->negotiation_suspended_ns;
+        }
+        s2n_handler->negotiation_suspended_ns = 0;
+    }
+
+    if (s2n_handler->early_data_enabled && !aws_linked_list_empty(&s2n_handler->early_data_queue)) {
+        bool early_data_blocked = false;
+        if (s_flush_early_data(handler, &early_data_blocked) == AWS_OP_SUCCESS && early_data_blocked) {
+            /* Waiting on the peer before more early data (or the rest of the handshake) can proceed. */
+            return AWS_OP_SUCCESS;
+        }
+    }
+
     s2n_blocked_status blocked = S2N_NOT_BLOCKED;
     do {
+        uint64_t negotiate_start_ns = 0;
+        aws_high_res_clock_get_ticks(&negotiate_start_ns);
+
         int negotiation_code = s2n_negotiate(s2n_handler->connection, &blocked);
 
         int s2n_error = s2n_errno;
+
+        /* Attribute the time spent inside s2n itself (record processing plus asymmetric crypto)
+         * separately from network waits and offloaded key operations. */
+        uint64_t negotiate_end_ns = 0;
+        aws_high_res_clock_get_ticks(&negotiate_end_ns);
+        if (negotiate_end_ns > negotiate_start_ns) {
+            s2n_handler->shared_state.stats.handshake_crypto_ns += negotiate_end_ns - negotiate_start_ns;
+        }
         if (negotiation_code == S2N_ERR_T_OK) {
             s2n_handler->state = NEGOTIATION_SUCCEEDED;
 
@@ -430,6 +650,69 @@ static int s_drive_negotiation(struct aws_channel_handler *handler) {
                 s2n_handler->server_name = aws_byte_buf_from_c_str(server_name);
             }
 
+            /* TLS 1.2 delivers resumption state as part of the handshake; store it now. TLS 1.3 tickets arrive
+             * post-handshake through s_s2n_session_ticket_received. */
+            if (s2n_handler->s2n_ctx->session_cache != NULL && server_name != NULL) {
+                int session_length = s2n_connection_get_session_length(s2n_handler->connection);
+                if (session_length > 0) {
+                    struct aws_byte_buf session_buf;
+                    if (aws_byte_buf_init(&session_buf, handler->alloc, (size_t)session_length) == AWS_OP_SUCCESS) {
+                        int copied = s2n_connection_get_session(
+                            s2n_handler->connection, session_buf.buffer, session_buf.capacity);
+                        if (copied > 0) {
+                            session_buf.len = (size_t)copied;
+                            if (aws_tls_session_cache_put(
+                                    s2n_handler->s2n_ctx->session_cache,
+                                    aws_byte_cursor_from_c_str(server_name),
+                                    aws_byte_cursor_from_buf(&session_buf)) == AWS_OP_SUCCESS) {
+                                AWS_LOGF_DEBUG(
+                                    AWS_LS_IO_TLS,
+                                    "id=%p: cached %d byte session for %s",
+                                    (void *)handler,
+                                    copied,
+                                    server_name);
+                            }
+                        }
+                        aws_byte_buf_clean_up_secure(&session_buf);
+                    }
+                }
+            }
+
+            if (s2n_handler->early_data_enabled) {
+                s2n_early_data_status_t early_status = S2N_EARLY_DATA_STATUS_NOT_REQUESTED;
+                if (s2n_connection_get_early_data_status(s2n_handler->connection, &early_status) == S2N_SUCCESS) {
+                    switch (early_status) {
+                        case S2N_EARLY_DATA_STATUS_OK:
+                        case S2N_EARLY_DATA_STATUS_END_OF_DATA:
+                            s2n_handler->early_data_status = AWS_TLS_EARLY_DATA_STATUS_ACCEPTED;
+                            break;
+                        case S2N_EARLY_DATA_STATUS_REJECTED:
+                            s2n_handler->early_data_status = AWS_TLS_EARLY_DATA_STATUS_REJECTED;
+                            break;
+                        default:
+                            s2n_handler->early_data_status = AWS_TLS_EARLY_DATA_STATUS_NONE;
+                            break;
+                    }
+                }
+
+                if (s2n_handler->early_data_status == AWS_TLS_EARLY_DATA_STATUS_REJECTED) {
+                    AWS_LOGF_WARN(
+                        AWS_LS_IO_TLS,
+                        "id=%p: server rejected early data; the caller must replay it",
+                        (void *)handler);
+                    s_fail_pending_early_data(s2n_handler, AWS_IO_TLS_EARLY_DATA_REJECTED);
+                }
+            }
+
+            /* The handshake's hash/transcript state (several KB per connection) is dead weight from here on. */
+            s2n_connection_free_handshake(s2n_handler->connection);
+
+#if defined(USE_KTLS)
+            if (s2n_handler->s2n_ctx->ktls_offload_enabled) {
+                s_try_enable_ktls(handler);
+            }
+#endif
+
             if (s2n_handler->slot->adj_right && s2n_handler->advertise_alpn_message && protocol) {
                 struct aws_io_message *message = aws_channel_acquire_message_from_pool(
                     s2n_handler->slot->channel,
@@ -481,6 +764,12 @@ static int s_drive_negotiation(struct aws_channel_handler *handler) {
         }
     } while (blocked == S2N_NOT_BLOCKED);
 
+    /* Blocked on application input means an async pkey or chain-validation operation is in flight;
+     * its completion task re-enters this function, which drains the suspension into the stats. */
+    if (s2n_handler->state == NEGOTIATION_ONGOING && blocked == S2N_BLOCKED_ON_APPLICATION_INPUT) {
+        aws_high_res_clock_get_ticks(&s2n_handler->negotiation_suspended_ns);
+    }
+
     return AWS_OP_SUCCESS;
 }
 
@@ -515,6 +804,8 @@ int aws_tls_client_handler_start_negotiation(struct aws_channel_handler *handler
     return AWS_OP_SUCCESS;
 }
 
+static void s_run_read(struct aws_channel_task *task, void *arg, aws_task_status status);
+
 static int s_s2n_handler_process_read_message(
     struct aws_channel_handler *handler,
     struct aws_channel_slot *slot,
@@ -526,6 +817,20 @@ static int s_s2n_handler_process_read_message(
         return aws_raise_error(AWS_IO_TLS_ERROR_NEGOTIATION_FAILURE);
     }
 
+    if (s2n_handler->ktls_active && message != NULL) {
+        /* The kernel already decrypted this data; pass the plaintext along without touching s2n. */
+        if (s2n_handler->on_data_read) {
+            s2n_handler->on_data_read(handler, slot, &message->message_data, s2n_handler->user_data);
+        }
+
+        if (slot->adj_right) {
+            return aws_channel_slot_send_message(slot, message, AWS_CHANNEL_DIR_READ);
+        }
+
+        aws_mem_release(message->allocator, message);
+        return AWS_OP_SUCCESS;
+    }
+
     if (message) {
         aws_linked_list_push_back(&s2n_handler->input_queue, &message->queueing_handle);
 
@@ -547,10 +852,17 @@ static int s_s2n_handler_process_read_message(
     }
 
     size_t processed = 0;
+    bool budget_yield = false;
     AWS_LOGF_TRACE(
         AWS_LS_IO_TLS, "id=%p: Downstream window %llu", (void *)handler, (unsigned long long)downstream_window);
 
     while (processed < downstream_window) {
+        /* cooperative tick budget: once at least one record made it downstream, yield to the
+         * loop's other channels and pick the decrypt loop back up from a task. */
+        if (processed > 0 && aws_event_loop_tick_budget_exhausted(aws_channel_get_event_loop(slot->channel))) {
+            budget_yield = true;
+            break;
+        }
 
         struct aws_io_message *outgoing_read_message = aws_channel_acquire_message_from_pool(
             slot->channel, AWS_IO_MESSAGE_APPLICATION_DATA, downstream_window - processed);
@@ -617,6 +929,20 @@ static int s_s2n_handler_process_read_message(
         }
     }
 
+    if (budget_yield && !s2n_handler->sequential_tasks.node.next) {
+        AWS_LOGF_TRACE(
+            AWS_LS_IO_TLS,
+            "id=%p: loop's tick budget exhausted mid-decrypt. Scheduling a task to resume on next tick.",
+            (void *)handler);
+        aws_channel_task_init(
+            &s2n_handler->sequential_tasks, s_run_read, handler, "s2n_channel_handler_read_budget_yield");
+        aws_channel_schedule_task_now(slot->channel, &s2n_handler->sequential_tasks);
+    }
+
+    /* Best effort: succeeds only when no partial record is pending, in which case the per-connection read buffers
+     * go back to s2n's allocator until the next record arrives. */
+    s2n_connection_release_buffers(s2n_handler->connection);
+
     AWS_LOGF_TRACE(
         AWS_LS_IO_TLS,
         "id=%p: Remaining window for this event-loop tick: %llu",
@@ -626,17 +952,196 @@ static int s_s2n_handler_process_read_message(
     return AWS_OP_SUCCESS;
 }
 
+/* Holds a flushed batch's original messages until the ciphertext carrying them completes downstream. */
+struct s2n_coalesced_write_batch {
+    struct aws_allocator *allocator;
+    struct aws_linked_list messages;
+};
+
+static void s_complete_coalesced_batch(
+    struct s2n_coalesced_write_batch *batch,
+    struct aws_channel *channel,
+    int error_code) {
+    while (!aws_linked_list_empty(&batch->messages)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&batch->messages);
+        struct aws_io_message *message = AWS_CONTAINER_OF(node, struct aws_io_message, queueing_handle);
+        if (message->on_completion) {
+            message->on_completion(channel, message, error_code, message->user_data);
+        }
+        aws_mem_release(message->allocator, message);
+    }
+
+    aws_mem_release(batch->allocator, batch);
+}
+
+static void s_coalesced_batch_on_write_completed(
+    struct aws_channel *channel,
+    struct aws_io_message *message,
+    int err_code,
+    void *user_data) {
+    (void)message;
+
+    s_complete_coalesced_batch(user_data, channel, err_code);
+}
+
+static void s_fail_pending_coalesced_writes(struct s2n_handler *s2n_handler, int error_code) {
+    aws_byte_buf_reset(&s2n_handler->coalesce_buf, false);
+
+    while (!aws_linked_list_empty(&s2n_handler->coalesce_pending_messages)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&s2n_handler->coalesce_pending_messages);
+        struct aws_io_message *message = AWS_CONTAINER_OF(node, struct aws_io_message, queueing_handle);
+        if (message->on_completion) {
+            message->on_completion(s2n_handler->slot->channel, message, error_code, message->user_data);
+        }
+        aws_mem_release(message->allocator, message);
+    }
+}
+
+static int s_flush_coalesced_writes(struct aws_channel_handler *handler) {
+    struct s2n_handler *s2n_handler = (struct s2n_handler *)handler->impl;
+
+    if (s2n_handler->coalesce_buf.len == 0) {
+        return AWS_OP_SUCCESS;
+    }
+
+    struct s2n_coalesced_write_batch *batch =
+        aws_mem_calloc(handler->alloc, 1, sizeof(struct s2n_coalesced_write_batch));
+    batch->allocator = handler->alloc;
+    aws_linked_list_init(&batch->messages);
+    aws_linked_list_swap_contents(&batch->messages, &s2n_handler->coalesce_pending_messages);
+
+    s2n_handler->latest_message_on_completion = s_coalesced_batch_on_write_completed;
+    s2n_handler->latest_message_completion_user_data = batch;
+
+    s2n_blocked_status blocked;
+    ssize_t flush_len = (ssize_t)s2n_handler->coalesce_buf.len;
+    ssize_t write_code =
+        s2n_send(s2n_handler->connection, s2n_handler->coalesce_buf.buffer, flush_len, &blocked);
+
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_TLS,
+        "id=%p: Flushed %lld coalesced bytes as a single record, wrote %lld",
+        (void *)handler,
+        (long long)flush_len,
+        (long long)write_code);
+
+    aws_byte_buf_reset(&s2n_handler->coalesce_buf, false);
+
+    if (write_code < flush_len) {
+        /* if the batch was never attached to an outgoing ciphertext message, it is still ours to fail here;
+         * otherwise the downstream write completion will deliver the error */
+        if (s2n_handler->latest_message_on_completion == s_coalesced_batch_on_write_completed) {
+            s2n_handler->latest_message_on_completion = NULL;
+            s2n_handler->latest_message_completion_user_data = NULL;
+            s_complete_coalesced_batch(batch, s2n_handler->slot->channel, AWS_IO_TLS_ERROR_WRITE_FAILURE);
+        }
+        return aws_raise_error(AWS_IO_TLS_ERROR_WRITE_FAILURE);
+    }
+
+    if (blocked == S2N_NOT_BLOCKED) {
+        s2n_connection_release_buffers(s2n_handler->connection);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static void s_coalesce_flush_task_fn(struct aws_channel_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    struct aws_channel_handler *handler = arg;
+    struct s2n_handler *s2n_handler = (struct s2n_handler *)handler->impl;
+
+    s2n_handler->coalesce_flush_scheduled = false;
+
+    if (status != AWS_TASK_STATUS_RUN_READY) {
+        s_fail_pending_coalesced_writes(s2n_handler, AWS_IO_TLS_ERROR_WRITE_FAILURE);
+        return;
+    }
+
+    if (s_flush_coalesced_writes(handler)) {
+        aws_channel_shutdown(s2n_handler->slot->channel, aws_last_error());
+    }
+}
+
+static int s_s2n_handler_coalesce_write(struct aws_channel_handler *handler, struct aws_io_message *message) {
+    struct s2n_handler *s2n_handler = (struct s2n_handler *)handler->impl;
+
+    if (s2n_handler->coalesce_buf.capacity == 0 &&
+        aws_byte_buf_init(&s2n_handler->coalesce_buf, handler->alloc, MAX_RECORD_SIZE)) {
+        return AWS_OP_ERR;
+    }
+
+    /* a full record flushes immediately; this write starts the next one */
+    if (message->message_data.len > s2n_handler->coalesce_buf.capacity - s2n_handler->coalesce_buf.len) {
+        if (s_flush_coalesced_writes(handler)) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    struct aws_byte_cursor message_data = aws_byte_cursor_from_buf(&message->message_data);
+    if (aws_byte_buf_append(&s2n_handler->coalesce_buf, &message_data)) {
+        return AWS_OP_ERR;
+    }
+
+    aws_linked_list_push_back(&s2n_handler->coalesce_pending_messages, &message->queueing_handle);
+
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_TLS,
+        "id=%p: Queued %llu byte write for coalescing, %llu bytes pending",
+        (void *)handler,
+        (unsigned long long)message->message_data.len,
+        (unsigned long long)s2n_handler->coalesce_buf.len);
+
+    if (!s2n_handler->coalesce_flush_scheduled) {
+        s2n_handler->coalesce_flush_scheduled = true;
+        aws_channel_task_init(
+            &s2n_handler->coalesce_flush_task, s_coalesce_flush_task_fn, handler, "s2n_coalesced_write_flush");
+        aws_channel_schedule_task_now(s2n_handler->slot->channel, &s2n_handler->coalesce_flush_task);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
 static int s_s2n_handler_process_write_message(
     struct aws_channel_handler *handler,
     struct aws_channel_slot *slot,
     struct aws_io_message *message) {
-    (void)slot;
     struct s2n_handler *s2n_handler = (struct s2n_handler *)handler->impl;
 
+    if (s2n_handler->ktls_active) {
+        /* The kernel encrypts on the way out; forward the plaintext message to the socket slot untouched. */
+        return aws_channel_slot_send_message(slot, message, AWS_CHANNEL_DIR_WRITE);
+    }
+    (void)slot;
+
     if (AWS_UNLIKELY(s2n_handler->state != NEGOTIATION_SUCCEEDED)) {
+        if (s2n_handler->state == NEGOTIATION_ONGOING && s2n_handler->early_data_enabled) {
+            AWS_LOGF_TRACE(
+                AWS_LS_IO_TLS,
+                "id=%p: queuing %llu byte write as early data",
+                (void *)handler,
+                (unsigned long long)message->message_data.len);
+            message->copy_mark = 0;
+            aws_linked_list_push_back(&s2n_handler->early_data_queue, &message->queueing_handle);
+
+            bool early_data_blocked = false;
+            return s_flush_early_data(handler, &early_data_blocked);
+        }
         return aws_raise_error(AWS_IO_TLS_ERROR_NOT_NEGOTIATED);
     }
 
+    /*
+     * Writes below half a record coalesce: the data is copied into the pending record buffer and encrypted as
+     * one record by the end-of-tick flush.  Larger writes already amortize the record overhead, so they skip
+     * the copy and go straight to s2n_send -- after flushing anything queued ahead of them, to preserve order.
+     */
+    if (message->message_data.len < MAX_RECORD_SIZE / 2) {
+        return s_s2n_handler_coalesce_write(handler, message);
+    }
+
+    if (s2n_handler->coalesce_buf.len > 0 && s_flush_coalesced_writes(handler)) {
+        return AWS_OP_ERR;
+    }
+
     s2n_handler->latest_message_on_completion = message->on_completion;
     s2n_handler->latest_message_completion_user_data = message->user_data;
 
@@ -654,6 +1159,12 @@ static int s_s2n_handler_process_write_message(
 
     aws_mem_release(message->allocator, message);
 
+    if (blocked == S2N_NOT_BLOCKED) {
+        /* Everything was flushed to the socket; hand the connection's record buffer back to s2n's allocator so
+         * idle connections don't each pin a full-size send buffer. */
+        s2n_connection_release_buffers(s2n_handler->connection);
+    }
+
     return AWS_OP_SUCCESS;
 }
 
@@ -975,6 +1486,226 @@ static int s_s2n_async_pkey_callback(struct s2n_connection *conn, struct s2n_asy
     return S2N_SUCCESS;
 }
 
+static void s_chain_validation_operation_destroy(struct aws_tls_chain_validation_operation *operation) {
+    if (operation->s2n_handler) {
+        aws_channel_release_hold(operation->s2n_handler->slot->channel);
+    }
+    aws_byte_buf_clean_up(&operation->verdict_key);
+    aws_mem_release(operation->alloc, operation);
+}
+
+/*
+ * Serializes the bytes that determine a verification verdict - the identity of the validation policy that will
+ * judge the chain, then every DER certificate in the peer's chain, length-prefixed, followed by the server
+ * name - into out_key for use with the process-wide verification cache. The policy identity (the context's
+ * validation callback and its user data) keeps contexts with different policies - say one that pins
+ * certificates and one that doesn't - from sharing verdicts for the same peer chain.
+ */
+static int s_build_chain_verdict_key(
+    struct aws_allocator *allocator,
+    struct s2n_ctx *s2n_ctx,
+    struct s2n_connection *connection,
+    struct aws_byte_buf *out_key) {
+    struct s2n_cert_chain_and_key *peer_chain = s2n_cert_chain_and_key_new();
+    if (peer_chain == NULL) {
+        return aws_raise_error(AWS_ERROR_OOM);
+    }
+
+    int result = AWS_OP_ERR;
+
+    uint32_t chain_length = 0;
+    if (s2n_connection_get_peer_cert_chain(connection, peer_chain) != S2N_SUCCESS ||
+        s2n_cert_chain_get_length(peer_chain, &chain_length) != S2N_SUCCESS || chain_length == 0) {
+        aws_raise_error(AWS_IO_TLS_CTX_ERROR);
+        goto done;
+    }
+
+    if (aws_byte_buf_init(out_key, allocator, 2048)) {
+        goto done;
+    }
+
+    /* pointer identity is sufficient: the cache is in-memory and process-wide, so these pointers
+     * are valid policy discriminators for exactly as long as any entry keyed on them can live */
+    struct {
+        aws_tls_on_chain_validation_fn *on_chain_validation;
+        void *chain_validation_user_data;
+    } policy_identity;
+    AWS_ZERO_STRUCT(policy_identity); /* keys must be byte-deterministic; don't leak padding */
+    policy_identity.on_chain_validation = s2n_ctx->on_chain_validation;
+    policy_identity.chain_validation_user_data = s2n_ctx->chain_validation_user_data;
+    struct aws_byte_cursor policy_cursor = {.ptr = (uint8_t *)&policy_identity, .len = sizeof(policy_identity)};
+    if (aws_byte_buf_append_dynamic(out_key, &policy_cursor)) {
+        goto done;
+    }
+
+    for (uint32_t i = 0; i < chain_length; ++i) {
+        struct s2n_cert *cert = NULL;
+        const uint8_t *der = NULL;
+        uint32_t der_length = 0;
+        if (s2n_cert_chain_get_cert(peer_chain, &cert, i) != S2N_SUCCESS ||
+            s2n_cert_get_der(cert, &der, &der_length) != S2N_SUCCESS) {
+            aws_raise_error(AWS_IO_TLS_CTX_ERROR);
+            goto done;
+        }
+
+        uint64_t length_prefix = (uint64_t)der_length;
+        struct aws_byte_cursor length_cursor = {.ptr = (uint8_t *)&length_prefix, .len = sizeof(length_prefix)};
+        struct aws_byte_cursor der_cursor = {.ptr = (uint8_t *)der, .len = der_length};
+        if (aws_byte_buf_append_dynamic(out_key, &length_cursor) ||
+            aws_byte_buf_append_dynamic(out_key, &der_cursor)) {
+            goto done;
+        }
+    }
+
+    const char *server_name = s2n_get_server_name(connection);
+    if (server_name != NULL) {
+        struct aws_byte_cursor server_name_cursor = aws_byte_cursor_from_c_str(server_name);
+        if (aws_byte_buf_append_dynamic(out_key, &server_name_cursor)) {
+            goto done;
+        }
+    }
+
+    result = AWS_OP_SUCCESS;
+
+done:
+    s2n_cert_chain_and_key_free(peer_chain);
+    if (result != AWS_OP_SUCCESS) {
+        aws_byte_buf_clean_up(out_key);
+    }
+    return result;
+}
+
+/* Finishes an asynchronous chain validation on the event-loop thread: accepted chains resume negotiation,
+ * rejected ones shut the channel down. */
+static void s_chain_validation_completion_task(
+    struct aws_channel_task *channel_task,
+    void *arg,
+    enum aws_task_status status) {
+
+    (void)channel_task;
+    struct aws_tls_chain_validation_operation *operation = arg;
+    struct s2n_handler *s2n_handler = operation->s2n_handler;
+    struct aws_channel_handler *handler = &s2n_handler->handler;
+
+    /* if things started failing since this task was scheduled, just clean up and bail out */
+    if (status != AWS_TASK_STATUS_RUN_READY || s2n_handler->state != NEGOTIATION_ONGOING) {
+        goto clean_up;
+    }
+
+    if (operation->verdict_key.len > 0) {
+        aws_tls_verification_cache_put(
+            operation->alloc, aws_byte_cursor_from_buf(&operation->verdict_key), operation->completion_error_code);
+    }
+
+    if (operation->completion_error_code == 0) {
+        s2n_cert_validation_accept(operation->validation_info);
+        s_drive_negotiation(handler);
+    } else {
+        AWS_LOGF_WARN(
+            AWS_LS_IO_TLS,
+            "id=%p: application rejected peer certificate chain with error %s",
+            (void *)handler,
+            aws_error_name(operation->completion_error_code));
+        s2n_cert_validation_reject(operation->validation_info);
+        aws_channel_shutdown(s2n_handler->slot->channel, operation->completion_error_code);
+    }
+
+clean_up:
+    s_chain_validation_operation_destroy(operation);
+}
+
+void aws_tls_chain_validation_operation_complete(
+    struct aws_tls_chain_validation_operation *operation,
+    int error_code) {
+
+    if (operation == NULL) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_TLS, "Chain validation complete: operation is null and therefore cannot be completed!");
+        return;
+    }
+
+    /* Ensure this can only be called once and exactly once. */
+    size_t complete_count = aws_atomic_fetch_add(&operation->complete_count, 1);
+    AWS_FATAL_ASSERT(complete_count == 0 && "TLS chain validation operation marked complete multiple times");
+
+    operation->completion_error_code = error_code;
+
+    /* The application may have completed the operation from a worker thread, but negotiation must be resumed on
+     * the event-loop thread. */
+    aws_channel_task_init(
+        &operation->completion_task,
+        s_chain_validation_completion_task,
+        operation,
+        "tls_chain_validation_completion_task");
+    aws_channel_schedule_task_now(operation->s2n_handler->slot->channel, &operation->completion_task);
+}
+
+static int s_s2n_cert_validation_callback(
+    struct s2n_connection *conn,
+    struct s2n_cert_validation_info *info,
+    void *context) {
+
+    (void)context;
+    struct s2n_handler *s2n_handler = s2n_connection_get_ctx(conn);
+    struct aws_channel_handler *handler = &s2n_handler->handler;
+    struct s2n_ctx *s2n_ctx = s2n_handler->s2n_ctx;
+
+    AWS_ASSERT(conn == s2n_handler->connection);
+
+    if (s2n_ctx->on_chain_validation == NULL) {
+        return s2n_cert_validation_accept(info) == S2N_SUCCESS ? S2N_SUCCESS : S2N_FAILURE;
+    }
+
+    struct aws_byte_buf verdict_key;
+    AWS_ZERO_STRUCT(verdict_key);
+    if (s2n_ctx->verification_cache_enabled) {
+        if (s_build_chain_verdict_key(handler->alloc, s2n_ctx, conn, &verdict_key)) {
+            /* keying failure just means no caching for this handshake */
+            aws_reset_error();
+        } else {
+            int cached_error_code = AWS_ERROR_SUCCESS;
+            if (aws_tls_verification_cache_check(aws_byte_cursor_from_buf(&verdict_key), &cached_error_code)) {
+                aws_byte_buf_clean_up(&verdict_key);
+
+                if (cached_error_code == AWS_ERROR_SUCCESS) {
+                    AWS_LOGF_TRACE(
+                        AWS_LS_IO_TLS,
+                        "id=%p: peer chain matched a cached verification verdict, skipping application validation",
+                        (void *)handler);
+                    return s2n_cert_validation_accept(info) == S2N_SUCCESS ? S2N_SUCCESS : S2N_FAILURE;
+                }
+
+                AWS_LOGF_WARN(
+                    AWS_LS_IO_TLS,
+                    "id=%p: peer chain matched a cached rejection verdict %s, failing validation",
+                    (void *)handler,
+                    aws_error_name(cached_error_code));
+                return s2n_cert_validation_reject(info) == S2N_SUCCESS ? S2N_SUCCESS : S2N_FAILURE;
+            }
+        }
+    }
+
+    struct aws_tls_chain_validation_operation *operation =
+        aws_mem_calloc(handler->alloc, 1, sizeof(struct aws_tls_chain_validation_operation));
+    operation->alloc = handler->alloc;
+    operation->validation_info = info;
+    operation->verdict_key = verdict_key;
+    aws_atomic_init_int(&operation->complete_count, 0);
+
+    /* Keep channel alive until the application completes the operation */
+    operation->s2n_handler = s2n_handler;
+    aws_channel_acquire_hold(s2n_handler->slot->channel);
+
+    AWS_LOGF_DEBUG(
+        AWS_LS_IO_TLS,
+        "id=%p: suspending handshake, deferring chain validation to the application callback",
+        (void *)handler);
+
+    s2n_ctx->on_chain_validation(operation, s2n_ctx->chain_validation_user_data);
+
+    return S2N_SUCCESS;
+}
+
 static int s_s2n_do_delayed_shutdown(
     struct aws_channel_handler *handler,
     struct aws_channel_slot *slot,
@@ -1006,6 +1737,16 @@ static int s_s2n_handler_shutdown(
     struct s2n_handler *s2n_handler = (struct s2n_handler *)handler->impl;
 
     if (dir == AWS_CHANNEL_DIR_WRITE) {
+        if (abort_immediately || error_code) {
+            s_fail_pending_coalesced_writes(s2n_handler, error_code ? error_code : AWS_IO_TLS_ERROR_WRITE_FAILURE);
+        } else {
+            /* graceful shutdown: push out anything still waiting on the end-of-tick flush task; a flush
+             * failure has already completed the pending writes with an error */
+            (void)s_flush_coalesced_writes(handler);
+        }
+
+        s_fail_pending_early_data(s2n_handler, error_code ? error_code : AWS_IO_TLS_ERROR_WRITE_FAILURE);
+
         if (!abort_immediately && error_code != AWS_IO_SOCKET_CLOSED) {
             AWS_LOGF_DEBUG(AWS_LS_IO_TLS, "id=%p: Scheduling delayed write direction shutdown", (void *)handler);
             if (s_s2n_do_delayed_shutdown(handler, slot, error_code) == AWS_OP_SUCCESS) {
@@ -1113,6 +1854,11 @@ struct aws_byte_buf aws_tls_handler_protocol(struct aws_channel_handler *handler
     return s2n_handler->protocol;
 }
 
+enum aws_tls_early_data_status aws_tls_handler_early_data_status(struct aws_channel_handler *handler) {
+    struct s2n_handler *s2n_handler = (struct s2n_handler *)handler->impl;
+    return s2n_handler->early_data_status;
+}
+
 struct aws_byte_buf aws_tls_handler_server_name(struct aws_channel_handler *handler) {
     struct s2n_handler *s2n_handler = (struct s2n_handler *)handler->impl;
     return s2n_handler->server_name;
@@ -1244,6 +1990,9 @@ static struct aws_channel_handler *s_new_tls_handler(
     s2n_handler->latest_message_on_completion = NULL;
     s2n_handler->slot = slot;
     aws_linked_list_init(&s2n_handler->input_queue);
+    aws_linked_list_init(&s2n_handler->early_data_queue);
+    /* coalesce_buf is allocated lazily on the first sub-record write */
+    aws_linked_list_init(&s2n_handler->coalesce_pending_messages);
 
     s2n_handler->protocol = aws_byte_buf_from_array(NULL, 0);
 
@@ -1264,6 +2013,29 @@ static struct aws_channel_handler *s_new_tls_handler(
     s2n_connection_set_ctx(s2n_handler->connection, s2n_handler);
     s2n_connection_set_blinding(s2n_handler->connection, S2N_SELF_SERVICE_BLINDING);
 
+    if (options->dynamic_record_resize_threshold > 0) {
+        if (s2n_connection_set_dynamic_record_threshold(
+                s2n_handler->connection,
+                options->dynamic_record_resize_threshold,
+                options->dynamic_record_timeout_threshold)) {
+            /* degraded latency, not a broken connection; keep going with fixed-size records */
+            AWS_LOGF_WARN(
+                AWS_LS_IO_TLS,
+                "id=%p: failed to enable dynamic record sizing %s (%s), continuing with fixed-size records",
+                (void *)&s2n_handler->handler,
+                s2n_strerror(s2n_errno, "EN"),
+                s2n_strerror_debug(s2n_errno, "EN"));
+        } else {
+            AWS_LOGF_DEBUG(
+                AWS_LS_IO_TLS,
+                "id=%p: dynamic record sizing enabled: small records for the first %lu bytes, resetting after "
+                "%u seconds of write inactivity",
+                (void *)&s2n_handler->handler,
+                (unsigned long)options->dynamic_record_resize_threshold,
+                (unsigned)options->dynamic_record_timeout_threshold);
+        }
+    }
+
     if (options->alpn_list) {
         AWS_LOGF_DEBUG(
             AWS_LS_IO_TLS,
@@ -1303,6 +2075,38 @@ static struct aws_channel_handler *s_new_tls_handler(
         goto cleanup_conn;
     }
 
+    if (mode == S2N_CLIENT && s2n_handler->s2n_ctx->session_cache != NULL && options->server_name != NULL) {
+        struct aws_byte_buf session_buf;
+        if (aws_byte_buf_init(&session_buf, allocator, 0) == AWS_OP_SUCCESS) {
+            if (aws_tls_session_cache_get(
+                    s2n_handler->s2n_ctx->session_cache,
+                    aws_byte_cursor_from_string(options->server_name),
+                    &session_buf) == AWS_OP_SUCCESS) {
+                if (s2n_connection_set_session(s2n_handler->connection, session_buf.buffer, session_buf.len)) {
+                    /* A rejected session is not fatal; the handshake falls back to a full negotiation. */
+                    AWS_LOGF_DEBUG(
+                        AWS_LS_IO_TLS,
+                        "id=%p: cached session for %s was rejected, continuing with full handshake",
+                        (void *)&s2n_handler->handler,
+                        aws_string_c_str(options->server_name));
+                } else {
+                    AWS_LOGF_DEBUG(
+                        AWS_LS_IO_TLS,
+                        "id=%p: attempting session resumption for %s",
+                        (void *)&s2n_handler->handler,
+                        aws_string_c_str(options->server_name));
+                    /* With a resumable session in hand, writes before negotiation completes may go out as
+                     * 0-RTT early data (if the session's ticket permits it). */
+                    s2n_handler->early_data_enabled = true;
+                }
+            } else {
+                /* Cache misses are expected; clear the error so it can't leak into later failure handling. */
+                aws_reset_error();
+            }
+            aws_byte_buf_clean_up_secure(&session_buf);
+        }
+    }
+
     aws_channel_task_init(
         &s2n_handler->delayed_shutdown_task.task,
         s_delayed_shutdown_task_fn,
@@ -1346,6 +2150,7 @@ static void s_s2n_ctx_destroy(struct s2n_ctx *s2n_ctx) {
             s2n_cert_chain_and_key_free(s2n_ctx->custom_cert_chain_and_key);
         }
         s2n_ctx->custom_key_handler = aws_custom_key_op_handler_release(s2n_ctx->custom_key_handler);
+        aws_tls_session_cache_destroy(s2n_ctx->session_cache);
 
         aws_mem_release(s2n_ctx->ctx.alloc, s2n_ctx);
     }
@@ -1377,6 +2182,49 @@ static void s_log_and_raise_s2n_errno(const char *msg) {
     aws_raise_error(AWS_IO_TLS_CTX_ERROR);
 }
 
+/* TLS 1.3 session tickets arrive after the handshake completes; s2n hands them to us through this callback. */
+static int s_s2n_session_ticket_received(struct s2n_connection *conn, void *ctx, struct s2n_session_ticket *ticket) {
+    (void)ctx;
+
+    struct s2n_handler *s2n_handler = s2n_connection_get_ctx(conn);
+    if (s2n_handler == NULL || s2n_handler->s2n_ctx->session_cache == NULL) {
+        return S2N_SUCCESS;
+    }
+
+    const char *server_name = s2n_get_server_name(conn);
+    if (server_name == NULL) {
+        return S2N_SUCCESS;
+    }
+
+    uint32_t ticket_length = 0;
+    if (s2n_session_ticket_get_data_len(ticket, &ticket_length) != S2N_SUCCESS || ticket_length == 0) {
+        return S2N_SUCCESS;
+    }
+
+    struct aws_byte_buf ticket_buf;
+    if (aws_byte_buf_init(&ticket_buf, s2n_handler->handler.alloc, ticket_length)) {
+        return S2N_SUCCESS;
+    }
+
+    if (s2n_session_ticket_get_data(ticket, ticket_buf.capacity, ticket_buf.buffer) == S2N_SUCCESS) {
+        ticket_buf.len = ticket_length;
+        if (aws_tls_session_cache_put(
+                s2n_handler->s2n_ctx->session_cache,
+                aws_byte_cursor_from_c_str(server_name),
+                aws_byte_cursor_from_buf(&ticket_buf)) == AWS_OP_SUCCESS) {
+            AWS_LOGF_DEBUG(
+                AWS_LS_IO_TLS,
+                "id=%p: cached %" PRIu32 " byte session ticket for %s",
+                (void *)&s2n_handler->handler,
+                ticket_length,
+                server_name);
+        }
+    }
+
+    aws_byte_buf_clean_up_secure(&ticket_buf);
+    return S2N_SUCCESS;
+}
+
 static struct aws_tls_ctx *s_tls_ctx_new(
     struct aws_allocator *alloc,
     const struct aws_tls_ctx_options *options,
@@ -1673,6 +2521,57 @@ static struct aws_tls_ctx *s_tls_ctx_new(
         s2n_config_send_max_fragment_length(s2n_ctx->s2n_config, S2N_TLS_MAX_FRAG_LEN_4096);
     }
 
+    if (options->send_buffer_size > 0) {
+        if (s2n_config_set_send_buffer_size(s2n_ctx->s2n_config, (uint32_t)options->send_buffer_size)) {
+            s_log_and_raise_s2n_errno("ctx: failed to set send buffer size");
+            goto cleanup_s2n_config;
+        }
+    }
+
+    s2n_ctx->on_chain_validation = options->on_chain_validation;
+    s2n_ctx->chain_validation_user_data = options->chain_validation_user_data;
+    if (options->on_chain_validation != NULL) {
+        if (s2n_config_set_cert_validation_cb(s2n_ctx->s2n_config, s_s2n_cert_validation_callback, NULL)) {
+            s_log_and_raise_s2n_errno("ctx: failed to set cert validation callback");
+            goto cleanup_s2n_config;
+        }
+    }
+
+    s2n_ctx->verification_cache_enabled = options->verification_cache_enabled;
+    if (options->verification_cache_enabled && options->on_chain_validation == NULL) {
+        /* s2n's built-in X.509 validation runs before the cert validation callback fires, so on this backend the
+         * cache can only short-circuit the application's own chain validation. */
+        AWS_LOGF_WARN(
+            AWS_LS_IO_TLS,
+            "ctx: verification caching was enabled without a chain validation callback;"
+            " it has no effect on this backend without one.");
+    }
+
+    s2n_ctx->ktls_offload_enabled = options->ktls_offload_enabled;
+#if !defined(USE_KTLS)
+    if (options->ktls_offload_enabled) {
+        AWS_LOGF_WARN(
+            AWS_LS_IO_TLS, "ctx: kTLS offload requested but the library was built without USE_KTLS; ignoring.");
+    }
+#endif
+
+    if (options->session_cache_enabled && mode == S2N_CLIENT) {
+        s2n_ctx->session_cache = aws_tls_session_cache_new(alloc, &options->session_cache_options);
+        if (s2n_ctx->session_cache == NULL) {
+            goto cleanup_s2n_config;
+        }
+
+        if (s2n_config_set_session_tickets_onoff(s2n_ctx->s2n_config, 1)) {
+            s_log_and_raise_s2n_errno("ctx: failed to enable session tickets");
+            goto cleanup_s2n_config;
+        }
+
+        if (s2n_config_set_session_ticket_cb(s2n_ctx->s2n_config, s_s2n_session_ticket_received, NULL)) {
+            s_log_and_raise_s2n_errno("ctx: failed to set session ticket callback");
+            goto cleanup_s2n_config;
+        }
+    }
+
     return &s2n_ctx->ctx;
 
 cleanup_s2n_config:
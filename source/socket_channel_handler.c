@@ -12,19 +12,47 @@
 #include <aws/io/socket.h>
 #include <aws/io/statistics.h>
 
+#ifdef AWS_USE_EPOLL
+#    include <aws/io/private/event_loop_io_uring.h>
+#endif
+
 #ifdef _MSC_VER
 #    pragma warning(disable : 4204) /* non-constant aggregate initializer */
 #endif
 
+enum {
+    /* datagrams pulled from the socket per aws_socket_read_datagrams() call; one message each */
+    AWS_SOCKET_HANDLER_DGRAM_READ_BATCH = 8,
+    /* reads below this coalesce into a shared message, and a run of them draws from the
+     * message pool's small-block class instead of a full-size message */
+    AWS_SOCKET_HANDLER_SMALL_READ_THRESHOLD = 512,
+};
+
 struct socket_handler {
     struct aws_socket *socket;
     struct aws_channel_slot *slot;
     size_t max_rw_size;
+    /* adaptive read sizing; when initial_read_size is 0 adaptation is off and
+     * current_read_size stays pinned at max_rw_size */
+    size_t current_read_size;
+    size_t initial_read_size;
+    uint8_t consecutive_full_reads;
+    uint8_t consecutive_small_reads;
     struct aws_channel_task read_task_storage;
     struct aws_channel_task shutdown_task_storage;
     struct aws_crt_statistics_socket stats;
+    /* bytes submitted to the socket but not yet accepted by the kernel */
+    size_t pending_write_bytes;
     int shutdown_err_code;
     bool shutdown_in_progress;
+#ifdef AWS_USE_EPOLL
+    /* io_uring zero-copy receive path; NULL when reads go through aws_socket_read() */
+    struct aws_io_uring_zero_copy_recv *zc_recv;
+    /* messages received from the kernel that the downstream read-window can't take yet */
+    struct aws_linked_list zc_pending_messages;
+    bool zc_recv_decided;
+    bool zc_recv_paused;
+#endif
 };
 
 static int s_socket_process_read_message(
@@ -70,6 +98,12 @@ static void s_on_socket_write_complete(
         if (socket && socket->handler) {
             struct socket_handler *socket_handler = socket->handler->impl;
             socket_handler->stats.bytes_written += amount_written;
+            aws_channel_touch_idle_timeout(channel);
+
+            size_t submitted = message->message_data.len;
+            socket_handler->pending_write_bytes =
+                socket_handler->pending_write_bytes > submitted ? socket_handler->pending_write_bytes - submitted : 0;
+            aws_channel_report_write_queue_size(channel, socket_handler->pending_write_bytes);
         }
 
         aws_mem_release(message->allocator, message);
@@ -84,7 +118,6 @@ static int s_socket_process_write_message(
     struct aws_channel_handler *handler,
     struct aws_channel_slot *slot,
     struct aws_io_message *message) {
-    (void)slot;
     struct socket_handler *socket_handler = handler->impl;
 
     AWS_LOGF_TRACE(
@@ -97,11 +130,28 @@ static int s_socket_process_write_message(
         return aws_raise_error(AWS_IO_SOCKET_CLOSED);
     }
 
+    /* account before submitting: the socket may complete the write (and run the completion,
+     * which decrements) inline. Decrements clamp at zero, so the counter stays sane if a
+     * failed submission already completed with an error. */
+    size_t submitting = message->message_data.len;
+    socket_handler->pending_write_bytes += submitting;
+
     struct aws_byte_cursor cursor = aws_byte_cursor_from_buf(&message->message_data);
-    if (aws_socket_write(socket_handler->socket, &cursor, s_on_socket_write_complete, message)) {
+    int write_result;
+    if (message->priority == AWS_IO_MESSAGE_PRIORITY_HIGH) {
+        /* urgent control frames flush ahead of any backed-up bulk writes */
+        write_result = aws_socket_write_urgent(socket_handler->socket, &cursor, s_on_socket_write_complete, message);
+    } else {
+        write_result = aws_socket_write(socket_handler->socket, &cursor, s_on_socket_write_complete, message);
+    }
+    if (write_result) {
+        socket_handler->pending_write_bytes =
+            socket_handler->pending_write_bytes > submitting ? socket_handler->pending_write_bytes - submitting : 0;
         return AWS_OP_ERR;
     }
 
+    aws_channel_report_write_queue_size(slot->channel, socket_handler->pending_write_bytes);
+
     return AWS_OP_SUCCESS;
 }
 
@@ -109,6 +159,116 @@ static void s_read_task(struct aws_channel_task *task, void *arg, aws_task_statu
 
 static void s_on_readable_notification(struct aws_socket *socket, int error_code, void *user_data);
 
+#ifdef AWS_USE_EPOLL
+
+/* Sends one zero-copy message downstream if the read-window can take it; queues it and pauses the
+ * kernel receive otherwise. Returns true if the receive should re-arm immediately. */
+static bool s_zc_try_deliver(struct socket_handler *socket_handler, struct aws_io_message *message) {
+    size_t downstream_window = aws_channel_slot_downstream_read_window(socket_handler->slot);
+
+    if (downstream_window < message->message_data.len) {
+        AWS_LOGF_TRACE(
+            AWS_LS_IO_SOCKET_HANDLER,
+            "id=%p: downstream window %llu can't take zero-copy message of %llu, pausing receive",
+            (void *)socket_handler->slot->handler,
+            (unsigned long long)downstream_window,
+            (unsigned long long)message->message_data.len);
+        aws_linked_list_push_back(&socket_handler->zc_pending_messages, &message->queueing_handle);
+        socket_handler->zc_recv_paused = true;
+        return false;
+    }
+
+    size_t message_len = message->message_data.len;
+    if (aws_channel_slot_send_message(socket_handler->slot, message, AWS_CHANNEL_DIR_READ)) {
+        int last_error = aws_last_error();
+        aws_mem_release(message->allocator, message);
+        aws_channel_shutdown(socket_handler->slot->channel, last_error);
+        return false;
+    }
+
+    socket_handler->stats.bytes_read += message_len;
+    /* O(1) activity mark for the loop's shared idle-timeout service */
+    aws_channel_touch_idle_timeout(socket_handler->slot->channel);
+    return true;
+}
+
+static bool s_on_zero_copy_recv(int error_code, struct aws_io_message *message, void *user_data) {
+    struct socket_handler *socket_handler = user_data;
+
+    if (error_code != 0) {
+        AWS_LOGF_TRACE(
+            AWS_LS_IO_SOCKET_HANDLER,
+            "id=%p: zero-copy recv completed with error %d(%s)",
+            (void *)socket_handler->slot->handler,
+            error_code,
+            aws_error_name(error_code));
+        if (!socket_handler->shutdown_in_progress) {
+            aws_channel_shutdown(socket_handler->slot->channel, error_code);
+        }
+        return false;
+    }
+
+    message->owning_channel = socket_handler->slot->channel;
+
+    if (socket_handler->shutdown_in_progress) {
+        aws_mem_release(message->allocator, message);
+        return false;
+    }
+
+    /* preserve byte ordering: if older messages are still queued, go behind them */
+    if (!aws_linked_list_empty(&socket_handler->zc_pending_messages)) {
+        aws_linked_list_push_back(&socket_handler->zc_pending_messages, &message->queueing_handle);
+        socket_handler->zc_recv_paused = true;
+        return false;
+    }
+
+    return s_zc_try_deliver(socket_handler, message);
+}
+
+/* Window opened back up (or a fairness tick fired): drain queued messages, then resume the receive. */
+static void s_zc_flush_pending(struct socket_handler *socket_handler) {
+    while (!aws_linked_list_empty(&socket_handler->zc_pending_messages)) {
+        struct aws_linked_list_node *node = aws_linked_list_front(&socket_handler->zc_pending_messages);
+        struct aws_io_message *message = AWS_CONTAINER_OF(node, struct aws_io_message, queueing_handle);
+
+        size_t downstream_window = aws_channel_slot_downstream_read_window(socket_handler->slot);
+        if (downstream_window < message->message_data.len) {
+            return; /* still blocked; stay paused */
+        }
+
+        aws_linked_list_pop_front(&socket_handler->zc_pending_messages);
+        size_t message_len = message->message_data.len;
+        if (aws_channel_slot_send_message(socket_handler->slot, message, AWS_CHANNEL_DIR_READ)) {
+            int last_error = aws_last_error();
+            aws_mem_release(message->allocator, message);
+            aws_channel_shutdown(socket_handler->slot->channel, last_error);
+            return;
+        }
+        socket_handler->stats.bytes_read += message_len;
+        aws_channel_touch_idle_timeout(socket_handler->slot->channel);
+    }
+
+    if (socket_handler->zc_recv_paused) {
+        socket_handler->zc_recv_paused = false;
+        aws_event_loop_io_uring_zero_copy_recv_resume(socket_handler->zc_recv);
+    }
+}
+
+static void s_zc_recv_teardown(struct socket_handler *socket_handler) {
+    if (socket_handler->zc_recv) {
+        aws_event_loop_io_uring_zero_copy_recv_stop(socket_handler->zc_recv);
+        socket_handler->zc_recv = NULL;
+    }
+
+    while (!aws_linked_list_empty(&socket_handler->zc_pending_messages)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&socket_handler->zc_pending_messages);
+        struct aws_io_message *message = AWS_CONTAINER_OF(node, struct aws_io_message, queueing_handle);
+        aws_mem_release(message->allocator, message);
+    }
+}
+
+#endif /* AWS_USE_EPOLL */
+
 /* Ok this next function is VERY important for how back pressure works. Here's what it's supposed to be doing:
  *
  * See how much data downstream is willing to accept.
@@ -120,12 +280,142 @@ static void s_on_readable_notification(struct aws_socket *socket, int error_code
  * or schedule a task to enforce fairness for other sockets in the event loop if we read up to the max
  * read per event loop tick.
  */
+/* Datagram sockets drain several datagrams per syscall (recvmmsg under the covers), one
+ * aws_io_message each, instead of paying a read() per datagram. */
+static void s_do_dgram_batch_read(struct socket_handler *socket_handler, size_t max_to_read) {
+    struct aws_event_loop *event_loop = aws_channel_get_event_loop(socket_handler->slot->channel);
+    size_t total_read = 0;
+    int last_error = 0;
+    bool drained = false;
+
+    while (total_read < max_to_read && !drained && !last_error) {
+        /* cooperative tick budget: once we've delivered something, yield to the loop's other
+         * channels and resume from the re-read task below. */
+        if (total_read > 0 && aws_event_loop_tick_budget_exhausted(event_loop)) {
+            break;
+        }
+
+        size_t iter_max_read = max_to_read - total_read;
+
+        struct aws_io_message *messages[AWS_SOCKET_HANDLER_DGRAM_READ_BATCH];
+        struct aws_byte_buf buffers[AWS_SOCKET_HANDLER_DGRAM_READ_BATCH];
+        size_t message_count = 0;
+
+        while (message_count < AWS_SOCKET_HANDLER_DGRAM_READ_BATCH) {
+            struct aws_io_message *message = aws_channel_acquire_message_from_pool(
+                socket_handler->slot->channel, AWS_IO_MESSAGE_APPLICATION_DATA, iter_max_read);
+            if (!message) {
+                last_error = aws_last_error();
+                break;
+            }
+            messages[message_count] = message;
+            buffers[message_count] = message->message_data;
+            ++message_count;
+        }
+
+        if (message_count == 0) {
+            break;
+        }
+
+        size_t num_received = 0;
+        if (aws_socket_read_datagrams(socket_handler->socket, buffers, message_count, &num_received)) {
+            last_error = aws_last_error();
+            for (size_t i = 0; i < message_count; ++i) {
+                aws_mem_release(messages[i]->allocator, messages[i]);
+            }
+            break;
+        }
+
+        /* a partial batch means the socket is drained; no need for another syscall to learn that */
+        drained = num_received < message_count;
+
+        for (size_t i = 0; i < message_count; ++i) {
+            if (i >= num_received || last_error != 0) {
+                aws_mem_release(messages[i]->allocator, messages[i]);
+                continue;
+            }
+
+            messages[i]->message_data.len = buffers[i].len;
+            total_read += buffers[i].len;
+            if (aws_channel_slot_send_message(socket_handler->slot, messages[i], AWS_CHANNEL_DIR_READ)) {
+                last_error = aws_last_error();
+                aws_mem_release(messages[i]->allocator, messages[i]);
+            }
+        }
+
+        AWS_LOGF_TRACE(
+            AWS_LS_IO_SOCKET_HANDLER,
+            "id=%p: read %llu datagrams from socket",
+            (void *)socket_handler->slot->handler,
+            (unsigned long long)num_received);
+    }
+
+    socket_handler->stats.bytes_read += total_read;
+    if (total_read > 0) {
+        aws_channel_touch_idle_timeout(socket_handler->slot->channel);
+    }
+
+    if (last_error != 0 && last_error != AWS_IO_READ_WOULD_BLOCK) {
+        aws_channel_shutdown(socket_handler->slot->channel, last_error);
+        return;
+    }
+
+    if (drained || last_error == AWS_IO_READ_WOULD_BLOCK) {
+        AWS_LOGF_TRACE(
+            AWS_LS_IO_SOCKET_HANDLER,
+            "id=%p: out of datagrams to read on socket. "
+            "Waiting on event-loop notification.",
+            (void *)socket_handler->slot->handler);
+        return;
+    }
+
+    /* the read budget for this tick ran out with datagrams still pending; pick up on the next tick */
+    if (!socket_handler->read_task_storage.task_fn) {
+        AWS_LOGF_TRACE(
+            AWS_LS_IO_SOCKET_HANDLER,
+            "id=%p: more datagrams are pending read, but we've exceeded "
+            "the max read on this tick. Scheduling a task to read on next tick.",
+            (void *)socket_handler->slot->handler);
+        aws_channel_task_init(
+            &socket_handler->read_task_storage, s_read_task, socket_handler, "socket_handler_re_read");
+        aws_channel_schedule_task_now(socket_handler->slot->channel, &socket_handler->read_task_storage);
+    }
+}
+
 static void s_do_read(struct socket_handler *socket_handler) {
 
     if (socket_handler->shutdown_in_progress) {
         return;
     }
 
+#ifdef AWS_USE_EPOLL
+    if (socket_handler->zc_recv) {
+        s_zc_flush_pending(socket_handler);
+        return;
+    }
+
+    /* first read on this channel: if the socket's event loop can receive straight into kernel
+     * provided buffers, switch to that path and let completions drive delivery from here on. */
+    if (!socket_handler->zc_recv_decided) {
+        socket_handler->zc_recv_decided = true;
+        struct aws_event_loop *event_loop = aws_socket_get_event_loop(socket_handler->socket);
+        if (event_loop && socket_handler->socket->options.type == AWS_SOCKET_STREAM &&
+            aws_event_loop_is_io_uring_zero_copy_recv_available(event_loop)) {
+
+            socket_handler->zc_recv = aws_event_loop_io_uring_zero_copy_recv_start(
+                event_loop, &socket_handler->socket->io_handle, s_on_zero_copy_recv, socket_handler);
+            if (socket_handler->zc_recv) {
+                AWS_LOGF_DEBUG(
+                    AWS_LS_IO_SOCKET_HANDLER,
+                    "id=%p: using io_uring zero-copy receive path",
+                    (void *)socket_handler->slot->handler);
+                /* any bytes already buffered in the socket will surface as the first completion */
+                return;
+            }
+        }
+    }
+#endif
+
     size_t downstream_window = aws_channel_slot_downstream_read_window(socket_handler->slot);
     size_t max_to_read =
         downstream_window > socket_handler->max_rw_size ? socket_handler->max_rw_size : downstream_window;
@@ -141,23 +431,50 @@ static void s_do_read(struct socket_handler *socket_handler) {
         return;
     }
 
+    if (socket_handler->socket->options.type == AWS_SOCKET_DGRAM) {
+        s_do_dgram_batch_read(socket_handler, max_to_read);
+        return;
+    }
+
+    struct aws_event_loop *event_loop = aws_channel_get_event_loop(socket_handler->slot->channel);
     size_t total_read = 0;
     size_t read = 0;
     int last_error = 0;
+    bool budget_exhausted = false;
+    struct aws_io_message *message = NULL;
     while (total_read < max_to_read) {
+        /* cooperative tick budget: once we've delivered something, yield to the loop's other
+         * channels and resume from the re-read task below. */
+        if (total_read > 0 && aws_event_loop_tick_budget_exhausted(event_loop)) {
+            budget_exhausted = true;
+            break;
+        }
+
         size_t iter_max_read = max_to_read - total_read;
+        if (socket_handler->current_read_size < iter_max_read) {
+            iter_max_read = socket_handler->current_read_size;
+        }
 
-        struct aws_io_message *message = aws_channel_acquire_message_from_pool(
-            socket_handler->slot->channel, AWS_IO_MESSAGE_APPLICATION_DATA, iter_max_read);
+        /* interactive traffic: a run of small reads draws from the pool's small-block class
+         * rather than burning a full-size message on a couple hundred bytes */
+        if (socket_handler->consecutive_small_reads >= 2 &&
+            iter_max_read > AWS_SOCKET_HANDLER_SMALL_READ_THRESHOLD) {
+            iter_max_read = AWS_SOCKET_HANDLER_SMALL_READ_THRESHOLD;
+        }
 
-        if (!message) {
-            last_error = aws_last_error();
-            break;
+        bool fresh_message = message == NULL;
+        if (fresh_message) {
+            message = aws_channel_acquire_message_from_pool(
+                socket_handler->slot->channel, AWS_IO_MESSAGE_APPLICATION_DATA, iter_max_read);
+
+            if (!message) {
+                last_error = aws_last_error();
+                break;
+            }
         }
 
         if (aws_socket_read(socket_handler->socket, &message->message_data, &read)) {
             last_error = aws_last_error();
-            aws_mem_release(message->allocator, message);
             break;
         }
 
@@ -168,11 +485,69 @@ static void s_do_read(struct socket_handler *socket_handler) {
             (void *)socket_handler->slot->handler,
             (unsigned long long)read);
 
+        if (read < AWS_SOCKET_HANDLER_SMALL_READ_THRESHOLD) {
+            if (socket_handler->consecutive_small_reads < UINT8_MAX) {
+                ++socket_handler->consecutive_small_reads;
+            }
+        } else {
+            socket_handler->consecutive_small_reads = 0;
+        }
+
+        if (fresh_message && socket_handler->initial_read_size != 0) {
+            if (read == iter_max_read) {
+                /* the socket keeps filling what we hand it; ask for more next time so bulk
+                 * transfers take fewer loop iterations */
+                if (++socket_handler->consecutive_full_reads >= 2 &&
+                    socket_handler->current_read_size < socket_handler->max_rw_size) {
+                    socket_handler->consecutive_full_reads = 0;
+                    size_t grown = socket_handler->current_read_size * 2;
+                    socket_handler->current_read_size = grown > socket_handler->max_rw_size
+                                                            ? socket_handler->max_rw_size
+                                                            : grown;
+                    AWS_LOGF_TRACE(
+                        AWS_LS_IO_SOCKET_HANDLER,
+                        "id=%p: growing read size to %llu",
+                        (void *)socket_handler->slot->handler,
+                        (unsigned long long)socket_handler->current_read_size);
+                }
+            } else {
+                socket_handler->consecutive_full_reads = 0;
+                if (read < socket_handler->current_read_size / 2 &&
+                    socket_handler->current_read_size > socket_handler->initial_read_size) {
+                    size_t shrunk = socket_handler->current_read_size / 2;
+                    socket_handler->current_read_size = shrunk < socket_handler->initial_read_size
+                                                            ? socket_handler->initial_read_size
+                                                            : shrunk;
+                }
+            }
+        }
+
+        /* small reads coalesce: keep appending to the same message while it has room, so a
+         * burst of tiny reads costs one delivery instead of one per read */
+        if (read < AWS_SOCKET_HANDLER_SMALL_READ_THRESHOLD &&
+            message->message_data.len < message->message_data.capacity) {
+            continue;
+        }
+
         if (aws_channel_slot_send_message(socket_handler->slot, message, AWS_CHANNEL_DIR_READ)) {
             last_error = aws_last_error();
             aws_mem_release(message->allocator, message);
+            message = NULL;
             break;
         }
+        message = NULL;
+    }
+
+    /* deliver a partially filled coalesced message before acting on the loop's exit reason */
+    if (message) {
+        if (message->message_data.len > 0) {
+            if (aws_channel_slot_send_message(socket_handler->slot, message, AWS_CHANNEL_DIR_READ)) {
+                last_error = aws_last_error();
+                aws_mem_release(message->allocator, message);
+            }
+        } else {
+            aws_mem_release(message->allocator, message);
+        }
     }
 
     AWS_LOGF_TRACE(
@@ -182,6 +557,23 @@ static void s_do_read(struct socket_handler *socket_handler) {
         (unsigned long long)total_read);
 
     socket_handler->stats.bytes_read += total_read;
+    if (total_read > 0) {
+        aws_channel_touch_idle_timeout(socket_handler->slot->channel);
+    }
+
+    if (budget_exhausted) {
+        if (!socket_handler->read_task_storage.task_fn) {
+            AWS_LOGF_TRACE(
+                AWS_LS_IO_SOCKET_HANDLER,
+                "id=%p: more data is pending read, but the loop's tick budget is "
+                "exhausted. Scheduling a task to read on next tick.",
+                (void *)socket_handler->slot->handler);
+            aws_channel_task_init(
+                &socket_handler->read_task_storage, s_read_task, socket_handler, "socket_handler_re_read");
+            aws_channel_schedule_task_now(socket_handler->slot->channel, &socket_handler->read_task_storage);
+        }
+        return;
+    }
 
     /* resubscribe as long as there's no error, just return if we're in a would block scenario. */
     if (total_read < max_to_read) {
@@ -306,6 +698,9 @@ static int s_socket_shutdown(
     struct socket_handler *socket_handler = (struct socket_handler *)handler->impl;
 
     socket_handler->shutdown_in_progress = true;
+#ifdef AWS_USE_EPOLL
+    s_zc_recv_teardown(socket_handler);
+#endif
     if (dir == AWS_CHANNEL_DIR_READ) {
         AWS_LOGF_TRACE(
             AWS_LS_IO_SOCKET_HANDLER,
@@ -370,6 +765,21 @@ static void s_reset_statistics(struct aws_channel_handler *handler) {
 static void s_gather_statistics(struct aws_channel_handler *handler, struct aws_array_list *stats_list) {
     struct socket_handler *socket_handler = (struct socket_handler *)handler->impl;
 
+    /* queue-depth gauges are sampled at gather time */
+    socket_handler->stats.bytes_queued_write = socket_handler->pending_write_bytes;
+    socket_handler->stats.read_window_remaining =
+        socket_handler->slot->adj_right ? aws_channel_slot_downstream_read_window(socket_handler->slot) : 0;
+
+    /* kernel transport gauges; left zero for non-TCP sockets and unsupported platforms */
+    struct aws_socket_transport_telemetry telemetry;
+    if (aws_socket_fetch_transport_telemetry(socket_handler->socket, &telemetry) == AWS_OP_SUCCESS) {
+        socket_handler->stats.round_trip_time_ns = telemetry.round_trip_time_ns;
+        socket_handler->stats.round_trip_time_variance_ns = telemetry.round_trip_time_variance_ns;
+        socket_handler->stats.retransmit_count = telemetry.retransmit_count;
+        socket_handler->stats.congestion_window_bytes = telemetry.congestion_window_bytes;
+        socket_handler->stats.kernel_send_queue_bytes = telemetry.kernel_send_queue_bytes;
+    }
+
     void *stats_base = &socket_handler->stats;
     aws_array_list_push_back(stats_list, &stats_base);
 }
@@ -380,6 +790,21 @@ static void s_trigger_read(struct aws_channel_handler *handler) {
     s_do_read(socket_handler);
 }
 
+/* channel migration support: the socket's io-event subscription is the only loop-bound resource
+ * this handler holds. Re-subscribing on the destination loop delivers fresh readable/writable
+ * edges, so queued reads and writes resume on their own. */
+static int s_socket_detach_from_event_loop(struct aws_channel_handler *handler) {
+    struct socket_handler *socket_handler = (struct socket_handler *)handler->impl;
+
+    return aws_socket_unassign_from_event_loop(socket_handler->socket);
+}
+
+static int s_socket_attach_to_event_loop(struct aws_channel_handler *handler, struct aws_event_loop *event_loop) {
+    struct socket_handler *socket_handler = (struct socket_handler *)handler->impl;
+
+    return aws_socket_assign_to_event_loop(socket_handler->socket, event_loop);
+}
+
 static struct aws_channel_handler_vtable s_vtable = {
     .process_read_message = s_socket_process_read_message,
     .destroy = s_socket_destroy,
@@ -391,6 +816,8 @@ static struct aws_channel_handler_vtable s_vtable = {
     .reset_statistics = s_reset_statistics,
     .gather_statistics = s_gather_statistics,
     .trigger_read = s_trigger_read,
+    .detach_from_event_loop = s_socket_detach_from_event_loop,
+    .attach_to_event_loop = s_socket_attach_to_event_loop,
 };
 
 struct aws_channel_handler *aws_socket_handler_new(
@@ -399,6 +826,24 @@ struct aws_channel_handler *aws_socket_handler_new(
     struct aws_channel_slot *slot,
     size_t max_read_size) {
 
+    struct aws_socket_handler_options options = {
+        .socket = socket,
+        .slot = slot,
+        .max_read_size = max_read_size,
+        .initial_read_size = 0,
+    };
+
+    return aws_socket_handler_new_with_options(allocator, &options);
+}
+
+struct aws_channel_handler *aws_socket_handler_new_with_options(
+    struct aws_allocator *allocator,
+    const struct aws_socket_handler_options *options) {
+
+    struct aws_socket *socket = options->socket;
+    struct aws_channel_slot *slot = options->slot;
+    size_t max_read_size = options->max_read_size != 0 ? options->max_read_size : g_aws_channel_max_fragment_size;
+
     /* make sure something has assigned this socket to an event loop, in client mode this will already have occurred.
        In server mode, someone should have assigned it before calling us.*/
     AWS_ASSERT(aws_socket_get_event_loop(socket));
@@ -415,9 +860,20 @@ struct aws_channel_handler *aws_socket_handler_new(
     impl->socket = socket;
     impl->slot = slot;
     impl->max_rw_size = max_read_size;
+    impl->initial_read_size =
+        options->initial_read_size > max_read_size ? max_read_size : options->initial_read_size;
+    impl->current_read_size = impl->initial_read_size != 0 ? impl->initial_read_size : max_read_size;
+    impl->consecutive_full_reads = 0;
+    impl->consecutive_small_reads = 0;
     AWS_ZERO_STRUCT(impl->read_task_storage);
     AWS_ZERO_STRUCT(impl->shutdown_task_storage);
     impl->shutdown_in_progress = false;
+#ifdef AWS_USE_EPOLL
+    impl->zc_recv = NULL;
+    impl->zc_recv_decided = false;
+    impl->zc_recv_paused = false;
+    aws_linked_list_init(&impl->zc_pending_messages);
+#endif
     if (aws_crt_statistics_socket_init(&impl->stats)) {
         goto cleanup_handler;
     }
@@ -6,6 +6,7 @@
 #include <aws/io/logging.h>
 #include <aws/io/retry_strategy.h>
 
+#include <aws/common/atomics.h>
 #include <aws/common/byte_buf.h>
 #include <aws/common/hash_table.h>
 #include <aws/common/mutex.h>
@@ -25,10 +26,10 @@ struct retry_bucket {
     struct aws_retry_strategy *owner;
     struct aws_string *partition_id;
     struct aws_byte_cursor partition_id_cur;
-    struct {
-        size_t current_capacity;
-        struct aws_mutex partition_lock;
-    } synced_data;
+    /* capacity accounting is lock-free; every token acquire/success/failure for a
+     * partition hits this counter, so don't serialize them on a mutex. The strategy's
+     * lock is only for partition-table mutation. */
+    struct aws_atomic_var current_capacity;
 };
 
 struct retry_bucket_token {
@@ -41,6 +42,37 @@ struct retry_bucket_token {
     void *original_user_data;
 };
 
+/* Try to take up to `cost` units from the bucket. Partial consumption is allowed when
+ * the bucket is nearly drained; returns the amount actually taken, or 0 if the bucket
+ * was empty. */
+static size_t s_retry_bucket_try_consume(struct retry_bucket *bucket, size_t cost) {
+    size_t current = aws_atomic_load_int(&bucket->current_capacity);
+    size_t consumed;
+    do {
+        if (current == 0) {
+            return 0;
+        }
+        consumed = aws_min_size(current, cost);
+    } while (!aws_atomic_compare_exchange_int(&bucket->current_capacity, &current, current - consumed));
+
+    return consumed;
+}
+
+/* Return `amount` units to the bucket, clamping at the strategy's maximum capacity.
+ * Returns the new capacity (for logging). */
+static size_t s_retry_bucket_payback(struct retry_bucket *bucket, size_t amount, size_t max_capacity) {
+    size_t current = aws_atomic_load_int(&bucket->current_capacity);
+    size_t desired;
+    do {
+        desired = current + amount;
+        if (desired > max_capacity || desired < current /* overflow */) {
+            desired = max_capacity;
+        }
+    } while (!aws_atomic_compare_exchange_int(&bucket->current_capacity, &current, desired));
+
+    return desired;
+}
+
 static bool s_partition_id_equals_byte_cur(const void *seated_cur, const void *cur_ptr) {
     return aws_byte_cursor_eq_ignore_case(seated_cur, cur_ptr);
 }
@@ -57,7 +89,6 @@ static void s_destroy_standard_retry_bucket(void *retry_bucket) {
         (void *)standard_retry_bucket->owner,
         AWS_BYTE_CURSOR_PRI(standard_retry_bucket->partition_id_cur));
     aws_string_destroy(standard_retry_bucket->partition_id);
-    aws_mutex_clean_up(&standard_retry_bucket->synced_data.partition_lock);
     aws_mem_release(standard_retry_bucket->allocator, standard_retry_bucket);
 }
 
@@ -127,12 +158,13 @@ static void s_on_standard_retry_token_acquired(
     aws_retry_token_release(&retry_token->retry_token);
 }
 
-static int s_standard_retry_acquire_token(
+static int s_standard_retry_acquire_token_impl(
     struct aws_retry_strategy *retry_strategy,
     const struct aws_byte_cursor *partition_id,
     aws_retry_strategy_on_retry_token_acquired_fn *on_acquired,
     void *user_data,
-    uint64_t timeout_ms) {
+    uint64_t timeout_ms,
+    struct aws_event_loop *pinned_event_loop) {
     struct standard_strategy *standard_strategy = retry_strategy->impl;
     bool bucket_needs_cleanup = false;
 
@@ -190,9 +222,8 @@ static int s_standard_retry_acquire_token(
         }
 
         bucket_ptr->partition_id_cur = aws_byte_cursor_from_string(bucket_ptr->partition_id);
-        AWS_FATAL_ASSERT(!aws_mutex_init(&bucket_ptr->synced_data.partition_lock) && "mutex init failed!");
         bucket_ptr->owner = retry_strategy;
-        bucket_ptr->synced_data.current_capacity = standard_strategy->max_capacity;
+        aws_atomic_init_int(&bucket_ptr->current_capacity, standard_strategy->max_capacity);
         AWS_LOGF_DEBUG(
             AWS_LS_IO_STANDARD_RETRY_STRATEGY,
             "id=%p: bucket %p for partition_id " PRInSTR " created",
@@ -239,12 +270,13 @@ static int s_standard_retry_acquire_token(
         (void *)&token->retry_token,
         AWS_BYTE_CURSOR_PRI(*partition_id_ptr));
 
-    if (aws_retry_strategy_acquire_retry_token(
+    if (aws_retry_strategy_acquire_retry_token_pinned(
             standard_strategy->exponential_backoff_retry_strategy,
             partition_id_ptr,
             s_on_standard_retry_token_acquired,
             token,
-            timeout_ms)) {
+            timeout_ms,
+            pinned_event_loop)) {
         AWS_LOGF_ERROR(
             AWS_LS_IO_STANDARD_RETRY_STRATEGY,
             "id=%p: error when acquiring retry token from backing retry strategy %p: %s",
@@ -273,6 +305,27 @@ table_locked:
     return AWS_OP_ERR;
 }
 
+static int s_standard_retry_acquire_token(
+    struct aws_retry_strategy *retry_strategy,
+    const struct aws_byte_cursor *partition_id,
+    aws_retry_strategy_on_retry_token_acquired_fn *on_acquired,
+    void *user_data,
+    uint64_t timeout_ms) {
+    return s_standard_retry_acquire_token_impl(
+        retry_strategy, partition_id, on_acquired, user_data, timeout_ms, NULL /*pinned_event_loop*/);
+}
+
+static int s_standard_retry_acquire_token_pinned(
+    struct aws_retry_strategy *retry_strategy,
+    const struct aws_byte_cursor *partition_id,
+    aws_retry_strategy_on_retry_token_acquired_fn *on_acquired,
+    void *user_data,
+    uint64_t timeout_ms,
+    struct aws_event_loop *pinned_event_loop) {
+    return s_standard_retry_acquire_token_impl(
+        retry_strategy, partition_id, on_acquired, user_data, timeout_ms, pinned_event_loop);
+}
+
 void s_standard_retry_strategy_on_retry_ready(struct aws_retry_token *token, int error_code, void *user_data) {
     (void)token;
 
@@ -307,13 +360,18 @@ static int s_standard_retry_strategy_schedule_retry(
 
     struct retry_bucket_token *impl = token->impl;
 
-    size_t capacity_consumed = 0;
+    size_t capacity_cost = 0;
 
-    AWS_FATAL_ASSERT(!aws_mutex_lock(&impl->strategy_bucket->synced_data.partition_lock) && "mutex lock failed");
-    size_t current_capacity = impl->strategy_bucket->synced_data.current_capacity;
-    if (current_capacity == 0) {
-        AWS_FATAL_ASSERT(
-            !aws_mutex_unlock(&impl->strategy_bucket->synced_data.partition_lock) && "mutex unlock failed");
+    if (error_type == AWS_RETRY_ERROR_TYPE_TRANSIENT) {
+        capacity_cost = s_standard_transient_cost;
+    } else {
+        /* you may be looking for throttling, but if that happened, the service told us to slow down,
+         * but is otherwise healthy. Pay a smaller penalty for those. */
+        capacity_cost = s_standard_retry_cost;
+    }
+
+    size_t capacity_consumed = s_retry_bucket_try_consume(impl->strategy_bucket, capacity_cost);
+    if (capacity_consumed == 0) {
         AWS_LOGF_INFO(
             AWS_LS_IO_STANDARD_RETRY_STRATEGY,
             "token_id=%p: requested to schedule retry but the bucket capacity is empty. Rejecting retry request.",
@@ -321,27 +379,16 @@ static int s_standard_retry_strategy_schedule_retry(
         return aws_raise_error(AWS_IO_RETRY_PERMISSION_DENIED);
     }
 
-    if (error_type == AWS_RETRY_ERROR_TYPE_TRANSIENT) {
-        capacity_consumed = aws_min_size(current_capacity, s_standard_transient_cost);
-    } else {
-        /* you may be looking for throttling, but if that happened, the service told us to slow down,
-         * but is otherwise healthy. Pay a smaller penalty for those. */
-        capacity_consumed = aws_min_size(current_capacity, s_standard_retry_cost);
-    }
-
     AWS_LOGF_DEBUG(
         AWS_LS_IO_STANDARD_RETRY_STRATEGY,
-        "token_id=%p: reducing retry capacity by %zu from %zu and scheduling retry.",
+        "token_id=%p: reduced retry capacity by %zu and scheduling retry.",
         (void *)token,
-        capacity_consumed,
-        current_capacity);
+        capacity_consumed);
     impl->original_user_data = user_data;
     impl->original_on_ready = retry_ready;
 
     size_t previous_cost = impl->last_retry_cost;
     impl->last_retry_cost = capacity_consumed;
-    impl->strategy_bucket->synced_data.current_capacity -= capacity_consumed;
-    AWS_FATAL_ASSERT(!aws_mutex_unlock(&impl->strategy_bucket->synced_data.partition_lock) && "mutex unlock failed");
 
     /* acquire before scheduling to prevent clean up before the callback runs. */
     aws_retry_token_acquire(&impl->retry_token);
@@ -355,14 +402,9 @@ static int s_standard_retry_strategy_schedule_retry(
             (void *)token,
             aws_error_debug_str(aws_last_error()));
         /* roll it back. */
-        AWS_FATAL_ASSERT(!aws_mutex_lock(&impl->strategy_bucket->synced_data.partition_lock) && "mutex lock failed");
         impl->last_retry_cost = previous_cost;
-        size_t desired_capacity = impl->strategy_bucket->synced_data.current_capacity + capacity_consumed;
         struct standard_strategy *strategy_impl = token->retry_strategy->impl;
-        impl->strategy_bucket->synced_data.current_capacity =
-            desired_capacity < strategy_impl->max_capacity ? desired_capacity : strategy_impl->max_capacity;
-        AWS_FATAL_ASSERT(
-            !aws_mutex_unlock(&impl->strategy_bucket->synced_data.partition_lock) && "mutex unlock failed");
+        s_retry_bucket_payback(impl->strategy_bucket, capacity_consumed, strategy_impl->max_capacity);
 
         return AWS_OP_ERR;
     }
@@ -373,7 +415,6 @@ static int s_standard_retry_strategy_schedule_retry(
 static int s_standard_retry_strategy_record_success(struct aws_retry_token *token) {
     struct retry_bucket_token *impl = token->impl;
 
-    AWS_FATAL_ASSERT(!aws_mutex_lock(&impl->strategy_bucket->synced_data.partition_lock) && "mutex lock failed");
     AWS_LOGF_DEBUG(
         AWS_LS_IO_STANDARD_RETRY_STRATEGY,
         "token_id=%p: partition=" PRInSTR
@@ -381,18 +422,16 @@ static int s_standard_retry_strategy_record_success(struct aws_retry_token *toke
         (void *)token,
         AWS_BYTE_CURSOR_PRI(impl->strategy_bucket->partition_id_cur),
         impl->last_retry_cost);
-    size_t capacity_payback = impl->strategy_bucket->synced_data.current_capacity + impl->last_retry_cost;
     struct standard_strategy *standard_strategy = token->retry_strategy->impl;
-    impl->strategy_bucket->synced_data.current_capacity =
-        capacity_payback < standard_strategy->max_capacity ? capacity_payback : standard_strategy->max_capacity;
+    size_t new_capacity =
+        s_retry_bucket_payback(impl->strategy_bucket, impl->last_retry_cost, standard_strategy->max_capacity);
     impl->last_retry_cost = 0;
     AWS_LOGF_TRACE(
         AWS_LS_IO_STANDARD_RETRY_STRATEGY,
         "bucket_id=%p: partition=" PRInSTR " : new capacity is %zu.",
         (void *)token,
         AWS_BYTE_CURSOR_PRI(impl->strategy_bucket->partition_id_cur),
-        impl->strategy_bucket->synced_data.current_capacity);
-    AWS_FATAL_ASSERT(!aws_mutex_unlock(&impl->strategy_bucket->synced_data.partition_lock) && "mutex unlock failed");
+        new_capacity);
     return AWS_OP_SUCCESS;
 }
 
@@ -412,6 +451,7 @@ static struct aws_retry_strategy_vtable s_standard_retry_vtable = {
     .release_token = s_standard_retry_strategy_release_token,
     .destroy = s_standard_retry_destroy,
     .record_success = s_standard_retry_strategy_record_success,
+    .acquire_token_pinned = s_standard_retry_acquire_token_pinned,
 };
 
 struct aws_retry_strategy *aws_retry_strategy_new_standard(
@@ -22,6 +22,13 @@ void aws_crt_statistics_socket_cleanup(struct aws_crt_statistics_socket *stats)
 void aws_crt_statistics_socket_reset(struct aws_crt_statistics_socket *stats) {
     stats->bytes_read = 0;
     stats->bytes_written = 0;
+    stats->bytes_queued_write = 0;
+    stats->read_window_remaining = 0;
+    stats->round_trip_time_ns = 0;
+    stats->round_trip_time_variance_ns = 0;
+    stats->retransmit_count = 0;
+    stats->congestion_window_bytes = 0;
+    stats->kernel_send_queue_bytes = 0;
 }
 
 int aws_crt_statistics_tls_init(struct aws_crt_statistics_tls *stats) {
@@ -42,3 +49,21 @@ void aws_crt_statistics_tls_reset(struct aws_crt_statistics_tls *stats) {
      */
     (void)stats;
 }
+
+int aws_crt_statistics_channel_init(struct aws_crt_statistics_channel *stats) {
+    AWS_ZERO_STRUCT(*stats);
+    stats->category = AWSCRT_STAT_CAT_CHANNEL;
+
+    return AWS_OP_SUCCESS;
+}
+
+void aws_crt_statistics_channel_cleanup(struct aws_crt_statistics_channel *stats) {
+    (void)stats;
+}
+
+void aws_crt_statistics_channel_reset(struct aws_crt_statistics_channel *stats) {
+    stats->task_execution_ns = 0;
+    stats->task_execution_count = 0;
+    stats->message_processing_ns = 0;
+    stats->message_processing_count = 0;
+}
@@ -0,0 +1,401 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/io/statistics_sink.h>
+
+#include <aws/common/atomics.h>
+#include <aws/common/clock.h>
+#include <aws/common/mutex.h>
+#include <aws/common/statistics.h>
+#include <aws/common/string.h>
+#include <aws/io/logging.h>
+#include <aws/io/statistics.h>
+
+#ifdef _WIN32
+
+struct aws_shm_stats_sink *aws_shm_stats_sink_new(
+    struct aws_allocator *allocator,
+    const struct aws_shm_stats_sink_options *options) {
+    (void)allocator;
+    (void)options;
+    aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+    return NULL;
+}
+
+void aws_shm_stats_sink_destroy(struct aws_shm_stats_sink *sink) {
+    (void)sink;
+}
+
+struct aws_shm_stats_ring *aws_shm_stats_sink_ring_for_event_loop(
+    struct aws_shm_stats_sink *sink,
+    struct aws_event_loop *event_loop) {
+    (void)sink;
+    (void)event_loop;
+    aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+    return NULL;
+}
+
+void aws_shm_stats_ring_publish(struct aws_shm_stats_ring *ring, const struct aws_shm_stats_record *record) {
+    (void)ring;
+    (void)record;
+}
+
+struct aws_crt_statistics_handler *aws_crt_statistics_handler_new_shm_sink(
+    struct aws_allocator *allocator,
+    struct aws_shm_stats_sink *sink,
+    struct aws_event_loop *event_loop) {
+    (void)allocator;
+    (void)sink;
+    (void)event_loop;
+    aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+    return NULL;
+}
+
+#else /* !_WIN32 */
+
+#    include <errno.h>
+#    include <fcntl.h>
+#    include <stdio.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
+
+enum {
+    AWS_SHM_STATS_MAGIC = 0x41575353, /* "AWSS" */
+    AWS_SHM_STATS_LAYOUT_VERSION = 1,
+    AWS_SHM_STATS_DEFAULT_RING_COUNT = 64,
+    AWS_SHM_STATS_DEFAULT_RING_CAPACITY = 64,
+};
+
+/* These structs ARE the binary layout documented in statistics_sink.h; every member is
+ * fixed-width and each struct is exactly one 64-byte cache line, so there is no padding
+ * for the compiler to invent. */
+struct aws_shm_stats_segment_header {
+    uint32_t magic;
+    uint32_t layout_version;
+    uint32_t ring_count;
+    uint32_t ring_capacity;
+    uint32_t record_size;
+    uint32_t reserved[11];
+};
+
+struct aws_shm_stats_ring_header {
+    /* Count of records ever published. The producer writes the slot, then store-releases
+     * head + 1; aws_atomic_var is a single word, matching the documented u64 on 64-bit. */
+    struct aws_atomic_var head;
+    /* Event loop identifier; written once at claim time, 0 while unclaimed. */
+    struct aws_atomic_var owner;
+    uint8_t reserved[64 - 2 * sizeof(struct aws_atomic_var)];
+};
+
+struct aws_shm_stats_ring {
+    struct aws_shm_stats_ring_header *header;
+    struct aws_shm_stats_record *records;
+    uint32_t capacity;
+};
+
+struct aws_shm_stats_sink {
+    struct aws_allocator *allocator;
+    struct aws_string *shm_name;
+    int shm_fd;
+    void *mapping;
+    size_t mapping_size;
+    uint32_t ring_count;
+    uint32_t ring_capacity;
+
+    /* Guards ring claiming only; publishing never touches the lock. */
+    struct aws_mutex lock;
+    struct aws_shm_stats_ring *rings;
+    struct aws_event_loop **ring_owners;
+    uint32_t rings_claimed;
+};
+
+static uint32_t s_round_up_power_of_two(uint32_t value) {
+    uint32_t rounded = 1;
+    while (rounded < value) {
+        rounded <<= 1;
+    }
+    return rounded;
+}
+
+struct aws_shm_stats_sink *aws_shm_stats_sink_new(
+    struct aws_allocator *allocator,
+    const struct aws_shm_stats_sink_options *options) {
+
+    AWS_STATIC_ASSERT(sizeof(struct aws_shm_stats_segment_header) == 64);
+    AWS_STATIC_ASSERT(sizeof(struct aws_shm_stats_record) == 64);
+
+    struct aws_shm_stats_sink *sink = aws_mem_calloc(allocator, 1, sizeof(struct aws_shm_stats_sink));
+    if (sink == NULL) {
+        return NULL;
+    }
+
+    sink->allocator = allocator;
+    sink->shm_fd = -1;
+    sink->ring_count = (options != NULL && options->ring_count > 0) ? options->ring_count
+                                                                    : (uint32_t)AWS_SHM_STATS_DEFAULT_RING_COUNT;
+    sink->ring_capacity = s_round_up_power_of_two(
+        (options != NULL && options->ring_capacity > 0) ? options->ring_capacity
+                                                        : (uint32_t)AWS_SHM_STATS_DEFAULT_RING_CAPACITY);
+
+    if (aws_mutex_init(&sink->lock)) {
+        goto on_error;
+    }
+
+    if (options != NULL && options->shm_name != NULL) {
+        sink->shm_name = aws_string_new_from_c_str(allocator, options->shm_name);
+    } else {
+        char default_name[64];
+        snprintf(default_name, sizeof(default_name), "/aws-c-io-stats-%d", (int)getpid());
+        sink->shm_name = aws_string_new_from_c_str(allocator, default_name);
+    }
+    if (sink->shm_name == NULL) {
+        goto on_error;
+    }
+
+    sink->mapping_size = sizeof(struct aws_shm_stats_segment_header) +
+                         (size_t)sink->ring_count * sizeof(struct aws_shm_stats_ring_header) +
+                         (size_t)sink->ring_count * sink->ring_capacity * sizeof(struct aws_shm_stats_record);
+
+    /* Replace any segment a crashed predecessor left behind. */
+    shm_unlink(aws_string_c_str(sink->shm_name));
+    sink->shm_fd = shm_open(aws_string_c_str(sink->shm_name), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    if (sink->shm_fd < 0) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_CHANNEL,
+            "static: shm_open(%s) failed with errno %d",
+            aws_string_c_str(sink->shm_name),
+            errno);
+        aws_raise_error(AWS_ERROR_SYS_CALL_FAILURE);
+        goto on_error;
+    }
+
+    if (ftruncate(sink->shm_fd, (off_t)sink->mapping_size) != 0) {
+        aws_raise_error(AWS_ERROR_SYS_CALL_FAILURE);
+        goto on_error;
+    }
+
+    sink->mapping = mmap(NULL, sink->mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, sink->shm_fd, 0);
+    if (sink->mapping == MAP_FAILED) {
+        sink->mapping = NULL;
+        aws_raise_error(AWS_ERROR_SYS_CALL_FAILURE);
+        goto on_error;
+    }
+
+    struct aws_shm_stats_segment_header *header = sink->mapping;
+    header->ring_count = sink->ring_count;
+    header->ring_capacity = sink->ring_capacity;
+    header->record_size = (uint32_t)sizeof(struct aws_shm_stats_record);
+    header->layout_version = AWS_SHM_STATS_LAYOUT_VERSION;
+    /* Magic last, so a scraper racing segment creation never sees a valid magic
+     * ahead of the rest of the header. */
+    header->magic = AWS_SHM_STATS_MAGIC;
+
+    sink->rings = aws_mem_calloc(allocator, sink->ring_count, sizeof(struct aws_shm_stats_ring));
+    sink->ring_owners = aws_mem_calloc(allocator, sink->ring_count, sizeof(struct aws_event_loop *));
+    if (sink->rings == NULL || sink->ring_owners == NULL) {
+        goto on_error;
+    }
+
+    struct aws_shm_stats_ring_header *ring_headers =
+        (struct aws_shm_stats_ring_header *)((uint8_t *)sink->mapping + sizeof(struct aws_shm_stats_segment_header));
+    struct aws_shm_stats_record *records =
+        (struct aws_shm_stats_record *)(ring_headers + sink->ring_count);
+    for (uint32_t i = 0; i < sink->ring_count; ++i) {
+        aws_atomic_init_int(&ring_headers[i].head, 0);
+        aws_atomic_init_int(&ring_headers[i].owner, 0);
+        sink->rings[i].header = &ring_headers[i];
+        sink->rings[i].records = records + (size_t)i * sink->ring_capacity;
+        sink->rings[i].capacity = sink->ring_capacity;
+    }
+
+    AWS_LOGF_INFO(
+        AWS_LS_IO_CHANNEL,
+        "id=%p: shared-memory statistics sink created at %s (%u rings of %u records)",
+        (void *)sink,
+        aws_string_c_str(sink->shm_name),
+        sink->ring_count,
+        sink->ring_capacity);
+
+    return sink;
+
+on_error:
+    aws_shm_stats_sink_destroy(sink);
+    return NULL;
+}
+
+void aws_shm_stats_sink_destroy(struct aws_shm_stats_sink *sink) {
+    if (sink == NULL) {
+        return;
+    }
+
+    if (sink->mapping != NULL) {
+        munmap(sink->mapping, sink->mapping_size);
+    }
+    if (sink->shm_fd >= 0) {
+        close(sink->shm_fd);
+    }
+    if (sink->shm_name != NULL) {
+        shm_unlink(aws_string_c_str(sink->shm_name));
+        aws_string_destroy(sink->shm_name);
+    }
+    aws_mem_release(sink->allocator, sink->rings);
+    aws_mem_release(sink->allocator, sink->ring_owners);
+    aws_mutex_clean_up(&sink->lock);
+    aws_mem_release(sink->allocator, sink);
+}
+
+struct aws_shm_stats_ring *aws_shm_stats_sink_ring_for_event_loop(
+    struct aws_shm_stats_sink *sink,
+    struct aws_event_loop *event_loop) {
+
+    struct aws_shm_stats_ring *ring = NULL;
+
+    aws_mutex_lock(&sink->lock);
+    for (uint32_t i = 0; i < sink->rings_claimed; ++i) {
+        if (sink->ring_owners[i] == event_loop) {
+            ring = &sink->rings[i];
+            goto unlock;
+        }
+    }
+
+    if (sink->rings_claimed == sink->ring_count) {
+        AWS_LOGF_WARN(
+            AWS_LS_IO_CHANNEL,
+            "id=%p: all %u statistics rings are claimed; event loop %p gets no ring",
+            (void *)sink,
+            sink->ring_count,
+            (void *)event_loop);
+        aws_raise_error(AWS_ERROR_INVALID_STATE);
+        goto unlock;
+    }
+
+    ring = &sink->rings[sink->rings_claimed];
+    sink->ring_owners[sink->rings_claimed] = event_loop;
+    ++sink->rings_claimed;
+    aws_atomic_store_int(&ring->header->owner, (size_t)(uintptr_t)event_loop);
+
+unlock:
+    aws_mutex_unlock(&sink->lock);
+    return ring;
+}
+
+void aws_shm_stats_ring_publish(struct aws_shm_stats_ring *ring, const struct aws_shm_stats_record *record) {
+    /* Single producer: only this thread advances head, so a relaxed read is enough. */
+    size_t head = aws_atomic_load_int_explicit(&ring->header->head, aws_memory_order_relaxed);
+    ring->records[head & (ring->capacity - 1)] = *record;
+    /* Release publishes the record bytes before the new head becomes visible to the scraper. */
+    aws_atomic_store_int_explicit(&ring->header->head, head + 1, aws_memory_order_release);
+}
+
+/* Statistics handler that folds each interval's socket/TLS stats into one record per channel. */
+
+struct aws_shm_sink_stats_handler {
+    struct aws_allocator *allocator;
+    struct aws_shm_stats_ring *ring;
+};
+
+static void s_shm_sink_process_statistics(
+    struct aws_crt_statistics_handler *handler,
+    struct aws_crt_statistics_sample_interval *interval,
+    struct aws_array_list *stats_list,
+    void *context) {
+
+    (void)interval;
+
+    struct aws_shm_sink_stats_handler *impl = handler->impl;
+    if (impl->ring == NULL) {
+        return;
+    }
+
+    struct aws_shm_stats_record record;
+    AWS_ZERO_STRUCT(record);
+    aws_high_res_clock_get_ticks(&record.timestamp_ns);
+    record.owner_id = (uint64_t)(uintptr_t)context;
+
+    size_t stats_count = aws_array_list_length(stats_list);
+    for (size_t i = 0; i < stats_count; ++i) {
+        struct aws_crt_statistics_base *stats_base = NULL;
+        aws_array_list_get_at(stats_list, &stats_base, i);
+
+        switch (stats_base->category) {
+            case AWSCRT_STAT_CAT_SOCKET: {
+                struct aws_crt_statistics_socket *socket_stats = (struct aws_crt_statistics_socket *)stats_base;
+                record.bytes_read += socket_stats->bytes_read;
+                record.bytes_written += socket_stats->bytes_written;
+                record.bytes_queued_write += socket_stats->bytes_queued_write;
+                record.read_window_remaining += socket_stats->read_window_remaining;
+                break;
+            }
+
+            case AWSCRT_STAT_CAT_TLS: {
+                struct aws_crt_statistics_tls *tls_stats = (struct aws_crt_statistics_tls *)stats_base;
+                record.tls_handshake_status = (uint64_t)tls_stats->handshake_status;
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+
+    aws_shm_stats_ring_publish(impl->ring, &record);
+}
+
+static void s_shm_sink_destroy_handler(struct aws_crt_statistics_handler *handler) {
+    if (handler == NULL) {
+        return;
+    }
+
+    struct aws_shm_sink_stats_handler *impl = handler->impl;
+    aws_mem_release(impl->allocator, handler);
+}
+
+static uint64_t s_shm_sink_get_report_interval_ms(struct aws_crt_statistics_handler *handler) {
+    (void)handler;
+    return 1000;
+}
+
+static struct aws_crt_statistics_handler_vtable s_shm_sink_stats_handler_vtable = {
+    .process_statistics = s_shm_sink_process_statistics,
+    .destroy = s_shm_sink_destroy_handler,
+    .get_report_interval_ms = s_shm_sink_get_report_interval_ms,
+};
+
+struct aws_crt_statistics_handler *aws_crt_statistics_handler_new_shm_sink(
+    struct aws_allocator *allocator,
+    struct aws_shm_stats_sink *sink,
+    struct aws_event_loop *event_loop) {
+
+    struct aws_shm_stats_ring *ring = aws_shm_stats_sink_ring_for_event_loop(sink, event_loop);
+    if (ring == NULL) {
+        return NULL;
+    }
+
+    struct aws_crt_statistics_handler *handler = NULL;
+    struct aws_shm_sink_stats_handler *impl = NULL;
+    if (aws_mem_acquire_many(
+            allocator,
+            2,
+            &handler,
+            sizeof(struct aws_crt_statistics_handler),
+            &impl,
+            sizeof(struct aws_shm_sink_stats_handler)) == NULL) {
+        return NULL;
+    }
+
+    AWS_ZERO_STRUCT(*handler);
+    AWS_ZERO_STRUCT(*impl);
+
+    impl->allocator = allocator;
+    impl->ring = ring;
+
+    handler->vtable = &s_shm_sink_stats_handler_vtable;
+    handler->allocator = allocator;
+    handler->impl = impl;
+
+    return handler;
+}
+
+#endif /* _WIN32 */
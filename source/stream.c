@@ -7,10 +7,18 @@
 
 #include <aws/common/file.h>
 #include <aws/io/file_utils.h>
+#include <aws/io/logging.h>
 #include <aws/io/private/tracing.h>
 
 #include <errno.h>
 
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
 int aws_input_stream_seek(struct aws_input_stream *stream, int64_t offset, enum aws_stream_seek_basis basis) {
     AWS_ASSERT(stream && stream->vtable && stream->vtable->seek);
 
@@ -50,6 +58,29 @@ int aws_input_stream_read(struct aws_input_stream *stream, struct aws_byte_buf *
     return read_result;
 }
 
+int aws_input_stream_readv(struct aws_input_stream *stream, struct aws_byte_buf *dest_array, size_t dest_count) {
+    AWS_ASSERT(stream && stream->vtable);
+    AWS_ASSERT(dest_array != NULL || dest_count == 0);
+
+    if (stream->vtable->readv != NULL) {
+        return stream->vtable->readv(stream, dest_array, dest_count);
+    }
+
+    /* fall back to one read() per buffer */
+    struct aws_stream_status status = {.is_end_of_stream = false, .is_valid = true};
+    for (size_t i = 0; i < dest_count && !status.is_end_of_stream; ++i) {
+        if (aws_input_stream_read(stream, &dest_array[i])) {
+            return AWS_OP_ERR;
+        }
+
+        if (aws_input_stream_get_status(stream, &status)) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
 int aws_input_stream_get_status(struct aws_input_stream *stream, struct aws_stream_status *status) {
     AWS_ASSERT(stream && stream->vtable && stream->vtable->get_status);
 
@@ -160,6 +191,22 @@ static int s_aws_input_stream_byte_cursor_read(struct aws_input_stream *stream,
     return AWS_OP_SUCCESS;
 }
 
+static int s_aws_input_stream_byte_cursor_readv(
+    struct aws_input_stream *stream,
+    struct aws_byte_buf *dest_array,
+    size_t dest_count) {
+    struct aws_input_stream_byte_cursor_impl *impl =
+        AWS_CONTAINER_OF(stream, struct aws_input_stream_byte_cursor_impl, base);
+
+    for (size_t i = 0; i < dest_count && impl->current_cursor.len > 0; ++i) {
+        if (s_aws_input_stream_byte_cursor_read(stream, &dest_array[i])) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
 static int s_aws_input_stream_byte_cursor_get_status(
     struct aws_input_stream *stream,
     struct aws_stream_status *status) {
@@ -195,6 +242,7 @@ static void s_aws_input_stream_byte_cursor_destroy(struct aws_input_stream_byte_
 static struct aws_input_stream_vtable s_aws_input_stream_byte_cursor_vtable = {
     .seek = s_aws_input_stream_byte_cursor_seek,
     .read = s_aws_input_stream_byte_cursor_read,
+    .readv = s_aws_input_stream_byte_cursor_readv,
     .get_status = s_aws_input_stream_byte_cursor_get_status,
     .get_length = s_aws_input_stream_byte_cursor_get_length,
 };
@@ -256,6 +304,21 @@ static int s_aws_input_stream_file_read(struct aws_input_stream *stream, struct
     return AWS_OP_SUCCESS;
 }
 
+static int s_aws_input_stream_file_readv(
+    struct aws_input_stream *stream,
+    struct aws_byte_buf *dest_array,
+    size_t dest_count) {
+    struct aws_input_stream_file_impl *impl = AWS_CONTAINER_OF(stream, struct aws_input_stream_file_impl, base);
+
+    for (size_t i = 0; i < dest_count && !feof(impl->file); ++i) {
+        if (s_aws_input_stream_file_read(stream, &dest_array[i])) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
 static int s_aws_input_stream_file_get_status(struct aws_input_stream *stream, struct aws_stream_status *status) {
     struct aws_input_stream_file_impl *impl = AWS_CONTAINER_OF(stream, struct aws_input_stream_file_impl, base);
 
@@ -282,6 +345,7 @@ static void s_aws_input_stream_file_destroy(struct aws_input_stream_file_impl *i
 static struct aws_input_stream_vtable s_aws_input_stream_file_vtable = {
     .seek = s_aws_input_stream_file_seek,
     .read = s_aws_input_stream_file_read,
+    .readv = s_aws_input_stream_file_readv,
     .get_status = s_aws_input_stream_file_get_status,
     .get_length = s_aws_input_stream_file_get_length,
 };
@@ -319,6 +383,531 @@ struct aws_input_stream *aws_input_stream_new_from_open_file(struct aws_allocato
     return &impl->base;
 }
 
+/*
+ * memory-mapped file input stream
+ *
+ * Serves file contents through a read-only mapping so reads copy straight from the page cache,
+ * bypassing the stdio buffer.  Large files are mapped in bounded windows that slide forward with
+ * the read position; each window is advised as sequential so the kernel reads ahead aggressively
+ * and drops pages behind us.
+ */
+#ifndef _WIN32
+
+enum { AWS_STREAM_MMAP_WINDOW_MAX_BYTES = 64 * 1024 * 1024 };
+
+struct aws_input_stream_mmap_impl {
+    struct aws_input_stream base;
+    struct aws_allocator *allocator;
+    int fd;
+    uint64_t file_size;
+    uint64_t position;
+    size_t page_size;
+    /* Currently mapped window; NULL until the first read.  window_offset is page-aligned. */
+    uint8_t *window_ptr;
+    size_t window_len;
+    uint64_t window_offset;
+};
+
+static void s_aws_input_stream_mmap_unmap(struct aws_input_stream_mmap_impl *impl) {
+    if (impl->window_ptr != NULL) {
+        munmap(impl->window_ptr, impl->window_len);
+        impl->window_ptr = NULL;
+        impl->window_len = 0;
+        impl->window_offset = 0;
+    }
+}
+
+/* Remaps the window so that impl->position falls inside it. */
+static int s_aws_input_stream_mmap_slide_window(struct aws_input_stream_mmap_impl *impl) {
+    AWS_ASSERT(impl->position < impl->file_size);
+
+    s_aws_input_stream_mmap_unmap(impl);
+
+    uint64_t window_offset = impl->position - (impl->position % impl->page_size);
+    uint64_t window_len = impl->file_size - window_offset;
+    if (window_len > AWS_STREAM_MMAP_WINDOW_MAX_BYTES) {
+        window_len = AWS_STREAM_MMAP_WINDOW_MAX_BYTES;
+    }
+
+    /* safe: window_len <= 64MB, well under SIZE_MAX on any supported platform */
+    void *mapping = mmap(NULL, (size_t)window_len, PROT_READ, MAP_PRIVATE, impl->fd, (off_t)window_offset);
+    if (mapping == MAP_FAILED) {
+        return aws_raise_error(AWS_IO_STREAM_READ_FAILED);
+    }
+
+#if defined(MADV_SEQUENTIAL)
+    /* advisory only; ignore failure */
+    madvise(mapping, (size_t)window_len, MADV_SEQUENTIAL);
+#endif
+
+    impl->window_ptr = mapping;
+    impl->window_len = (size_t)window_len;
+    impl->window_offset = window_offset;
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_aws_input_stream_mmap_seek(
+    struct aws_input_stream *stream,
+    int64_t offset,
+    enum aws_stream_seek_basis basis) {
+    struct aws_input_stream_mmap_impl *impl = AWS_CONTAINER_OF(stream, struct aws_input_stream_mmap_impl, base);
+
+    /* bounds analysis mirrors the byte-cursor stream's seek above */
+    uint64_t final_offset = 0;
+
+    switch (basis) {
+        case AWS_SSB_BEGIN:
+            if (offset < 0 || (uint64_t)offset > impl->file_size) {
+                return aws_raise_error(AWS_IO_STREAM_INVALID_SEEK_POSITION);
+            }
+
+            final_offset = (uint64_t)offset;
+            break;
+
+        case AWS_SSB_END:
+            if (offset > 0 || offset == INT64_MIN || (uint64_t)(-offset) > impl->file_size) {
+                return aws_raise_error(AWS_IO_STREAM_INVALID_SEEK_POSITION);
+            }
+
+            final_offset = impl->file_size - (uint64_t)(-offset);
+            break;
+
+        default:
+            return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    /* the window slides lazily on the next read */
+    impl->position = final_offset;
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_aws_input_stream_mmap_read(struct aws_input_stream *stream, struct aws_byte_buf *dest) {
+    struct aws_input_stream_mmap_impl *impl = AWS_CONTAINER_OF(stream, struct aws_input_stream_mmap_impl, base);
+
+    while (dest->len < dest->capacity && impl->position < impl->file_size) {
+        if (impl->window_ptr == NULL || impl->position < impl->window_offset ||
+            impl->position >= impl->window_offset + impl->window_len) {
+            if (s_aws_input_stream_mmap_slide_window(impl)) {
+                return AWS_OP_ERR;
+            }
+        }
+
+        /* the window never extends past end-of-file, so window remaining bounds the copy */
+        size_t window_remaining = (size_t)(impl->window_offset + impl->window_len - impl->position);
+        size_t to_copy = dest->capacity - dest->len;
+        if (to_copy > window_remaining) {
+            to_copy = window_remaining;
+        }
+
+        if (!aws_byte_buf_write(dest, impl->window_ptr + (impl->position - impl->window_offset), to_copy)) {
+            return aws_raise_error(AWS_IO_STREAM_READ_FAILED);
+        }
+
+        impl->position += to_copy;
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_aws_input_stream_mmap_readv(
+    struct aws_input_stream *stream,
+    struct aws_byte_buf *dest_array,
+    size_t dest_count) {
+    struct aws_input_stream_mmap_impl *impl = AWS_CONTAINER_OF(stream, struct aws_input_stream_mmap_impl, base);
+
+    for (size_t i = 0; i < dest_count && impl->position < impl->file_size; ++i) {
+        if (s_aws_input_stream_mmap_read(stream, &dest_array[i])) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_aws_input_stream_mmap_get_status(struct aws_input_stream *stream, struct aws_stream_status *status) {
+    struct aws_input_stream_mmap_impl *impl = AWS_CONTAINER_OF(stream, struct aws_input_stream_mmap_impl, base);
+
+    status->is_end_of_stream = impl->position >= impl->file_size;
+    status->is_valid = true;
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_aws_input_stream_mmap_get_length(struct aws_input_stream *stream, int64_t *out_length) {
+    struct aws_input_stream_mmap_impl *impl = AWS_CONTAINER_OF(stream, struct aws_input_stream_mmap_impl, base);
+
+    if (impl->file_size > INT64_MAX) {
+        return aws_raise_error(AWS_ERROR_OVERFLOW_DETECTED);
+    }
+
+    *out_length = (int64_t)impl->file_size;
+
+    return AWS_OP_SUCCESS;
+}
+
+static void s_aws_input_stream_mmap_destroy(struct aws_input_stream_mmap_impl *impl) {
+    s_aws_input_stream_mmap_unmap(impl);
+    if (impl->fd >= 0) {
+        close(impl->fd);
+    }
+    aws_mem_release(impl->allocator, impl);
+}
+
+static struct aws_input_stream_vtable s_aws_input_stream_mmap_vtable = {
+    .seek = s_aws_input_stream_mmap_seek,
+    .read = s_aws_input_stream_mmap_read,
+    .readv = s_aws_input_stream_mmap_readv,
+    .get_status = s_aws_input_stream_mmap_get_status,
+    .get_length = s_aws_input_stream_mmap_get_length,
+};
+
+struct aws_input_stream *aws_input_stream_new_from_file_mapped(struct aws_allocator *allocator, const char *file_name) {
+
+    struct aws_input_stream_mmap_impl *impl = aws_mem_calloc(allocator, 1, sizeof(struct aws_input_stream_mmap_impl));
+    impl->allocator = allocator;
+    impl->fd = -1;
+
+    impl->fd = open(file_name, O_RDONLY | O_CLOEXEC);
+    if (impl->fd < 0) {
+        aws_translate_and_raise_io_error(errno);
+        goto on_error;
+    }
+
+    struct stat file_stats;
+    if (fstat(impl->fd, &file_stats)) {
+        aws_translate_and_raise_io_error(errno);
+        goto on_error;
+    }
+
+    /* mapping only makes sense for regular files; pipes/devices have no fixed length to map */
+    if (!S_ISREG(file_stats.st_mode)) {
+        aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        goto on_error;
+    }
+
+    impl->file_size = (uint64_t)file_stats.st_size;
+
+    long page_size = sysconf(_SC_PAGESIZE);
+    impl->page_size = (page_size > 0) ? (size_t)page_size : 4096;
+
+    impl->base.vtable = &s_aws_input_stream_mmap_vtable;
+    aws_ref_count_init(&impl->base.ref_count, impl, (aws_simple_completion_callback *)s_aws_input_stream_mmap_destroy);
+
+    return &impl->base;
+
+on_error:
+    if (impl->fd >= 0) {
+        close(impl->fd);
+    }
+    aws_mem_release(allocator, impl);
+    return NULL;
+}
+
+/*
+ * unbuffered (page-cache-bypassing) file input stream
+ *
+ * For bulk sequential streaming of data that will never be re-read (ex: multi-terabyte backups),
+ * where filling the page cache only evicts the hot working set of co-located processes.  Reads go
+ * through O_DIRECT where available, staged through a suitably aligned block that the stream reuses
+ * for its whole lifetime.  Where O_DIRECT is unavailable (or refused by the filesystem), falls back
+ * to buffered reads with POSIX_FADV_DONTNEED issued behind the read position, which keeps the cache
+ * footprint bounded even though the bytes transit it.
+ */
+
+enum {
+    /* staging block; also the I/O size, so it should stay a multiple of any sane block size */
+    AWS_STREAM_DIRECT_BLOCK_BYTES = 1024 * 1024,
+    /* fallback mode: how far the read position runs ahead before cached pages behind it are dropped */
+    AWS_STREAM_DIRECT_DROP_BEHIND_BYTES = 8 * 1024 * 1024,
+};
+
+struct aws_input_stream_unbuffered_impl {
+    struct aws_input_stream base;
+    struct aws_allocator *allocator;
+    int fd;
+    uint64_t file_size;
+    uint64_t position;
+    /* required alignment for O_DIRECT offsets/lengths/buffers; page size satisfies every filesystem */
+    size_t alignment;
+    bool direct_io; /* false: buffered fallback with drop-behind advice */
+
+    /* staging block, reused across reads.  block is the aligned pointer within block_raw. */
+    void *block_raw;
+    uint8_t *block;
+    /* file range currently staged; block_offset is alignment-aligned */
+    uint64_t block_offset;
+    size_t block_len;
+    bool block_valid;
+
+    /* fallback mode: everything below this file offset has been advised out of the cache */
+    uint64_t drop_behind_watermark;
+};
+
+/* Stages the block containing impl->position.  A short read at end-of-file is fine;
+ * reading an aligned length past EOF is explicitly allowed for O_DIRECT. */
+static int s_aws_input_stream_unbuffered_fill_block(struct aws_input_stream_unbuffered_impl *impl) {
+    uint64_t block_offset = impl->position - (impl->position % impl->alignment);
+
+    ssize_t amount_read;
+    do {
+        amount_read = pread(impl->fd, impl->block, AWS_STREAM_DIRECT_BLOCK_BYTES, (off_t)block_offset);
+    } while (amount_read < 0 && errno == EINTR);
+
+    if (amount_read < 0) {
+        return aws_raise_error(AWS_IO_STREAM_READ_FAILED);
+    }
+
+    impl->block_offset = block_offset;
+    impl->block_len = (size_t)amount_read;
+    impl->block_valid = true;
+
+    return AWS_OP_SUCCESS;
+}
+
+/* Fallback mode only: tell the kernel we're done with the pages behind the read position. */
+static void s_aws_input_stream_unbuffered_drop_behind(struct aws_input_stream_unbuffered_impl *impl) {
+#if defined(POSIX_FADV_DONTNEED)
+    if (impl->position < impl->drop_behind_watermark + AWS_STREAM_DIRECT_DROP_BEHIND_BYTES) {
+        return;
+    }
+
+    /* keep the boundary page-aligned so a partially consumed page isn't dropped and re-faulted */
+    uint64_t drop_end = impl->position - (impl->position % impl->alignment);
+
+    /* advisory only; ignore failure */
+    posix_fadvise(
+        impl->fd,
+        (off_t)impl->drop_behind_watermark,
+        (off_t)(drop_end - impl->drop_behind_watermark),
+        POSIX_FADV_DONTNEED);
+    impl->drop_behind_watermark = drop_end;
+#else
+    (void)impl;
+#endif
+}
+
+static int s_aws_input_stream_unbuffered_seek(
+    struct aws_input_stream *stream,
+    int64_t offset,
+    enum aws_stream_seek_basis basis) {
+    struct aws_input_stream_unbuffered_impl *impl =
+        AWS_CONTAINER_OF(stream, struct aws_input_stream_unbuffered_impl, base);
+
+    /* bounds analysis mirrors the byte-cursor stream's seek above */
+    uint64_t final_offset = 0;
+
+    switch (basis) {
+        case AWS_SSB_BEGIN:
+            if (offset < 0 || (uint64_t)offset > impl->file_size) {
+                return aws_raise_error(AWS_IO_STREAM_INVALID_SEEK_POSITION);
+            }
+
+            final_offset = (uint64_t)offset;
+            break;
+
+        case AWS_SSB_END:
+            if (offset > 0 || offset == INT64_MIN || (uint64_t)(-offset) > impl->file_size) {
+                return aws_raise_error(AWS_IO_STREAM_INVALID_SEEK_POSITION);
+            }
+
+            final_offset = impl->file_size - (uint64_t)(-offset);
+            break;
+
+        default:
+            return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    /* the block is restaged lazily on the next read */
+    impl->position = final_offset;
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_aws_input_stream_unbuffered_read(struct aws_input_stream *stream, struct aws_byte_buf *dest) {
+    struct aws_input_stream_unbuffered_impl *impl =
+        AWS_CONTAINER_OF(stream, struct aws_input_stream_unbuffered_impl, base);
+
+    while (dest->len < dest->capacity && impl->position < impl->file_size) {
+        if (!impl->block_valid || impl->position < impl->block_offset ||
+            impl->position >= impl->block_offset + impl->block_len) {
+            if (s_aws_input_stream_unbuffered_fill_block(impl)) {
+                return AWS_OP_ERR;
+            }
+            if (impl->position >= impl->block_offset + impl->block_len) {
+                /* the file shrank underneath us; treat it as end-of-stream */
+                impl->file_size = impl->block_offset + impl->block_len;
+                break;
+            }
+        }
+
+        size_t block_remaining = (size_t)(impl->block_offset + impl->block_len - impl->position);
+        size_t to_copy = dest->capacity - dest->len;
+        if (to_copy > block_remaining) {
+            to_copy = block_remaining;
+        }
+
+        if (!aws_byte_buf_write(dest, impl->block + (impl->position - impl->block_offset), to_copy)) {
+            return aws_raise_error(AWS_IO_STREAM_READ_FAILED);
+        }
+
+        impl->position += to_copy;
+
+        if (!impl->direct_io) {
+            s_aws_input_stream_unbuffered_drop_behind(impl);
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_aws_input_stream_unbuffered_readv(
+    struct aws_input_stream *stream,
+    struct aws_byte_buf *dest_array,
+    size_t dest_count) {
+    struct aws_input_stream_unbuffered_impl *impl =
+        AWS_CONTAINER_OF(stream, struct aws_input_stream_unbuffered_impl, base);
+
+    for (size_t i = 0; i < dest_count && impl->position < impl->file_size; ++i) {
+        if (s_aws_input_stream_unbuffered_read(stream, &dest_array[i])) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_aws_input_stream_unbuffered_get_status(struct aws_input_stream *stream, struct aws_stream_status *status) {
+    struct aws_input_stream_unbuffered_impl *impl =
+        AWS_CONTAINER_OF(stream, struct aws_input_stream_unbuffered_impl, base);
+
+    status->is_end_of_stream = impl->position >= impl->file_size;
+    status->is_valid = true;
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_aws_input_stream_unbuffered_get_length(struct aws_input_stream *stream, int64_t *out_length) {
+    struct aws_input_stream_unbuffered_impl *impl =
+        AWS_CONTAINER_OF(stream, struct aws_input_stream_unbuffered_impl, base);
+
+    if (impl->file_size > INT64_MAX) {
+        return aws_raise_error(AWS_ERROR_OVERFLOW_DETECTED);
+    }
+
+    *out_length = (int64_t)impl->file_size;
+
+    return AWS_OP_SUCCESS;
+}
+
+static void s_aws_input_stream_unbuffered_destroy(struct aws_input_stream_unbuffered_impl *impl) {
+    if (impl->fd >= 0) {
+        close(impl->fd);
+    }
+    aws_mem_release(impl->allocator, impl->block_raw);
+    aws_mem_release(impl->allocator, impl);
+}
+
+static struct aws_input_stream_vtable s_aws_input_stream_unbuffered_vtable = {
+    .seek = s_aws_input_stream_unbuffered_seek,
+    .read = s_aws_input_stream_unbuffered_read,
+    .readv = s_aws_input_stream_unbuffered_readv,
+    .get_status = s_aws_input_stream_unbuffered_get_status,
+    .get_length = s_aws_input_stream_unbuffered_get_length,
+};
+
+struct aws_input_stream *aws_input_stream_new_from_file_unbuffered(
+    struct aws_allocator *allocator,
+    const char *file_name) {
+
+    struct aws_input_stream_unbuffered_impl *impl =
+        aws_mem_calloc(allocator, 1, sizeof(struct aws_input_stream_unbuffered_impl));
+    impl->allocator = allocator;
+    impl->fd = -1;
+
+#if defined(O_DIRECT)
+    impl->fd = open(file_name, O_RDONLY | O_CLOEXEC | O_DIRECT);
+    if (impl->fd >= 0) {
+        impl->direct_io = true;
+    }
+#endif
+
+    /* some filesystems (ex: tmpfs, some network mounts) refuse O_DIRECT; fall back to
+     * buffered reads and keep the cache footprint bounded with drop-behind advice instead */
+    if (impl->fd < 0) {
+        impl->fd = open(file_name, O_RDONLY | O_CLOEXEC);
+        if (impl->fd < 0) {
+            aws_translate_and_raise_io_error(errno);
+            goto on_error;
+        }
+
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_FILE_UTILS,
+            "Direct I/O unavailable for file '%s'; using buffered reads with drop-behind advice.",
+            file_name);
+
+#if defined(POSIX_FADV_SEQUENTIAL)
+        /* advisory only; ignore failure */
+        posix_fadvise(impl->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    }
+
+    struct stat file_stats;
+    if (fstat(impl->fd, &file_stats)) {
+        aws_translate_and_raise_io_error(errno);
+        goto on_error;
+    }
+
+    /* direct I/O only makes sense for regular files; pipes/devices have their own semantics */
+    if (!S_ISREG(file_stats.st_mode)) {
+        aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        goto on_error;
+    }
+
+    impl->file_size = (uint64_t)file_stats.st_size;
+
+    long page_size = sysconf(_SC_PAGESIZE);
+    impl->alignment = (page_size > 0) ? (size_t)page_size : 4096;
+
+    /* the allocator doesn't guarantee page alignment, so over-allocate and align by hand */
+    impl->block_raw = aws_mem_acquire(allocator, AWS_STREAM_DIRECT_BLOCK_BYTES + impl->alignment);
+    impl->block = (uint8_t *)(((uintptr_t)impl->block_raw + impl->alignment - 1) & ~((uintptr_t)impl->alignment - 1));
+
+    impl->base.vtable = &s_aws_input_stream_unbuffered_vtable;
+    aws_ref_count_init(
+        &impl->base.ref_count, impl, (aws_simple_completion_callback *)s_aws_input_stream_unbuffered_destroy);
+
+    return &impl->base;
+
+on_error:
+    if (impl->fd >= 0) {
+        close(impl->fd);
+    }
+    aws_mem_release(allocator, impl);
+    return NULL;
+}
+
+#else /* _WIN32 */
+
+struct aws_input_stream *aws_input_stream_new_from_file_mapped(struct aws_allocator *allocator, const char *file_name) {
+    AWS_LOGF_DEBUG(
+        AWS_LS_IO_FILE_UTILS,
+        "Memory-mapped streams are not supported on this platform; falling back to a buffered file stream.");
+    return aws_input_stream_new_from_file(allocator, file_name);
+}
+
+struct aws_input_stream *aws_input_stream_new_from_file_unbuffered(
+    struct aws_allocator *allocator,
+    const char *file_name) {
+    AWS_LOGF_DEBUG(
+        AWS_LS_IO_FILE_UTILS,
+        "Unbuffered streams are not supported on this platform; falling back to a buffered file stream.");
+    return aws_input_stream_new_from_file(allocator, file_name);
+}
+
+#endif /* _WIN32 */
+
 struct aws_input_stream *aws_input_stream_acquire(struct aws_input_stream *stream) {
     if (stream != NULL) {
         if (stream->vtable->acquire) {
@@ -0,0 +1,83 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/io/private/task_watchdog.h>
+
+#include <aws/common/clock.h>
+#include <aws/io/logging.h>
+
+enum {
+    /* a task holding the loop thread for this long is almost certainly a bug */
+    DEFAULT_BUDGET_NS = 100000000, /* 100ms */
+};
+
+int aws_task_watchdog_init(
+    struct aws_task_watchdog *watchdog,
+    struct aws_allocator *alloc,
+    aws_io_clock_fn *clock,
+    uint64_t budget_ns) {
+    AWS_PRECONDITION(clock != NULL);
+
+    watchdog->alloc = alloc;
+    watchdog->clock = clock;
+    watchdog->budget_ns = budget_ns != 0 ? budget_ns : DEFAULT_BUDGET_NS;
+
+    /* type tags are string literals, so pointer identity is the right equality */
+    return aws_hash_table_init(&watchdog->overrun_counts, alloc, 8, aws_hash_ptr, aws_ptr_eq, NULL, NULL);
+}
+
+void aws_task_watchdog_clean_up(struct aws_task_watchdog *watchdog) {
+    aws_hash_table_clean_up(&watchdog->overrun_counts);
+}
+
+static size_t s_bump_overrun_count(struct aws_task_watchdog *watchdog, const void *tag) {
+    struct aws_hash_element *elem = NULL;
+    if (aws_hash_table_create(&watchdog->overrun_counts, (void *)tag, &elem, NULL)) {
+        return 1;
+    }
+    elem->value = (void *)((uintptr_t)elem->value + 1);
+    return (size_t)(uintptr_t)elem->value;
+}
+
+void aws_task_watchdog_run_task(
+    struct aws_task_watchdog *watchdog,
+    struct aws_task *task,
+    enum aws_task_status status) {
+    uint64_t start_ns = 0;
+    watchdog->clock(&start_ns);
+
+    task->fn(task, task->arg, status);
+
+    uint64_t end_ns = 0;
+    watchdog->clock(&end_ns);
+
+    if (AWS_UNLIKELY(end_ns > start_ns && end_ns - start_ns > watchdog->budget_ns)) {
+        const char *type_tag = task->type_tag != NULL ? task->type_tag : "<untagged>";
+        size_t count = s_bump_overrun_count(watchdog, type_tag);
+        AWS_LOGF_WARN(
+            AWS_LS_IO_EVENT_LOOP,
+            "task_watchdog: task %p \"%s\" ran for %llums (budget %llums); overrun #%zu for this tag",
+            (void *)task,
+            type_tag,
+            (unsigned long long)aws_timestamp_convert(end_ns - start_ns, AWS_TIMESTAMP_NANOS, AWS_TIMESTAMP_MILLIS, NULL),
+            (unsigned long long)aws_timestamp_convert(
+                watchdog->budget_ns, AWS_TIMESTAMP_NANOS, AWS_TIMESTAMP_MILLIS, NULL),
+            count);
+    }
+}
+
+void aws_task_watchdog_report_pass(struct aws_task_watchdog *watchdog, uint64_t start_ns, uint64_t end_ns) {
+    if (AWS_UNLIKELY(end_ns > start_ns && end_ns - start_ns > watchdog->budget_ns)) {
+        static const char *s_pass_tag = "<scheduler-pass>";
+        size_t count = s_bump_overrun_count(watchdog, s_pass_tag);
+        AWS_LOGF_WARN(
+            AWS_LS_IO_EVENT_LOOP,
+            "task_watchdog: scheduler pass ran for %llums (budget %llums); overrun #%zu",
+            (unsigned long long)aws_timestamp_convert(end_ns - start_ns, AWS_TIMESTAMP_NANOS, AWS_TIMESTAMP_MILLIS, NULL),
+            (unsigned long long)aws_timestamp_convert(
+                watchdog->budget_ns, AWS_TIMESTAMP_NANOS, AWS_TIMESTAMP_MILLIS, NULL),
+            count);
+    }
+}
@@ -0,0 +1,195 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/io/private/timer_wheel.h>
+
+#include <aws/io/private/task_watchdog.h>
+
+enum {
+    /* 1ms ticks on level 0, which makes level 1 ticks 512ms and the total horizon ~131s */
+    TICK0_NS = 1000000,
+};
+
+#define TICK1_NS ((uint64_t)TICK0_NS * AWS_TIMER_WHEEL_LEVEL0_SLOTS)
+#define HORIZON0_NS ((uint64_t)TICK0_NS * AWS_TIMER_WHEEL_LEVEL0_SLOTS)
+#define HORIZON1_NS (TICK1_NS * AWS_TIMER_WHEEL_LEVEL1_SLOTS)
+
+/* values stashed in aws_task.reserved while a task is linked into one of our slot lists. The
+ * magic offset keeps freshly-initialized tasks (reserved == 0) from ever looking like ours. */
+enum wheel_membership {
+    WHEEL_MEMBER_NONE = 0,
+    WHEEL_MEMBER_LEVEL0 = 0xA150,
+    WHEEL_MEMBER_LEVEL1 = 0xA151,
+};
+
+void aws_timer_wheel_init(struct aws_timer_wheel *wheel, uint64_t now_ns) {
+    for (size_t i = 0; i < AWS_TIMER_WHEEL_LEVEL0_SLOTS; ++i) {
+        aws_linked_list_init(&wheel->level0[i]);
+    }
+    for (size_t i = 0; i < AWS_TIMER_WHEEL_LEVEL1_SLOTS; ++i) {
+        aws_linked_list_init(&wheel->level1[i]);
+    }
+    wheel->current_tick0 = now_ns / TICK0_NS;
+    wheel->current_tick1 = now_ns / TICK1_NS;
+    wheel->last_now_ns = now_ns;
+    wheel->level0_count = 0;
+    wheel->level1_count = 0;
+    wheel->watchdog = NULL;
+}
+
+static void s_run_due_task(struct aws_timer_wheel *wheel, struct aws_task *task) {
+    if (wheel->watchdog != NULL) {
+        aws_task_watchdog_run_task(wheel->watchdog, task, AWS_TASK_STATUS_RUN_READY);
+    } else {
+        task->fn(task, task->arg, AWS_TASK_STATUS_RUN_READY);
+    }
+}
+
+static void s_drain_list(struct aws_linked_list *list, enum aws_task_status status) {
+    while (!aws_linked_list_empty(list)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(list);
+        struct aws_task *task = AWS_CONTAINER_OF(node, struct aws_task, node);
+        task->reserved = WHEEL_MEMBER_NONE;
+        task->fn(task, task->arg, status);
+    }
+}
+
+void aws_timer_wheel_clean_up(struct aws_timer_wheel *wheel) {
+    for (size_t i = 0; i < AWS_TIMER_WHEEL_LEVEL0_SLOTS; ++i) {
+        s_drain_list(&wheel->level0[i], AWS_TASK_STATUS_CANCELED);
+    }
+    for (size_t i = 0; i < AWS_TIMER_WHEEL_LEVEL1_SLOTS; ++i) {
+        s_drain_list(&wheel->level1[i], AWS_TASK_STATUS_CANCELED);
+    }
+    wheel->level0_count = 0;
+    wheel->level1_count = 0;
+}
+
+bool aws_timer_wheel_try_schedule(struct aws_timer_wheel *wheel, struct aws_task *task, uint64_t run_at_nanos) {
+    uint64_t delta = run_at_nanos > wheel->last_now_ns ? run_at_nanos - wheel->last_now_ns : 0;
+
+    task->timestamp = run_at_nanos;
+
+    if (delta < HORIZON0_NS) {
+        size_t slot = (size_t)((run_at_nanos / TICK0_NS) % AWS_TIMER_WHEEL_LEVEL0_SLOTS);
+        aws_linked_list_push_back(&wheel->level0[slot], &task->node);
+        task->reserved = WHEEL_MEMBER_LEVEL0;
+        wheel->level0_count++;
+        return true;
+    }
+
+    if (delta < HORIZON1_NS) {
+        size_t slot = (size_t)((run_at_nanos / TICK1_NS) % AWS_TIMER_WHEEL_LEVEL1_SLOTS);
+        aws_linked_list_push_back(&wheel->level1[slot], &task->node);
+        task->reserved = WHEEL_MEMBER_LEVEL1;
+        wheel->level1_count++;
+        return true;
+    }
+
+    /* beyond the horizon; caller falls back to its priority-queue scheduler */
+    return false;
+}
+
+bool aws_timer_wheel_try_cancel(struct aws_timer_wheel *wheel, struct aws_task *task) {
+    if (task->reserved == WHEEL_MEMBER_LEVEL0) {
+        wheel->level0_count--;
+    } else if (task->reserved == WHEEL_MEMBER_LEVEL1) {
+        wheel->level1_count--;
+    } else {
+        return false;
+    }
+
+    aws_linked_list_remove(&task->node);
+    task->reserved = WHEEL_MEMBER_NONE;
+    task->fn(task, task->arg, AWS_TASK_STATUS_CANCELED);
+    return true;
+}
+
+/* Runs due tasks in a level-0 slot; tasks hashed here for a later lap stay put. */
+static void s_sweep_level0_slot(struct aws_timer_wheel *wheel, size_t slot, uint64_t now_ns) {
+    struct aws_linked_list *list = &wheel->level0[slot];
+    struct aws_linked_list_node *node = aws_linked_list_begin(list);
+    while (node != aws_linked_list_end(list)) {
+        struct aws_task *task = AWS_CONTAINER_OF(node, struct aws_task, node);
+        node = aws_linked_list_next(node);
+        if (task->timestamp <= now_ns) {
+            aws_linked_list_remove(&task->node);
+            task->reserved = WHEEL_MEMBER_NONE;
+            wheel->level0_count--;
+            s_run_due_task(wheel, task);
+        }
+    }
+}
+
+/* Runs due tasks in a level-1 slot and cascades not-yet-due tasks that now fit level 0's horizon. */
+static void s_sweep_level1_slot(struct aws_timer_wheel *wheel, size_t slot, uint64_t now_ns) {
+    struct aws_linked_list *list = &wheel->level1[slot];
+    struct aws_linked_list_node *node = aws_linked_list_begin(list);
+    while (node != aws_linked_list_end(list)) {
+        struct aws_task *task = AWS_CONTAINER_OF(node, struct aws_task, node);
+        node = aws_linked_list_next(node);
+
+        if (task->timestamp <= now_ns) {
+            aws_linked_list_remove(&task->node);
+            task->reserved = WHEEL_MEMBER_NONE;
+            wheel->level1_count--;
+            s_run_due_task(wheel, task);
+        } else if (task->timestamp - now_ns < HORIZON0_NS) {
+            aws_linked_list_remove(&task->node);
+            wheel->level1_count--;
+            aws_timer_wheel_try_schedule(wheel, task, task->timestamp);
+        }
+    }
+}
+
+void aws_timer_wheel_run_due(struct aws_timer_wheel *wheel, uint64_t now_ns) {
+    if (now_ns < wheel->last_now_ns) {
+        return;
+    }
+    wheel->last_now_ns = now_ns;
+
+    uint64_t target_tick0 = now_ns / TICK0_NS;
+    if (wheel->level0_count > 0 && target_tick0 > wheel->current_tick0) {
+        if (target_tick0 - wheel->current_tick0 >= AWS_TIMER_WHEEL_LEVEL0_SLOTS) {
+            /* slept for more than a full lap; one pass over every slot beats ticking through it */
+            for (size_t slot = 0; slot < AWS_TIMER_WHEEL_LEVEL0_SLOTS; ++slot) {
+                s_sweep_level0_slot(wheel, slot, now_ns);
+            }
+        } else {
+            for (uint64_t tick = wheel->current_tick0 + 1; tick <= target_tick0; ++tick) {
+                s_sweep_level0_slot(wheel, (size_t)(tick % AWS_TIMER_WHEEL_LEVEL0_SLOTS), now_ns);
+            }
+        }
+    }
+    wheel->current_tick0 = target_tick0;
+
+    uint64_t target_tick1 = now_ns / TICK1_NS;
+    if (wheel->level1_count > 0) {
+        /* sweep through the current slot too, so tasks near the front of the window cascade early */
+        if (target_tick1 > wheel->current_tick1 &&
+            target_tick1 - wheel->current_tick1 >= AWS_TIMER_WHEEL_LEVEL1_SLOTS) {
+            for (size_t slot = 0; slot < AWS_TIMER_WHEEL_LEVEL1_SLOTS; ++slot) {
+                s_sweep_level1_slot(wheel, slot, now_ns);
+            }
+        } else {
+            for (uint64_t tick = wheel->current_tick1; tick <= target_tick1; ++tick) {
+                s_sweep_level1_slot(wheel, (size_t)(tick % AWS_TIMER_WHEEL_LEVEL1_SLOTS), now_ns);
+            }
+        }
+    }
+    wheel->current_tick1 = target_tick1;
+}
+
+bool aws_timer_wheel_has_tasks(const struct aws_timer_wheel *wheel, uint64_t *next_run_time_ns) {
+    if (wheel->level0_count > 0) {
+        *next_run_time_ns = (wheel->current_tick0 + 1) * TICK0_NS;
+        return true;
+    }
+    if (wheel->level1_count > 0) {
+        *next_run_time_ns = (wheel->current_tick1 + 1) * TICK1_NS;
+        return true;
+    }
+    return false;
+}
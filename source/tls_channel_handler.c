@@ -15,8 +15,21 @@
 
 #include "./pkcs11_private.h"
 
+#include <aws/common/clock.h>
+#include <aws/common/hash_table.h>
+#include <aws/common/lru_cache.h>
+#include <aws/common/mutex.h>
 #include <aws/common/string.h>
 
+#ifndef _WIN32
+#    include <errno.h>
+#    include <fcntl.h>
+#    include <stdio.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
 void aws_tls_ctx_options_init_default_client(struct aws_tls_ctx_options *options, struct aws_allocator *allocator) {
     AWS_ZERO_STRUCT(*options);
     options->allocator = allocator;
@@ -27,6 +40,12 @@ void aws_tls_ctx_options_init_default_client(struct aws_tls_ctx_options *options
 }
 
 void aws_tls_ctx_options_clean_up(struct aws_tls_ctx_options *options) {
+#ifndef _WIN32
+    if (options->ca_file_shared_mapping) {
+        munmap(options->ca_file_shared_mapping, options->ca_file_shared_mapping_size);
+        AWS_ZERO_STRUCT(options->ca_file);
+    }
+#endif
     aws_byte_buf_clean_up(&options->ca_file);
     aws_string_destroy(options->ca_path);
     aws_byte_buf_clean_up(&options->certificate);
@@ -191,7 +210,8 @@ int aws_tls_ctx_options_init_client_mtls_with_pkcs11(
         &pkcs11_options->user_pin,
         &pkcs11_options->token_label,
         &pkcs11_options->private_key_object_label,
-        pkcs11_options->slot_id);
+        pkcs11_options->slot_id,
+        pkcs11_options->max_sessions);
 
     struct aws_byte_buf tmp_cert_buf;
     AWS_ZERO_STRUCT(tmp_cert_buf);
@@ -521,10 +541,203 @@ error:
     return AWS_OP_ERR;
 }
 
+#ifdef _WIN32
+int aws_tls_ctx_options_override_default_trust_store_from_shared_cache(
+    struct aws_tls_ctx_options *options,
+    const char *ca_file,
+    const char *cache_path) {
+    (void)options;
+    (void)ca_file;
+    (void)cache_path;
+    return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+}
+#else
+/* Maps an existing sanitized-PEM cache read-only; every process mapping the same file shares one
+ * set of physical pages for the bundle. */
+static int s_trust_store_cache_map(struct aws_tls_ctx_options *options, const char *cache_path) {
+    int fd = open(cache_path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return AWS_OP_ERR;
+    }
+
+    struct stat file_info;
+    if (fstat(fd, &file_info) != 0 || file_info.st_size <= 0) {
+        close(fd);
+        return AWS_OP_ERR;
+    }
+
+    size_t mapping_size = (size_t)file_info.st_size;
+    void *mapping = mmap(NULL, mapping_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return AWS_OP_ERR;
+    }
+
+    /* a sanitized cache always opens with a PEM begin header; anything else is a stale or foreign
+     * file, and the caller rebuilds it */
+    struct aws_byte_cursor pem_prefix = aws_byte_cursor_from_c_str("-----BEGIN");
+    if (mapping_size < pem_prefix.len || memcmp(mapping, pem_prefix.ptr, pem_prefix.len) != 0) {
+        munmap(mapping, mapping_size);
+        return AWS_OP_ERR;
+    }
+
+    options->ca_file.buffer = mapping;
+    options->ca_file.len = mapping_size;
+    options->ca_file.capacity = mapping_size;
+    options->ca_file.allocator = NULL;
+    options->ca_file_shared_mapping = mapping;
+    options->ca_file_shared_mapping_size = mapping_size;
+    return AWS_OP_SUCCESS;
+}
+
+/* Writes the sanitized bundle to a temp file beside cache_path and renames it into place, so
+ * concurrent first processes race benignly and a reader never maps a partial file. */
+static int s_trust_store_cache_build(const struct aws_byte_buf *sanitized_pem, const char *cache_path) {
+    char temp_path[1024];
+    int formatted = snprintf(temp_path, sizeof(temp_path), "%s.tmp.%d", cache_path, (int)getpid());
+    if (formatted <= 0 || (size_t)formatted >= sizeof(temp_path)) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    int fd = open(temp_path, O_CREAT | O_EXCL | O_WRONLY | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (fd < 0) {
+        return aws_raise_error(AWS_ERROR_SYS_CALL_FAILURE);
+    }
+
+    const uint8_t *cursor = sanitized_pem->buffer;
+    size_t remaining = sanitized_pem->len;
+    while (remaining > 0) {
+        ssize_t written = write(fd, cursor, remaining);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            close(fd);
+            unlink(temp_path);
+            return aws_raise_error(AWS_ERROR_SYS_CALL_FAILURE);
+        }
+        cursor += written;
+        remaining -= (size_t)written;
+    }
+
+    if (close(fd) != 0 || rename(temp_path, cache_path) != 0) {
+        unlink(temp_path);
+        return aws_raise_error(AWS_ERROR_SYS_CALL_FAILURE);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+int aws_tls_ctx_options_override_default_trust_store_from_shared_cache(
+    struct aws_tls_ctx_options *options,
+    const char *ca_file,
+    const char *cache_path) {
+
+    if (!cache_path) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    if (aws_tls_options_buf_is_set(&options->ca_file)) {
+        AWS_LOGF_ERROR(AWS_LS_IO_TLS, "static: cannot override trust store multiple times");
+        return aws_raise_error(AWS_ERROR_INVALID_STATE);
+    }
+
+    if (s_trust_store_cache_map(options, cache_path) == AWS_OP_SUCCESS) {
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_TLS,
+            "static: attached to shared trust-store cache %s (%zu bytes), skipping per-process parse",
+            cache_path,
+            options->ca_file_shared_mapping_size);
+        return AWS_OP_SUCCESS;
+    }
+
+    /* no usable cache yet; this process builds it from the source bundle */
+    if (!ca_file) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_TLS,
+            "static: shared trust-store cache %s is missing and no source bundle was given",
+            cache_path);
+        return aws_raise_error(AWS_ERROR_FILE_INVALID_PATH);
+    }
+
+    struct aws_byte_buf ca_file_tmp;
+    AWS_ZERO_STRUCT(ca_file_tmp);
+    if (aws_byte_buf_init_from_file(&ca_file_tmp, options->allocator, ca_file)) {
+        return AWS_OP_ERR;
+    }
+
+    if (aws_sanitize_pem(&ca_file_tmp, options->allocator)) {
+        AWS_LOGF_ERROR(AWS_LS_IO_TLS, "static: Invalid CA file. File must contain PEM encoded data");
+        aws_byte_buf_clean_up_secure(&ca_file_tmp);
+        return AWS_OP_ERR;
+    }
+
+    if (s_trust_store_cache_build(&ca_file_tmp, cache_path) == AWS_OP_SUCCESS &&
+        s_trust_store_cache_map(options, cache_path) == AWS_OP_SUCCESS) {
+        AWS_LOGF_INFO(
+            AWS_LS_IO_TLS,
+            "static: built shared trust-store cache %s (%zu bytes)",
+            cache_path,
+            options->ca_file_shared_mapping_size);
+        aws_byte_buf_clean_up_secure(&ca_file_tmp);
+        return AWS_OP_SUCCESS;
+    }
+
+    /* cache couldn't be written or mapped (read-only filesystem, concurrent writer, ...); fall
+     * back to the private heap copy so the context still comes up */
+    AWS_LOGF_WARN(
+        AWS_LS_IO_TLS,
+        "static: failed to build shared trust-store cache %s, falling back to a private copy",
+        cache_path);
+    options->ca_file = ca_file_tmp;
+    return AWS_OP_SUCCESS;
+}
+#endif /* _WIN32 */
+
 void aws_tls_ctx_options_set_extension_data(struct aws_tls_ctx_options *options, void *extension_data) {
     options->ctx_options_extension = extension_data;
 }
 
+int aws_tls_ctx_options_set_session_cache(
+    struct aws_tls_ctx_options *options,
+    const struct aws_tls_session_cache_options *cache_options) {
+
+    if (cache_options != NULL && ((cache_options->put_fn == NULL) != (cache_options->get_fn == NULL))) {
+        AWS_LOGF_ERROR(
+            AWS_LS_IO_TLS, "static: session cache callbacks must be supplied together, or not at all");
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    options->session_cache_enabled = true;
+    if (cache_options != NULL) {
+        options->session_cache_options = *cache_options;
+    } else {
+        AWS_ZERO_STRUCT(options->session_cache_options);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+void aws_tls_ctx_options_set_ktls_offload(struct aws_tls_ctx_options *options, bool ktls_offload) {
+    options->ktls_offload_enabled = ktls_offload;
+}
+
+void aws_tls_ctx_options_set_send_buffer_size(struct aws_tls_ctx_options *options, size_t send_buffer_size) {
+    options->send_buffer_size = send_buffer_size;
+}
+
+void aws_tls_ctx_options_set_chain_validation_callback(
+    struct aws_tls_ctx_options *options,
+    aws_tls_on_chain_validation_fn *on_chain_validation,
+    void *user_data) {
+    options->on_chain_validation = on_chain_validation;
+    options->chain_validation_user_data = user_data;
+}
+
+void aws_tls_ctx_options_set_verification_caching(struct aws_tls_ctx_options *options, bool enabled) {
+    options->verification_cache_enabled = enabled;
+}
+
 int aws_tls_ctx_options_override_default_trust_store(
     struct aws_tls_ctx_options *options,
     const struct aws_byte_cursor *ca_file) {
@@ -619,6 +832,14 @@ void aws_tls_connection_options_set_callbacks(
     conn_options->user_data = user_data;
 }
 
+void aws_tls_connection_options_set_dynamic_record_threshold(
+    struct aws_tls_connection_options *conn_options,
+    uint32_t resize_threshold,
+    uint16_t timeout_threshold) {
+    conn_options->dynamic_record_resize_threshold = resize_threshold;
+    conn_options->dynamic_record_timeout_threshold = timeout_threshold;
+}
+
 int aws_tls_connection_options_set_server_name(
     struct aws_tls_connection_options *conn_options,
     struct aws_allocator *allocator,
@@ -791,6 +1012,324 @@ void aws_tls_ctx_release(struct aws_tls_ctx *ctx) {
     }
 }
 
+#ifndef BYO_CRYPTO
+
+static struct aws_mutex s_tls_ctx_cache_lock = AWS_MUTEX_INIT;
+static struct aws_hash_table s_tls_ctx_cache_table;
+static bool s_tls_ctx_cache_initialized;
+
+static void s_tls_ctx_cache_release_value(void *value) {
+    aws_tls_ctx_release(value);
+}
+
+static int s_fingerprint_append_field(struct aws_byte_buf *fingerprint, struct aws_byte_cursor field) {
+    uint64_t field_length = (uint64_t)field.len;
+    struct aws_byte_cursor length_cursor = {.ptr = (uint8_t *)&field_length, .len = sizeof(field_length)};
+
+    if (aws_byte_buf_append_dynamic(fingerprint, &length_cursor)) {
+        return AWS_OP_ERR;
+    }
+
+    return field.len > 0 ? aws_byte_buf_append_dynamic(fingerprint, &field) : AWS_OP_SUCCESS;
+}
+
+/*
+ * Serializes every option that influences the resulting context into a canonical byte string: fixed-size scalars
+ * (with any struct padding zeroed) followed by each variable-length field, length-prefixed so distinct option sets
+ * cannot serialize to the same bytes. Callback/extension pointers are fingerprinted by identity.
+ */
+static struct aws_string *s_tls_ctx_options_fingerprint(
+    struct aws_allocator *allocator,
+    const struct aws_tls_ctx_options *options) {
+
+    struct {
+        int minimum_tls_version;
+        int cipher_pref;
+        uint64_t max_fragment_size;
+        uint64_t send_buffer_size;
+        uint64_t session_cache_capacity;
+        uint8_t verify_peer;
+        uint8_t session_cache_enabled;
+        uint8_t ktls_offload_enabled;
+        uint8_t verification_cache_enabled;
+        const void *custom_key_op_handler;
+        const void *ctx_options_extension;
+        const void *session_cache_put_fn;
+        const void *session_cache_get_fn;
+        const void *session_cache_user_data;
+        const void *on_chain_validation;
+        const void *chain_validation_user_data;
+    } scalar_fields;
+    AWS_ZERO_STRUCT(scalar_fields);
+
+    scalar_fields.minimum_tls_version = (int)options->minimum_tls_version;
+    scalar_fields.cipher_pref = (int)options->cipher_pref;
+    scalar_fields.max_fragment_size = (uint64_t)options->max_fragment_size;
+    scalar_fields.send_buffer_size = (uint64_t)options->send_buffer_size;
+    scalar_fields.session_cache_capacity = (uint64_t)options->session_cache_options.capacity;
+    scalar_fields.verify_peer = options->verify_peer ? 1 : 0;
+    scalar_fields.session_cache_enabled = options->session_cache_enabled ? 1 : 0;
+    scalar_fields.ktls_offload_enabled = options->ktls_offload_enabled ? 1 : 0;
+    scalar_fields.verification_cache_enabled = options->verification_cache_enabled ? 1 : 0;
+    scalar_fields.custom_key_op_handler = options->custom_key_op_handler;
+    scalar_fields.ctx_options_extension = options->ctx_options_extension;
+    scalar_fields.session_cache_put_fn = (const void *)options->session_cache_options.put_fn;
+    scalar_fields.session_cache_get_fn = (const void *)options->session_cache_options.get_fn;
+    scalar_fields.session_cache_user_data = options->session_cache_options.user_data;
+    scalar_fields.on_chain_validation = (const void *)options->on_chain_validation;
+    scalar_fields.chain_validation_user_data = options->chain_validation_user_data;
+
+    struct aws_byte_buf fingerprint;
+    if (aws_byte_buf_init(&fingerprint, allocator, 256)) {
+        return NULL;
+    }
+
+    struct aws_byte_cursor scalar_cursor = {.ptr = (uint8_t *)&scalar_fields, .len = sizeof(scalar_fields)};
+    struct aws_byte_cursor empty_cursor;
+    AWS_ZERO_STRUCT(empty_cursor);
+
+    if (aws_byte_buf_append_dynamic(&fingerprint, &scalar_cursor) ||
+        s_fingerprint_append_field(&fingerprint, aws_byte_cursor_from_buf(&options->ca_file)) ||
+        s_fingerprint_append_field(
+            &fingerprint, options->ca_path ? aws_byte_cursor_from_string(options->ca_path) : empty_cursor) ||
+        s_fingerprint_append_field(
+            &fingerprint, options->alpn_list ? aws_byte_cursor_from_string(options->alpn_list) : empty_cursor) ||
+        s_fingerprint_append_field(&fingerprint, aws_byte_cursor_from_buf(&options->certificate)) ||
+        s_fingerprint_append_field(&fingerprint, aws_byte_cursor_from_buf(&options->private_key))) {
+        goto on_error;
+    }
+
+#ifdef _WIN32
+    if (s_fingerprint_append_field(
+            &fingerprint,
+            options->system_certificate_path ? aws_byte_cursor_from_c_str(options->system_certificate_path)
+                                             : empty_cursor)) {
+        goto on_error;
+    }
+#endif
+
+#ifdef __APPLE__
+    if (s_fingerprint_append_field(&fingerprint, aws_byte_cursor_from_buf(&options->pkcs12)) ||
+        s_fingerprint_append_field(&fingerprint, aws_byte_cursor_from_buf(&options->pkcs12_password))) {
+        goto on_error;
+    }
+#    if !defined(AWS_OS_IOS)
+    if (s_fingerprint_append_field(
+            &fingerprint,
+            options->keychain_path ? aws_byte_cursor_from_string(options->keychain_path) : empty_cursor)) {
+        goto on_error;
+    }
+#    endif
+#endif
+
+    struct aws_string *result = aws_string_new_from_array(allocator, fingerprint.buffer, fingerprint.len);
+    aws_byte_buf_clean_up_secure(&fingerprint);
+    return result;
+
+on_error:
+    aws_byte_buf_clean_up_secure(&fingerprint);
+    return NULL;
+}
+
+struct aws_tls_ctx *aws_tls_client_ctx_new_cached(
+    struct aws_allocator *alloc,
+    const struct aws_tls_ctx_options *options) {
+
+    struct aws_string *fingerprint = s_tls_ctx_options_fingerprint(alloc, options);
+    if (fingerprint == NULL) {
+        return NULL;
+    }
+
+    aws_mutex_lock(&s_tls_ctx_cache_lock);
+
+    if (!s_tls_ctx_cache_initialized) {
+        if (aws_hash_table_init(
+                &s_tls_ctx_cache_table,
+                alloc,
+                8,
+                aws_hash_string,
+                aws_hash_callback_string_eq,
+                aws_hash_callback_string_destroy,
+                s_tls_ctx_cache_release_value)) {
+            aws_mutex_unlock(&s_tls_ctx_cache_lock);
+            aws_string_destroy(fingerprint);
+            return NULL;
+        }
+        s_tls_ctx_cache_initialized = true;
+    }
+
+    struct aws_hash_element *element = NULL;
+    aws_hash_table_find(&s_tls_ctx_cache_table, fingerprint, &element);
+    if (element != NULL) {
+        struct aws_tls_ctx *existing = aws_tls_ctx_acquire(element->value);
+        aws_mutex_unlock(&s_tls_ctx_cache_lock);
+        aws_string_destroy(fingerprint);
+        AWS_LOGF_DEBUG(
+            AWS_LS_IO_TLS, "static: returning interned tls ctx %p for identical options", (void *)existing);
+        return existing;
+    }
+
+    aws_mutex_unlock(&s_tls_ctx_cache_lock);
+
+    /* Building a context parses certificates and trust stores (multi-millisecond); do it outside the lock. */
+    struct aws_tls_ctx *ctx = aws_tls_client_ctx_new(alloc, options);
+    if (ctx == NULL) {
+        aws_string_destroy(fingerprint);
+        return NULL;
+    }
+
+    aws_mutex_lock(&s_tls_ctx_cache_lock);
+
+    element = NULL;
+    aws_hash_table_find(&s_tls_ctx_cache_table, fingerprint, &element);
+    if (element != NULL) {
+        /* Another thread interned the same options while we were building; keep theirs. */
+        struct aws_tls_ctx *existing = aws_tls_ctx_acquire(element->value);
+        aws_mutex_unlock(&s_tls_ctx_cache_lock);
+        aws_string_destroy(fingerprint);
+        aws_tls_ctx_release(ctx);
+        return existing;
+    }
+
+    if (aws_hash_table_put(&s_tls_ctx_cache_table, fingerprint, aws_tls_ctx_acquire(ctx), NULL)) {
+        /* Not fatal: the caller still gets a working (just un-interned) context. */
+        aws_mutex_unlock(&s_tls_ctx_cache_lock);
+        aws_string_destroy(fingerprint);
+        aws_tls_ctx_release(ctx);
+        return ctx;
+    }
+
+    aws_mutex_unlock(&s_tls_ctx_cache_lock);
+    return ctx;
+}
+
+void aws_tls_ctx_cache_clean_up(void) {
+    aws_mutex_lock(&s_tls_ctx_cache_lock);
+    if (s_tls_ctx_cache_initialized) {
+        aws_hash_table_clean_up(&s_tls_ctx_cache_table);
+        s_tls_ctx_cache_initialized = false;
+    }
+    aws_mutex_unlock(&s_tls_ctx_cache_lock);
+}
+
+#endif /* BYO_CRYPTO */
+
+/*
+ * Process-wide cache of peer chain verification verdicts, shared by the TLS backends.  It lives here rather than
+ * per-context so reconnect waves spanning many contexts still hit.  Entries are keyed by the exact bytes the
+ * backend considers decisive (the DER chain plus the server name) and expire after a fixed TTL, so revoked or
+ * rotated certificates are re-verified on a bounded delay.  Capacity is bounded by an LRU policy.
+ */
+enum { AWS_TLS_VERIFICATION_CACHE_CAPACITY = 512 };
+
+/* 5 minutes */
+static const uint64_t s_tls_verification_cache_ttl_ns = (uint64_t)300 * AWS_TIMESTAMP_NANOS;
+
+struct aws_tls_verification_verdict {
+    struct aws_allocator *allocator;
+    /* points into key_storage; doubles as the cache key so lookups need no temporary allocations */
+    struct aws_byte_cursor key;
+    struct aws_byte_buf key_storage;
+    int error_code;
+    uint64_t expiry_timestamp_ns;
+};
+
+static struct aws_mutex s_tls_verification_cache_lock = AWS_MUTEX_INIT;
+static struct aws_cache *s_tls_verification_cache;
+
+static void s_tls_verification_verdict_destroy(void *value) {
+    struct aws_tls_verification_verdict *verdict = value;
+    aws_byte_buf_clean_up(&verdict->key_storage);
+    aws_mem_release(verdict->allocator, verdict);
+}
+
+static bool s_tls_verification_key_eq(const void *a, const void *b) {
+    return aws_byte_cursor_eq(a, b);
+}
+
+bool aws_tls_verification_cache_check(struct aws_byte_cursor key, int *out_error_code) {
+    bool found = false;
+
+    aws_mutex_lock(&s_tls_verification_cache_lock);
+    if (s_tls_verification_cache == NULL) {
+        goto done;
+    }
+
+    void *element = NULL;
+    if (aws_cache_find(s_tls_verification_cache, &key, &element) || element == NULL) {
+        goto done;
+    }
+
+    struct aws_tls_verification_verdict *verdict = element;
+    uint64_t now = 0;
+    if (aws_high_res_clock_get_ticks(&now) || now >= verdict->expiry_timestamp_ns) {
+        aws_cache_remove(s_tls_verification_cache, &key);
+        goto done;
+    }
+
+    *out_error_code = verdict->error_code;
+    found = true;
+
+done:
+    aws_mutex_unlock(&s_tls_verification_cache_lock);
+    return found;
+}
+
+void aws_tls_verification_cache_put(struct aws_allocator *allocator, struct aws_byte_cursor key, int error_code) {
+    uint64_t now = 0;
+    if (aws_high_res_clock_get_ticks(&now)) {
+        return;
+    }
+
+    struct aws_tls_verification_verdict *verdict =
+        aws_mem_calloc(allocator, 1, sizeof(struct aws_tls_verification_verdict));
+    verdict->allocator = allocator;
+    verdict->error_code = error_code;
+    verdict->expiry_timestamp_ns = now + s_tls_verification_cache_ttl_ns;
+
+    if (aws_byte_buf_init_copy_from_cursor(&verdict->key_storage, allocator, key)) {
+        aws_mem_release(allocator, verdict);
+        return;
+    }
+    verdict->key = aws_byte_cursor_from_buf(&verdict->key_storage);
+
+    aws_mutex_lock(&s_tls_verification_cache_lock);
+    if (s_tls_verification_cache == NULL) {
+        s_tls_verification_cache = aws_cache_new_lru(
+            allocator,
+            aws_hash_byte_cursor_ptr,
+            s_tls_verification_key_eq,
+            NULL /* keys are owned by their verdicts */,
+            s_tls_verification_verdict_destroy,
+            AWS_TLS_VERIFICATION_CACHE_CAPACITY);
+
+        if (s_tls_verification_cache == NULL) {
+            goto done;
+        }
+    }
+
+    /* aws_cache_put does not replace in place */
+    aws_cache_remove(s_tls_verification_cache, &verdict->key);
+    if (aws_cache_put(s_tls_verification_cache, &verdict->key, verdict) == AWS_OP_SUCCESS) {
+        verdict = NULL;
+    }
+
+done:
+    aws_mutex_unlock(&s_tls_verification_cache_lock);
+    if (verdict != NULL) {
+        s_tls_verification_verdict_destroy(verdict);
+    }
+}
+
+void aws_tls_verification_cache_clean_up(void) {
+    aws_mutex_lock(&s_tls_verification_cache_lock);
+    if (s_tls_verification_cache != NULL) {
+        aws_cache_destroy(s_tls_verification_cache);
+        s_tls_verification_cache = NULL;
+    }
+    aws_mutex_unlock(&s_tls_verification_cache_lock);
+}
+
 const char *aws_tls_hash_algorithm_str(enum aws_tls_hash_algorithm hash) {
     /* clang-format off */
     switch (hash) {
@@ -6,8 +6,14 @@
 #include <aws/io/private/tls_channel_handler_shared.h>
 
 #include <aws/common/clock.h>
+#include <aws/common/lru_cache.h>
+#include <aws/common/mutex.h>
+#include <aws/common/string.h>
+#include <aws/io/private/tracing.h>
 #include <aws/io/tls_channel_handler.h>
 
+enum { AWS_TLS_SESSION_CACHE_DEFAULT_CAPACITY = 128 };
+
 static void s_tls_timeout_task_fn(struct aws_channel_task *channel_task, void *arg, enum aws_task_status status) {
     (void)channel_task;
 
@@ -31,6 +37,9 @@ void aws_tls_channel_handler_shared_init(
     tls_handler_shared->handler = handler;
     tls_handler_shared->tls_timeout_ms = options->timeout_ms;
     aws_crt_statistics_tls_init(&tls_handler_shared->stats);
+    /* The handler's slot isn't wired up yet, so the channel clock is unavailable here; the
+     * first-byte delay is measured against the high-res clock on both ends. */
+    aws_high_res_clock_get_ticks(&tls_handler_shared->handler_created_ns);
     aws_channel_task_init(&tls_handler_shared->timeout_task, s_tls_timeout_task_fn, tls_handler_shared, "tls_timeout");
 }
 
@@ -41,11 +50,25 @@ void aws_tls_channel_handler_shared_clean_up(struct aws_tls_channel_handler_shar
 void aws_on_drive_tls_negotiation(struct aws_tls_channel_handler_shared *tls_handler_shared) {
     if (tls_handler_shared->stats.handshake_status == AWS_TLS_NEGOTIATION_STATUS_NONE) {
         tls_handler_shared->stats.handshake_status = AWS_TLS_NEGOTIATION_STATUS_ONGOING;
+        AWS_IO_USDT_TLS_NEGOTIATION_STATE(
+            tls_handler_shared->handler->slot->channel,
+            tls_handler_shared->handler,
+            AWS_TLS_NEGOTIATION_STATUS_ONGOING,
+            0 /*error_code*/);
 
         uint64_t now = 0;
         aws_channel_current_clock_time(tls_handler_shared->handler->slot->channel, &now);
         tls_handler_shared->stats.handshake_start_ns = now;
 
+        /* For a server this is the accept-to-ClientHello gap; for a client it's the (tiny) delay
+         * before the scheduled negotiation task ran. */
+        uint64_t first_drive_ns = 0;
+        aws_high_res_clock_get_ticks(&first_drive_ns);
+        if (first_drive_ns > tls_handler_shared->handler_created_ns) {
+            tls_handler_shared->stats.handshake_first_byte_delay_ns =
+                first_drive_ns - tls_handler_shared->handler_created_ns;
+        }
+
         if (tls_handler_shared->tls_timeout_ms > 0) {
             uint64_t timeout_ns =
                 now + aws_timestamp_convert(
@@ -62,8 +85,153 @@ void aws_on_tls_negotiation_completed(struct aws_tls_channel_handler_shared *tls
         (error_code == AWS_ERROR_SUCCESS) ? AWS_TLS_NEGOTIATION_STATUS_SUCCESS : AWS_TLS_NEGOTIATION_STATUS_FAILURE;
     aws_channel_current_clock_time(
         tls_handler_shared->handler->slot->channel, &tls_handler_shared->stats.handshake_end_ns);
+    AWS_IO_USDT_TLS_NEGOTIATION_STATE(
+        tls_handler_shared->handler->slot->channel,
+        tls_handler_shared->handler,
+        tls_handler_shared->stats.handshake_status,
+        error_code);
 }
 
 bool aws_tls_options_buf_is_set(const struct aws_byte_buf *buf) {
     return buf->allocator != NULL;
 }
+
+struct aws_tls_session_cache {
+    struct aws_allocator *allocator;
+    struct aws_tls_session_cache_options options;
+    /* Protects lru_sessions; unused when the user supplied external-store callbacks. */
+    struct aws_mutex lock;
+    struct aws_cache *lru_sessions;
+};
+
+static void s_destroy_cached_session(void *value) {
+    struct aws_byte_buf *session = value;
+    struct aws_allocator *allocator = session->allocator;
+    aws_byte_buf_clean_up_secure(session);
+    aws_mem_release(allocator, session);
+}
+
+struct aws_tls_session_cache *aws_tls_session_cache_new(
+    struct aws_allocator *allocator,
+    const struct aws_tls_session_cache_options *options) {
+
+    struct aws_tls_session_cache *cache = aws_mem_calloc(allocator, 1, sizeof(struct aws_tls_session_cache));
+    if (cache == NULL) {
+        return NULL;
+    }
+
+    cache->allocator = allocator;
+    if (options != NULL) {
+        cache->options = *options;
+    }
+
+    if (aws_mutex_init(&cache->lock)) {
+        goto on_error;
+    }
+
+    if (cache->options.put_fn == NULL) {
+        size_t capacity =
+            cache->options.capacity > 0 ? cache->options.capacity : AWS_TLS_SESSION_CACHE_DEFAULT_CAPACITY;
+        cache->lru_sessions = aws_cache_new_lru(
+            allocator,
+            aws_hash_string,
+            aws_hash_callback_string_eq,
+            aws_hash_callback_string_destroy,
+            s_destroy_cached_session,
+            capacity);
+        if (cache->lru_sessions == NULL) {
+            goto on_error;
+        }
+    }
+
+    return cache;
+
+on_error:
+    aws_tls_session_cache_destroy(cache);
+    return NULL;
+}
+
+void aws_tls_session_cache_destroy(struct aws_tls_session_cache *cache) {
+    if (cache == NULL) {
+        return;
+    }
+
+    if (cache->lru_sessions != NULL) {
+        aws_cache_destroy(cache->lru_sessions);
+    }
+    aws_mutex_clean_up(&cache->lock);
+    aws_mem_release(cache->allocator, cache);
+}
+
+int aws_tls_session_cache_put(
+    struct aws_tls_session_cache *cache,
+    struct aws_byte_cursor key,
+    struct aws_byte_cursor session) {
+
+    if (cache->options.put_fn != NULL) {
+        return cache->options.put_fn(key, session, cache->options.user_data);
+    }
+
+    struct aws_string *key_copy = aws_string_new_from_cursor(cache->allocator, &key);
+    if (key_copy == NULL) {
+        return AWS_OP_ERR;
+    }
+
+    struct aws_byte_buf *session_copy = aws_mem_calloc(cache->allocator, 1, sizeof(struct aws_byte_buf));
+    if (session_copy == NULL) {
+        goto on_error;
+    }
+
+    if (aws_byte_buf_init_copy_from_cursor(session_copy, cache->allocator, session)) {
+        aws_mem_release(cache->allocator, session_copy);
+        goto on_error;
+    }
+
+    aws_mutex_lock(&cache->lock);
+    /* Remove any stale entry first; aws_cache_put does not replace in place. */
+    aws_cache_remove(cache->lru_sessions, key_copy);
+    int result = aws_cache_put(cache->lru_sessions, key_copy, session_copy);
+    aws_mutex_unlock(&cache->lock);
+
+    if (result) {
+        s_destroy_cached_session(session_copy);
+        goto on_error;
+    }
+
+    return AWS_OP_SUCCESS;
+
+on_error:
+    aws_string_destroy(key_copy);
+    return AWS_OP_ERR;
+}
+
+int aws_tls_session_cache_get(
+    struct aws_tls_session_cache *cache,
+    struct aws_byte_cursor key,
+    struct aws_byte_buf *out_session) {
+
+    if (cache->options.get_fn != NULL) {
+        return cache->options.get_fn(key, out_session, cache->options.user_data);
+    }
+
+    struct aws_string *key_copy = aws_string_new_from_cursor(cache->allocator, &key);
+    if (key_copy == NULL) {
+        return AWS_OP_ERR;
+    }
+
+    int result = AWS_OP_SUCCESS;
+
+    aws_mutex_lock(&cache->lock);
+    void *element = NULL;
+    if (aws_cache_find(cache->lru_sessions, key_copy, &element) || element == NULL) {
+        result = aws_raise_error(AWS_ERROR_HASHTBL_ITEM_NOT_FOUND);
+    } else {
+        struct aws_byte_buf *session = element;
+        struct aws_byte_cursor session_cursor = aws_byte_cursor_from_buf(session);
+        result = aws_byte_buf_append_dynamic(out_session, &session_cursor);
+    }
+    aws_mutex_unlock(&cache->lock);
+
+    aws_string_destroy(key_copy);
+    return result;
+}
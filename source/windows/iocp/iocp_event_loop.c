@@ -11,6 +11,7 @@
 #include <aws/common/thread.h>
 
 #include <aws/io/logging.h>
+#include <aws/io/private/pipe.h>
 
 #include <Windows.h>
 
@@ -73,6 +74,7 @@ struct iocp_loop {
         struct aws_mutex mutex;
         bool thread_signaled; /* whether thread has been signaled about changes to synced_data */
         struct aws_linked_list tasks_to_schedule;
+        struct aws_linked_list background_tasks_to_schedule;
         event_thread_state state;
     } synced_data;
 
@@ -80,6 +82,10 @@ struct iocp_loop {
     struct {
         struct aws_task_scheduler scheduler;
 
+        /* FIFO low band: at most BACKGROUND_TASK_BUDGET_PER_TICK of these run per loop, after
+         * completion packets and the normal scheduler pass */
+        struct aws_linked_list background_tasks;
+
         /* These variables duplicate ones in synced_data.
          * We move values out while holding the mutex and operate on them later */
         event_thread_state state;
@@ -93,6 +99,10 @@ enum {
 
     /* Max I/O completion packets to process per loop of the event-thread */
     MAX_COMPLETION_PACKETS_PER_LOOP = 100,
+
+    /* background tasks run per loop of the event-thread; a non-empty backlog keeps the next
+     * completion wait at zero timeout, so spare capacity drains it without starving the data path */
+    BACKGROUND_TASK_BUDGET_PER_TICK = 16,
 };
 
 static void s_destroy(struct aws_event_loop *event_loop);
@@ -100,6 +110,7 @@ static int s_run(struct aws_event_loop *event_loop);
 static int s_stop(struct aws_event_loop *event_loop);
 static int s_wait_for_stop_completion(struct aws_event_loop *event_loop);
 static void s_schedule_task_now(struct aws_event_loop *event_loop, struct aws_task *task);
+static void s_schedule_task_now_background(struct aws_event_loop *event_loop, struct aws_task *task);
 static void s_schedule_task_future(struct aws_event_loop *event_loop, struct aws_task *task, uint64_t run_at_nanos);
 static void s_cancel_task(struct aws_event_loop *event_loop, struct aws_task *task);
 static int s_connect_to_io_completion_port(struct aws_event_loop *event_loop, struct aws_io_handle *handle);
@@ -135,6 +146,7 @@ struct aws_event_loop_vtable s_iocp_vtable = {
     .stop = s_stop,
     .wait_for_stop_completion = s_wait_for_stop_completion,
     .schedule_task_now = s_schedule_task_now,
+    .schedule_task_now_background = s_schedule_task_now_background,
     .schedule_task_future = s_schedule_task_future,
     .cancel_task = s_cancel_task,
     .connect_to_io_completion_port = s_connect_to_io_completion_port,
@@ -232,6 +244,8 @@ struct aws_event_loop *aws_event_loop_new_default_with_options(
     clean_up_mutex = true;
 
     aws_linked_list_init(&impl->synced_data.tasks_to_schedule);
+    aws_linked_list_init(&impl->synced_data.background_tasks_to_schedule);
+    aws_linked_list_init(&impl->thread_data.background_tasks);
 
     err = aws_task_scheduler_init(&impl->thread_data.scheduler, alloc);
     if (err) {
@@ -307,13 +321,27 @@ static void s_destroy(struct aws_event_loop *event_loop) {
 
     aws_task_scheduler_clean_up(&impl->thread_data.scheduler); /* cancels remaining tasks in scheduler */
 
+    while (!aws_linked_list_empty(&impl->thread_data.background_tasks)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&impl->thread_data.background_tasks);
+        struct aws_task *task = AWS_CONTAINER_OF(node, struct aws_task, node);
+        task->fn(task, task->arg, AWS_TASK_STATUS_CANCELED);
+    }
+
     while (!aws_linked_list_empty(&impl->synced_data.tasks_to_schedule)) {
         struct aws_linked_list_node *node = aws_linked_list_pop_front(&impl->synced_data.tasks_to_schedule);
         struct aws_task *task = AWS_CONTAINER_OF(node, struct aws_task, node);
         task->fn(task, task->arg, AWS_TASK_STATUS_CANCELED);
     }
 
+    while (!aws_linked_list_empty(&impl->synced_data.background_tasks_to_schedule)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&impl->synced_data.background_tasks_to_schedule);
+        struct aws_task *task = AWS_CONTAINER_OF(node, struct aws_task, node);
+        task->fn(task, task->arg, AWS_TASK_STATUS_CANCELED);
+    }
+
     /* Clean up everything else */
+    aws_pipe_pool_purge_event_loop(event_loop);
+
     bool close_iocp_success = CloseHandle(impl->iocp_handle);
     AWS_ASSERT(close_iocp_success);
     (void)close_iocp_success;
@@ -484,9 +512,47 @@ static void s_schedule_task_future(struct aws_event_loop *event_loop, struct aws
     s_schedule_task_common(event_loop, task, run_at_nanos);
 }
 
+/* Called from any thread */
+static void s_schedule_task_now_background(struct aws_event_loop *event_loop, struct aws_task *task) {
+    struct iocp_loop *impl = event_loop->impl_data;
+    AWS_ASSERT(impl);
+    AWS_ASSERT(task);
+
+    if (s_is_event_thread(event_loop)) {
+        AWS_LOGF_TRACE(
+            AWS_LS_IO_EVENT_LOOP, "id=%p: scheduling background task %p in-thread", (void *)event_loop, (void *)task);
+        aws_linked_list_push_back(&impl->thread_data.background_tasks, &task->node);
+        return;
+    }
+
+    AWS_LOGF_TRACE(
+        AWS_LS_IO_EVENT_LOOP, "id=%p: Scheduling background task %p cross-thread", (void *)event_loop, (void *)task);
+    task->timestamp = 0;
+    bool should_signal_thread = false;
+
+    { /* Begin critical section */
+        aws_mutex_lock(&impl->synced_data.mutex);
+        aws_linked_list_push_back(&impl->synced_data.background_tasks_to_schedule, &task->node);
+
+        if (!impl->synced_data.thread_signaled) {
+            AWS_LOGF_TRACE(AWS_LS_IO_EVENT_LOOP, "id=%p: Waking up event-loop thread", (void *)event_loop);
+            should_signal_thread = true;
+            impl->synced_data.thread_signaled = true;
+        }
+
+        aws_mutex_unlock(&impl->synced_data.mutex);
+    } /* End critical section */
+
+    if (should_signal_thread) {
+        s_signal_synced_data_changed(event_loop);
+    }
+}
+
 static void s_cancel_task(struct aws_event_loop *event_loop, struct aws_task *task) {
     AWS_LOGF_TRACE(AWS_LS_IO_EVENT_LOOP, "id=%p: cancelling task %p", (void *)event_loop, (void *)task);
     struct iocp_loop *iocp_loop = event_loop->impl_data;
+    /* background tasks are covered too: they carry timestamp 0 and are linked through the same
+     * aws_task node, so the scheduler's cancel path unlinks them from the band's list */
     aws_task_scheduler_cancel_task(&iocp_loop->thread_data.scheduler, task);
 }
 
@@ -584,6 +650,8 @@ static void s_process_synced_data(struct aws_event_loop *event_loop) {
      * We'll process them later, so that we minimize time spent holding the mutex. */
     struct aws_linked_list tasks_to_schedule;
     aws_linked_list_init(&tasks_to_schedule);
+    struct aws_linked_list background_tasks_to_schedule;
+    aws_linked_list_init(&background_tasks_to_schedule);
 
     { /* Begin critical section */
         aws_mutex_lock(&impl->synced_data.mutex);
@@ -596,12 +664,18 @@ static void s_process_synced_data(struct aws_event_loop *event_loop) {
         }
 
         aws_linked_list_swap_contents(&impl->synced_data.tasks_to_schedule, &tasks_to_schedule);
+        aws_linked_list_swap_contents(&impl->synced_data.background_tasks_to_schedule, &background_tasks_to_schedule);
 
         aws_mutex_unlock(&impl->synced_data.mutex);
     } /* End critical section */
 
     AWS_LOGF_TRACE(AWS_LS_IO_EVENT_LOOP, "id=%p: notified of cross-thread tasks to schedule", (void *)event_loop);
     s_process_tasks_to_schedule(event_loop, &tasks_to_schedule);
+
+    while (!aws_linked_list_empty(&background_tasks_to_schedule)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&background_tasks_to_schedule);
+        aws_linked_list_push_back(&impl->thread_data.background_tasks, node);
+    }
 }
 
 static int s_unsubscribe_from_io_events(struct aws_event_loop *event_loop, struct aws_io_handle *handle) {
@@ -698,6 +772,7 @@ static void aws_event_loop_thread(void *user_data) {
             timeout_ms);        /* Timeout in ms. If timeout reached then FALSE is returned. */
 
         aws_event_loop_register_tick_start(event_loop);
+        aws_event_loop_register_wait_result(event_loop, has_completion_entries ? (size_t)num_entries : 0);
 
         if (has_completion_entries) {
             AWS_LOGF_TRACE(
@@ -746,6 +821,17 @@ static void aws_event_loop_thread(void *user_data) {
         AWS_LOGF_TRACE(AWS_LS_IO_EVENT_LOOP, "id=%p: running scheduled tasks.", (void *)event_loop);
         aws_task_scheduler_run_all(&impl->thread_data.scheduler, now_ns);
 
+        /* low band: at most a budget's worth of background work per loop, after completion
+         * packets and the normal scheduler pass, bounding the latency housekeeping can inject
+         * into the data path */
+        for (int i = 0;
+             i < BACKGROUND_TASK_BUDGET_PER_TICK && !aws_linked_list_empty(&impl->thread_data.background_tasks);
+             ++i) {
+            struct aws_linked_list_node *bg_node = aws_linked_list_pop_front(&impl->thread_data.background_tasks);
+            struct aws_task *bg_task = AWS_CONTAINER_OF(bg_node, struct aws_task, node);
+            bg_task->fn(bg_task, bg_task->arg, AWS_TASK_STATUS_RUN_READY);
+        }
+
         /* Set timeout for next GetQueuedCompletionStatus() call.
          * If clock fails, or scheduler has no tasks, use default timeout */
         bool use_default_timeout = false;
@@ -778,6 +864,12 @@ static void aws_event_loop_thread(void *user_data) {
                 (int)timeout_ms);
         }
 
+        /* leftover background work: poll rather than block, so spare capacity keeps draining
+         * the low band while I/O stays ahead of it */
+        if (!aws_linked_list_empty(&impl->thread_data.background_tasks)) {
+            timeout_ms = 0;
+        }
+
         aws_event_loop_register_tick_end(event_loop);
     }
     AWS_LOGF_DEBUG(AWS_LS_IO_EVENT_LOOP, "id=%p: exiting main loop", (void *)event_loop);
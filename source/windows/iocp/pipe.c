@@ -5,8 +5,10 @@
 
 #include <aws/io/pipe.h>
 
+#include <aws/common/mutex.h>
 #include <aws/common/task_scheduler.h>
 #include <aws/io/event_loop.h>
+#include <aws/io/private/pipe.h>
 
 #include <stdbool.h>
 #include <stdio.h>
@@ -64,6 +66,9 @@ struct read_end_impl {
 
     struct aws_event_loop *event_loop;
 
+    /* Shared with the write end; coordinates returning the handle pair to the pool at clean-up. */
+    struct pipe_pair_tracker *tracker;
+
     /* Async overlapped operation for monitoring pipe status.
      * This operation is re-used each time monitoring resumes.
      * Note that rapidly subscribing/unsubscribing could lead to the monitoring operation from a previous subscribe
@@ -106,16 +111,22 @@ struct write_end_impl {
     struct aws_io_handle handle;
     struct aws_event_loop *event_loop;
 
+    /* Shared with the read end; coordinates returning the handle pair to the pool at clean-up. */
+    struct pipe_pair_tracker *tracker;
+
     /* List of currently active pipe_write_requests */
     struct aws_linked_list write_list;
 
-    /* Future optimization idea: avoid an allocation on each write by keeping 1 pre-allocated pipe_write_request around
-     * and re-using it whenever possible */
+    /* Completed pipe_write_requests cached for reuse, so steady-state writes don't allocate */
+    struct aws_linked_list free_write_requests;
+    size_t free_write_request_count;
 };
 
 enum {
     PIPE_BUFFER_SIZE = 4096,
     PIPE_UNIQUE_NAME_MAX_TRIES = 10,
+    PIPE_POOL_MAX_ENTRIES = 32,
+    PIPE_MAX_FREE_WRITE_REQUESTS = 8,
 };
 
 static void s_read_end_on_zero_byte_read_completion(
@@ -150,6 +161,159 @@ static int s_raise_last_windows_error(void) {
     return aws_raise_error(aws_error);
 }
 
+/*
+ * Pool of idle pipe handle pairs.  An IOCP association is permanent, so a pooled pair can only be handed back
+ * to an aws_pipe_init() targeting the exact event-loop pair it was created for; the loop pair is therefore the
+ * pool key (every instance uses the same PIPE_BUFFER_SIZE, so buffer size doesn't differentiate entries).
+ * Pairs whose loop is being destroyed are purged via aws_pipe_pool_purge_event_loop().
+ */
+struct pipe_pool_entry {
+    HANDLE write_handle;
+    HANDLE read_handle;
+    struct aws_event_loop *write_loop;
+    struct aws_event_loop *read_loop;
+};
+
+static struct {
+    struct aws_mutex lock;
+    struct pipe_pool_entry entries[PIPE_POOL_MAX_ENTRIES];
+    size_t entry_count;
+} s_pipe_pool = {
+    .lock = AWS_MUTEX_INIT,
+};
+
+static bool s_pipe_pool_acquire(
+    struct aws_event_loop *write_loop,
+    struct aws_event_loop *read_loop,
+    HANDLE *out_write_handle,
+    HANDLE *out_read_handle) {
+
+    bool found = false;
+
+    aws_mutex_lock(&s_pipe_pool.lock);
+    for (size_t i = 0; i < s_pipe_pool.entry_count; ++i) {
+        struct pipe_pool_entry *entry = &s_pipe_pool.entries[i];
+        if (entry->write_loop == write_loop && entry->read_loop == read_loop) {
+            *out_write_handle = entry->write_handle;
+            *out_read_handle = entry->read_handle;
+            s_pipe_pool.entries[i] = s_pipe_pool.entries[--s_pipe_pool.entry_count];
+            found = true;
+            break;
+        }
+    }
+    aws_mutex_unlock(&s_pipe_pool.lock);
+
+    return found;
+}
+
+static bool s_pipe_pool_release(
+    HANDLE write_handle,
+    HANDLE read_handle,
+    struct aws_event_loop *write_loop,
+    struct aws_event_loop *read_loop) {
+
+    bool pooled = false;
+
+    aws_mutex_lock(&s_pipe_pool.lock);
+    if (s_pipe_pool.entry_count < PIPE_POOL_MAX_ENTRIES) {
+        s_pipe_pool.entries[s_pipe_pool.entry_count++] = (struct pipe_pool_entry){
+            .write_handle = write_handle,
+            .read_handle = read_handle,
+            .write_loop = write_loop,
+            .read_loop = read_loop,
+        };
+        pooled = true;
+    }
+    aws_mutex_unlock(&s_pipe_pool.lock);
+
+    return pooled;
+}
+
+void aws_pipe_pool_purge_event_loop(struct aws_event_loop *event_loop) {
+    aws_mutex_lock(&s_pipe_pool.lock);
+    size_t i = 0;
+    while (i < s_pipe_pool.entry_count) {
+        struct pipe_pool_entry *entry = &s_pipe_pool.entries[i];
+        if (entry->write_loop == event_loop || entry->read_loop == event_loop) {
+            CloseHandle(entry->write_handle);
+            CloseHandle(entry->read_handle);
+            s_pipe_pool.entries[i] = s_pipe_pool.entries[--s_pipe_pool.entry_count];
+        } else {
+            ++i;
+        }
+    }
+    aws_mutex_unlock(&s_pipe_pool.lock);
+}
+
+/*
+ * Shared by the two ends of one pipe; decides, as each end cleans up, whether the still-open handle pair can
+ * go back to the pool.  An end that cleans up with operations in flight or unread data closes its handle and
+ * poisons the pair; otherwise the handle stays open, and the last end out pools the pair (or closes both
+ * handles when the pool is full).
+ */
+struct pipe_pair_tracker {
+    struct aws_allocator *alloc;
+    struct aws_mutex lock;
+    int ends_remaining;
+    bool poolable;
+    HANDLE write_handle;
+    HANDLE read_handle;
+    struct aws_event_loop *write_loop;
+    struct aws_event_loop *read_loop;
+};
+
+static void s_pipe_tracker_on_end_clean_up(struct pipe_pair_tracker *tracker, bool is_write_end, bool end_poolable) {
+    aws_mutex_lock(&tracker->lock);
+
+    if (!end_poolable) {
+        tracker->poolable = false;
+        if (is_write_end) {
+            CloseHandle(tracker->write_handle);
+            tracker->write_handle = INVALID_HANDLE_VALUE;
+        } else {
+            CloseHandle(tracker->read_handle);
+            tracker->read_handle = INVALID_HANDLE_VALUE;
+        }
+    }
+
+    bool last_end = --tracker->ends_remaining == 0;
+    aws_mutex_unlock(&tracker->lock);
+
+    if (!last_end) {
+        return;
+    }
+
+    /* no further synchronization needed; we hold the last reference to the tracker */
+    bool pool_pair = tracker->poolable;
+    if (pool_pair) {
+        /* a write racing the read end's clean-up may have left bytes in the pipe; only an empty pair pools */
+        DWORD bytes_available = 0;
+        pool_pair =
+            PeekNamedPipe(tracker->read_handle, NULL, 0, NULL, &bytes_available, NULL) && bytes_available == 0;
+    }
+
+    if (pool_pair) {
+        if (!s_pipe_pool_release(tracker->write_handle, tracker->read_handle, tracker->write_loop, tracker->read_loop)) {
+            CloseHandle(tracker->write_handle);
+            CloseHandle(tracker->read_handle);
+        }
+    } else if (tracker->poolable) {
+        /* both handles were left open for pooling, but the pipe wasn't empty after all */
+        CloseHandle(tracker->write_handle);
+        CloseHandle(tracker->read_handle);
+    } else {
+        if (tracker->write_handle != INVALID_HANDLE_VALUE) {
+            CloseHandle(tracker->write_handle);
+        }
+        if (tracker->read_handle != INVALID_HANDLE_VALUE) {
+            CloseHandle(tracker->read_handle);
+        }
+    }
+
+    aws_mutex_clean_up(&tracker->lock);
+    aws_mem_release(tracker->alloc, tracker);
+}
+
 AWS_THREAD_LOCAL uint32_t tl_unique_name_counter = 0;
 
 AWS_IO_API int aws_pipe_get_unique_name(char *dst, size_t dst_size) {
@@ -205,6 +369,10 @@ int aws_pipe_init(
     struct write_end_impl *write_impl = NULL;
     struct read_end_impl *read_impl = NULL;
 
+    /* The read-end handle lives here until it's handed to read_impl, so every failure path can close it. */
+    HANDLE pooled_write_handle = INVALID_HANDLE_VALUE;
+    HANDLE pooled_read_handle = INVALID_HANDLE_VALUE;
+
     /* Init write-end */
     write_impl = aws_mem_calloc(allocator, 1, sizeof(struct write_end_impl));
     if (!write_impl) {
@@ -215,47 +383,69 @@ int aws_pipe_init(
     write_impl->state = WRITE_END_STATE_OPEN;
     write_impl->handle.data.handle = INVALID_HANDLE_VALUE;
     aws_linked_list_init(&write_impl->write_list);
+    aws_linked_list_init(&write_impl->free_write_requests);
 
-    /* Anonymous pipes don't support overlapped I/O so named pipes are used. Names must be unique system-wide.
-     * We generate random names, but collisions are theoretically possible, so try several times before giving up. */
-    char pipe_name[256];
-    int tries = 0;
-    while (true) {
-        int err = aws_pipe_get_unique_name(pipe_name, sizeof(pipe_name));
-        if (err) {
-            goto clean_up;
-        }
-
-        const DWORD open_mode = PIPE_ACCESS_OUTBOUND | FILE_FLAG_OVERLAPPED | FILE_FLAG_FIRST_PIPE_INSTANCE;
-
-        const DWORD pipe_mode = PIPE_TYPE_BYTE | PIPE_WAIT | PIPE_REJECT_REMOTE_CLIENTS;
+    /* Reuse an idle pair already created for (and IOCP-associated with) this exact loop pair, if one is
+     * available; this skips both CreateNamedPipe/CreateFile and the completion-port association below. */
+    bool from_pool =
+        s_pipe_pool_acquire(write_end_event_loop, read_end_event_loop, &pooled_write_handle, &pooled_read_handle);
 
-        write_impl->handle.data.handle = CreateNamedPipeA(
-            pipe_name,
-            open_mode,
-            pipe_mode,
-            1,                /*nMaxInstances*/
-            PIPE_BUFFER_SIZE, /*nOutBufferSize*/
-            PIPE_BUFFER_SIZE, /*nInBufferSize*/
-            0,                /*nDefaultTimeout: 0 means default*/
-            NULL);            /*lpSecurityAttributes: NULL means default */
-
-        if (write_impl->handle.data.handle != INVALID_HANDLE_VALUE) {
-            /* Success, break out of loop */
-            break;
+    if (from_pool) {
+        write_impl->handle.data.handle = pooled_write_handle;
+    } else {
+        /* Anonymous pipes don't support overlapped I/O so named pipes are used. Names must be unique system-wide.
+         * We generate random names, but collisions are theoretically possible, so try several times before giving up.
+         */
+        char pipe_name[256];
+        int tries = 0;
+        while (true) {
+            int name_err = aws_pipe_get_unique_name(pipe_name, sizeof(pipe_name));
+            if (name_err) {
+                goto clean_up;
+            }
+
+            const DWORD open_mode = PIPE_ACCESS_OUTBOUND | FILE_FLAG_OVERLAPPED | FILE_FLAG_FIRST_PIPE_INSTANCE;
+
+            const DWORD pipe_mode = PIPE_TYPE_BYTE | PIPE_WAIT | PIPE_REJECT_REMOTE_CLIENTS;
+
+            write_impl->handle.data.handle = CreateNamedPipeA(
+                pipe_name,
+                open_mode,
+                pipe_mode,
+                1,                /*nMaxInstances*/
+                PIPE_BUFFER_SIZE, /*nOutBufferSize*/
+                PIPE_BUFFER_SIZE, /*nInBufferSize*/
+                0,                /*nDefaultTimeout: 0 means default*/
+                NULL);            /*lpSecurityAttributes: NULL means default */
+
+            if (write_impl->handle.data.handle != INVALID_HANDLE_VALUE) {
+                /* Success, break out of loop */
+                break;
+            }
+
+            if (++tries >= PIPE_UNIQUE_NAME_MAX_TRIES) {
+                s_raise_last_windows_error();
+                goto clean_up;
+            }
         }
 
-        if (++tries >= PIPE_UNIQUE_NAME_MAX_TRIES) {
+        /* Open the read end before connecting either handle to a completion port, so the failure paths below
+         * don't have to distinguish pooled handles from fresh ones. */
+        pooled_read_handle = CreateFileA(
+            pipe_name,     /*lpFileName*/
+            GENERIC_READ,  /*dwDesiredAccess*/
+            0,             /*dwShareMode: 0 prevents acess by external processes*/
+            NULL,          /*lpSecurityAttributes: NULL prevents inheritance by child processes*/
+            OPEN_EXISTING, /*dwCreationDisposition*/
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED, /*dwFlagsAndAttributes*/
+            NULL);                                        /*hTemplateFile: ignored when opening existing file*/
+
+        if (pooled_read_handle == INVALID_HANDLE_VALUE) {
             s_raise_last_windows_error();
             goto clean_up;
         }
     }
 
-    int err = aws_event_loop_connect_handle_to_io_completion_port(write_end_event_loop, &write_impl->handle);
-    if (err) {
-        goto clean_up;
-    }
-
     write_impl->event_loop = write_end_event_loop;
 
     /* Init read-end */
@@ -266,25 +456,19 @@ int aws_pipe_init(
 
     read_impl->alloc = allocator;
     read_impl->state = READ_END_STATE_OPEN;
-    read_impl->handle.data.handle = INVALID_HANDLE_VALUE;
-
-    read_impl->handle.data.handle = CreateFileA(
-        pipe_name,     /*lpFileName*/
-        GENERIC_READ,  /*dwDesiredAccess*/
-        0,             /*dwShareMode: 0 prevents acess by external processes*/
-        NULL,          /*lpSecurityAttributes: NULL prevents inheritance by child processes*/
-        OPEN_EXISTING, /*dwCreationDisposition*/
-        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED, /*dwFlagsAndAttributes*/
-        NULL);                                        /*hTemplateFile: ignored when opening existing file*/
-
-    if (read_impl->handle.data.handle == INVALID_HANDLE_VALUE) {
-        s_raise_last_windows_error();
-        goto clean_up;
-    }
+    read_impl->handle.data.handle = pooled_read_handle;
+    pooled_read_handle = INVALID_HANDLE_VALUE;
 
-    err = aws_event_loop_connect_handle_to_io_completion_port(read_end_event_loop, &read_impl->handle);
-    if (err) {
-        goto clean_up;
+    if (!from_pool) {
+        int err = aws_event_loop_connect_handle_to_io_completion_port(write_end_event_loop, &write_impl->handle);
+        if (err) {
+            goto clean_up;
+        }
+
+        err = aws_event_loop_connect_handle_to_io_completion_port(read_end_event_loop, &read_impl->handle);
+        if (err) {
+            goto clean_up;
+        }
     }
 
     read_impl->event_loop = read_end_event_loop;
@@ -307,12 +491,34 @@ int aws_pipe_init(
     aws_task_init(
         &read_impl->async_error_report->op.task, s_read_end_report_error_task, read_end, "pipe_read_end_report_error");
 
+    /* The tracker outlives whichever end cleans up first and decides whether the pair goes back to the pool. */
+    struct pipe_pair_tracker *tracker = aws_mem_calloc(allocator, 1, sizeof(struct pipe_pair_tracker));
+    if (!tracker) {
+        goto clean_up;
+    }
+
+    tracker->alloc = allocator;
+    aws_mutex_init(&tracker->lock);
+    tracker->ends_remaining = 2;
+    tracker->poolable = true;
+    tracker->write_handle = write_impl->handle.data.handle;
+    tracker->read_handle = read_impl->handle.data.handle;
+    tracker->write_loop = write_end_event_loop;
+    tracker->read_loop = read_end_event_loop;
+    write_impl->tracker = tracker;
+    read_impl->tracker = tracker;
+
     /* Success */
     write_end->impl_data = write_impl;
     read_end->impl_data = read_impl;
     return AWS_OP_SUCCESS;
 
 clean_up:
+    if (pooled_read_handle != INVALID_HANDLE_VALUE) {
+        /* the read-end handle was acquired (or opened) but never handed to read_impl */
+        CloseHandle(pooled_read_handle);
+    }
+
     if (write_impl) {
         if (write_impl->handle.data.handle != INVALID_HANDLE_VALUE) {
             CloseHandle(write_impl->handle.data.handle);
@@ -373,7 +579,10 @@ int aws_pipe_clean_up_read_end(struct aws_pipe_read_end *read_end) {
         return aws_raise_error(AWS_ERROR_IO_EVENT_LOOP_THREAD_ONLY);
     }
 
-    CloseHandle(read_impl->handle.data.handle);
+    /* The handle can only be pooled for reuse if nothing is in flight on it; the tracker additionally checks
+     * for unread data before actually pooling the pair.  A non-poolable handle is closed, like before. */
+    bool end_poolable = !read_impl->async_monitoring->is_active && !read_impl->async_error_report->is_active;
+    s_pipe_tracker_on_end_clean_up(read_impl->tracker, false /*is_write_end*/, end_poolable);
 
     /* If the async operations are inactive they can be deleted now.
      * Otherwise, inform the operations of the clean-up so they can delete themselves upon completion. */
@@ -704,7 +913,9 @@ int aws_pipe_clean_up_write_end(struct aws_pipe_write_end *write_end) {
         return aws_raise_error(AWS_ERROR_IO_EVENT_LOOP_THREAD_ONLY);
     }
 
-    CloseHandle(write_impl->handle.data.handle);
+    /* An end with writes still in flight can't be pooled; the tracker closes its handle instead. */
+    bool end_poolable = aws_linked_list_empty(&write_impl->write_list);
+    s_pipe_tracker_on_end_clean_up(write_impl->tracker, true /*is_write_end*/, end_poolable);
 
     /* Inform outstanding writes about the clean up. */
     while (!aws_linked_list_empty(&write_impl->write_list)) {
@@ -713,12 +924,28 @@ int aws_pipe_clean_up_write_end(struct aws_pipe_write_end *write_end) {
         write_req->is_write_end_cleaned_up = true;
     }
 
+    while (!aws_linked_list_empty(&write_impl->free_write_requests)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&write_impl->free_write_requests);
+        struct pipe_write_request *write_req = AWS_CONTAINER_OF(node, struct pipe_write_request, list_node);
+        aws_mem_release(write_req->alloc, write_req);
+    }
+
     aws_mem_release(write_impl->alloc, write_impl);
     AWS_ZERO_STRUCT(*write_end);
 
     return AWS_OP_SUCCESS;
 }
 
+/* Cache a finished request for reuse by the next write, or free it if the cache is full. */
+static void s_write_request_recycle(struct write_end_impl *write_impl, struct pipe_write_request *write_request) {
+    if (write_impl->free_write_request_count < PIPE_MAX_FREE_WRITE_REQUESTS) {
+        aws_linked_list_push_back(&write_impl->free_write_requests, &write_request->list_node);
+        write_impl->free_write_request_count++;
+    } else {
+        aws_mem_release(write_request->alloc, write_request);
+    }
+}
+
 int aws_pipe_write(
     struct aws_pipe_write_end *write_end,
     struct aws_byte_cursor src_buffer,
@@ -739,9 +966,16 @@ int aws_pipe_write(
     }
     DWORD num_bytes_to_write = (DWORD)src_buffer.len;
 
-    struct pipe_write_request *write = aws_mem_acquire(write_impl->alloc, sizeof(struct pipe_write_request));
-    if (!write) {
-        return AWS_OP_ERR;
+    struct pipe_write_request *write = NULL;
+    if (!aws_linked_list_empty(&write_impl->free_write_requests)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&write_impl->free_write_requests);
+        write_impl->free_write_request_count--;
+        write = AWS_CONTAINER_OF(node, struct pipe_write_request, list_node);
+    } else {
+        write = aws_mem_acquire(write_impl->alloc, sizeof(struct pipe_write_request));
+        if (!write) {
+            return AWS_OP_ERR;
+        }
     }
 
     AWS_ZERO_STRUCT(*write);
@@ -761,7 +995,7 @@ int aws_pipe_write(
     /* Overlapped WriteFile() calls may succeed immediately, or they may queue the work. In either of these cases, IOCP
      * on the event-loop will alert us when the operation completes and we'll invoke user callbacks then. */
     if (!write_success && GetLastError() != ERROR_IO_PENDING) {
-        aws_mem_release(write_impl->alloc, write);
+        s_write_request_recycle(write_impl, write);
         return s_raise_last_windows_error();
     }
 
@@ -769,6 +1003,60 @@ int aws_pipe_write(
     return AWS_OP_SUCCESS;
 }
 
+int aws_pipe_write_multiple(
+    struct aws_pipe_write_end *write_end,
+    const struct aws_byte_cursor *buffers,
+    size_t buffer_count,
+    aws_pipe_on_write_multiple_completed_fn *on_completed,
+    void *user_data) {
+
+    (void)write_end;
+    (void)buffers;
+    (void)buffer_count;
+    (void)on_completed;
+    (void)user_data;
+    return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+}
+
+int aws_pipe_splice_from_fd(
+    struct aws_pipe_write_end *write_end,
+    int source_fd,
+    size_t max_bytes,
+    size_t *out_bytes_spliced) {
+
+    (void)write_end;
+    (void)source_fd;
+    (void)max_bytes;
+    *out_bytes_spliced = 0;
+    return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+}
+
+int aws_pipe_splice_to_fd(
+    struct aws_pipe_read_end *read_end,
+    int destination_fd,
+    size_t max_bytes,
+    size_t *out_bytes_spliced) {
+
+    (void)read_end;
+    (void)destination_fd;
+    (void)max_bytes;
+    *out_bytes_spliced = 0;
+    return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+}
+
+int aws_pipe_tee(
+    struct aws_pipe_read_end *from,
+    struct aws_pipe_write_end *to,
+    size_t max_bytes,
+    size_t *out_bytes_teed) {
+
+    (void)from;
+    (void)to;
+    (void)max_bytes;
+    *out_bytes_teed = 0;
+    return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+}
+
 void s_write_end_on_write_completion(
     struct aws_event_loop *event_loop,
     struct aws_overlapped *overlapped,
@@ -788,13 +1076,16 @@ void s_write_end_on_write_completion(
     void *user_data = write_request->user_data;
 
     /* Clean up write-request.
-     * Note that write-end might have been cleaned up before this executes. */
+     * Note that write-end might have been cleaned up before this executes.
+     * Recycling happens before the user callback so that a clean-up from inside the callback frees the
+     * cached request along with the rest of the write end. */
     if (!write_request->is_write_end_cleaned_up) {
         aws_linked_list_remove(&write_request->list_node);
+        s_write_request_recycle(write_end->impl_data, write_request);
+    } else {
+        aws_mem_release(write_request->alloc, write_request);
     }
 
-    aws_mem_release(write_request->alloc, write_request);
-
     /* Report outcome to user */
     if (user_callback) {
 
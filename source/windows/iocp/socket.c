@@ -296,6 +296,12 @@ struct io_operation_data {
     bool in_use;
 };
 
+enum {
+    /* cap on retired write operations kept for reuse per socket; in-flight writes per socket are
+     * bounded by the channel's write queue, so a small cache covers the steady state */
+    AWS_IOCP_WRITE_OPERATION_CACHE_MAX = 8,
+};
+
 struct iocp_socket {
     struct socket_vtable *vtable;
     struct io_operation_data *read_io_data;
@@ -303,6 +309,10 @@ struct iocp_socket {
     uint8_t accept_buffer[SOCK_STORAGE_SIZE * 2];
     struct socket_connect_args *connect_args;
     struct aws_linked_list pending_io_operations;
+    /* retired write operations cached for reuse, so steady-state writes don't heap-allocate and
+     * their OVERLAPPED structures stay in memory the kernel has already probed and locked */
+    struct aws_linked_list free_write_operations;
+    size_t free_write_operation_count;
     bool stop_accept;
 };
 
@@ -374,6 +384,7 @@ static int s_socket_init(
     impl->read_io_data->socket = socket;
     impl->read_io_data->in_use = false;
     aws_linked_list_init(&impl->pending_io_operations);
+    aws_linked_list_init(&impl->free_write_operations);
 
     socket->allocator = alloc;
     socket->io_handle.data.handle = INVALID_HANDLE_VALUE;
@@ -424,6 +435,13 @@ void aws_socket_clean_up(struct aws_socket *socket) {
         aws_mem_release(socket->allocator, socket_impl->read_io_data);
     }
 
+    while (!aws_linked_list_empty(&socket_impl->free_write_operations)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&socket_impl->free_write_operations);
+        struct io_operation_data *op_data = AWS_CONTAINER_OF(node, struct io_operation_data, node);
+        /* cached entries are write_cb_args allocations; io_data is their first member */
+        aws_mem_release(socket->allocator, op_data);
+    }
+
     aws_mem_release(socket->allocator, socket->impl);
     AWS_ZERO_STRUCT(*socket);
     socket->io_handle.data.handle = INVALID_HANDLE_VALUE;
@@ -555,6 +573,54 @@ int aws_socket_start_accept(
     return socket_impl->vtable->start_accept(socket, accept_loop, on_accept_result, user_data);
 }
 
+int aws_socket_start_accept_multi_loop(
+    struct aws_socket *socket,
+    struct aws_event_loop_group *el_group,
+    aws_socket_on_accept_result_fn *on_accept_result,
+    void *user_data) {
+    /* IOCP has no exclusive-wakeup analogue for a shared AcceptEx listener; accepts funnel
+     * through the loop that owns the socket as before. */
+    (void)el_group;
+    (void)socket;
+    (void)on_accept_result;
+    (void)user_data;
+    return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+}
+
+int aws_socket_read_datagrams(
+    struct aws_socket *socket,
+    struct aws_byte_buf *buffers,
+    size_t buffer_count,
+    size_t *num_received) {
+    /* no recvmmsg analogue on this platform; fall back to one read per datagram */
+    *num_received = 0;
+    for (size_t i = 0; i < buffer_count; ++i) {
+        size_t amount_read = 0;
+        if (aws_socket_read(socket, &buffers[i], &amount_read)) {
+            if (aws_last_error() == AWS_IO_READ_WOULD_BLOCK && *num_received > 0) {
+                aws_reset_error();
+                return AWS_OP_SUCCESS;
+            }
+            return AWS_OP_ERR;
+        }
+        ++*num_received;
+    }
+    return AWS_OP_SUCCESS;
+}
+
+int aws_socket_write_datagrams(
+    struct aws_socket *socket,
+    const struct aws_byte_cursor *datagrams,
+    size_t datagram_count,
+    size_t *num_sent) {
+    /* no sendmmsg analogue in the IOCP model; use aws_socket_write per datagram. */
+    (void)socket;
+    (void)datagrams;
+    (void)datagram_count;
+    *num_sent = 0;
+    return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+}
+
 int aws_socket_stop_accept(struct aws_socket *socket) {
     struct iocp_socket *socket_impl = socket->impl;
     return socket_impl->vtable->stop_accept(socket);
@@ -2259,6 +2325,44 @@ int aws_socket_set_options(struct aws_socket *socket, const struct aws_socket_op
 
     socket->options = *options;
 
+    if (socket->options.domain != AWS_SOCKET_LOCAL) {
+        if (socket->options.send_buffer_size > 0) {
+            int send_buffer_size = (int)socket->options.send_buffer_size;
+            if (setsockopt(
+                    (SOCKET)socket->io_handle.data.handle,
+                    SOL_SOCKET,
+                    SO_SNDBUF,
+                    (char *)&send_buffer_size,
+                    sizeof(int))) {
+                int wsa_err = WSAGetLastError(); /* logging may reset error, so cache it */
+                AWS_LOGF_WARN(
+                    AWS_LS_IO_SOCKET,
+                    "id=%p handle=%p: setsockopt() call for SO_SNDBUF failed with WSAError %d",
+                    (void *)socket,
+                    (void *)socket->io_handle.data.handle,
+                    wsa_err);
+            }
+        }
+
+        if (socket->options.receive_buffer_size > 0) {
+            int receive_buffer_size = (int)socket->options.receive_buffer_size;
+            if (setsockopt(
+                    (SOCKET)socket->io_handle.data.handle,
+                    SOL_SOCKET,
+                    SO_RCVBUF,
+                    (char *)&receive_buffer_size,
+                    sizeof(int))) {
+                int wsa_err = WSAGetLastError(); /* logging may reset error, so cache it */
+                AWS_LOGF_WARN(
+                    AWS_LS_IO_SOCKET,
+                    "id=%p handle=%p: setsockopt() call for SO_RCVBUF failed with WSAError %d",
+                    (void *)socket,
+                    (void *)socket->io_handle.data.handle,
+                    wsa_err);
+            }
+        }
+    }
+
     if (socket->options.domain != AWS_SOCKET_LOCAL && socket->options.type == AWS_SOCKET_STREAM) {
         if (socket->options.keepalive &&
             !(socket->options.keep_alive_interval_sec && socket->options.keep_alive_timeout_sec)) {
@@ -2539,6 +2643,12 @@ int aws_socket_assign_to_event_loop(struct aws_socket *socket, struct aws_event_
     return aws_event_loop_connect_handle_to_io_completion_port(event_loop, &socket->io_handle);
 }
 
+int aws_socket_unassign_from_event_loop(struct aws_socket *socket) {
+    (void)socket;
+    /* a handle associated with an i/o completion port cannot be disassociated from it */
+    return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+}
+
 struct aws_event_loop *aws_socket_get_event_loop(struct aws_socket *socket) {
     return socket->event_loop;
 }
@@ -3090,6 +3200,35 @@ struct write_cb_args {
     void *user_data;
 };
 
+/* Returns a completed write operation to the socket's reuse cache, or frees it if the cache is full. */
+static void s_socket_recycle_write_operation(struct aws_socket *socket, struct write_cb_args *write_cb_args) {
+    struct iocp_socket *socket_impl = socket->impl;
+
+    if (socket_impl->free_write_operation_count >= AWS_IOCP_WRITE_OPERATION_CACHE_MAX) {
+        aws_mem_release(write_cb_args->io_data.allocator, write_cb_args);
+        return;
+    }
+
+    aws_linked_list_push_back(&socket_impl->free_write_operations, &write_cb_args->io_data.node);
+    socket_impl->free_write_operation_count++;
+}
+
+/* Acquires a write operation from the socket's reuse cache, falling back to a fresh allocation. */
+static struct write_cb_args *s_socket_acquire_write_operation(struct aws_socket *socket) {
+    struct iocp_socket *socket_impl = socket->impl;
+
+    if (!aws_linked_list_empty(&socket_impl->free_write_operations)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&socket_impl->free_write_operations);
+        socket_impl->free_write_operation_count--;
+        struct io_operation_data *op_data = AWS_CONTAINER_OF(node, struct io_operation_data, node);
+        struct write_cb_args *write_cb_args = AWS_CONTAINER_OF(op_data, struct write_cb_args, io_data);
+        AWS_ZERO_STRUCT(*write_cb_args);
+        return write_cb_args;
+    }
+
+    return aws_mem_calloc(socket->allocator, 1, sizeof(struct write_cb_args));
+}
+
 /* Invoked for TCP, UDP, and Local when a message has been completely written to the wire.*/
 static void s_socket_written_event(
     struct aws_event_loop *event_loop,
@@ -3142,9 +3281,11 @@ static void s_socket_written_event(
 
     void *user_data = write_cb_args->user_data;
     aws_socket_on_write_completed_fn *callback = write_cb_args->user_callback;
-    callback(operation_data->socket, aws_error_code, num_bytes_transferred, user_data);
 
-    aws_mem_release(operation_data->allocator, write_cb_args);
+    /* recycle before the callback; the callback may close and clean up the socket */
+    s_socket_recycle_write_operation(socket, write_cb_args);
+
+    callback(socket, aws_error_code, num_bytes_transferred, user_data);
 }
 
 int aws_socket_write(
@@ -3165,7 +3306,7 @@ int aws_socket_write(
         return aws_raise_error(AWS_IO_SOCKET_NOT_CONNECTED);
     }
 
-    struct write_cb_args *write_cb_data = aws_mem_calloc(socket->allocator, 1, sizeof(struct write_cb_args));
+    struct write_cb_args *write_cb_data = s_socket_acquire_write_operation(socket);
     if (!write_cb_data) {
         socket->state = ERRORED;
         return AWS_OP_ERR;
@@ -3221,6 +3362,36 @@ int aws_socket_write(
     return AWS_OP_SUCCESS;
 }
 
+int aws_socket_write_urgent(
+    struct aws_socket *socket,
+    const struct aws_byte_cursor *cursor,
+    aws_socket_on_write_completed_fn *written_fn,
+    void *user_data) {
+    /* every write is handed straight to the kernel via WriteFile(); there is no user-space backlog
+     * for an urgent write to overtake, so this is identical to aws_socket_write() */
+    return aws_socket_write(socket, cursor, written_fn, user_data);
+}
+
+int aws_socket_write_file_region(
+    struct aws_socket *socket,
+    int file_fd,
+    uint64_t offset,
+    size_t length,
+    aws_socket_on_write_completed_fn *written_fn,
+    void *user_data) {
+    (void)socket;
+    (void)file_fd;
+    (void)offset;
+    (void)length;
+    (void)written_fn;
+    (void)user_data;
+
+    /* The POSIX file descriptor in the signature doesn't map to this backend; a TransmitFile()
+     * path would also need its own OVERLAPPED plumbing. Callers fall back to streamed reads
+     * through aws_socket_write(). */
+    return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+}
+
 int aws_socket_get_error(struct aws_socket *socket) {
     if (socket->options.domain != AWS_SOCKET_LOCAL) {
         int connect_result;
@@ -3241,6 +3412,46 @@ int aws_socket_get_error(struct aws_socket *socket) {
     return AWS_OP_SUCCESS;
 }
 
+int aws_socket_fetch_transport_telemetry(
+    struct aws_socket *socket,
+    struct aws_socket_transport_telemetry *out_telemetry) {
+    (void)socket;
+    AWS_ZERO_STRUCT(*out_telemetry);
+    return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+}
+
+int aws_socket_init_from_fd(
+    struct aws_socket *socket,
+    struct aws_allocator *alloc,
+    const struct aws_socket_options *options,
+    int connected_fd) {
+    (void)socket;
+    (void)alloc;
+    (void)options;
+    (void)connected_fd;
+    return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+}
+
+int aws_socket_send_fd(
+    struct aws_socket *socket,
+    const struct aws_byte_cursor *payload,
+    int fd_to_send,
+    size_t *amount_written) {
+    (void)socket;
+    (void)payload;
+    (void)fd_to_send;
+    *amount_written = 0;
+    return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+}
+
+int aws_socket_read_with_fd(struct aws_socket *socket, struct aws_byte_buf *buffer, size_t *amount_read, int *out_fd) {
+    (void)socket;
+    (void)buffer;
+    *amount_read = 0;
+    *out_fd = -1;
+    return aws_raise_error(AWS_ERROR_PLATFORM_NOT_SUPPORTED);
+}
+
 bool aws_socket_is_open(struct aws_socket *socket) {
     return socket->io_handle.data.handle != INVALID_HANDLE_VALUE;
 }
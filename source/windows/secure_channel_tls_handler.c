@@ -47,7 +47,10 @@ void aws_tls_init_static_state(struct aws_allocator *alloc) {
     (void)alloc;
 }
 
-void aws_tls_clean_up_static_state(void) {}
+void aws_tls_clean_up_static_state(void) {
+    aws_tls_verification_cache_clean_up();
+    aws_pki_release_cert_store_cache();
+}
 
 struct secure_channel_ctx {
     struct aws_tls_ctx ctx;
@@ -60,6 +63,7 @@ struct secure_channel_ctx {
     HCRYPTKEY private_key;
     bool verify_peer;
     bool should_free_pcerts;
+    bool verification_cache_enabled;
 };
 
 struct secure_channel_handler {
@@ -103,6 +107,7 @@ struct secure_channel_handler {
     bool advertise_alpn_message;
     bool negotiation_finished;
     bool verify_peer;
+    bool verification_cache_enabled;
 };
 
 static size_t s_message_overhead(struct aws_channel_handler *handler) {
@@ -178,6 +183,65 @@ bool aws_tls_is_cipher_pref_supported(enum aws_tls_cipher_pref cipher_pref) {
 #define MAX_HOST_LENGTH 255
 
 /* this only gets called if the user specified a custom ca. */
+static int s_verdict_key_append(struct aws_byte_buf *key, const BYTE *data, DWORD length) {
+    uint64_t length_prefix = (uint64_t)length;
+    struct aws_byte_cursor length_cursor = {.ptr = (uint8_t *)&length_prefix, .len = sizeof(length_prefix)};
+    struct aws_byte_cursor data_cursor = {.ptr = (uint8_t *)data, .len = length};
+
+    if (aws_byte_buf_append_dynamic(key, &length_cursor)) {
+        return AWS_OP_ERR;
+    }
+
+    return length > 0 ? aws_byte_buf_append_dynamic(key, &data_cursor) : AWS_OP_SUCCESS;
+}
+
+/*
+ * Serializes the bytes that determine a verification verdict - the identity of the trust store that will judge
+ * the chain, the peer's leaf certificate, every certificate the peer presented alongside it, and the server
+ * name, each length-prefixed - into out_key for use with the process-wide verification cache. The trust-store
+ * identity keeps contexts configured with different custom CAs from sharing verdicts for the same peer chain;
+ * handle identity is sufficient because the cache is in-memory and the store lives as long as its context.
+ */
+static int s_build_chain_verdict_key(
+    struct aws_channel_handler *handler,
+    PCCERT_CONTEXT peer_certificate,
+    struct aws_byte_buf *out_key) {
+
+    struct secure_channel_handler *sc_handler = handler->impl;
+
+    if (aws_byte_buf_init(out_key, handler->alloc, 2048)) {
+        return AWS_OP_ERR;
+    }
+
+    HCERTSTORE trust_store = sc_handler->custom_ca_store;
+    if (s_verdict_key_append(out_key, (const BYTE *)&trust_store, sizeof(trust_store))) {
+        goto error;
+    }
+
+    if (s_verdict_key_append(out_key, peer_certificate->pbCertEncoded, peer_certificate->cbCertEncoded)) {
+        goto error;
+    }
+
+    PCCERT_CONTEXT presented_cert = NULL;
+    while ((presented_cert = CertEnumCertificatesInStore(peer_certificate->hCertStore, presented_cert)) != NULL) {
+        if (s_verdict_key_append(out_key, presented_cert->pbCertEncoded, presented_cert->cbCertEncoded)) {
+            CertFreeCertificateContext(presented_cert);
+            goto error;
+        }
+    }
+
+    struct aws_byte_buf host = aws_tls_handler_server_name(handler);
+    if (s_verdict_key_append(out_key, host.buffer, (DWORD)host.len)) {
+        goto error;
+    }
+
+    return AWS_OP_SUCCESS;
+
+error:
+    aws_byte_buf_clean_up(out_key);
+    return AWS_OP_ERR;
+}
+
 static int s_manually_verify_peer_cert(struct aws_channel_handler *handler) {
     AWS_LOGF_DEBUG(
         AWS_LS_IO_TLS,
@@ -203,6 +267,41 @@ static int s_manually_verify_peer_cert(struct aws_channel_handler *handler) {
         return AWS_OP_ERR;
     }
 
+    /* before doing any path building, check whether this exact presented chain was already verified recently */
+    struct aws_byte_buf verdict_key;
+    AWS_ZERO_STRUCT(verdict_key);
+    bool record_verdict = false;
+
+    if (sc_handler->verification_cache_enabled) {
+        if (s_build_chain_verdict_key(handler, peer_certificate, &verdict_key)) {
+            /* keying failure just means no caching for this handshake */
+            aws_reset_error();
+        } else {
+            record_verdict = true;
+
+            int cached_error_code = AWS_ERROR_SUCCESS;
+            if (aws_tls_verification_cache_check(aws_byte_cursor_from_buf(&verdict_key), &cached_error_code)) {
+                aws_byte_buf_clean_up(&verdict_key);
+                CertFreeCertificateContext(peer_certificate);
+
+                if (cached_error_code == AWS_ERROR_SUCCESS) {
+                    AWS_LOGF_DEBUG(
+                        AWS_LS_IO_TLS,
+                        "id=%p: peer chain matched a cached verification verdict, skipping chain building.",
+                        (void *)handler);
+                    return AWS_OP_SUCCESS;
+                }
+
+                AWS_LOGF_ERROR(
+                    AWS_LS_IO_TLS,
+                    "id=%p: peer chain matched a cached rejection verdict %s.",
+                    (void *)handler,
+                    aws_error_name(cached_error_code));
+                return AWS_OP_ERR;
+            }
+        }
+    }
+
     /* this next bit scours the custom trust store to try and load a chain to verify
        the leaf certificate against. */
     CERT_CHAIN_ENGINE_CONFIG engine_config;
@@ -334,6 +433,14 @@ static int s_manually_verify_peer_cert(struct aws_channel_handler *handler) {
 
 done:
 
+    if (record_verdict) {
+        aws_tls_verification_cache_put(
+            handler->alloc,
+            aws_byte_cursor_from_buf(&verdict_key),
+            result == AWS_OP_SUCCESS ? AWS_ERROR_SUCCESS : AWS_IO_TLS_ERROR_NEGOTIATION_FAILURE);
+    }
+    aws_byte_buf_clean_up(&verdict_key);
+
     if (cert_chain_ctx != NULL) {
         CertFreeCertificateChain(cert_chain_ctx);
     }
@@ -1046,7 +1153,11 @@ static int s_do_client_side_negotiation_step_2(struct aws_channel_handler *handl
     return AWS_OP_SUCCESS;
 }
 
-static int s_do_application_data_decrypt(struct aws_channel_handler *handler) {
+/* Decrypts every record in in_buf. DecryptMessage() aliases its output buffers over the input, so decryption is
+   in place and in_buf's contents are consumed. in_buf is either the handler's buffered_read_in_data_buf, or an
+   incoming aws_io_message's buffer when nothing was carried over from a previous read; in the latter case an
+   incomplete trailing record is stashed in buffered_read_in_data_buf for the next read to complete. */
+static int s_decrypt_buffer(struct aws_channel_handler *handler, struct aws_byte_buf *in_buf) {
     struct secure_channel_handler *sc_handler = handler->impl;
 
     /* I know this is an unncessary initialization, it's initialized here to make linters happy.*/
@@ -1060,13 +1171,13 @@ static int s_do_application_data_decrypt(struct aws_channel_handler *handler) {
         SecBuffer input_buffers[4];
         AWS_ZERO_ARRAY(input_buffers);
 
-        size_t read_len = sc_handler->read_extra ? sc_handler->read_extra : sc_handler->buffered_read_in_data_buf.len;
-        size_t offset = sc_handler->read_extra ? sc_handler->buffered_read_in_data_buf.len - sc_handler->read_extra : 0;
+        size_t read_len = sc_handler->read_extra ? sc_handler->read_extra : in_buf->len;
+        size_t offset = sc_handler->read_extra ? in_buf->len - sc_handler->read_extra : 0;
         sc_handler->read_extra = 0;
 
         input_buffers[0] = (SecBuffer){
             .cbBuffer = (unsigned long)(read_len),
-            .pvBuffer = sc_handler->buffered_read_in_data_buf.buffer + offset,
+            .pvBuffer = in_buf->buffer + offset,
             .BufferType = SECBUFFER_DATA,
         };
 
@@ -1106,7 +1217,7 @@ static int s_do_application_data_decrypt(struct aws_channel_handler *handler) {
                 } else {
                     error = AWS_OP_SUCCESS;
                     /* this means we processed everything in the buffer. */
-                    sc_handler->buffered_read_in_data_buf.len = 0;
+                    in_buf->len = 0;
                     AWS_LOGF_TRACE(
                         AWS_LS_IO_TLS,
                         "id=%p: Decrypt ended exactly on the end of the record, resetting buffer.",
@@ -1123,11 +1234,16 @@ static int s_do_application_data_decrypt(struct aws_channel_handler *handler) {
                 "id=%p: (incomplete) message received. Expecting remaining portion of size %zu.",
                 (void *)handler,
                 sc_handler->estimated_incomplete_size);
-            memmove(
-                sc_handler->buffered_read_in_data_buf.buffer,
-                sc_handler->buffered_read_in_data_buf.buffer + offset,
-                read_len);
-            sc_handler->buffered_read_in_data_buf.len = read_len;
+            if (in_buf == &sc_handler->buffered_read_in_data_buf) {
+                memmove(in_buf->buffer, in_buf->buffer + offset, read_len);
+                in_buf->len = read_len;
+            } else {
+                /* decrypting in place over a message's buffer; stash the incomplete trailing record in the
+                   handler's buffer so the next read can complete it. The in-place path is only taken when the
+                   message fits in this buffer, so the tail always fits too. */
+                memcpy(sc_handler->buffered_read_in_data_buf.buffer, in_buf->buffer + offset, read_len);
+                sc_handler->buffered_read_in_data_buf.len = read_len;
+            }
             aws_raise_error(AWS_IO_READ_WOULD_BLOCK);
         }
         /* SEC_I_CONTEXT_EXPIRED means that the message sender has shut down the connection.  One such case
@@ -1152,6 +1268,11 @@ static int s_do_application_data_decrypt(struct aws_channel_handler *handler) {
     return error;
 }
 
+static int s_do_application_data_decrypt(struct aws_channel_handler *handler) {
+    struct secure_channel_handler *sc_handler = handler->impl;
+    return s_decrypt_buffer(handler, &sc_handler->buffered_read_in_data_buf);
+}
+
 static int s_process_pending_output_messages(struct aws_channel_handler *handler) {
     struct secure_channel_handler *sc_handler = handler->impl;
 
@@ -1245,6 +1366,45 @@ static int s_process_read_message(
             (void *)handler,
             message->message_data.len);
 
+        /* Fast path: once negotiation is done and nothing is carried over from a previous partial record, decrypt
+           in place over the message's own buffer (DecryptMessage aliases its SECBUFFER_DATA output over the
+           input), skipping the copy into buffered_read_in_data_buf. Falls back to the buffered path when a
+           partial record is pending or the message wouldn't fit the incomplete-tail stash. */
+        if (sc_handler->s_connection_state_fn == s_do_application_data_decrypt && message->message_data.len > 0 &&
+            sc_handler->buffered_read_in_data_buf.len == 0 && sc_handler->read_extra == 0 &&
+            message->message_data.len <= sc_handler->buffered_read_in_data_buf.capacity) {
+
+            int fast_err = s_decrypt_buffer(handler, &message->message_data);
+
+            if (fast_err && aws_last_error() == AWS_IO_READ_WOULD_BLOCK) {
+                /* the incomplete trailing record was stashed in buffered_read_in_data_buf; flush whatever
+                   decrypted cleanly and keep the window from deadlocking, as the buffered path does. */
+                fast_err = AWS_OP_SUCCESS;
+                if (sc_handler->buffered_read_out_data_buf.len) {
+                    fast_err = s_process_pending_output_messages(handler);
+                }
+                if (!fast_err) {
+                    size_t window_size = slot->window_size;
+                    if (!window_size &&
+                        aws_channel_slot_increment_read_window(slot, sc_handler->estimated_incomplete_size)) {
+                        fast_err = AWS_OP_ERR;
+                    } else {
+                        sc_handler->estimated_incomplete_size = 0;
+                    }
+                }
+            } else if (!fast_err && sc_handler->buffered_read_out_data_buf.len) {
+                fast_err = s_process_pending_output_messages(handler);
+            }
+
+            if (!fast_err) {
+                aws_mem_release(message->allocator, message);
+                return AWS_OP_SUCCESS;
+            }
+
+            aws_channel_shutdown(slot->channel, aws_last_error());
+            return AWS_OP_ERR;
+        }
+
         struct aws_byte_cursor message_cursor = aws_byte_cursor_from_buf(&message->message_data);
 
         /* The SSPI interface forces us to manage incomplete records manually. So when we had extra after
@@ -1696,6 +1856,12 @@ struct aws_byte_buf aws_tls_handler_protocol(struct aws_channel_handler *handler
     return sc_handler->protocol;
 }
 
+enum aws_tls_early_data_status aws_tls_handler_early_data_status(struct aws_channel_handler *handler) {
+    /* SChannel does not support sending 0-RTT early data. */
+    (void)handler;
+    return AWS_TLS_EARLY_DATA_STATUS_NONE;
+}
+
 struct aws_byte_buf aws_tls_handler_server_name(struct aws_channel_handler *handler) {
     struct secure_channel_handler *sc_handler = handler->impl;
     return sc_handler->server_name;
@@ -1803,6 +1969,7 @@ static struct aws_channel_handler *s_tls_handler_new(
         aws_byte_buf_from_array(sc_handler->buffered_read_out_data, sizeof(sc_handler->buffered_read_out_data));
     sc_handler->buffered_read_out_data_buf.len = 0;
     sc_handler->verify_peer = sc_ctx->verify_peer;
+    sc_handler->verification_cache_enabled = sc_ctx->verification_cache_enabled;
 
     return &sc_handler->handler;
 
@@ -1898,7 +2065,25 @@ struct aws_tls_ctx *s_ctx_new(
         }
     }
 
+    /* SChannel maintains its own per-process session cache keyed off the credential handle acquired below, so
+     * connections sharing this ctx already resume sessions; there is nothing to wire up for
+     * session_cache_enabled. External session store callbacks are not supported on this backend. */
+    if (options->session_cache_enabled && options->session_cache_options.put_fn != NULL) {
+        AWS_LOGF_WARN(
+            AWS_LS_IO_TLS,
+            "static: external session store callbacks are not supported with SChannel; "
+            "the OS session cache will be used instead.");
+    }
+
+    if (options->on_chain_validation != NULL) {
+        AWS_LOGF_WARN(
+            AWS_LS_IO_TLS,
+            "static: asynchronous chain validation callbacks are not supported with SChannel; "
+            "validation runs inline as before.");
+    }
+
     secure_channel_ctx->verify_peer = options->verify_peer;
+    secure_channel_ctx->verification_cache_enabled = options->verification_cache_enabled;
     secure_channel_ctx->credentials.dwVersion = SCHANNEL_CRED_VERSION;
     secure_channel_ctx->should_free_pcerts = true;
 
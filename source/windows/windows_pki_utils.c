@@ -6,6 +6,9 @@
 #include <aws/io/pem.h>
 #include <aws/io/private/pki_utils.h>
 
+#include <aws/cal/hash.h>
+#include <aws/common/hash_table.h>
+#include <aws/common/mutex.h>
 #include <aws/common/uuid.h>
 
 #include <aws/io/logging.h>
@@ -22,6 +25,147 @@
 #define CERT_HASH_STR_LEN 40
 #define CERT_HASH_LEN 20
 
+/* System-store opens and CA-override parsing dominate TLS context creation on Windows, and both
+ * produce handles that CryptoAPI itself reference-counts (CertDuplicateStore /
+ * CertDuplicateCertificateContext). Results are cached keyed by a SHA-256 digest of the inputs;
+ * callers receive duplicated handles and release them exactly as before, while the cache holds
+ * one reference per entry until library clean-up. */
+struct cert_store_cache_entry {
+    struct aws_allocator *alloc;
+    struct aws_byte_cursor key; /* points at digest */
+    uint8_t digest[AWS_SHA256_LEN];
+    HCERTSTORE store;
+    PCCERT_CONTEXT cert; /* NULL for trusted-CA entries */
+};
+
+/* domain separation for the digest, so a path and a PEM blob with the same bytes cannot collide */
+enum cert_store_cache_tag {
+    CERT_STORE_CACHE_SYSTEM_PATH = 1,
+    CERT_STORE_CACHE_TRUSTED_CA = 2,
+};
+
+static struct aws_mutex s_cert_store_cache_lock = AWS_MUTEX_INIT;
+static struct aws_hash_table s_cert_store_cache;
+static bool s_cert_store_cache_valid;
+
+static uint64_t s_cert_store_cache_hash_key(const void *key) {
+    return aws_hash_byte_cursor_ptr(key);
+}
+
+static bool s_cert_store_cache_key_eq(const void *a, const void *b) {
+    return aws_byte_cursor_eq(a, b);
+}
+
+static void s_cert_store_cache_destroy_entry(void *value) {
+    struct cert_store_cache_entry *entry = value;
+    if (entry->cert) {
+        CertFreeCertificateContext(entry->cert);
+    }
+    CertCloseStore(entry->store, 0);
+    aws_mem_release(entry->alloc, entry);
+}
+
+static int s_compute_cert_store_cache_digest(
+    struct aws_allocator *alloc,
+    enum cert_store_cache_tag tag,
+    const struct aws_byte_cursor *input,
+    uint8_t *out_digest) {
+
+    struct aws_hash *sha256 = aws_sha256_new(alloc);
+    if (!sha256) {
+        return AWS_OP_ERR;
+    }
+
+    int result = AWS_OP_ERR;
+    uint8_t tag_byte = (uint8_t)tag;
+    struct aws_byte_cursor tag_cursor = aws_byte_cursor_from_array(&tag_byte, sizeof(tag_byte));
+    struct aws_byte_buf digest_buf = aws_byte_buf_from_empty_array(out_digest, AWS_SHA256_LEN);
+
+    if (aws_hash_update(sha256, &tag_cursor) || aws_hash_update(sha256, input) ||
+        aws_hash_finalize(sha256, &digest_buf, 0)) {
+        goto done;
+    }
+
+    result = AWS_OP_SUCCESS;
+
+done:
+    aws_hash_destroy(sha256);
+    return result;
+}
+
+static bool s_cert_store_cache_find(const uint8_t *digest, HCERTSTORE *out_store, PCCERT_CONTEXT *out_cert) {
+    bool found = false;
+
+    aws_mutex_lock(&s_cert_store_cache_lock);
+    if (s_cert_store_cache_valid) {
+        struct aws_byte_cursor key = aws_byte_cursor_from_array(digest, AWS_SHA256_LEN);
+        struct aws_hash_element *element = NULL;
+        aws_hash_table_find(&s_cert_store_cache, &key, &element);
+        if (element) {
+            struct cert_store_cache_entry *entry = element->value;
+            *out_store = CertDuplicateStore(entry->store);
+            if (out_cert) {
+                *out_cert = CertDuplicateCertificateContext(entry->cert);
+            }
+            found = true;
+        }
+    }
+    aws_mutex_unlock(&s_cert_store_cache_lock);
+
+    return found;
+}
+
+/* the cache is best-effort; any failure just skips caching */
+static void s_cert_store_cache_put(
+    struct aws_allocator *alloc,
+    const uint8_t *digest,
+    HCERTSTORE store,
+    PCCERT_CONTEXT cert) {
+
+    aws_mutex_lock(&s_cert_store_cache_lock);
+
+    if (!s_cert_store_cache_valid) {
+        if (aws_hash_table_init(
+                &s_cert_store_cache,
+                alloc,
+                4,
+                s_cert_store_cache_hash_key,
+                s_cert_store_cache_key_eq,
+                NULL,
+                s_cert_store_cache_destroy_entry)) {
+            goto done;
+        }
+        s_cert_store_cache_valid = true;
+    }
+
+    struct cert_store_cache_entry *entry = aws_mem_calloc(alloc, 1, sizeof(struct cert_store_cache_entry));
+    if (!entry) {
+        goto done;
+    }
+
+    entry->alloc = alloc;
+    memcpy(entry->digest, digest, AWS_SHA256_LEN);
+    entry->key = aws_byte_cursor_from_array(entry->digest, AWS_SHA256_LEN);
+    entry->store = CertDuplicateStore(store);
+    entry->cert = cert ? CertDuplicateCertificateContext(cert) : NULL;
+
+    if (aws_hash_table_put(&s_cert_store_cache, &entry->key, entry, NULL)) {
+        s_cert_store_cache_destroy_entry(entry);
+    }
+
+done:
+    aws_mutex_unlock(&s_cert_store_cache_lock);
+}
+
+void aws_pki_release_cert_store_cache(void) {
+    aws_mutex_lock(&s_cert_store_cache_lock);
+    if (s_cert_store_cache_valid) {
+        s_cert_store_cache_valid = false;
+        aws_hash_table_clean_up(&s_cert_store_cache);
+    }
+    aws_mutex_unlock(&s_cert_store_cache_lock);
+}
+
 /**
  * Split system cert path into exactly three segments like:
  * "CurrentUser\My\a11f8a9b5df5b98ba3508fbca575d09570e0d2c6"
@@ -57,6 +201,17 @@ int aws_load_cert_from_system_cert_store(const char *cert_path, HCERTSTORE *cert
 
     AWS_LOGF_INFO(AWS_LS_IO_PKI, "static: loading certificate at windows cert manager path '%s'.", cert_path);
 
+    uint8_t cache_digest[AWS_SHA256_LEN];
+    struct aws_byte_cursor path_cursor = aws_byte_cursor_from_c_str(cert_path);
+    bool digest_computed = s_compute_cert_store_cache_digest(
+                               aws_default_allocator(), CERT_STORE_CACHE_SYSTEM_PATH, &path_cursor, cache_digest) ==
+                           AWS_OP_SUCCESS;
+
+    if (digest_computed && s_cert_store_cache_find(cache_digest, cert_store, certs)) {
+        AWS_LOGF_DEBUG(AWS_LS_IO_PKI, "static: reusing cached cert store handle for '%s'.", cert_path);
+        return AWS_OP_SUCCESS;
+    }
+
     struct aws_byte_cursor segments[3];
     if (s_split_system_cert_path(cert_path, segments)) {
         return AWS_OP_ERR;
@@ -164,6 +319,10 @@ int aws_load_cert_from_system_cert_store(const char *cert_path, HCERTSTORE *cert
         goto on_error;
     }
 
+    if (digest_computed) {
+        s_cert_store_cache_put(aws_default_allocator(), cache_digest, *cert_store, *certs);
+    }
+
     return AWS_OP_SUCCESS;
 
 on_error:
@@ -184,6 +343,16 @@ int aws_import_trusted_certificates(
     *cert_store = NULL;
     int result = AWS_OP_ERR;
 
+    uint8_t cache_digest[AWS_SHA256_LEN];
+    bool digest_computed =
+        s_compute_cert_store_cache_digest(alloc, CERT_STORE_CACHE_TRUSTED_CA, certificates_blob, cache_digest) ==
+        AWS_OP_SUCCESS;
+
+    if (digest_computed && s_cert_store_cache_find(cache_digest, cert_store, NULL)) {
+        AWS_LOGF_DEBUG(AWS_LS_IO_PKI, "static: reusing cached trusted CA cert store.");
+        return AWS_OP_SUCCESS;
+    }
+
     if (aws_pem_objects_init_from_file_contents(&certificates, alloc, *certificates_blob)) {
         goto clean_up;
     }
@@ -253,6 +422,10 @@ int aws_import_trusted_certificates(
 
     result = AWS_OP_SUCCESS;
 
+    if (digest_computed) {
+        s_cert_store_cache_put(alloc, cache_digest, *cert_store, NULL);
+    }
+
 clean_up:
 
     aws_pem_objects_clean_up(&certificates);
@@ -0,0 +1,175 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/io/retry_strategy.h>
+
+#include <aws/testing/aws_test_harness.h>
+
+#include <aws/common/clock.h>
+#include <aws/common/condition_variable.h>
+
+#include <aws/io/event_loop.h>
+
+struct adaptive_retry_test_data {
+    struct aws_retry_token *retry_token;
+    struct aws_mutex mutex;
+    struct aws_condition_variable cvar;
+    int token_acquisition_error_code;
+    int schedule_retry_error_code;
+    bool token_acquired;
+    bool retry_ready;
+};
+
+static uint64_t s_mock_time_ns;
+
+static int s_mock_clock(uint64_t *timestamp) {
+    *timestamp = s_mock_time_ns;
+    return AWS_OP_SUCCESS;
+}
+
+static bool s_token_acquisition_completed(void *arg) {
+    struct adaptive_retry_test_data *test_data = arg;
+    return test_data->token_acquired;
+}
+
+static void s_on_retry_token_acquired(
+    struct aws_retry_strategy *retry_strategy,
+    int error_code,
+    struct aws_retry_token *token,
+    void *user_data) {
+    (void)retry_strategy;
+
+    struct adaptive_retry_test_data *test_data = user_data;
+    aws_mutex_lock(&test_data->mutex);
+    test_data->retry_token = token;
+    test_data->token_acquisition_error_code = error_code;
+    test_data->token_acquired = true;
+    aws_mutex_unlock(&test_data->mutex);
+    aws_condition_variable_notify_one(&test_data->cvar);
+}
+
+static bool s_retry_ready_completed(void *arg) {
+    struct adaptive_retry_test_data *test_data = arg;
+    return test_data->retry_ready;
+}
+
+static void s_on_retry_ready(struct aws_retry_token *token, int error_code, void *user_data) {
+    (void)token;
+
+    struct adaptive_retry_test_data *test_data = user_data;
+    aws_mutex_lock(&test_data->mutex);
+    test_data->schedule_retry_error_code = error_code;
+    test_data->retry_ready = true;
+    aws_mutex_unlock(&test_data->mutex);
+    aws_condition_variable_notify_one(&test_data->cvar);
+}
+
+/* Verify the rate limiter stays dormant until the first throttling response,
+ * then starts recommending send delays. */
+static int s_test_adaptive_retry_throttling_enables_rate_limiter(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+    aws_io_library_init(allocator);
+
+    s_mock_time_ns = AWS_TIMESTAMP_NANOS; /* start the mock clock at 1 second */
+
+    struct aws_event_loop_group *el_group = aws_event_loop_group_new_default(allocator, 1, NULL);
+    struct aws_adaptive_retry_options retry_options = {
+        .standard_options =
+            {
+                .backoff_retry_options =
+                    {
+                        .el_group = el_group,
+                    },
+            },
+        .clock_override = s_mock_clock,
+    };
+
+    struct aws_retry_strategy *retry_strategy = aws_retry_strategy_new_adaptive(allocator, &retry_options);
+    ASSERT_NOT_NULL(retry_strategy);
+
+    struct adaptive_retry_test_data test_data = {
+        .mutex = AWS_MUTEX_INIT,
+        .cvar = AWS_CONDITION_VARIABLE_INIT,
+    };
+
+    ASSERT_SUCCESS(aws_mutex_lock(&test_data.mutex));
+    ASSERT_SUCCESS(
+        aws_retry_strategy_acquire_retry_token(retry_strategy, NULL, s_on_retry_token_acquired, &test_data, 0));
+    ASSERT_SUCCESS(
+        aws_condition_variable_wait_pred(&test_data.cvar, &test_data.mutex, s_token_acquisition_completed, &test_data));
+    aws_mutex_unlock(&test_data.mutex);
+
+    ASSERT_INT_EQUALS(0, test_data.token_acquisition_error_code);
+    ASSERT_NOT_NULL(test_data.retry_token);
+
+    /* no throttling seen yet, so no send delay */
+    ASSERT_UINT_EQUALS(0, aws_retry_token_get_send_delay_ns(test_data.retry_token));
+
+    /* a throttling response enables the rate limiter */
+    s_mock_time_ns += 600ULL * 1000000ULL; /* +600ms */
+
+    ASSERT_SUCCESS(aws_mutex_lock(&test_data.mutex));
+    ASSERT_SUCCESS(aws_retry_strategy_schedule_retry(
+        test_data.retry_token, AWS_RETRY_ERROR_TYPE_THROTTLING, s_on_retry_ready, &test_data));
+    ASSERT_SUCCESS(
+        aws_condition_variable_wait_pred(&test_data.cvar, &test_data.mutex, s_retry_ready_completed, &test_data));
+    aws_mutex_unlock(&test_data.mutex);
+
+    ASSERT_INT_EQUALS(0, test_data.schedule_retry_error_code);
+
+    /* the bucket now meters admission; the retry attempt should be told to wait */
+    ASSERT_TRUE(aws_retry_token_get_send_delay_ns(test_data.retry_token) > 0);
+
+    ASSERT_SUCCESS(aws_retry_token_record_success(test_data.retry_token));
+    aws_retry_token_release(test_data.retry_token);
+
+    aws_retry_strategy_release(retry_strategy);
+    aws_event_loop_group_release(el_group);
+
+    aws_io_library_clean_up();
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(adaptive_retry_throttling_enables_rate_limiter, s_test_adaptive_retry_throttling_enables_rate_limiter)
+
+/* Verify a strategy without rate limiting reports no send delay. */
+static int s_test_adaptive_retry_delay_hint_defaults_to_zero(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+    aws_io_library_init(allocator);
+
+    struct aws_event_loop_group *el_group = aws_event_loop_group_new_default(allocator, 1, NULL);
+    struct aws_standard_retry_options retry_options = {
+        .backoff_retry_options =
+            {
+                .el_group = el_group,
+            },
+    };
+
+    struct aws_retry_strategy *retry_strategy = aws_retry_strategy_new_standard(allocator, &retry_options);
+    ASSERT_NOT_NULL(retry_strategy);
+
+    struct adaptive_retry_test_data test_data = {
+        .mutex = AWS_MUTEX_INIT,
+        .cvar = AWS_CONDITION_VARIABLE_INIT,
+    };
+
+    ASSERT_SUCCESS(aws_mutex_lock(&test_data.mutex));
+    ASSERT_SUCCESS(
+        aws_retry_strategy_acquire_retry_token(retry_strategy, NULL, s_on_retry_token_acquired, &test_data, 0));
+    ASSERT_SUCCESS(
+        aws_condition_variable_wait_pred(&test_data.cvar, &test_data.mutex, s_token_acquisition_completed, &test_data));
+    aws_mutex_unlock(&test_data.mutex);
+
+    ASSERT_NOT_NULL(test_data.retry_token);
+    ASSERT_UINT_EQUALS(0, aws_retry_token_get_send_delay_ns(test_data.retry_token));
+
+    aws_retry_token_release(test_data.retry_token);
+    aws_retry_strategy_release(retry_strategy);
+    aws_event_loop_group_release(el_group);
+
+    aws_io_library_clean_up();
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(adaptive_retry_delay_hint_defaults_to_zero, s_test_adaptive_retry_delay_hint_defaults_to_zero)
@@ -5,6 +5,8 @@
 #include <aws/io/async_stream.h>
 
 #include <aws/common/clock.h>
+#include <aws/common/file.h>
+#include <aws/io/event_loop.h>
 #include <aws/io/future.h>
 #include <aws/testing/async_stream_tester.h>
 #include <aws/testing/aws_test_harness.h>
@@ -133,6 +135,181 @@ static int s_test_async_input_stream_fill_eof_requires_extra_read(struct aws_all
     return 0;
 }
 
+/* Test aws_async_input_stream_new_from_file()
+ * Ensure reads run off the calling thread and deliver the whole file */
+AWS_TEST_CASE(async_input_stream_file_simple, s_test_async_input_stream_file_simple)
+static int s_test_async_input_stream_file_simple(struct aws_allocator *alloc, void *ctx) {
+    (void)ctx;
+    aws_io_library_init(alloc);
+
+    const char *file_path = "async_input_stream_file_simple.txt"; /* unique name */
+    remove(file_path);
+    FILE *file = aws_fopen(file_path, "w");
+    fprintf(file, "123456789");
+    fclose(file);
+
+    struct aws_event_loop_group *reading_elg = aws_event_loop_group_new_default(alloc, 1, NULL);
+
+    struct aws_async_input_stream *async_stream = aws_async_input_stream_new_from_file(alloc, file_path, reading_elg);
+    ASSERT_NOT_NULL(async_stream);
+
+    struct aws_byte_buf buf;
+    aws_byte_buf_init(&buf, alloc, 512);
+
+    struct aws_future_bool *read_future = aws_async_input_stream_read_to_fill(async_stream, &buf);
+    ASSERT_TRUE(aws_future_bool_wait(read_future, MAX_TIMEOUT_NS));
+    ASSERT_INT_EQUALS(0, aws_future_bool_get_error(read_future));
+    ASSERT_BIN_ARRAYS_EQUALS("123456789", 9, buf.buffer, buf.len);
+    aws_future_bool_release(read_future);
+
+    /* one more read confirms EOF */
+    buf.len = 0;
+    read_future = aws_async_input_stream_read_to_fill(async_stream, &buf);
+    ASSERT_TRUE(aws_future_bool_wait(read_future, MAX_TIMEOUT_NS));
+    ASSERT_INT_EQUALS(0, aws_future_bool_get_error(read_future));
+    ASSERT_TRUE(aws_future_bool_get_result(read_future));
+    aws_future_bool_release(read_future);
+
+    /* cleanup */
+    aws_byte_buf_clean_up(&buf);
+    aws_async_input_stream_release(async_stream);
+    aws_event_loop_group_release(reading_elg);
+    remove(file_path);
+    aws_io_library_clean_up();
+    return 0;
+}
+
+/* Test aws_async_input_stream_new_from_file()
+ * Ensure a nonexistent file fails creation cleanly */
+AWS_TEST_CASE(async_input_stream_file_open_failure, s_test_async_input_stream_file_open_failure)
+static int s_test_async_input_stream_file_open_failure(struct aws_allocator *alloc, void *ctx) {
+    (void)ctx;
+    aws_io_library_init(alloc);
+
+    struct aws_event_loop_group *reading_elg = aws_event_loop_group_new_default(alloc, 1, NULL);
+
+    struct aws_async_input_stream *async_stream =
+        aws_async_input_stream_new_from_file(alloc, "file_that_does_not_exist.txt", reading_elg);
+    ASSERT_NULL(async_stream);
+
+    aws_event_loop_group_release(reading_elg);
+    aws_io_library_clean_up();
+    return 0;
+}
+
+/* Test aws_async_input_stream_readv()
+ * Ensure one call fills a whole batch of buffers */
+AWS_TEST_CASE(async_input_stream_readv, s_test_async_input_stream_readv)
+static int s_test_async_input_stream_readv(struct aws_allocator *alloc, void *ctx) {
+    (void)ctx;
+    aws_io_library_init(alloc);
+
+    struct aws_async_input_stream_tester_options options = {
+        .completion_strategy = AWS_ASYNC_READ_COMPLETES_ON_ANOTHER_THREAD,
+        .base =
+            {
+                .source_bytes = aws_byte_cursor_from_c_str("123456789"),
+                .max_bytes_per_read = 1,
+            },
+    };
+    struct aws_async_input_stream *async_stream = aws_async_input_stream_new_tester(alloc, &options);
+
+    struct aws_byte_buf dest_array[2];
+    aws_byte_buf_init(&dest_array[0], alloc, 4);
+    aws_byte_buf_init(&dest_array[1], alloc, 16);
+
+    struct aws_future_bool *read_future = aws_async_input_stream_readv(async_stream, dest_array, 2);
+    ASSERT_TRUE(aws_future_bool_wait(read_future, MAX_TIMEOUT_NS));
+    ASSERT_INT_EQUALS(0, aws_future_bool_get_error(read_future));
+    ASSERT_BIN_ARRAYS_EQUALS("1234", 4, dest_array[0].buffer, dest_array[0].len);
+    ASSERT_BIN_ARRAYS_EQUALS("56789", 5, dest_array[1].buffer, dest_array[1].len);
+    ASSERT_TRUE(aws_future_bool_get_result(read_future));
+    aws_future_bool_release(read_future);
+
+    /* cleanup */
+    aws_byte_buf_clean_up(&dest_array[0]);
+    aws_byte_buf_clean_up(&dest_array[1]);
+    aws_async_input_stream_release(async_stream);
+    aws_io_library_clean_up();
+    return 0;
+}
+
+/* Test aws_async_input_stream_new_read_ahead()
+ * Ensure prefetched reads deliver the same bytes and EOF as the source */
+AWS_TEST_CASE(async_input_stream_read_ahead_simple, s_test_async_input_stream_read_ahead_simple)
+static int s_test_async_input_stream_read_ahead_simple(struct aws_allocator *alloc, void *ctx) {
+    (void)ctx;
+    aws_io_library_init(alloc);
+
+    struct aws_async_input_stream_tester_options options = {
+        .completion_strategy = AWS_ASYNC_READ_COMPLETES_ON_ANOTHER_THREAD,
+        .base =
+            {
+                .source_bytes = aws_byte_cursor_from_c_str("123456789"),
+                .max_bytes_per_read = 1,
+            },
+    };
+    struct aws_async_input_stream *source = aws_async_input_stream_new_tester(alloc, &options);
+
+    /* tiny ring so the adapter has to cycle its buffers several times */
+    struct aws_async_input_stream *async_stream = aws_async_input_stream_new_read_ahead(alloc, source, 2 /*size*/, 2 /*count*/);
+    ASSERT_NOT_NULL(async_stream);
+
+    struct aws_byte_buf buf;
+    aws_byte_buf_init(&buf, alloc, 512);
+
+    struct aws_future_bool *read_future = aws_async_input_stream_read_to_fill(async_stream, &buf);
+    ASSERT_TRUE(aws_future_bool_wait(read_future, MAX_TIMEOUT_NS));
+    ASSERT_INT_EQUALS(0, aws_future_bool_get_error(read_future));
+    ASSERT_BIN_ARRAYS_EQUALS("123456789", 9, buf.buffer, buf.len);
+    ASSERT_TRUE(aws_future_bool_get_result(read_future));
+    aws_future_bool_release(read_future);
+
+    /* cleanup */
+    aws_byte_buf_clean_up(&buf);
+    aws_async_input_stream_release(async_stream);
+    aws_async_input_stream_release(source);
+    aws_io_library_clean_up();
+    return 0;
+}
+
+/* Test aws_async_input_stream_new_read_ahead()
+ * Ensure a source read error surfaces through the adapter */
+AWS_TEST_CASE(async_input_stream_read_ahead_reports_error, s_test_async_input_stream_read_ahead_reports_error)
+static int s_test_async_input_stream_read_ahead_reports_error(struct aws_allocator *alloc, void *ctx) {
+    (void)ctx;
+    aws_io_library_init(alloc);
+
+    struct aws_async_input_stream_tester_options options = {
+        .base =
+            {
+                .source_bytes = aws_byte_cursor_from_c_str("123456789"),
+                .max_bytes_per_read = 1,
+                .fail_on_nth_read = 2,
+                .fail_with_error_code = 999,
+            },
+    };
+    struct aws_async_input_stream *source = aws_async_input_stream_new_tester(alloc, &options);
+
+    struct aws_async_input_stream *async_stream = aws_async_input_stream_new_read_ahead(alloc, source, 4 /*size*/, 2 /*count*/);
+    ASSERT_NOT_NULL(async_stream);
+
+    struct aws_byte_buf buf;
+    aws_byte_buf_init(&buf, alloc, 512);
+
+    struct aws_future_bool *read_future = aws_async_input_stream_read_to_fill(async_stream, &buf);
+    ASSERT_TRUE(aws_future_bool_wait(read_future, MAX_TIMEOUT_NS));
+    ASSERT_INT_EQUALS(999, aws_future_bool_get_error(read_future));
+    aws_future_bool_release(read_future);
+
+    /* cleanup */
+    aws_byte_buf_clean_up(&buf);
+    aws_async_input_stream_release(async_stream);
+    aws_async_input_stream_release(source);
+    aws_io_library_clean_up();
+    return 0;
+}
+
 /* Test aws_async_input_stream_read_to_fill()
  * Ensure that it reports errors from an underlying read() call */
 AWS_TEST_CASE(async_input_stream_fill_reports_error, s_test_async_input_stream_fill_reports_error)
@@ -11,8 +11,11 @@
 #include <aws/io/channel.h>
 #include <aws/io/channel_bootstrap.h>
 #include <aws/io/event_loop.h>
+#include <aws/io/message_pool.h>
 #include <aws/io/socket.h>
+#include <aws/io/statistics.h>
 #include <aws/testing/aws_test_harness.h>
+#include <aws/testing/io_testing_channel.h>
 
 #include "mock_dns_resolver.h"
 #include "read_write_test_handler.h"
@@ -616,6 +619,75 @@ static int s_test_channel_duplicate_shutdown(struct aws_allocator *allocator, vo
 
 AWS_TEST_CASE(channel_duplicate_shutdown, s_test_channel_duplicate_shutdown)
 
+struct server_warm_up_test_args {
+    struct aws_mutex mutex;
+    struct aws_condition_variable condition_variable;
+    bool complete; /* protected by mutex */
+};
+
+static void s_server_warm_up_test_on_complete(struct aws_server_bootstrap *bootstrap, void *user_data) {
+    (void)bootstrap;
+    struct server_warm_up_test_args *test_args = user_data;
+
+    aws_mutex_lock(&test_args->mutex);
+    test_args->complete = true;
+    aws_mutex_unlock(&test_args->mutex);
+    aws_condition_variable_notify_one(&test_args->condition_variable);
+}
+
+static bool s_server_warm_up_test_complete_predicate(void *arg) {
+    struct server_warm_up_test_args *test_args = arg;
+    return test_args->complete;
+}
+
+static int s_test_server_bootstrap_warm_up(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_io_library_init(allocator);
+
+    struct aws_event_loop_group *event_loop_group = aws_event_loop_group_new_default(allocator, 2, NULL);
+    ASSERT_NOT_NULL(event_loop_group);
+
+    struct aws_server_bootstrap *bootstrap = aws_server_bootstrap_new(allocator, event_loop_group);
+    ASSERT_NOT_NULL(bootstrap);
+
+    struct server_warm_up_test_args test_args = {
+        .mutex = AWS_MUTEX_INIT,
+        .condition_variable = AWS_CONDITION_VARIABLE_INIT,
+        .complete = false,
+    };
+
+    struct aws_message_pool_creation_args pool_creation_args = {
+        .application_data_msg_data_size = 16 * 1024,
+        .application_data_msg_count = 8,
+        .small_block_msg_data_size = 128,
+        .small_block_msg_count = 8,
+    };
+
+    struct aws_server_bootstrap_warm_up_options warm_up_options = {
+        .message_pool_creation_args = &pool_creation_args,
+        .parked_channels_per_loop = 2,
+        .on_complete = s_server_warm_up_test_on_complete,
+        .user_data = &test_args,
+    };
+
+    ASSERT_SUCCESS(aws_server_bootstrap_warm_up(bootstrap, &warm_up_options));
+
+    ASSERT_SUCCESS(aws_mutex_lock(&test_args.mutex));
+    ASSERT_SUCCESS(aws_condition_variable_wait_pred(
+        &test_args.condition_variable, &test_args.mutex, s_server_warm_up_test_complete_predicate, &test_args));
+    ASSERT_SUCCESS(aws_mutex_unlock(&test_args.mutex));
+
+    aws_server_bootstrap_release(bootstrap);
+    aws_event_loop_group_release(event_loop_group);
+
+    aws_io_library_clean_up();
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(server_bootstrap_warm_up, s_test_server_bootstrap_warm_up)
+
 struct channel_connect_test_args {
     struct aws_mutex *mutex;
     struct aws_condition_variable cv;
@@ -841,3 +913,497 @@ static int s_test_channel_connect_some_hosts_timeout(struct aws_allocator *alloc
 }
 
 AWS_TEST_CASE(channel_connect_some_hosts_timeout, s_test_channel_connect_some_hosts_timeout);
+
+/* Adaptive statistics sampling: idle channels decay to long reporting intervals, and a decayed
+ * channel that moves data again is reported on the coordinator's next tick. Driven with the
+ * testing channel's virtual clock so the timeline is exact. */
+
+struct counting_stats_handler_impl {
+    struct aws_allocator *allocator;
+    size_t report_count;
+};
+
+static void s_counting_stats_process_statistics(
+    struct aws_crt_statistics_handler *handler,
+    struct aws_crt_statistics_sample_interval *interval,
+    struct aws_array_list *stats_list,
+    void *context) {
+    (void)interval;
+    (void)stats_list;
+    (void)context;
+
+    struct counting_stats_handler_impl *impl = handler->impl;
+    impl->report_count++;
+}
+
+static void s_counting_stats_destroy(struct aws_crt_statistics_handler *handler) {
+    struct counting_stats_handler_impl *impl = handler->impl;
+    struct aws_allocator *allocator = impl->allocator;
+    aws_mem_release(allocator, impl);
+    aws_mem_release(allocator, handler);
+}
+
+static uint64_t s_counting_stats_get_report_interval_ms(struct aws_crt_statistics_handler *handler) {
+    (void)handler;
+    return 10;
+}
+
+static struct aws_crt_statistics_handler_vtable s_counting_stats_vtable = {
+    .process_statistics = s_counting_stats_process_statistics,
+    .destroy = s_counting_stats_destroy,
+    .get_report_interval_ms = s_counting_stats_get_report_interval_ms,
+};
+
+static int s_test_channel_statistics_idle_decay(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    testing_channel_set_virtual_time(0);
+
+    struct aws_testing_channel_options test_channel_options = {.clock_fn = testing_channel_virtual_clock};
+    struct testing_channel testing_channel;
+    ASSERT_SUCCESS(testing_channel_init(&testing_channel, allocator, &test_channel_options));
+    ASSERT_SUCCESS(testing_channel_install_downstream_handler(&testing_channel, SIZE_MAX));
+
+    struct aws_crt_statistics_handler *stats_handler =
+        aws_mem_calloc(allocator, 1, sizeof(struct aws_crt_statistics_handler));
+    struct counting_stats_handler_impl *stats_impl =
+        aws_mem_calloc(allocator, 1, sizeof(struct counting_stats_handler_impl));
+    stats_impl->allocator = allocator;
+    stats_handler->vtable = &s_counting_stats_vtable;
+    stats_handler->allocator = allocator;
+    stats_handler->impl = stats_impl;
+
+    ASSERT_SUCCESS(aws_channel_set_statistics_handler(testing_channel.channel, stats_handler));
+
+    /* 150ms of idle in 10ms steps: with the interval doubling after each empty report,
+     * reports land at 10, 30, 70 and 150ms instead of one per tick */
+    for (size_t i = 0; i < 15; ++i) {
+        testing_channel_advance_virtual_time(&testing_channel, 10000000 /* 10ms */);
+    }
+    ASSERT_UINT_EQUALS(4, stats_impl->report_count);
+
+    /* moving data across a decayed channel pulls the next report in to the next tick */
+    char payload[2048];
+    memset(payload, 'x', sizeof(payload));
+    ASSERT_SUCCESS(
+        testing_channel_push_read_data(&testing_channel, aws_byte_cursor_from_array(payload, sizeof(payload))));
+    testing_channel_advance_virtual_time(&testing_channel, 10000000 /* 10ms */);
+    ASSERT_UINT_EQUALS(5, stats_impl->report_count);
+
+    /* drain the delivered message so clean-up doesn't leak it */
+    struct aws_byte_buf scratch;
+    ASSERT_SUCCESS(aws_byte_buf_init(&scratch, allocator, 2048));
+    ASSERT_SUCCESS(testing_channel_drain_messages(testing_channel_get_read_message_queue(&testing_channel), &scratch));
+    aws_byte_buf_clean_up(&scratch);
+
+    ASSERT_SUCCESS(testing_channel_clean_up(&testing_channel));
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(channel_statistics_idle_decay, s_test_channel_statistics_idle_decay)
+
+struct channel_migration_test_args {
+    struct aws_mutex mutex;
+    struct aws_condition_variable condition_variable;
+    struct aws_event_loop *destination_loop;
+    int migration_error_code;      /* protected by mutex */
+    bool migration_completed;      /* protected by mutex */
+    bool task_ran_on_destination;  /* protected by mutex */
+    bool task_completed;           /* protected by mutex */
+};
+
+static void s_channel_migration_test_on_completed(struct aws_channel *channel, int error_code, void *user_data) {
+    (void)channel;
+    struct channel_migration_test_args *migration_args = user_data;
+
+    aws_mutex_lock(&migration_args->mutex);
+    migration_args->migration_error_code = error_code;
+    migration_args->migration_completed = true;
+    aws_mutex_unlock(&migration_args->mutex);
+    aws_condition_variable_notify_one(&migration_args->condition_variable);
+}
+
+static bool s_channel_migration_completed_predicate(void *arg) {
+    struct channel_migration_test_args *migration_args = arg;
+    return migration_args->migration_completed;
+}
+
+static void s_channel_migration_test_task(struct aws_channel_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    (void)status;
+    struct channel_migration_test_args *migration_args = arg;
+
+    aws_mutex_lock(&migration_args->mutex);
+    migration_args->task_ran_on_destination =
+        aws_event_loop_thread_is_callers_thread(migration_args->destination_loop);
+    migration_args->task_completed = true;
+    aws_mutex_unlock(&migration_args->mutex);
+    aws_condition_variable_notify_one(&migration_args->condition_variable);
+}
+
+static bool s_channel_migration_task_predicate(void *arg) {
+    struct channel_migration_test_args *migration_args = arg;
+    return migration_args->task_completed;
+}
+
+static int s_test_channel_migrate_between_loops(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+    struct aws_event_loop *loop_a = aws_event_loop_new_default(allocator, aws_high_res_clock_get_ticks);
+    ASSERT_NOT_NULL(loop_a, "Event loop creation failed with error: %s", aws_error_debug_str(aws_last_error()));
+    ASSERT_SUCCESS(aws_event_loop_run(loop_a));
+
+    struct aws_event_loop *loop_b = aws_event_loop_new_default(allocator, aws_high_res_clock_get_ticks);
+    ASSERT_NOT_NULL(loop_b, "Event loop creation failed with error: %s", aws_error_debug_str(aws_last_error()));
+    ASSERT_SUCCESS(aws_event_loop_run(loop_b));
+
+    struct aws_channel *channel = NULL;
+
+    struct channel_setup_test_args test_args = {
+        .error_code = 0,
+        .mutex = AWS_MUTEX_INIT,
+        .condition_variable = AWS_CONDITION_VARIABLE_INIT,
+        .setup_completed = false,
+        .shutdown_completed = false,
+    };
+
+    struct aws_channel_options args = {
+        .on_setup_completed = s_channel_setup_test_on_setup_completed,
+        .setup_user_data = &test_args,
+        .on_shutdown_completed = NULL,
+        .shutdown_user_data = NULL,
+        .event_loop = loop_a,
+    };
+
+    ASSERT_SUCCESS(s_channel_setup_create_and_wait(allocator, &args, &test_args, &channel));
+    ASSERT_PTR_EQUALS(loop_a, aws_channel_get_event_loop(channel));
+
+    struct channel_migration_test_args migration_args = {
+        .mutex = AWS_MUTEX_INIT,
+        .condition_variable = AWS_CONDITION_VARIABLE_INIT,
+        .destination_loop = loop_b,
+    };
+
+    /* migrating to the loop the channel is already on is refused outright */
+    ASSERT_ERROR(AWS_ERROR_INVALID_ARGUMENT, aws_channel_migrate(channel, loop_a, NULL, NULL));
+
+    ASSERT_SUCCESS(aws_channel_migrate(channel, loop_b, s_channel_migration_test_on_completed, &migration_args));
+
+    ASSERT_SUCCESS(aws_mutex_lock(&migration_args.mutex));
+    ASSERT_SUCCESS(aws_condition_variable_wait_pred(
+        &migration_args.condition_variable,
+        &migration_args.mutex,
+        s_channel_migration_completed_predicate,
+        &migration_args));
+    ASSERT_INT_EQUALS(0, migration_args.migration_error_code);
+    ASSERT_SUCCESS(aws_mutex_unlock(&migration_args.mutex));
+
+    ASSERT_PTR_EQUALS(loop_b, aws_channel_get_event_loop(channel));
+
+    /* tasks scheduled after the move run on the destination loop's thread */
+    struct aws_channel_task task;
+    aws_channel_task_init(&task, s_channel_migration_test_task, &migration_args, "channel_migration_test_task");
+    aws_channel_schedule_task_now(channel, &task);
+
+    ASSERT_SUCCESS(aws_mutex_lock(&migration_args.mutex));
+    ASSERT_SUCCESS(aws_condition_variable_wait_pred(
+        &migration_args.condition_variable,
+        &migration_args.mutex,
+        s_channel_migration_task_predicate,
+        &migration_args));
+    ASSERT_TRUE(migration_args.task_ran_on_destination);
+    ASSERT_SUCCESS(aws_mutex_unlock(&migration_args.mutex));
+
+    aws_channel_destroy(channel);
+    aws_event_loop_destroy(loop_b);
+    aws_event_loop_destroy(loop_a);
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(channel_migrate_between_loops, s_test_channel_migrate_between_loops)
+
+struct cpu_stats_capture_handler_impl {
+    struct aws_allocator *allocator;
+    struct aws_crt_statistics_channel channel_stats;
+    bool channel_record_seen;
+};
+
+static void s_cpu_stats_capture_process_statistics(
+    struct aws_crt_statistics_handler *handler,
+    struct aws_crt_statistics_sample_interval *interval,
+    struct aws_array_list *stats_list,
+    void *context) {
+    (void)interval;
+    (void)context;
+
+    struct cpu_stats_capture_handler_impl *impl = handler->impl;
+
+    size_t stats_count = aws_array_list_length(stats_list);
+    for (size_t i = 0; i < stats_count; ++i) {
+        struct aws_crt_statistics_base *base = NULL;
+        aws_array_list_get_at(stats_list, &base, i);
+        if (base->category == (aws_crt_statistics_category_t)AWSCRT_STAT_CAT_CHANNEL) {
+            impl->channel_stats = *(struct aws_crt_statistics_channel *)base;
+            impl->channel_record_seen = true;
+        }
+    }
+}
+
+static void s_cpu_stats_capture_destroy(struct aws_crt_statistics_handler *handler) {
+    struct cpu_stats_capture_handler_impl *impl = handler->impl;
+    struct aws_allocator *allocator = impl->allocator;
+    aws_mem_release(allocator, impl);
+    aws_mem_release(allocator, handler);
+}
+
+static uint64_t s_cpu_stats_capture_get_report_interval_ms(struct aws_crt_statistics_handler *handler) {
+    (void)handler;
+    return 10;
+}
+
+static struct aws_crt_statistics_handler_vtable s_cpu_stats_capture_vtable = {
+    .process_statistics = s_cpu_stats_capture_process_statistics,
+    .destroy = s_cpu_stats_capture_destroy,
+    .get_report_interval_ms = s_cpu_stats_capture_get_report_interval_ms,
+};
+
+static void s_cpu_stats_noop_channel_task(struct aws_channel_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    (void)arg;
+    (void)status;
+}
+
+static int s_test_channel_cpu_time_statistics(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    testing_channel_set_virtual_time(0);
+
+    struct aws_testing_channel_options test_channel_options = {.clock_fn = testing_channel_virtual_clock};
+    struct testing_channel testing_channel;
+    ASSERT_SUCCESS(testing_channel_init(&testing_channel, allocator, &test_channel_options));
+    ASSERT_SUCCESS(testing_channel_install_downstream_handler(&testing_channel, SIZE_MAX));
+
+    struct aws_crt_statistics_handler *stats_handler =
+        aws_mem_calloc(allocator, 1, sizeof(struct aws_crt_statistics_handler));
+    struct cpu_stats_capture_handler_impl *stats_impl =
+        aws_mem_calloc(allocator, 1, sizeof(struct cpu_stats_capture_handler_impl));
+    stats_impl->allocator = allocator;
+    stats_handler->vtable = &s_cpu_stats_capture_vtable;
+    stats_handler->allocator = allocator;
+    stats_handler->impl = stats_impl;
+
+    ASSERT_SUCCESS(aws_channel_set_statistics_handler(testing_channel.channel, stats_handler));
+
+    /* one message dispatched through the pipeline and one channel task executed */
+    char payload[512];
+    memset(payload, 'x', sizeof(payload));
+    ASSERT_SUCCESS(
+        testing_channel_push_read_data(&testing_channel, aws_byte_cursor_from_array(payload, sizeof(payload))));
+
+    struct aws_channel_task noop_task;
+    aws_channel_task_init(&noop_task, s_cpu_stats_noop_channel_task, NULL, "cpu_stats_noop");
+    aws_channel_schedule_task_now(testing_channel.channel, &noop_task);
+    testing_channel_drain_queued_tasks(&testing_channel);
+
+    testing_channel_advance_virtual_time(&testing_channel, 10000000 /* 10ms */);
+
+    ASSERT_TRUE(stats_impl->channel_record_seen);
+    /* the message passed through two slots but nested dispatch counts once */
+    ASSERT_UINT_EQUALS(1, stats_impl->channel_stats.message_processing_count);
+    ASSERT_TRUE(stats_impl->channel_stats.task_execution_count >= 1);
+
+    /* counters reset each interval: an idle interval reports zeros */
+    stats_impl->channel_record_seen = false;
+    testing_channel_advance_virtual_time(&testing_channel, 20000000 /* 20ms: comfortably past the next report */);
+    ASSERT_TRUE(stats_impl->channel_record_seen);
+    ASSERT_UINT_EQUALS(0, stats_impl->channel_stats.message_processing_count);
+    ASSERT_UINT_EQUALS(0, stats_impl->channel_stats.task_execution_count);
+
+    /* drain the delivered message so clean-up doesn't leak it */
+    struct aws_byte_buf scratch;
+    ASSERT_SUCCESS(aws_byte_buf_init(&scratch, allocator, 512));
+    ASSERT_SUCCESS(testing_channel_drain_messages(testing_channel_get_read_message_queue(&testing_channel), &scratch));
+    aws_byte_buf_clean_up(&scratch);
+
+    ASSERT_SUCCESS(testing_channel_clean_up(&testing_channel));
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(channel_cpu_time_statistics, s_test_channel_cpu_time_statistics)
+
+static int s_test_channel_statistics_aggregate_only(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    testing_channel_set_virtual_time(0);
+
+    struct aws_testing_channel_options test_channel_options = {
+        .clock_fn = testing_channel_virtual_clock,
+        .statistics_mode = AWS_CHANNEL_STATS_AGGREGATE_ONLY,
+    };
+    struct testing_channel testing_channel;
+    ASSERT_SUCCESS(testing_channel_init(&testing_channel, allocator, &test_channel_options));
+    ASSERT_SUCCESS(testing_channel_install_downstream_handler(&testing_channel, SIZE_MAX));
+
+    struct aws_crt_statistics_handler *stats_handler =
+        aws_mem_calloc(allocator, 1, sizeof(struct aws_crt_statistics_handler));
+    struct counting_stats_handler_impl *stats_impl =
+        aws_mem_calloc(allocator, 1, sizeof(struct counting_stats_handler_impl));
+    stats_impl->allocator = allocator;
+    stats_handler->vtable = &s_counting_stats_vtable;
+    stats_handler->allocator = allocator;
+    stats_handler->impl = stats_impl;
+
+    ASSERT_SUCCESS(aws_channel_set_statistics_handler(testing_channel.channel, stats_handler));
+
+    /* one message dispatched through the pipeline and one channel task executed */
+    char payload[512];
+    memset(payload, 'x', sizeof(payload));
+    ASSERT_SUCCESS(
+        testing_channel_push_read_data(&testing_channel, aws_byte_cursor_from_array(payload, sizeof(payload))));
+
+    struct aws_channel_task noop_task;
+    aws_channel_task_init(&noop_task, s_cpu_stats_noop_channel_task, NULL, "aggregate_stats_noop");
+    aws_channel_schedule_task_now(testing_channel.channel, &noop_task);
+    testing_channel_drain_queued_tasks(&testing_channel);
+
+    /* aggregate-only channels never report individually, no matter how much time passes */
+    for (size_t i = 0; i < 15; ++i) {
+        testing_channel_advance_virtual_time(&testing_channel, 10000000 /* 10ms */);
+    }
+    ASSERT_UINT_EQUALS(0, stats_impl->report_count);
+
+    /* their dispatch counts land in the loop's rollup instead */
+    struct aws_crt_statistics_channel aggregate_stats;
+    uint64_t aggregate_channel_count = 0;
+    ASSERT_SUCCESS(
+        aws_channel_fetch_aggregate_statistics(testing_channel.loop, &aggregate_stats, &aggregate_channel_count));
+    ASSERT_UINT_EQUALS(1, aggregate_channel_count);
+    ASSERT_UINT_EQUALS(1, aggregate_stats.message_processing_count);
+    ASSERT_TRUE(aggregate_stats.task_execution_count >= 1);
+
+    /* fetching resets the rollup */
+    ASSERT_SUCCESS(aws_channel_fetch_aggregate_statistics(testing_channel.loop, &aggregate_stats, NULL));
+    ASSERT_UINT_EQUALS(0, aggregate_stats.message_processing_count);
+    ASSERT_UINT_EQUALS(0, aggregate_stats.task_execution_count);
+
+    /* drain the delivered message so clean-up doesn't leak it */
+    struct aws_byte_buf scratch;
+    ASSERT_SUCCESS(aws_byte_buf_init(&scratch, allocator, 512));
+    ASSERT_SUCCESS(testing_channel_drain_messages(testing_channel_get_read_message_queue(&testing_channel), &scratch));
+    aws_byte_buf_clean_up(&scratch);
+
+    ASSERT_SUCCESS(testing_channel_clean_up(&testing_channel));
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(channel_statistics_aggregate_only, s_test_channel_statistics_aggregate_only)
+
+static int s_test_channel_deferred_write_flush(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_testing_channel_options test_channel_options = {
+        .clock_fn = aws_high_res_clock_get_ticks,
+        .enable_deferred_write_flush = true,
+    };
+    struct testing_channel testing_channel;
+    ASSERT_SUCCESS(testing_channel_init(&testing_channel, allocator, &test_channel_options));
+    ASSERT_SUCCESS(testing_channel_install_downstream_handler(&testing_channel, SIZE_MAX));
+    testing_channel_drain_queued_tasks(&testing_channel);
+
+    /* several messages produced in one tick stay parked on the sending slot... */
+    const char *payloads[] = {"first", "second", "third"};
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(payloads); ++i) {
+        struct aws_io_message *msg =
+            aws_channel_acquire_message_from_pool(testing_channel.channel, AWS_IO_MESSAGE_APPLICATION_DATA, 64);
+        ASSERT_NOT_NULL(msg);
+        struct aws_byte_cursor payload = aws_byte_cursor_from_c_str(payloads[i]);
+        ASSERT_TRUE(aws_byte_buf_write_from_whole_cursor(&msg->message_data, payload));
+        ASSERT_SUCCESS(testing_channel_push_write_message(&testing_channel, msg));
+    }
+    ASSERT_TRUE(aws_linked_list_empty(testing_channel_get_written_message_queue(&testing_channel)));
+
+    /* ...and arrive together, in order, once the tick-end flush runs */
+    testing_channel_drain_queued_tasks(&testing_channel);
+    ASSERT_SUCCESS(testing_channel_check_written_messages_str(&testing_channel, allocator, "firstsecondthird"));
+
+    ASSERT_SUCCESS(testing_channel_clean_up(&testing_channel));
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(channel_deferred_write_flush, s_test_channel_deferred_write_flush)
+
+static void s_on_idle_timeout_fired(struct aws_channel *channel, void *user_data) {
+    (void)channel;
+    int *fire_count = user_data;
+    (*fire_count)++;
+}
+
+static int s_test_channel_idle_timeout(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    testing_channel_set_virtual_time(0);
+
+    struct aws_testing_channel_options test_channel_options = {.clock_fn = testing_channel_virtual_clock};
+    struct testing_channel testing_channel;
+    ASSERT_SUCCESS(testing_channel_init(&testing_channel, allocator, &test_channel_options));
+
+    int fire_count = 0;
+    ASSERT_SUCCESS(aws_channel_set_idle_timeout(testing_channel.channel, 3000, s_on_idle_timeout_fired, &fire_count));
+
+    /* periodic activity keeps deferring the deadline, even though each touch is just a flag store */
+    for (size_t i = 0; i < 5; ++i) {
+        aws_channel_touch_idle_timeout(testing_channel.channel);
+        testing_channel_advance_virtual_time(&testing_channel, 2000000000ULL /* 2s */);
+        ASSERT_INT_EQUALS(0, fire_count);
+    }
+
+    /* once the activity stops, the timeout fires within a tick of the coarse deadline */
+    for (size_t i = 0; i < 5; ++i) {
+        testing_channel_advance_virtual_time(&testing_channel, 1000000000ULL /* 1s */);
+    }
+    ASSERT_INT_EQUALS(1, fire_count);
+
+    /* one-shot: the timeout disarmed itself before firing */
+    for (size_t i = 0; i < 5; ++i) {
+        testing_channel_advance_virtual_time(&testing_channel, 1000000000ULL /* 1s */);
+    }
+    ASSERT_INT_EQUALS(1, fire_count);
+
+    ASSERT_SUCCESS(testing_channel_clean_up(&testing_channel));
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(channel_idle_timeout, s_test_channel_idle_timeout)
+
+static int s_test_memory_pool_hugepage_backed(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    enum {
+        SEGMENT_COUNT = 4,
+        SEGMENT_SIZE = 16 * 1024,
+    };
+
+    struct aws_memory_pool pool;
+    ASSERT_SUCCESS(aws_memory_pool_init_ex(&pool, allocator, SEGMENT_COUNT, SEGMENT_SIZE, true /*hugepage_backed*/));
+
+    /* drain the warm segments and push past them into the fallback path */
+    void *segments[SEGMENT_COUNT + 2];
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(segments); ++i) {
+        segments[i] = aws_memory_pool_acquire(&pool);
+        ASSERT_NOT_NULL(segments[i]);
+        /* every segment must be fully writable, slab-carved or not */
+        memset(segments[i], 0xAB, SEGMENT_SIZE);
+        for (size_t j = 0; j < i; ++j) {
+            ASSERT_TRUE(segments[i] != segments[j]);
+        }
+    }
+
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(segments); ++i) {
+        aws_memory_pool_release(&pool, segments[i]);
+    }
+
+    aws_memory_pool_clean_up(&pool);
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(memory_pool_hugepage_backed, s_test_memory_pool_hugepage_backed)
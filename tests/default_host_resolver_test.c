@@ -1537,3 +1537,195 @@ static int s_test_resolver_low_frequency_starvation_fn(struct aws_allocator *all
 }
 
 AWS_TEST_CASE(test_resolver_low_frequency_starvation, s_test_resolver_low_frequency_starvation_fn)
+
+struct listener_test_callback_data {
+    struct aws_mutex *mutex;
+    struct aws_condition_variable condition_variable;
+    size_t batch_count;
+    uint64_t last_epoch;
+    size_t last_new_count;
+    size_t last_expired_count;
+    bool shutdown_invoked;
+};
+
+static void s_listener_test_on_address_batch(
+    struct aws_host_listener *listener,
+    const struct aws_array_list *new_addresses,
+    const struct aws_array_list *expired_addresses,
+    uint64_t address_epoch,
+    void *user_data) {
+
+    (void)listener;
+
+    struct listener_test_callback_data *callback_data = user_data;
+
+    aws_mutex_lock(callback_data->mutex);
+    ++callback_data->batch_count;
+    callback_data->last_epoch = address_epoch;
+    callback_data->last_new_count = aws_array_list_length(new_addresses);
+    callback_data->last_expired_count = aws_array_list_length(expired_addresses);
+    aws_mutex_unlock(callback_data->mutex);
+    aws_condition_variable_notify_one(&callback_data->condition_variable);
+}
+
+static void s_listener_test_on_shutdown(void *user_data) {
+    struct listener_test_callback_data *callback_data = user_data;
+
+    aws_mutex_lock(callback_data->mutex);
+    callback_data->shutdown_invoked = true;
+    aws_mutex_unlock(callback_data->mutex);
+    aws_condition_variable_notify_one(&callback_data->condition_variable);
+}
+
+static bool s_listener_test_received_batch_pred(void *arg) {
+    struct listener_test_callback_data *callback_data = arg;
+
+    return callback_data->batch_count >= 1;
+}
+
+static bool s_listener_test_received_several_batches_pred(void *arg) {
+    struct listener_test_callback_data *callback_data = arg;
+
+    return callback_data->batch_count >= 3;
+}
+
+static bool s_listener_test_shutdown_pred(void *arg) {
+    struct listener_test_callback_data *callback_data = arg;
+
+    return callback_data->shutdown_invoked;
+}
+
+static int s_test_resolver_listener_address_batches_fn(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_io_library_init(allocator);
+
+    struct aws_event_loop_group *el_group = aws_event_loop_group_new_default(allocator, 1, NULL);
+
+    struct aws_host_resolver_default_options resolver_options = {
+        .el_group = el_group,
+        .max_entries = 10,
+    };
+    struct aws_host_resolver *resolver = aws_host_resolver_new_default(allocator, &resolver_options);
+
+    const struct aws_string *host_name = aws_string_new_from_c_str(allocator, "host_address");
+
+    const struct aws_string *addr1_ipv4 = aws_string_new_from_c_str(allocator, "address1ipv4");
+    const struct aws_string *addr1_ipv6 = aws_string_new_from_c_str(allocator, "address1ipv6");
+
+    /* every resolve returns the same pair, so only the first refresh changes the address set */
+    struct mock_dns_resolver mock_resolver;
+    ASSERT_SUCCESS(mock_dns_resolver_init(&mock_resolver, 1000, allocator));
+
+    struct aws_host_resolution_config config = {
+        .max_ttl = 30,
+        .impl = mock_dns_resolve,
+        .impl_data = &mock_resolver,
+        .resolve_frequency_ns = aws_timestamp_convert(100, AWS_TIMESTAMP_MILLIS, AWS_TIMESTAMP_NANOS, NULL),
+    };
+
+    struct aws_host_address host_address_1_ipv4 = {
+        .address = addr1_ipv4,
+        .allocator = allocator,
+        .expiry = 0,
+        .host = aws_string_new_from_c_str(allocator, "host_address"),
+        .connection_failure_count = 0,
+        .record_type = AWS_ADDRESS_RECORD_TYPE_A,
+        .use_count = 0,
+        .weight = 0,
+    };
+
+    struct aws_host_address host_address_1_ipv6 = {
+        .address = addr1_ipv6,
+        .allocator = allocator,
+        .expiry = 0,
+        .host = aws_string_new_from_c_str(allocator, "host_address"),
+        .connection_failure_count = 0,
+        .record_type = AWS_ADDRESS_RECORD_TYPE_AAAA,
+        .use_count = 0,
+        .weight = 0,
+    };
+
+    struct aws_array_list address_list_1;
+    ASSERT_SUCCESS(aws_array_list_init_dynamic(&address_list_1, allocator, 2, sizeof(struct aws_host_address)));
+    ASSERT_SUCCESS(aws_array_list_push_back(&address_list_1, &host_address_1_ipv6));
+    ASSERT_SUCCESS(aws_array_list_push_back(&address_list_1, &host_address_1_ipv4));
+    ASSERT_SUCCESS(mock_dns_resolver_append_address_list(&mock_resolver, &address_list_1));
+
+    struct aws_mutex mutex = AWS_MUTEX_INIT;
+    struct listener_test_callback_data listener_callback_data = {
+        .mutex = &mutex,
+        .condition_variable = AWS_CONDITION_VARIABLE_INIT,
+    };
+
+    struct aws_host_listener_options listener_options = {
+        .host_name = aws_byte_cursor_from_string(host_name),
+        .on_address_batch = s_listener_test_on_address_batch,
+        .on_shutdown = s_listener_test_on_shutdown,
+        .user_data = &listener_callback_data,
+    };
+
+    struct aws_host_listener *listener = aws_host_resolver_add_host_listener(resolver, &listener_options);
+    ASSERT_NOT_NULL(listener);
+
+    struct default_host_callback_data callback_data = {
+        .condition_variable = AWS_CONDITION_VARIABLE_INIT,
+        .invoked = false,
+        .has_aaaa_address = false,
+        .has_a_address = false,
+        .mutex = &mutex,
+    };
+
+    ASSERT_SUCCESS(aws_host_resolver_resolve_host(
+        resolver, host_name, s_default_host_resolved_test_callback, &config, &callback_data));
+
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    aws_condition_variable_wait_pred(
+        &callback_data.condition_variable, &mutex, s_default_host_resolved_predicate, &callback_data);
+
+    aws_host_address_clean_up(&callback_data.aaaa_address);
+    aws_host_address_clean_up(&callback_data.a_address);
+
+    /* the first refresh delivers both records as a single batch and establishes epoch 1 */
+    aws_condition_variable_wait_pred(
+        &listener_callback_data.condition_variable, &mutex, s_listener_test_received_batch_pred, &listener_callback_data);
+
+    ASSERT_UINT_EQUALS(1, listener_callback_data.last_epoch);
+    ASSERT_UINT_EQUALS(2, listener_callback_data.last_new_count);
+    ASSERT_UINT_EQUALS(0, listener_callback_data.last_expired_count);
+
+    /*
+     * Subsequent refreshes return the same records: each still produces exactly one callback, but with empty
+     * deltas and an unchanged epoch, so a consumer comparing epochs can skip them outright.
+     */
+    aws_condition_variable_wait_pred(
+        &listener_callback_data.condition_variable,
+        &mutex,
+        s_listener_test_received_several_batches_pred,
+        &listener_callback_data);
+
+    ASSERT_UINT_EQUALS(1, listener_callback_data.last_epoch);
+    ASSERT_UINT_EQUALS(0, listener_callback_data.last_new_count);
+    ASSERT_UINT_EQUALS(0, listener_callback_data.last_expired_count);
+
+    aws_mutex_unlock(&mutex);
+
+    ASSERT_SUCCESS(aws_host_resolver_remove_host_listener(resolver, listener));
+
+    aws_mutex_lock(&mutex);
+    aws_condition_variable_wait_pred(
+        &listener_callback_data.condition_variable, &mutex, s_listener_test_shutdown_pred, &listener_callback_data);
+    aws_mutex_unlock(&mutex);
+
+    aws_host_resolver_release(resolver);
+    aws_string_destroy((void *)host_name);
+    aws_event_loop_group_release(el_group);
+
+    aws_io_library_clean_up();
+
+    mock_dns_resolver_clean_up(&mock_resolver);
+
+    return 0;
+}
+
+AWS_TEST_CASE(test_resolver_listener_address_batches, s_test_resolver_listener_address_batches_fn)
@@ -1066,6 +1066,41 @@ static int test_event_loop_group_setup_and_shutdown(struct aws_allocator *alloca
 
 AWS_TEST_CASE(event_loop_group_setup_and_shutdown, test_event_loop_group_setup_and_shutdown)
 
+static int test_event_loop_group_grow_and_shrink(struct aws_allocator *allocator, void *ctx) {
+
+    (void)ctx;
+    aws_io_library_init(allocator);
+
+    struct aws_event_loop_group *event_loop_group = aws_event_loop_group_new_default(allocator, 1, NULL);
+    ASSERT_NOT_NULL(event_loop_group);
+    ASSERT_UINT_EQUALS(1, aws_event_loop_group_get_loop_count(event_loop_group));
+
+    ASSERT_SUCCESS(aws_event_loop_group_grow(event_loop_group, 2));
+    ASSERT_UINT_EQUALS(3, aws_event_loop_group_get_loop_count(event_loop_group));
+
+    /* the grown loops are running and selectable */
+    for (size_t i = 0; i < 3; ++i) {
+        ASSERT_NOT_NULL(aws_event_loop_group_get_loop_at(event_loop_group, i));
+    }
+    ASSERT_NOT_NULL(aws_event_loop_group_get_next_loop(event_loop_group));
+
+    /* the last loop can never be retired */
+    ASSERT_ERROR(AWS_ERROR_INVALID_ARGUMENT, aws_event_loop_group_shrink(event_loop_group, 3));
+
+    ASSERT_SUCCESS(aws_event_loop_group_shrink(event_loop_group, 2));
+    ASSERT_UINT_EQUALS(1, aws_event_loop_group_get_loop_count(event_loop_group));
+    ASSERT_NOT_NULL(aws_event_loop_group_get_next_loop(event_loop_group));
+
+    /* retired loops are destroyed with the group */
+    aws_event_loop_group_release(event_loop_group);
+
+    aws_io_library_clean_up();
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(event_loop_group_grow_and_shrink, test_event_loop_group_grow_and_shrink)
+
 static int test_numa_aware_event_loop_group_setup_and_shutdown(struct aws_allocator *allocator, void *ctx) {
 
     (void)ctx;
@@ -327,3 +327,75 @@ static int s_test_exponential_backoff_retry_invalid_options_fn(struct aws_alloca
     return AWS_OP_SUCCESS;
 }
 AWS_TEST_CASE(test_exponential_backoff_retry_invalid_options, s_test_exponential_backoff_retry_invalid_options_fn)
+
+struct pinned_acquire_test_data {
+    struct aws_event_loop *pinned_loop;
+    struct aws_retry_token *token;
+    bool on_pinned_loop_thread;
+    bool callback_invoked;
+    struct aws_mutex mutex;
+    struct aws_condition_variable cvar;
+};
+
+static void s_pinned_acquire_on_token_acquired(
+    struct aws_retry_strategy *retry_strategy,
+    int error_code,
+    struct aws_retry_token *token,
+    void *user_data) {
+    (void)retry_strategy;
+    (void)error_code;
+
+    struct pinned_acquire_test_data *test_data = user_data;
+    aws_mutex_lock(&test_data->mutex);
+    test_data->token = token;
+    test_data->on_pinned_loop_thread = aws_event_loop_thread_is_callers_thread(test_data->pinned_loop);
+    test_data->callback_invoked = true;
+    aws_mutex_unlock(&test_data->mutex);
+    aws_condition_variable_notify_all(&test_data->cvar);
+}
+
+static bool s_pinned_acquire_completed(void *arg) {
+    struct pinned_acquire_test_data *test_data = arg;
+    return test_data->callback_invoked;
+}
+
+/* verify that a pinned acquisition vends the token on the designated event loop's thread. */
+static int s_test_exponential_backoff_retry_pinned_acquire_fn(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_io_library_init(allocator);
+
+    struct aws_event_loop_group *el_group = aws_event_loop_group_new_default(allocator, 2, NULL);
+    struct aws_exponential_backoff_retry_options config = {
+        .max_retries = 3,
+        .el_group = el_group,
+    };
+
+    struct aws_retry_strategy *retry_strategy = aws_retry_strategy_new_exponential_backoff(allocator, &config);
+    ASSERT_NOT_NULL(retry_strategy);
+
+    struct pinned_acquire_test_data test_data = {
+        .pinned_loop = aws_event_loop_group_get_next_loop(el_group),
+        .mutex = AWS_MUTEX_INIT,
+        .cvar = AWS_CONDITION_VARIABLE_INIT,
+    };
+
+    ASSERT_SUCCESS(aws_mutex_lock(&test_data.mutex));
+    ASSERT_SUCCESS(aws_retry_strategy_acquire_retry_token_pinned(
+        retry_strategy, NULL, s_pinned_acquire_on_token_acquired, &test_data, 0, test_data.pinned_loop));
+    ASSERT_SUCCESS(
+        aws_condition_variable_wait_pred(&test_data.cvar, &test_data.mutex, s_pinned_acquire_completed, &test_data));
+    aws_mutex_unlock(&test_data.mutex);
+
+    ASSERT_NOT_NULL(test_data.token);
+    ASSERT_TRUE(test_data.on_pinned_loop_thread);
+
+    aws_retry_token_release(test_data.token);
+    aws_retry_strategy_release(retry_strategy);
+    aws_event_loop_group_release(el_group);
+
+    aws_io_library_clean_up();
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_exponential_backoff_retry_pinned_acquire, s_test_exponential_backoff_retry_pinned_acquire_fn)
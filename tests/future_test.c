@@ -760,3 +760,108 @@ static int s_test_future_set_error(struct aws_allocator *alloc, void *ctx) {
     return 0;
 }
 AWS_TEST_CASE(future_set_error, s_test_future_set_error)
+
+static int s_test_future_when_all(struct aws_allocator *alloc, void *ctx) {
+    (void)ctx;
+    aws_io_library_init(alloc);
+
+    struct aws_future_bool *a = aws_future_bool_new(alloc);
+    struct aws_future_bool *b = aws_future_bool_new(alloc);
+    struct aws_future_impl *inputs[] = {(struct aws_future_impl *)a, (struct aws_future_impl *)b};
+
+    struct aws_future_void *all = aws_future_when_all(alloc, inputs, 2);
+    ASSERT_NOT_NULL(all);
+    ASSERT_FALSE(aws_future_void_is_done(all));
+
+    /* not done until every input is done */
+    aws_future_bool_set_result(a, true);
+    ASSERT_FALSE(aws_future_void_is_done(all));
+
+    aws_future_bool_set_result(b, false);
+    ASSERT_TRUE(aws_future_void_is_done(all));
+    ASSERT_INT_EQUALS(0, aws_future_void_get_error(all));
+
+    aws_future_void_release(all);
+
+    /* first error observed wins */
+    struct aws_future_bool *c = aws_future_bool_new(alloc);
+    struct aws_future_bool *d = aws_future_bool_new(alloc);
+    struct aws_future_impl *inputs2[] = {(struct aws_future_impl *)c, (struct aws_future_impl *)d};
+
+    struct aws_future_void *all2 = aws_future_when_all(alloc, inputs2, 2);
+    aws_future_bool_set_error(c, 999);
+    ASSERT_FALSE(aws_future_void_is_done(all2));
+    aws_future_bool_set_error(d, 222);
+    ASSERT_TRUE(aws_future_void_is_done(all2));
+    ASSERT_INT_EQUALS(999, aws_future_void_get_error(all2));
+
+    aws_future_void_release(all2);
+    aws_future_bool_release(a);
+    aws_future_bool_release(b);
+    aws_future_bool_release(c);
+    aws_future_bool_release(d);
+
+    /* an empty array is a usage error */
+    ASSERT_NULL(aws_future_when_all(alloc, NULL, 0));
+    ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+
+    aws_io_library_clean_up();
+    return 0;
+}
+AWS_TEST_CASE(future_when_all, s_test_future_when_all)
+
+static int s_test_future_when_any(struct aws_allocator *alloc, void *ctx) {
+    (void)ctx;
+    aws_io_library_init(alloc);
+
+    /* first successful input claims the win, later completions are ignored */
+    struct aws_future_bool *a = aws_future_bool_new(alloc);
+    struct aws_future_bool *b = aws_future_bool_new(alloc);
+    struct aws_future_impl *inputs[] = {(struct aws_future_impl *)a, (struct aws_future_impl *)b};
+
+    struct aws_future_size *any = aws_future_when_any(alloc, inputs, 2);
+    ASSERT_NOT_NULL(any);
+    ASSERT_FALSE(aws_future_size_is_done(any));
+
+    /* a failure alone doesn't complete it while others are still pending */
+    aws_future_bool_set_error(a, 999);
+    ASSERT_FALSE(aws_future_size_is_done(any));
+
+    aws_future_bool_set_result(b, true);
+    ASSERT_TRUE(aws_future_size_is_done(any));
+    ASSERT_INT_EQUALS(0, aws_future_size_get_error(any));
+    ASSERT_UINT_EQUALS(1, aws_future_size_get_result(any));
+
+    aws_future_size_release(any);
+
+    /* if every input fails, the last error to arrive is reported */
+    struct aws_future_bool *c = aws_future_bool_new(alloc);
+    struct aws_future_bool *d = aws_future_bool_new(alloc);
+    struct aws_future_impl *inputs2[] = {(struct aws_future_impl *)c, (struct aws_future_impl *)d};
+
+    struct aws_future_size *any2 = aws_future_when_any(alloc, inputs2, 2);
+    aws_future_bool_set_error(c, 999);
+    aws_future_bool_set_error(d, 222);
+    ASSERT_TRUE(aws_future_size_is_done(any2));
+    ASSERT_INT_EQUALS(222, aws_future_size_get_error(any2));
+
+    aws_future_size_release(any2);
+    aws_future_bool_release(a);
+    aws_future_bool_release(b);
+    aws_future_bool_release(c);
+    aws_future_bool_release(d);
+
+    /* inputs that are already done complete the combinator during creation */
+    struct aws_future_bool *e = aws_future_bool_new(alloc);
+    aws_future_bool_set_result(e, true);
+    struct aws_future_impl *inputs3[] = {(struct aws_future_impl *)e};
+    struct aws_future_size *any3 = aws_future_when_any(alloc, inputs3, 1);
+    ASSERT_TRUE(aws_future_size_is_done(any3));
+    ASSERT_UINT_EQUALS(0, aws_future_size_get_result(any3));
+    aws_future_size_release(any3);
+    aws_future_bool_release(e);
+
+    aws_io_library_clean_up();
+    return 0;
+}
+AWS_TEST_CASE(future_when_any, s_test_future_when_any)
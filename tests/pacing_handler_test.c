@@ -0,0 +1,192 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/io/pacing_channel_handler.h>
+
+#include <aws/io/channel.h>
+#include <aws/testing/aws_test_harness.h>
+#include <aws/testing/io_testing_channel.h>
+
+static size_t s_count_messages(struct aws_linked_list *messages) {
+    size_t count = 0;
+    for (struct aws_linked_list_node *node = aws_linked_list_begin(messages); node != aws_linked_list_end(messages);
+         node = aws_linked_list_next(node)) {
+        ++count;
+    }
+    return count;
+}
+
+static int s_install_pacing_handler(
+    struct aws_allocator *allocator,
+    struct testing_channel *testing,
+    const struct aws_pacing_handler_options *options) {
+
+    struct aws_channel_slot *slot = aws_channel_slot_new(testing->channel);
+    ASSERT_NOT_NULL(slot);
+    ASSERT_SUCCESS(aws_channel_slot_insert_right(testing->left_handler_slot, slot));
+
+    struct aws_channel_handler *handler = aws_pacing_handler_new(allocator, options);
+    ASSERT_NOT_NULL(handler);
+    ASSERT_SUCCESS(aws_channel_slot_set_handler(slot, handler));
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_push_write_message(struct testing_channel *testing, uint8_t fill, size_t size) {
+    struct aws_io_message *message =
+        aws_channel_acquire_message_from_pool(testing->channel, AWS_IO_MESSAGE_APPLICATION_DATA, size);
+    ASSERT_NOT_NULL(message);
+    memset(message->message_data.buffer, fill, size);
+    message->message_data.len = size;
+    ASSERT_SUCCESS(testing_channel_push_write_message(testing, message));
+    return AWS_OP_SUCCESS;
+}
+
+/* writes beyond the burst budget queue, and the release timer lets them out at the shaped rate */
+static int s_test_pacing_handler_shapes_writes(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    testing_channel_set_virtual_time(0);
+
+    struct aws_testing_channel_options test_channel_options = {.clock_fn = testing_channel_virtual_clock};
+    struct testing_channel testing_channel;
+    ASSERT_SUCCESS(testing_channel_init(&testing_channel, allocator, &test_channel_options));
+
+    /* 1MB/s refills 1024 bytes (one message) per 1ms release tick */
+    struct aws_pacing_handler_options pacing_options = {
+        .rate_bytes_per_sec = 1000 * 1000,
+        .burst_size_bytes = 1024,
+    };
+    ASSERT_SUCCESS(s_install_pacing_handler(allocator, &testing_channel, &pacing_options));
+    ASSERT_SUCCESS(testing_channel_install_downstream_handler(&testing_channel, SIZE_MAX));
+
+    /* first message rides the initial burst; the next two must wait for tokens */
+    ASSERT_SUCCESS(s_push_write_message(&testing_channel, 'a', 1024));
+    ASSERT_SUCCESS(s_push_write_message(&testing_channel, 'b', 1024));
+    ASSERT_SUCCESS(s_push_write_message(&testing_channel, 'c', 1024));
+    testing_channel_drain_queued_tasks(&testing_channel);
+
+    struct aws_linked_list *written = testing_channel_get_written_message_queue(&testing_channel);
+    ASSERT_UINT_EQUALS(1, s_count_messages(written));
+
+    /* one release tick releases one refill worth */
+    testing_channel_advance_virtual_time(&testing_channel, 1000000 /* 1ms */);
+    ASSERT_UINT_EQUALS(2, s_count_messages(written));
+
+    testing_channel_advance_virtual_time(&testing_channel, 1000000 /* 1ms */);
+    ASSERT_UINT_EQUALS(3, s_count_messages(written));
+
+    /* FIFO order survived the queue */
+    struct aws_byte_buf all_written;
+    ASSERT_SUCCESS(aws_byte_buf_init(&all_written, allocator, 3 * 1024));
+    ASSERT_SUCCESS(testing_channel_drain_written_messages(&testing_channel, &all_written));
+    ASSERT_UINT_EQUALS(3 * 1024, all_written.len);
+    ASSERT_UINT_EQUALS('a', all_written.buffer[0]);
+    ASSERT_UINT_EQUALS('b', all_written.buffer[1024]);
+    ASSERT_UINT_EQUALS('c', all_written.buffer[2048]);
+    aws_byte_buf_clean_up(&all_written);
+
+    ASSERT_SUCCESS(testing_channel_clean_up(&testing_channel));
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(pacing_handler_shapes_writes, s_test_pacing_handler_shapes_writes)
+
+/* a HIGH priority frame overtakes queued bulk data instead of waiting behind it */
+static int s_test_pacing_handler_high_priority_overtakes(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    testing_channel_set_virtual_time(0);
+
+    struct aws_testing_channel_options test_channel_options = {.clock_fn = testing_channel_virtual_clock};
+    struct testing_channel testing_channel;
+    ASSERT_SUCCESS(testing_channel_init(&testing_channel, allocator, &test_channel_options));
+
+    struct aws_pacing_handler_options pacing_options = {
+        .rate_bytes_per_sec = 1000 * 1000,
+        .burst_size_bytes = 1024,
+    };
+    ASSERT_SUCCESS(s_install_pacing_handler(allocator, &testing_channel, &pacing_options));
+    ASSERT_SUCCESS(testing_channel_install_downstream_handler(&testing_channel, SIZE_MAX));
+
+    /* exhaust the bucket and back up a bulk message */
+    ASSERT_SUCCESS(s_push_write_message(&testing_channel, 'a', 1024));
+    ASSERT_SUCCESS(s_push_write_message(&testing_channel, 'b', 1024));
+    testing_channel_drain_queued_tasks(&testing_channel);
+
+    struct aws_linked_list *written = testing_channel_get_written_message_queue(&testing_channel);
+    ASSERT_UINT_EQUALS(1, s_count_messages(written));
+
+    struct aws_io_message *urgent =
+        aws_channel_acquire_message_from_pool(testing_channel.channel, AWS_IO_MESSAGE_APPLICATION_DATA, 16);
+    ASSERT_NOT_NULL(urgent);
+    memset(urgent->message_data.buffer, 'p', 16);
+    urgent->message_data.len = 16;
+    urgent->priority = AWS_IO_MESSAGE_PRIORITY_HIGH;
+    ASSERT_SUCCESS(testing_channel_push_write_message(&testing_channel, urgent));
+    testing_channel_drain_queued_tasks(&testing_channel);
+
+    /* the ping went out ahead of the queued bulk message */
+    ASSERT_UINT_EQUALS(2, s_count_messages(written));
+    struct aws_io_message *last_written =
+        AWS_CONTAINER_OF(aws_linked_list_back(written), struct aws_io_message, queueing_handle);
+    ASSERT_UINT_EQUALS(16, last_written->message_data.len);
+    ASSERT_UINT_EQUALS('p', last_written->message_data.buffer[0]);
+
+    /* the bulk message still drains on the timer */
+    testing_channel_advance_virtual_time(&testing_channel, 2000000 /* 2ms: tokens repaid the overtake too */);
+    ASSERT_UINT_EQUALS(3, s_count_messages(written));
+
+    struct aws_byte_buf scratch;
+    ASSERT_SUCCESS(aws_byte_buf_init(&scratch, allocator, 3 * 1024));
+    ASSERT_SUCCESS(testing_channel_drain_written_messages(&testing_channel, &scratch));
+    aws_byte_buf_clean_up(&scratch);
+
+    ASSERT_SUCCESS(testing_channel_clean_up(&testing_channel));
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(pacing_handler_high_priority_overtakes, s_test_pacing_handler_high_priority_overtakes)
+
+/* graceful shutdown flushes the queued backlog downstream instead of dropping it */
+static int s_test_pacing_handler_shutdown_flushes_queue(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    testing_channel_set_virtual_time(0);
+
+    struct aws_testing_channel_options test_channel_options = {.clock_fn = testing_channel_virtual_clock};
+    struct testing_channel testing_channel;
+    ASSERT_SUCCESS(testing_channel_init(&testing_channel, allocator, &test_channel_options));
+
+    struct aws_pacing_handler_options pacing_options = {
+        .rate_bytes_per_sec = 1000 * 1000,
+        .burst_size_bytes = 1024,
+    };
+    ASSERT_SUCCESS(s_install_pacing_handler(allocator, &testing_channel, &pacing_options));
+    ASSERT_SUCCESS(testing_channel_install_downstream_handler(&testing_channel, SIZE_MAX));
+
+    ASSERT_SUCCESS(s_push_write_message(&testing_channel, 'a', 1024));
+    ASSERT_SUCCESS(s_push_write_message(&testing_channel, 'b', 1024));
+    ASSERT_SUCCESS(s_push_write_message(&testing_channel, 'c', 1024));
+    testing_channel_drain_queued_tasks(&testing_channel);
+
+    struct aws_linked_list *written = testing_channel_get_written_message_queue(&testing_channel);
+    ASSERT_UINT_EQUALS(1, s_count_messages(written));
+
+    /* shut down before the timer ever fires: the two queued messages flush unshaped */
+    aws_channel_shutdown(testing_channel.channel, AWS_ERROR_SUCCESS);
+    testing_channel_drain_queued_tasks(&testing_channel);
+    ASSERT_UINT_EQUALS(3, s_count_messages(written));
+
+    struct aws_byte_buf scratch;
+    ASSERT_SUCCESS(aws_byte_buf_init(&scratch, allocator, 3 * 1024));
+    ASSERT_SUCCESS(testing_channel_drain_written_messages(&testing_channel, &scratch));
+    aws_byte_buf_clean_up(&scratch);
+
+    ASSERT_SUCCESS(testing_channel_clean_up(&testing_channel));
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(pacing_handler_shutdown_flushes_queue, s_test_pacing_handler_shutdown_flushes_queue)
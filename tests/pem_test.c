@@ -1180,3 +1180,101 @@ static int s_test_pem_invalid_in_chain_parse(struct aws_allocator *allocator, vo
 }
 
 AWS_TEST_CASE(test_pem_invalid_in_chain_parse, s_test_pem_invalid_in_chain_parse)
+
+static int s_test_pem_views_parse(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    /* Same chain as s_test_pem_cert_chain_parse plus surrounding comments; the views variant must
+     * produce byte-identical objects to the allocating API, just backed by one arena. */
+    static const char *s_pem_data_str = "# comment before the chain\n"
+                                        "-----BEGIN CERTIFICATE-----\n"
+                                        "MIICrTCCAZUCAn3VMA0GCSqGSIb3DQEBBQUAMB4xHDAaBgNVBAMME3MyblRlc3RJ\n"
+                                        "bnRlcm1lZGlhdGUwIBcNMTYwMzMwMTg1NzQzWhgPMjExNjAzMDYxODU3NDNaMBgx\n"
+                                        "FjAUBgNVBAMMDXMyblRlc3RTZXJ2ZXIwggEiMA0GCSqGSIb3DQEBAQUAA4IBDwAw\n"
+                                        "ggEKAoIBAQDRw6AuYXAeRT0YuptCfJjRB/EDJyyGXnv+8TV2H1WJWhMLk8qND27r\n"
+                                        "79A6EjbVmJaOV9qrokVqpDmXS712Z3BDprJ+1LFMymm3A+AFuK/skeGy0skik+Tg\n"
+                                        "MmFT5XBVvmsw4uB1S9uUqktHauXgjhFPPsfvk4ewL4LulVEN2TEeI1Odj4CaMxAO\n"
+                                        "Iuowm8wI2OHVzRHlrRmyJ9hYGuHHQ2TaTGIjr3WpAFuXi9pHGGMYa0uXAVPmgjdE\n"
+                                        "XZ8t46u/ZKQ9W1uJkZEVKhcijT7G2VBrsBUq0CDiL+TDaGfthnBzUc9zt4fx/S/3\n"
+                                        "qulC2WbKI3xrasQyjrsHTAJ75Md3rK09AgMBAAEwDQYJKoZIhvcNAQEFBQADggEB\n"
+                                        "AHHkXNA9BtgAebZC2zriW4hRfeIkJMOwvfKBXHTuY5iCLD1otis6AZljcCKXM6O9\n"
+                                        "489eHBC4T6mJwVsXhH+/ccEKqNRD2bUfQgOij32PsteV1eOHfHIFqdJmnBVb8tYa\n"
+                                        "jxUvy7UQvXrPqaHbODrHe+7f7r1YCzerujiP5SSHphY3GQq88KemfFczp/4GnYas\n"
+                                        "sE50OYe7DQcB4zvnxmAXp51JIN4ooktUU9oKIM5y2cgEWdmJzeqPANYxf0ZIPlTg\n"
+                                        "ETknKw1Dzf8wlK5mFbbG4LPQh1mkDVcwQV3ogG6kGMRa7neH+6SFkNpAKuPCoje4\n"
+                                        "NAE+WQ5ve1wk7nIRTQwDAF4=\n"
+                                        "-----END CERTIFICATE-----\n"
+                                        "# comment between objects\n"
+                                        "-----BEGIN CERTIFICATE-----\n"
+                                        "MIIDKTCCAhGgAwIBAgICVxYwDQYJKoZIhvcNAQEFBQAwFjEUMBIGA1UEAwwLczJu\n"
+                                        "VGVzdFJvb3QwIBcNMTYwMzMwMTg1NzA5WhgPMjExNjAzMDYxODU3MDlaMB4xHDAa\n"
+                                        "BgNVBAMME3MyblRlc3RJbnRlcm1lZGlhdGUwggEiMA0GCSqGSIb3DQEBAQUAA4IB\n"
+                                        "DwAwggEKAoIBAQDM/i3eclxYcvedPCEnVe6A/HYsYPeP1qKBZQhbpuuX061jFZKw\n"
+                                        "lecb0eau1PORLbcsYK40u3xUzoA5u6Q0ebDuqPbqSJkCazsh66cu9STl8ubbk7oI\n"
+                                        "8LJjUJFhhy2Jmm9krXhPyRscU+CXOCZ2G1GhBqTI8cgMYhEVHwb3qy1EHg6G3n4W\n"
+                                        "AjV+cKQcbUytq8DRmVe0bNJxDOX8ivzfAp3lUIwub+JfpxrWIUhb3iVGj5CauI98\n"
+                                        "bNFHTWwYp7tviIIi21Q+L3nExCyE4yTUP/mebBZ62JnbvsWSs3r3//Am5d8G3WdY\n"
+                                        "BXsERoDoLBvHnqlO/oo4ppGCRI7GkDroACi/AgMBAAGjdzB1MAwGA1UdEwQFMAMB\n"
+                                        "Af8wHQYDVR0OBBYEFGqUKVWVlL03sHuOggFACdlHckPBMEYGA1UdIwQ/MD2AFE2X\n"
+                                        "AbNDryMlBpMNI6Ce927uUFwToRqkGDAWMRQwEgYDVQQDDAtzMm5UZXN0Um9vdIIJ\n"
+                                        "ANDUkH+UYdz1MA0GCSqGSIb3DQEBBQUAA4IBAQA3O3S9VT0EC1yG4xyNNUZ7+CzF\n"
+                                        "uFA6uiO38ygcN5Nz1oNPy2eQer7vYmrHtqN6gS/o1Ag5F8bLRCqeuZTsOG80O29H\n"
+                                        "kNhs5xYprdU82AqcaWwEd0kDrhC5rEvs6fj1J0NKmmhbovYxuDboj0a7If7HEqX0\n"
+                                        "NizyU3M3JONPZgadchZ+F5DosatF1Bpt/gsQRy383IogQ0/FS+juHCCc4VIUemuk\n"
+                                        "YY1J8o5XdrGWrPBBiudTWqCobe+N541b+YLWbajT5UKzvSqJmcqpPTniJGc9eZxc\n"
+                                        "z3cCNd3cKa9bK51stEnQSlA7PQXYs3K+TD3EmSn/G2x6Hmfr7lrpbIhEaD+y\n"
+                                        "-----END CERTIFICATE-----\n"
+                                        "# trailing comment\n";
+
+    struct aws_byte_cursor pem_data = aws_byte_cursor_from_c_str(s_pem_data_str);
+
+    struct aws_array_list object_list;
+    ASSERT_SUCCESS(aws_pem_objects_init_from_file_contents(&object_list, allocator, pem_data));
+
+    struct aws_array_list view_list;
+    struct aws_byte_buf arena;
+    ASSERT_SUCCESS(aws_pem_objects_init_views_from_file_contents(&view_list, &arena, allocator, pem_data));
+
+    ASSERT_UINT_EQUALS(2, aws_array_list_length(&view_list));
+    ASSERT_UINT_EQUALS(aws_array_list_length(&object_list), aws_array_list_length(&view_list));
+
+    for (size_t i = 0; i < aws_array_list_length(&view_list); ++i) {
+        struct aws_pem_object *pem_object = NULL;
+        aws_array_list_get_at_ptr(&object_list, (void **)&pem_object, i);
+        struct aws_pem_object_view *view = NULL;
+        aws_array_list_get_at_ptr(&view_list, (void **)&view, i);
+
+        ASSERT_INT_EQUALS(pem_object->type, view->type);
+        ASSERT_TRUE(aws_string_eq_byte_cursor(pem_object->type_string, &view->type_string));
+        ASSERT_BIN_ARRAYS_EQUALS(pem_object->data.buffer, pem_object->data.len, view->data.ptr, view->data.len);
+
+        /* views must live inside the single arena allocation */
+        ASSERT_TRUE(view->data.ptr >= arena.buffer && view->data.ptr + view->data.len <= arena.buffer + arena.len);
+    }
+
+    aws_pem_object_views_clean_up(&view_list, &arena);
+    aws_pem_objects_clean_up(&object_list);
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_pem_views_parse, s_test_pem_views_parse)
+
+static int s_test_pem_views_invalid_parse(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+    /* Dangling begin header with a truncated body must fail, same as the allocating API. */
+    static const char *s_invalid_pem = "-----BEGIN CERTIFICATE-----\n"
+                                       "MIICrTCCAZUCAn3VMA0GCSqGSIb3DQEBBQUAMB4xHDAaBgNVBAMME3MyblRlc3RJ\n";
+
+    struct aws_byte_cursor pem_data = aws_byte_cursor_from_c_str(s_invalid_pem);
+
+    struct aws_array_list view_list;
+    struct aws_byte_buf arena;
+    ASSERT_ERROR(
+        AWS_ERROR_PEM_MALFORMED, aws_pem_objects_init_views_from_file_contents(&view_list, &arena, allocator, pem_data));
+    ASSERT_UINT_EQUALS(0, aws_array_list_length(&view_list));
+
+    aws_pem_object_views_clean_up(&view_list, &arena);
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_pem_views_invalid_parse, s_test_pem_views_invalid_parse)
@@ -415,6 +415,65 @@ static int test_pipe_read_write_large_buffer(struct pipe_state *state) {
 
 PIPE_TEST_CASE(pipe_read_write_large_buffer, GIANT_BUFFER_SIZE);
 
+#ifndef _WIN32
+static void s_clean_up_write_end_on_write_multiple_completed(
+    struct aws_pipe_write_end *write_end,
+    int error_code,
+    void *user_data) {
+
+    struct pipe_state *state = user_data;
+
+    if (!error_code) {
+        state->buffers.num_bytes_written += state->buffers.src.len;
+    }
+
+    int err = aws_pipe_clean_up_write_end(write_end);
+    if (err) {
+        goto error;
+    }
+
+    s_signal_done_on_write_end_closed(state);
+
+    return;
+error:
+    s_signal_error(state);
+}
+
+/* Split the source buffer into several cursors and send them all with one gathering write */
+static void s_write_multiple_once_task(struct pipe_state *state) {
+    struct aws_byte_cursor whole = aws_byte_cursor_from_buf(&state->buffers.src);
+    struct aws_byte_cursor split[3];
+    size_t chunk = whole.len / 3;
+    split[0] = aws_byte_cursor_advance(&whole, chunk);
+    split[1] = aws_byte_cursor_advance(&whole, chunk);
+    split[2] = whole;
+
+    int err = aws_pipe_write_multiple(
+        &state->write_end, split, AWS_ARRAY_SIZE(split), s_clean_up_write_end_on_write_multiple_completed, state);
+    if (err) {
+        goto error;
+    }
+
+    return;
+error:
+    s_signal_error(state);
+}
+
+/* Test that a gathering write delivers every buffer, in order, with one completion callback */
+static int test_pipe_write_multiple_buffers(struct pipe_state *state) {
+    s_schedule_read_end_task(state, s_read_everything_task);
+    s_schedule_write_end_task(state, s_write_multiple_once_task);
+
+    ASSERT_SUCCESS(s_wait_for_results(state));
+
+    ASSERT_SUCCESS(s_pipe_state_check_copied_data(state));
+
+    return AWS_OP_SUCCESS;
+}
+
+PIPE_TEST_CASE(pipe_write_multiple_buffers, GIANT_BUFFER_SIZE);
+#endif /* _WIN32 */
+
 static void s_on_readable_event(struct aws_pipe_read_end *read_end, int error_code, void *user_data) {
 
     struct pipe_state *state = user_data;
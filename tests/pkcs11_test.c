@@ -457,6 +457,34 @@ static int s_test_pkcs11_lib_sanity_check(struct aws_allocator *allocator, void
 }
 AWS_TEST_CASE(pkcs11_lib_sanity_check, s_test_pkcs11_lib_sanity_check)
 
+/* Load the library on a background thread and block on the future */
+static int s_test_pkcs11_lib_new_async(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+    ASSERT_SUCCESS(s_pkcs11_tester_init_without_load(allocator));
+
+    struct aws_pkcs11_lib_options options = {
+        .filename = aws_byte_cursor_from_string(s_pkcs11_tester.shared_lib_path),
+        .initialize_finalize_behavior = AWS_PKCS11_LIB_STRICT_INITIALIZE_FINALIZE,
+    };
+    struct aws_future_pkcs11_lib *future = aws_pkcs11_lib_new_async(allocator, &options);
+    ASSERT_NOT_NULL(future);
+    ASSERT_TRUE(aws_future_pkcs11_lib_wait(future, TIMEOUT_NANOS));
+    ASSERT_INT_EQUALS(0, aws_future_pkcs11_lib_get_error(future));
+
+    struct aws_pkcs11_lib *lib = aws_future_pkcs11_lib_get_result_by_move(future);
+    ASSERT_NOT_NULL(lib);
+
+    /* call C_GetInfo() to confirm the lib works */
+    CK_INFO info;
+    ASSERT_INT_EQUALS(CKR_OK, aws_pkcs11_lib_get_function_list(lib)->C_GetInfo(&info));
+
+    aws_pkcs11_lib_release(lib);
+    aws_future_pkcs11_lib_release(future);
+    s_pkcs11_tester_clean_up();
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(pkcs11_lib_new_async, s_test_pkcs11_lib_new_async)
+
 /* Stress test the DEFAULT_BEHAVIOR for C_Initialize() / C_Finalize() calls */
 static int s_test_pkcs11_lib_behavior_default(struct aws_allocator *allocator, void *ctx) {
     (void)ctx;
@@ -10,6 +10,7 @@
 #include <aws/common/string.h>
 #include <aws/common/task_scheduler.h>
 
+#include <aws/io/channel_bootstrap.h>
 #include <aws/io/event_loop.h>
 #include <aws/io/host_resolver.h>
 #include <aws/io/socket.h>
@@ -18,6 +19,11 @@
 #    pragma warning(disable : 4996) /* strncpy */
 #endif
 
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
+
 #if USE_VSOCK
 #    include <linux/vm_sockets.h>
 #endif
@@ -413,163 +419,929 @@ static int s_test_local_socket_communication(struct aws_allocator *allocator, vo
 
 AWS_TEST_CASE(local_socket_communication, s_test_local_socket_communication)
 
-static int s_test_tcp_socket_communication(struct aws_allocator *allocator, void *ctx) {
-    (void)ctx;
+#ifndef _WIN32
+struct fd_passing_args {
+    struct aws_socket *socket;
+    struct aws_mutex *mutex;
+    struct aws_condition_variable condition_variable;
+    struct aws_byte_buf *read_data;
+    int fd_to_send;
+    int received_fd;
+    size_t amount_written;
+    size_t amount_read;
+    int error_code;
+    bool write_completed;
+    bool read_completed;
+};
 
-    struct aws_socket_options options;
-    AWS_ZERO_STRUCT(options);
-    options.connect_timeout_ms = 3000;
-    options.keepalive = true;
-    options.keep_alive_interval_sec = 1000;
-    options.keep_alive_timeout_sec = 60000;
-    options.type = AWS_SOCKET_STREAM;
-    options.domain = AWS_SOCKET_IPV4;
+static void s_send_fd_task(struct aws_task *task, void *args, enum aws_task_status status) {
+    (void)task;
+    (void)status;
 
-    struct aws_socket_endpoint endpoint = {.address = "127.0.0.1", .port = 8127};
+    struct fd_passing_args *fd_args = args;
+    aws_mutex_lock(fd_args->mutex);
+    struct aws_byte_cursor payload = aws_byte_cursor_from_c_str("fd");
+    if (aws_socket_send_fd(fd_args->socket, &payload, fd_args->fd_to_send, &fd_args->amount_written)) {
+        fd_args->error_code = aws_last_error();
+    }
+    fd_args->write_completed = true;
+    aws_mutex_unlock(fd_args->mutex);
+    aws_condition_variable_notify_one(&fd_args->condition_variable);
+}
 
-    return s_test_socket(allocator, &options, &endpoint);
+static bool s_send_fd_completed_predicate(void *arg) {
+    struct fd_passing_args *fd_args = arg;
+
+    return fd_args->write_completed;
 }
 
-AWS_TEST_CASE(tcp_socket_communication, s_test_tcp_socket_communication)
+static void s_read_fd_task(struct aws_task *task, void *args, enum aws_task_status status) {
+    (void)task;
+    (void)status;
 
-#if defined(USE_VSOCK)
-static int s_test_vsock_loopback_socket_communication(struct aws_allocator *allocator, void *ctx) {
-/* Without vsock loopback it's difficult to test vsock functionality.
- * Also note that having this defined does not guarantee that it's available
- * for use and there's no path to figure out dynamically if it can be used. */
-#    if defined(VMADDR_CID_LOCAL)
+    struct fd_passing_args *fd_args = args;
+    aws_mutex_lock(fd_args->mutex);
+
+    while (fd_args->received_fd < 0) {
+        size_t data_len = 0;
+        if (aws_socket_read_with_fd(fd_args->socket, fd_args->read_data, &data_len, &fd_args->received_fd)) {
+            if (AWS_IO_READ_WOULD_BLOCK == aws_last_error()) {
+                continue;
+            }
+            fd_args->error_code = aws_last_error();
+            break;
+        }
+        fd_args->amount_read += data_len;
+    }
+    fd_args->read_completed = true;
+
+    aws_mutex_unlock(fd_args->mutex);
+    aws_condition_variable_notify_one(&fd_args->condition_variable);
+}
+
+static bool s_read_fd_completed_predicate(void *arg) {
+    struct fd_passing_args *fd_args = arg;
+
+    return fd_args->read_completed;
+}
+
+static int s_test_local_socket_fd_passing(struct aws_allocator *allocator, void *ctx) {
     (void)ctx;
 
+    struct aws_event_loop *event_loop = aws_event_loop_new_default(allocator, aws_high_res_clock_get_ticks);
+    ASSERT_NOT_NULL(event_loop, "Event loop creation failed with error: %s", aws_error_debug_str(aws_last_error()));
+    ASSERT_SUCCESS(aws_event_loop_run(event_loop));
+
+    struct aws_mutex mutex = AWS_MUTEX_INIT;
+    struct aws_condition_variable condition_variable = AWS_CONDITION_VARIABLE_INIT;
+
     struct aws_socket_options options;
     AWS_ZERO_STRUCT(options);
     options.connect_timeout_ms = 3000;
     options.type = AWS_SOCKET_STREAM;
-    options.domain = AWS_SOCKET_VSOCK;
+    options.domain = AWS_SOCKET_LOCAL;
 
-    struct aws_socket_endpoint endpoint = {.address = "1" /* VMADDR_CID_LOCAL */, .port = 8127};
+    struct aws_socket_endpoint endpoint;
+    AWS_ZERO_STRUCT(endpoint);
+    aws_socket_endpoint_init_local_address_for_test(&endpoint);
 
-    return s_test_socket(allocator, &options, &endpoint);
-#    else
-    return 0;
-#    endif
-}
+    struct local_listener_args listener_args = {
+        .mutex = &mutex,
+        .condition_variable = &condition_variable,
+        .incoming = NULL,
+        .incoming_invoked = false,
+        .error_invoked = false,
+    };
 
-AWS_TEST_CASE(vsock_loopback_socket_communication, s_test_vsock_loopback_socket_communication)
-#endif
+    struct aws_socket listener;
+    ASSERT_SUCCESS(aws_socket_init(&listener, allocator, &options));
+    ASSERT_SUCCESS(aws_socket_bind(&listener, &endpoint));
+    ASSERT_SUCCESS(aws_socket_listen(&listener, 1024));
+    ASSERT_SUCCESS(aws_socket_start_accept(&listener, event_loop, s_local_listener_incoming, &listener_args));
 
-static int s_test_udp_socket_communication(struct aws_allocator *allocator, void *ctx) {
-    (void)ctx;
+    struct local_outgoing_args outgoing_args = {
+        .mutex = &mutex, .condition_variable = &condition_variable, .connect_invoked = false, .error_invoked = false};
 
-    struct aws_socket_options options;
-    AWS_ZERO_STRUCT(options);
-    options.connect_timeout_ms = 3000;
-    options.type = AWS_SOCKET_DGRAM;
-    options.domain = AWS_SOCKET_IPV4;
+    struct aws_socket outgoing;
+    ASSERT_SUCCESS(aws_socket_init(&outgoing, allocator, &options));
+    ASSERT_SUCCESS(aws_socket_connect(&outgoing, &endpoint, event_loop, s_local_outgoing_connection, &outgoing_args));
 
-    struct aws_socket_endpoint endpoint = {.address = "127.0.0.1", .port = 8126};
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    ASSERT_SUCCESS(aws_condition_variable_wait_pred(&condition_variable, &mutex, s_incoming_predicate, &listener_args));
+    ASSERT_SUCCESS(
+        aws_condition_variable_wait_pred(&condition_variable, &mutex, s_connection_completed_predicate, &outgoing_args));
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
 
-    return s_test_socket(allocator, &options, &endpoint);
-}
+    struct aws_socket *server_sock = listener_args.incoming;
+    ASSERT_NOT_NULL(server_sock);
+    ASSERT_SUCCESS(aws_socket_assign_to_event_loop(server_sock, event_loop));
+    aws_socket_subscribe_to_readable_events(server_sock, s_on_readable, NULL);
+    aws_socket_subscribe_to_readable_events(&outgoing, s_on_readable, NULL);
 
-AWS_TEST_CASE(udp_socket_communication, s_test_udp_socket_communication)
+    /* pass the read end of a pipe across the connection, then prove the received descriptor
+     * refers to the same pipe by reading the sentinel through it. */
+    int pipe_fds[2] = {-1, -1};
+    ASSERT_INT_EQUALS(0, pipe(pipe_fds));
+    const char sentinel[] = "sentinel";
+    ASSERT_INT_EQUALS((int)sizeof(sentinel), (int)write(pipe_fds[1], sentinel, sizeof(sentinel)));
 
-static int s_test_udp_bind_connect_communication(struct aws_allocator *allocator, void *ctx) {
-    (void)ctx;
+    uint8_t read_storage[32] = {0};
+    struct aws_byte_buf read_buffer = aws_byte_buf_from_array(read_storage, sizeof(read_storage));
+    read_buffer.len = 0;
 
-    struct aws_socket_options options;
-    AWS_ZERO_STRUCT(options);
-    options.connect_timeout_ms = 3000;
-    options.type = AWS_SOCKET_DGRAM;
-    options.domain = AWS_SOCKET_IPV4;
+    struct fd_passing_args fd_args = {
+        .socket = &outgoing,
+        .mutex = &mutex,
+        .condition_variable = AWS_CONDITION_VARIABLE_INIT,
+        .read_data = &read_buffer,
+        .fd_to_send = pipe_fds[0],
+        .received_fd = -1,
+        .amount_written = 0,
+        .amount_read = 0,
+        .error_code = 0,
+        .write_completed = false,
+        .read_completed = false,
+    };
 
-    struct aws_socket_endpoint local = {.address = "127.0.0.1", .port = 4242};
-    struct aws_socket_endpoint endpoint = {.address = "127.0.0.1", .port = 8126};
+    struct aws_task send_fd_task = {
+        .fn = s_send_fd_task,
+        .arg = &fd_args,
+    };
 
-    return s_test_socket_ex(allocator, &options, &local, &endpoint);
+    aws_event_loop_schedule_task_now(event_loop, &send_fd_task);
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    aws_condition_variable_wait_pred(&fd_args.condition_variable, &mutex, s_send_fd_completed_predicate, &fd_args);
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+    ASSERT_INT_EQUALS(0, fd_args.error_code);
+    ASSERT_UINT_EQUALS(2, fd_args.amount_written);
+
+    fd_args.socket = server_sock;
+    struct aws_task read_fd_task = {
+        .fn = s_read_fd_task,
+        .arg = &fd_args,
+    };
+
+    aws_event_loop_schedule_task_now(event_loop, &read_fd_task);
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    aws_condition_variable_wait_pred(&fd_args.condition_variable, &mutex, s_read_fd_completed_predicate, &fd_args);
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+    ASSERT_INT_EQUALS(0, fd_args.error_code);
+    ASSERT_TRUE(fd_args.received_fd >= 0);
+    ASSERT_TRUE(fd_args.received_fd != pipe_fds[0]);
+    ASSERT_UINT_EQUALS(2, fd_args.amount_read);
+
+    char received_sentinel[sizeof(sentinel)] = {0};
+    ASSERT_INT_EQUALS(
+        (int)sizeof(sentinel), (int)read(fd_args.received_fd, received_sentinel, sizeof(received_sentinel)));
+    ASSERT_BIN_ARRAYS_EQUALS(sentinel, sizeof(sentinel), received_sentinel, sizeof(received_sentinel));
+
+    close(fd_args.received_fd);
+    close(pipe_fds[0]);
+    close(pipe_fds[1]);
+
+    struct socket_io_args io_args = {
+        .mutex = &mutex,
+        .condition_variable = AWS_CONDITION_VARIABLE_INIT,
+        .close_completed = false,
+    };
+
+    struct aws_task close_task = {
+        .fn = s_socket_close_task,
+        .arg = &io_args,
+    };
+
+    io_args.socket = server_sock;
+    aws_event_loop_schedule_task_now(event_loop, &close_task);
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    aws_condition_variable_wait_pred(&io_args.condition_variable, &mutex, s_close_completed_predicate, &io_args);
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+    aws_socket_clean_up(server_sock);
+    aws_mem_release(allocator, server_sock);
+
+    io_args.socket = &outgoing;
+    io_args.close_completed = false;
+    aws_event_loop_schedule_task_now(event_loop, &close_task);
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    aws_condition_variable_wait_pred(&io_args.condition_variable, &mutex, s_close_completed_predicate, &io_args);
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+    aws_socket_clean_up(&outgoing);
+
+    io_args.socket = &listener;
+    io_args.close_completed = false;
+    aws_event_loop_schedule_task_now(event_loop, &close_task);
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    aws_condition_variable_wait_pred(&io_args.condition_variable, &mutex, s_close_completed_predicate, &io_args);
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+    aws_socket_clean_up(&listener);
+
+    aws_event_loop_destroy(event_loop);
+
+    return 0;
 }
-AWS_TEST_CASE(udp_bind_connect_communication, s_test_udp_bind_connect_communication)
 
-struct test_host_callback_data {
-    struct aws_host_address a_address;
+AWS_TEST_CASE(local_socket_fd_passing, s_test_local_socket_fd_passing)
+
+enum {
+    URGENT_TEST_BULK_WRITE_SIZE = 64 * 1024,
+    URGENT_TEST_BULK_WRITE_COUNT = 32,
+};
+
+struct urgent_write_args {
+    struct aws_event_loop *event_loop;
+    struct aws_socket *socket;
     struct aws_mutex *mutex;
-    bool has_a_address;
     struct aws_condition_variable condition_variable;
-    bool invoked;
+    struct aws_byte_cursor bulk_cursor;
+    struct aws_byte_cursor urgent_cursor;
+    struct aws_byte_buf *read_data;
+    size_t bytes_expected;
+    int error_code;
+    bool writes_submitted;
+    bool read_completed;
 };
 
-static bool s_test_host_resolved_predicate(void *arg) {
-    struct test_host_callback_data *callback_data = arg;
-
-    return callback_data->invoked;
+static void s_urgent_write_complete(struct aws_socket *socket, int error_code, size_t amount_written, void *user_data) {
+    (void)socket;
+    (void)error_code;
+    (void)amount_written;
+    (void)user_data;
 }
 
-static void s_test_host_resolver_shutdown_callback(void *user_data) {
-    struct test_host_callback_data *callback_data = user_data;
+/* submit a pile of bulk writes back-to-back (far more than the kernel buffers will take, so the
+ * tail queues in user-space), then one urgent write that should overtake the queued bulk */
+static void s_urgent_submit_task(struct aws_task *task, void *args, enum aws_task_status status) {
+    (void)task;
+    (void)status;
 
-    aws_mutex_lock(callback_data->mutex);
-    callback_data->invoked = true;
-    aws_mutex_unlock(callback_data->mutex);
+    struct urgent_write_args *urgent_args = args;
+    aws_mutex_lock(urgent_args->mutex);
 
-    aws_condition_variable_notify_one(&callback_data->condition_variable);
-}
+    for (size_t i = 0; i < URGENT_TEST_BULK_WRITE_COUNT; ++i) {
+        if (aws_socket_write(urgent_args->socket, &urgent_args->bulk_cursor, s_urgent_write_complete, NULL)) {
+            urgent_args->error_code = aws_last_error();
+            break;
+        }
+    }
 
-static void s_test_host_resolved_test_callback(
-    struct aws_host_resolver *resolver,
-    const struct aws_string *host_name,
-    int err_code,
-    const struct aws_array_list *host_addresses,
-    void *user_data) {
+    if (urgent_args->error_code == 0 &&
+        aws_socket_write_urgent(urgent_args->socket, &urgent_args->urgent_cursor, s_urgent_write_complete, NULL)) {
+        urgent_args->error_code = aws_last_error();
+    }
 
-    (void)resolver;
-    (void)host_name;
-    (void)err_code;
+    urgent_args->writes_submitted = true;
+    aws_mutex_unlock(urgent_args->mutex);
+    aws_condition_variable_notify_one(&urgent_args->condition_variable);
+}
 
-    struct test_host_callback_data *callback_data = user_data;
+static bool s_urgent_submit_predicate(void *arg) {
+    struct urgent_write_args *urgent_args = arg;
+    return urgent_args->writes_submitted;
+}
 
-    aws_mutex_lock(callback_data->mutex);
-    struct aws_host_address *host_address = NULL;
+/* drains the connection; re-schedules itself on would-block so the loop can keep flushing the
+ * writer's queued requests between read attempts */
+static void s_urgent_read_task(struct aws_task *task, void *args, enum aws_task_status status) {
+    (void)status;
 
-    if (aws_array_list_length(host_addresses) == 1) {
-        aws_array_list_get_at_ptr(host_addresses, (void **)&host_address, 0);
+    struct urgent_write_args *urgent_args = args;
+    aws_mutex_lock(urgent_args->mutex);
 
-        aws_host_address_copy(host_address, &callback_data->a_address);
-        callback_data->has_a_address = true;
+    while (urgent_args->read_data->len < urgent_args->bytes_expected) {
+        size_t data_len = 0;
+        if (aws_socket_read(urgent_args->socket, urgent_args->read_data, &data_len)) {
+            if (AWS_IO_READ_WOULD_BLOCK == aws_last_error()) {
+                aws_mutex_unlock(urgent_args->mutex);
+                aws_event_loop_schedule_task_now(urgent_args->event_loop, task);
+                return;
+            }
+            urgent_args->error_code = aws_last_error();
+            break;
+        }
     }
+    urgent_args->read_completed = true;
 
-    callback_data->invoked = true;
-    aws_mutex_unlock(callback_data->mutex);
-    aws_condition_variable_notify_one(&callback_data->condition_variable);
+    aws_mutex_unlock(urgent_args->mutex);
+    aws_condition_variable_notify_one(&urgent_args->condition_variable);
 }
 
-static int s_test_connect_timeout(struct aws_allocator *allocator, void *ctx) {
-    (void)ctx;
+static bool s_urgent_read_predicate(void *arg) {
+    struct urgent_write_args *urgent_args = arg;
+    return urgent_args->read_completed;
+}
 
-    aws_io_library_init(allocator);
+static int s_test_local_socket_urgent_write_overtakes_bulk(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
 
-    struct aws_event_loop_group *el_group = aws_event_loop_group_new_default(allocator, 1, NULL);
-    struct aws_event_loop *event_loop = aws_event_loop_group_get_next_loop(el_group);
+    struct aws_event_loop *event_loop = aws_event_loop_new_default(allocator, aws_high_res_clock_get_ticks);
     ASSERT_NOT_NULL(event_loop, "Event loop creation failed with error: %s", aws_error_debug_str(aws_last_error()));
+    ASSERT_SUCCESS(aws_event_loop_run(event_loop));
 
     struct aws_mutex mutex = AWS_MUTEX_INIT;
     struct aws_condition_variable condition_variable = AWS_CONDITION_VARIABLE_INIT;
 
     struct aws_socket_options options;
     AWS_ZERO_STRUCT(options);
-    options.connect_timeout_ms = 1000;
+    options.connect_timeout_ms = 3000;
     options.type = AWS_SOCKET_STREAM;
-    options.domain = AWS_SOCKET_IPV4;
-
-    struct aws_host_resolver_default_options resolver_options = {
-        .el_group = el_group,
-        .max_entries = 2,
-    };
-    struct aws_host_resolver *resolver = aws_host_resolver_new_default(allocator, &resolver_options);
+    options.domain = AWS_SOCKET_LOCAL;
 
-    struct aws_host_resolution_config resolution_config = {
-        .impl = aws_default_dns_resolve, .impl_data = NULL, .max_ttl = 1};
+    struct aws_socket_endpoint endpoint;
+    AWS_ZERO_STRUCT(endpoint);
+    aws_socket_endpoint_init_local_address_for_test(&endpoint);
 
-    struct test_host_callback_data host_callback_data = {
-        .condition_variable = AWS_CONDITION_VARIABLE_INIT,
+    struct local_listener_args listener_args = {
+        .mutex = &mutex,
+        .condition_variable = &condition_variable,
+        .incoming = NULL,
+        .incoming_invoked = false,
+        .error_invoked = false,
+    };
+
+    struct aws_socket listener;
+    ASSERT_SUCCESS(aws_socket_init(&listener, allocator, &options));
+    ASSERT_SUCCESS(aws_socket_bind(&listener, &endpoint));
+    ASSERT_SUCCESS(aws_socket_listen(&listener, 1024));
+    ASSERT_SUCCESS(aws_socket_start_accept(&listener, event_loop, s_local_listener_incoming, &listener_args));
+
+    struct local_outgoing_args outgoing_args = {
+        .mutex = &mutex, .condition_variable = &condition_variable, .connect_invoked = false, .error_invoked = false};
+
+    struct aws_socket outgoing;
+    ASSERT_SUCCESS(aws_socket_init(&outgoing, allocator, &options));
+    ASSERT_SUCCESS(aws_socket_connect(&outgoing, &endpoint, event_loop, s_local_outgoing_connection, &outgoing_args));
+
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    ASSERT_SUCCESS(aws_condition_variable_wait_pred(&condition_variable, &mutex, s_incoming_predicate, &listener_args));
+    ASSERT_SUCCESS(
+        aws_condition_variable_wait_pred(&condition_variable, &mutex, s_connection_completed_predicate, &outgoing_args));
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+
+    struct aws_socket *server_sock = listener_args.incoming;
+    ASSERT_NOT_NULL(server_sock);
+    ASSERT_SUCCESS(aws_socket_assign_to_event_loop(server_sock, event_loop));
+    aws_socket_subscribe_to_readable_events(server_sock, s_on_readable, NULL);
+    aws_socket_subscribe_to_readable_events(&outgoing, s_on_readable, NULL);
+
+    struct aws_byte_buf bulk_buffer;
+    ASSERT_SUCCESS(aws_byte_buf_init(&bulk_buffer, allocator, URGENT_TEST_BULK_WRITE_SIZE));
+    memset(bulk_buffer.buffer, 'b', URGENT_TEST_BULK_WRITE_SIZE);
+    bulk_buffer.len = URGENT_TEST_BULK_WRITE_SIZE;
+
+    const char urgent_payload[] = "URGENT!!";
+    size_t urgent_len = sizeof(urgent_payload) - 1;
+    size_t total_len = (size_t)URGENT_TEST_BULK_WRITE_COUNT * URGENT_TEST_BULK_WRITE_SIZE + urgent_len;
+
+    struct aws_byte_buf read_buffer;
+    ASSERT_SUCCESS(aws_byte_buf_init(&read_buffer, allocator, total_len));
+
+    struct urgent_write_args urgent_args = {
+        .event_loop = event_loop,
+        .socket = &outgoing,
+        .mutex = &mutex,
+        .condition_variable = AWS_CONDITION_VARIABLE_INIT,
+        .bulk_cursor = aws_byte_cursor_from_buf(&bulk_buffer),
+        .urgent_cursor = aws_byte_cursor_from_array(urgent_payload, urgent_len),
+        .read_data = &read_buffer,
+        .bytes_expected = total_len,
+        .error_code = 0,
+        .writes_submitted = false,
+        .read_completed = false,
+    };
+
+    struct aws_task submit_task = {
+        .fn = s_urgent_submit_task,
+        .arg = &urgent_args,
+    };
+
+    aws_event_loop_schedule_task_now(event_loop, &submit_task);
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    aws_condition_variable_wait_pred(&urgent_args.condition_variable, &mutex, s_urgent_submit_predicate, &urgent_args);
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+    ASSERT_INT_EQUALS(0, urgent_args.error_code);
+
+    urgent_args.socket = server_sock;
+    struct aws_task read_task = {
+        .fn = s_urgent_read_task,
+        .arg = &urgent_args,
+    };
+
+    aws_event_loop_schedule_task_now(event_loop, &read_task);
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    aws_condition_variable_wait_pred(&urgent_args.condition_variable, &mutex, s_urgent_read_predicate, &urgent_args);
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+    ASSERT_INT_EQUALS(0, urgent_args.error_code);
+    ASSERT_UINT_EQUALS(total_len, read_buffer.len);
+
+    /* locate the urgent payload in the received stream */
+    size_t marker_offset = SIZE_MAX;
+    for (size_t i = 0; i + urgent_len <= read_buffer.len; ++i) {
+        if (memcmp(read_buffer.buffer + i, urgent_payload, urgent_len) == 0) {
+            marker_offset = i;
+            break;
+        }
+    }
+    ASSERT_TRUE(marker_offset != SIZE_MAX);
+    /* it must have overtaken queued bulk: bulk bytes follow it in the stream */
+    ASSERT_TRUE(marker_offset + urgent_len < read_buffer.len);
+    /* and it must not have corrupted the partially-flushed front request: it sits on a
+     * bulk-write boundary */
+    ASSERT_UINT_EQUALS(0, marker_offset % URGENT_TEST_BULK_WRITE_SIZE);
+
+    aws_byte_buf_clean_up(&read_buffer);
+    aws_byte_buf_clean_up(&bulk_buffer);
+
+    struct socket_io_args io_args = {
+        .mutex = &mutex,
+        .condition_variable = AWS_CONDITION_VARIABLE_INIT,
+        .close_completed = false,
+    };
+
+    struct aws_task close_task = {
+        .fn = s_socket_close_task,
+        .arg = &io_args,
+    };
+
+    io_args.socket = server_sock;
+    aws_event_loop_schedule_task_now(event_loop, &close_task);
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    aws_condition_variable_wait_pred(&io_args.condition_variable, &mutex, s_close_completed_predicate, &io_args);
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+    aws_socket_clean_up(server_sock);
+    aws_mem_release(allocator, server_sock);
+
+    io_args.socket = &outgoing;
+    io_args.close_completed = false;
+    aws_event_loop_schedule_task_now(event_loop, &close_task);
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    aws_condition_variable_wait_pred(&io_args.condition_variable, &mutex, s_close_completed_predicate, &io_args);
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+    aws_socket_clean_up(&outgoing);
+
+    io_args.socket = &listener;
+    io_args.close_completed = false;
+    aws_event_loop_schedule_task_now(event_loop, &close_task);
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    aws_condition_variable_wait_pred(&io_args.condition_variable, &mutex, s_close_completed_predicate, &io_args);
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+    aws_socket_clean_up(&listener);
+
+    aws_event_loop_destroy(event_loop);
+
+    return 0;
+}
+
+AWS_TEST_CASE(local_socket_urgent_write_overtakes_bulk, s_test_local_socket_urgent_write_overtakes_bulk)
+#endif /* _WIN32 */
+
+#ifndef _WIN32
+struct file_region_write_args {
+    struct socket_io_args *io_args;
+    int file_fd;
+    uint64_t offset;
+    size_t length;
+};
+
+static void s_write_file_region_task(struct aws_task *task, void *args, enum aws_task_status status) {
+    (void)task;
+    (void)status;
+
+    struct file_region_write_args *region_args = args;
+    if (aws_socket_write_file_region(
+            region_args->io_args->socket,
+            region_args->file_fd,
+            region_args->offset,
+            region_args->length,
+            s_on_written,
+            region_args->io_args)) {
+        s_on_written(region_args->io_args->socket, aws_last_error(), region_args->length, region_args->io_args);
+    }
+}
+
+static int s_test_local_socket_write_file_region(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_event_loop *event_loop = aws_event_loop_new_default(allocator, aws_high_res_clock_get_ticks);
+    ASSERT_NOT_NULL(event_loop, "Event loop creation failed with error: %s", aws_error_debug_str(aws_last_error()));
+    ASSERT_SUCCESS(aws_event_loop_run(event_loop));
+
+    /* file with known contents to transmit */
+    const char *file_path = "local_socket_write_file_region.txt";
+    const char file_contents[] = "zero copy file to socket";
+    remove(file_path);
+    FILE *file = fopen(file_path, "wb");
+    ASSERT_NOT_NULL(file);
+    fwrite(file_contents, 1, sizeof(file_contents), file);
+    fclose(file);
+    int file_fd = open(file_path, O_RDONLY);
+    ASSERT_TRUE(file_fd >= 0);
+
+    struct aws_mutex mutex = AWS_MUTEX_INIT;
+    struct aws_condition_variable condition_variable = AWS_CONDITION_VARIABLE_INIT;
+
+    struct local_listener_args listener_args = {
+        .mutex = &mutex,
+        .condition_variable = &condition_variable,
+        .incoming = NULL,
+        .incoming_invoked = false,
+        .error_invoked = false,
+    };
+
+    struct aws_socket_options options;
+    AWS_ZERO_STRUCT(options);
+    options.connect_timeout_ms = 3000;
+    options.type = AWS_SOCKET_STREAM;
+    options.domain = AWS_SOCKET_LOCAL;
+
+    struct aws_socket_endpoint endpoint;
+    AWS_ZERO_STRUCT(endpoint);
+    aws_socket_endpoint_init_local_address_for_test(&endpoint);
+
+    struct aws_socket listener;
+    ASSERT_SUCCESS(aws_socket_init(&listener, allocator, &options));
+    ASSERT_SUCCESS(aws_socket_bind(&listener, &endpoint));
+    ASSERT_SUCCESS(aws_socket_listen(&listener, 1024));
+    ASSERT_SUCCESS(aws_socket_start_accept(&listener, event_loop, s_local_listener_incoming, &listener_args));
+
+    struct local_outgoing_args outgoing_args = {
+        .mutex = &mutex, .condition_variable = &condition_variable, .connect_invoked = false, .error_invoked = false};
+
+    struct aws_socket outgoing;
+    ASSERT_SUCCESS(aws_socket_init(&outgoing, allocator, &options));
+    ASSERT_SUCCESS(aws_socket_connect(&outgoing, &endpoint, event_loop, s_local_outgoing_connection, &outgoing_args));
+
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    ASSERT_SUCCESS(aws_condition_variable_wait_pred(&condition_variable, &mutex, s_incoming_predicate, &listener_args));
+    ASSERT_SUCCESS(
+        aws_condition_variable_wait_pred(&condition_variable, &mutex, s_connection_completed_predicate, &outgoing_args));
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+
+    struct aws_socket *server_sock = listener_args.incoming;
+    ASSERT_NOT_NULL(server_sock);
+    ASSERT_SUCCESS(aws_socket_assign_to_event_loop(server_sock, event_loop));
+    aws_socket_subscribe_to_readable_events(server_sock, s_on_readable, NULL);
+    aws_socket_subscribe_to_readable_events(&outgoing, s_on_readable, NULL);
+
+    char write_data[sizeof(file_contents)] = {0};
+    struct aws_byte_buf read_buffer = aws_byte_buf_from_array((const uint8_t *)file_contents, sizeof(file_contents));
+    struct aws_byte_buf write_buffer = aws_byte_buf_from_array((const uint8_t *)write_data, sizeof(write_data));
+    write_buffer.len = 0;
+
+    struct socket_io_args io_args = {
+        .socket = &outgoing,
+        .to_write = NULL,
+        .to_read = &read_buffer,
+        .read_data = &write_buffer,
+        .mutex = &mutex,
+        .amount_read = 0,
+        .amount_written = 0,
+        .error_code = 0,
+        .condition_variable = AWS_CONDITION_VARIABLE_INIT,
+        .close_completed = false,
+    };
+
+    struct file_region_write_args region_args = {
+        .io_args = &io_args,
+        .file_fd = file_fd,
+        .offset = 0,
+        .length = sizeof(file_contents),
+    };
+
+    struct aws_task write_task = {
+        .fn = s_write_file_region_task,
+        .arg = &region_args,
+    };
+
+    aws_event_loop_schedule_task_now(event_loop, &write_task);
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    aws_condition_variable_wait_pred(&io_args.condition_variable, &mutex, s_write_completed_predicate, &io_args);
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+    ASSERT_INT_EQUALS(AWS_OP_SUCCESS, io_args.error_code);
+    ASSERT_UINT_EQUALS(sizeof(file_contents), io_args.amount_written);
+
+    io_args.socket = server_sock;
+    struct aws_task read_task = {
+        .fn = s_read_task,
+        .arg = &io_args,
+    };
+
+    aws_event_loop_schedule_task_now(event_loop, &read_task);
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    aws_condition_variable_wait_pred(&io_args.condition_variable, &mutex, s_read_task_predicate, &io_args);
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+    ASSERT_INT_EQUALS(AWS_OP_SUCCESS, io_args.error_code);
+    ASSERT_BIN_ARRAYS_EQUALS(file_contents, sizeof(file_contents), write_buffer.buffer, write_buffer.len);
+
+    struct aws_task close_task = {
+        .fn = s_socket_close_task,
+        .arg = &io_args,
+    };
+
+    io_args.socket = server_sock;
+    io_args.close_completed = false;
+    aws_event_loop_schedule_task_now(event_loop, &close_task);
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    aws_condition_variable_wait_pred(&io_args.condition_variable, &mutex, s_close_completed_predicate, &io_args);
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+
+    aws_socket_clean_up(server_sock);
+    aws_mem_release(allocator, server_sock);
+
+    io_args.socket = &outgoing;
+    io_args.close_completed = false;
+    aws_event_loop_schedule_task_now(event_loop, &close_task);
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    aws_condition_variable_wait_pred(&io_args.condition_variable, &mutex, s_close_completed_predicate, &io_args);
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+    aws_socket_clean_up(&outgoing);
+
+    io_args.socket = &listener;
+    io_args.close_completed = false;
+    aws_event_loop_schedule_task_now(event_loop, &close_task);
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    aws_condition_variable_wait_pred(&io_args.condition_variable, &mutex, s_close_completed_predicate, &io_args);
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+    aws_socket_clean_up(&listener);
+
+    aws_event_loop_destroy(event_loop);
+
+    close(file_fd);
+    remove(file_path);
+
+    return 0;
+}
+
+AWS_TEST_CASE(local_socket_write_file_region, s_test_local_socket_write_file_region)
+#endif /* _WIN32 */
+
+static int s_test_tcp_socket_communication(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_socket_options options;
+    AWS_ZERO_STRUCT(options);
+    options.connect_timeout_ms = 3000;
+    options.keepalive = true;
+    options.keep_alive_interval_sec = 1000;
+    options.keep_alive_timeout_sec = 60000;
+    options.type = AWS_SOCKET_STREAM;
+    options.domain = AWS_SOCKET_IPV4;
+
+    struct aws_socket_endpoint endpoint = {.address = "127.0.0.1", .port = 8127};
+
+    return s_test_socket(allocator, &options, &endpoint);
+}
+
+AWS_TEST_CASE(tcp_socket_communication, s_test_tcp_socket_communication)
+
+static int s_test_socket_transport_telemetry(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_event_loop *event_loop = aws_event_loop_new_default(allocator, aws_high_res_clock_get_ticks);
+    ASSERT_NOT_NULL(event_loop, "Event loop creation failed with error: %s", aws_error_debug_str(aws_last_error()));
+    ASSERT_SUCCESS(aws_event_loop_run(event_loop));
+
+    struct aws_mutex mutex = AWS_MUTEX_INIT;
+    struct aws_condition_variable condition_variable = AWS_CONDITION_VARIABLE_INIT;
+
+    struct aws_socket_options options;
+    AWS_ZERO_STRUCT(options);
+    options.connect_timeout_ms = 3000;
+    options.type = AWS_SOCKET_STREAM;
+    options.domain = AWS_SOCKET_IPV4;
+
+    struct aws_socket_endpoint endpoint = {.address = "127.0.0.1", .port = 0};
+
+    struct local_listener_args listener_args = {
+        .mutex = &mutex,
+        .condition_variable = &condition_variable,
+        .incoming = NULL,
+        .incoming_invoked = false,
+        .error_invoked = false,
+    };
+
+    struct aws_socket listener;
+    ASSERT_SUCCESS(aws_socket_init(&listener, allocator, &options));
+    ASSERT_SUCCESS(aws_socket_bind(&listener, &endpoint));
+    ASSERT_SUCCESS(aws_socket_get_bound_address(&listener, &endpoint));
+    ASSERT_SUCCESS(aws_socket_listen(&listener, 1024));
+    ASSERT_SUCCESS(aws_socket_start_accept(&listener, event_loop, s_local_listener_incoming, &listener_args));
+
+    struct local_outgoing_args outgoing_args = {
+        .mutex = &mutex, .condition_variable = &condition_variable, .connect_invoked = false, .error_invoked = false};
+
+    struct aws_socket outgoing;
+    ASSERT_SUCCESS(aws_socket_init(&outgoing, allocator, &options));
+    ASSERT_SUCCESS(aws_socket_connect(&outgoing, &endpoint, event_loop, s_local_outgoing_connection, &outgoing_args));
+
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    ASSERT_SUCCESS(aws_condition_variable_wait_pred(&condition_variable, &mutex, s_incoming_predicate, &listener_args));
+    ASSERT_SUCCESS(
+        aws_condition_variable_wait_pred(&condition_variable, &mutex, s_connection_completed_predicate, &outgoing_args));
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+
+    struct aws_socket_transport_telemetry telemetry;
+#if defined(__linux__)
+    ASSERT_SUCCESS(aws_socket_fetch_transport_telemetry(&outgoing, &telemetry));
+    /* an established connection always has a non-empty congestion window */
+    ASSERT_TRUE(telemetry.congestion_window_bytes > 0);
+    ASSERT_UINT_EQUALS(0, telemetry.retransmit_count);
+#else
+    ASSERT_ERROR(AWS_ERROR_PLATFORM_NOT_SUPPORTED, aws_socket_fetch_transport_telemetry(&outgoing, &telemetry));
+#endif
+
+    /* telemetry is TCP-only */
+    struct aws_socket_options local_options = options;
+    local_options.domain = AWS_SOCKET_LOCAL;
+    struct aws_socket local_socket;
+    ASSERT_SUCCESS(aws_socket_init(&local_socket, allocator, &local_options));
+    ASSERT_ERROR(
+        AWS_IO_SOCKET_INVALID_OPERATION_FOR_TYPE, aws_socket_fetch_transport_telemetry(&local_socket, &telemetry));
+    aws_socket_clean_up(&local_socket);
+
+    struct socket_io_args io_args = {
+        .socket = &outgoing,
+        .mutex = &mutex,
+        .condition_variable = AWS_CONDITION_VARIABLE_INIT,
+        .close_completed = false,
+    };
+
+    struct aws_task close_task = {
+        .fn = s_socket_close_task,
+        .arg = &io_args,
+    };
+
+    if (listener_args.incoming) {
+        io_args.socket = listener_args.incoming;
+        io_args.close_completed = false;
+        aws_event_loop_schedule_task_now(event_loop, &close_task);
+        ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+        aws_condition_variable_wait_pred(&io_args.condition_variable, &mutex, s_close_completed_predicate, &io_args);
+        ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+
+        aws_socket_clean_up(listener_args.incoming);
+        aws_mem_release(allocator, listener_args.incoming);
+    }
+
+    io_args.socket = &outgoing;
+    io_args.close_completed = false;
+    aws_event_loop_schedule_task_now(event_loop, &close_task);
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    aws_condition_variable_wait_pred(&io_args.condition_variable, &mutex, s_close_completed_predicate, &io_args);
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+    aws_socket_clean_up(&outgoing);
+
+    io_args.socket = &listener;
+    io_args.close_completed = false;
+    aws_event_loop_schedule_task_now(event_loop, &close_task);
+    ASSERT_SUCCESS(aws_mutex_lock(&mutex));
+    aws_condition_variable_wait_pred(&io_args.condition_variable, &mutex, s_close_completed_predicate, &io_args);
+    ASSERT_SUCCESS(aws_mutex_unlock(&mutex));
+    aws_socket_clean_up(&listener);
+
+    aws_event_loop_destroy(event_loop);
+
+    return 0;
+}
+
+AWS_TEST_CASE(socket_transport_telemetry, s_test_socket_transport_telemetry)
+
+#if defined(USE_VSOCK)
+static int s_test_vsock_loopback_socket_communication(struct aws_allocator *allocator, void *ctx) {
+/* Without vsock loopback it's difficult to test vsock functionality.
+ * Also note that having this defined does not guarantee that it's available
+ * for use and there's no path to figure out dynamically if it can be used. */
+#    if defined(VMADDR_CID_LOCAL)
+    (void)ctx;
+
+    struct aws_socket_options options;
+    AWS_ZERO_STRUCT(options);
+    options.connect_timeout_ms = 3000;
+    options.type = AWS_SOCKET_STREAM;
+    options.domain = AWS_SOCKET_VSOCK;
+
+    struct aws_socket_endpoint endpoint = {.address = "1" /* VMADDR_CID_LOCAL */, .port = 8127};
+
+    return s_test_socket(allocator, &options, &endpoint);
+#    else
+    return 0;
+#    endif
+}
+
+AWS_TEST_CASE(vsock_loopback_socket_communication, s_test_vsock_loopback_socket_communication)
+#endif
+
+static int s_test_udp_socket_communication(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_socket_options options;
+    AWS_ZERO_STRUCT(options);
+    options.connect_timeout_ms = 3000;
+    options.type = AWS_SOCKET_DGRAM;
+    options.domain = AWS_SOCKET_IPV4;
+
+    struct aws_socket_endpoint endpoint = {.address = "127.0.0.1", .port = 8126};
+
+    return s_test_socket(allocator, &options, &endpoint);
+}
+
+AWS_TEST_CASE(udp_socket_communication, s_test_udp_socket_communication)
+
+static int s_test_udp_bind_connect_communication(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_socket_options options;
+    AWS_ZERO_STRUCT(options);
+    options.connect_timeout_ms = 3000;
+    options.type = AWS_SOCKET_DGRAM;
+    options.domain = AWS_SOCKET_IPV4;
+
+    struct aws_socket_endpoint local = {.address = "127.0.0.1", .port = 4242};
+    struct aws_socket_endpoint endpoint = {.address = "127.0.0.1", .port = 8126};
+
+    return s_test_socket_ex(allocator, &options, &local, &endpoint);
+}
+AWS_TEST_CASE(udp_bind_connect_communication, s_test_udp_bind_connect_communication)
+
+struct test_host_callback_data {
+    struct aws_host_address a_address;
+    struct aws_mutex *mutex;
+    bool has_a_address;
+    struct aws_condition_variable condition_variable;
+    bool invoked;
+};
+
+static bool s_test_host_resolved_predicate(void *arg) {
+    struct test_host_callback_data *callback_data = arg;
+
+    return callback_data->invoked;
+}
+
+static void s_test_host_resolver_shutdown_callback(void *user_data) {
+    struct test_host_callback_data *callback_data = user_data;
+
+    aws_mutex_lock(callback_data->mutex);
+    callback_data->invoked = true;
+    aws_mutex_unlock(callback_data->mutex);
+
+    aws_condition_variable_notify_one(&callback_data->condition_variable);
+}
+
+static void s_test_host_resolved_test_callback(
+    struct aws_host_resolver *resolver,
+    const struct aws_string *host_name,
+    int err_code,
+    const struct aws_array_list *host_addresses,
+    void *user_data) {
+
+    (void)resolver;
+    (void)host_name;
+    (void)err_code;
+
+    struct test_host_callback_data *callback_data = user_data;
+
+    aws_mutex_lock(callback_data->mutex);
+    struct aws_host_address *host_address = NULL;
+
+    if (aws_array_list_length(host_addresses) == 1) {
+        aws_array_list_get_at_ptr(host_addresses, (void **)&host_address, 0);
+
+        aws_host_address_copy(host_address, &callback_data->a_address);
+        callback_data->has_a_address = true;
+    }
+
+    callback_data->invoked = true;
+    aws_mutex_unlock(callback_data->mutex);
+    aws_condition_variable_notify_one(&callback_data->condition_variable);
+}
+
+static int s_test_connect_timeout(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_io_library_init(allocator);
+
+    struct aws_event_loop_group *el_group = aws_event_loop_group_new_default(allocator, 1, NULL);
+    struct aws_event_loop *event_loop = aws_event_loop_group_get_next_loop(el_group);
+    ASSERT_NOT_NULL(event_loop, "Event loop creation failed with error: %s", aws_error_debug_str(aws_last_error()));
+
+    struct aws_mutex mutex = AWS_MUTEX_INIT;
+    struct aws_condition_variable condition_variable = AWS_CONDITION_VARIABLE_INIT;
+
+    struct aws_socket_options options;
+    AWS_ZERO_STRUCT(options);
+    options.connect_timeout_ms = 1000;
+    options.type = AWS_SOCKET_STREAM;
+    options.domain = AWS_SOCKET_IPV4;
+
+    struct aws_host_resolver_default_options resolver_options = {
+        .el_group = el_group,
+        .max_entries = 2,
+    };
+    struct aws_host_resolver *resolver = aws_host_resolver_new_default(allocator, &resolver_options);
+
+    struct aws_host_resolution_config resolution_config = {
+        .impl = aws_default_dns_resolve, .impl_data = NULL, .max_ttl = 1};
+
+    struct test_host_callback_data host_callback_data = {
+        .condition_variable = AWS_CONDITION_VARIABLE_INIT,
         .invoked = false,
         .has_a_address = false,
         .mutex = &mutex,
@@ -713,6 +1485,220 @@ static int s_test_connect_timeout_cancelation(struct aws_allocator *allocator, v
 
 AWS_TEST_CASE(connect_timeout_cancelation, s_test_connect_timeout_cancelation)
 
+struct bootstrap_cancel_test_data {
+    struct aws_mutex mutex;
+    struct aws_condition_variable condition_variable;
+    bool setup_invoked;
+    int setup_error_code;
+};
+
+static bool s_bootstrap_cancel_setup_invoked_predicate(void *arg) {
+    struct bootstrap_cancel_test_data *test_data = arg;
+    return test_data->setup_invoked;
+}
+
+static void s_bootstrap_cancel_on_setup(
+    struct aws_client_bootstrap *bootstrap,
+    int error_code,
+    struct aws_channel *channel,
+    void *user_data) {
+
+    (void)bootstrap;
+    (void)channel;
+
+    struct bootstrap_cancel_test_data *test_data = user_data;
+    aws_mutex_lock(&test_data->mutex);
+    test_data->setup_invoked = true;
+    test_data->setup_error_code = error_code;
+    aws_mutex_unlock(&test_data->mutex);
+    aws_condition_variable_notify_one(&test_data->condition_variable);
+}
+
+static void s_bootstrap_cancel_on_shutdown(
+    struct aws_client_bootstrap *bootstrap,
+    int error_code,
+    struct aws_channel *channel,
+    void *user_data) {
+
+    (void)bootstrap;
+    (void)error_code;
+    (void)channel;
+    (void)user_data;
+}
+
+static int s_test_client_connection_token_cancel_before_connect(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_io_library_init(allocator);
+
+    struct aws_event_loop_group *el_group = aws_event_loop_group_new_default(allocator, 1, NULL);
+
+    struct aws_host_resolver_default_options resolver_options = {
+        .el_group = el_group,
+        .max_entries = 2,
+    };
+    struct aws_host_resolver *resolver = aws_host_resolver_new_default(allocator, &resolver_options);
+
+    struct aws_client_bootstrap_options bootstrap_options = {
+        .event_loop_group = el_group,
+        .host_resolver = resolver,
+    };
+    struct aws_client_bootstrap *bootstrap = aws_client_bootstrap_new(allocator, &bootstrap_options);
+    ASSERT_NOT_NULL(bootstrap);
+
+    struct aws_socket_options options;
+    AWS_ZERO_STRUCT(options);
+    options.connect_timeout_ms = 3000;
+    options.type = AWS_SOCKET_STREAM;
+    options.domain = AWS_SOCKET_IPV4;
+
+    struct aws_client_connection_token *token = aws_client_connection_token_new(allocator);
+    ASSERT_NOT_NULL(token);
+
+    /* a token cancelled before the attempt starts fails the attempt synchronously */
+    aws_client_connection_token_cancel(token);
+
+    struct bootstrap_cancel_test_data test_data = {
+        .mutex = AWS_MUTEX_INIT,
+        .condition_variable = AWS_CONDITION_VARIABLE_INIT,
+    };
+
+    struct aws_socket_channel_bootstrap_options channel_options = {
+        .bootstrap = bootstrap,
+        .host_name = "127.0.0.1",
+        .port = 80,
+        .socket_options = &options,
+        .setup_callback = s_bootstrap_cancel_on_setup,
+        .shutdown_callback = s_bootstrap_cancel_on_shutdown,
+        .user_data = &test_data,
+        .cancellation_token = token,
+    };
+
+    ASSERT_ERROR(AWS_ERROR_IO_OPERATION_CANCELLED, aws_client_bootstrap_new_socket_channel(&channel_options));
+    ASSERT_FALSE(test_data.setup_invoked);
+
+    /* cancelling again is a harmless no-op */
+    aws_client_connection_token_cancel(token);
+
+    aws_client_connection_token_release(token);
+    aws_client_bootstrap_release(bootstrap);
+    aws_host_resolver_release(resolver);
+    aws_event_loop_group_release(el_group);
+
+    aws_io_library_clean_up();
+
+    return 0;
+}
+
+AWS_TEST_CASE(client_connection_token_cancel_before_connect, s_test_client_connection_token_cancel_before_connect)
+
+/* shared driver: kicks off a connection to a black-holed endpoint with a generous per-attempt connect
+ * timeout, then aborts it via 'token' or lets 'overall_timeout_ms' expire, and returns the setup error */
+static int s_run_blackholed_connection(
+    struct aws_allocator *allocator,
+    struct aws_client_connection_token *token,
+    uint64_t overall_timeout_ms,
+    int *out_setup_error_code) {
+
+    struct aws_event_loop_group *el_group = aws_event_loop_group_new_default(allocator, 1, NULL);
+
+    struct aws_host_resolver_default_options resolver_options = {
+        .el_group = el_group,
+        .max_entries = 2,
+    };
+    struct aws_host_resolver *resolver = aws_host_resolver_new_default(allocator, &resolver_options);
+
+    struct aws_client_bootstrap_options bootstrap_options = {
+        .event_loop_group = el_group,
+        .host_resolver = resolver,
+    };
+    struct aws_client_bootstrap *bootstrap = aws_client_bootstrap_new(allocator, &bootstrap_options);
+    ASSERT_NOT_NULL(bootstrap);
+
+    struct aws_socket_options options;
+    AWS_ZERO_STRUCT(options);
+    options.connect_timeout_ms = 10000;
+    options.type = AWS_SOCKET_STREAM;
+    options.domain = AWS_SOCKET_IPV4;
+
+    struct bootstrap_cancel_test_data test_data = {
+        .mutex = AWS_MUTEX_INIT,
+        .condition_variable = AWS_CONDITION_VARIABLE_INIT,
+    };
+
+    /* This ec2 instance sits in a VPC that makes sure port 81 is black-holed (no TCP SYN should be received). */
+    struct aws_socket_channel_bootstrap_options channel_options = {
+        .bootstrap = bootstrap,
+        .host_name = "ec2-54-158-231-48.compute-1.amazonaws.com",
+        .port = 81,
+        .socket_options = &options,
+        .setup_callback = s_bootstrap_cancel_on_setup,
+        .shutdown_callback = s_bootstrap_cancel_on_shutdown,
+        .user_data = &test_data,
+        .overall_timeout_ms = overall_timeout_ms,
+        .cancellation_token = token,
+    };
+
+    ASSERT_SUCCESS(aws_client_bootstrap_new_socket_channel(&channel_options));
+
+    if (token != NULL) {
+        aws_client_connection_token_cancel(token);
+    }
+
+    aws_mutex_lock(&test_data.mutex);
+    ASSERT_SUCCESS(aws_condition_variable_wait_pred(
+        &test_data.condition_variable, &test_data.mutex, s_bootstrap_cancel_setup_invoked_predicate, &test_data));
+    aws_mutex_unlock(&test_data.mutex);
+
+    *out_setup_error_code = test_data.setup_error_code;
+
+    aws_client_bootstrap_release(bootstrap);
+    aws_host_resolver_release(resolver);
+    aws_event_loop_group_release(el_group);
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_test_client_connection_token_cancels_in_flight_connect(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_io_library_init(allocator);
+
+    struct aws_client_connection_token *token = aws_client_connection_token_new(allocator);
+    ASSERT_NOT_NULL(token);
+
+    int setup_error_code = 0;
+    ASSERT_SUCCESS(s_run_blackholed_connection(allocator, token, 0 /*overall_timeout_ms*/, &setup_error_code));
+    ASSERT_INT_EQUALS(AWS_ERROR_IO_OPERATION_CANCELLED, setup_error_code);
+
+    aws_client_connection_token_release(token);
+
+    aws_io_library_clean_up();
+
+    return 0;
+}
+
+AWS_TEST_CASE(
+    client_connection_token_cancels_in_flight_connect,
+    s_test_client_connection_token_cancels_in_flight_connect)
+
+static int s_test_client_connection_overall_timeout(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_io_library_init(allocator);
+
+    /* the 500ms overall budget must fire long before the 10s per-attempt connect timeout */
+    int setup_error_code = 0;
+    ASSERT_SUCCESS(s_run_blackholed_connection(allocator, NULL /*token*/, 500 /*overall_timeout_ms*/, &setup_error_code));
+    ASSERT_INT_EQUALS(AWS_IO_SOCKET_TIMEOUT, setup_error_code);
+
+    aws_io_library_clean_up();
+
+    return 0;
+}
+
+AWS_TEST_CASE(client_connection_overall_timeout, s_test_client_connection_overall_timeout)
+
 struct error_test_args {
     int error_code;
     struct aws_mutex mutex;
@@ -0,0 +1,135 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/io/statistics_sink.h>
+
+#include <aws/testing/aws_test_harness.h>
+
+#ifndef _WIN32
+
+#    include <fcntl.h>
+#    include <string.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
+
+static const char *s_test_shm_name = "/aws-c-io-statistics-sink-test";
+
+static uint32_t s_read_u32(const uint8_t *base, size_t offset) {
+    uint32_t value;
+    memcpy(&value, base + offset, sizeof(value));
+    return value;
+}
+
+static uint64_t s_read_u64(const uint8_t *base, size_t offset) {
+    uint64_t value;
+    memcpy(&value, base + offset, sizeof(value));
+    return value;
+}
+
+/*
+ * Publishes records through the sink API, then scrapes them back through a second mapping of the
+ * segment using only the raw byte offsets documented in statistics_sink.h — the same way an
+ * out-of-process agent would.
+ */
+static int s_test_shm_stats_sink_publish_and_scrape(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_shm_stats_sink_options options = {
+        .shm_name = s_test_shm_name,
+        .ring_count = 4,
+        .ring_capacity = 8,
+    };
+
+    struct aws_shm_stats_sink *sink = aws_shm_stats_sink_new(allocator, &options);
+    ASSERT_NOT_NULL(sink);
+
+    /* Rings are keyed by pointer identity; any stable address stands in for an event loop here. */
+    int loop_marker = 0;
+    struct aws_event_loop *fake_loop = (struct aws_event_loop *)&loop_marker;
+
+    struct aws_shm_stats_ring *ring = aws_shm_stats_sink_ring_for_event_loop(sink, fake_loop);
+    ASSERT_NOT_NULL(ring);
+
+    /* Re-acquiring for the same loop must return the claimed ring, not burn a fresh one. */
+    ASSERT_PTR_EQUALS(ring, aws_shm_stats_sink_ring_for_event_loop(sink, fake_loop));
+
+    for (uint64_t i = 0; i < 3; ++i) {
+        struct aws_shm_stats_record record = {
+            .timestamp_ns = 1000 + i,
+            .owner_id = 0xC0FFEE,
+            .bytes_read = 100 * (i + 1),
+            .bytes_written = 200 * (i + 1),
+            .bytes_queued_write = 10,
+            .read_window_remaining = 16 * 1024,
+            .tls_handshake_status = 2,
+        };
+        aws_shm_stats_ring_publish(ring, &record);
+    }
+
+    /* Scrape side: independent mapping, raw layout. */
+    int fd = shm_open(s_test_shm_name, O_RDONLY, 0);
+    ASSERT_TRUE(fd >= 0);
+
+    const size_t segment_size = 64 /*header*/ + 4 * 64 /*ring headers*/ + 4 * 8 * 64 /*records*/;
+    const uint8_t *base = mmap(NULL, segment_size, PROT_READ, MAP_SHARED, fd, 0);
+    ASSERT_TRUE(base != MAP_FAILED);
+
+    ASSERT_UINT_EQUALS(0x41575353, s_read_u32(base, 0)); /* magic */
+    ASSERT_UINT_EQUALS(1, s_read_u32(base, 4));          /* layout_version */
+    ASSERT_UINT_EQUALS(4, s_read_u32(base, 8));          /* ring_count */
+    ASSERT_UINT_EQUALS(8, s_read_u32(base, 12));         /* ring_capacity */
+    ASSERT_UINT_EQUALS(64, s_read_u32(base, 16));        /* record_size */
+
+    const size_t ring0_header = 64;
+    ASSERT_UINT_EQUALS(3, s_read_u64(base, ring0_header));                             /* head */
+    ASSERT_UINT_EQUALS((uint64_t)(uintptr_t)fake_loop, s_read_u64(base, ring0_header + 8)); /* owner */
+
+    const size_t ring0_records = 64 + 4 * 64;
+    for (uint64_t i = 0; i < 3; ++i) {
+        const size_t record_offset = ring0_records + (size_t)i * 64;
+        ASSERT_UINT_EQUALS(1000 + i, s_read_u64(base, record_offset));
+        ASSERT_UINT_EQUALS(0xC0FFEE, s_read_u64(base, record_offset + 8));
+        ASSERT_UINT_EQUALS(100 * (i + 1), s_read_u64(base, record_offset + 16)); /* bytes_read */
+        ASSERT_UINT_EQUALS(200 * (i + 1), s_read_u64(base, record_offset + 24)); /* bytes_written */
+        ASSERT_UINT_EQUALS(2, s_read_u64(base, record_offset + 48));             /* tls_handshake_status */
+    }
+
+    munmap((void *)base, segment_size);
+    close(fd);
+
+    aws_shm_stats_sink_destroy(sink);
+
+    /* destroy unlinks the segment */
+    ASSERT_TRUE(shm_open(s_test_shm_name, O_RDONLY, 0) < 0);
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(shm_stats_sink_publish_and_scrape, s_test_shm_stats_sink_publish_and_scrape)
+
+static int s_test_shm_stats_sink_ring_exhaustion(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_shm_stats_sink_options options = {
+        .shm_name = s_test_shm_name,
+        .ring_count = 2,
+        .ring_capacity = 8,
+    };
+
+    struct aws_shm_stats_sink *sink = aws_shm_stats_sink_new(allocator, &options);
+    ASSERT_NOT_NULL(sink);
+
+    int markers[3] = {0};
+    ASSERT_NOT_NULL(aws_shm_stats_sink_ring_for_event_loop(sink, (struct aws_event_loop *)&markers[0]));
+    ASSERT_NOT_NULL(aws_shm_stats_sink_ring_for_event_loop(sink, (struct aws_event_loop *)&markers[1]));
+
+    ASSERT_NULL(aws_shm_stats_sink_ring_for_event_loop(sink, (struct aws_event_loop *)&markers[2]));
+    ASSERT_UINT_EQUALS(AWS_ERROR_INVALID_STATE, aws_last_error());
+
+    aws_shm_stats_sink_destroy(sink);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(shm_stats_sink_ring_exhaustion, s_test_shm_stats_sink_ring_exhaustion)
+
+#endif /* !_WIN32 */
@@ -441,3 +441,150 @@ static int s_test_input_stream_read_only(struct aws_allocator *allocator, void *
 }
 
 AWS_TEST_CASE(test_input_stream_read_only, s_test_input_stream_read_only);
+
+static int s_do_input_stream_readv_test(struct aws_input_stream *stream, struct aws_allocator *allocator) {
+    /* split "SimpleTest" across two buffers with one call */
+    struct aws_byte_buf dest_array[2];
+    aws_byte_buf_init(&dest_array[0], allocator, 4);
+    aws_byte_buf_init(&dest_array[1], allocator, 16);
+
+    ASSERT_SUCCESS(aws_input_stream_readv(stream, dest_array, 2));
+
+    ASSERT_BIN_ARRAYS_EQUALS("Simp", 4, dest_array[0].buffer, dest_array[0].len);
+    ASSERT_BIN_ARRAYS_EQUALS("leTest", 6, dest_array[1].buffer, dest_array[1].len);
+
+    struct aws_stream_status status;
+    AWS_ZERO_STRUCT(status);
+    ASSERT_SUCCESS(aws_input_stream_get_status(stream, &status));
+    ASSERT_TRUE(status.is_valid);
+
+    aws_byte_buf_clean_up(&dest_array[0]);
+    aws_byte_buf_clean_up(&dest_array[1]);
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_test_input_stream_memory_readv(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_input_stream *stream = s_create_memory_stream(allocator);
+
+    ASSERT_TRUE(s_do_input_stream_readv_test(stream, allocator) == AWS_OP_SUCCESS);
+
+    s_destroy_memory_stream(stream);
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(test_input_stream_memory_readv, s_test_input_stream_memory_readv);
+
+static int s_test_input_stream_file_readv(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    const char *file_path = "test_input_stream_file_readv.txt"; /* unique name */
+    struct aws_input_stream *stream = s_create_file_stream(allocator, file_path);
+
+    ASSERT_TRUE(s_do_input_stream_readv_test(stream, allocator) == AWS_OP_SUCCESS);
+
+    s_destroy_file_stream(stream, file_path);
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(test_input_stream_file_readv, s_test_input_stream_file_readv);
+
+static struct aws_input_stream *s_create_mapped_file_stream(struct aws_allocator *allocator, const char *file_path) {
+    remove(file_path);
+
+    FILE *file = aws_fopen(file_path, "w");
+    fprintf(file, "%s", (char *)s_simple_test->bytes);
+    fclose(file);
+
+    return aws_input_stream_new_from_file_mapped(allocator, file_path);
+}
+
+static int s_test_input_stream_file_mapped_iterate(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    const char *file_path = "test_input_stream_file_mapped_iterate.txt"; /* unique name */
+    struct aws_input_stream *stream = s_create_mapped_file_stream(allocator, file_path);
+    ASSERT_NOT_NULL(stream);
+
+    struct aws_byte_cursor test_cursor = aws_byte_cursor_from_string(s_simple_test);
+    ASSERT_TRUE(s_do_simple_input_stream_test(stream, allocator, 2, &test_cursor) == AWS_OP_SUCCESS);
+
+    s_destroy_file_stream(stream, file_path);
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(test_input_stream_file_mapped_iterate, s_test_input_stream_file_mapped_iterate);
+
+static int s_test_input_stream_file_mapped_seek(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    const char *file_path = "test_input_stream_file_mapped_seek.txt"; /* unique name */
+    struct aws_input_stream *stream = s_create_mapped_file_stream(allocator, file_path);
+    ASSERT_NOT_NULL(stream);
+
+    struct aws_byte_cursor test_cursor = aws_byte_cursor_from_string(s_simple_test);
+    aws_byte_cursor_advance(&test_cursor, SEEK_BEGINNING_OFFSET);
+    ASSERT_TRUE(
+        s_do_input_stream_seek_test(stream, allocator, SEEK_BEGINNING_OFFSET, AWS_SSB_BEGIN, &test_cursor) ==
+        AWS_OP_SUCCESS);
+
+    s_destroy_file_stream(stream, file_path);
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(test_input_stream_file_mapped_seek, s_test_input_stream_file_mapped_seek);
+
+static struct aws_input_stream *s_create_unbuffered_file_stream(
+    struct aws_allocator *allocator,
+    const char *file_path) {
+    remove(file_path);
+
+    FILE *file = aws_fopen(file_path, "w");
+    fprintf(file, "%s", (char *)s_simple_test->bytes);
+    fclose(file);
+
+    return aws_input_stream_new_from_file_unbuffered(allocator, file_path);
+}
+
+static int s_test_input_stream_file_unbuffered_iterate(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    const char *file_path = "test_input_stream_file_unbuffered_iterate.txt"; /* unique name */
+    struct aws_input_stream *stream = s_create_unbuffered_file_stream(allocator, file_path);
+    ASSERT_NOT_NULL(stream);
+
+    struct aws_byte_cursor test_cursor = aws_byte_cursor_from_string(s_simple_test);
+    ASSERT_TRUE(s_do_simple_input_stream_test(stream, allocator, 2, &test_cursor) == AWS_OP_SUCCESS);
+
+    s_destroy_file_stream(stream, file_path);
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(test_input_stream_file_unbuffered_iterate, s_test_input_stream_file_unbuffered_iterate);
+
+static int s_test_input_stream_file_unbuffered_seek(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    const char *file_path = "test_input_stream_file_unbuffered_seek.txt"; /* unique name */
+    struct aws_input_stream *stream = s_create_unbuffered_file_stream(allocator, file_path);
+    ASSERT_NOT_NULL(stream);
+
+    struct aws_byte_cursor test_cursor = aws_byte_cursor_from_string(s_simple_test);
+    aws_byte_cursor_advance(&test_cursor, SEEK_BEGINNING_OFFSET);
+    ASSERT_TRUE(
+        s_do_input_stream_seek_test(stream, allocator, SEEK_BEGINNING_OFFSET, AWS_SSB_BEGIN, &test_cursor) ==
+        AWS_OP_SUCCESS);
+
+    s_destroy_file_stream(stream, file_path);
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(test_input_stream_file_unbuffered_seek, s_test_input_stream_file_unbuffered_seek);
@@ -2225,6 +2225,72 @@ static int s_tls_destroy_null_context(struct aws_allocator *allocator, void *ctx
 }
 AWS_TEST_CASE(tls_destroy_null_context, s_tls_destroy_null_context);
 
+static int s_tls_shared_trust_store_cache(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+#    ifdef _WIN32
+    struct aws_tls_ctx_options tls_options;
+    aws_tls_ctx_options_init_default_client(&tls_options, allocator);
+    ASSERT_ERROR(
+        AWS_ERROR_PLATFORM_NOT_SUPPORTED,
+        aws_tls_ctx_options_override_default_trust_store_from_shared_cache(&tls_options, "unused.pem", "unused.cache"));
+    aws_tls_ctx_options_clean_up(&tls_options);
+    return AWS_OP_SUCCESS;
+#    else
+    const char *bundle_path = "shared_trust_store_bundle.pem";
+    const char *cache_path = "shared_trust_store_cache.pem";
+
+    remove(bundle_path);
+    remove(cache_path);
+
+    /* comments around the object exercise sanitization; the cache must hold the clean form */
+    FILE *bundle_file = aws_fopen(bundle_path, "w");
+    ASSERT_NOT_NULL(bundle_file);
+    fprintf(
+        bundle_file,
+        "# comment before\n-----BEGIN CERTIFICATE-----\nZm9vYmFy\n-----END CERTIFICATE-----\n# comment after\n");
+    fclose(bundle_file);
+
+    /* first process: builds the cache from the source bundle */
+    struct aws_tls_ctx_options first_options;
+    aws_tls_ctx_options_init_default_client(&first_options, allocator);
+    ASSERT_SUCCESS(
+        aws_tls_ctx_options_override_default_trust_store_from_shared_cache(&first_options, bundle_path, cache_path));
+    ASSERT_NOT_NULL(first_options.ca_file_shared_mapping);
+    ASSERT_TRUE(first_options.ca_file.len > 0);
+
+    struct aws_byte_buf first_contents;
+    ASSERT_SUCCESS(aws_byte_buf_init_copy(&first_contents, allocator, &first_options.ca_file));
+    aws_tls_ctx_options_clean_up(&first_options);
+
+    /* later process: attaches to the existing cache without a source bundle */
+    struct aws_tls_ctx_options second_options;
+    aws_tls_ctx_options_init_default_client(&second_options, allocator);
+    ASSERT_SUCCESS(
+        aws_tls_ctx_options_override_default_trust_store_from_shared_cache(&second_options, NULL, cache_path));
+    ASSERT_NOT_NULL(second_options.ca_file_shared_mapping);
+    ASSERT_BIN_ARRAYS_EQUALS(
+        first_contents.buffer, first_contents.len, second_options.ca_file.buffer, second_options.ca_file.len);
+    aws_tls_ctx_options_clean_up(&second_options);
+
+    /* a missing cache with no source bundle has nothing to build from */
+    struct aws_tls_ctx_options missing_options;
+    aws_tls_ctx_options_init_default_client(&missing_options, allocator);
+    ASSERT_ERROR(
+        AWS_ERROR_FILE_INVALID_PATH,
+        aws_tls_ctx_options_override_default_trust_store_from_shared_cache(
+            &missing_options, NULL, "shared_trust_store_nonexistent.pem"));
+    aws_tls_ctx_options_clean_up(&missing_options);
+
+    aws_byte_buf_clean_up(&first_contents);
+    remove(bundle_path);
+    remove(cache_path);
+
+    return AWS_OP_SUCCESS;
+#    endif /* _WIN32 */
+}
+AWS_TEST_CASE(tls_shared_trust_store_cache, s_tls_shared_trust_store_cache);
+
 static int s_test_ecc_cert_import(struct aws_allocator *allocator, void *ctx) {
     (void)ctx;
     (void)allocator;